@@ -19,6 +19,7 @@
 #include <Lumos/Core/Application.h>
 #include <Lumos/Core/OS/Input.h>
 #include <Lumos/Core/OS/FileSystem.h>
+#include <Lumos/Core/OS/PakArchive.h>
 #include <Lumos/Core/OS/OS.h>
 #include <Lumos/Core/Version.h>
 #include <Lumos/Core/Engine.h>
@@ -26,6 +27,7 @@
 #include <Lumos/Audio/AudioManager.h>
 #include <Lumos/Scene/Scene.h>
 #include <Lumos/Scene/SceneManager.h>
+#include <Lumos/Scene/SceneBVH.h>
 #include <Lumos/Scene/Entity.h>
 #include <Lumos/Scene/EntityManager.h>
 #include <Lumos/Events/ApplicationEvent.h>
@@ -596,6 +598,19 @@ namespace Lumos
                     openReloadScenePopup = true;
                 }
 
+                if(ImGui::MenuItem("Build Asset Pak"))
+                {
+                    // Loose files still override it in the editor, so it only needs rebuilding before shipping.
+                    // The mounted archive maps the file being replaced, so it's unmounted for the build once
+                    // queued reads, which keep it mapped while they run, have finished
+                    const std::string pakPath = m_ProjectSettings.m_ProjectRoot + "Assets.lpak";
+                    FileSystem::Get().WaitForAsyncReads();
+                    FileSystem::Get().UnmountPaks();
+                    PakArchive::Build(m_ProjectSettings.m_ProjectRoot + "Assets", pakPath);
+                    if(FileSystem::FileExists(pakPath))
+                        FileSystem::Get().MountPak(pakPath);
+                }
+
                 ImGui::Separator();
 
                 if(ImGui::BeginMenu("Style"))
@@ -2430,7 +2445,8 @@ namespace Lumos
     void Editor::SelectObject(const Maths::Ray& ray, bool hoveredOnly)
     {
         LUMOS_PROFILE_FUNCTION();
-        auto& registry                    = Application::Get().GetSceneManager()->GetCurrentScene()->GetRegistry();
+        Scene* scene                      = Application::Get().GetSceneManager()->GetCurrentScene();
+        auto& registry                    = scene->GetRegistry();
         float closestEntityDist           = Maths::M_INFINITY;
         entt::entity currentClosestEntity = entt::null;
 
@@ -2439,8 +2455,19 @@ namespace Lumos
         static Timer timer;
         static float timeSinceLastSelect = 0.0f;
 
-        for(auto entity : group)
+        // Sorted by distance to each entity's bounds, which no mesh or sprite inside can be closer than
+        std::vector<SceneBVH::RayHit> hits;
+        scene->GetBVH()->RayCastAll(ray, Maths::M_INFINITY, hits);
+
+        for(auto& hit : hits)
         {
+            if(hit.Distance >= closestEntityDist)
+                break;
+
+            entt::entity entity = hit.Entity;
+            if(!group.contains(entity))
+                continue;
+
             const auto& [model, trans] = group.get<Graphics::ModelComponent, Maths::Transform>(entity);
 
             auto& meshes = model.ModelRef->GetMeshes();
@@ -2499,8 +2526,15 @@ namespace Lumos
 
         auto spriteGroup = registry.group<Graphics::Sprite>(entt::get<Maths::Transform>);
 
-        for(auto entity : spriteGroup)
+        for(auto& hit : hits)
         {
+            if(hit.Distance >= closestEntityDist)
+                break;
+
+            entt::entity entity = hit.Entity;
+            if(!spriteGroup.contains(entity))
+                continue;
+
             const auto& [sprite, trans] = spriteGroup.get<Graphics::Sprite, Maths::Transform>(entity);
 
             auto& worldTransform = trans.GetWorldMatrix();
@@ -2521,8 +2555,15 @@ namespace Lumos
 
         auto animSpriteGroup = registry.group<Graphics::AnimatedSprite>(entt::get<Maths::Transform>);
 
-        for(auto entity : animSpriteGroup)
+        for(auto& hit : hits)
         {
+            if(hit.Distance >= closestEntityDist)
+                break;
+
+            entt::entity entity = hit.Entity;
+            if(!animSpriteGroup.contains(entity))
+                continue;
+
             const auto& [sprite, trans] = animSpriteGroup.get<Graphics::AnimatedSprite, Maths::Transform>(entity);
 
             auto& worldTransform = trans.GetWorldMatrix();
@@ -2739,7 +2780,10 @@ namespace Lumos
         {
             std::string physicalPath;
             Lumos::FileSystem::Get().ResolvePhysicalPath(path, physicalPath);
-            auto sound = Sound::Create(physicalPath, StringUtilities::GetFilePathExtension(path));
+
+            // Opened as a positional sound, so stereo is down mixed to mono. Preserve Stereo in the inspector reloads it
+            const bool preserveStereo = false;
+            auto sound                = Sound::Create(physicalPath, StringUtilities::GetFilePathExtension(path), preserveStereo);
 
             auto soundNode = SharedPtr<SoundNode>(SoundNode::Create());
             soundNode->SetSound(sound);
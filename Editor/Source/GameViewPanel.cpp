@@ -230,6 +230,10 @@ namespace Lumos
 
                 ImGui::Text("Num Rendered Objects %u", RenderPassesStats.NumRenderedObjects);
                 ImGui::Text("Num Shadow Objects %u", RenderPassesStats.NumShadowObjects);
+                ImGui::Text("Num Clustered Lights %u", RenderPassesStats.NumClusteredLights);
+                if(RenderPassesStats.NumDroppedClusterLights > 0)
+                    ImGui::Text("Dropped Cluster Lights %u", RenderPassesStats.NumDroppedClusterLights);
+                ImGui::Text("Num Occluded Objects %u", RenderPassesStats.NumOccludedObjects);
                 ImGui::Text("Num Draw Calls  %u", RenderPassesStats.NumDrawCalls);
                 ImGui::Text("Used GPU Memory : %.1f mb | Total : %.1f mb", stats.UsedGPUMemory * 0.000001f, stats.TotalGPUMemory * 0.000001f);
 
@@ -425,9 +425,7 @@ namespace Lumos
                 ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0.7f, 0.7f, 0.7f, 0.0f));
                 if(ImGui::Button(active ? ICON_MDI_EYE : ICON_MDI_EYE_OFF))
                 {
-                    auto& activeComponent = registry.get_or_emplace<ActiveComponent>(node);
-
-                    activeComponent.active = !active;
+                    registry.emplace_or_replace<ActiveComponent>(node, !active);
                 }
                 ImGui::PopStyleColor();
             }
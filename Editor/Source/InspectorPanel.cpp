@@ -591,6 +591,8 @@ end
         auto friction        = phys.GetRigidBody()->GetFriction();
         auto isStatic        = phys.GetRigidBody()->GetIsStatic();
         auto isRest          = phys.GetRigidBody()->GetIsAtRest();
+        auto continuous      = phys.GetRigidBody()->GetContinuousCollision();
+        int collisionLayer   = phys.GetRigidBody()->GetCollisionLayer();
         auto mass            = 1.0f / phys.GetRigidBody()->GetInverseMass();
         auto velocity        = phys.GetRigidBody()->GetLinearVelocity();
         auto elasticity      = phys.GetRigidBody()->GetElasticity();
@@ -637,6 +639,13 @@ end
         if(Lumos::ImGuiUtilities::Property("At Rest", isRest))
             phys.GetRigidBody()->SetIsAtRest(isRest);
 
+        if(Lumos::ImGuiUtilities::Property("Continuous Collision", continuous))
+            phys.GetRigidBody()->SetContinuousCollision(continuous);
+
+        // Scene queries only see bodies whose layer is set in their layer mask
+        if(Lumos::ImGuiUtilities::Property("Collision Layer", collisionLayer, 0, 31))
+            phys.GetRigidBody()->SetCollisionLayer(uint16_t(collisionLayer));
+
         if(Lumos::ImGuiUtilities::Property("Angular Factor", angularFactor))
             phys.GetRigidBody()->SetAngularFactor(angularFactor);
 
@@ -825,6 +834,7 @@ end
         auto volume            = soundNode->GetVolume();
         auto referenceDistance = soundNode->GetReferenceDistance();
         auto rollOffFactor     = soundNode->GetRollOffFactor();
+        auto priority          = soundNode->GetPriority();
 
         ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(2, 2));
         ImGui::Columns(2);
@@ -866,6 +876,12 @@ end
             updated = true;
         }
 
+        if(Lumos::ImGuiUtilities::Property("Priority", priority, 0.0f, 10.0f, 0.1f))
+        {
+            soundNode->SetPriority(priority);
+            updated = true;
+        }
+
         if(Lumos::ImGuiUtilities::Property("Paused", paused))
         {
             soundNode->SetPaused(paused);
@@ -895,7 +911,7 @@ end
                     {
                         std::string physicalPath;
                         Lumos::FileSystem::Get().ResolvePhysicalPath(filePath, physicalPath);
-                        auto newSound = Lumos::Sound::Create(physicalPath, Lumos::StringUtilities::GetFilePathExtension(filePath));
+                        auto newSound = Lumos::Sound::Create(physicalPath, Lumos::StringUtilities::GetFilePathExtension(filePath), soundPointer && soundPointer->GetPreserveStereo());
 
                         soundNode->SetSound(newSound);
                     }
@@ -919,7 +935,14 @@ end
             Lumos::ImGuiUtilities::Property("Length", length, 0.0, 0.0, Lumos::ImGuiUtilities::PropertyFlag::ReadOnly);
             Lumos::ImGuiUtilities::Property("Channels", channels, 0, 0, Lumos::ImGuiUtilities::PropertyFlag::ReadOnly);
 
-            if(updated)
+            // Stereo is down mixed to mono while loading, so changing it reloads the sound
+            bool preserveStereo = soundPointer->GetPreserveStereo();
+            if(Lumos::ImGuiUtilities::Property("Preserve Stereo", preserveStereo))
+            {
+                const std::string& soundPath = soundPointer->GetFilePath();
+                soundNode->SetSound(Lumos::Sound::Create(soundPath, Lumos::StringUtilities::GetFilePathExtension(soundPath), preserveStereo));
+            }
+            else if(updated)
                 soundNode->SetSound(soundPointer);
         }
 
@@ -2056,6 +2079,9 @@ end
                         if(reg.get<Lumos::Graphics::ModelComponent>(e).ModelRef)
                             model.SetPrimitiveType(Lumos::Graphics::PrimitiveType::File);
                     }
+
+                    // The meshes were swapped in place so let listeners know the bounds changed
+                    reg.patch<Lumos::Graphics::ModelComponent>(e);
                 }
                 if(is_selected)
                     ImGui::SetItemDefaultFocus();
@@ -2396,6 +2422,334 @@ end
                         }
                         ImGui::EndCombo();
                     }
+                    ImGui::PopItemWidth();
+                    ImGui::NextColumn();
+
+                    auto controller        = modelRef->GetOrCreateAnimationController();
+                    const auto& stateNames = controller->GetStateNames();
+
+                    // Draws only the combo, AnyState is listed first when allowAny is set
+                    auto stateCombo = [&stateNames](const char* id, size_t& state, bool allowAny)
+                    {
+                        bool updated        = false;
+                        const char* preview = state < stateNames.size() ? stateNames[state].c_str() : "Any";
+                        ImGui::PushItemWidth(-1);
+                        if(ImGui::BeginCombo(id, preview, 0))
+                        {
+                            if(allowAny && ImGui::Selectable("Any", state == Graphics::AnimationTransition::AnyState))
+                            {
+                                state   = Graphics::AnimationTransition::AnyState;
+                                updated = true;
+                            }
+                            for(size_t n = 0; n < stateNames.size(); n++)
+                            {
+                                if(ImGui::Selectable(stateNames[n].c_str(), state == n))
+                                {
+                                    state   = n;
+                                    updated = true;
+                                }
+                            }
+                            ImGui::EndCombo();
+                        }
+                        ImGui::PopItemWidth();
+                        return updated;
+                    };
+
+                    uint32_t jointLOD = controller->GetJointLOD();
+                    if(Lumos::ImGuiUtilities::Property("Joint LOD", jointLOD))
+                        controller->SetJointLOD(jointLOD);
+                    ImGuiUtilities::Tooltip("Joints deeper than this follow their parent in rest pose, zero evaluates every joint");
+
+                    ImGui::Columns(1);
+                    if(ImGui::TreeNode("Parameters"))
+                    {
+                        ImGui::Columns(2);
+                        std::string parameterToRemove;
+                        for(const auto& parameter : controller->GetParameters())
+                        {
+                            ImGui::PushID(parameter.Name.c_str());
+                            ImGui::AlignTextToFramePadding();
+                            ImGui::TextUnformatted(parameter.Name.c_str());
+                            ImGui::NextColumn();
+
+                            float value = parameter.Value;
+                            ImGui::PushItemWidth(-ImGui::GetFontSize() * 2.0f);
+                            if(ImGui::DragFloat("##Value", &value, 0.01f))
+                                controller->SetParameter(parameter.Name, value);
+                            ImGui::PopItemWidth();
+
+                            ImGui::SameLine();
+                            if(ImGui::Button(ICON_MDI_MINUS))
+                                parameterToRemove = parameter.Name;
+                            ImGuiUtilities::Tooltip("Remove Parameter");
+                            ImGui::NextColumn();
+                            ImGui::PopID();
+                        }
+
+                        if(!parameterToRemove.empty())
+                            controller->RemoveParameter(parameterToRemove);
+
+                        static char newParameter[INPUT_BUF_SIZE];
+                        ImGui::AlignTextToFramePadding();
+                        ImGui::TextUnformatted("New Parameter");
+                        ImGui::NextColumn();
+                        ImGui::PushItemWidth(-ImGui::GetFontSize() * 2.0f);
+                        ImGui::InputText("##NewParameter", newParameter, IM_ARRAYSIZE(newParameter));
+                        ImGui::PopItemWidth();
+                        ImGui::SameLine();
+                        if(ImGui::Button(ICON_MDI_PLUS "##AddParameter") && newParameter[0] != '\0')
+                        {
+                            controller->SetParameter(newParameter, controller->GetParameter(newParameter));
+                            newParameter[0] = '\0';
+                        }
+                        ImGuiUtilities::Tooltip("Add Parameter");
+                        ImGui::NextColumn();
+
+                        ImGui::Columns(1);
+                        ImGui::TreePop();
+                    }
+
+                    bool transitionsOpen = ImGui::TreeNode("Transitions");
+                    ImGui::SameLine((ImGui::GetWindowContentRegionMax() - ImGui::GetWindowContentRegionMin()).x - ImGui::GetFontSize());
+                    ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0.7f, 0.7f, 0.7f, 0.0f));
+                    if(ImGui::Button(ICON_MDI_PLUS "##AddTransition"))
+                        controller->AddTransition(Graphics::AnimationTransition());
+                    ImGuiUtilities::Tooltip("Add Transition");
+                    ImGui::PopStyleColor();
+
+                    if(transitionsOpen)
+                    {
+                        Vector<const char*> parameterNames(Application::Get().GetFrameArena());
+                        parameterNames.PushBack("None");
+                        for(const auto& parameter : controller->GetParameters())
+                            parameterNames.PushBack(parameter.Name.c_str());
+
+                        size_t transitionToRemove = Graphics::AnimationTransition::AnyState;
+                        for(size_t i = 0; i < controller->GetTransitions().size(); i++)
+                        {
+                            Graphics::AnimationTransition transition = controller->GetTransitions()[i];
+                            const char* from                         = transition.FromState < stateNames.size() ? stateNames[transition.FromState].c_str() : "Any";
+
+                            ImGui::PushID((int)i);
+                            bool open = ImGui::TreeNode("##Transition", "%s -> %s", from, stateNames[transition.ToState].c_str());
+
+                            ImGui::SameLine((ImGui::GetWindowContentRegionMax() - ImGui::GetWindowContentRegionMin()).x - ImGui::GetFontSize());
+                            ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0.7f, 0.7f, 0.7f, 0.0f));
+                            if(ImGui::Button(ICON_MDI_MINUS))
+                                transitionToRemove = i;
+                            ImGuiUtilities::Tooltip("Remove Transition");
+                            ImGui::PopStyleColor();
+
+                            if(open)
+                            {
+                                ImGui::Columns(2);
+                                bool updated = false;
+
+                                ImGui::AlignTextToFramePadding();
+                                ImGui::TextUnformatted("From");
+                                ImGui::NextColumn();
+                                updated |= stateCombo("##From", transition.FromState, true);
+                                ImGui::NextColumn();
+
+                                ImGui::AlignTextToFramePadding();
+                                ImGui::TextUnformatted("To");
+                                ImGui::NextColumn();
+                                updated |= stateCombo("##To", transition.ToState, false);
+                                ImGui::NextColumn();
+
+                                updated |= Lumos::ImGuiUtilities::Property("Duration", transition.Duration, 0.0f, 10.0f, 0.01f, Lumos::ImGuiUtilities::PropertyFlag::DragValue);
+                                updated |= Lumos::ImGuiUtilities::Property("Exit Time", transition.ExitTime, 0.0f, 1.0f, 0.01f, Lumos::ImGuiUtilities::PropertyFlag::SliderValue);
+
+                                int32_t parameterIndex = 0;
+                                for(int32_t n = 1; n < (int32_t)parameterNames.Size(); n++)
+                                {
+                                    if(transition.Parameter == parameterNames[n])
+                                        parameterIndex = n;
+                                }
+
+                                // A parameter that was removed stays on the transition until another is picked
+                                if(!transition.Parameter.empty() && parameterIndex == 0)
+                                    Lumos::ImGuiUtilities::PropertyConst("Missing Parameter", transition.Parameter.c_str());
+
+                                if(Lumos::ImGuiUtilities::PropertyDropdown("Parameter", parameterNames.Data(), (int32_t)parameterNames.Size(), &parameterIndex))
+                                {
+                                    transition.Parameter = parameterIndex == 0 ? std::string() : std::string(parameterNames[parameterIndex]);
+                                    updated              = true;
+                                }
+
+                                if(!transition.Parameter.empty())
+                                {
+                                    const char* modes[] = { "Greater", "Less" };
+                                    int32_t mode        = (int32_t)transition.Mode;
+                                    if(Lumos::ImGuiUtilities::PropertyDropdown("Condition", modes, 2, &mode))
+                                    {
+                                        transition.Mode = (Graphics::AnimationConditionMode)mode;
+                                        updated         = true;
+                                    }
+                                    updated |= Lumos::ImGuiUtilities::Property("Threshold", transition.Threshold, 0.0f, 0.0f, 0.01f, Lumos::ImGuiUtilities::PropertyFlag::DragValue);
+                                }
+
+                                if(updated)
+                                    controller->SetTransition(i, transition);
+
+                                ImGui::Columns(1);
+                                ImGui::TreePop();
+                            }
+                            ImGui::PopID();
+                        }
+
+                        if(transitionToRemove != Graphics::AnimationTransition::AnyState)
+                            controller->RemoveTransition(transitionToRemove);
+
+                        ImGui::TreePop();
+                    }
+
+                    bool layersOpen = ImGui::TreeNode("Layers");
+                    ImGui::SameLine((ImGui::GetWindowContentRegionMax() - ImGui::GetWindowContentRegionMin()).x - ImGui::GetFontSize());
+                    ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0.7f, 0.7f, 0.7f, 0.0f));
+                    if(ImGui::Button(ICON_MDI_PLUS "##AddLayer"))
+                        controller->AddLayer("Layer");
+                    ImGuiUtilities::Tooltip("Add Layer");
+                    ImGui::PopStyleColor();
+
+                    if(layersOpen)
+                    {
+                        const ozz::animation::Skeleton& skeleton = modelRef->GetSkeleton()->GetSkeleton();
+                        Vector<const char*> jointNames(Application::Get().GetFrameArena());
+                        jointNames.Reserve(skeleton.num_joints());
+                        for(const char* jointName : skeleton.joint_names())
+                            jointNames.PushBack(jointName);
+
+                        size_t layerToRemove = ~size_t(0);
+                        for(size_t i = 0; i < controller->GetLayers().size(); i++)
+                        {
+                            const Graphics::AnimationLayer& layer = controller->GetLayer(i);
+
+                            ImGui::PushID((int)i);
+                            bool open = ImGui::TreeNode("##Layer", "%s", layer.Name.c_str());
+
+                            ImGui::SameLine((ImGui::GetWindowContentRegionMax() - ImGui::GetWindowContentRegionMin()).x - ImGui::GetFontSize());
+                            ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0.7f, 0.7f, 0.7f, 0.0f));
+                            if(ImGui::Button(ICON_MDI_MINUS))
+                                layerToRemove = i;
+                            ImGuiUtilities::Tooltip("Remove Layer");
+                            ImGui::PopStyleColor();
+
+                            if(open)
+                            {
+                                ImGui::Columns(2);
+
+                                std::string name = layer.Name;
+                                if(Lumos::ImGuiUtilities::Property("Name", name, Lumos::ImGuiUtilities::PropertyFlag::None))
+                                    controller->SetLayerName(i, name);
+
+                                const char* modes[] = { "Override", "Additive" };
+                                int32_t mode        = (int32_t)layer.Mode;
+                                if(Lumos::ImGuiUtilities::PropertyDropdown("Mode", modes, 2, &mode))
+                                    controller->SetLayerBlendMode(i, (Graphics::AnimationBlendMode)mode);
+
+                                float weight = layer.Weight;
+                                if(Lumos::ImGuiUtilities::Property("Weight", weight, 0.0f, 1.0f, 0.01f, Lumos::ImGuiUtilities::PropertyFlag::SliderValue))
+                                    controller->SetLayerWeight(i, weight);
+
+                                float parameter = layer.Parameter;
+                                if(Lumos::ImGuiUtilities::Property("Blend Parameter", parameter, 0.0f, 0.0f, 0.01f, Lumos::ImGuiUtilities::PropertyFlag::DragValue))
+                                    controller->SetLayerParameter(i, parameter);
+
+                                ImGui::Columns(1);
+                                bool blendTreeOpen = ImGui::TreeNode("Blend Tree");
+                                ImGui::SameLine((ImGui::GetWindowContentRegionMax() - ImGui::GetWindowContentRegionMin()).x - ImGui::GetFontSize());
+                                ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0.7f, 0.7f, 0.7f, 0.0f));
+                                if(ImGui::Button(ICON_MDI_PLUS "##AddBlendState"))
+                                    controller->AddLayerBlendState(i, controller->GetCurrentState(), layer.BlendTree.empty() ? 0.0f : layer.BlendTree.back().Threshold + 1.0f);
+                                ImGuiUtilities::Tooltip("Add Blend State");
+                                ImGui::PopStyleColor();
+
+                                if(blendTreeOpen)
+                                {
+                                    // Entries are only added through the controller, so an edit rebuilds the tree
+                                    std::vector<Graphics::BlendTreeEntry> entries = layer.BlendTree;
+                                    bool updated                                  = false;
+                                    size_t entryToRemove                          = ~size_t(0);
+
+                                    ImGui::Columns(2);
+                                    for(size_t j = 0; j < entries.size(); j++)
+                                    {
+                                        ImGui::PushID((int)j);
+                                        updated |= stateCombo("##State", entries[j].StateIndex, false);
+                                        ImGui::NextColumn();
+
+                                        ImGui::PushItemWidth(-ImGui::GetFontSize() * 2.0f);
+                                        updated |= ImGui::DragFloat("##Threshold", &entries[j].Threshold, 0.01f);
+                                        ImGui::PopItemWidth();
+
+                                        ImGui::SameLine();
+                                        if(ImGui::Button(ICON_MDI_MINUS))
+                                            entryToRemove = j;
+                                        ImGuiUtilities::Tooltip("Remove Blend State");
+                                        ImGui::NextColumn();
+                                        ImGui::PopID();
+                                    }
+                                    ImGui::Columns(1);
+
+                                    if(entryToRemove < entries.size())
+                                    {
+                                        entries.erase(entries.begin() + entryToRemove);
+                                        updated = true;
+                                    }
+
+                                    if(updated)
+                                    {
+                                        controller->ClearLayerBlendStates(i);
+                                        for(const auto& entry : entries)
+                                            controller->AddLayerBlendState(i, entry.StateIndex, entry.Threshold);
+                                    }
+                                    ImGui::TreePop();
+                                }
+
+                                if(ImGui::TreeNode("Joint Mask"))
+                                {
+                                    ImGui::Columns(2);
+                                    const auto& mask = layer.GetJointMask();
+                                    if(mask.empty())
+                                        Lumos::ImGuiUtilities::PropertyConst("Joints", "All");
+
+                                    for(size_t j = 0; j < mask.size(); j++)
+                                    {
+                                        float jointWeight = mask[j];
+                                        if(jointWeight > 0.0f)
+                                            Lumos::ImGuiUtilities::Property(jointNames[(uint32_t)j], jointWeight, 0.0f, 1.0f, 0.0f, Lumos::ImGuiUtilities::PropertyFlag::ReadOnly);
+                                    }
+
+                                    static int32_t maskJoint  = 0;
+                                    static float maskWeight   = 1.0f;
+                                    static bool maskRecursive = true;
+                                    maskJoint                 = std::min(maskJoint, (int32_t)jointNames.Size() - 1);
+
+                                    Lumos::ImGuiUtilities::PropertyDropdown("Joint", jointNames.Data(), (int32_t)jointNames.Size(), &maskJoint);
+                                    Lumos::ImGuiUtilities::Property("Mask Weight", maskWeight, 0.0f, 1.0f, 0.01f, Lumos::ImGuiUtilities::PropertyFlag::SliderValue);
+                                    Lumos::ImGuiUtilities::Property("Include Children", maskRecursive);
+                                    ImGui::Columns(1);
+
+                                    if(ImGui::Button("Set Joint Weight"))
+                                        controller->SetLayerJointMask(i, jointNames[maskJoint], maskWeight, maskRecursive);
+                                    ImGui::SameLine();
+                                    if(ImGui::Button("Clear Mask"))
+                                        controller->ClearLayerJointMask(i);
+
+                                    ImGui::TreePop();
+                                }
+
+                                ImGui::TreePop();
+                            }
+                            ImGui::PopID();
+                        }
+
+                        if(layerToRemove < controller->GetLayers().size())
+                            controller->RemoveLayer(layerToRemove);
+
+                        ImGui::TreePop();
+                    }
                 }
                 ImGui::TreePop();
             }
@@ -2865,12 +3219,7 @@ namespace Lumos
             auto activeComponent = registry.try_get<ActiveComponent>(selected);
             bool active          = activeComponent ? activeComponent->active : true;
             if(ImGui::Checkbox("##ActiveCheckbox", &active))
-            {
-                if(!activeComponent)
-                    registry.emplace<ActiveComponent>(selected, active);
-                else
-                    activeComponent->active = active;
-            }
+                registry.emplace_or_replace<ActiveComponent>(selected, active);
             ImGui::SameLine();
             ImGui::TextUnformatted(ICON_MDI_CUBE);
             ImGui::SameLine();
@@ -2,6 +2,7 @@
 #include "Editor.h"
 
 #include <Lumos/Core/Profiler.h>
+#include <Lumos/Graphics/Model.h>
 
 namespace Lumos
 {
@@ -44,6 +45,9 @@ namespace Lumos
                 ImGuiUtilities::Property("Show Console", projectSettings.ShowConsole);
                 ImGuiUtilities::Property("Title", projectSettings.Title);
                 ImGuiUtilities::Property("RenderAPI", projectSettings.RenderAPI, 0, 1);
+                // Models already loaded keep their vertex format until they are loaded again
+                if(ImGuiUtilities::Property("Compact Model Vertices", projectSettings.CompactModelVertices))
+                    Graphics::Model::SetImportCompactVertices(projectSettings.CompactModelVertices);
                 ImGuiUtilities::Property("Project Version", projectSettings.ProjectVersion, 0, 0, ImGuiUtilities::PropertyFlag::ReadOnly);
 
                 if(!ImGui::IsItemActive() && m_NameUpdated)
@@ -3,1600 +3,1641 @@
 #include <array>
 #include <cstdint>
 
-constexpr uint32_t spirv_ForwardPBRfragspv_size = 50980;
-constexpr std::array<uint32_t, 12745> spirv_ForwardPBRfragspv = {
-    0x07230203, 0x00010000, 0x000D000A, 0x00000817, 0x00000000, 0x00020011, 0x00000001, 0x0006000B, 
+constexpr uint32_t spirv_ForwardPBRfragspv_size = 52316;
+constexpr std::array<uint32_t, 13079> spirv_ForwardPBRfragspv = {
+    0x07230203, 0x00010000, 0x000D000A, 0x000007AA, 0x00000000, 0x00020011, 0x00000001, 0x0006000B, 
 0x00000001, 0x4C534C47, 0x6474732E, 0x3035342E, 0x00000000, 0x0003000E, 0x00000000, 0x00000001, 
-0x0008000F, 0x00000004, 0x00000004, 0x6E69616D, 0x00000000, 0x00000204, 0x00000314, 0x000006AF, 
-0x00030010, 0x00000004, 0x00000007, 0x00030003, 0x00000002, 0x000001C2, 0x00090004, 0x415F4C47, 
+0x0008000F, 0x00000004, 0x0000005C, 0x6E69616D, 0x00000000, 0x00000051, 0x00000059, 0x00000103, 
+0x00030010, 0x0000005C, 0x00000007, 0x00030003, 0x00000002, 0x000001C2, 0x00090004, 0x415F4C47, 
 0x735F4252, 0x72617065, 0x5F657461, 0x64616873, 0x6F5F7265, 0x63656A62, 0x00007374, 0x00090004, 
 0x415F4C47, 0x735F4252, 0x69646168, 0x6C5F676E, 0x75676E61, 0x5F656761, 0x70303234, 0x006B6361, 
 0x000A0004, 0x475F4C47, 0x4C474F4F, 0x70635F45, 0x74735F70, 0x5F656C79, 0x656E696C, 0x7269645F, 
 0x69746365, 0x00006576, 0x00080004, 0x475F4C47, 0x4C474F4F, 0x6E695F45, 0x64756C63, 0x69645F65, 
-0x74636572, 0x00657669, 0x00040005, 0x00000004, 0x6E69616D, 0x00000000, 0x00050005, 0x0000000A, 
-0x35776F70, 0x3B316628, 0x00000000, 0x00030005, 0x00000009, 0x00000078, 0x00060005, 0x00000010, 
-0x61476544, 0x28616D6D, 0x3B336676, 0x00000000, 0x00040005, 0x0000000F, 0x6F6C6F63, 0x00007275, 
-0x00060005, 0x00000016, 0x61476544, 0x28616D6D, 0x3B346676, 0x00000000, 0x00040005, 0x00000015, 
-0x6F6C6F63, 0x00007275, 0x00060005, 0x00000019, 0x75746173, 0x65746172, 0x3B316628, 0x00000000, 
-0x00040005, 0x00000018, 0x756C6176, 0x00000065, 0x00080005, 0x00000020, 0x47475F44, 0x31662858, 
-0x3B31663B, 0x3B336676, 0x3B336676, 0x00000000, 0x00050005, 0x0000001C, 0x67756F72, 0x73656E68, 
-0x00000073, 0x00030005, 0x0000001D, 0x00486F4E, 0x00030005, 0x0000001E, 0x0000006E, 0x00030005, 
-0x0000001F, 0x00000068, 0x00080005, 0x00000026, 0x63535F46, 0x63696C68, 0x6676286B, 0x31663B33, 
-0x3B31663B, 0x00000000, 0x00030005, 0x00000023, 0x00003066, 0x00030005, 0x00000024, 0x00303966, 
-0x00030005, 0x00000025, 0x00486F56, 0x00070005, 0x0000002C, 0x63535F46, 0x63696C68, 0x3166286B, 
-0x3B31663B, 0x003B3166, 0x00030005, 0x00000029, 0x00000075, 0x00030005, 0x0000002A, 0x00003066, 
-0x00030005, 0x0000002B, 0x00303966, 0x00080005, 0x00000033, 0x425F6446, 0x656C7275, 0x31662879, 
-0x3B31663B, 0x663B3166, 0x00003B31, 0x00050005, 0x0000002F, 0x67756F72, 0x73656E68, 0x00000073, 
-0x00030005, 0x00000030, 0x00566F4E, 0x00030005, 0x00000031, 0x004C6F4E, 0x00030005, 0x00000032, 
-0x00486F4C, 0x000A0005, 0x00000038, 0x6D535F56, 0x47687469, 0x6F435847, 0x6C657272, 0x64657461, 
-0x3B316628, 0x663B3166, 0x00003B31, 0x00030005, 0x00000035, 0x00566F4E, 0x00030005, 0x00000036, 
-0x004C6F4E, 0x00030005, 0x00000037, 0x00000061, 0x000A0005, 0x0000003D, 0x706D6F43, 0x4D657475, 
-0x6F726369, 0x64616853, 0x6E69776F, 0x31662867, 0x3B31663B, 0x00000000, 0x00030005, 0x0000003B, 
-0x004C6F4E, 0x00050005, 0x0000003C, 0x69736976, 0x696C6962, 0x00007974, 0x00080005, 0x00000043, 
-0x66666944, 0x28657375, 0x663B3166, 0x31663B31, 0x3B31663B, 0x00000000, 0x00050005, 0x0000003F, 
-0x67756F72, 0x73656E68, 0x00000073, 0x00030005, 0x00000040, 0x00566F4E, 0x00030005, 0x00000041, 
-0x004C6F4E, 0x00030005, 0x00000042, 0x00486F4C, 0x00060005, 0x00000046, 0x6D616C63, 0x566F4E70, 
-0x3B316628, 0x00000000, 0x00030005, 0x00000045, 0x00566F4E, 0x000A0005, 0x0000004B, 0x706D6F63, 
-0x44657475, 0x75666669, 0x6F436573, 0x72756F6C, 0x34667628, 0x3B31663B, 0x00000000, 0x00050005, 
-0x00000049, 0x65736162, 0x6F6C6F43, 0x00007275, 0x00050005, 0x0000004A, 0x6174656D, 0x63696C6C, 
-0x00000000, 0x00080005, 0x00000051, 0x706D6F63, 0x46657475, 0x66762830, 0x31663B34, 0x3B31663B, 
-0x00000000, 0x00050005, 0x0000004E, 0x65736162, 0x6F6C6F43, 0x00007275, 0x00050005, 0x0000004F, 
-0x6174656D, 0x63696C6C, 0x00000000, 0x00050005, 0x00000050, 0x6C666572, 0x61746365, 0x0065636E, 
-0x00080005, 0x00000054, 0x706D6F63, 0x44657475, 0x656C6569, 0x69727463, 0x28304663, 0x003B3166, 
-0x00050005, 0x00000053, 0x6C666572, 0x61746365, 0x0065636E, 0x000B0005, 0x00000057, 0x63726570, 
-0x75747065, 0x6F526C61, 0x6E686775, 0x54737365, 0x756F526F, 0x656E6867, 0x66287373, 0x00003B31, 
-0x00070005, 0x00000056, 0x63726570, 0x75747065, 0x6F526C61, 0x6E686775, 0x00737365, 0x00090005, 
-0x0000005D, 0x74736964, 0x75626972, 0x6E6F6974, 0x3B316628, 0x763B3166, 0x763B3366, 0x003B3366, 
-0x00050005, 0x00000059, 0x67756F72, 0x73656E68, 0x00000073, 0x00030005, 0x0000005A, 0x00486F4E, 
-0x00030005, 0x0000005B, 0x00000068, 0x00040005, 0x0000005C, 0x6D726F6E, 0x00006C61, 0x00080005, 
-0x00000062, 0x69736976, 0x696C6962, 0x66287974, 0x31663B31, 0x3B31663B, 0x00000000, 0x00050005, 
-0x0000005F, 0x67756F72, 0x73656E68, 0x00000073, 0x00030005, 0x00000060, 0x00566F4E, 0x00030005, 
-0x00000061, 0x004C6F4E, 0x00060005, 0x00000067, 0x73657266, 0x286C656E, 0x3B336676, 0x003B3166, 
-0x00030005, 0x00000065, 0x00003066, 0x00030005, 0x00000066, 0x00486F4C, 0x000B0005, 0x0000006D, 
+0x74636572, 0x00657669, 0x00030005, 0x00000007, 0x004F4255, 0x00060006, 0x00000007, 0x00000000, 
+0x6A6F7270, 0x77656956, 0x00000000, 0x00060005, 0x00000003, 0x61435F75, 0x6172656D, 0x61746144, 
+0x00000000, 0x00050005, 0x00000010, 0x64616853, 0x6144776F, 0x00006174, 0x00080006, 0x00000010, 
+0x00000000, 0x4C726944, 0x74686769, 0x7274614D, 0x73656369, 0x00000000, 0x00050005, 0x0000000C, 
+0x69445F75, 0x61685372, 0x00776F64, 0x00070005, 0x00000014, 0x66696E55, 0x4D6D726F, 0x72657461, 
+0x446C6169, 0x00617461, 0x00070006, 0x00000014, 0x00000000, 0x65626C41, 0x6F436F64, 0x72756F6C, 
+0x00000000, 0x00060006, 0x00000014, 0x00000001, 0x67756F52, 0x73656E68, 0x00000073, 0x00060006, 
+0x00000014, 0x00000002, 0x6174654D, 0x63696C6C, 0x00000000, 0x00060006, 0x00000014, 0x00000003, 
+0x6C666552, 0x61746365, 0x0065636E, 0x00060006, 0x00000014, 0x00000004, 0x73696D45, 0x65766973, 
+0x00000000, 0x00070006, 0x00000014, 0x00000005, 0x65626C41, 0x614D6F64, 0x63614670, 0x00726F74, 
+0x00080006, 0x00000014, 0x00000006, 0x6174654D, 0x63696C6C, 0x4670614D, 0x6F746361, 0x00000072, 
+0x00080006, 0x00000014, 0x00000007, 0x67756F52, 0x73656E68, 0x70614D73, 0x74636146, 0x0000726F, 
+0x00070006, 0x00000014, 0x00000008, 0x6D726F4E, 0x614D6C61, 0x63614670, 0x00726F74, 0x00080006, 
+0x00000014, 0x00000009, 0x73696D45, 0x65766973, 0x4670614D, 0x6F746361, 0x00000072, 0x00060006, 
+0x00000014, 0x0000000A, 0x614D4F41, 0x63614670, 0x00726F74, 0x00060006, 0x00000014, 0x0000000B, 
+0x68706C41, 0x74754361, 0x0066664F, 0x00060006, 0x00000014, 0x0000000C, 0x6B726F77, 0x776F6C66, 
+0x00000000, 0x00060005, 0x00000013, 0x614D5F75, 0x69726574, 0x61446C61, 0x00006174, 0x00040005, 
+0x00000019, 0x6867694C, 0x00000074, 0x00050006, 0x00000019, 0x00000000, 0x6F6C6F63, 0x00007275, 
+0x00060006, 0x00000019, 0x00000001, 0x69736F70, 0x6E6F6974, 0x00000000, 0x00060006, 0x00000019, 
+0x00000002, 0x65726964, 0x6F697463, 0x0000006E, 0x00060006, 0x00000019, 0x00000003, 0x65746E69, 
+0x7469736E, 0x00000079, 0x00050006, 0x00000019, 0x00000004, 0x69646172, 0x00007375, 0x00050006, 
+0x00000019, 0x00000005, 0x65707974, 0x00000000, 0x00050006, 0x00000019, 0x00000006, 0x6C676E61, 
+0x00000065, 0x00070005, 0x0000001D, 0x66696E55, 0x536D726F, 0x656E6563, 0x61746144, 0x00000000, 
+0x00050006, 0x0000001D, 0x00000000, 0x6867696C, 0x00007374, 0x00070006, 0x0000001D, 0x00000001, 
+0x64616853, 0x7254776F, 0x66736E61, 0x006D726F, 0x00060006, 0x0000001D, 0x00000002, 0x77656956, 
+0x7274614D, 0x00007869, 0x00060006, 0x0000001D, 0x00000003, 0x6867694C, 0x65695674, 0x00000077, 
+0x00060006, 0x0000001D, 0x00000004, 0x73616942, 0x7274614D, 0x00007869, 0x00070006, 0x0000001D, 
+0x00000005, 0x656D6163, 0x6F506172, 0x69746973, 0x00006E6F, 0x00060006, 0x0000001D, 0x00000006, 
+0x696C7053, 0x70654474, 0x00736874, 0x00060006, 0x0000001D, 0x00000007, 0x6867694C, 0x7A695374, 
+0x00000065, 0x00070006, 0x0000001D, 0x00000008, 0x5378614D, 0x6F646168, 0x73694477, 0x00000074, 
+0x00060006, 0x0000001D, 0x00000009, 0x64616853, 0x6146776F, 0x00006564, 0x00060006, 0x0000001D, 
+0x0000000A, 0x63736143, 0x46656461, 0x00656461, 0x00060006, 0x0000001D, 0x0000000B, 0x6867694C, 
+0x756F4374, 0x0000746E, 0x00060006, 0x0000001D, 0x0000000C, 0x64616853, 0x6F43776F, 0x00746E75, 
+0x00050006, 0x0000001D, 0x0000000D, 0x65646F4D, 0x00000000, 0x00060006, 0x0000001D, 0x0000000E, 
+0x4D766E45, 0x6F437069, 0x00746E75, 0x00060006, 0x0000001D, 0x0000000F, 0x74696E49, 0x426C6169, 
+0x00736169, 0x00050006, 0x0000001D, 0x00000010, 0x74646957, 0x00000068, 0x00050006, 0x0000001D, 
+0x00000011, 0x67696548, 0x00007468, 0x00070006, 0x0000001D, 0x00000012, 0x64616873, 0x6E45776F, 
+0x656C6261, 0x00000064, 0x00050005, 0x00000018, 0x63535F75, 0x44656E65, 0x00617461, 0x00050005, 
+0x00000021, 0x6C415F75, 0x6F646562, 0x0070614D, 0x00060005, 0x00000025, 0x654D5F75, 0x6C6C6174, 
+0x614D6369, 0x00000070, 0x00060005, 0x00000026, 0x6F525F75, 0x6E686775, 0x4D737365, 0x00007061, 
+0x00050005, 0x00000027, 0x6F4E5F75, 0x6C616D72, 0x0070614D, 0x00040005, 0x00000029, 0x4F415F75, 
+0x0070614D, 0x00060005, 0x0000002A, 0x6D455F75, 0x69737369, 0x614D6576, 0x00000070, 0x00050005, 
+0x0000002B, 0x61685375, 0x4D776F64, 0x00007061, 0x00040005, 0x0000002F, 0x766E4575, 0x0070614D, 
+0x00040005, 0x00000033, 0x72724975, 0x0070614D, 0x00050005, 0x00000034, 0x44524275, 0x54554C46, 
+0x00000000, 0x00050005, 0x00000035, 0x41535375, 0x70614D4F, 0x00000000, 0x00080005, 0x0000003A, 
+0x66696E55, 0x436D726F, 0x7473756C, 0x694C7265, 0x73746867, 0x00000000, 0x00050006, 0x0000003A, 
+0x00000000, 0x6867694C, 0x00007374, 0x00060005, 0x00000037, 0x6C435F75, 0x65747375, 0x67694C72, 
+0x00737468, 0x00070005, 0x00000046, 0x66696E55, 0x436D726F, 0x7473756C, 0x72477265, 0x00006469, 
+0x00080006, 0x00000046, 0x00000000, 0x6A6F7250, 0x69746365, 0x61506E6F, 0x736D6172, 0x00000000, 
+0x00060006, 0x00000046, 0x00000001, 0x656D6944, 0x6F69736E, 0x0000736E, 0x00050006, 0x00000046, 
+0x00000002, 0x676E6152, 0x00007365, 0x00060005, 0x00000042, 0x6C435F75, 0x65747375, 0x69724772, 
+0x00000064, 0x00080005, 0x0000004F, 0x66696E55, 0x436D726F, 0x7473756C, 0x6E497265, 0x65636964, 
+0x00000073, 0x00050006, 0x0000004F, 0x00000000, 0x69646E49, 0x00736563, 0x00070005, 0x0000004C, 
+0x6C435F75, 0x65747375, 0x646E4972, 0x73656369, 0x00000000, 0x00050005, 0x00000055, 0x74726556, 
+0x61447865, 0x00006174, 0x00050006, 0x00000055, 0x00000000, 0x6F6C6F43, 0x00007275, 0x00060006, 
+0x00000055, 0x00000001, 0x43786554, 0x64726F6F, 0x00000000, 0x00060006, 0x00000055, 0x00000002, 
+0x69736F50, 0x6E6F6974, 0x00000000, 0x00050006, 0x00000055, 0x00000003, 0x6D726F4E, 0x00006C61, 
+0x00060006, 0x00000055, 0x00000004, 0x6C726F57, 0x726F4E64, 0x006C616D, 0x00060005, 0x00000051, 
+0x74726556, 0x754F7865, 0x74757074, 0x00000000, 0x00050005, 0x00000057, 0x64616853, 0x6146776F, 
+0x00006564, 0x00050005, 0x00000059, 0x4374756F, 0x756F6C6F, 0x00000072, 0x00030005, 0x0000005B, 
+0x00494850, 0x00040005, 0x0000005C, 0x6E69616D, 0x00000000, 0x00050005, 0x00000063, 0x43786574, 
+0x756F6C6F, 0x00000072, 0x00050005, 0x00000072, 0x6174656D, 0x63696C6C, 0x00000000, 0x00050005, 
+0x00000073, 0x67756F72, 0x73656E68, 0x00000073, 0x00030005, 0x0000008C, 0x00786574, 0x00030005, 
+0x000000B3, 0x00786574, 0x00050005, 0x000000CD, 0x6574614D, 0x6C616972, 0x00000000, 0x00050006, 
+0x000000CD, 0x00000000, 0x65626C41, 0x00006F64, 0x00060006, 0x000000CD, 0x00000001, 0x6174654D, 
+0x63696C6C, 0x00000000, 0x00060006, 0x000000CD, 0x00000002, 0x67756F52, 0x73656E68, 0x00000073, 
+0x00080006, 0x000000CD, 0x00000003, 0x63726550, 0x75747065, 0x6F526C61, 0x6E686775, 0x00737365, 
+0x00060006, 0x000000CD, 0x00000004, 0x6C666552, 0x61746365, 0x0065636E, 0x00060006, 0x000000CD, 
+0x00000005, 0x73696D45, 0x65766973, 0x00000000, 0x00050006, 0x000000CD, 0x00000006, 0x6D726F4E, 
+0x00006C61, 0x00040006, 0x000000CD, 0x00000007, 0x00004F41, 0x00050006, 0x000000CD, 0x00000008, 
+0x77656956, 0x00000000, 0x00050006, 0x000000CD, 0x00000009, 0x746F444E, 0x00000056, 0x00040006, 
+0x000000CD, 0x0000000A, 0x00003046, 0x00080006, 0x000000CD, 0x0000000B, 0x72656E45, 0x6F437967, 
+0x6E65706D, 0x69746173, 0x00006E6F, 0x00040006, 0x000000CD, 0x0000000C, 0x00676664, 0x00050005, 
+0x000000CC, 0x6574616D, 0x6C616972, 0x00000000, 0x00040005, 0x000000FD, 0x61726170, 0x0000006D, 
+0x00060005, 0x00000103, 0x465F6C67, 0x43676172, 0x64726F6F, 0x00000000, 0x00030005, 0x0000010E, 
+0x00007675, 0x00040005, 0x00000114, 0x6F617373, 0x00000000, 0x00040005, 0x00000120, 0x61726170, 
+0x0000006D, 0x00050005, 0x00000129, 0x67756F72, 0x73656E68, 0x00003273, 0x00040005, 0x0000012D, 
+0x75646E64, 0x00000000, 0x00040005, 0x00000131, 0x76646E64, 0x00000000, 0x00050005, 0x00000139, 
+0x69726176, 0x65636E61, 0x00000000, 0x00070005, 0x0000013D, 0x6E72656B, 0x6F526C65, 0x6E686775, 
+0x32737365, 0x00000000, 0x00040005, 0x00000142, 0x61726170, 0x0000006D, 0x00070005, 0x00000144, 
+0x746C6966, 0x64657265, 0x67756F52, 0x73656E68, 0x00003273, 0x00040005, 0x00000150, 0x6F507377, 
+0x00000073, 0x00040005, 0x0000016B, 0x61726170, 0x0000006D, 0x00050005, 0x0000016F, 0x6C666572, 
+0x61746365, 0x0065636E, 0x00040005, 0x00000173, 0x61726170, 0x0000006D, 0x00040005, 0x00000176, 
+0x61726170, 0x0000006D, 0x00040005, 0x00000177, 0x61726170, 0x0000006D, 0x00030005, 0x0000017A, 
+0x00003046, 0x00040005, 0x0000018C, 0x61726170, 0x0000006D, 0x00040005, 0x0000018F, 0x61726170, 
+0x0000006D, 0x00030005, 0x0000019E, 0x0000724C, 0x00040005, 0x000001A0, 0x61726170, 0x0000006D, 
+0x00040005, 0x000001A3, 0x61726170, 0x0000006D, 0x00040005, 0x000001A5, 0x61726170, 0x0000006D, 
+0x00070005, 0x000001A8, 0x6867696C, 0x6E6F4374, 0x62697274, 0x6F697475, 0x0000006E, 0x00040005, 
+0x000001AA, 0x61726170, 0x0000006D, 0x00040005, 0x000001AD, 0x61726170, 0x0000006D, 0x00040005, 
+0x000001AF, 0x61726170, 0x0000006D, 0x00060005, 0x000001B2, 0x436C6269, 0x72746E6F, 0x74756269, 
+0x006E6F69, 0x00050005, 0x000001B9, 0x616E6966, 0x6C6F436C, 0x0072756F, 0x00040005, 0x000001F4, 
+0x61726170, 0x0000006D, 0x00060005, 0x000001F7, 0x63736163, 0x49656461, 0x7865646E, 0x00000000, 
+0x00050005, 0x00000061, 0x41746547, 0x6465626C, 0x0000286F, 0x00040005, 0x00000220, 0x61726170, 
+0x0000006D, 0x00060005, 0x0000007B, 0x4D746547, 0x6C617465, 0x2863696C, 0x00000000, 0x00060005, 
+0x0000007E, 0x52746547, 0x6867756F, 0x7373656E, 0x00000028, 0x00040005, 0x000000F9, 0x41746547, 
+0x0000284F, 0x00070005, 0x000000FC, 0x45746547, 0x7373696D, 0x28657669, 0x3B336676, 0x00000000, 
+0x00040005, 0x00000269, 0x65626C61, 0x00006F64, 0x00040005, 0x00000280, 0x61726170, 0x0000006D, 
+0x000B0005, 0x0000011F, 0x63726570, 0x75747065, 0x6F526C61, 0x6E686775, 0x54737365, 0x756F526F, 
+0x656E6867, 0x66287373, 0x00003B31, 0x00070005, 0x00000285, 0x63726570, 0x75747065, 0x6F526C61, 
+0x6E686775, 0x00737365, 0x00060005, 0x00000141, 0x75746173, 0x65746172, 0x3B316628, 0x00000000, 
+0x00040005, 0x0000028A, 0x756C6176, 0x00000065, 0x00080005, 0x0000016A, 0x706D6F63, 0x44657475, 
+0x656C6569, 0x69727463, 0x28304663, 0x003B3166, 0x00050005, 0x0000028E, 0x6C666572, 0x61746365, 
+0x0065636E, 0x00080005, 0x00000172, 0x706D6F63, 0x46657475, 0x66762830, 0x31663B34, 0x3B31663B, 
+0x00000000, 0x00050005, 0x00000296, 0x65736162, 0x6F6C6F43, 0x00007275, 0x00050005, 0x00000297, 
+0x6174656D, 0x63696C6C, 0x00000000, 0x00050005, 0x00000298, 0x6C666572, 0x61746365, 0x0065636E, 
+0x000A0005, 0x0000018B, 0x706D6F63, 0x44657475, 0x75666669, 0x6F436573, 0x72756F6C, 0x34667628, 
+0x3B31663B, 0x00000000, 0x00050005, 0x000002A5, 0x65736162, 0x6F6C6F43, 0x00007275, 0x00050005, 
+0x000002A6, 0x6174656D, 0x63696C6C, 0x00000000, 0x00170005, 0x0000019F, 0x6867694C, 0x676E6974, 
+0x33667628, 0x3366763B, 0x7274733B, 0x2D746375, 0x6574614D, 0x6C616972, 0x3466762D, 0x2D31662D, 
+0x662D3166, 0x31662D31, 0x3366762D, 0x3366762D, 0x2D31662D, 0x2D336676, 0x762D3166, 0x762D3366, 
+0x762D3366, 0x3B313266, 0x00000000, 0x00030005, 0x000002AE, 0x00003046, 0x00040005, 0x000002AF, 
+0x6F507377, 0x00000073, 0x00050005, 0x000002B0, 0x6574616D, 0x6C616972, 0x00000000, 0x00040005, 
+0x000002B3, 0x75736572, 0x0000746C, 0x00030005, 0x000002B4, 0x00000069, 0x00040005, 0x000002C1, 
+0x6867694C, 0x00000074, 0x00050006, 0x000002C1, 0x00000000, 0x6F6C6F63, 0x00007275, 0x00060006, 
+0x000002C1, 0x00000001, 0x69736F70, 0x6E6F6974, 0x00000000, 0x00060006, 0x000002C1, 0x00000002, 
+0x65726964, 0x6F697463, 0x0000006E, 0x00060006, 0x000002C1, 0x00000003, 0x65746E69, 0x7469736E, 
+0x00000079, 0x00050006, 0x000002C1, 0x00000004, 0x69646172, 0x00007375, 0x00050006, 0x000002C1, 
+0x00000005, 0x65707974, 0x00000000, 0x00050006, 0x000002C1, 0x00000006, 0x6C676E61, 0x00000065, 
+0x00040005, 0x000002C0, 0x61726170, 0x0000006D, 0x00040005, 0x000002CE, 0x61726170, 0x0000006D, 
+0x00040005, 0x000002D0, 0x61726170, 0x0000006D, 0x00040005, 0x000002E1, 0x77656976, 0x00736F50, 
+0x00040005, 0x000002E3, 0x61726170, 0x0000006D, 0x00040005, 0x000002E7, 0x61726170, 0x0000006D, 
+0x00040005, 0x000002EA, 0x676E6172, 0x00000065, 0x00040005, 0x000002EE, 0x7366666F, 0x00007465, 
+0x00040005, 0x000002F2, 0x6E756F63, 0x00000074, 0x00030005, 0x000002F4, 0x00000069, 0x00040005, 
+0x00000301, 0x61726170, 0x0000006D, 0x00040005, 0x00000303, 0x61726170, 0x0000006D, 0x00040005, 
+0x0000030E, 0x61726170, 0x0000006D, 0x00040005, 0x00000310, 0x61726170, 0x0000006D, 0x00150005, 
+0x000001A9, 0x284C4249, 0x3B336676, 0x3B336676, 0x75727473, 0x4D2D7463, 0x72657461, 0x2D6C6169, 
+0x2D346676, 0x662D3166, 0x31662D31, 0x2D31662D, 0x2D336676, 0x2D336676, 0x762D3166, 0x662D3366, 
+0x66762D31, 0x66762D33, 0x66762D33, 0x003B3132, 0x00030005, 0x00000318, 0x00003046, 0x00030005, 
+0x00000319, 0x0000724C, 0x00050005, 0x0000031A, 0x6574616D, 0x6C616972, 0x00000000, 0x00050005, 
+0x00000321, 0x61727269, 0x6E616964, 0x00006563, 0x00040005, 0x00000323, 0x61726170, 0x0000006D, 
+0x00040005, 0x00000325, 0x61726170, 0x0000006D, 0x00040005, 0x00000328, 0x61726170, 0x0000006D, 
+0x00030005, 0x0000032C, 0x00000046, 0x00030005, 0x00000333, 0x0000646B, 0x00050005, 0x00000339, 
+0x66666964, 0x49657375, 0x00004C42, 0x00080005, 0x0000033D, 0x6E455F75, 0x64615276, 0x636E6169, 
+0x78655465, 0x6576654C, 0x0000736C, 0x00070005, 0x00000347, 0x63657073, 0x72616C75, 0x61727249, 
+0x6E616964, 0x00006563, 0x00050005, 0x00000352, 0x63657073, 0x72616C75, 0x004C4249, 0x00090005, 
+0x000001F3, 0x636C6143, 0x74616C75, 0x73614365, 0x65646163, 0x65646E49, 0x66762878, 0x00003B33, 
+0x00040005, 0x00000359, 0x6F507377, 0x00000073, 0x00060005, 0x0000035B, 0x63736163, 0x49656461, 
+0x7865646E, 0x00000000, 0x00040005, 0x00000364, 0x77656976, 0x00736F50, 0x00030005, 0x00000365, 
+0x00000069, 0x00060005, 0x0000021F, 0x61476544, 0x28616D6D, 0x3B346676, 0x00000000, 0x00040005, 
+0x0000037E, 0x6F6C6F63, 0x00007275, 0x00040005, 0x00000380, 0x61726170, 0x0000006D, 0x00060005, 
+0x0000027F, 0x61476544, 0x28616D6D, 0x3B336676, 0x00000000, 0x00040005, 0x0000038A, 0x6F6C6F63, 
+0x00007275, 0x00210005, 0x000002BF, 0x6867694C, 0x6E6F4374, 0x62697274, 0x6F697475, 0x7473286E, 
+0x74637572, 0x67694C2D, 0x762D7468, 0x762D3466, 0x762D3466, 0x662D3466, 0x31662D31, 0x2D31662D, 
+0x3B313166, 0x3B336676, 0x75727473, 0x4D2D7463, 0x72657461, 0x2D6C6169, 0x2D346676, 0x662D3166, 
+0x31662D31, 0x2D31662D, 0x2D336676, 0x2D336676, 0x762D3166, 0x662D3366, 0x66762D31, 0x66762D33, 
+0x66762D33, 0x003B3132, 0x00040005, 0x00000391, 0x6867696C, 0x00000074, 0x00040005, 0x00000392, 
+0x6F507377, 0x00000073, 0x00050005, 0x00000393, 0x6574616D, 0x6C616972, 0x00000000, 0x00040005, 
+0x00000395, 0x756C6176, 0x00000065, 0x00030005, 0x000003A1, 0x0000004C, 0x00040005, 0x000003A4, 
+0x74736964, 0x00000000, 0x00040005, 0x000003AD, 0x65747461, 0x0000006E, 0x00050005, 0x000003B9, 
+0x65747461, 0x7461756E, 0x006E6F69, 0x00030005, 0x000003CC, 0x0000004C, 0x00050005, 0x000003D0, 
+0x6F747563, 0x6E416666, 0x00656C67, 0x00040005, 0x000003D3, 0x74736964, 0x00000000, 0x00040005, 
+0x000003DC, 0x74656874, 0x00000061, 0x00040005, 0x000003E2, 0x69737065, 0x006E6F6C, 0x00050005, 
+0x000003E8, 0x65747461, 0x7461756E, 0x006E6F69, 0x00040005, 0x000003F9, 0x746F446E, 0x0000004C, 
+0x00040005, 0x00000406, 0x61726170, 0x0000006D, 0x00060005, 0x00000409, 0x63736163, 0x49656461, 
+0x7865646E, 0x00000000, 0x00040005, 0x0000040B, 0x61726170, 0x0000006D, 0x00040005, 0x0000040D, 
+0x61726170, 0x0000006D, 0x00040005, 0x0000040F, 0x61726170, 0x0000006D, 0x00040005, 0x00000413, 
+0x61726170, 0x0000006D, 0x00030005, 0x0000041A, 0x0000694C, 0x00050005, 0x00000421, 0x6461724C, 
+0x636E6169, 0x00000065, 0x00030005, 0x00000427, 0x0000684C, 0x00040005, 0x0000042C, 0x61726170, 
+0x0000006D, 0x00050005, 0x0000042E, 0x6867696C, 0x4C6F4E74, 0x00000000, 0x00030005, 0x00000434, 
+0x00000068, 0x00040005, 0x0000043B, 0x61726170, 0x0000006D, 0x00050005, 0x0000043D, 0x64616873, 
+0x5F676E69, 0x00566F4E, 0x00030005, 0x0000043F, 0x00566F4E, 0x00040005, 0x00000440, 0x61726170, 
+0x0000006D, 0x00030005, 0x00000443, 0x004C6F4E, 0x00040005, 0x00000448, 0x61726170, 0x0000006D, 
+0x00030005, 0x0000044A, 0x00486F4E, 0x00040005, 0x0000044E, 0x61726170, 0x0000006D, 0x00030005, 
+0x00000450, 0x00486F4C, 0x00040005, 0x00000452, 0x61726170, 0x0000006D, 0x00040005, 0x00000454, 
+0x61726170, 0x0000006D, 0x00040005, 0x00000456, 0x61726170, 0x0000006D, 0x00040005, 0x00000458, 
+0x61726170, 0x0000006D, 0x00030005, 0x0000045B, 0x00006446, 0x00040005, 0x0000045D, 0x61726170, 
+0x0000006D, 0x00040005, 0x0000045F, 0x61726170, 0x0000006D, 0x00040005, 0x00000461, 0x61726170, 
+0x0000006D, 0x00040005, 0x00000463, 0x61726170, 0x0000006D, 0x00040005, 0x00000465, 0x61726170, 
+0x0000006D, 0x00040005, 0x00000467, 0x61726170, 0x0000006D, 0x00040005, 0x00000469, 0x61726170, 
+0x0000006D, 0x00030005, 0x0000046C, 0x00007246, 0x00040005, 0x00000470, 0x6F6C6F63, 0x00007275, 
+0x00040005, 0x00000479, 0x61726170, 0x0000006D, 0x00040005, 0x0000047B, 0x61726170, 0x0000006D, 
+0x00080005, 0x000002E2, 0x43746547, 0x7473756C, 0x6E497265, 0x28786564, 0x3B336676, 0x00000000, 
+0x00040005, 0x00000482, 0x77656976, 0x00736F50, 0x00040005, 0x00000487, 0x736D6964, 0x00000000, 
+0x00040005, 0x0000048D, 0x74706564, 0x00000068, 0x00030005, 0x00000494, 0x0063646E, 0x00040005, 
+0x000004A9, 0x63696C73, 0x00000065, 0x00040005, 0x000004C3, 0x656C6974, 0x00000000, 0x00030005, 
+0x000004CC, 0x0000007A, 0x00070005, 0x000002E6, 0x43746547, 0x7473756C, 0x61527265, 0x2865676E, 
+0x003B3175, 0x00040005, 0x000004DE, 0x73756C63, 0x00726574, 0x00090005, 0x00000300, 0x43746547, 
+0x7473756C, 0x694C7265, 0x49746867, 0x7865646E, 0x3B317528, 0x00000000, 0x00040005, 0x000004E7, 
+0x65646E69, 0x00000078, 0x00040005, 0x000004F1, 0x6B636170, 0x00006465, 0x000B0005, 0x00000322, 
 0x73657266, 0x536C656E, 0x696C6863, 0x6F526B63, 0x6E686775, 0x28737365, 0x3B336676, 0x663B3166, 
-0x00003B31, 0x00030005, 0x0000006A, 0x00003046, 0x00050005, 0x0000006B, 0x54736F63, 0x61746568, 
-0x00000000, 0x00050005, 0x0000006C, 0x67756F72, 0x73656E68, 0x00000073, 0x00050005, 0x00000070, 
-0x41746547, 0x6465626C, 0x0000286F, 0x00060005, 0x00000073, 0x4D746547, 0x6C617465, 0x2863696C, 
-0x00000000, 0x00060005, 0x00000076, 0x52746547, 0x6867756F, 0x7373656E, 0x00000028, 0x00040005, 
-0x00000078, 0x41746547, 0x0000284F, 0x00070005, 0x0000007B, 0x45746547, 0x7373696D, 0x28657669, 
-0x3B336676, 0x00000000, 0x00040005, 0x0000007A, 0x65626C61, 0x00006F64, 0x00050005, 0x00000081, 
-0x73696F4E, 0x66762865, 0x00003B32, 0x00030005, 0x00000080, 0x00006F63, 0x00090005, 0x00000089, 
-0x65676F56, 0x7369446C, 0x6D61536B, 0x28656C70, 0x663B3169, 0x31663B31, 0x0000003B, 0x00050005, 
-0x00000086, 0x706D6173, 0x6E49656C, 0x00786564, 0x00090005, 0x00000087, 0x53766E69, 0x72617571, 
-0x6F6F5265, 0x6D615374, 0x73656C70, 0x6E756F43, 0x00000074, 0x00030005, 0x00000088, 0x00696870, 
-0x00050005, 0x0000008D, 0x646E6152, 0x76286D6F, 0x003B3466, 0x00040005, 0x0000008C, 0x64656573, 
-0x00000034, 0x00060005, 0x00000092, 0x646E6152, 0x76286D6F, 0x693B3366, 0x00003B31, 0x00040005, 
-0x00000090, 0x64656573, 0x00000000, 0x00030005, 0x00000091, 0x00000069, 0x00090005, 0x00000098, 
-0x53746547, 0x6F646168, 0x61694277, 0x66762873, 0x66763B33, 0x31693B33, 0x0000003B, 0x00060005, 
-0x00000095, 0x6867696C, 0x72694474, 0x69746365, 0x00006E6F, 0x00040005, 0x00000096, 0x6D726F6E, 
-0x00006C61, 0x00050005, 0x00000097, 0x64616873, 0x6E49776F, 0x00786564, 0x000A0005, 0x0000009B, 
-0x65746E69, 0x61656C72, 0x47646576, 0x69646172, 0x4E746E65, 0x6573696F, 0x32667628, 0x0000003B, 
-0x00060005, 0x0000009A, 0x69736F70, 0x6E6F6974, 0x7263735F, 0x006E6565, 0x00100005, 0x000000A8, 
-0x53464350, 0x6F646168, 0x72694477, 0x69746365, 0x6C616E6F, 0x6867694C, 0x41732874, 0x763B3132, 
-0x663B3466, 0x66763B31, 0x66763B33, 0x66763B33, 0x31693B33, 0x0000003B, 0x00050005, 0x000000A1, 
-0x64616873, 0x614D776F, 0x00000070, 0x00060005, 0x000000A2, 0x64616873, 0x6F43776F, 0x7364726F, 
-0x00000000, 0x00050005, 0x000000A3, 0x61527675, 0x73756964, 0x00000000, 0x00060005, 0x000000A4, 
-0x6867696C, 0x72694474, 0x69746365, 0x00006E6F, 0x00040005, 0x000000A5, 0x6D726F6E, 0x00006C61, 
-0x00040005, 0x000000A6, 0x6F507377, 0x00000073, 0x00060005, 0x000000A7, 0x63736163, 0x49656461, 
-0x7865646E, 0x00000000, 0x00090005, 0x000000AC, 0x636C6143, 0x74616C75, 0x73614365, 0x65646163, 
-0x65646E49, 0x66762878, 0x00003B33, 0x00040005, 0x000000AB, 0x6F507377, 0x00000073, 0x000A0005, 
-0x000000B3, 0x636C6143, 0x74616C75, 0x61685365, 0x28776F64, 0x3B336676, 0x763B3169, 0x763B3366, 
-0x003B3366, 0x00040005, 0x000000AF, 0x6F507377, 0x00000073, 0x00060005, 0x000000B0, 0x63736163, 
-0x49656461, 0x7865646E, 0x00000000, 0x00060005, 0x000000B1, 0x6867696C, 0x72694474, 0x69746365, 
-0x00006E6F, 0x00040005, 0x000000B2, 0x6D726F6E, 0x00006C61, 0x00050005, 0x000000B5, 0x6574614D, 
-0x6C616972, 0x00000000, 0x00050006, 0x000000B5, 0x00000000, 0x65626C41, 0x00006F64, 0x00060006, 
-0x000000B5, 0x00000001, 0x6174654D, 0x63696C6C, 0x00000000, 0x00060006, 0x000000B5, 0x00000002, 
-0x67756F52, 0x73656E68, 0x00000073, 0x00080006, 0x000000B5, 0x00000003, 0x63726550, 0x75747065, 
-0x6F526C61, 0x6E686775, 0x00737365, 0x00060006, 0x000000B5, 0x00000004, 0x6C666552, 0x61746365, 
-0x0065636E, 0x00060006, 0x000000B5, 0x00000005, 0x73696D45, 0x65766973, 0x00000000, 0x00050006, 
-0x000000B5, 0x00000006, 0x6D726F4E, 0x00006C61, 0x00040006, 0x000000B5, 0x00000007, 0x00004F41, 
-0x00050006, 0x000000B5, 0x00000008, 0x77656956, 0x00000000, 0x00050006, 0x000000B5, 0x00000009, 
-0x746F444E, 0x00000056, 0x00040006, 0x000000B5, 0x0000000A, 0x00003046, 0x00080006, 0x000000B5, 
-0x0000000B, 0x72656E45, 0x6F437967, 0x6E65706D, 0x69746173, 0x00006E6F, 0x00040006, 0x000000B5, 
-0x0000000C, 0x00676664, 0x00040005, 0x000000B6, 0x6867694C, 0x00000074, 0x00050006, 0x000000B6, 
-0x00000000, 0x6F6C6F63, 0x00007275, 0x00060006, 0x000000B6, 0x00000001, 0x69736F70, 0x6E6F6974, 
-0x00000000, 0x00060006, 0x000000B6, 0x00000002, 0x65726964, 0x6F697463, 0x0000006E, 0x00060006, 
-0x000000B6, 0x00000003, 0x65746E69, 0x7469736E, 0x00000079, 0x00050006, 0x000000B6, 0x00000004, 
-0x69646172, 0x00007375, 0x00050006, 0x000000B6, 0x00000005, 0x65707974, 0x00000000, 0x00050006, 
-0x000000B6, 0x00000006, 0x6C676E61, 0x00000065, 0x00230005, 0x000000BF, 0x746F7349, 0x69706F72, 
-0x626F4C63, 0x74732865, 0x74637572, 0x74614D2D, 0x61697265, 0x66762D6C, 0x31662D34, 0x2D31662D, 
-0x662D3166, 0x66762D31, 0x66762D33, 0x31662D33, 0x3366762D, 0x2D31662D, 0x2D336676, 0x2D336676, 
-0x31326676, 0x7274733B, 0x2D746375, 0x6867694C, 0x66762D74, 0x66762D34, 0x66762D34, 0x31662D34, 
-0x2D31662D, 0x662D3166, 0x763B3131, 0x663B3366, 0x31663B31, 0x3B31663B, 0x003B3166, 0x00050005, 
-0x000000B8, 0x6574616D, 0x6C616972, 0x00000000, 0x00040005, 0x000000B9, 0x6867696C, 0x00000074, 
-0x00030005, 0x000000BA, 0x00000068, 0x00030005, 0x000000BB, 0x00566F4E, 0x00030005, 0x000000BC, 
-0x004C6F4E, 0x00030005, 0x000000BD, 0x00486F4E, 0x00030005, 0x000000BE, 0x00486F4C, 0x00180005, 
-0x000000C6, 0x66666944, 0x4C657375, 0x2865626F, 0x75727473, 0x4D2D7463, 0x72657461, 0x2D6C6169, 
+0x00003B31, 0x00030005, 0x000004F9, 0x00003046, 0x00050005, 0x000004FA, 0x54736F63, 0x61746568, 
+0x00000000, 0x00050005, 0x000004FB, 0x67756F72, 0x73656E68, 0x00000073, 0x000A0005, 0x0000040A, 
+0x636C6143, 0x74616C75, 0x61685365, 0x28776F64, 0x3B336676, 0x763B3169, 0x763B3366, 0x003B3366, 
+0x00040005, 0x0000050D, 0x6F507377, 0x00000073, 0x00060005, 0x0000050E, 0x63736163, 0x49656461, 
+0x7865646E, 0x00000000, 0x00060005, 0x0000050F, 0x6867696C, 0x72694474, 0x69746365, 0x00006E6F, 
+0x00040005, 0x00000510, 0x6D726F6E, 0x00006C61, 0x00060005, 0x00000514, 0x64616873, 0x6944776F, 
+0x6E617473, 0x00006563, 0x00070005, 0x00000517, 0x6E617274, 0x69746973, 0x69446E6F, 0x6E617473, 
+0x00006563, 0x00040005, 0x00000520, 0x77656976, 0x00736F50, 0x00050005, 0x00000523, 0x74736964, 
+0x65636E61, 0x00000000, 0x00050005, 0x0000053B, 0x64616873, 0x6F43776F, 0x0064726F, 0x00040005, 
+0x00000542, 0x5241454E, 0x00000000, 0x00050005, 0x0000054A, 0x61527675, 0x73756964, 0x00000000, 
+0x00060005, 0x0000054E, 0x64616873, 0x6D41776F, 0x746E756F, 0x00000000, 0x00040005, 0x00000550, 
+0x61726170, 0x0000006D, 0x00040005, 0x00000552, 0x61726170, 0x0000006D, 0x00040005, 0x00000554, 
+0x61726170, 0x0000006D, 0x00040005, 0x00000556, 0x61726170, 0x0000006D, 0x00040005, 0x00000558, 
+0x61726170, 0x0000006D, 0x00040005, 0x0000055A, 0x61726170, 0x0000006D, 0x00050005, 0x00000569, 
+0x63736163, 0x46656461, 0x00656461, 0x00050005, 0x0000056C, 0x63736163, 0x4E656461, 0x00747865, 
+0x00040005, 0x00000584, 0x61726170, 0x0000006D, 0x00040005, 0x00000586, 0x61726170, 0x0000006D, 
+0x00040005, 0x00000588, 0x61726170, 0x0000006D, 0x00040005, 0x0000058A, 0x61726170, 0x0000006D, 
+0x00040005, 0x0000058C, 0x61726170, 0x0000006D, 0x00040005, 0x0000058E, 0x61726170, 0x0000006D, 
+0x00060005, 0x00000591, 0x64616873, 0x6D41776F, 0x746E756F, 0x00000031, 0x00060005, 0x0000043A, 
+0x6D616C63, 0x566F4E70, 0x3B316628, 0x00000000, 0x00030005, 0x0000059B, 0x00566F4E, 0x00180005, 
+0x00000451, 0x66666944, 0x4C657375, 0x2865626F, 0x75727473, 0x4D2D7463, 0x72657461, 0x2D6C6169, 
 0x2D346676, 0x662D3166, 0x31662D31, 0x2D31662D, 0x2D336676, 0x2D336676, 0x762D3166, 0x662D3366, 
 0x66762D31, 0x66762D33, 0x66762D33, 0x663B3132, 0x31663B31, 0x3B31663B, 0x00000000, 0x00050005, 
-0x000000C2, 0x6574616D, 0x6C616972, 0x00000000, 0x00030005, 0x000000C3, 0x00566F4E, 0x00030005, 
-0x000000C4, 0x004C6F4E, 0x00030005, 0x000000C5, 0x00486F4C, 0x00230005, 0x000000CF, 0x63657053, 
+0x000005A0, 0x6574616D, 0x6C616972, 0x00000000, 0x00030005, 0x000005A1, 0x00566F4E, 0x00030005, 
+0x000005A2, 0x004C6F4E, 0x00030005, 0x000005A3, 0x00486F4C, 0x00040005, 0x000005A9, 0x61726170, 
+0x0000006D, 0x00040005, 0x000005AC, 0x61726170, 0x0000006D, 0x00040005, 0x000005AE, 0x61726170, 
+0x0000006D, 0x00040005, 0x000005B0, 0x61726170, 0x0000006D, 0x00230005, 0x0000045C, 0x63657053, 
 0x72616C75, 0x65626F4C, 0x72747328, 0x2D746375, 0x6574614D, 0x6C616972, 0x3466762D, 0x2D31662D, 
 0x662D3166, 0x31662D31, 0x3366762D, 0x3366762D, 0x2D31662D, 0x2D336676, 0x762D3166, 0x762D3366, 
 0x762D3366, 0x3B313266, 0x75727473, 0x4C2D7463, 0x74686769, 0x3466762D, 0x3466762D, 0x3466762D, 
 0x2D31662D, 0x662D3166, 0x31662D31, 0x66763B31, 0x31663B33, 0x3B31663B, 0x663B3166, 0x00003B31, 
-0x00050005, 0x000000C8, 0x6574616D, 0x6C616972, 0x00000000, 0x00040005, 0x000000C9, 0x6867696C, 
-0x00000074, 0x00030005, 0x000000CA, 0x00000068, 0x00030005, 0x000000CB, 0x00566F4E, 0x00030005, 
-0x000000CC, 0x004C6F4E, 0x00030005, 0x000000CD, 0x00486F4E, 0x00030005, 0x000000CE, 0x00486F4C, 
-0x00170005, 0x000000D6, 0x6867694C, 0x676E6974, 0x33667628, 0x3366763B, 0x7274733B, 0x2D746375, 
-0x6574614D, 0x6C616972, 0x3466762D, 0x2D31662D, 0x662D3166, 0x31662D31, 0x3366762D, 0x3366762D, 
-0x2D31662D, 0x2D336676, 0x762D3166, 0x762D3366, 0x762D3366, 0x3B313266, 0x00000000, 0x00030005, 
-0x000000D3, 0x00003046, 0x00040005, 0x000000D4, 0x6F507377, 0x00000073, 0x00050005, 0x000000D5, 
-0x6574616D, 0x6C616972, 0x00000000, 0x00150005, 0x000000DB, 0x284C4249, 0x3B336676, 0x3B336676, 
-0x75727473, 0x4D2D7463, 0x72657461, 0x2D6C6169, 0x2D346676, 0x662D3166, 0x31662D31, 0x2D31662D, 
-0x2D336676, 0x2D336676, 0x762D3166, 0x662D3366, 0x66762D31, 0x66762D33, 0x66762D33, 0x003B3132, 
-0x00030005, 0x000000D8, 0x00003046, 0x00030005, 0x000000D9, 0x0000724C, 0x00050005, 0x000000DA, 
-0x6574616D, 0x6C616972, 0x00000000, 0x00050005, 0x000000DE, 0x64616853, 0x6146776F, 0x00006564, 
-0x00030005, 0x000000E0, 0x00494850, 0x00030005, 0x000000E2, 0x00003278, 0x00040005, 0x000000F3, 
-0x61726170, 0x0000006D, 0x00030005, 0x00000106, 0x0048784E, 0x00030005, 0x00000108, 0x00000061, 
-0x00030005, 0x0000010C, 0x0000006B, 0x00030005, 0x00000116, 0x00000064, 0x00040005, 0x00000126, 
-0x61726170, 0x0000006D, 0x00030005, 0x00000138, 0x00303966, 0x00060005, 0x00000142, 0x6867696C, 
-0x61635374, 0x72657474, 0x00000000, 0x00040005, 0x00000143, 0x61726170, 0x0000006D, 0x00040005, 
-0x00000144, 0x61726170, 0x0000006D, 0x00040005, 0x00000146, 0x61726170, 0x0000006D, 0x00050005, 
-0x00000149, 0x77656976, 0x74616353, 0x00726574, 0x00040005, 0x0000014A, 0x61726170, 0x0000006D, 
-0x00040005, 0x0000014B, 0x61726170, 0x0000006D, 0x00040005, 0x0000014D, 0x61726170, 0x0000006D, 
-0x00030005, 0x00000156, 0x00003261, 0x00040005, 0x0000015A, 0x4C584747, 0x00000000, 0x00040005, 
-0x00000168, 0x56584747, 0x00000000, 0x00050005, 0x0000017C, 0x72657061, 0x65727574, 0x00000000, 
-0x00050005, 0x00000182, 0x7263696D, 0x6168536F, 0x00776F64, 0x00040005, 0x00000186, 0x61726170, 
-0x0000006D, 0x00040005, 0x0000018D, 0x61726170, 0x0000006D, 0x00040005, 0x0000018F, 0x61726170, 
-0x0000006D, 0x00040005, 0x00000191, 0x61726170, 0x0000006D, 0x00040005, 0x00000193, 0x61726170, 
-0x0000006D, 0x00040005, 0x000001BA, 0x61726170, 0x0000006D, 0x00040005, 0x000001BC, 0x61726170, 
-0x0000006D, 0x00040005, 0x000001C1, 0x61726170, 0x0000006D, 0x00040005, 0x000001C3, 0x61726170, 
-0x0000006D, 0x00040005, 0x000001C5, 0x61726170, 0x0000006D, 0x00030005, 0x000001CA, 0x00303966, 
-0x00040005, 0x000001CE, 0x61726170, 0x0000006D, 0x00040005, 0x000001D0, 0x61726170, 0x0000006D, 
-0x00040005, 0x000001D2, 0x61726170, 0x0000006D, 0x00070005, 0x000001E7, 0x66696E55, 0x4D6D726F, 
-0x72657461, 0x446C6169, 0x00617461, 0x00070006, 0x000001E7, 0x00000000, 0x65626C41, 0x6F436F64, 
-0x72756F6C, 0x00000000, 0x00060006, 0x000001E7, 0x00000001, 0x67756F52, 0x73656E68, 0x00000073, 
-0x00060006, 0x000001E7, 0x00000002, 0x6174654D, 0x63696C6C, 0x00000000, 0x00060006, 0x000001E7, 
-0x00000003, 0x6C666552, 0x61746365, 0x0065636E, 0x00060006, 0x000001E7, 0x00000004, 0x73696D45, 
-0x65766973, 0x00000000, 0x00070006, 0x000001E7, 0x00000005, 0x65626C41, 0x614D6F64, 0x63614670, 
-0x00726F74, 0x00080006, 0x000001E7, 0x00000006, 0x6174654D, 0x63696C6C, 0x4670614D, 0x6F746361, 
-0x00000072, 0x00080006, 0x000001E7, 0x00000007, 0x67756F52, 0x73656E68, 0x70614D73, 0x74636146, 
-0x0000726F, 0x00070006, 0x000001E7, 0x00000008, 0x6D726F4E, 0x614D6C61, 0x63614670, 0x00726F74, 
-0x00080006, 0x000001E7, 0x00000009, 0x73696D45, 0x65766973, 0x4670614D, 0x6F746361, 0x00000072, 
-0x00060006, 0x000001E7, 0x0000000A, 0x614D4F41, 0x63614670, 0x00726F74, 0x00060006, 0x000001E7, 
-0x0000000B, 0x68706C41, 0x74754361, 0x0066664F, 0x00060006, 0x000001E7, 0x0000000C, 0x6B726F77, 
-0x776F6C66, 0x00000000, 0x00060005, 0x000001E9, 0x614D5F75, 0x69726574, 0x61446C61, 0x00006174, 
-0x00050005, 0x000001FF, 0x6C415F75, 0x6F646562, 0x0070614D, 0x00050005, 0x00000202, 0x74726556, 
-0x61447865, 0x00006174, 0x00050006, 0x00000202, 0x00000000, 0x6F6C6F43, 0x00007275, 0x00060006, 
-0x00000202, 0x00000001, 0x43786554, 0x64726F6F, 0x00000000, 0x00060006, 0x00000202, 0x00000002, 
-0x69736F50, 0x6E6F6974, 0x00000000, 0x00050006, 0x00000202, 0x00000003, 0x6D726F4E, 0x00006C61, 
-0x00060006, 0x00000202, 0x00000004, 0x6C726F57, 0x726F4E64, 0x006C616D, 0x00060005, 0x00000204, 
-0x74726556, 0x754F7865, 0x74757074, 0x00000000, 0x00040005, 0x0000020A, 0x61726170, 0x0000006D, 
-0x00060005, 0x00000223, 0x654D5F75, 0x6C6C6174, 0x614D6369, 0x00000070, 0x00060005, 0x0000023F, 
-0x6F525F75, 0x6E686775, 0x4D737365, 0x00007061, 0x00040005, 0x00000256, 0x4F415F75, 0x0070614D, 
-0x00060005, 0x00000272, 0x6D455F75, 0x69737369, 0x614D6576, 0x00000070, 0x00040005, 0x00000277, 
-0x61726170, 0x0000006D, 0x00050005, 0x00000289, 0x646C6F47, 0x6E416E65, 0x00656C67, 0x00030005, 
-0x0000028B, 0x00000072, 0x00040005, 0x00000292, 0x74656874, 0x00000061, 0x00040005, 0x00000299, 
-0x656E6973, 0x00000000, 0x00040005, 0x0000029C, 0x69736F63, 0x0000656E, 0x00050005, 0x000002A8, 
-0x5F746F64, 0x646F7270, 0x00746375, 0x00040005, 0x000002B4, 0x64656573, 0x00000034, 0x00040005, 
-0x000002BC, 0x61726170, 0x0000006D, 0x00040005, 0x000002C1, 0x426E696D, 0x00736169, 0x00040005, 
-0x000002C2, 0x6867694C, 0x00000074, 0x00050006, 0x000002C2, 0x00000000, 0x6F6C6F63, 0x00007275, 
-0x00060006, 0x000002C2, 0x00000001, 0x69736F70, 0x6E6F6974, 0x00000000, 0x00060006, 0x000002C2, 
-0x00000002, 0x65726964, 0x6F697463, 0x0000006E, 0x00060006, 0x000002C2, 0x00000003, 0x65746E69, 
-0x7469736E, 0x00000079, 0x00050006, 0x000002C2, 0x00000004, 0x69646172, 0x00007375, 0x00050006, 
-0x000002C2, 0x00000005, 0x65707974, 0x00000000, 0x00050006, 0x000002C2, 0x00000006, 0x6C676E61, 
-0x00000065, 0x00070005, 0x000002C9, 0x66696E55, 0x536D726F, 0x656E6563, 0x61746144, 0x00000000, 
-0x00050006, 0x000002C9, 0x00000000, 0x6867696C, 0x00007374, 0x00070006, 0x000002C9, 0x00000001, 
-0x64616853, 0x7254776F, 0x66736E61, 0x006D726F, 0x00060006, 0x000002C9, 0x00000002, 0x77656956, 
-0x7274614D, 0x00007869, 0x00060006, 0x000002C9, 0x00000003, 0x6867694C, 0x65695674, 0x00000077, 
-0x00060006, 0x000002C9, 0x00000004, 0x73616942, 0x7274614D, 0x00007869, 0x00070006, 0x000002C9, 
-0x00000005, 0x656D6163, 0x6F506172, 0x69746973, 0x00006E6F, 0x00060006, 0x000002C9, 0x00000006, 
-0x696C7053, 0x70654474, 0x00736874, 0x00060006, 0x000002C9, 0x00000007, 0x6867694C, 0x7A695374, 
-0x00000065, 0x00070006, 0x000002C9, 0x00000008, 0x5378614D, 0x6F646168, 0x73694477, 0x00000074, 
-0x00060006, 0x000002C9, 0x00000009, 0x64616853, 0x6146776F, 0x00006564, 0x00060006, 0x000002C9, 
-0x0000000A, 0x63736143, 0x46656461, 0x00656461, 0x00060006, 0x000002C9, 0x0000000B, 0x6867694C, 
-0x756F4374, 0x0000746E, 0x00060006, 0x000002C9, 0x0000000C, 0x64616853, 0x6F43776F, 0x00746E75, 
-0x00050006, 0x000002C9, 0x0000000D, 0x65646F4D, 0x00000000, 0x00060006, 0x000002C9, 0x0000000E, 
-0x4D766E45, 0x6F437069, 0x00746E75, 0x00060006, 0x000002C9, 0x0000000F, 0x74696E49, 0x426C6169, 
-0x00736169, 0x00050006, 0x000002C9, 0x00000010, 0x74646957, 0x00000068, 0x00050006, 0x000002C9, 
-0x00000011, 0x67696548, 0x00007468, 0x00070006, 0x000002C9, 0x00000012, 0x64616873, 0x6E45776F, 
-0x656C6261, 0x00000064, 0x00050005, 0x000002CB, 0x63535F75, 0x44656E65, 0x00617461, 0x00040005, 
-0x000002CF, 0x73616962, 0x00000000, 0x00040005, 0x000002DB, 0x6967616D, 0x00000063, 0x00040005, 
-0x000002EC, 0x73616962, 0x00000000, 0x00040005, 0x000002ED, 0x61726170, 0x0000006D, 0x00040005, 
-0x000002EF, 0x61726170, 0x0000006D, 0x00040005, 0x000002F1, 0x61726170, 0x0000006D, 0x00030005, 
-0x000002F4, 0x006D7573, 0x00040005, 0x000002F5, 0x73696F6E, 0x00000065, 0x00040005, 0x000002F6, 
-0x61726170, 0x0000006D, 0x00090005, 0x000002FA, 0x53766E69, 0x72617571, 0x6F6F5265, 0x6D615374, 
-0x73656C70, 0x6E756F43, 0x00000074, 0x00050005, 0x000002FB, 0x6F6F6C66, 0x50646572, 0x0000736F, 
-0x00040005, 0x00000300, 0x65646E69, 0x00000078, 0x00040005, 0x00000302, 0x61726170, 0x0000006D, 
-0x00040005, 0x00000304, 0x61726170, 0x0000006D, 0x00030005, 0x0000030A, 0x00000069, 0x00040005, 
-0x00000312, 0x7366666F, 0x00007465, 0x00060005, 0x00000314, 0x465F6C67, 0x43676172, 0x64726F6F, 
-0x00000000, 0x00040005, 0x00000315, 0x61726170, 0x0000006D, 0x00040005, 0x00000319, 0x61726170, 
-0x0000006D, 0x00040005, 0x0000031B, 0x61726170, 0x0000006D, 0x00040005, 0x0000031D, 0x61726170, 
-0x0000006D, 0x00030005, 0x00000322, 0x0000007A, 0x00060005, 0x0000033E, 0x63736163, 0x49656461, 
-0x7865646E, 0x00000000, 0x00040005, 0x0000033F, 0x77656976, 0x00736F50, 0x00030005, 0x00000349, 
-0x00000069, 0x00060005, 0x00000365, 0x64616873, 0x6944776F, 0x6E617473, 0x00006563, 0x00070005, 
-0x00000369, 0x6E617274, 0x69746973, 0x69446E6F, 0x6E617473, 0x00006563, 0x00040005, 0x0000036C, 
-0x77656976, 0x00736F50, 0x00050005, 0x00000375, 0x74736964, 0x65636E61, 0x00000000, 0x00050005, 
-0x00000383, 0x64616873, 0x6F43776F, 0x0064726F, 0x00040005, 0x00000395, 0x5241454E, 0x00000000, 
-0x00050005, 0x00000397, 0x61527675, 0x73756964, 0x00000000, 0x00060005, 0x000003A2, 0x64616873, 
-0x6D41776F, 0x746E756F, 0x00000000, 0x00050005, 0x000003A3, 0x61685375, 0x4D776F64, 0x00007061, 
-0x00040005, 0x000003A4, 0x61726170, 0x0000006D, 0x00040005, 0x000003A6, 0x61726170, 0x0000006D, 
-0x00040005, 0x000003A8, 0x61726170, 0x0000006D, 0x00040005, 0x000003AA, 0x61726170, 0x0000006D, 
-0x00040005, 0x000003AC, 0x61726170, 0x0000006D, 0x00040005, 0x000003AE, 0x61726170, 0x0000006D, 
-0x00050005, 0x000003B1, 0x63736163, 0x46656461, 0x00656461, 0x00050005, 0x000003BE, 0x63736163, 
-0x4E656461, 0x00747865, 0x00060005, 0x000003D8, 0x64616873, 0x6D41776F, 0x746E756F, 0x00000031, 
-0x00040005, 0x000003D9, 0x61726170, 0x0000006D, 0x00040005, 0x000003DB, 0x61726170, 0x0000006D, 
-0x00040005, 0x000003DD, 0x61726170, 0x0000006D, 0x00040005, 0x000003DF, 0x61726170, 0x0000006D, 
-0x00040005, 0x000003E1, 0x61726170, 0x0000006D, 0x00040005, 0x000003E3, 0x61726170, 0x0000006D, 
-0x00030005, 0x000003F1, 0x00000044, 0x00040005, 0x000003F3, 0x61726170, 0x0000006D, 0x00040005, 
-0x000003F5, 0x61726170, 0x0000006D, 0x00030005, 0x000003F8, 0x00000056, 0x00040005, 0x000003F9, 
-0x61726170, 0x0000006D, 0x00040005, 0x000003FB, 0x61726170, 0x0000006D, 0x00040005, 0x000003FD, 
-0x61726170, 0x0000006D, 0x00030005, 0x00000400, 0x00000046, 0x00040005, 0x00000402, 0x61726170, 
-0x0000006D, 0x00040005, 0x0000040E, 0x61726170, 0x0000006D, 0x00040005, 0x00000410, 0x61726170, 
-0x0000006D, 0x00040005, 0x00000412, 0x61726170, 0x0000006D, 0x00040005, 0x00000414, 0x61726170, 
-0x0000006D, 0x00040005, 0x0000041A, 0x61726170, 0x0000006D, 0x00040005, 0x0000041C, 0x61726170, 
-0x0000006D, 0x00040005, 0x0000041E, 0x61726170, 0x0000006D, 0x00040005, 0x00000420, 0x61726170, 
-0x0000006D, 0x00040005, 0x00000425, 0x75736572, 0x0000746C, 0x00030005, 0x00000427, 0x00000069, 
-0x00040005, 0x00000433, 0x6867696C, 0x00000074, 0x00040005, 0x00000447, 0x756C6176, 0x00000065, 
-0x00030005, 0x0000044D, 0x0000004C, 0x00040005, 0x00000453, 0x74736964, 0x00000000, 0x00040005, 
-0x00000458, 0x65747461, 0x0000006E, 0x00050005, 0x0000045F, 0x65747461, 0x7461756E, 0x006E6F69, 
-0x00030005, 0x00000478, 0x0000004C, 0x00050005, 0x0000047E, 0x6F747563, 0x6E416666, 0x00656C67, 
-0x00040005, 0x00000482, 0x74736964, 0x00000000, 0x00040005, 0x00000487, 0x74656874, 0x00000061, 
-0x00040005, 0x0000048D, 0x69737065, 0x006E6F6C, 0x00050005, 0x00000493, 0x65747461, 0x7461756E, 
-0x006E6F69, 0x00040005, 0x000004A4, 0x746F446E, 0x0000004C, 0x00060005, 0x000004B4, 0x63736163, 
-0x49656461, 0x7865646E, 0x00000000, 0x00040005, 0x000004B5, 0x61726170, 0x0000006D, 0x00040005, 
-0x000004B8, 0x61726170, 0x0000006D, 0x00040005, 0x000004BA, 0x61726170, 0x0000006D, 0x00040005, 
-0x000004BC, 0x61726170, 0x0000006D, 0x00040005, 0x000004C0, 0x61726170, 0x0000006D, 0x00030005, 
-0x000004C5, 0x0000694C, 0x00050005, 0x000004C9, 0x6461724C, 0x636E6169, 0x00000065, 0x00030005, 
-0x000004D0, 0x0000684C, 0x00050005, 0x000004D6, 0x6867696C, 0x4C6F4E74, 0x00000000, 0x00040005, 
-0x000004DB, 0x61726170, 0x0000006D, 0x00030005, 0x000004DD, 0x00000068, 0x00050005, 0x000004E3, 
-0x64616873, 0x5F676E69, 0x00566F4E, 0x00040005, 0x000004E9, 0x61726170, 0x0000006D, 0x00030005, 
-0x000004EB, 0x00566F4E, 0x00030005, 0x000004ED, 0x004C6F4E, 0x00040005, 0x000004EE, 0x61726170, 
-0x0000006D, 0x00030005, 0x000004F1, 0x00486F4E, 0x00040005, 0x000004F6, 0x61726170, 0x0000006D, 
-0x00030005, 0x000004F8, 0x00486F4C, 0x00040005, 0x000004FC, 0x61726170, 0x0000006D, 0x00030005, 
-0x000004FE, 0x00006446, 0x00040005, 0x00000500, 0x61726170, 0x0000006D, 0x00040005, 0x00000502, 
-0x61726170, 0x0000006D, 0x00040005, 0x00000504, 0x61726170, 0x0000006D, 0x00030005, 0x00000507, 
-0x00007246, 0x00040005, 0x0000050B, 0x61726170, 0x0000006D, 0x00040005, 0x0000050D, 0x61726170, 
-0x0000006D, 0x00040005, 0x0000050F, 0x61726170, 0x0000006D, 0x00040005, 0x00000511, 0x61726170, 
-0x0000006D, 0x00040005, 0x00000514, 0x6F6C6F63, 0x00007275, 0x00040005, 0x0000051E, 0x61726170, 
-0x0000006D, 0x00040005, 0x00000520, 0x61726170, 0x0000006D, 0x00050005, 0x0000052D, 0x61727269, 
-0x6E616964, 0x00006563, 0x00040005, 0x00000531, 0x72724975, 0x0070614D, 0x00030005, 0x00000537, 
-0x00000046, 0x00040005, 0x00000538, 0x61726170, 0x0000006D, 0x00040005, 0x0000053A, 0x61726170, 
-0x0000006D, 0x00040005, 0x0000053D, 0x61726170, 0x0000006D, 0x00030005, 0x00000541, 0x0000646B, 
-0x00050005, 0x00000549, 0x66666964, 0x49657375, 0x00004C42, 0x00080005, 0x0000054F, 0x6E455F75, 
-0x64615276, 0x636E6169, 0x78655465, 0x6576654C, 0x0000736C, 0x00070005, 0x00000553, 0x63657073, 
-0x72616C75, 0x61727249, 0x6E616964, 0x00006563, 0x00040005, 0x00000554, 0x766E4575, 0x0070614D, 
-0x00050005, 0x0000055E, 0x63657073, 0x72616C75, 0x004C4249, 0x00050005, 0x00000571, 0x43786574, 
-0x756F6C6F, 0x00000072, 0x00050005, 0x0000057B, 0x6174656D, 0x63696C6C, 0x00000000, 0x00050005, 
-0x0000057C, 0x67756F72, 0x73656E68, 0x00000073, 0x00030005, 0x0000058B, 0x00786574, 0x00030005, 
-0x000005AF, 0x00786574, 0x00050005, 0x000005CD, 0x6574616D, 0x6C616972, 0x00000000, 0x00050005, 
-0x000005E2, 0x6F4E5F75, 0x6C616D72, 0x0070614D, 0x00040005, 0x000005FB, 0x61726170, 0x0000006D, 
-0x00030005, 0x00000601, 0x00007675, 0x00040005, 0x0000060B, 0x6F617373, 0x00000000, 0x00050005, 
-0x0000060C, 0x41535375, 0x70614D4F, 0x00000000, 0x00040005, 0x0000061B, 0x61726170, 0x0000006D, 
-0x00050005, 0x00000620, 0x67756F72, 0x73656E68, 0x00003273, 0x00040005, 0x00000624, 0x75646E64, 
-0x00000000, 0x00040005, 0x00000628, 0x76646E64, 0x00000000, 0x00050005, 0x0000062C, 0x69726176, 
-0x65636E61, 0x00000000, 0x00070005, 0x00000634, 0x6E72656B, 0x6F526C65, 0x6E686775, 0x32737365, 
-0x00000000, 0x00070005, 0x00000639, 0x746C6966, 0x64657265, 0x67756F52, 0x73656E68, 0x00003273, 
-0x00040005, 0x0000063D, 0x61726170, 0x0000006D, 0x00040005, 0x00000647, 0x6F507377, 0x00000073, 
-0x00050005, 0x0000065A, 0x44524275, 0x54554C46, 0x00000000, 0x00050005, 0x00000664, 0x6C666572, 
-0x61746365, 0x0065636E, 0x00040005, 0x00000665, 0x61726170, 0x0000006D, 0x00030005, 0x00000669, 
-0x00003046, 0x00040005, 0x0000066C, 0x61726170, 0x0000006D, 0x00040005, 0x0000066F, 0x61726170, 
-0x0000006D, 0x00040005, 0x00000681, 0x61726170, 0x0000006D, 0x00030005, 0x0000068B, 0x0000724C, 
-0x00070005, 0x00000695, 0x6867696C, 0x6E6F4374, 0x62697274, 0x6F697475, 0x0000006E, 0x00040005, 
-0x00000696, 0x61726170, 0x0000006D, 0x00040005, 0x00000699, 0x61726170, 0x0000006D, 0x00040005, 
-0x0000069B, 0x61726170, 0x0000006D, 0x00060005, 0x0000069E, 0x436C6269, 0x72746E6F, 0x74756269, 
-0x006E6F69, 0x00040005, 0x0000069F, 0x61726170, 0x0000006D, 0x00040005, 0x000006A2, 0x61726170, 
-0x0000006D, 0x00040005, 0x000006A4, 0x61726170, 0x0000006D, 0x00050005, 0x000006A7, 0x616E6966, 
-0x6C6F436C, 0x0072756F, 0x00050005, 0x000006AF, 0x4374756F, 0x756F6C6F, 0x00000072, 0x00060005, 
-0x000006EE, 0x63736163, 0x49656461, 0x7865646E, 0x00000000, 0x00040005, 0x000006EF, 0x61726170, 
-0x0000006D, 0x00030005, 0x0000070D, 0x004F4255, 0x00060006, 0x0000070D, 0x00000000, 0x6A6F7270, 
-0x77656956, 0x00000000, 0x00060005, 0x0000070F, 0x61435F75, 0x6172656D, 0x61746144, 0x00000000, 
-0x00050005, 0x00000711, 0x64616853, 0x6144776F, 0x00006174, 0x00080006, 0x00000711, 0x00000000, 
-0x4C726944, 0x74686769, 0x7274614D, 0x73656369, 0x00000000, 0x00050005, 0x00000713, 0x69445F75, 
-0x61685372, 0x00776F64, 0x00060005, 0x00000716, 0x656E6F42, 0x6E617254, 0x726F6673, 0x0000736D, 
-0x00070006, 0x00000716, 0x00000000, 0x656E6F42, 0x6E617254, 0x726F6673, 0x0000736D, 0x00070005, 
-0x00000718, 0x6F425F75, 0x7254656E, 0x66736E61, 0x736D726F, 0x00000000, 0x00050048, 0x000001E7, 
-0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x000001E7, 0x00000001, 0x00000023, 0x00000010, 
-0x00050048, 0x000001E7, 0x00000002, 0x00000023, 0x00000014, 0x00050048, 0x000001E7, 0x00000003, 
-0x00000023, 0x00000018, 0x00050048, 0x000001E7, 0x00000004, 0x00000023, 0x0000001C, 0x00050048, 
-0x000001E7, 0x00000005, 0x00000023, 0x00000020, 0x00050048, 0x000001E7, 0x00000006, 0x00000023, 
-0x00000024, 0x00050048, 0x000001E7, 0x00000007, 0x00000023, 0x00000028, 0x00050048, 0x000001E7, 
-0x00000008, 0x00000023, 0x0000002C, 0x00050048, 0x000001E7, 0x00000009, 0x00000023, 0x00000030, 
-0x00050048, 0x000001E7, 0x0000000A, 0x00000023, 0x00000034, 0x00050048, 0x000001E7, 0x0000000B, 
-0x00000023, 0x00000038, 0x00050048, 0x000001E7, 0x0000000C, 0x00000023, 0x0000003C, 0x00030047, 
-0x000001E7, 0x00000002, 0x00040047, 0x000001E9, 0x00000022, 0x00000001, 0x00040047, 0x000001E9, 
-0x00000021, 0x00000006, 0x00040047, 0x000001FF, 0x00000022, 0x00000001, 0x00040047, 0x000001FF, 
-0x00000021, 0x00000000, 0x00040047, 0x00000204, 0x0000001E, 0x00000000, 0x00040047, 0x00000223, 
-0x00000022, 0x00000001, 0x00040047, 0x00000223, 0x00000021, 0x00000001, 0x00040047, 0x0000023F, 
-0x00000022, 0x00000001, 0x00040047, 0x0000023F, 0x00000021, 0x00000002, 0x00040047, 0x00000256, 
-0x00000022, 0x00000001, 0x00040047, 0x00000256, 0x00000021, 0x00000004, 0x00040047, 0x00000272, 
-0x00000022, 0x00000001, 0x00040047, 0x00000272, 0x00000021, 0x00000005, 0x00050048, 0x000002C2, 
-0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x000002C2, 0x00000001, 0x00000023, 0x00000010, 
-0x00050048, 0x000002C2, 0x00000002, 0x00000023, 0x00000020, 0x00050048, 0x000002C2, 0x00000003, 
-0x00000023, 0x00000030, 0x00050048, 0x000002C2, 0x00000004, 0x00000023, 0x00000034, 0x00050048, 
-0x000002C2, 0x00000005, 0x00000023, 0x00000038, 0x00050048, 0x000002C2, 0x00000006, 0x00000023, 
-0x0000003C, 0x00040047, 0x000002C4, 0x00000006, 0x00000040, 0x00040047, 0x000002C7, 0x00000006, 
-0x00000040, 0x00040047, 0x000002C8, 0x00000006, 0x00000010, 0x00050048, 0x000002C9, 0x00000000, 
-0x00000023, 0x00000000, 0x00040048, 0x000002C9, 0x00000001, 0x00000005, 0x00050048, 0x000002C9, 
-0x00000001, 0x00000023, 0x00000800, 0x00050048, 0x000002C9, 0x00000001, 0x00000007, 0x00000010, 
-0x00040048, 0x000002C9, 0x00000002, 0x00000005, 0x00050048, 0x000002C9, 0x00000002, 0x00000023, 
-0x00000900, 0x00050048, 0x000002C9, 0x00000002, 0x00000007, 0x00000010, 0x00040048, 0x000002C9, 
-0x00000003, 0x00000005, 0x00050048, 0x000002C9, 0x00000003, 0x00000023, 0x00000940, 0x00050048, 
-0x000002C9, 0x00000003, 0x00000007, 0x00000010, 0x00040048, 0x000002C9, 0x00000004, 0x00000005, 
-0x00050048, 0x000002C9, 0x00000004, 0x00000023, 0x00000980, 0x00050048, 0x000002C9, 0x00000004, 
-0x00000007, 0x00000010, 0x00050048, 0x000002C9, 0x00000005, 0x00000023, 0x000009C0, 0x00050048, 
-0x000002C9, 0x00000006, 0x00000023, 0x000009D0, 0x00050048, 0x000002C9, 0x00000007, 0x00000023, 
-0x00000A10, 0x00050048, 0x000002C9, 0x00000008, 0x00000023, 0x00000A14, 0x00050048, 0x000002C9, 
-0x00000009, 0x00000023, 0x00000A18, 0x00050048, 0x000002C9, 0x0000000A, 0x00000023, 0x00000A1C, 
-0x00050048, 0x000002C9, 0x0000000B, 0x00000023, 0x00000A20, 0x00050048, 0x000002C9, 0x0000000C, 
-0x00000023, 0x00000A24, 0x00050048, 0x000002C9, 0x0000000D, 0x00000023, 0x00000A28, 0x00050048, 
-0x000002C9, 0x0000000E, 0x00000023, 0x00000A2C, 0x00050048, 0x000002C9, 0x0000000F, 0x00000023, 
-0x00000A30, 0x00050048, 0x000002C9, 0x00000010, 0x00000023, 0x00000A34, 0x00050048, 0x000002C9, 
-0x00000011, 0x00000023, 0x00000A38, 0x00050048, 0x000002C9, 0x00000012, 0x00000023, 0x00000A3C, 
-0x00030047, 0x000002C9, 0x00000002, 0x00040047, 0x000002CB, 0x00000022, 0x00000002, 0x00040047, 
-0x000002CB, 0x00000021, 0x00000005, 0x00040047, 0x00000314, 0x0000000B, 0x0000000F, 0x00040047, 
-0x000003A3, 0x00000022, 0x00000002, 0x00040047, 0x000003A3, 0x00000021, 0x00000000, 0x00040047, 
-0x00000531, 0x00000022, 0x00000002, 0x00040047, 0x00000531, 0x00000021, 0x00000002, 0x00040047, 
-0x00000554, 0x00000022, 0x00000002, 0x00040047, 0x00000554, 0x00000021, 0x00000001, 0x00040047, 
-0x000005E2, 0x00000022, 0x00000001, 0x00040047, 0x000005E2, 0x00000021, 0x00000003, 0x00040047, 
-0x0000060C, 0x00000022, 0x00000002, 0x00040047, 0x0000060C, 0x00000021, 0x00000004, 0x00040047, 
-0x0000065A, 0x00000022, 0x00000002, 0x00040047, 0x0000065A, 0x00000021, 0x00000003, 0x00040047, 
-0x000006AF, 0x0000001E, 0x00000000, 0x00040048, 0x0000070D, 0x00000000, 0x00000005, 0x00050048, 
-0x0000070D, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x0000070D, 0x00000000, 0x00000007, 
-0x00000010, 0x00030047, 0x0000070D, 0x00000002, 0x00040047, 0x0000070F, 0x00000022, 0x00000000, 
-0x00040047, 0x0000070F, 0x00000021, 0x00000000, 0x00040047, 0x00000710, 0x00000006, 0x00000040, 
-0x00040048, 0x00000711, 0x00000000, 0x00000005, 0x00050048, 0x00000711, 0x00000000, 0x00000023, 
-0x00000000, 0x00050048, 0x00000711, 0x00000000, 0x00000007, 0x00000010, 0x00030047, 0x00000711, 
-0x00000002, 0x00040047, 0x00000713, 0x00000022, 0x00000000, 0x00040047, 0x00000713, 0x00000021, 
-0x00000001, 0x00040047, 0x00000715, 0x00000006, 0x00000040, 0x00040048, 0x00000716, 0x00000000, 
-0x00000005, 0x00050048, 0x00000716, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000716, 
-0x00000000, 0x00000007, 0x00000010, 0x00030047, 0x00000716, 0x00000002, 0x00040047, 0x00000718, 
-0x00000022, 0x00000003, 0x00040047, 0x00000718, 0x00000021, 0x00000000, 0x00020013, 0x00000002, 
-0x00030021, 0x00000003, 0x00000002, 0x00030016, 0x00000006, 0x00000020, 0x00040020, 0x00000007, 
-0x00000007, 0x00000006, 0x00040021, 0x00000008, 0x00000006, 0x00000007, 0x00040017, 0x0000000C, 
-0x00000006, 0x00000003, 0x00040020, 0x0000000D, 0x00000007, 0x0000000C, 0x00040021, 0x0000000E, 
-0x0000000C, 0x0000000D, 0x00040017, 0x00000012, 0x00000006, 0x00000004, 0x00040020, 0x00000013, 
-0x00000007, 0x00000012, 0x00040021, 0x00000014, 0x00000012, 0x00000013, 0x00070021, 0x0000001B, 
-0x00000006, 0x00000007, 0x00000007, 0x0000000C, 0x0000000C, 0x00060021, 0x00000022, 0x0000000C, 
-0x0000000C, 0x00000007, 0x00000007, 0x00060021, 0x00000028, 0x00000006, 0x00000007, 0x00000007, 
-0x00000007, 0x00070021, 0x0000002E, 0x00000006, 0x00000007, 0x00000007, 0x00000007, 0x00000007, 
-0x00050021, 0x0000003A, 0x00000006, 0x00000007, 0x00000007, 0x00050021, 0x00000048, 0x0000000C, 
-0x00000012, 0x00000007, 0x00060021, 0x0000004D, 0x0000000C, 0x00000012, 0x00000007, 0x00000007, 
-0x00050021, 0x00000064, 0x0000000C, 0x0000000C, 0x00000007, 0x00060021, 0x00000069, 0x0000000C, 
-0x0000000D, 0x00000007, 0x00000007, 0x00030021, 0x0000006F, 0x00000012, 0x00030021, 0x00000072, 
-0x0000000C, 0x00030021, 0x00000075, 0x00000006, 0x00040017, 0x0000007D, 0x00000006, 0x00000002, 
-0x00040020, 0x0000007E, 0x00000007, 0x0000007D, 0x00040021, 0x0000007F, 0x00000006, 0x0000007E, 
-0x00040015, 0x00000083, 0x00000020, 0x00000001, 0x00040020, 0x00000084, 0x00000007, 0x00000083, 
-0x00060021, 0x00000085, 0x0000007D, 0x00000084, 0x00000007, 0x00000007, 0x00040021, 0x0000008B, 
-0x00000006, 0x00000013, 0x00050021, 0x0000008F, 0x00000006, 0x0000000D, 0x00000084, 0x00060021, 
-0x00000094, 0x00000006, 0x0000000D, 0x0000000D, 0x00000084, 0x00090019, 0x0000009D, 0x00000006, 
-0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x0003001B, 0x0000009E, 
-0x0000009D, 0x00040020, 0x0000009F, 0x00000000, 0x0000009E, 0x000A0021, 0x000000A0, 0x00000006, 
-0x0000009F, 0x00000013, 0x00000007, 0x0000000D, 0x0000000D, 0x0000000D, 0x00000084, 0x00040021, 
-0x000000AA, 0x00000083, 0x0000000D, 0x00070021, 0x000000AE, 0x00000006, 0x0000000D, 0x00000084, 
-0x0000000D, 0x0000000D, 0x000F001E, 0x000000B5, 0x00000012, 0x00000006, 0x00000006, 0x00000006, 
-0x00000006, 0x0000000C, 0x0000000C, 0x00000006, 0x0000000C, 0x00000006, 0x0000000C, 0x0000000C, 
-0x0000007D, 0x0009001E, 0x000000B6, 0x00000012, 0x00000012, 0x00000012, 0x00000006, 0x00000006, 
-0x00000006, 0x00000006, 0x000A0021, 0x000000B7, 0x0000000C, 0x000000B5, 0x000000B6, 0x0000000C, 
-0x00000007, 0x00000007, 0x00000007, 0x00000007, 0x00070021, 0x000000C1, 0x0000000C, 0x000000B5, 
-0x00000007, 0x00000007, 0x00000007, 0x00040020, 0x000000D1, 0x00000007, 0x000000B5, 0x00060021, 
-0x000000D2, 0x0000000C, 0x0000000D, 0x0000000D, 0x000000D1, 0x00040020, 0x000000DD, 0x00000006, 
-0x00000006, 0x0004003B, 0x000000DD, 0x000000DE, 0x00000006, 0x0004002B, 0x00000006, 0x000000DF, 
-0x3F800000, 0x0004003B, 0x000000DD, 0x000000E0, 0x00000006, 0x0004002B, 0x00000006, 0x000000E1, 
-0x3FCF1BBD, 0x0004002B, 0x00000006, 0x000000EE, 0x400CCCCD, 0x0006002C, 0x0000000C, 0x000000EF, 
-0x000000EE, 0x000000EE, 0x000000EE, 0x00040015, 0x000000F7, 0x00000020, 0x00000000, 0x0004002B, 
-0x000000F7, 0x000000F8, 0x00000003, 0x0004002B, 0x00000006, 0x00000102, 0x00000000, 0x0004002B, 
-0x00000006, 0x0000011A, 0x3EA2F983, 0x0004002B, 0x00000006, 0x0000011D, 0x477FE000, 0x0004002B, 
-0x00000006, 0x00000132, 0x40A00000, 0x0004002B, 0x00000006, 0x00000139, 0x3F000000, 0x0004002B, 
-0x00000006, 0x0000013A, 0x40000000, 0x0004002B, 0x00000006, 0x0000017E, 0x3F7FF972, 0x0004002B, 
-0x00000006, 0x00000199, 0x3DCCCCCD, 0x0004002B, 0x00000006, 0x000001AE, 0x3E23D70A, 0x0004002B, 
-0x00000006, 0x000001CB, 0x41840000, 0x0006002C, 0x0000000C, 0x000001CC, 0x000001CB, 0x000001CB, 
-0x000001CB, 0x000F001E, 0x000001E7, 0x00000012, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 
-0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 
-0x00040020, 0x000001E8, 0x00000002, 0x000001E7, 0x0004003B, 0x000001E8, 0x000001E9, 0x00000002, 
-0x0004002B, 0x00000083, 0x000001EA, 0x00000005, 0x00040020, 0x000001EB, 0x00000002, 0x00000006, 
-0x0004002B, 0x00000006, 0x000001EE, 0x3D4CCCCD, 0x00020014, 0x000001EF, 0x0004002B, 0x00000083, 
-0x000001F3, 0x00000000, 0x00040020, 0x000001F4, 0x00000002, 0x00000012, 0x00090019, 0x000001FC, 
-0x00000006, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x0003001B, 
-0x000001FD, 0x000001FC, 0x00040020, 0x000001FE, 0x00000000, 0x000001FD, 0x0004003B, 0x000001FE, 
-0x000001FF, 0x00000000, 0x00040018, 0x00000201, 0x0000000C, 0x00000003, 0x0007001E, 0x00000202, 
-0x0000000C, 0x0000007D, 0x00000012, 0x0000000C, 0x00000201, 0x00040020, 0x00000203, 0x00000001, 
-0x00000202, 0x0004003B, 0x00000203, 0x00000204, 0x00000001, 0x0004002B, 0x00000083, 0x00000205, 
-0x00000001, 0x00040020, 0x00000206, 0x00000001, 0x0000007D, 0x0004002B, 0x00000083, 0x00000210, 
-0x00000006, 0x0004002B, 0x00000083, 0x00000216, 0x00000002, 0x0004003B, 0x000001FE, 0x00000223, 
-0x00000000, 0x0004002B, 0x00000083, 0x0000022E, 0x00000007, 0x0004003B, 0x000001FE, 0x0000023F, 
-0x00000000, 0x0004002B, 0x000000F7, 0x00000244, 0x00000000, 0x0004002B, 0x00000083, 0x0000024A, 
-0x0000000A, 0x0004003B, 0x000001FE, 0x00000256, 0x00000000, 0x0004002B, 0x00000083, 0x00000260, 
-0x00000009, 0x0004002B, 0x00000083, 0x00000266, 0x00000004, 0x0004003B, 0x000001FE, 0x00000272, 
-0x00000000, 0x0004002B, 0x00000006, 0x0000027F, 0x414FD639, 0x0004002B, 0x00000006, 0x00000280, 
-0x429C774C, 0x0005002C, 0x0000007D, 0x00000281, 0x0000027F, 0x00000280, 0x0004002B, 0x00000006, 
-0x00000284, 0x472AEE8C, 0x0004002B, 0x00000006, 0x0000028A, 0x4019999A, 0x0004002B, 0x00000006, 
-0x000002AA, 0x4234A7F0, 0x0004002B, 0x00000006, 0x000002AB, 0x42BD5893, 0x0007002C, 0x00000012, 
-0x000002AC, 0x0000027F, 0x00000280, 0x000002AA, 0x000002AB, 0x0009001E, 0x000002C2, 0x00000012, 
-0x00000012, 0x00000012, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x0004002B, 0x000000F7, 
-0x000002C3, 0x00000020, 0x0004001C, 0x000002C4, 0x000002C2, 0x000002C3, 0x00040018, 0x000002C5, 
-0x00000012, 0x00000004, 0x0004002B, 0x000000F7, 0x000002C6, 0x00000004, 0x0004001C, 0x000002C7, 
-0x000002C5, 0x000002C6, 0x0004001C, 0x000002C8, 0x00000012, 0x000002C6, 0x0015001E, 0x000002C9, 
-0x000002C4, 0x000002C7, 0x000002C5, 0x000002C5, 0x000002C5, 0x00000012, 0x000002C8, 0x00000006, 
-0x00000006, 0x00000006, 0x00000006, 0x00000083, 0x00000083, 0x00000083, 0x00000083, 0x00000006, 
-0x00000006, 0x00000006, 0x00000083, 0x00040020, 0x000002CA, 0x00000002, 0x000002C9, 0x0004003B, 
-0x000002CA, 0x000002CB, 0x00000002, 0x0004002B, 0x00000083, 0x000002CC, 0x0000000F, 0x0004002B, 
-0x00000006, 0x000002DC, 0x3D897143, 0x0004002B, 0x00000006, 0x000002DD, 0x3BBF4590, 0x0004002B, 
-0x00000006, 0x000002DE, 0x4253EE82, 0x0006002C, 0x0000000C, 0x000002DF, 0x000002DC, 0x000002DD, 
-0x000002DE, 0x0004002B, 0x000000F7, 0x000002E0, 0x00000002, 0x0004002B, 0x00000006, 0x000002FD, 
-0x447A0000, 0x0004002B, 0x00000006, 0x00000301, 0x41800000, 0x0004002B, 0x00000083, 0x00000308, 
-0x00000010, 0x00040020, 0x00000313, 0x00000001, 0x00000012, 0x0004003B, 0x00000313, 0x00000314, 
-0x00000001, 0x0004002B, 0x00000006, 0x0000031F, 0x44800000, 0x0004002B, 0x00000006, 0x0000033A, 
-0x40800000, 0x00040020, 0x00000340, 0x00000002, 0x000002C5, 0x0004002B, 0x00000083, 0x00000350, 
-0x0000000C, 0x00040020, 0x00000351, 0x00000002, 0x00000083, 0x0004002B, 0x00000083, 0x00000366, 
-0x00000008, 0x0004002B, 0x00000006, 0x00000396, 0x3C23D70A, 0x0004002B, 0x00000006, 0x000003A0, 
-0x3B03126F, 0x0004003B, 0x0000009F, 0x000003A3, 0x00000000, 0x0006002C, 0x0000000C, 0x00000426, 
-0x00000102, 0x00000102, 0x00000102, 0x0004002B, 0x00000083, 0x0000042E, 0x0000000B, 0x00040020, 
-0x00000432, 0x00000007, 0x000000B6, 0x00040020, 0x00000435, 0x00000002, 0x000002C2, 0x0004002B, 
-0x00000083, 0x0000043F, 0x00000003, 0x0004002B, 0x00000006, 0x00000490, 0x3F666666, 0x0004002B, 
-0x00000083, 0x000004AB, 0x00000012, 0x00090019, 0x0000052E, 0x00000006, 0x00000003, 0x00000000, 
-0x00000000, 0x00000000, 0x00000001, 0x00000000, 0x0003001B, 0x0000052F, 0x0000052E, 0x00040020, 
-0x00000530, 0x00000000, 0x0000052F, 0x0004003B, 0x00000530, 0x00000531, 0x00000000, 0x0004002B, 
-0x00000083, 0x00000550, 0x0000000E, 0x0004003B, 0x00000530, 0x00000554, 0x00000000, 0x0004002B, 
-0x000000F7, 0x00000564, 0x00000001, 0x00040020, 0x000005D7, 0x00000001, 0x0000000C, 0x0004002B, 
-0x00000006, 0x000005DE, 0x3D23D70A, 0x0004003B, 0x000001FE, 0x000005E2, 0x00000000, 0x00040020, 
-0x000005ED, 0x00000001, 0x00000201, 0x0004002B, 0x00000083, 0x00000606, 0x00000011, 0x0004003B, 
-0x000001FE, 0x0000060C, 0x00000000, 0x0004002B, 0x00000006, 0x00000618, 0x3D3851EC, 0x0004002B, 
-0x00000006, 0x00000637, 0x3CA3D70A, 0x0004002B, 0x00000006, 0x00000644, 0x3B04B5DD, 0x0004002B, 
-0x00000006, 0x00000657, 0x38D1B717, 0x0004003B, 0x000001FE, 0x0000065A, 0x00000000, 0x00040020, 
-0x000006AE, 0x00000003, 0x00000012, 0x0004003B, 0x000006AE, 0x000006AF, 0x00000003, 0x0004002B, 
-0x00000083, 0x000006B5, 0x0000000D, 0x0004002B, 0x00000006, 0x000006F9, 0x3F4CCCCD, 0x0004002B, 
-0x00000006, 0x000006FA, 0x3E4CCCCD, 0x0007002C, 0x00000012, 0x000006FB, 0x000006F9, 0x000006FA, 
-0x000006FA, 0x000000DF, 0x0007002C, 0x00000012, 0x000006FF, 0x000006FA, 0x000006F9, 0x000006FA, 
-0x000000DF, 0x0007002C, 0x00000012, 0x00000703, 0x000006FA, 0x000006FA, 0x000006F9, 0x000000DF, 
-0x0007002C, 0x00000012, 0x00000707, 0x000006F9, 0x000006F9, 0x000006FA, 0x000000DF, 0x0003001E, 
-0x0000070D, 0x000002C5, 0x00040020, 0x0000070E, 0x00000002, 0x0000070D, 0x0004003B, 0x0000070E, 
-0x0000070F, 0x00000002, 0x0004001C, 0x00000710, 0x000002C5, 0x000002C6, 0x0003001E, 0x00000711, 
-0x00000710, 0x00040020, 0x00000712, 0x00000002, 0x00000711, 0x0004003B, 0x00000712, 0x00000713, 
-0x00000002, 0x0004002B, 0x000000F7, 0x00000714, 0x00000064, 0x0004001C, 0x00000715, 0x000002C5, 
-0x00000714, 0x0003001E, 0x00000716, 0x00000715, 0x00040020, 0x00000717, 0x00000002, 0x00000716, 
-0x0004003B, 0x00000717, 0x00000718, 0x00000002, 0x0004002B, 0x00000006, 0x00000719, 0x40C90FDB, 
-0x0004002B, 0x00000006, 0x0000071A, 0x3727C5AC, 0x0006002C, 0x0000000C, 0x0000071B, 0x000005DE, 
-0x000005DE, 0x000005DE, 0x0007002C, 0x00000012, 0x0000071C, 0x00000139, 0x00000102, 0x00000102, 
-0x00000139, 0x0007002C, 0x00000012, 0x0000071D, 0x00000102, 0x00000139, 0x00000102, 0x00000139, 
-0x0007002C, 0x00000012, 0x0000071E, 0x00000102, 0x00000102, 0x000000DF, 0x00000102, 0x0007002C, 
-0x00000012, 0x0000071F, 0x00000102, 0x00000102, 0x00000102, 0x000000DF, 0x0007002C, 0x000002C5, 
-0x00000720, 0x0000071C, 0x0000071D, 0x0000071E, 0x0000071F, 0x0004002B, 0x000000F7, 0x00000721, 
-0x00000010, 0x0004001C, 0x00000722, 0x0000007D, 0x00000721, 0x0004002B, 0x00000006, 0x00000723, 
-0xBF7127FA, 0x0004002B, 0x00000006, 0x00000724, 0xBECC51E0, 0x0005002C, 0x0000007D, 0x00000725, 
-0x00000723, 0x00000724, 0x0004002B, 0x00000006, 0x00000726, 0x3F7211EE, 0x0004002B, 0x00000006, 
-0x00000727, 0xBF44D71B, 0x0005002C, 0x0000007D, 0x00000728, 0x00000726, 0x00000727, 0x0004002B, 
-0x00000006, 0x00000729, 0xBDC0E398, 0x0004002B, 0x00000006, 0x0000072A, 0xBF6DEC6B, 0x0005002C, 
-0x0000007D, 0x0000072B, 0x00000729, 0x0000072A, 0x0004002B, 0x00000006, 0x0000072C, 0x3EB09E84, 
-0x0004002B, 0x00000006, 0x0000072D, 0x3E967720, 0x0005002C, 0x0000007D, 0x0000072E, 0x0000072C, 
-0x0000072D, 0x0004002B, 0x00000006, 0x0000072F, 0xBF6A777E, 0x0004002B, 0x00000006, 0x00000730, 
-0x3EEA5988, 0x0005002C, 0x0000007D, 0x00000731, 0x0000072F, 0x00000730, 0x0004002B, 0x00000006, 
-0x00000732, 0xBF50C0D4, 0x0004002B, 0x00000006, 0x00000733, 0xBF610E50, 0x0005002C, 0x0000007D, 
-0x00000734, 0x00000732, 0x00000733, 0x0004002B, 0x00000006, 0x00000735, 0xBEC3FB24, 0x0004002B, 
-0x00000006, 0x00000736, 0x3E8DB498, 0x0005002C, 0x0000007D, 0x00000737, 0x00000735, 0x00000736, 
-0x0004002B, 0x00000006, 0x00000738, 0x3F798F60, 0x0004002B, 0x00000006, 0x00000739, 0x3F41A8EC, 
-0x0005002C, 0x0000007D, 0x0000073A, 0x00000738, 0x00000739, 0x0004002B, 0x00000006, 0x0000073B, 
-0x3EE2EF78, 0x0004002B, 0x00000006, 0x0000073C, 0xBF79A12C, 0x0005002C, 0x0000007D, 0x0000073D, 
-0x0000073B, 0x0000073C, 0x0004002B, 0x00000006, 0x0000073E, 0x3F099500, 0x0004002B, 0x00000006, 
-0x0000073F, 0xBEF28D4A, 0x0005002C, 0x0000007D, 0x00000740, 0x0000073E, 0x0000073F, 0x0004002B, 
-0x00000006, 0x00000741, 0xBE87AA08, 0x0004002B, 0x00000006, 0x00000742, 0xBED67E06, 0x0005002C, 
-0x0000007D, 0x00000743, 0x00000741, 0x00000742, 0x0004002B, 0x00000006, 0x00000744, 0x3F4ABEE2, 
-0x0004002B, 0x00000006, 0x00000745, 0x3E437BC8, 0x0005002C, 0x0000007D, 0x00000746, 0x00000744, 
-0x00000745, 0x0004002B, 0x00000006, 0x00000747, 0xBE77B198, 0x0004002B, 0x00000006, 0x00000748, 
-0x3F7F3FA8, 0x0005002C, 0x0000007D, 0x00000749, 0x00000747, 0x00000748, 0x0004002B, 0x00000006, 
-0x0000074A, 0xBF5068D4, 0x0004002B, 0x00000006, 0x0000074B, 0x3F6A148A, 0x0005002C, 0x0000007D, 
-0x0000074C, 0x0000074A, 0x0000074B, 0x0004002B, 0x00000006, 0x0000074D, 0x3E4CA330, 0x0004002B, 
-0x00000006, 0x0000074E, 0x3F495268, 0x0005002C, 0x0000007D, 0x0000074F, 0x0000074D, 0x0000074E, 
-0x0004002B, 0x00000006, 0x00000750, 0x3E134898, 0x0004002B, 0x00000006, 0x00000751, 0xBE106460, 
-0x0005002C, 0x0000007D, 0x00000752, 0x00000750, 0x00000751, 0x0013002C, 0x00000722, 0x00000753, 
-0x00000725, 0x00000728, 0x0000072B, 0x0000072E, 0x00000731, 0x00000734, 0x00000737, 0x0000073A, 
-0x0000073D, 0x00000740, 0x00000743, 0x00000746, 0x00000749, 0x0000074C, 0x0000074F, 0x00000752, 
-0x0004002B, 0x000000F7, 0x00000754, 0x00000040, 0x0004001C, 0x00000755, 0x0000007D, 0x00000754, 
-0x0004002B, 0x00000006, 0x00000756, 0xBF625322, 0x0004002B, 0x00000006, 0x00000757, 0x3DFEF391, 
-0x0005002C, 0x0000007D, 0x00000758, 0x00000756, 0x00000757, 0x0004002B, 0x00000006, 0x00000759, 
-0xBF36E169, 0x0004002B, 0x00000006, 0x0000075A, 0x3CE4E26D, 0x0005002C, 0x0000007D, 0x0000075B, 
-0x00000759, 0x0000075A, 0x0004002B, 0x00000006, 0x0000075C, 0xBF3F7953, 0x0004002B, 0x00000006, 
-0x0000075D, 0x3E696463, 0x0005002C, 0x0000007D, 0x0000075E, 0x0000075C, 0x0000075D, 0x0004002B, 
-0x00000006, 0x0000075F, 0xBF708A37, 0x0004002B, 0x00000006, 0x00000760, 0x3E797B31, 0x0005002C, 
-0x0000007D, 0x00000761, 0x0000075F, 0x00000760, 0x0004002B, 0x00000006, 0x00000762, 0xBF7C476F, 
-0x0004002B, 0x00000006, 0x00000763, 0x3D3A81DC, 0x0005002C, 0x0000007D, 0x00000764, 0x00000762, 
-0x00000763, 0x0004002B, 0x00000006, 0x00000765, 0xBF5C828C, 0x0004002B, 0x00000006, 0x00000766, 
-0xBE0B7DC8, 0x0005002C, 0x0000007D, 0x00000767, 0x00000765, 0x00000766, 0x0004002B, 0x00000006, 
-0x00000768, 0xBF61C66D, 0x0004002B, 0x00000006, 0x00000769, 0x3ECB3786, 0x0005002C, 0x0000007D, 
-0x0000076A, 0x00000768, 0x00000769, 0x0004002B, 0x00000006, 0x0000076B, 0xBEEF127F, 0x0004002B, 
-0x00000006, 0x0000076C, 0x3C6DFE76, 0x0005002C, 0x0000007D, 0x0000076D, 0x0000076B, 0x0000076C, 
-0x0004002B, 0x00000006, 0x0000076E, 0xBF0EE6A7, 0x0004002B, 0x00000006, 0x0000076F, 0x3E59C411, 
-0x0005002C, 0x0000007D, 0x00000770, 0x0000076E, 0x0000076F, 0x0004002B, 0x00000006, 0x00000771, 
-0xBF14151A, 0x0004002B, 0x00000006, 0x00000772, 0xBDC43E53, 0x0005002C, 0x0000007D, 0x00000773, 
-0x00000771, 0x00000772, 0x0004002B, 0x00000006, 0x00000774, 0xBF3D8213, 0x0004002B, 0x00000006, 
-0x00000775, 0xBDC3DA30, 0x0005002C, 0x0000007D, 0x00000776, 0x00000774, 0x00000775, 0x0004002B, 
-0x00000006, 0x00000777, 0xBF406E2B, 0x0004002B, 0x00000006, 0x00000778, 0x3EF1F927, 0x0005002C, 
-0x0000007D, 0x00000779, 0x00000777, 0x00000778, 0x0004002B, 0x00000006, 0x0000077A, 0xBF0D9B0B, 
-0x0004002B, 0x00000006, 0x0000077B, 0xBE790364, 0x0005002C, 0x0000007D, 0x0000077C, 0x0000077A, 
-0x0000077B, 0x0004002B, 0x00000006, 0x0000077D, 0xBF2CBD34, 0x0004002B, 0x00000006, 0x0000077E, 
-0xBEA95571, 0x0005002C, 0x0000007D, 0x0000077F, 0x0000077D, 0x0000077E, 0x0004002B, 0x00000006, 
-0x00000780, 0xBECE3737, 0x0004002B, 0x00000006, 0x00000781, 0xBDFA08C0, 0x0005002C, 0x0000007D, 
-0x00000782, 0x00000780, 0x00000781, 0x0004002B, 0x00000006, 0x00000783, 0xBEA3B9AE, 0x0004002B, 
-0x00000006, 0x00000784, 0xBE9FD439, 0x0005002C, 0x0000007D, 0x00000785, 0x00000783, 0x00000784, 
-0x0004002B, 0x00000006, 0x00000786, 0xBED3EDB7, 0x0004002B, 0x00000006, 0x00000787, 0xBEE127D4, 
-0x0005002C, 0x0000007D, 0x00000788, 0x00000786, 0x00000787, 0x0004002B, 0x00000006, 0x00000789, 
-0xBF7AA9C5, 0x0004002B, 0x00000006, 0x0000078A, 0xBE4E132B, 0x0005002C, 0x0000007D, 0x0000078B, 
-0x00000789, 0x0000078A, 0x0004002B, 0x00000006, 0x0000078C, 0xBF5D9696, 0x0004002B, 0x00000006, 
-0x0000078D, 0xBE93CFD5, 0x0005002C, 0x0000007D, 0x0000078E, 0x0000078C, 0x0000078D, 0x0004002B, 
-0x00000006, 0x0000078F, 0xBE798D8B, 0x0004002B, 0x00000006, 0x00000790, 0xBE3ED9E0, 0x0005002C, 
-0x0000007D, 0x00000791, 0x0000078F, 0x00000790, 0x0004002B, 0x00000006, 0x00000792, 0xBE96FFC1, 
-0x0004002B, 0x00000006, 0x00000793, 0xBD645804, 0x0005002C, 0x0000007D, 0x00000794, 0x00000792, 
-0x00000793, 0x0004002B, 0x00000006, 0x00000795, 0xBF1ABD5E, 0x0004002B, 0x00000006, 0x00000796, 
-0xBF0B5409, 0x0005002C, 0x0000007D, 0x00000797, 0x00000795, 0x00000796, 0x0004002B, 0x00000006, 
-0x00000798, 0xBED60B70, 0x0004002B, 0x00000006, 0x00000799, 0xBF167222, 0x0005002C, 0x0000007D, 
-0x0000079A, 0x00000798, 0x00000799, 0x0004002B, 0x00000006, 0x0000079B, 0xBF0C957D, 0x0004002B, 
-0x00000006, 0x0000079C, 0xBED4EDD5, 0x0005002C, 0x0000007D, 0x0000079D, 0x0000079B, 0x0000079C, 
-0x0004002B, 0x00000006, 0x0000079E, 0xBE73CB3E, 0x0004002B, 0x00000006, 0x0000079F, 0xBF1C9C5E, 
-0x0005002C, 0x0000007D, 0x000007A0, 0x0000079E, 0x0000079F, 0x0004002B, 0x00000006, 0x000007A1, 
-0xBE88B4C0, 0x0004002B, 0x00000006, 0x000007A2, 0xBEEB5E0F, 0x0005002C, 0x0000007D, 0x000007A3, 
-0x000007A1, 0x000007A2, 0x0004002B, 0x00000006, 0x000007A4, 0xBDCCCFF2, 0x0004002B, 0x00000006, 
-0x000007A5, 0xBE6A9D62, 0x0005002C, 0x0000007D, 0x000007A6, 0x000007A4, 0x000007A5, 0x0004002B, 
-0x00000006, 0x000007A7, 0xBDD0BFA1, 0x0004002B, 0x00000006, 0x000007A8, 0xBEC2C16E, 0x0005002C, 
-0x0000007D, 0x000007A9, 0x000007A7, 0x000007A8, 0x0004002B, 0x00000006, 0x000007AA, 0xBF2E749F, 
-0x0004002B, 0x00000006, 0x000007AB, 0xBF3365DC, 0x0005002C, 0x0000007D, 0x000007AC, 0x000007AA, 
-0x000007AB, 0x0004002B, 0x00000006, 0x000007AD, 0xBF4373F3, 0x0004002B, 0x00000006, 0x000007AE, 
-0xBF0B1B58, 0x0005002C, 0x0000007D, 0x000007AF, 0x000007AD, 0x000007AE, 0x0004002B, 0x00000006, 
-0x000007B0, 0xBF0C8D3B, 0x0004002B, 0x00000006, 0x000007B1, 0xBF403116, 0x0005002C, 0x0000007D, 
-0x000007B2, 0x000007B0, 0x000007B1, 0x0004002B, 0x00000006, 0x000007B3, 0xBF4F1D93, 0x0004002B, 
-0x00000006, 0x000007B4, 0xBED1461B, 0x0005002C, 0x0000007D, 0x000007B5, 0x000007B3, 0x000007B4, 
-0x0004002B, 0x00000006, 0x000007B6, 0xBEC6B980, 0x0004002B, 0x00000006, 0x000007B7, 0xBF4600B0, 
-0x0005002C, 0x0000007D, 0x000007B8, 0x000007B6, 0x000007B7, 0x0004002B, 0x00000006, 0x000007B9, 
-0xBEDBD945, 0x0004002B, 0x00000006, 0x000007BA, 0xBF6517A4, 0x0005002C, 0x0000007D, 0x000007BB, 
-0x000007B9, 0x000007BA, 0x0004002B, 0x00000006, 0x000007BC, 0xBE06C15D, 0x0004002B, 0x00000006, 
-0x000007BD, 0x3D853D21, 0x0005002C, 0x0000007D, 0x000007BE, 0x000007BC, 0x000007BD, 0x0004002B, 
-0x00000006, 0x000007BF, 0xBE8CCD10, 0x0004002B, 0x00000006, 0x000007C0, 0x3DD2C8C5, 0x0005002C, 
-0x0000007D, 0x000007C1, 0x000007BF, 0x000007C0, 0x0004002B, 0x00000006, 0x000007C2, 0xBDD953DF, 
-0x0004002B, 0x00000006, 0x000007C3, 0xBD8BEF07, 0x0005002C, 0x0000007D, 0x000007C4, 0x000007C2, 
-0x000007C3, 0x0004002B, 0x00000006, 0x000007C5, 0xBE96D3FA, 0x0004002B, 0x00000006, 0x000007C6, 
-0xBF643A54, 0x0005002C, 0x0000007D, 0x000007C7, 0x000007C5, 0x000007C6, 0x0004002B, 0x00000006, 
-0x000007C8, 0xBF21218A, 0x0004002B, 0x00000006, 0x000007C9, 0x3EC23F03, 0x0005002C, 0x0000007D, 
-0x000007CA, 0x000007C8, 0x000007C9, 0x0004002B, 0x00000006, 0x000007CB, 0xBED083FD, 0x0004002B, 
-0x00000006, 0x000007CC, 0x3EADF373, 0x0005002C, 0x0000007D, 0x000007CD, 0x000007CB, 0x000007CC, 
-0x0004002B, 0x00000006, 0x000007CE, 0x3D92BD3C, 0x0004002B, 0x00000006, 0x000007CF, 0xBEC4C0DF, 
-0x0005002C, 0x0000007D, 0x000007D0, 0x000007CE, 0x000007CF, 0x0004002B, 0x00000006, 0x000007D1, 
-0x3CB45F18, 0x0004002B, 0x00000006, 0x000007D2, 0xBE870FE0, 0x0005002C, 0x0000007D, 0x000007D3, 
-0x000007D1, 0x000007D2, 0x0004002B, 0x00000006, 0x000007D4, 0x3B7E36D2, 0x0004002B, 0x00000006, 
-0x000007D5, 0xBE0B56B8, 0x0005002C, 0x0000007D, 0x000007D6, 0x000007D4, 0x000007D5, 0x0004002B, 
-0x00000006, 0x000007D7, 0xBE0CD573, 0x0004002B, 0x00000006, 0x000007D8, 0xBF44916D, 0x0005002C, 
-0x0000007D, 0x000007D9, 0x000007D7, 0x000007D8, 0x0004002B, 0x00000006, 0x000007DA, 0xBD506141, 
-0x0004002B, 0x00000006, 0x000007DB, 0xBF67F413, 0x0005002C, 0x0000007D, 0x000007DC, 0x000007DA, 
-0x000007DB, 0x0004002B, 0x00000006, 0x000007DD, 0x3DE9BE90, 0x0004002B, 0x00000006, 0x000007DE, 
-0xBD8F77F2, 0x0005002C, 0x0000007D, 0x000007DF, 0x000007DD, 0x000007DE, 0x0004002B, 0x00000006, 
-0x000007E0, 0x3E273BC9, 0x0004002B, 0x00000006, 0x000007E1, 0xBE5E71CE, 0x0005002C, 0x0000007D, 
-0x000007E2, 0x000007E0, 0x000007E1, 0x0004002B, 0x00000006, 0x000007E3, 0xBDCD562A, 0x0004002B, 
-0x00000006, 0x000007E4, 0xBF1686A5, 0x0005002C, 0x0000007D, 0x000007E5, 0x000007E3, 0x000007E4, 
-0x0004002B, 0x00000006, 0x000007E6, 0xBBA1F080, 0x0004002B, 0x00000006, 0x000007E7, 0x3E006078, 
-0x0005002C, 0x0000007D, 0x000007E8, 0x000007E6, 0x000007E7, 0x0004002B, 0x00000006, 0x000007E9, 
-0x3D1098D4, 0x0004002B, 0x00000006, 0x000007EA, 0xBF1E8B1A, 0x0005002C, 0x0000007D, 0x000007EB, 
-0x000007E9, 0x000007EA, 0x0004002B, 0x00000006, 0x000007EC, 0x3E48576D, 0x0004002B, 0x00000006, 
-0x000007ED, 0xBEEB04EE, 0x0005002C, 0x0000007D, 0x000007EE, 0x000007EC, 0x000007ED, 0x0004002B, 
-0x00000006, 0x000007EF, 0x3E9BA1D3, 0x0004002B, 0x00000006, 0x000007F0, 0xBEB1565C, 0x0005002C, 
-0x0000007D, 0x000007F1, 0x000007EF, 0x000007F0, 0x0004002B, 0x00000006, 0x000007F2, 0xBF2D9924, 
-0x0004002B, 0x00000006, 0x000007F3, 0x3F2F62A6, 0x0005002C, 0x0000007D, 0x000007F4, 0x000007F2, 
-0x000007F3, 0x0004002B, 0x00000006, 0x000007F5, 0xBF20E001, 0x0004002B, 0x00000006, 0x000007F6, 
-0x3F020AD9, 0x0005002C, 0x0000007D, 0x000007F7, 0x000007F5, 0x000007F6, 0x0004002B, 0x00000006, 
-0x000007F8, 0xBF022B49, 0x0004002B, 0x00000006, 0x000007F9, 0x3EEAE1AC, 0x0005002C, 0x0000007D, 
-0x000007FA, 0x000007F8, 0x000007F9, 0x0004002B, 0x00000006, 0x000007FB, 0x3D039EF1, 0x0004002B, 
-0x00000006, 0x000007FC, 0xBF48331E, 0x0005002C, 0x0000007D, 0x000007FD, 0x000007FB, 0x000007FC, 
-0x0004002B, 0x00000006, 0x000007FE, 0x3DFB1316, 0x0004002B, 0x00000006, 0x000007FF, 0x3E8F8A6E, 
-0x0005002C, 0x0000007D, 0x00000800, 0x000007FE, 0x000007FF, 0x0004002B, 0x00000006, 0x00000801, 
-0xBD32C301, 0x0004002B, 0x00000006, 0x00000802, 0x3E9FCE10, 0x0005002C, 0x0000007D, 0x00000803, 
-0x00000801, 0x00000802, 0x0004002B, 0x00000006, 0x00000804, 0x3E082F51, 0x0004002B, 0x00000006, 
-0x00000805, 0x3DAE6D9C, 0x0005002C, 0x0000007D, 0x00000806, 0x00000804, 0x00000805, 0x0004002B, 
-0x00000006, 0x00000807, 0xBE44B76F, 0x0004002B, 0x00000006, 0x00000808, 0x3E925AAB, 0x0005002C, 
-0x0000007D, 0x00000809, 0x00000807, 0x00000808, 0x0004002B, 0x00000006, 0x0000080A, 0x3E3C0725, 
-0x0004002B, 0x00000006, 0x0000080B, 0xBF369707, 0x0005002C, 0x0000007D, 0x0000080C, 0x0000080A, 
-0x0000080B, 0x0004002B, 0x00000006, 0x0000080D, 0x3E87CAEA, 0x0004002B, 0x00000006, 0x0000080E, 
-0xBF18C261, 0x0005002C, 0x0000007D, 0x0000080F, 0x0000080D, 0x0000080E, 0x0004002B, 0x00000006, 
-0x00000810, 0xBC1DBEC2, 0x0004002B, 0x00000006, 0x00000811, 0xBEF75361, 0x0005002C, 0x0000007D, 
-0x00000812, 0x00000810, 0x00000811, 0x0004002B, 0x00000006, 0x00000813, 0xBC97AEDE, 0x0004002B, 
-0x00000006, 0x00000814, 0x3EDF1477, 0x0005002C, 0x0000007D, 0x00000815, 0x00000813, 0x00000814, 
-0x0043002C, 0x00000755, 0x00000816, 0x00000758, 0x0000075B, 0x0000075E, 0x00000761, 0x00000764, 
-0x00000767, 0x0000076A, 0x0000076D, 0x00000770, 0x00000773, 0x00000776, 0x00000779, 0x0000077C, 
-0x0000077F, 0x00000782, 0x00000785, 0x00000788, 0x0000078B, 0x0000078E, 0x00000791, 0x00000794, 
-0x00000797, 0x0000079A, 0x0000079D, 0x000007A0, 0x000007A3, 0x000007A6, 0x000007A9, 0x000007AC, 
-0x000007AF, 0x000007B2, 0x000007B5, 0x000007B8, 0x000007BB, 0x000007BE, 0x000007C1, 0x000007C4, 
-0x000007C7, 0x000007CA, 0x000007CD, 0x000007D0, 0x000007D3, 0x000007D6, 0x000007D9, 0x000007DC, 
-0x000007DF, 0x000007E2, 0x000007E5, 0x000007E8, 0x000007EB, 0x000007EE, 0x000007F1, 0x000007F4, 
-0x000007F7, 0x000007FA, 0x000007FD, 0x00000800, 0x00000803, 0x00000806, 0x00000809, 0x0000080C, 
-0x0000080F, 0x00000812, 0x00000815, 0x00050036, 0x00000002, 0x00000004, 0x00000000, 0x00000003, 
-0x000200F8, 0x00000005, 0x0004003B, 0x00000013, 0x00000571, 0x00000007, 0x0004003B, 0x00000007, 
-0x0000057B, 0x00000007, 0x0004003B, 0x00000007, 0x0000057C, 0x00000007, 0x0004003B, 0x0000000D, 
-0x0000058B, 0x00000007, 0x0004003B, 0x0000000D, 0x000005AF, 0x00000007, 0x0004003B, 0x000000D1, 
-0x000005CD, 0x00000007, 0x0004003B, 0x0000000D, 0x000005FB, 0x00000007, 0x0004003B, 0x0000007E, 
-0x00000601, 0x00000007, 0x0004003B, 0x00000007, 0x0000060B, 0x00000007, 0x0004003B, 0x00000007, 
-0x0000061B, 0x00000007, 0x0004003B, 0x00000007, 0x00000620, 0x00000007, 0x0004003B, 0x0000000D, 
-0x00000624, 0x00000007, 0x0004003B, 0x0000000D, 0x00000628, 0x00000007, 0x0004003B, 0x00000007, 
-0x0000062C, 0x00000007, 0x0004003B, 0x00000007, 0x00000634, 0x00000007, 0x0004003B, 0x00000007, 
-0x00000639, 0x00000007, 0x0004003B, 0x00000007, 0x0000063D, 0x00000007, 0x0004003B, 0x0000000D, 
-0x00000647, 0x00000007, 0x0004003B, 0x00000007, 0x00000664, 0x00000007, 0x0004003B, 0x00000007, 
-0x00000665, 0x00000007, 0x0004003B, 0x0000000D, 0x00000669, 0x00000007, 0x0004003B, 0x00000007, 
-0x0000066C, 0x00000007, 0x0004003B, 0x00000007, 0x0000066F, 0x00000007, 0x0004003B, 0x00000007, 
-0x00000681, 0x00000007, 0x0004003B, 0x0000000D, 0x0000068B, 0x00000007, 0x0004003B, 0x0000000D, 
-0x00000695, 0x00000007, 0x0004003B, 0x0000000D, 0x00000696, 0x00000007, 0x0004003B, 0x0000000D, 
-0x00000699, 0x00000007, 0x0004003B, 0x000000D1, 0x0000069B, 0x00000007, 0x0004003B, 0x0000000D, 
-0x0000069E, 0x00000007, 0x0004003B, 0x0000000D, 0x0000069F, 0x00000007, 0x0004003B, 0x0000000D, 
-0x000006A2, 0x00000007, 0x0004003B, 0x000000D1, 0x000006A4, 0x00000007, 0x0004003B, 0x0000000D, 
-0x000006A7, 0x00000007, 0x0004003B, 0x00000084, 0x000006EE, 0x00000007, 0x0004003B, 0x0000000D, 
-0x000006EF, 0x00000007, 0x0003003E, 0x000000DE, 0x000000DF, 0x0003003E, 0x000000E0, 0x000000E1, 
-0x00040039, 0x00000012, 0x00000572, 0x00000070, 0x0003003E, 0x00000571, 0x00000572, 0x00050041, 
-0x00000007, 0x00000573, 0x00000571, 0x000000F8, 0x0004003D, 0x00000006, 0x00000574, 0x00000573, 
-0x00050041, 0x000001EB, 0x00000575, 0x000001E9, 0x0000042E, 0x0004003D, 0x00000006, 0x00000576, 
-0x00000575, 0x000500B8, 0x000001EF, 0x00000577, 0x00000574, 0x00000576, 0x000300F7, 0x00000579, 
-0x00000000, 0x000400FA, 0x00000577, 0x00000578, 0x00000579, 0x000200F8, 0x00000578, 0x000100FC, 
-0x000200F8, 0x00000579, 0x0003003E, 0x0000057B, 0x00000102, 0x0003003E, 0x0000057C, 0x00000102, 
-0x00050041, 0x000001EB, 0x0000057D, 0x000001E9, 0x00000350, 0x0004003D, 0x00000006, 0x0000057E, 
-0x0000057D, 0x000500B4, 0x000001EF, 0x0000057F, 0x0000057E, 0x00000102, 0x000300F7, 0x00000581, 
-0x00000000, 0x000400FA, 0x0000057F, 0x00000580, 0x00000585, 0x000200F8, 0x00000580, 0x00040039, 
-0x0000000C, 0x00000582, 0x00000073, 0x00050051, 0x00000006, 0x00000583, 0x00000582, 0x00000000, 
-0x0003003E, 0x0000057B, 0x00000583, 0x00040039, 0x00000006, 0x00000584, 0x00000076, 0x0003003E, 
-0x0000057C, 0x00000584, 0x000200F9, 0x00000581, 0x000200F8, 0x00000585, 0x00050041, 0x000001EB, 
-0x00000586, 0x000001E9, 0x00000350, 0x0004003D, 0x00000006, 0x00000587, 0x00000586, 0x000500B4, 
-0x000001EF, 0x00000588, 0x00000587, 0x000000DF, 0x000300F7, 0x0000058A, 0x00000000, 0x000400FA, 
-0x00000588, 0x00000589, 0x000005A9, 0x000200F8, 0x00000589, 0x0004003D, 0x000001FD, 0x0000058C, 
-0x00000223, 0x00050041, 0x00000206, 0x0000058D, 0x00000204, 0x00000205, 0x0004003D, 0x0000007D, 
-0x0000058E, 0x0000058D, 0x00050057, 0x00000012, 0x0000058F, 0x0000058C, 0x0000058E, 0x0008004F, 
-0x0000000C, 0x00000590, 0x0000058F, 0x0000058F, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 
-0x0000058B, 0x00000590, 0x00050041, 0x000001EB, 0x00000591, 0x000001E9, 0x00000210, 0x0004003D, 
-0x00000006, 0x00000592, 0x00000591, 0x00050083, 0x00000006, 0x00000593, 0x000000DF, 0x00000592, 
-0x00050041, 0x000001EB, 0x00000594, 0x000001E9, 0x00000216, 0x0004003D, 0x00000006, 0x00000595, 
-0x00000594, 0x00050085, 0x00000006, 0x00000596, 0x00000593, 0x00000595, 0x00050041, 0x000001EB, 
-0x00000597, 0x000001E9, 0x00000210, 0x0004003D, 0x00000006, 0x00000598, 0x00000597, 0x00050041, 
-0x00000007, 0x00000599, 0x0000058B, 0x000002E0, 0x0004003D, 0x00000006, 0x0000059A, 0x00000599, 
-0x00050085, 0x00000006, 0x0000059B, 0x00000598, 0x0000059A, 0x00050081, 0x00000006, 0x0000059C, 
-0x00000596, 0x0000059B, 0x0003003E, 0x0000057B, 0x0000059C, 0x00050041, 0x000001EB, 0x0000059D, 
-0x000001E9, 0x00000210, 0x0004003D, 0x00000006, 0x0000059E, 0x0000059D, 0x00050083, 0x00000006, 
-0x0000059F, 0x000000DF, 0x0000059E, 0x00050041, 0x000001EB, 0x000005A0, 0x000001E9, 0x00000205, 
-0x0004003D, 0x00000006, 0x000005A1, 0x000005A0, 0x00050085, 0x00000006, 0x000005A2, 0x0000059F, 
-0x000005A1, 0x00050041, 0x000001EB, 0x000005A3, 0x000001E9, 0x00000210, 0x0004003D, 0x00000006, 
-0x000005A4, 0x000005A3, 0x00050041, 0x00000007, 0x000005A5, 0x0000058B, 0x00000564, 0x0004003D, 
-0x00000006, 0x000005A6, 0x000005A5, 0x00050085, 0x00000006, 0x000005A7, 0x000005A4, 0x000005A6, 
-0x00050081, 0x00000006, 0x000005A8, 0x000005A2, 0x000005A7, 0x0003003E, 0x0000057C, 0x000005A8, 
-0x000200F9, 0x0000058A, 0x000200F8, 0x000005A9, 0x00050041, 0x000001EB, 0x000005AA, 0x000001E9, 
-0x00000350, 0x0004003D, 0x00000006, 0x000005AB, 0x000005AA, 0x000500B4, 0x000001EF, 0x000005AC, 
-0x000005AB, 0x0000013A, 0x000300F7, 0x000005AE, 0x00000000, 0x000400FA, 0x000005AC, 0x000005AD, 
-0x000005AE, 0x000200F8, 0x000005AD, 0x0004003D, 0x000001FD, 0x000005B0, 0x00000223, 0x00050041, 
-0x00000206, 0x000005B1, 0x00000204, 0x00000205, 0x0004003D, 0x0000007D, 0x000005B2, 0x000005B1, 
-0x00050057, 0x00000012, 0x000005B3, 0x000005B0, 0x000005B2, 0x0008004F, 0x0000000C, 0x000005B4, 
-0x000005B3, 0x000005B3, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x000005AF, 0x000005B4, 
-0x00050041, 0x000001EB, 0x000005B5, 0x000001E9, 0x00000210, 0x0004003D, 0x00000006, 0x000005B6, 
-0x000005B5, 0x00050083, 0x00000006, 0x000005B7, 0x000000DF, 0x000005B6, 0x00050041, 0x000001EB, 
-0x000005B8, 0x000001E9, 0x00000216, 0x0004003D, 0x00000006, 0x000005B9, 0x000005B8, 0x00050085, 
-0x00000006, 0x000005BA, 0x000005B7, 0x000005B9, 0x00050041, 0x000001EB, 0x000005BB, 0x000001E9, 
-0x00000210, 0x0004003D, 0x00000006, 0x000005BC, 0x000005BB, 0x00050041, 0x00000007, 0x000005BD, 
-0x000005AF, 0x000002E0, 0x0004003D, 0x00000006, 0x000005BE, 0x000005BD, 0x00050085, 0x00000006, 
-0x000005BF, 0x000005BC, 0x000005BE, 0x00050081, 0x00000006, 0x000005C0, 0x000005BA, 0x000005BF, 
-0x0003003E, 0x0000057B, 0x000005C0, 0x00050041, 0x000001EB, 0x000005C1, 0x000001E9, 0x00000210, 
-0x0004003D, 0x00000006, 0x000005C2, 0x000005C1, 0x00050083, 0x00000006, 0x000005C3, 0x000000DF, 
-0x000005C2, 0x00050041, 0x000001EB, 0x000005C4, 0x000001E9, 0x00000205, 0x0004003D, 0x00000006, 
-0x000005C5, 0x000005C4, 0x00050085, 0x00000006, 0x000005C6, 0x000005C3, 0x000005C5, 0x00050041, 
-0x000001EB, 0x000005C7, 0x000001E9, 0x00000210, 0x0004003D, 0x00000006, 0x000005C8, 0x000005C7, 
-0x00050041, 0x00000007, 0x000005C9, 0x000005AF, 0x00000564, 0x0004003D, 0x00000006, 0x000005CA, 
-0x000005C9, 0x00050085, 0x00000006, 0x000005CB, 0x000005C8, 0x000005CA, 0x00050081, 0x00000006, 
-0x000005CC, 0x000005C6, 0x000005CB, 0x0003003E, 0x0000057C, 0x000005CC, 0x000200F9, 0x000005AE, 
-0x000200F8, 0x000005AE, 0x000200F9, 0x0000058A, 0x000200F8, 0x0000058A, 0x000200F9, 0x00000581, 
-0x000200F8, 0x00000581, 0x0004003D, 0x00000012, 0x000005CE, 0x00000571, 0x00050041, 0x00000013, 
-0x000005CF, 0x000005CD, 0x000001F3, 0x0003003E, 0x000005CF, 0x000005CE, 0x0004003D, 0x00000006, 
-0x000005D0, 0x0000057B, 0x00050041, 0x00000007, 0x000005D1, 0x000005CD, 0x00000205, 0x0003003E, 
-0x000005D1, 0x000005D0, 0x0004003D, 0x00000006, 0x000005D2, 0x0000057C, 0x00050041, 0x00000007, 
-0x000005D3, 0x000005CD, 0x0000043F, 0x0003003E, 0x000005D3, 0x000005D2, 0x00050041, 0x000001EB, 
-0x000005D4, 0x000001E9, 0x0000043F, 0x0004003D, 0x00000006, 0x000005D5, 0x000005D4, 0x00050041, 
-0x00000007, 0x000005D6, 0x000005CD, 0x00000266, 0x0003003E, 0x000005D6, 0x000005D5, 0x00050041, 
-0x000005D7, 0x000005D8, 0x00000204, 0x0000043F, 0x0004003D, 0x0000000C, 0x000005D9, 0x000005D8, 
-0x0006000C, 0x0000000C, 0x000005DA, 0x00000001, 0x00000045, 0x000005D9, 0x00050041, 0x0000000D, 
-0x000005DB, 0x000005CD, 0x00000210, 0x0003003E, 0x000005DB, 0x000005DA, 0x00050041, 0x000001EB, 
-0x000005DC, 0x000001E9, 0x00000366, 0x0004003D, 0x00000006, 0x000005DD, 0x000005DC, 0x000500BA, 
-0x000001EF, 0x000005DF, 0x000005DD, 0x000005DE, 0x000300F7, 0x000005E1, 0x00000000, 0x000400FA, 
-0x000005DF, 0x000005E0, 0x000005E1, 0x000200F8, 0x000005E0, 0x0004003D, 0x000001FD, 0x000005E3, 
-0x000005E2, 0x00050041, 0x00000206, 0x000005E4, 0x00000204, 0x00000205, 0x0004003D, 0x0000007D, 
-0x000005E5, 0x000005E4, 0x00050057, 0x00000012, 0x000005E6, 0x000005E3, 0x000005E5, 0x0008004F, 
-0x0000000C, 0x000005E7, 0x000005E6, 0x000005E6, 0x00000000, 0x00000001, 0x00000002, 0x0005008E, 
-0x0000000C, 0x000005E8, 0x000005E7, 0x0000013A, 0x00060050, 0x0000000C, 0x000005E9, 0x000000DF, 
-0x000000DF, 0x000000DF, 0x00050083, 0x0000000C, 0x000005EA, 0x000005E8, 0x000005E9, 0x0006000C, 
-0x0000000C, 0x000005EB, 0x00000001, 0x00000045, 0x000005EA, 0x00050041, 0x0000000D, 0x000005EC, 
-0x000005CD, 0x00000210, 0x0003003E, 0x000005EC, 0x000005EB, 0x00050041, 0x000005ED, 0x000005EE, 
-0x00000204, 0x00000266, 0x0004003D, 0x00000201, 0x000005EF, 0x000005EE, 0x00050041, 0x0000000D, 
-0x000005F0, 0x000005CD, 0x00000210, 0x0004003D, 0x0000000C, 0x000005F1, 0x000005F0, 0x00050091, 
-0x0000000C, 0x000005F2, 0x000005EF, 0x000005F1, 0x0006000C, 0x0000000C, 0x000005F3, 0x00000001, 
-0x00000045, 0x000005F2, 0x00050041, 0x0000000D, 0x000005F4, 0x000005CD, 0x00000210, 0x0003003E, 
-0x000005F4, 0x000005F3, 0x00050041, 0x0000000D, 0x000005F5, 0x000005CD, 0x00000210, 0x0004003D, 
-0x0000000C, 0x000005F6, 0x000005F5, 0x0006000C, 0x0000000C, 0x000005F7, 0x00000001, 0x00000045, 
-0x000005F6, 0x00050041, 0x0000000D, 0x000005F8, 0x000005CD, 0x00000210, 0x0003003E, 0x000005F8, 
-0x000005F7, 0x000200F9, 0x000005E1, 0x000200F8, 0x000005E1, 0x00040039, 0x00000006, 0x000005F9, 
-0x00000078, 0x00050041, 0x00000007, 0x000005FA, 0x000005CD, 0x0000022E, 0x0003003E, 0x000005FA, 
-0x000005F9, 0x00050041, 0x00000013, 0x000005FC, 0x000005CD, 0x000001F3, 0x0004003D, 0x00000012, 
-0x000005FD, 0x000005FC, 0x0008004F, 0x0000000C, 0x000005FE, 0x000005FD, 0x000005FD, 0x00000000, 
-0x00000001, 0x00000002, 0x0003003E, 0x000005FB, 0x000005FE, 0x00050039, 0x0000000C, 0x000005FF, 
-0x0000007B, 0x000005FB, 0x00050041, 0x0000000D, 0x00000600, 0x000005CD, 0x000001EA, 0x0003003E, 
-0x00000600, 0x000005FF, 0x0004003D, 0x00000012, 0x00000602, 0x00000314, 0x0007004F, 0x0000007D, 
-0x00000603, 0x00000602, 0x00000602, 0x00000000, 0x00000001, 0x00050041, 0x000001EB, 0x00000604, 
-0x000002CB, 0x00000308, 0x0004003D, 0x00000006, 0x00000605, 0x00000604, 0x00050041, 0x000001EB, 
-0x00000607, 0x000002CB, 0x00000606, 0x0004003D, 0x00000006, 0x00000608, 0x00000607, 0x00050050, 
-0x0000007D, 0x00000609, 0x00000605, 0x00000608, 0x00050088, 0x0000007D, 0x0000060A, 0x00000603, 
-0x00000609, 0x0003003E, 0x00000601, 0x0000060A, 0x0004003D, 0x000001FD, 0x0000060D, 0x0000060C, 
-0x0004003D, 0x0000007D, 0x0000060E, 0x00000601, 0x00050057, 0x00000012, 0x0000060F, 0x0000060D, 
-0x0000060E, 0x00050051, 0x00000006, 0x00000610, 0x0000060F, 0x00000000, 0x0003003E, 0x0000060B, 
-0x00000610, 0x0004003D, 0x00000006, 0x00000611, 0x0000060B, 0x00050041, 0x00000013, 0x00000612, 
-0x000005CD, 0x000001F3, 0x0004003D, 0x00000012, 0x00000613, 0x00000612, 0x0005008E, 0x00000012, 
-0x00000614, 0x00000613, 0x00000611, 0x00050041, 0x00000013, 0x00000615, 0x000005CD, 0x000001F3, 
-0x0003003E, 0x00000615, 0x00000614, 0x00050041, 0x00000007, 0x00000616, 0x000005CD, 0x0000043F, 
-0x0004003D, 0x00000006, 0x00000617, 0x00000616, 0x0008000C, 0x00000006, 0x00000619, 0x00000001, 
-0x0000002B, 0x00000617, 0x00000618, 0x000000DF, 0x00050041, 0x00000007, 0x0000061A, 0x000005CD, 
-0x0000043F, 0x0003003E, 0x0000061A, 0x00000619, 0x00050041, 0x00000007, 0x0000061C, 0x000005CD, 
-0x00000216, 0x0004003D, 0x00000006, 0x0000061D, 0x0000061C, 0x0003003E, 0x0000061B, 0x0000061D, 
-0x00050039, 0x00000006, 0x0000061E, 0x00000057, 0x0000061B, 0x00050041, 0x00000007, 0x0000061F, 
-0x000005CD, 0x00000216, 0x0003003E, 0x0000061F, 0x0000061E, 0x0004003D, 0x00000006, 0x00000621, 
-0x0000057C, 0x0004003D, 0x00000006, 0x00000622, 0x0000057C, 0x00050085, 0x00000006, 0x00000623, 
-0x00000621, 0x00000622, 0x0003003E, 0x00000620, 0x00000623, 0x00050041, 0x0000000D, 0x00000625, 
-0x000005CD, 0x00000210, 0x0004003D, 0x0000000C, 0x00000626, 0x00000625, 0x000400CF, 0x0000000C, 
-0x00000627, 0x00000626, 0x0003003E, 0x00000624, 0x00000627, 0x00050041, 0x0000000D, 0x00000629, 
-0x000005CD, 0x00000210, 0x0004003D, 0x0000000C, 0x0000062A, 0x00000629, 0x000400D0, 0x0000000C, 
-0x0000062B, 0x0000062A, 0x0003003E, 0x00000628, 0x0000062B, 0x0004003D, 0x0000000C, 0x0000062D, 
-0x00000624, 0x0004003D, 0x0000000C, 0x0000062E, 0x00000624, 0x00050094, 0x00000006, 0x0000062F, 
-0x0000062D, 0x0000062E, 0x0004003D, 0x0000000C, 0x00000630, 0x00000628, 0x0004003D, 0x0000000C, 
-0x00000631, 0x00000628, 0x00050094, 0x00000006, 0x00000632, 0x00000630, 0x00000631, 0x00050081, 
-0x00000006, 0x00000633, 0x0000062F, 0x00000632, 0x0003003E, 0x0000062C, 0x00000633, 0x0004003D, 
-0x00000006, 0x00000635, 0x0000062C, 0x00050085, 0x00000006, 0x00000636, 0x00000635, 0x000000DF, 
-0x0007000C, 0x00000006, 0x00000638, 0x00000001, 0x00000025, 0x00000636, 0x00000637, 0x0003003E, 
-0x00000634, 0x00000638, 0x0004003D, 0x00000006, 0x0000063A, 0x00000620, 0x0004003D, 0x00000006, 
-0x0000063B, 0x00000634, 0x00050081, 0x00000006, 0x0000063C, 0x0000063A, 0x0000063B, 0x0003003E, 
-0x0000063D, 0x0000063C, 0x00050039, 0x00000006, 0x0000063E, 0x00000019, 0x0000063D, 0x0003003E, 
-0x00000639, 0x0000063E, 0x0004003D, 0x00000006, 0x0000063F, 0x00000639, 0x0006000C, 0x00000006, 
-0x00000640, 0x00000001, 0x0000001F, 0x0000063F, 0x00050041, 0x00000007, 0x00000641, 0x000005CD, 
-0x00000216, 0x0003003E, 0x00000641, 0x00000640, 0x00050041, 0x00000007, 0x00000642, 0x000005CD, 
-0x00000216, 0x0004003D, 0x00000006, 0x00000643, 0x00000642, 0x0008000C, 0x00000006, 0x00000645, 
-0x00000001, 0x0000002B, 0x00000643, 0x00000644, 0x000000DF, 0x00050041, 0x00000007, 0x00000646, 
-0x000005CD, 0x00000216, 0x0003003E, 0x00000646, 0x00000645, 0x00050041, 0x00000313, 0x00000648, 
-0x00000204, 0x00000216, 0x0004003D, 0x00000012, 0x00000649, 0x00000648, 0x0008004F, 0x0000000C, 
-0x0000064A, 0x00000649, 0x00000649, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x00000647, 
-0x0000064A, 0x00050041, 0x000001F4, 0x0000064B, 0x000002CB, 0x000001EA, 0x0004003D, 0x00000012, 
-0x0000064C, 0x0000064B, 0x0008004F, 0x0000000C, 0x0000064D, 0x0000064C, 0x0000064C, 0x00000000, 
-0x00000001, 0x00000002, 0x0004003D, 0x0000000C, 0x0000064E, 0x00000647, 0x00050083, 0x0000000C, 
-0x0000064F, 0x0000064D, 0x0000064E, 0x0006000C, 0x0000000C, 0x00000650, 0x00000001, 0x00000045, 
-0x0000064F, 0x00050041, 0x0000000D, 0x00000651, 0x000005CD, 0x00000366, 0x0003003E, 0x00000651, 
-0x00000650, 0x00050041, 0x0000000D, 0x00000652, 0x000005CD, 0x00000210, 0x0004003D, 0x0000000C, 
-0x00000653, 0x00000652, 0x00050041, 0x0000000D, 0x00000654, 0x000005CD, 0x00000366, 0x0004003D, 
-0x0000000C, 0x00000655, 0x00000654, 0x00050094, 0x00000006, 0x00000656, 0x00000653, 0x00000655, 
-0x0007000C, 0x00000006, 0x00000658, 0x00000001, 0x00000028, 0x00000656, 0x00000657, 0x00050041, 
-0x00000007, 0x00000659, 0x000005CD, 0x00000260, 0x0003003E, 0x00000659, 0x00000658, 0x0004003D, 
-0x000001FD, 0x0000065B, 0x0000065A, 0x00050041, 0x00000007, 0x0000065C, 0x000005CD, 0x00000260, 
-0x0004003D, 0x00000006, 0x0000065D, 0x0000065C, 0x00050041, 0x00000007, 0x0000065E, 0x000005CD, 
-0x0000043F, 0x0004003D, 0x00000006, 0x0000065F, 0x0000065E, 0x00050050, 0x0000007D, 0x00000660, 
-0x0000065D, 0x0000065F, 0x00050057, 0x00000012, 0x00000661, 0x0000065B, 0x00000660, 0x0007004F, 
-0x0000007D, 0x00000662, 0x00000661, 0x00000661, 0x00000000, 0x00000001, 0x00050041, 0x0000007E, 
-0x00000663, 0x000005CD, 0x00000350, 0x0003003E, 0x00000663, 0x00000662, 0x00050041, 0x00000007, 
-0x00000666, 0x000005CD, 0x00000266, 0x0004003D, 0x00000006, 0x00000667, 0x00000666, 0x0003003E, 
-0x00000665, 0x00000667, 0x00050039, 0x00000006, 0x00000668, 0x00000054, 0x00000665, 0x0003003E, 
-0x00000664, 0x00000668, 0x00050041, 0x00000013, 0x0000066A, 0x000005CD, 0x000001F3, 0x0004003D, 
-0x00000012, 0x0000066B, 0x0000066A, 0x00050041, 0x00000007, 0x0000066D, 0x000005CD, 0x00000205, 
-0x0004003D, 0x00000006, 0x0000066E, 0x0000066D, 0x0003003E, 0x0000066C, 0x0000066E, 0x0004003D, 
-0x00000006, 0x00000670, 0x00000664, 0x0003003E, 0x0000066F, 0x00000670, 0x00070039, 0x0000000C, 
-0x00000671, 0x00000051, 0x0000066B, 0x0000066C, 0x0000066F, 0x0003003E, 0x00000669, 0x00000671, 
-0x0004003D, 0x0000000C, 0x00000672, 0x00000669, 0x00050041, 0x0000000D, 0x00000673, 0x000005CD, 
-0x0000024A, 0x0003003E, 0x00000673, 0x00000672, 0x00050041, 0x0000000D, 0x00000674, 0x000005CD, 
-0x0000024A, 0x0004003D, 0x0000000C, 0x00000675, 0x00000674, 0x00060041, 0x00000007, 0x00000676, 
-0x000005CD, 0x00000350, 0x00000564, 0x0004003D, 0x00000006, 0x00000677, 0x00000676, 0x0007000C, 
-0x00000006, 0x00000678, 0x00000001, 0x00000028, 0x00000199, 0x00000677, 0x00050088, 0x00000006, 
-0x00000679, 0x000000DF, 0x00000678, 0x00050083, 0x00000006, 0x0000067A, 0x00000679, 0x000000DF, 
-0x0005008E, 0x0000000C, 0x0000067B, 0x00000675, 0x0000067A, 0x00060050, 0x0000000C, 0x0000067C, 
-0x000000DF, 0x000000DF, 0x000000DF, 0x00050081, 0x0000000C, 0x0000067D, 0x0000067C, 0x0000067B, 
-0x00050041, 0x0000000D, 0x0000067E, 0x000005CD, 0x0000042E, 0x0003003E, 0x0000067E, 0x0000067D, 
-0x00050041, 0x00000013, 0x0000067F, 0x000005CD, 0x000001F3, 0x0004003D, 0x00000012, 0x00000680, 
-0x0000067F, 0x00050041, 0x00000007, 0x00000682, 0x000005CD, 0x00000205, 0x0004003D, 0x00000006, 
-0x00000683, 0x00000682, 0x0003003E, 0x00000681, 0x00000683, 0x00060039, 0x0000000C, 0x00000684, 
-0x0000004B, 0x00000680, 0x00000681, 0x00060041, 0x00000007, 0x00000685, 0x000005CD, 0x000001F3, 
-0x00000244, 0x00050051, 0x00000006, 0x00000686, 0x00000684, 0x00000000, 0x0003003E, 0x00000685, 
-0x00000686, 0x00060041, 0x00000007, 0x00000687, 0x000005CD, 0x000001F3, 0x00000564, 0x00050051, 
-0x00000006, 0x00000688, 0x00000684, 0x00000001, 0x0003003E, 0x00000687, 0x00000688, 0x00060041, 
-0x00000007, 0x00000689, 0x000005CD, 0x000001F3, 0x000002E0, 0x00050051, 0x00000006, 0x0000068A, 
-0x00000684, 0x00000002, 0x0003003E, 0x00000689, 0x0000068A, 0x00050041, 0x00000007, 0x0000068C, 
-0x000005CD, 0x00000260, 0x0004003D, 0x00000006, 0x0000068D, 0x0000068C, 0x00050085, 0x00000006, 
-0x0000068E, 0x0000013A, 0x0000068D, 0x00050041, 0x0000000D, 0x0000068F, 0x000005CD, 0x00000210, 
-0x0004003D, 0x0000000C, 0x00000690, 0x0000068F, 0x0005008E, 0x0000000C, 0x00000691, 0x00000690, 
-0x0000068E, 0x00050041, 0x0000000D, 0x00000692, 0x000005CD, 0x00000366, 0x0004003D, 0x0000000C, 
-0x00000693, 0x00000692, 0x00050083, 0x0000000C, 0x00000694, 0x00000691, 0x00000693, 0x0003003E, 
-0x0000068B, 0x00000694, 0x00050041, 0x0000000D, 0x00000697, 0x000005CD, 0x0000024A, 0x0004003D, 
-0x0000000C, 0x00000698, 0x00000697, 0x0003003E, 0x00000696, 0x00000698, 0x0004003D, 0x0000000C, 
-0x0000069A, 0x00000647, 0x0003003E, 0x00000699, 0x0000069A, 0x0004003D, 0x000000B5, 0x0000069C, 
-0x000005CD, 0x0003003E, 0x0000069B, 0x0000069C, 0x00070039, 0x0000000C, 0x0000069D, 0x000000D6, 
-0x00000696, 0x00000699, 0x0000069B, 0x0003003E, 0x00000695, 0x0000069D, 0x00050041, 0x0000000D, 
-0x000006A0, 0x000005CD, 0x0000024A, 0x0004003D, 0x0000000C, 0x000006A1, 0x000006A0, 0x0003003E, 
-0x0000069F, 0x000006A1, 0x0004003D, 0x0000000C, 0x000006A3, 0x0000068B, 0x0003003E, 0x000006A2, 
-0x000006A3, 0x0004003D, 0x000000B5, 0x000006A5, 0x000005CD, 0x0003003E, 0x000006A4, 0x000006A5, 
-0x00070039, 0x0000000C, 0x000006A6, 0x000000DB, 0x0000069F, 0x000006A2, 0x000006A4, 0x0003003E, 
-0x0000069E, 0x000006A6, 0x0004003D, 0x0000000C, 0x000006A8, 0x00000695, 0x0004003D, 0x0000000C, 
-0x000006A9, 0x0000069E, 0x00050081, 0x0000000C, 0x000006AA, 0x000006A8, 0x000006A9, 0x00050041, 
-0x0000000D, 0x000006AB, 0x000005CD, 0x000001EA, 0x0004003D, 0x0000000C, 0x000006AC, 0x000006AB, 
-0x00050081, 0x0000000C, 0x000006AD, 0x000006AA, 0x000006AC, 0x0003003E, 0x000006A7, 0x000006AD, 
-0x0004003D, 0x0000000C, 0x000006B0, 0x000006A7, 0x00050051, 0x00000006, 0x000006B1, 0x000006B0, 
-0x00000000, 0x00050051, 0x00000006, 0x000006B2, 0x000006B0, 0x00000001, 0x00050051, 0x00000006, 
-0x000006B3, 0x000006B0, 0x00000002, 0x00070050, 0x00000012, 0x000006B4, 0x000006B1, 0x000006B2, 
-0x000006B3, 0x000000DF, 0x0003003E, 0x000006AF, 0x000006B4, 0x00050041, 0x00000351, 0x000006B6, 
-0x000002CB, 0x000006B5, 0x0004003D, 0x00000083, 0x000006B7, 0x000006B6, 0x000500AD, 0x000001EF, 
-0x000006B8, 0x000006B7, 0x000001F3, 0x000300F7, 0x000006BA, 0x00000000, 0x000400FA, 0x000006B8, 
-0x000006B9, 0x000006BA, 0x000200F8, 0x000006B9, 0x00050041, 0x00000351, 0x000006BB, 0x000002CB, 
-0x000006B5, 0x0004003D, 0x00000083, 0x000006BC, 0x000006BB, 0x000300F7, 0x000006C4, 0x00000000, 
-0x001100FB, 0x000006BC, 0x000006C4, 0x00000001, 0x000006BD, 0x00000002, 0x000006BE, 0x00000003, 
-0x000006BF, 0x00000004, 0x000006C0, 0x00000005, 0x000006C1, 0x00000006, 0x000006C2, 0x00000007, 
-0x000006C3, 0x000200F8, 0x000006BD, 0x00050041, 0x00000013, 0x000006C5, 0x000005CD, 0x000001F3, 
-0x0004003D, 0x00000012, 0x000006C6, 0x000006C5, 0x0003003E, 0x000006AF, 0x000006C6, 0x000200F9, 
-0x000006C4, 0x000200F8, 0x000006BE, 0x00050041, 0x00000007, 0x000006C8, 0x000005CD, 0x00000205, 
-0x0004003D, 0x00000006, 0x000006C9, 0x000006C8, 0x00060050, 0x0000000C, 0x000006CA, 0x000006C9, 
-0x000006C9, 0x000006C9, 0x00050051, 0x00000006, 0x000006CB, 0x000006CA, 0x00000000, 0x00050051, 
-0x00000006, 0x000006CC, 0x000006CA, 0x00000001, 0x00050051, 0x00000006, 0x000006CD, 0x000006CA, 
-0x00000002, 0x00070050, 0x00000012, 0x000006CE, 0x000006CB, 0x000006CC, 0x000006CD, 0x000000DF, 
-0x0003003E, 0x000006AF, 0x000006CE, 0x000200F9, 0x000006C4, 0x000200F8, 0x000006BF, 0x00050041, 
-0x00000007, 0x000006D0, 0x000005CD, 0x0000043F, 0x0004003D, 0x00000006, 0x000006D1, 0x000006D0, 
-0x00060050, 0x0000000C, 0x000006D2, 0x000006D1, 0x000006D1, 0x000006D1, 0x00050051, 0x00000006, 
-0x000006D3, 0x000006D2, 0x00000000, 0x00050051, 0x00000006, 0x000006D4, 0x000006D2, 0x00000001, 
-0x00050051, 0x00000006, 0x000006D5, 0x000006D2, 0x00000002, 0x00070050, 0x00000012, 0x000006D6, 
-0x000006D3, 0x000006D4, 0x000006D5, 0x000000DF, 0x0003003E, 0x000006AF, 0x000006D6, 0x000200F9, 
-0x000006C4, 0x000200F8, 0x000006C0, 0x00050041, 0x00000007, 0x000006D8, 0x000005CD, 0x0000022E, 
-0x0004003D, 0x00000006, 0x000006D9, 0x000006D8, 0x00060050, 0x0000000C, 0x000006DA, 0x000006D9, 
-0x000006D9, 0x000006D9, 0x00050051, 0x00000006, 0x000006DB, 0x000006DA, 0x00000000, 0x00050051, 
-0x00000006, 0x000006DC, 0x000006DA, 0x00000001, 0x00050051, 0x00000006, 0x000006DD, 0x000006DA, 
-0x00000002, 0x00070050, 0x00000012, 0x000006DE, 0x000006DB, 0x000006DC, 0x000006DD, 0x000000DF, 
-0x0003003E, 0x000006AF, 0x000006DE, 0x000200F9, 0x000006C4, 0x000200F8, 0x000006C1, 0x00050041, 
-0x0000000D, 0x000006E0, 0x000005CD, 0x000001EA, 0x0004003D, 0x0000000C, 0x000006E1, 0x000006E0, 
-0x00050051, 0x00000006, 0x000006E2, 0x000006E1, 0x00000000, 0x00050051, 0x00000006, 0x000006E3, 
-0x000006E1, 0x00000001, 0x00050051, 0x00000006, 0x000006E4, 0x000006E1, 0x00000002, 0x00070050, 
-0x00000012, 0x000006E5, 0x000006E2, 0x000006E3, 0x000006E4, 0x000000DF, 0x0003003E, 0x000006AF, 
-0x000006E5, 0x000200F9, 0x000006C4, 0x000200F8, 0x000006C2, 0x00050041, 0x0000000D, 0x000006E7, 
-0x000005CD, 0x00000210, 0x0004003D, 0x0000000C, 0x000006E8, 0x000006E7, 0x00050051, 0x00000006, 
-0x000006E9, 0x000006E8, 0x00000000, 0x00050051, 0x00000006, 0x000006EA, 0x000006E8, 0x00000001, 
-0x00050051, 0x00000006, 0x000006EB, 0x000006E8, 0x00000002, 0x00070050, 0x00000012, 0x000006EC, 
-0x000006E9, 0x000006EA, 0x000006EB, 0x000000DF, 0x0003003E, 0x000006AF, 0x000006EC, 0x000200F9, 
-0x000006C4, 0x000200F8, 0x000006C3, 0x0004003D, 0x0000000C, 0x000006F0, 0x00000647, 0x0003003E, 
-0x000006EF, 0x000006F0, 0x00050039, 0x00000083, 0x000006F1, 0x000000AC, 0x000006EF, 0x0003003E, 
-0x000006EE, 0x000006F1, 0x0004003D, 0x00000083, 0x000006F2, 0x000006EE, 0x000300F7, 0x000006F7, 
-0x00000000, 0x000B00FB, 0x000006F2, 0x000006F7, 0x00000000, 0x000006F3, 0x00000001, 0x000006F4, 
-0x00000002, 0x000006F5, 0x00000003, 0x000006F6, 0x000200F8, 0x000006F3, 0x0004003D, 0x00000012, 
-0x000006F8, 0x000006AF, 0x00050085, 0x00000012, 0x000006FC, 0x000006F8, 0x000006FB, 0x0003003E, 
-0x000006AF, 0x000006FC, 0x000200F9, 0x000006F7, 0x000200F8, 0x000006F4, 0x0004003D, 0x00000012, 
-0x000006FE, 0x000006AF, 0x00050085, 0x00000012, 0x00000700, 0x000006FE, 0x000006FF, 0x0003003E, 
-0x000006AF, 0x00000700, 0x000200F9, 0x000006F7, 0x000200F8, 0x000006F5, 0x0004003D, 0x00000012, 
-0x00000702, 0x000006AF, 0x00050085, 0x00000012, 0x00000704, 0x00000702, 0x00000703, 0x0003003E, 
-0x000006AF, 0x00000704, 0x000200F9, 0x000006F7, 0x000200F8, 0x000006F6, 0x0004003D, 0x00000012, 
-0x00000706, 0x000006AF, 0x00050085, 0x00000012, 0x00000708, 0x00000706, 0x00000707, 0x0003003E, 
-0x000006AF, 0x00000708, 0x000200F9, 0x000006F7, 0x000200F8, 0x000006F7, 0x000200F9, 0x000006C4, 
-0x000200F8, 0x000006C4, 0x000200F9, 0x000006BA, 0x000200F8, 0x000006BA, 0x000100FD, 0x00010038, 
-0x00050036, 0x00000006, 0x0000000A, 0x00000000, 0x00000008, 0x00030037, 0x00000007, 0x00000009, 
-0x000200F8, 0x0000000B, 0x0004003B, 0x00000007, 0x000000E2, 0x00000007, 0x0004003D, 0x00000006, 
-0x000000E3, 0x00000009, 0x0004003D, 0x00000006, 0x000000E4, 0x00000009, 0x00050085, 0x00000006, 
-0x000000E5, 0x000000E3, 0x000000E4, 0x0003003E, 0x000000E2, 0x000000E5, 0x0004003D, 0x00000006, 
-0x000000E6, 0x000000E2, 0x0004003D, 0x00000006, 0x000000E7, 0x000000E2, 0x00050085, 0x00000006, 
-0x000000E8, 0x000000E6, 0x000000E7, 0x0004003D, 0x00000006, 0x000000E9, 0x00000009, 0x00050085, 
-0x00000006, 0x000000EA, 0x000000E8, 0x000000E9, 0x000200FE, 0x000000EA, 0x00010038, 0x00050036, 
-0x0000000C, 0x00000010, 0x00000000, 0x0000000E, 0x00030037, 0x0000000D, 0x0000000F, 0x000200F8, 
-0x00000011, 0x0004003D, 0x0000000C, 0x000000ED, 0x0000000F, 0x0007000C, 0x0000000C, 0x000000F0, 
-0x00000001, 0x0000001A, 0x000000ED, 0x000000EF, 0x000200FE, 0x000000F0, 0x00010038, 0x00050036, 
-0x00000012, 0x00000016, 0x00000000, 0x00000014, 0x00030037, 0x00000013, 0x00000015, 0x000200F8, 
-0x00000017, 0x0004003B, 0x0000000D, 0x000000F3, 0x00000007, 0x0004003D, 0x00000012, 0x000000F4, 
-0x00000015, 0x0008004F, 0x0000000C, 0x000000F5, 0x000000F4, 0x000000F4, 0x00000000, 0x00000001, 
-0x00000002, 0x0003003E, 0x000000F3, 0x000000F5, 0x00050039, 0x0000000C, 0x000000F6, 0x00000010, 
-0x000000F3, 0x00050041, 0x00000007, 0x000000F9, 0x00000015, 0x000000F8, 0x0004003D, 0x00000006, 
-0x000000FA, 0x000000F9, 0x00050051, 0x00000006, 0x000000FB, 0x000000F6, 0x00000000, 0x00050051, 
-0x00000006, 0x000000FC, 0x000000F6, 0x00000001, 0x00050051, 0x00000006, 0x000000FD, 0x000000F6, 
-0x00000002, 0x00070050, 0x00000012, 0x000000FE, 0x000000FB, 0x000000FC, 0x000000FD, 0x000000FA, 
-0x000200FE, 0x000000FE, 0x00010038, 0x00050036, 0x00000006, 0x00000019, 0x00000000, 0x00000008, 
-0x00030037, 0x00000007, 0x00000018, 0x000200F8, 0x0000001A, 0x0004003D, 0x00000006, 0x00000101, 
-0x00000018, 0x0008000C, 0x00000006, 0x00000103, 0x00000001, 0x0000002B, 0x00000101, 0x00000102, 
-0x000000DF, 0x000200FE, 0x00000103, 0x00010038, 0x00050036, 0x00000006, 0x00000020, 0x00000000, 
-0x0000001B, 0x00030037, 0x00000007, 0x0000001C, 0x00030037, 0x00000007, 0x0000001D, 0x00030037, 
-0x0000000C, 0x0000001E, 0x00030037, 0x0000000C, 0x0000001F, 0x000200F8, 0x00000021, 0x0004003B, 
-0x0000000D, 0x00000106, 0x00000007, 0x0004003B, 0x00000007, 0x00000108, 0x00000007, 0x0004003B, 
-0x00000007, 0x0000010C, 0x00000007, 0x0004003B, 0x00000007, 0x00000116, 0x00000007, 0x0007000C, 
-0x0000000C, 0x00000107, 0x00000001, 0x00000044, 0x0000001E, 0x0000001F, 0x0003003E, 0x00000106, 
-0x00000107, 0x0004003D, 0x00000006, 0x00000109, 0x0000001D, 0x0004003D, 0x00000006, 0x0000010A, 
-0x0000001C, 0x00050085, 0x00000006, 0x0000010B, 0x00000109, 0x0000010A, 0x0003003E, 0x00000108, 
-0x0000010B, 0x0004003D, 0x00000006, 0x0000010D, 0x0000001C, 0x0004003D, 0x0000000C, 0x0000010E, 
-0x00000106, 0x0004003D, 0x0000000C, 0x0000010F, 0x00000106, 0x00050094, 0x00000006, 0x00000110, 
-0x0000010E, 0x0000010F, 0x0004003D, 0x00000006, 0x00000111, 0x00000108, 0x0004003D, 0x00000006, 
-0x00000112, 0x00000108, 0x00050085, 0x00000006, 0x00000113, 0x00000111, 0x00000112, 0x00050081, 
-0x00000006, 0x00000114, 0x00000110, 0x00000113, 0x00050088, 0x00000006, 0x00000115, 0x0000010D, 
-0x00000114, 0x0003003E, 0x0000010C, 0x00000115, 0x0004003D, 0x00000006, 0x00000117, 0x0000010C, 
-0x0004003D, 0x00000006, 0x00000118, 0x0000010C, 0x00050085, 0x00000006, 0x00000119, 0x00000117, 
-0x00000118, 0x00050085, 0x00000006, 0x0000011B, 0x00000119, 0x0000011A, 0x0003003E, 0x00000116, 
-0x0000011B, 0x0004003D, 0x00000006, 0x0000011C, 0x00000116, 0x0007000C, 0x00000006, 0x0000011E, 
-0x00000001, 0x00000025, 0x0000011C, 0x0000011D, 0x000200FE, 0x0000011E, 0x00010038, 0x00050036, 
-0x0000000C, 0x00000026, 0x00000000, 0x00000022, 0x00030037, 0x0000000C, 0x00000023, 0x00030037, 
-0x00000007, 0x00000024, 0x00030037, 0x00000007, 0x00000025, 0x000200F8, 0x00000027, 0x0004003B, 
-0x00000007, 0x00000126, 0x00000007, 0x0004003D, 0x00000006, 0x00000121, 0x00000024, 0x00060050, 
-0x0000000C, 0x00000122, 0x00000121, 0x00000121, 0x00000121, 0x00050083, 0x0000000C, 0x00000123, 
-0x00000122, 0x00000023, 0x0004003D, 0x00000006, 0x00000124, 0x00000025, 0x00050083, 0x00000006, 
-0x00000125, 0x000000DF, 0x00000124, 0x0003003E, 0x00000126, 0x00000125, 0x00050039, 0x00000006, 
-0x00000127, 0x0000000A, 0x00000126, 0x0005008E, 0x0000000C, 0x00000128, 0x00000123, 0x00000127, 
-0x00050081, 0x0000000C, 0x00000129, 0x00000023, 0x00000128, 0x000200FE, 0x00000129, 0x00010038, 
-0x00050036, 0x00000006, 0x0000002C, 0x00000000, 0x00000028, 0x00030037, 0x00000007, 0x00000029, 
-0x00030037, 0x00000007, 0x0000002A, 0x00030037, 0x00000007, 0x0000002B, 0x000200F8, 0x0000002D, 
-0x0004003D, 0x00000006, 0x0000012C, 0x0000002A, 0x0004003D, 0x00000006, 0x0000012D, 0x0000002B, 
-0x0004003D, 0x00000006, 0x0000012E, 0x0000002A, 0x00050083, 0x00000006, 0x0000012F, 0x0000012D, 
-0x0000012E, 0x0004003D, 0x00000006, 0x00000130, 0x00000029, 0x00050083, 0x00000006, 0x00000131, 
-0x000000DF, 0x00000130, 0x0007000C, 0x00000006, 0x00000133, 0x00000001, 0x0000001A, 0x00000131, 
-0x00000132, 0x00050085, 0x00000006, 0x00000134, 0x0000012F, 0x00000133, 0x00050081, 0x00000006, 
-0x00000135, 0x0000012C, 0x00000134, 0x000200FE, 0x00000135, 0x00010038, 0x00050036, 0x00000006, 
-0x00000033, 0x00000000, 0x0000002E, 0x00030037, 0x00000007, 0x0000002F, 0x00030037, 0x00000007, 
-0x00000030, 0x00030037, 0x00000007, 0x00000031, 0x00030037, 0x00000007, 0x00000032, 0x000200F8, 
-0x00000034, 0x0004003B, 0x00000007, 0x00000138, 0x00000007, 0x0004003B, 0x00000007, 0x00000142, 
-0x00000007, 0x0004003B, 0x00000007, 0x00000143, 0x00000007, 0x0004003B, 0x00000007, 0x00000144, 
-0x00000007, 0x0004003B, 0x00000007, 0x00000146, 0x00000007, 0x0004003B, 0x00000007, 0x00000149, 
-0x00000007, 0x0004003B, 0x00000007, 0x0000014A, 0x00000007, 0x0004003B, 0x00000007, 0x0000014B, 
-0x00000007, 0x0004003B, 0x00000007, 0x0000014D, 0x00000007, 0x0004003D, 0x00000006, 0x0000013B, 
-0x0000002F, 0x00050085, 0x00000006, 0x0000013C, 0x0000013A, 0x0000013B, 0x0004003D, 0x00000006, 
-0x0000013D, 0x00000032, 0x00050085, 0x00000006, 0x0000013E, 0x0000013C, 0x0000013D, 0x0004003D, 
-0x00000006, 0x0000013F, 0x00000032, 0x00050085, 0x00000006, 0x00000140, 0x0000013E, 0x0000013F, 
-0x00050081, 0x00000006, 0x00000141, 0x00000139, 0x00000140, 0x0003003E, 0x00000138, 0x00000141, 
-0x0003003E, 0x00000143, 0x000000DF, 0x0004003D, 0x00000006, 0x00000145, 0x00000138, 0x0003003E, 
-0x00000144, 0x00000145, 0x0004003D, 0x00000006, 0x00000147, 0x00000031, 0x0003003E, 0x00000146, 
-0x00000147, 0x00070039, 0x00000006, 0x00000148, 0x0000002C, 0x00000143, 0x00000144, 0x00000146, 
-0x0003003E, 0x00000142, 0x00000148, 0x0003003E, 0x0000014A, 0x000000DF, 0x0004003D, 0x00000006, 
-0x0000014C, 0x00000138, 0x0003003E, 0x0000014B, 0x0000014C, 0x0004003D, 0x00000006, 0x0000014E, 
-0x00000030, 0x0003003E, 0x0000014D, 0x0000014E, 0x00070039, 0x00000006, 0x0000014F, 0x0000002C, 
-0x0000014A, 0x0000014B, 0x0000014D, 0x0003003E, 0x00000149, 0x0000014F, 0x0004003D, 0x00000006, 
-0x00000150, 0x00000142, 0x0004003D, 0x00000006, 0x00000151, 0x00000149, 0x00050085, 0x00000006, 
-0x00000152, 0x00000150, 0x00000151, 0x00050085, 0x00000006, 0x00000153, 0x00000152, 0x0000011A, 
-0x000200FE, 0x00000153, 0x00010038, 0x00050036, 0x00000006, 0x00000038, 0x00000000, 0x00000028, 
-0x00030037, 0x00000007, 0x00000035, 0x00030037, 0x00000007, 0x00000036, 0x00030037, 0x00000007, 
-0x00000037, 0x000200F8, 0x00000039, 0x0004003B, 0x00000007, 0x00000156, 0x00000007, 0x0004003B, 
-0x00000007, 0x0000015A, 0x00000007, 0x0004003B, 0x00000007, 0x00000168, 0x00000007, 0x0004003D, 
-0x00000006, 0x00000157, 0x00000037, 0x0004003D, 0x00000006, 0x00000158, 0x00000037, 0x00050085, 
-0x00000006, 0x00000159, 0x00000157, 0x00000158, 0x0003003E, 0x00000156, 0x00000159, 0x0004003D, 
-0x00000006, 0x0000015B, 0x00000035, 0x0004003D, 0x00000006, 0x0000015C, 0x00000036, 0x0004007F, 
-0x00000006, 0x0000015D, 0x0000015C, 0x0004003D, 0x00000006, 0x0000015E, 0x00000156, 0x00050085, 
-0x00000006, 0x0000015F, 0x0000015D, 0x0000015E, 0x0004003D, 0x00000006, 0x00000160, 0x00000036, 
-0x00050081, 0x00000006, 0x00000161, 0x0000015F, 0x00000160, 0x0004003D, 0x00000006, 0x00000162, 
-0x00000036, 0x00050085, 0x00000006, 0x00000163, 0x00000161, 0x00000162, 0x0004003D, 0x00000006, 
-0x00000164, 0x00000156, 0x00050081, 0x00000006, 0x00000165, 0x00000163, 0x00000164, 0x0006000C, 
-0x00000006, 0x00000166, 0x00000001, 0x0000001F, 0x00000165, 0x00050085, 0x00000006, 0x00000167, 
-0x0000015B, 0x00000166, 0x0003003E, 0x0000015A, 0x00000167, 0x0004003D, 0x00000006, 0x00000169, 
-0x00000036, 0x0004003D, 0x00000006, 0x0000016A, 0x00000035, 0x0004007F, 0x00000006, 0x0000016B, 
-0x0000016A, 0x0004003D, 0x00000006, 0x0000016C, 0x00000156, 0x00050085, 0x00000006, 0x0000016D, 
-0x0000016B, 0x0000016C, 0x0004003D, 0x00000006, 0x0000016E, 0x00000035, 0x00050081, 0x00000006, 
-0x0000016F, 0x0000016D, 0x0000016E, 0x0004003D, 0x00000006, 0x00000170, 0x00000035, 0x00050085, 
-0x00000006, 0x00000171, 0x0000016F, 0x00000170, 0x0004003D, 0x00000006, 0x00000172, 0x00000156, 
-0x00050081, 0x00000006, 0x00000173, 0x00000171, 0x00000172, 0x0006000C, 0x00000006, 0x00000174, 
-0x00000001, 0x0000001F, 0x00000173, 0x00050085, 0x00000006, 0x00000175, 0x00000169, 0x00000174, 
-0x0003003E, 0x00000168, 0x00000175, 0x0004003D, 0x00000006, 0x00000176, 0x00000168, 0x0004003D, 
-0x00000006, 0x00000177, 0x0000015A, 0x00050081, 0x00000006, 0x00000178, 0x00000176, 0x00000177, 
-0x00050088, 0x00000006, 0x00000179, 0x00000139, 0x00000178, 0x000200FE, 0x00000179, 0x00010038, 
-0x00050036, 0x00000006, 0x0000003D, 0x00000000, 0x0000003A, 0x00030037, 0x00000007, 0x0000003B, 
-0x00030037, 0x00000007, 0x0000003C, 0x000200F8, 0x0000003E, 0x0004003B, 0x00000007, 0x0000017C, 
-0x00000007, 0x0004003B, 0x00000007, 0x00000182, 0x00000007, 0x0004003B, 0x00000007, 0x00000186, 
-0x00000007, 0x0004003D, 0x00000006, 0x0000017D, 0x0000003C, 0x0007000C, 0x00000006, 0x0000017F, 
-0x00000001, 0x00000025, 0x0000017D, 0x0000017E, 0x00050083, 0x00000006, 0x00000180, 0x000000DF, 
-0x0000017F, 0x0006000C, 0x00000006, 0x00000181, 0x00000001, 0x00000020, 0x00000180, 0x0003003E, 
-0x0000017C, 0x00000181, 0x0004003D, 0x00000006, 0x00000183, 0x0000003B, 0x0004003D, 0x00000006, 
-0x00000184, 0x0000017C, 0x00050085, 0x00000006, 0x00000185, 0x00000183, 0x00000184, 0x0003003E, 
-0x00000186, 0x00000185, 0x00050039, 0x00000006, 0x00000187, 0x00000019, 0x00000186, 0x0003003E, 
-0x00000182, 0x00000187, 0x0004003D, 0x00000006, 0x00000188, 0x00000182, 0x0004003D, 0x00000006, 
-0x00000189, 0x00000182, 0x00050085, 0x00000006, 0x0000018A, 0x00000188, 0x00000189, 0x000200FE, 
-0x0000018A, 0x00010038, 0x00050036, 0x00000006, 0x00000043, 0x00000000, 0x0000002E, 0x00030037, 
-0x00000007, 0x0000003F, 0x00030037, 0x00000007, 0x00000040, 0x00030037, 0x00000007, 0x00000041, 
-0x00030037, 0x00000007, 0x00000042, 0x000200F8, 0x00000044, 0x0004003B, 0x00000007, 0x0000018D, 
-0x00000007, 0x0004003B, 0x00000007, 0x0000018F, 0x00000007, 0x0004003B, 0x00000007, 0x00000191, 
-0x00000007, 0x0004003B, 0x00000007, 0x00000193, 0x00000007, 0x0004003D, 0x00000006, 0x0000018E, 
-0x0000003F, 0x0003003E, 0x0000018D, 0x0000018E, 0x0004003D, 0x00000006, 0x00000190, 0x00000040, 
-0x0003003E, 0x0000018F, 0x00000190, 0x0004003D, 0x00000006, 0x00000192, 0x00000041, 0x0003003E, 
-0x00000191, 0x00000192, 0x0004003D, 0x00000006, 0x00000194, 0x00000042, 0x0003003E, 0x00000193, 
-0x00000194, 0x00080039, 0x00000006, 0x00000195, 0x00000033, 0x0000018D, 0x0000018F, 0x00000191, 
-0x00000193, 0x000200FE, 0x00000195, 0x00010038, 0x00050036, 0x00000006, 0x00000046, 0x00000000, 
-0x00000008, 0x00030037, 0x00000007, 0x00000045, 0x000200F8, 0x00000047, 0x0004003D, 0x00000006, 
-0x00000198, 0x00000045, 0x0007000C, 0x00000006, 0x0000019A, 0x00000001, 0x00000028, 0x00000198, 
-0x00000199, 0x000200FE, 0x0000019A, 0x00010038, 0x00050036, 0x0000000C, 0x0000004B, 0x00000000, 
-0x00000048, 0x00030037, 0x00000012, 0x00000049, 0x00030037, 0x00000007, 0x0000004A, 0x000200F8, 
-0x0000004C, 0x0008004F, 0x0000000C, 0x0000019D, 0x00000049, 0x00000049, 0x00000000, 0x00000001, 
-0x00000002, 0x0004003D, 0x00000006, 0x0000019E, 0x0000004A, 0x00050083, 0x00000006, 0x0000019F, 
-0x000000DF, 0x0000019E, 0x0005008E, 0x0000000C, 0x000001A0, 0x0000019D, 0x0000019F, 0x000200FE, 
-0x000001A0, 0x00010038, 0x00050036, 0x0000000C, 0x00000051, 0x00000000, 0x0000004D, 0x00030037, 
-0x00000012, 0x0000004E, 0x00030037, 0x00000007, 0x0000004F, 0x00030037, 0x00000007, 0x00000050, 
-0x000200F8, 0x00000052, 0x0008004F, 0x0000000C, 0x000001A3, 0x0000004E, 0x0000004E, 0x00000000, 
-0x00000001, 0x00000002, 0x0004003D, 0x00000006, 0x000001A4, 0x0000004F, 0x0005008E, 0x0000000C, 
-0x000001A5, 0x000001A3, 0x000001A4, 0x0004003D, 0x00000006, 0x000001A6, 0x00000050, 0x0004003D, 
-0x00000006, 0x000001A7, 0x0000004F, 0x00050083, 0x00000006, 0x000001A8, 0x000000DF, 0x000001A7, 
-0x00050085, 0x00000006, 0x000001A9, 0x000001A6, 0x000001A8, 0x00060050, 0x0000000C, 0x000001AA, 
-0x000001A9, 0x000001A9, 0x000001A9, 0x00050081, 0x0000000C, 0x000001AB, 0x000001A5, 0x000001AA, 
-0x000200FE, 0x000001AB, 0x00010038, 0x00050036, 0x00000006, 0x00000054, 0x00000000, 0x00000008, 
-0x00030037, 0x00000007, 0x00000053, 0x000200F8, 0x00000055, 0x0004003D, 0x00000006, 0x000001AF, 
-0x00000053, 0x00050085, 0x00000006, 0x000001B0, 0x000001AE, 0x000001AF, 0x0004003D, 0x00000006, 
-0x000001B1, 0x00000053, 0x00050085, 0x00000006, 0x000001B2, 0x000001B0, 0x000001B1, 0x000200FE, 
-0x000001B2, 0x00010038, 0x00050036, 0x00000006, 0x00000057, 0x00000000, 0x00000008, 0x00030037, 
-0x00000007, 0x00000056, 0x000200F8, 0x00000058, 0x0004003D, 0x00000006, 0x000001B5, 0x00000056, 
-0x0004003D, 0x00000006, 0x000001B6, 0x00000056, 0x00050085, 0x00000006, 0x000001B7, 0x000001B5, 
-0x000001B6, 0x000200FE, 0x000001B7, 0x00010038, 0x00050036, 0x00000006, 0x0000005D, 0x00000000, 
-0x0000001B, 0x00030037, 0x00000007, 0x00000059, 0x00030037, 0x00000007, 0x0000005A, 0x00030037, 
-0x0000000C, 0x0000005B, 0x00030037, 0x0000000C, 0x0000005C, 0x000200F8, 0x0000005E, 0x0004003B, 
-0x00000007, 0x000001BA, 0x00000007, 0x0004003B, 0x00000007, 0x000001BC, 0x00000007, 0x0004003D, 
-0x00000006, 0x000001BB, 0x00000059, 0x0003003E, 0x000001BA, 0x000001BB, 0x0004003D, 0x00000006, 
-0x000001BD, 0x0000005A, 0x0003003E, 0x000001BC, 0x000001BD, 0x00080039, 0x00000006, 0x000001BE, 
-0x00000020, 0x000001BA, 0x000001BC, 0x0000005C, 0x0000005B, 0x000200FE, 0x000001BE, 0x00010038, 
-0x00050036, 0x00000006, 0x00000062, 0x00000000, 0x00000028, 0x00030037, 0x00000007, 0x0000005F, 
-0x00030037, 0x00000007, 0x00000060, 0x00030037, 0x00000007, 0x00000061, 0x000200F8, 0x00000063, 
-0x0004003B, 0x00000007, 0x000001C1, 0x00000007, 0x0004003B, 0x00000007, 0x000001C3, 0x00000007, 
-0x0004003B, 0x00000007, 0x000001C5, 0x00000007, 0x0004003D, 0x00000006, 0x000001C2, 0x0000005F, 
-0x0003003E, 0x000001C1, 0x000001C2, 0x0004003D, 0x00000006, 0x000001C4, 0x00000060, 0x0003003E, 
-0x000001C3, 0x000001C4, 0x0004003D, 0x00000006, 0x000001C6, 0x00000061, 0x0003003E, 0x000001C5, 
-0x000001C6, 0x00070039, 0x00000006, 0x000001C7, 0x00000038, 0x000001C1, 0x000001C3, 0x000001C5, 
-0x000200FE, 0x000001C7, 0x00010038, 0x00050036, 0x0000000C, 0x00000067, 0x00000000, 0x00000064, 
-0x00030037, 0x0000000C, 0x00000065, 0x00030037, 0x00000007, 0x00000066, 0x000200F8, 0x00000068, 
-0x0004003B, 0x00000007, 0x000001CA, 0x00000007, 0x0004003B, 0x00000007, 0x000001CE, 0x00000007, 
-0x0004003B, 0x00000007, 0x000001D0, 0x00000007, 0x0004003B, 0x00000007, 0x000001D2, 0x00000007, 
-0x00050094, 0x00000006, 0x000001CD, 0x00000065, 0x000001CC, 0x0003003E, 0x000001CE, 0x000001CD, 
-0x00050039, 0x00000006, 0x000001CF, 0x00000019, 0x000001CE, 0x0003003E, 0x000001CA, 0x000001CF, 
-0x0004003D, 0x00000006, 0x000001D1, 0x000001CA, 0x0003003E, 0x000001D0, 0x000001D1, 0x0004003D, 
-0x00000006, 0x000001D3, 0x00000066, 0x0003003E, 0x000001D2, 0x000001D3, 0x00070039, 0x0000000C, 
-0x000001D4, 0x00000026, 0x00000065, 0x000001D0, 0x000001D2, 0x000200FE, 0x000001D4, 0x00010038, 
-0x00050036, 0x0000000C, 0x0000006D, 0x00000000, 0x00000069, 0x00030037, 0x0000000D, 0x0000006A, 
-0x00030037, 0x00000007, 0x0000006B, 0x00030037, 0x00000007, 0x0000006C, 0x000200F8, 0x0000006E, 
-0x0004003D, 0x0000000C, 0x000001D7, 0x0000006A, 0x0004003D, 0x00000006, 0x000001D8, 0x0000006C, 
-0x00050083, 0x00000006, 0x000001D9, 0x000000DF, 0x000001D8, 0x00060050, 0x0000000C, 0x000001DA, 
-0x000001D9, 0x000001D9, 0x000001D9, 0x0004003D, 0x0000000C, 0x000001DB, 0x0000006A, 0x0007000C, 
-0x0000000C, 0x000001DC, 0x00000001, 0x00000028, 0x000001DA, 0x000001DB, 0x0004003D, 0x0000000C, 
-0x000001DD, 0x0000006A, 0x00050083, 0x0000000C, 0x000001DE, 0x000001DC, 0x000001DD, 0x0004003D, 
-0x00000006, 0x000001DF, 0x0000006B, 0x00050083, 0x00000006, 0x000001E0, 0x000000DF, 0x000001DF, 
-0x0007000C, 0x00000006, 0x000001E1, 0x00000001, 0x00000028, 0x000001E0, 0x00000102, 0x0007000C, 
-0x00000006, 0x000001E2, 0x00000001, 0x0000001A, 0x000001E1, 0x00000132, 0x0005008E, 0x0000000C, 
-0x000001E3, 0x000001DE, 0x000001E2, 0x00050081, 0x0000000C, 0x000001E4, 0x000001D7, 0x000001E3, 
-0x000200FE, 0x000001E4, 0x00010038, 0x00050036, 0x00000012, 0x00000070, 0x00000000, 0x0000006F, 
-0x000200F8, 0x00000071, 0x0004003B, 0x00000013, 0x0000020A, 0x00000007, 0x00050041, 0x000001EB, 
-0x000001EC, 0x000001E9, 0x000001EA, 0x0004003D, 0x00000006, 0x000001ED, 0x000001EC, 0x000500B8, 
-0x000001EF, 0x000001F0, 0x000001ED, 0x000001EE, 0x000300F7, 0x000001F2, 0x00000000, 0x000400FA, 
-0x000001F0, 0x000001F1, 0x000001F2, 0x000200F8, 0x000001F1, 0x00050041, 0x000001F4, 0x000001F5, 
-0x000001E9, 0x000001F3, 0x0004003D, 0x00000012, 0x000001F6, 0x000001F5, 0x000200FE, 0x000001F6, 
-0x000200F8, 0x000001F2, 0x00050041, 0x000001F4, 0x000001F8, 0x000001E9, 0x000001F3, 0x0004003D, 
-0x00000012, 0x000001F9, 0x000001F8, 0x00050041, 0x000001EB, 0x000001FA, 0x000001E9, 0x000001EA, 
-0x0004003D, 0x00000006, 0x000001FB, 0x000001FA, 0x0004003D, 0x000001FD, 0x00000200, 0x000001FF, 
-0x00050041, 0x00000206, 0x00000207, 0x00000204, 0x00000205, 0x0004003D, 0x0000007D, 0x00000208, 
-0x00000207, 0x00050057, 0x00000012, 0x00000209, 0x00000200, 0x00000208, 0x0003003E, 0x0000020A, 
-0x00000209, 0x00050039, 0x00000012, 0x0000020B, 0x00000016, 0x0000020A, 0x0005008E, 0x00000012, 
-0x0000020C, 0x0000020B, 0x000001FB, 0x00050085, 0x00000012, 0x0000020D, 0x000001F9, 0x0000020C, 
-0x000200FE, 0x0000020D, 0x00010038, 0x00050036, 0x0000000C, 0x00000073, 0x00000000, 0x00000072, 
-0x000200F8, 0x00000074, 0x00050041, 0x000001EB, 0x00000211, 0x000001E9, 0x00000210, 0x0004003D, 
-0x00000006, 0x00000212, 0x00000211, 0x000500B8, 0x000001EF, 0x00000213, 0x00000212, 0x000001EE, 
-0x000300F7, 0x00000215, 0x00000000, 0x000400FA, 0x00000213, 0x00000214, 0x00000215, 0x000200F8, 
-0x00000214, 0x00050041, 0x000001EB, 0x00000217, 0x000001E9, 0x00000216, 0x0004003D, 0x00000006, 
-0x00000218, 0x00000217, 0x00060050, 0x0000000C, 0x00000219, 0x00000218, 0x00000218, 0x00000218, 
-0x000200FE, 0x00000219, 0x000200F8, 0x00000215, 0x00050041, 0x000001EB, 0x0000021B, 0x000001E9, 
-0x00000210, 0x0004003D, 0x00000006, 0x0000021C, 0x0000021B, 0x00050083, 0x00000006, 0x0000021D, 
-0x000000DF, 0x0000021C, 0x00050041, 0x000001EB, 0x0000021E, 0x000001E9, 0x00000216, 0x0004003D, 
-0x00000006, 0x0000021F, 0x0000021E, 0x00050085, 0x00000006, 0x00000220, 0x0000021D, 0x0000021F, 
-0x00050041, 0x000001EB, 0x00000221, 0x000001E9, 0x00000210, 0x0004003D, 0x00000006, 0x00000222, 
-0x00000221, 0x0004003D, 0x000001FD, 0x00000224, 0x00000223, 0x00050041, 0x00000206, 0x00000225, 
-0x00000204, 0x00000205, 0x0004003D, 0x0000007D, 0x00000226, 0x00000225, 0x00050057, 0x00000012, 
-0x00000227, 0x00000224, 0x00000226, 0x0008004F, 0x0000000C, 0x00000228, 0x00000227, 0x00000227, 
-0x00000000, 0x00000001, 0x00000002, 0x0005008E, 0x0000000C, 0x00000229, 0x00000228, 0x00000222, 
-0x00060050, 0x0000000C, 0x0000022A, 0x00000220, 0x00000220, 0x00000220, 0x00050081, 0x0000000C, 
-0x0000022B, 0x0000022A, 0x00000229, 0x000200FE, 0x0000022B, 0x00010038, 0x00050036, 0x00000006, 
-0x00000076, 0x00000000, 0x00000075, 0x000200F8, 0x00000077, 0x00050041, 0x000001EB, 0x0000022F, 
-0x000001E9, 0x0000022E, 0x0004003D, 0x00000006, 0x00000230, 0x0000022F, 0x000500B8, 0x000001EF, 
-0x00000231, 0x00000230, 0x000001EE, 0x000300F7, 0x00000233, 0x00000000, 0x000400FA, 0x00000231, 
-0x00000232, 0x00000233, 0x000200F8, 0x00000232, 0x00050041, 0x000001EB, 0x00000234, 0x000001E9, 
-0x00000205, 0x0004003D, 0x00000006, 0x00000235, 0x00000234, 0x000200FE, 0x00000235, 0x000200F8, 
-0x00000233, 0x00050041, 0x000001EB, 0x00000237, 0x000001E9, 0x0000022E, 0x0004003D, 0x00000006, 
-0x00000238, 0x00000237, 0x00050083, 0x00000006, 0x00000239, 0x000000DF, 0x00000238, 0x00050041, 
-0x000001EB, 0x0000023A, 0x000001E9, 0x00000205, 0x0004003D, 0x00000006, 0x0000023B, 0x0000023A, 
-0x00050085, 0x00000006, 0x0000023C, 0x00000239, 0x0000023B, 0x00050041, 0x000001EB, 0x0000023D, 
-0x000001E9, 0x0000022E, 0x0004003D, 0x00000006, 0x0000023E, 0x0000023D, 0x0004003D, 0x000001FD, 
-0x00000240, 0x0000023F, 0x00050041, 0x00000206, 0x00000241, 0x00000204, 0x00000205, 0x0004003D, 
-0x0000007D, 0x00000242, 0x00000241, 0x00050057, 0x00000012, 0x00000243, 0x00000240, 0x00000242, 
-0x00050051, 0x00000006, 0x00000245, 0x00000243, 0x00000000, 0x00050085, 0x00000006, 0x00000246, 
-0x0000023E, 0x00000245, 0x00050081, 0x00000006, 0x00000247, 0x0000023C, 0x00000246, 0x000200FE, 
-0x00000247, 0x00010038, 0x00050036, 0x00000006, 0x00000078, 0x00000000, 0x00000075, 0x000200F8, 
-0x00000079, 0x00050041, 0x000001EB, 0x0000024B, 0x000001E9, 0x0000024A, 0x0004003D, 0x00000006, 
-0x0000024C, 0x0000024B, 0x000500B8, 0x000001EF, 0x0000024D, 0x0000024C, 0x000001EE, 0x000300F7, 
-0x0000024F, 0x00000000, 0x000400FA, 0x0000024D, 0x0000024E, 0x0000024F, 0x000200F8, 0x0000024E, 
-0x000200FE, 0x000000DF, 0x000200F8, 0x0000024F, 0x00050041, 0x000001EB, 0x00000251, 0x000001E9, 
-0x0000024A, 0x0004003D, 0x00000006, 0x00000252, 0x00000251, 0x00050083, 0x00000006, 0x00000253, 
-0x000000DF, 0x00000252, 0x00050041, 0x000001EB, 0x00000254, 0x000001E9, 0x0000024A, 0x0004003D, 
-0x00000006, 0x00000255, 0x00000254, 0x0004003D, 0x000001FD, 0x00000257, 0x00000256, 0x00050041, 
-0x00000206, 0x00000258, 0x00000204, 0x00000205, 0x0004003D, 0x0000007D, 0x00000259, 0x00000258, 
-0x00050057, 0x00000012, 0x0000025A, 0x00000257, 0x00000259, 0x00050051, 0x00000006, 0x0000025B, 
-0x0000025A, 0x00000000, 0x00050085, 0x00000006, 0x0000025C, 0x00000255, 0x0000025B, 0x00050081, 
-0x00000006, 0x0000025D, 0x00000253, 0x0000025C, 0x000200FE, 0x0000025D, 0x00010038, 0x00050036, 
-0x0000000C, 0x0000007B, 0x00000000, 0x0000000E, 0x00030037, 0x0000000D, 0x0000007A, 0x000200F8, 
-0x0000007C, 0x0004003B, 0x0000000D, 0x00000277, 0x00000007, 0x00050041, 0x000001EB, 0x00000261, 
-0x000001E9, 0x00000260, 0x0004003D, 0x00000006, 0x00000262, 0x00000261, 0x000500B8, 0x000001EF, 
-0x00000263, 0x00000262, 0x000001EE, 0x000300F7, 0x00000265, 0x00000000, 0x000400FA, 0x00000263, 
-0x00000264, 0x00000265, 0x000200F8, 0x00000264, 0x00050041, 0x000001EB, 0x00000267, 0x000001E9, 
-0x00000266, 0x0004003D, 0x00000006, 0x00000268, 0x00000267, 0x0004003D, 0x0000000C, 0x00000269, 
-0x0000007A, 0x0005008E, 0x0000000C, 0x0000026A, 0x00000269, 0x00000268, 0x000200FE, 0x0000026A, 
-0x000200F8, 0x00000265, 0x00050041, 0x000001EB, 0x0000026C, 0x000001E9, 0x00000266, 0x0004003D, 
-0x00000006, 0x0000026D, 0x0000026C, 0x0004003D, 0x0000000C, 0x0000026E, 0x0000007A, 0x0005008E, 
-0x0000000C, 0x0000026F, 0x0000026E, 0x0000026D, 0x00050041, 0x000001EB, 0x00000270, 0x000001E9, 
-0x00000260, 0x0004003D, 0x00000006, 0x00000271, 0x00000270, 0x0004003D, 0x000001FD, 0x00000273, 
-0x00000272, 0x00050041, 0x00000206, 0x00000274, 0x00000204, 0x00000205, 0x0004003D, 0x0000007D, 
-0x00000275, 0x00000274, 0x00050057, 0x00000012, 0x00000276, 0x00000273, 0x00000275, 0x0008004F, 
-0x0000000C, 0x00000278, 0x00000276, 0x00000276, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 
-0x00000277, 0x00000278, 0x00050039, 0x0000000C, 0x00000279, 0x00000010, 0x00000277, 0x0005008E, 
-0x0000000C, 0x0000027A, 0x00000279, 0x00000271, 0x00050081, 0x0000000C, 0x0000027B, 0x0000026F, 
-0x0000027A, 0x000200FE, 0x0000027B, 0x00010038, 0x00050036, 0x00000006, 0x00000081, 0x00000000, 
-0x0000007F, 0x00030037, 0x0000007E, 0x00000080, 0x000200F8, 0x00000082, 0x0004003D, 0x0000007D, 
-0x0000027E, 0x00000080, 0x00050094, 0x00000006, 0x00000282, 0x0000027E, 0x00000281, 0x0006000C, 
-0x00000006, 0x00000283, 0x00000001, 0x0000000D, 0x00000282, 0x00050085, 0x00000006, 0x00000285, 
-0x00000283, 0x00000284, 0x0006000C, 0x00000006, 0x00000286, 0x00000001, 0x0000000A, 0x00000285, 
-0x000200FE, 0x00000286, 0x00010038, 0x00050036, 0x0000007D, 0x00000089, 0x00000000, 0x00000085, 
-0x00030037, 0x00000084, 0x00000086, 0x00030037, 0x00000007, 0x00000087, 0x00030037, 0x00000007, 
-0x00000088, 0x000200F8, 0x0000008A, 0x0004003B, 0x00000007, 0x00000289, 0x00000007, 0x0004003B, 
-0x00000007, 0x0000028B, 0x00000007, 0x0004003B, 0x00000007, 0x00000292, 0x00000007, 0x0004003B, 
-0x00000007, 0x00000299, 0x00000007, 0x0004003B, 0x00000007, 0x0000029C, 0x00000007, 0x0003003E, 
-0x00000289, 0x0000028A, 0x0004003D, 0x00000083, 0x0000028C, 0x00000086, 0x0004006F, 0x00000006, 
-0x0000028D, 0x0000028C, 0x00050081, 0x00000006, 0x0000028E, 0x0000028D, 0x00000139, 0x0006000C, 
-0x00000006, 0x0000028F, 0x00000001, 0x0000001F, 0x0000028E, 0x0004003D, 0x00000006, 0x00000290, 
-0x00000087, 0x00050085, 0x00000006, 0x00000291, 0x0000028F, 0x00000290, 0x0003003E, 0x0000028B, 
-0x00000291, 0x0004003D, 0x00000083, 0x00000293, 0x00000086, 0x0004006F, 0x00000006, 0x00000294, 
-0x00000293, 0x0004003D, 0x00000006, 0x00000295, 0x00000289, 0x00050085, 0x00000006, 0x00000296, 
-0x00000294, 0x00000295, 0x0004003D, 0x00000006, 0x00000297, 0x00000088, 0x00050081, 0x00000006, 
-0x00000298, 0x00000296, 0x00000297, 0x0003003E, 0x00000292, 0x00000298, 0x0004003D, 0x00000006, 
-0x0000029A, 0x00000292, 0x0006000C, 0x00000006, 0x0000029B, 0x00000001, 0x0000000D, 0x0000029A, 
-0x0003003E, 0x00000299, 0x0000029B, 0x0004003D, 0x00000006, 0x0000029D, 0x00000292, 0x0006000C, 
-0x00000006, 0x0000029E, 0x00000001, 0x0000000E, 0x0000029D, 0x0003003E, 0x0000029C, 0x0000029E, 
-0x0004003D, 0x00000006, 0x0000029F, 0x0000028B, 0x0004003D, 0x00000006, 0x000002A0, 0x0000029C, 
-0x00050085, 0x00000006, 0x000002A1, 0x0000029F, 0x000002A0, 0x0004003D, 0x00000006, 0x000002A2, 
-0x0000028B, 0x0004003D, 0x00000006, 0x000002A3, 0x00000299, 0x00050085, 0x00000006, 0x000002A4, 
-0x000002A2, 0x000002A3, 0x00050050, 0x0000007D, 0x000002A5, 0x000002A1, 0x000002A4, 0x000200FE, 
-0x000002A5, 0x00010038, 0x00050036, 0x00000006, 0x0000008D, 0x00000000, 0x0000008B, 0x00030037, 
-0x00000013, 0x0000008C, 0x000200F8, 0x0000008E, 0x0004003B, 0x00000007, 0x000002A8, 0x00000007, 
-0x0004003D, 0x00000012, 0x000002A9, 0x0000008C, 0x00050094, 0x00000006, 0x000002AD, 0x000002A9, 
-0x000002AC, 0x0003003E, 0x000002A8, 0x000002AD, 0x0004003D, 0x00000006, 0x000002AE, 0x000002A8, 
-0x0006000C, 0x00000006, 0x000002AF, 0x00000001, 0x0000000D, 0x000002AE, 0x00050085, 0x00000006, 
-0x000002B0, 0x000002AF, 0x00000284, 0x0006000C, 0x00000006, 0x000002B1, 0x00000001, 0x0000000A, 
-0x000002B0, 0x000200FE, 0x000002B1, 0x00010038, 0x00050036, 0x00000006, 0x00000092, 0x00000000, 
-0x0000008F, 0x00030037, 0x0000000D, 0x00000090, 0x00030037, 0x00000084, 0x00000091, 0x000200F8, 
-0x00000093, 0x0004003B, 0x00000013, 0x000002B4, 0x00000007, 0x0004003B, 0x00000013, 0x000002BC, 
-0x00000007, 0x0004003D, 0x0000000C, 0x000002B5, 0x00000090, 0x0004003D, 0x00000083, 0x000002B6, 
-0x00000091, 0x0004006F, 0x00000006, 0x000002B7, 0x000002B6, 0x00050051, 0x00000006, 0x000002B8, 
-0x000002B5, 0x00000000, 0x00050051, 0x00000006, 0x000002B9, 0x000002B5, 0x00000001, 0x00050051, 
-0x00000006, 0x000002BA, 0x000002B5, 0x00000002, 0x00070050, 0x00000012, 0x000002BB, 0x000002B8, 
-0x000002B9, 0x000002BA, 0x000002B7, 0x0003003E, 0x000002B4, 0x000002BB, 0x0004003D, 0x00000012, 
-0x000002BD, 0x000002B4, 0x0003003E, 0x000002BC, 0x000002BD, 0x00050039, 0x00000006, 0x000002BE, 
-0x0000008D, 0x000002BC, 0x000200FE, 0x000002BE, 0x00010038, 0x00050036, 0x00000006, 0x00000098, 
-0x00000000, 0x00000094, 0x00030037, 0x0000000D, 0x00000095, 0x00030037, 0x0000000D, 0x00000096, 
-0x00030037, 0x00000084, 0x00000097, 0x000200F8, 0x00000099, 0x0004003B, 0x00000007, 0x000002C1, 
-0x00000007, 0x0004003B, 0x00000007, 0x000002CF, 0x00000007, 0x00050041, 0x000001EB, 0x000002CD, 
-0x000002CB, 0x000002CC, 0x0004003D, 0x00000006, 0x000002CE, 0x000002CD, 0x0003003E, 0x000002C1, 
-0x000002CE, 0x0004003D, 0x00000006, 0x000002D0, 0x000002C1, 0x0004003D, 0x0000000C, 0x000002D1, 
-0x00000096, 0x0004003D, 0x0000000C, 0x000002D2, 0x00000095, 0x00050094, 0x00000006, 0x000002D3, 
-0x000002D1, 0x000002D2, 0x00050083, 0x00000006, 0x000002D4, 0x000000DF, 0x000002D3, 0x00050085, 
-0x00000006, 0x000002D5, 0x000002D0, 0x000002D4, 0x0004003D, 0x00000006, 0x000002D6, 0x000002C1, 
-0x0007000C, 0x00000006, 0x000002D7, 0x00000001, 0x00000028, 0x000002D5, 0x000002D6, 0x0003003E, 
-0x000002CF, 0x000002D7, 0x0004003D, 0x00000006, 0x000002D8, 0x000002CF, 0x000200FE, 0x000002D8, 
-0x00010038, 0x00050036, 0x00000006, 0x0000009B, 0x00000000, 0x0000007F, 0x00030037, 0x0000007E, 
-0x0000009A, 0x000200F8, 0x0000009C, 0x0004003B, 0x0000000D, 0x000002DB, 0x00000007, 0x0003003E, 
-0x000002DB, 0x000002DF, 0x00050041, 0x00000007, 0x000002E1, 0x000002DB, 0x000002E0, 0x0004003D, 
-0x00000006, 0x000002E2, 0x000002E1, 0x0004003D, 0x0000007D, 0x000002E3, 0x0000009A, 0x0004003D, 
-0x0000000C, 0x000002E4, 0x000002DB, 0x0007004F, 0x0000007D, 0x000002E5, 0x000002E4, 0x000002E4, 
-0x00000000, 0x00000001, 0x00050094, 0x00000006, 0x000002E6, 0x000002E3, 0x000002E5, 0x0006000C, 
-0x00000006, 0x000002E7, 0x00000001, 0x0000000A, 0x000002E6, 0x00050085, 0x00000006, 0x000002E8, 
-0x000002E2, 0x000002E7, 0x0006000C, 0x00000006, 0x000002E9, 0x00000001, 0x0000000A, 0x000002E8, 
-0x000200FE, 0x000002E9, 0x00010038, 0x00050036, 0x00000006, 0x000000A8, 0x00000000, 0x000000A0, 
-0x00030037, 0x0000009F, 0x000000A1, 0x00030037, 0x00000013, 0x000000A2, 0x00030037, 0x00000007, 
-0x000000A3, 0x00030037, 0x0000000D, 0x000000A4, 0x00030037, 0x0000000D, 0x000000A5, 0x00030037, 
-0x0000000D, 0x000000A6, 0x00030037, 0x00000084, 0x000000A7, 0x000200F8, 0x000000A9, 0x0004003B, 
-0x00000007, 0x000002EC, 0x00000007, 0x0004003B, 0x0000000D, 0x000002ED, 0x00000007, 0x0004003B, 
-0x0000000D, 0x000002EF, 0x00000007, 0x0004003B, 0x00000084, 0x000002F1, 0x00000007, 0x0004003B, 
-0x00000007, 0x000002F4, 0x00000007, 0x0004003B, 0x00000007, 0x000002F5, 0x00000007, 0x0004003B, 
-0x0000007E, 0x000002F6, 0x00000007, 0x0004003B, 0x00000007, 0x000002FA, 0x00000007, 0x0004003B, 
-0x0000000D, 0x000002FB, 0x00000007, 0x0004003B, 0x00000084, 0x00000300, 0x00000007, 0x0004003B, 
-0x0000000D, 0x00000302, 0x00000007, 0x0004003B, 0x00000084, 0x00000304, 0x00000007, 0x0004003B, 
-0x00000084, 0x0000030A, 0x00000007, 0x0004003B, 0x0000007E, 0x00000312, 0x00000007, 0x0004003B, 
-0x0000007E, 0x00000315, 0x00000007, 0x0004003B, 0x00000084, 0x00000319, 0x00000007, 0x0004003B, 
-0x00000007, 0x0000031B, 0x00000007, 0x0004003B, 0x00000007, 0x0000031D, 0x00000007, 0x0004003B, 
-0x00000007, 0x00000322, 0x00000007, 0x0004003D, 0x0000000C, 0x000002EE, 0x000000A4, 0x0003003E, 
-0x000002ED, 0x000002EE, 0x0004003D, 0x0000000C, 0x000002F0, 0x000000A5, 0x0003003E, 0x000002EF, 
-0x000002F0, 0x0004003D, 0x00000083, 0x000002F2, 0x000000A7, 0x0003003E, 0x000002F1, 0x000002F2, 
-0x00070039, 0x00000006, 0x000002F3, 0x00000098, 0x000002ED, 0x000002EF, 0x000002F1, 0x0003003E, 
-0x000002EC, 0x000002F3, 0x0003003E, 0x000002F4, 0x00000102, 0x0004003D, 0x0000000C, 0x000002F7, 
-0x000000A6, 0x0007004F, 0x0000007D, 0x000002F8, 0x000002F7, 0x000002F7, 0x00000000, 0x00000001, 
-0x0003003E, 0x000002F6, 0x000002F8, 0x00050039, 0x00000006, 0x000002F9, 0x00000081, 0x000002F6, 
-0x0003003E, 0x000002F5, 0x000002F9, 0x0003003E, 0x000002FA, 0x00000139, 0x0004003D, 0x0000000C, 
-0x000002FC, 0x000000A6, 0x0005008E, 0x0000000C, 0x000002FE, 0x000002FC, 0x000002FD, 0x0006000C, 
-0x0000000C, 0x000002FF, 0x00000001, 0x00000008, 0x000002FE, 0x0003003E, 0x000002FB, 0x000002FF, 
-0x0004003D, 0x0000000C, 0x00000303, 0x000002FB, 0x0003003E, 0x00000302, 0x00000303, 0x0003003E, 
-0x00000304, 0x00000205, 0x00060039, 0x00000006, 0x00000305, 0x00000092, 0x00000302, 0x00000304, 
-0x00050085, 0x00000006, 0x00000306, 0x00000301, 0x00000305, 0x0004006E, 0x00000083, 0x00000307, 
-0x00000306, 0x0005008B, 0x00000083, 0x00000309, 0x00000307, 0x00000308, 0x0003003E, 0x00000300, 
-0x00000309, 0x0003003E, 0x0000030A, 0x000001F3, 0x000200F9, 0x0000030B, 0x000200F8, 0x0000030B, 
-0x000400F6, 0x0000030D, 0x0000030E, 0x00000000, 0x000200F9, 0x0000030F, 0x000200F8, 0x0000030F, 
-0x0004003D, 0x00000083, 0x00000310, 0x0000030A, 0x000500B1, 0x000001EF, 0x00000311, 0x00000310, 
-0x00000266, 0x000400FA, 0x00000311, 0x0000030C, 0x0000030D, 0x000200F8, 0x0000030C, 0x0004003D, 
-0x00000012, 0x00000316, 0x00000314, 0x0007004F, 0x0000007D, 0x00000317, 0x00000316, 0x00000316, 
-0x00000000, 0x00000001, 0x0003003E, 0x00000315, 0x00000317, 0x00050039, 0x00000006, 0x00000318, 
-0x0000009B, 0x00000315, 0x0004003D, 0x00000083, 0x0000031A, 0x0000030A, 0x0003003E, 0x00000319, 
-0x0000031A, 0x0004003D, 0x00000006, 0x0000031C, 0x000002FA, 0x0003003E, 0x0000031B, 0x0000031C, 
-0x0003003E, 0x0000031D, 0x00000318, 0x00070039, 0x0000007D, 0x0000031E, 0x00000089, 0x00000319, 
-0x0000031B, 0x0000031D, 0x00050050, 0x0000007D, 0x00000320, 0x0000031F, 0x0000031F, 0x00050088, 
-0x0000007D, 0x00000321, 0x0000031E, 0x00000320, 0x0003003E, 0x00000312, 0x00000321, 0x0004003D, 
-0x0000009E, 0x00000323, 0x000000A1, 0x0004003D, 0x00000012, 0x00000324, 0x000000A2, 0x0007004F, 
-0x0000007D, 0x00000325, 0x00000324, 0x00000324, 0x00000000, 0x00000001, 0x0004003D, 0x0000007D, 
-0x00000326, 0x00000312, 0x00050081, 0x0000007D, 0x00000327, 0x00000325, 0x00000326, 0x0004003D, 
-0x00000083, 0x00000328, 0x000000A7, 0x0004006F, 0x00000006, 0x00000329, 0x00000328, 0x00050051, 
-0x00000006, 0x0000032A, 0x00000327, 0x00000000, 0x00050051, 0x00000006, 0x0000032B, 0x00000327, 
-0x00000001, 0x00060050, 0x0000000C, 0x0000032C, 0x0000032A, 0x0000032B, 0x00000329, 0x00050057, 
-0x00000012, 0x0000032D, 0x00000323, 0x0000032C, 0x00050051, 0x00000006, 0x0000032E, 0x0000032D, 
-0x00000000, 0x0004003D, 0x00000006, 0x0000032F, 0x000002EC, 0x00050083, 0x00000006, 0x00000330, 
-0x0000032E, 0x0000032F, 0x0003003E, 0x00000322, 0x00000330, 0x00050041, 0x00000007, 0x00000331, 
-0x000000A2, 0x000002E0, 0x0004003D, 0x00000006, 0x00000332, 0x00000331, 0x0004003D, 0x00000006, 
-0x00000333, 0x00000322, 0x0007000C, 0x00000006, 0x00000334, 0x00000001, 0x00000030, 0x00000332, 
-0x00000333, 0x0004003D, 0x00000006, 0x00000335, 0x000002F4, 0x00050081, 0x00000006, 0x00000336, 
-0x00000335, 0x00000334, 0x0003003E, 0x000002F4, 0x00000336, 0x000200F9, 0x0000030E, 0x000200F8, 
-0x0000030E, 0x0004003D, 0x00000083, 0x00000337, 0x0000030A, 0x00050080, 0x00000083, 0x00000338, 
-0x00000337, 0x00000205, 0x0003003E, 0x0000030A, 0x00000338, 0x000200F9, 0x0000030B, 0x000200F8, 
-0x0000030D, 0x0004003D, 0x00000006, 0x00000339, 0x000002F4, 0x00050088, 0x00000006, 0x0000033B, 
-0x00000339, 0x0000033A, 0x000200FE, 0x0000033B, 0x00010038, 0x00050036, 0x00000083, 0x000000AC, 
-0x00000000, 0x000000AA, 0x00030037, 0x0000000D, 0x000000AB, 0x000200F8, 0x000000AD, 0x0004003B, 
-0x00000084, 0x0000033E, 0x00000007, 0x0004003B, 0x00000013, 0x0000033F, 0x00000007, 0x0004003B, 
-0x00000084, 0x00000349, 0x00000007, 0x0003003E, 0x0000033E, 0x000001F3, 0x00050041, 0x00000340, 
-0x00000341, 0x000002CB, 0x00000216, 0x0004003D, 0x000002C5, 0x00000342, 0x00000341, 0x0004003D, 
-0x0000000C, 0x00000343, 0x000000AB, 0x00050051, 0x00000006, 0x00000344, 0x00000343, 0x00000000, 
-0x00050051, 0x00000006, 0x00000345, 0x00000343, 0x00000001, 0x00050051, 0x00000006, 0x00000346, 
-0x00000343, 0x00000002, 0x00070050, 0x00000012, 0x00000347, 0x00000344, 0x00000345, 0x00000346, 
-0x000000DF, 0x00050091, 0x00000012, 0x00000348, 0x00000342, 0x00000347, 0x0003003E, 0x0000033F, 
-0x00000348, 0x0003003E, 0x00000349, 0x000001F3, 0x000200F9, 0x0000034A, 0x000200F8, 0x0000034A, 
-0x000400F6, 0x0000034C, 0x0000034D, 0x00000000, 0x000200F9, 0x0000034E, 0x000200F8, 0x0000034E, 
-0x0004003D, 0x00000083, 0x0000034F, 0x00000349, 0x00050041, 0x00000351, 0x00000352, 0x000002CB, 
-0x00000350, 0x0004003D, 0x00000083, 0x00000353, 0x00000352, 0x00050082, 0x00000083, 0x00000354, 
-0x00000353, 0x00000205, 0x000500B1, 0x000001EF, 0x00000355, 0x0000034F, 0x00000354, 0x000400FA, 
-0x00000355, 0x0000034B, 0x0000034C, 0x000200F8, 0x0000034B, 0x00050041, 0x00000007, 0x00000356, 
-0x0000033F, 0x000002E0, 0x0004003D, 0x00000006, 0x00000357, 0x00000356, 0x0004003D, 0x00000083, 
-0x00000358, 0x00000349, 0x00070041, 0x000001EB, 0x00000359, 0x000002CB, 0x00000210, 0x00000358, 
-0x00000244, 0x0004003D, 0x00000006, 0x0000035A, 0x00000359, 0x000500B8, 0x000001EF, 0x0000035B, 
-0x00000357, 0x0000035A, 0x000300F7, 0x0000035D, 0x00000000, 0x000400FA, 0x0000035B, 0x0000035C, 
-0x0000035D, 0x000200F8, 0x0000035C, 0x0004003D, 0x00000083, 0x0000035E, 0x00000349, 0x00050080, 
-0x00000083, 0x0000035F, 0x0000035E, 0x00000205, 0x0003003E, 0x0000033E, 0x0000035F, 0x000200F9, 
-0x0000035D, 0x000200F8, 0x0000035D, 0x000200F9, 0x0000034D, 0x000200F8, 0x0000034D, 0x0004003D, 
-0x00000083, 0x00000360, 0x00000349, 0x00050080, 0x00000083, 0x00000361, 0x00000360, 0x00000205, 
-0x0003003E, 0x00000349, 0x00000361, 0x000200F9, 0x0000034A, 0x000200F8, 0x0000034C, 0x0004003D, 
-0x00000083, 0x00000362, 0x0000033E, 0x000200FE, 0x00000362, 0x00010038, 0x00050036, 0x00000006, 
-0x000000B3, 0x00000000, 0x000000AE, 0x00030037, 0x0000000D, 0x000000AF, 0x00030037, 0x00000084, 
-0x000000B0, 0x00030037, 0x0000000D, 0x000000B1, 0x00030037, 0x0000000D, 0x000000B2, 0x000200F8, 
-0x000000B4, 0x0004003B, 0x00000007, 0x00000365, 0x00000007, 0x0004003B, 0x00000007, 0x00000369, 
-0x00000007, 0x0004003B, 0x00000013, 0x0000036C, 0x00000007, 0x0004003B, 0x00000007, 0x00000375, 
-0x00000007, 0x0004003B, 0x00000013, 0x00000383, 0x00000007, 0x0004003B, 0x00000007, 0x00000395, 
-0x00000007, 0x0004003B, 0x00000007, 0x00000397, 0x00000007, 0x0004003B, 0x00000007, 0x000003A2, 
-0x00000007, 0x0004003B, 0x00000013, 0x000003A4, 0x00000007, 0x0004003B, 0x00000007, 0x000003A6, 
-0x00000007, 0x0004003B, 0x0000000D, 0x000003A8, 0x00000007, 0x0004003B, 0x0000000D, 0x000003AA, 
-0x00000007, 0x0004003B, 0x0000000D, 0x000003AC, 0x00000007, 0x0004003B, 0x00000084, 0x000003AE, 
-0x00000007, 0x0004003B, 0x00000007, 0x000003B1, 0x00000007, 0x0004003B, 0x00000084, 0x000003BE, 
-0x00000007, 0x0004003B, 0x00000007, 0x000003D8, 0x00000007, 0x0004003B, 0x00000013, 0x000003D9, 
-0x00000007, 0x0004003B, 0x00000007, 0x000003DB, 0x00000007, 0x0004003B, 0x0000000D, 0x000003DD, 
-0x00000007, 0x0004003B, 0x0000000D, 0x000003DF, 0x00000007, 0x0004003B, 0x0000000D, 0x000003E1, 
-0x00000007, 0x0004003B, 0x00000084, 0x000003E3, 0x00000007, 0x00050041, 0x000001EB, 0x00000367, 
-0x000002CB, 0x00000366, 0x0004003D, 0x00000006, 0x00000368, 0x00000367, 0x0003003E, 0x00000365, 
-0x00000368, 0x00050041, 0x000001EB, 0x0000036A, 0x000002CB, 0x00000260, 0x0004003D, 0x00000006, 
-0x0000036B, 0x0000036A, 0x0003003E, 0x00000369, 0x0000036B, 0x00050041, 0x00000340, 0x0000036D, 
-0x000002CB, 0x00000216, 0x0004003D, 0x000002C5, 0x0000036E, 0x0000036D, 0x0004003D, 0x0000000C, 
-0x0000036F, 0x000000AF, 0x00050051, 0x00000006, 0x00000370, 0x0000036F, 0x00000000, 0x00050051, 
-0x00000006, 0x00000371, 0x0000036F, 0x00000001, 0x00050051, 0x00000006, 0x00000372, 0x0000036F, 
-0x00000002, 0x00070050, 0x00000012, 0x00000373, 0x00000370, 0x00000371, 0x00000372, 0x000000DF, 
-0x00050091, 0x00000012, 0x00000374, 0x0000036E, 0x00000373, 0x0003003E, 0x0000036C, 0x00000374, 
-0x0004003D, 0x00000012, 0x00000376, 0x0000036C, 0x0006000C, 0x00000006, 0x00000377, 0x00000001, 
-0x00000042, 0x00000376, 0x0003003E, 0x00000375, 0x00000377, 0x0004003D, 0x00000006, 0x00000378, 
-0x00000375, 0x0004003D, 0x00000006, 0x00000379, 0x00000365, 0x0004003D, 0x00000006, 0x0000037A, 
-0x00000369, 0x00050083, 0x00000006, 0x0000037B, 0x00000379, 0x0000037A, 0x00050083, 0x00000006, 
-0x0000037C, 0x00000378, 0x0000037B, 0x0003003E, 0x000000DE, 0x0000037C, 0x0004003D, 0x00000006, 
-0x0000037D, 0x00000369, 0x0004003D, 0x00000006, 0x0000037E, 0x000000DE, 0x00050088, 0x00000006, 
-0x0000037F, 0x0000037E, 0x0000037D, 0x0003003E, 0x000000DE, 0x0000037F, 0x0004003D, 0x00000006, 
-0x00000380, 0x000000DE, 0x00050083, 0x00000006, 0x00000381, 0x000000DF, 0x00000380, 0x0008000C, 
-0x00000006, 0x00000382, 0x00000001, 0x0000002B, 0x00000381, 0x00000102, 0x000000DF, 0x0003003E, 
-0x000000DE, 0x00000382, 0x00050041, 0x00000340, 0x00000384, 0x000002CB, 0x00000266, 0x0004003D, 
-0x000002C5, 0x00000385, 0x00000384, 0x0004003D, 0x00000083, 0x00000386, 0x000000B0, 0x00060041, 
-0x00000340, 0x00000387, 0x000002CB, 0x00000205, 0x00000386, 0x0004003D, 0x000002C5, 0x00000388, 
-0x00000387, 0x00050092, 0x000002C5, 0x00000389, 0x00000385, 0x00000388, 0x0004003D, 0x0000000C, 
-0x0000038A, 0x000000AF, 0x00050051, 0x00000006, 0x0000038B, 0x0000038A, 0x00000000, 0x00050051, 
-0x00000006, 0x0000038C, 0x0000038A, 0x00000001, 0x00050051, 0x00000006, 0x0000038D, 0x0000038A, 
-0x00000002, 0x00070050, 0x00000012, 0x0000038E, 0x0000038B, 0x0000038C, 0x0000038D, 0x000000DF, 
-0x00050091, 0x00000012, 0x0000038F, 0x00000389, 0x0000038E, 0x0003003E, 0x00000383, 0x0000038F, 
-0x0004003D, 0x00000012, 0x00000390, 0x00000383, 0x00050041, 0x00000007, 0x00000391, 0x00000383, 
-0x000000F8, 0x0004003D, 0x00000006, 0x00000392, 0x00000391, 0x00050088, 0x00000006, 0x00000393, 
-0x000000DF, 0x00000392, 0x0005008E, 0x00000012, 0x00000394, 0x00000390, 0x00000393, 0x0003003E, 
-0x00000383, 0x00000394, 0x0003003E, 0x00000395, 0x00000396, 0x00050041, 0x000001EB, 0x00000398, 
-0x000002CB, 0x0000022E, 0x0004003D, 0x00000006, 0x00000399, 0x00000398, 0x0004003D, 0x00000006, 
-0x0000039A, 0x00000395, 0x00050085, 0x00000006, 0x0000039B, 0x00000399, 0x0000039A, 0x00050041, 
-0x00000007, 0x0000039C, 0x00000383, 0x000002E0, 0x0004003D, 0x00000006, 0x0000039D, 0x0000039C, 
-0x00050088, 0x00000006, 0x0000039E, 0x0000039B, 0x0000039D, 0x0003003E, 0x00000397, 0x0000039E, 
-0x0004003D, 0x00000006, 0x0000039F, 0x00000397, 0x0007000C, 0x00000006, 0x000003A1, 0x00000001, 
-0x00000025, 0x0000039F, 0x000003A0, 0x0003003E, 0x00000397, 0x000003A1, 0x0003003E, 0x000003A2, 
-0x000000DF, 0x0004003D, 0x00000012, 0x000003A5, 0x00000383, 0x0003003E, 0x000003A4, 0x000003A5, 
-0x0004003D, 0x00000006, 0x000003A7, 0x00000397, 0x0003003E, 0x000003A6, 0x000003A7, 0x0004003D, 
-0x0000000C, 0x000003A9, 0x000000B1, 0x0003003E, 0x000003A8, 0x000003A9, 0x0004003D, 0x0000000C, 
-0x000003AB, 0x000000B2, 0x0003003E, 0x000003AA, 0x000003AB, 0x0004003D, 0x0000000C, 0x000003AD, 
-0x000000AF, 0x0003003E, 0x000003AC, 0x000003AD, 0x0004003D, 0x00000083, 0x000003AF, 0x000000B0, 
-0x0003003E, 0x000003AE, 0x000003AF, 0x000B0039, 0x00000006, 0x000003B0, 0x000000A8, 0x000003A3, 
-0x000003A4, 0x000003A6, 0x000003A8, 0x000003AA, 0x000003AC, 0x000003AE, 0x0003003E, 0x000003A2, 
-0x000003B0, 0x0004003D, 0x00000083, 0x000003B2, 0x000000B0, 0x00070041, 0x000001EB, 0x000003B3, 
-0x000002CB, 0x00000210, 0x000003B2, 0x00000244, 0x0004003D, 0x00000006, 0x000003B4, 0x000003B3, 
-0x00050041, 0x000001EB, 0x000003B5, 0x000002CB, 0x0000024A, 0x0004003D, 0x00000006, 0x000003B6, 
-0x000003B5, 0x00050081, 0x00000006, 0x000003B7, 0x000003B4, 0x000003B6, 0x0004003D, 0x00000083, 
-0x000003B8, 0x000000B0, 0x00070041, 0x000001EB, 0x000003B9, 0x000002CB, 0x00000210, 0x000003B8, 
-0x00000244, 0x0004003D, 0x00000006, 0x000003BA, 0x000003B9, 0x00050041, 0x00000007, 0x000003BB, 
-0x0000036C, 0x000002E0, 0x0004003D, 0x00000006, 0x000003BC, 0x000003BB, 0x0008000C, 0x00000006, 
-0x000003BD, 0x00000001, 0x00000031, 0x000003B7, 0x000003BA, 0x000003BC, 0x0003003E, 0x000003B1, 
-0x000003BD, 0x0004003D, 0x00000083, 0x000003BF, 0x000000B0, 0x00050080, 0x00000083, 0x000003C0, 
-0x000003BF, 0x00000205, 0x0003003E, 0x000003BE, 0x000003C0, 0x0004003D, 0x00000006, 0x000003C1, 
-0x000003B1, 0x000500BA, 0x000001EF, 0x000003C2, 0x000003C1, 0x00000102, 0x000300F7, 0x000003C4, 
-0x00000000, 0x000400FA, 0x000003C2, 0x000003C3, 0x000003C4, 0x000200F8, 0x000003C3, 0x0004003D, 
-0x00000083, 0x000003C5, 0x000003BE, 0x00050041, 0x00000351, 0x000003C6, 0x000002CB, 0x00000350, 
-0x0004003D, 0x00000083, 0x000003C7, 0x000003C6, 0x000500B1, 0x000001EF, 0x000003C8, 0x000003C5, 
-0x000003C7, 0x000200F9, 0x000003C4, 0x000200F8, 0x000003C4, 0x000700F5, 0x000001EF, 0x000003C9, 
-0x000003C2, 0x000000B4, 0x000003C8, 0x000003C3, 0x000300F7, 0x000003CB, 0x00000000, 0x000400FA, 
-0x000003C9, 0x000003CA, 0x000003CB, 0x000200F8, 0x000003CA, 0x00050041, 0x00000340, 0x000003CC, 
-0x000002CB, 0x00000266, 0x0004003D, 0x000002C5, 0x000003CD, 0x000003CC, 0x0004003D, 0x00000083, 
-0x000003CE, 0x000003BE, 0x00060041, 0x00000340, 0x000003CF, 0x000002CB, 0x00000205, 0x000003CE, 
-0x0004003D, 0x000002C5, 0x000003D0, 0x000003CF, 0x00050092, 0x000002C5, 0x000003D1, 0x000003CD, 
-0x000003D0, 0x0004003D, 0x0000000C, 0x000003D2, 0x000000AF, 0x00050051, 0x00000006, 0x000003D3, 
-0x000003D2, 0x00000000, 0x00050051, 0x00000006, 0x000003D4, 0x000003D2, 0x00000001, 0x00050051, 
-0x00000006, 0x000003D5, 0x000003D2, 0x00000002, 0x00070050, 0x00000012, 0x000003D6, 0x000003D3, 
-0x000003D4, 0x000003D5, 0x000000DF, 0x00050091, 0x00000012, 0x000003D7, 0x000003D1, 0x000003D6, 
-0x0003003E, 0x00000383, 0x000003D7, 0x0004003D, 0x00000012, 0x000003DA, 0x00000383, 0x0003003E, 
-0x000003D9, 0x000003DA, 0x0004003D, 0x00000006, 0x000003DC, 0x00000397, 0x0003003E, 0x000003DB, 
-0x000003DC, 0x0004003D, 0x0000000C, 0x000003DE, 0x000000B1, 0x0003003E, 0x000003DD, 0x000003DE, 
-0x0004003D, 0x0000000C, 0x000003E0, 0x000000B2, 0x0003003E, 0x000003DF, 0x000003E0, 0x0004003D, 
-0x0000000C, 0x000003E2, 0x000000AF, 0x0003003E, 0x000003E1, 0x000003E2, 0x0004003D, 0x00000083, 
-0x000003E4, 0x000003BE, 0x0003003E, 0x000003E3, 0x000003E4, 0x000B0039, 0x00000006, 0x000003E5, 
-0x000000A8, 0x000003A3, 0x000003D9, 0x000003DB, 0x000003DD, 0x000003DF, 0x000003E1, 0x000003E3, 
-0x0003003E, 0x000003D8, 0x000003E5, 0x0004003D, 0x00000006, 0x000003E6, 0x000003A2, 0x0004003D, 
-0x00000006, 0x000003E7, 0x000003D8, 0x0004003D, 0x00000006, 0x000003E8, 0x000003B1, 0x0008000C, 
-0x00000006, 0x000003E9, 0x00000001, 0x0000002E, 0x000003E6, 0x000003E7, 0x000003E8, 0x0003003E, 
-0x000003A2, 0x000003E9, 0x000200F9, 0x000003CB, 0x000200F8, 0x000003CB, 0x0004003D, 0x00000006, 
-0x000003EA, 0x000003A2, 0x00050083, 0x00000006, 0x000003EB, 0x000000DF, 0x000003EA, 0x0004003D, 
-0x00000006, 0x000003EC, 0x000000DE, 0x00050085, 0x00000006, 0x000003ED, 0x000003EB, 0x000003EC, 
-0x00050083, 0x00000006, 0x000003EE, 0x000000DF, 0x000003ED, 0x000200FE, 0x000003EE, 0x00010038, 
-0x00050036, 0x0000000C, 0x000000BF, 0x00000000, 0x000000B7, 0x00030037, 0x000000B5, 0x000000B8, 
-0x00030037, 0x000000B6, 0x000000B9, 0x00030037, 0x0000000C, 0x000000BA, 0x00030037, 0x00000007, 
-0x000000BB, 0x00030037, 0x00000007, 0x000000BC, 0x00030037, 0x00000007, 0x000000BD, 0x00030037, 
-0x00000007, 0x000000BE, 0x000200F8, 0x000000C0, 0x0004003B, 0x00000007, 0x000003F1, 0x00000007, 
-0x0004003B, 0x00000007, 0x000003F3, 0x00000007, 0x0004003B, 0x00000007, 0x000003F5, 0x00000007, 
-0x0004003B, 0x00000007, 0x000003F8, 0x00000007, 0x0004003B, 0x00000007, 0x000003F9, 0x00000007, 
-0x0004003B, 0x00000007, 0x000003FB, 0x00000007, 0x0004003B, 0x00000007, 0x000003FD, 0x00000007, 
-0x0004003B, 0x0000000D, 0x00000400, 0x00000007, 0x0004003B, 0x00000007, 0x00000402, 0x00000007, 
-0x00050051, 0x0000000C, 0x000003F2, 0x000000B8, 0x00000006, 0x00050051, 0x00000006, 0x000003F4, 
-0x000000B8, 0x00000002, 0x0003003E, 0x000003F3, 0x000003F4, 0x0004003D, 0x00000006, 0x000003F6, 
-0x000000BD, 0x0003003E, 0x000003F5, 0x000003F6, 0x00080039, 0x00000006, 0x000003F7, 0x0000005D, 
-0x000003F3, 0x000003F5, 0x000003F2, 0x000000BA, 0x0003003E, 0x000003F1, 0x000003F7, 0x00050051, 
-0x00000006, 0x000003FA, 0x000000B8, 0x00000002, 0x0003003E, 0x000003F9, 0x000003FA, 0x0004003D, 
-0x00000006, 0x000003FC, 0x000000BB, 0x0003003E, 0x000003FB, 0x000003FC, 0x0004003D, 0x00000006, 
-0x000003FE, 0x000000BC, 0x0003003E, 0x000003FD, 0x000003FE, 0x00070039, 0x00000006, 0x000003FF, 
-0x00000062, 0x000003F9, 0x000003FB, 0x000003FD, 0x0003003E, 0x000003F8, 0x000003FF, 0x00050051, 
-0x0000000C, 0x00000401, 0x000000B8, 0x0000000A, 0x0004003D, 0x00000006, 0x00000403, 0x000000BE, 
-0x0003003E, 0x00000402, 0x00000403, 0x00060039, 0x0000000C, 0x00000404, 0x00000067, 0x00000401, 
-0x00000402, 0x0003003E, 0x00000400, 0x00000404, 0x0004003D, 0x00000006, 0x00000405, 0x000003F1, 
-0x0004003D, 0x00000006, 0x00000406, 0x000003F8, 0x00050085, 0x00000006, 0x00000407, 0x00000405, 
-0x00000406, 0x0004003D, 0x0000000C, 0x00000408, 0x00000400, 0x0005008E, 0x0000000C, 0x00000409, 
-0x00000408, 0x00000407, 0x000200FE, 0x00000409, 0x00010038, 0x00050036, 0x0000000C, 0x000000C6, 
-0x00000000, 0x000000C1, 0x00030037, 0x000000B5, 0x000000C2, 0x00030037, 0x00000007, 0x000000C3, 
-0x00030037, 0x00000007, 0x000000C4, 0x00030037, 0x00000007, 0x000000C5, 0x000200F8, 0x000000C7, 
-0x0004003B, 0x00000007, 0x0000040E, 0x00000007, 0x0004003B, 0x00000007, 0x00000410, 0x00000007, 
-0x0004003B, 0x00000007, 0x00000412, 0x00000007, 0x0004003B, 0x00000007, 0x00000414, 0x00000007, 
-0x00050051, 0x00000012, 0x0000040C, 0x000000C2, 0x00000000, 0x0008004F, 0x0000000C, 0x0000040D, 
-0x0000040C, 0x0000040C, 0x00000000, 0x00000001, 0x00000002, 0x00050051, 0x00000006, 0x0000040F, 
-0x000000C2, 0x00000002, 0x0003003E, 0x0000040E, 0x0000040F, 0x0004003D, 0x00000006, 0x00000411, 
-0x000000C3, 0x0003003E, 0x00000410, 0x00000411, 0x0004003D, 0x00000006, 0x00000413, 0x000000C4, 
-0x0003003E, 0x00000412, 0x00000413, 0x0004003D, 0x00000006, 0x00000415, 0x000000C5, 0x0003003E, 
-0x00000414, 0x00000415, 0x00080039, 0x00000006, 0x00000416, 0x00000043, 0x0000040E, 0x00000410, 
-0x00000412, 0x00000414, 0x0005008E, 0x0000000C, 0x00000417, 0x0000040D, 0x00000416, 0x000200FE, 
-0x00000417, 0x00010038, 0x00050036, 0x0000000C, 0x000000CF, 0x00000000, 0x000000B7, 0x00030037, 
-0x000000B5, 0x000000C8, 0x00030037, 0x000000B6, 0x000000C9, 0x00030037, 0x0000000C, 0x000000CA, 
-0x00030037, 0x00000007, 0x000000CB, 0x00030037, 0x00000007, 0x000000CC, 0x00030037, 0x00000007, 
-0x000000CD, 0x00030037, 0x00000007, 0x000000CE, 0x000200F8, 0x000000D0, 0x0004003B, 0x00000007, 
-0x0000041A, 0x00000007, 0x0004003B, 0x00000007, 0x0000041C, 0x00000007, 0x0004003B, 0x00000007, 
-0x0000041E, 0x00000007, 0x0004003B, 0x00000007, 0x00000420, 0x00000007, 0x0004003D, 0x00000006, 
-0x0000041B, 0x000000CB, 0x0003003E, 0x0000041A, 0x0000041B, 0x0004003D, 0x00000006, 0x0000041D, 
-0x000000CC, 0x0003003E, 0x0000041C, 0x0000041D, 0x0004003D, 0x00000006, 0x0000041F, 0x000000CD, 
-0x0003003E, 0x0000041E, 0x0000041F, 0x0004003D, 0x00000006, 0x00000421, 0x000000CE, 0x0003003E, 
-0x00000420, 0x00000421, 0x000B0039, 0x0000000C, 0x00000422, 0x000000BF, 0x000000C8, 0x000000C9, 
-0x000000CA, 0x0000041A, 0x0000041C, 0x0000041E, 0x00000420, 0x000200FE, 0x00000422, 0x00010038, 
-0x00050036, 0x0000000C, 0x000000D6, 0x00000000, 0x000000D2, 0x00030037, 0x0000000D, 0x000000D3, 
-0x00030037, 0x0000000D, 0x000000D4, 0x00030037, 0x000000D1, 0x000000D5, 0x000200F8, 0x000000D7, 
-0x0004003B, 0x0000000D, 0x00000425, 0x00000007, 0x0004003B, 0x00000084, 0x00000427, 0x00000007, 
-0x0004003B, 0x00000432, 0x00000433, 0x00000007, 0x0004003B, 0x00000007, 0x00000447, 0x00000007, 
-0x0004003B, 0x0000000D, 0x0000044D, 0x00000007, 0x0004003B, 0x00000007, 0x00000453, 0x00000007, 
-0x0004003B, 0x00000007, 0x00000458, 0x00000007, 0x0004003B, 0x00000007, 0x0000045F, 0x00000007, 
-0x0004003B, 0x0000000D, 0x00000478, 0x00000007, 0x0004003B, 0x00000007, 0x0000047E, 0x00000007, 
-0x0004003B, 0x00000007, 0x00000482, 0x00000007, 0x0004003B, 0x00000007, 0x00000487, 0x00000007, 
-0x0004003B, 0x00000007, 0x0000048D, 0x00000007, 0x0004003B, 0x00000007, 0x00000493, 0x00000007, 
-0x0004003B, 0x00000007, 0x000004A4, 0x00000007, 0x0004003B, 0x00000084, 0x000004B4, 0x00000007, 
-0x0004003B, 0x0000000D, 0x000004B5, 0x00000007, 0x0004003B, 0x0000000D, 0x000004B8, 0x00000007, 
-0x0004003B, 0x00000084, 0x000004BA, 0x00000007, 0x0004003B, 0x0000000D, 0x000004BC, 0x00000007, 
-0x0004003B, 0x0000000D, 0x000004C0, 0x00000007, 0x0004003B, 0x0000000D, 0x000004C5, 0x00000007, 
-0x0004003B, 0x0000000D, 0x000004C9, 0x00000007, 0x0004003B, 0x0000000D, 0x000004D0, 0x00000007, 
-0x0004003B, 0x00000007, 0x000004D6, 0x00000007, 0x0004003B, 0x00000007, 0x000004DB, 0x00000007, 
-0x0004003B, 0x0000000D, 0x000004DD, 0x00000007, 0x0004003B, 0x00000007, 0x000004E3, 0x00000007, 
-0x0004003B, 0x00000007, 0x000004E9, 0x00000007, 0x0004003B, 0x00000007, 0x000004EB, 0x00000007, 
-0x0004003B, 0x00000007, 0x000004ED, 0x00000007, 0x0004003B, 0x00000007, 0x000004EE, 0x00000007, 
-0x0004003B, 0x00000007, 0x000004F1, 0x00000007, 0x0004003B, 0x00000007, 0x000004F6, 0x00000007, 
-0x0004003B, 0x00000007, 0x000004F8, 0x00000007, 0x0004003B, 0x00000007, 0x000004FC, 0x00000007, 
-0x0004003B, 0x0000000D, 0x000004FE, 0x00000007, 0x0004003B, 0x00000007, 0x00000500, 0x00000007, 
-0x0004003B, 0x00000007, 0x00000502, 0x00000007, 0x0004003B, 0x00000007, 0x00000504, 0x00000007, 
-0x0004003B, 0x0000000D, 0x00000507, 0x00000007, 0x0004003B, 0x00000007, 0x0000050B, 0x00000007, 
-0x0004003B, 0x00000007, 0x0000050D, 0x00000007, 0x0004003B, 0x00000007, 0x0000050F, 0x00000007, 
-0x0004003B, 0x00000007, 0x00000511, 0x00000007, 0x0004003B, 0x0000000D, 0x00000514, 0x00000007, 
-0x0004003B, 0x00000007, 0x0000051E, 0x00000007, 0x0004003B, 0x00000007, 0x00000520, 0x00000007, 
-0x0003003E, 0x00000425, 0x00000426, 0x0003003E, 0x00000427, 0x000001F3, 0x000200F9, 0x00000428, 
-0x000200F8, 0x00000428, 0x000400F6, 0x0000042A, 0x0000042B, 0x00000000, 0x000200F9, 0x0000042C, 
-0x000200F8, 0x0000042C, 0x0004003D, 0x00000083, 0x0000042D, 0x00000427, 0x00050041, 0x00000351, 
-0x0000042F, 0x000002CB, 0x0000042E, 0x0004003D, 0x00000083, 0x00000430, 0x0000042F, 0x000500B1, 
-0x000001EF, 0x00000431, 0x0000042D, 0x00000430, 0x000400FA, 0x00000431, 0x00000429, 0x0000042A, 
-0x000200F8, 0x00000429, 0x0004003D, 0x00000083, 0x00000434, 0x00000427, 0x00060041, 0x00000435, 
-0x00000436, 0x000002CB, 0x000001F3, 0x00000434, 0x0004003D, 0x000002C2, 0x00000437, 0x00000436, 
-0x00050051, 0x00000012, 0x00000438, 0x00000437, 0x00000000, 0x00050041, 0x00000013, 0x00000439, 
-0x00000433, 0x000001F3, 0x0003003E, 0x00000439, 0x00000438, 0x00050051, 0x00000012, 0x0000043A, 
-0x00000437, 0x00000001, 0x00050041, 0x00000013, 0x0000043B, 0x00000433, 0x00000205, 0x0003003E, 
-0x0000043B, 0x0000043A, 0x00050051, 0x00000012, 0x0000043C, 0x00000437, 0x00000002, 0x00050041, 
-0x00000013, 0x0000043D, 0x00000433, 0x00000216, 0x0003003E, 0x0000043D, 0x0000043C, 0x00050051, 
-0x00000006, 0x0000043E, 0x00000437, 0x00000003, 0x00050041, 0x00000007, 0x00000440, 0x00000433, 
-0x0000043F, 0x0003003E, 0x00000440, 0x0000043E, 0x00050051, 0x00000006, 0x00000441, 0x00000437, 
-0x00000004, 0x00050041, 0x00000007, 0x00000442, 0x00000433, 0x00000266, 0x0003003E, 0x00000442, 
-0x00000441, 0x00050051, 0x00000006, 0x00000443, 0x00000437, 0x00000005, 0x00050041, 0x00000007, 
-0x00000444, 0x00000433, 0x000001EA, 0x0003003E, 0x00000444, 0x00000443, 0x00050051, 0x00000006, 
-0x00000445, 0x00000437, 0x00000006, 0x00050041, 0x00000007, 0x00000446, 0x00000433, 0x00000210, 
-0x0003003E, 0x00000446, 0x00000445, 0x0003003E, 0x00000447, 0x00000102, 0x00050041, 0x00000007, 
-0x00000448, 0x00000433, 0x000001EA, 0x0004003D, 0x00000006, 0x00000449, 0x00000448, 0x000500B4, 
-0x000001EF, 0x0000044A, 0x00000449, 0x0000013A, 0x000300F7, 0x0000044C, 0x00000000, 0x000400FA, 
-0x0000044A, 0x0000044B, 0x00000472, 0x000200F8, 0x0000044B, 0x00050041, 0x00000013, 0x0000044E, 
-0x00000433, 0x00000205, 0x0004003D, 0x00000012, 0x0000044F, 0x0000044E, 0x0008004F, 0x0000000C, 
-0x00000450, 0x0000044F, 0x0000044F, 0x00000000, 0x00000001, 0x00000002, 0x0004003D, 0x0000000C, 
-0x00000451, 0x000000D4, 0x00050083, 0x0000000C, 0x00000452, 0x00000450, 0x00000451, 0x0003003E, 
-0x0000044D, 0x00000452, 0x0004003D, 0x0000000C, 0x00000454, 0x0000044D, 0x0006000C, 0x00000006, 
-0x00000455, 0x00000001, 0x00000042, 0x00000454, 0x0003003E, 0x00000453, 0x00000455, 0x0004003D, 
-0x0000000C, 0x00000456, 0x0000044D, 0x0006000C, 0x0000000C, 0x00000457, 0x00000001, 0x00000045, 
-0x00000456, 0x0003003E, 0x0000044D, 0x00000457, 0x00050041, 0x00000007, 0x00000459, 0x00000433, 
-0x00000266, 0x0004003D, 0x00000006, 0x0000045A, 0x00000459, 0x0004003D, 0x00000006, 0x0000045B, 
-0x00000453, 0x0007000C, 0x00000006, 0x0000045C, 0x00000001, 0x0000001A, 0x0000045B, 0x0000013A, 
-0x00050081, 0x00000006, 0x0000045D, 0x0000045C, 0x000000DF, 0x00050088, 0x00000006, 0x0000045E, 
-0x0000045A, 0x0000045D, 0x0003003E, 0x00000458, 0x0000045E, 0x0004003D, 0x00000006, 0x00000460, 
-0x00000453, 0x0004003D, 0x00000006, 0x00000461, 0x00000453, 0x00050085, 0x00000006, 0x00000462, 
-0x00000460, 0x00000461, 0x00050041, 0x00000007, 0x00000463, 0x00000433, 0x00000266, 0x0004003D, 
-0x00000006, 0x00000464, 0x00000463, 0x00050041, 0x00000007, 0x00000465, 0x00000433, 0x00000266, 
-0x0004003D, 0x00000006, 0x00000466, 0x00000465, 0x00050085, 0x00000006, 0x00000467, 0x00000464, 
-0x00000466, 0x00050088, 0x00000006, 0x00000468, 0x00000462, 0x00000467, 0x00050083, 0x00000006, 
-0x00000469, 0x000000DF, 0x00000468, 0x0008000C, 0x00000006, 0x0000046A, 0x00000001, 0x0000002B, 
-0x00000469, 0x00000102, 0x000000DF, 0x0003003E, 0x0000045F, 0x0000046A, 0x0004003D, 0x00000006, 
-0x0000046B, 0x0000045F, 0x0003003E, 0x00000447, 0x0000046B, 0x0004003D, 0x0000000C, 0x0000046C, 
-0x0000044D, 0x00050051, 0x00000006, 0x0000046D, 0x0000046C, 0x00000000, 0x00050051, 0x00000006, 
-0x0000046E, 0x0000046C, 0x00000001, 0x00050051, 0x00000006, 0x0000046F, 0x0000046C, 0x00000002, 
-0x00070050, 0x00000012, 0x00000470, 0x0000046D, 0x0000046E, 0x0000046F, 0x000000DF, 0x00050041, 
-0x00000013, 0x00000471, 0x00000433, 0x00000216, 0x0003003E, 0x00000471, 0x00000470, 0x000200F9, 
-0x0000044C, 0x000200F8, 0x00000472, 0x00050041, 0x00000007, 0x00000473, 0x00000433, 0x000001EA, 
-0x0004003D, 0x00000006, 0x00000474, 0x00000473, 0x000500B4, 0x000001EF, 0x00000475, 0x00000474, 
-0x000000DF, 0x000300F7, 0x00000477, 0x00000000, 0x000400FA, 0x00000475, 0x00000476, 0x000004A3, 
-0x000200F8, 0x00000476, 0x00050041, 0x00000013, 0x00000479, 0x00000433, 0x00000205, 0x0004003D, 
-0x00000012, 0x0000047A, 0x00000479, 0x0008004F, 0x0000000C, 0x0000047B, 0x0000047A, 0x0000047A, 
-0x00000000, 0x00000001, 0x00000002, 0x0004003D, 0x0000000C, 0x0000047C, 0x000000D4, 0x00050083, 
-0x0000000C, 0x0000047D, 0x0000047B, 0x0000047C, 0x0003003E, 0x00000478, 0x0000047D, 0x00050041, 
-0x00000007, 0x0000047F, 0x00000433, 0x00000210, 0x0004003D, 0x00000006, 0x00000480, 0x0000047F, 
-0x00050083, 0x00000006, 0x00000481, 0x000000DF, 0x00000480, 0x0003003E, 0x0000047E, 0x00000481, 
-0x0004003D, 0x0000000C, 0x00000483, 0x00000478, 0x0006000C, 0x00000006, 0x00000484, 0x00000001, 
-0x00000042, 0x00000483, 0x0003003E, 0x00000482, 0x00000484, 0x0004003D, 0x0000000C, 0x00000485, 
-0x00000478, 0x0006000C, 0x0000000C, 0x00000486, 0x00000001, 0x00000045, 0x00000485, 0x0003003E, 
-0x00000478, 0x00000486, 0x0004003D, 0x0000000C, 0x00000488, 0x00000478, 0x00050041, 0x00000013, 
-0x00000489, 0x00000433, 0x00000216, 0x0004003D, 0x00000012, 0x0000048A, 0x00000489, 0x0008004F, 
-0x0000000C, 0x0000048B, 0x0000048A, 0x0000048A, 0x00000000, 0x00000001, 0x00000002, 0x00050094, 
-0x00000006, 0x0000048C, 0x00000488, 0x0000048B, 0x0003003E, 0x00000487, 0x0000048C, 0x0004003D, 
-0x00000006, 0x0000048E, 0x0000047E, 0x0004003D, 0x00000006, 0x0000048F, 0x0000047E, 0x00050085, 
-0x00000006, 0x00000491, 0x0000048F, 0x00000490, 0x00050083, 0x00000006, 0x00000492, 0x0000048E, 
-0x00000491, 0x0003003E, 0x0000048D, 0x00000492, 0x0004003D, 0x00000006, 0x00000494, 0x00000487, 
-0x0004003D, 0x00000006, 0x00000495, 0x0000047E, 0x00050083, 0x00000006, 0x00000496, 0x00000494, 
-0x00000495, 0x0004003D, 0x00000006, 0x00000497, 0x0000048D, 0x00050088, 0x00000006, 0x00000498, 
-0x00000496, 0x00000497, 0x0003003E, 0x00000493, 0x00000498, 0x00050041, 0x00000007, 0x00000499, 
-0x00000433, 0x00000266, 0x0004003D, 0x00000006, 0x0000049A, 0x00000499, 0x0004003D, 0x00000006, 
-0x0000049B, 0x00000482, 0x0007000C, 0x00000006, 0x0000049C, 0x00000001, 0x0000001A, 0x0000049B, 
-0x0000013A, 0x00050081, 0x00000006, 0x0000049D, 0x0000049C, 0x000000DF, 0x00050088, 0x00000006, 
-0x0000049E, 0x0000049A, 0x0000049D, 0x0004003D, 0x00000006, 0x0000049F, 0x00000493, 0x00050085, 
-0x00000006, 0x000004A0, 0x0000049F, 0x0000049E, 0x0003003E, 0x00000493, 0x000004A0, 0x0004003D, 
-0x00000006, 0x000004A1, 0x00000493, 0x0008000C, 0x00000006, 0x000004A2, 0x00000001, 0x0000002B, 
-0x000004A1, 0x00000102, 0x000000DF, 0x0003003E, 0x00000447, 0x000004A2, 0x000200F9, 0x00000477, 
-0x000200F8, 0x000004A3, 0x00050041, 0x0000000D, 0x000004A5, 0x000000D5, 0x00000210, 0x0004003D, 
-0x0000000C, 0x000004A6, 0x000004A5, 0x00050041, 0x00000013, 0x000004A7, 0x00000433, 0x00000216, 
-0x0004003D, 0x00000012, 0x000004A8, 0x000004A7, 0x0008004F, 0x0000000C, 0x000004A9, 0x000004A8, 
-0x000004A8, 0x00000000, 0x00000001, 0x00000002, 0x00050094, 0x00000006, 0x000004AA, 0x000004A6, 
-0x000004A9, 0x0003003E, 0x000004A4, 0x000004AA, 0x00050041, 0x00000351, 0x000004AC, 0x000002CB, 
-0x000004AB, 0x0004003D, 0x00000083, 0x000004AD, 0x000004AC, 0x000500AD, 0x000001EF, 0x000004AE, 
-0x000004AD, 0x000001F3, 0x0004003D, 0x00000006, 0x000004AF, 0x000004A4, 0x000500BA, 0x000001EF, 
-0x000004B0, 0x000004AF, 0x00000102, 0x000500A7, 0x000001EF, 0x000004B1, 0x000004AE, 0x000004B0, 
-0x000300F7, 0x000004B3, 0x00000000, 0x000400FA, 0x000004B1, 0x000004B2, 0x000004C4, 0x000200F8, 
-0x000004B2, 0x0004003D, 0x0000000C, 0x000004B6, 0x000000D4, 0x0003003E, 0x000004B5, 0x000004B6, 
-0x00050039, 0x00000083, 0x000004B7, 0x000000AC, 0x000004B5, 0x0003003E, 0x000004B4, 0x000004B7, 
-0x0004003D, 0x0000000C, 0x000004B9, 0x000000D4, 0x0003003E, 0x000004B8, 0x000004B9, 0x0004003D, 
-0x00000083, 0x000004BB, 0x000004B4, 0x0003003E, 0x000004BA, 0x000004BB, 0x00050041, 0x00000013, 
-0x000004BD, 0x00000433, 0x00000216, 0x0004003D, 0x00000012, 0x000004BE, 0x000004BD, 0x0008004F, 
-0x0000000C, 0x000004BF, 0x000004BE, 0x000004BE, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 
-0x000004BC, 0x000004BF, 0x00050041, 0x0000000D, 0x000004C1, 0x000000D5, 0x00000210, 0x0004003D, 
-0x0000000C, 0x000004C2, 0x000004C1, 0x0003003E, 0x000004C0, 0x000004C2, 0x00080039, 0x00000006, 
-0x000004C3, 0x000000B3, 0x000004B8, 0x000004BA, 0x000004BC, 0x000004C0, 0x0003003E, 0x00000447, 
-0x000004C3, 0x000200F9, 0x000004B3, 0x000200F8, 0x000004C4, 0x0003003E, 0x00000447, 0x000000DF, 
-0x000200F9, 0x000004B3, 0x000200F8, 0x000004B3, 0x000200F9, 0x00000477, 0x000200F8, 0x00000477, 
-0x000200F9, 0x0000044C, 0x000200F8, 0x0000044C, 0x00050041, 0x00000013, 0x000004C6, 0x00000433, 
-0x00000216, 0x0004003D, 0x00000012, 0x000004C7, 0x000004C6, 0x0008004F, 0x0000000C, 0x000004C8, 
-0x000004C7, 0x000004C7, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x000004C5, 0x000004C8, 
-0x00050041, 0x00000013, 0x000004CA, 0x00000433, 0x000001F3, 0x0004003D, 0x00000012, 0x000004CB, 
-0x000004CA, 0x0008004F, 0x0000000C, 0x000004CC, 0x000004CB, 0x000004CB, 0x00000000, 0x00000001, 
-0x00000002, 0x00050041, 0x00000007, 0x000004CD, 0x00000433, 0x0000043F, 0x0004003D, 0x00000006, 
-0x000004CE, 0x000004CD, 0x0005008E, 0x0000000C, 0x000004CF, 0x000004CC, 0x000004CE, 0x0003003E, 
-0x000004C9, 0x000004CF, 0x0004003D, 0x0000000C, 0x000004D1, 0x000004C5, 0x00050041, 0x0000000D, 
-0x000004D2, 0x000000D5, 0x00000366, 0x0004003D, 0x0000000C, 0x000004D3, 0x000004D2, 0x00050081, 
-0x0000000C, 0x000004D4, 0x000004D1, 0x000004D3, 0x0006000C, 0x0000000C, 0x000004D5, 0x00000001, 
-0x00000045, 0x000004D4, 0x0003003E, 0x000004D0, 0x000004D5, 0x00050041, 0x0000000D, 0x000004D7, 
-0x000000D5, 0x00000210, 0x0004003D, 0x0000000C, 0x000004D8, 0x000004D7, 0x0004003D, 0x0000000C, 
-0x000004D9, 0x000004C5, 0x00050094, 0x00000006, 0x000004DA, 0x000004D8, 0x000004D9, 0x0003003E, 
-0x000004DB, 0x000004DA, 0x00050039, 0x00000006, 0x000004DC, 0x00000019, 0x000004DB, 0x0003003E, 
-0x000004D6, 0x000004DC, 0x00050041, 0x0000000D, 0x000004DE, 0x000000D5, 0x00000366, 0x0004003D, 
-0x0000000C, 0x000004DF, 0x000004DE, 0x0004003D, 0x0000000C, 0x000004E0, 0x000004C5, 0x00050081, 
-0x0000000C, 0x000004E1, 0x000004DF, 0x000004E0, 0x0006000C, 0x0000000C, 0x000004E2, 0x00000001, 
-0x00000045, 0x000004E1, 0x0003003E, 0x000004DD, 0x000004E2, 0x00050041, 0x0000000D, 0x000004E4, 
-0x000000D5, 0x00000210, 0x0004003D, 0x0000000C, 0x000004E5, 0x000004E4, 0x00050041, 0x0000000D, 
-0x000004E6, 0x000000D5, 0x00000366, 0x0004003D, 0x0000000C, 0x000004E7, 0x000004E6, 0x00050094, 
-0x00000006, 0x000004E8, 0x000004E5, 0x000004E7, 0x0003003E, 0x000004E9, 0x000004E8, 0x00050039, 
-0x00000006, 0x000004EA, 0x00000046, 0x000004E9, 0x0003003E, 0x000004E3, 0x000004EA, 0x0004003D, 
-0x00000006, 0x000004EC, 0x000004E3, 0x0003003E, 0x000004EB, 0x000004EC, 0x0004003D, 0x00000006, 
-0x000004EF, 0x000004D6, 0x0003003E, 0x000004EE, 0x000004EF, 0x00050039, 0x00000006, 0x000004F0, 
-0x00000019, 0x000004EE, 0x0003003E, 0x000004ED, 0x000004F0, 0x00050041, 0x0000000D, 0x000004F2, 
-0x000000D5, 0x00000210, 0x0004003D, 0x0000000C, 0x000004F3, 0x000004F2, 0x0004003D, 0x0000000C, 
-0x000004F4, 0x000004DD, 0x00050094, 0x00000006, 0x000004F5, 0x000004F3, 0x000004F4, 0x0003003E, 
-0x000004F6, 0x000004F5, 0x00050039, 0x00000006, 0x000004F7, 0x00000019, 0x000004F6, 0x0003003E, 
-0x000004F1, 0x000004F7, 0x0004003D, 0x0000000C, 0x000004F9, 0x000004C5, 0x0004003D, 0x0000000C, 
-0x000004FA, 0x000004DD, 0x00050094, 0x00000006, 0x000004FB, 0x000004F9, 0x000004FA, 0x0003003E, 
-0x000004FC, 0x000004FB, 0x00050039, 0x00000006, 0x000004FD, 0x00000019, 0x000004FC, 0x0003003E, 
-0x000004F8, 0x000004FD, 0x0004003D, 0x000000B5, 0x000004FF, 0x000000D5, 0x0004003D, 0x00000006, 
-0x00000501, 0x000004EB, 0x0003003E, 0x00000500, 0x00000501, 0x0004003D, 0x00000006, 0x00000503, 
-0x000004ED, 0x0003003E, 0x00000502, 0x00000503, 0x0004003D, 0x00000006, 0x00000505, 0x000004F8, 
-0x0003003E, 0x00000504, 0x00000505, 0x00080039, 0x0000000C, 0x00000506, 0x000000C6, 0x000004FF, 
-0x00000500, 0x00000502, 0x00000504, 0x0003003E, 0x000004FE, 0x00000506, 0x0004003D, 0x000000B5, 
-0x00000508, 0x000000D5, 0x0004003D, 0x000000B6, 0x00000509, 0x00000433, 0x0004003D, 0x0000000C, 
-0x0000050A, 0x000004DD, 0x0004003D, 0x00000006, 0x0000050C, 0x000004EB, 0x0003003E, 0x0000050B, 
-0x0000050C, 0x0004003D, 0x00000006, 0x0000050E, 0x000004ED, 0x0003003E, 0x0000050D, 0x0000050E, 
-0x0004003D, 0x00000006, 0x00000510, 0x000004F1, 0x0003003E, 0x0000050F, 0x00000510, 0x0004003D, 
-0x00000006, 0x00000512, 0x000004F8, 0x0003003E, 0x00000511, 0x00000512, 0x000B0039, 0x0000000C, 
-0x00000513, 0x000000CF, 0x00000508, 0x00000509, 0x0000050A, 0x0000050B, 0x0000050D, 0x0000050F, 
-0x00000511, 0x0003003E, 0x00000507, 0x00000513, 0x0004003D, 0x0000000C, 0x00000515, 0x000004FE, 
-0x0004003D, 0x0000000C, 0x00000516, 0x00000507, 0x00050081, 0x0000000C, 0x00000517, 0x00000515, 
-0x00000516, 0x0003003E, 0x00000514, 0x00000517, 0x0004003D, 0x0000000C, 0x00000518, 0x00000514, 
-0x0004003D, 0x0000000C, 0x00000519, 0x000004C9, 0x00050085, 0x0000000C, 0x0000051A, 0x00000518, 
-0x00000519, 0x0004003D, 0x00000006, 0x0000051B, 0x00000447, 0x0004003D, 0x00000006, 0x0000051C, 
-0x000004ED, 0x00050085, 0x00000006, 0x0000051D, 0x0000051B, 0x0000051C, 0x0004003D, 0x00000006, 
-0x0000051F, 0x000004ED, 0x0003003E, 0x0000051E, 0x0000051F, 0x00050041, 0x00000007, 0x00000521, 
-0x000000D5, 0x0000022E, 0x0004003D, 0x00000006, 0x00000522, 0x00000521, 0x0003003E, 0x00000520, 
-0x00000522, 0x00060039, 0x00000006, 0x00000523, 0x0000003D, 0x0000051E, 0x00000520, 0x00050085, 
-0x00000006, 0x00000524, 0x0000051D, 0x00000523, 0x0005008E, 0x0000000C, 0x00000525, 0x0000051A, 
-0x00000524, 0x0004003D, 0x0000000C, 0x00000526, 0x00000425, 0x00050081, 0x0000000C, 0x00000527, 
-0x00000526, 0x00000525, 0x0003003E, 0x00000425, 0x00000527, 0x000200F9, 0x0000042B, 0x000200F8, 
-0x0000042B, 0x0004003D, 0x00000083, 0x00000528, 0x00000427, 0x00050080, 0x00000083, 0x00000529, 
-0x00000528, 0x00000205, 0x0003003E, 0x00000427, 0x00000529, 0x000200F9, 0x00000428, 0x000200F8, 
-0x0000042A, 0x0004003D, 0x0000000C, 0x0000052A, 0x00000425, 0x000200FE, 0x0000052A, 0x00010038, 
-0x00050036, 0x0000000C, 0x000000DB, 0x00000000, 0x000000D2, 0x00030037, 0x0000000D, 0x000000D8, 
-0x00030037, 0x0000000D, 0x000000D9, 0x00030037, 0x000000D1, 0x000000DA, 0x000200F8, 0x000000DC, 
-0x0004003B, 0x0000000D, 0x0000052D, 0x00000007, 0x0004003B, 0x0000000D, 0x00000537, 0x00000007, 
-0x0004003B, 0x0000000D, 0x00000538, 0x00000007, 0x0004003B, 0x00000007, 0x0000053A, 0x00000007, 
-0x0004003B, 0x00000007, 0x0000053D, 0x00000007, 0x0004003B, 0x0000000D, 0x00000541, 0x00000007, 
-0x0004003B, 0x0000000D, 0x00000549, 0x00000007, 0x0004003B, 0x00000084, 0x0000054F, 0x00000007, 
-0x0004003B, 0x0000000D, 0x00000553, 0x00000007, 0x0004003B, 0x0000000D, 0x0000055E, 0x00000007, 
-0x0004003D, 0x0000052F, 0x00000532, 0x00000531, 0x00050041, 0x0000000D, 0x00000533, 0x000000DA, 
-0x00000210, 0x0004003D, 0x0000000C, 0x00000534, 0x00000533, 0x00050057, 0x00000012, 0x00000535, 
-0x00000532, 0x00000534, 0x0008004F, 0x0000000C, 0x00000536, 0x00000535, 0x00000535, 0x00000000, 
-0x00000001, 0x00000002, 0x0003003E, 0x0000052D, 0x00000536, 0x0004003D, 0x0000000C, 0x00000539, 
-0x000000D8, 0x0003003E, 0x00000538, 0x00000539, 0x00050041, 0x00000007, 0x0000053B, 0x000000DA, 
-0x00000260, 0x0004003D, 0x00000006, 0x0000053C, 0x0000053B, 0x0003003E, 0x0000053A, 0x0000053C, 
-0x00050041, 0x00000007, 0x0000053E, 0x000000DA, 0x00000216, 0x0004003D, 0x00000006, 0x0000053F, 
-0x0000053E, 0x0003003E, 0x0000053D, 0x0000053F, 0x00070039, 0x0000000C, 0x00000540, 0x0000006D, 
-0x00000538, 0x0000053A, 0x0000053D, 0x0003003E, 0x00000537, 0x00000540, 0x0004003D, 0x0000000C, 
-0x00000542, 0x00000537, 0x00060050, 0x0000000C, 0x00000543, 0x000000DF, 0x000000DF, 0x000000DF, 
-0x00050083, 0x0000000C, 0x00000544, 0x00000543, 0x00000542, 0x00050041, 0x00000007, 0x00000545, 
-0x000000DA, 0x00000205, 0x0004003D, 0x00000006, 0x00000546, 0x00000545, 0x00050083, 0x00000006, 
-0x00000547, 0x000000DF, 0x00000546, 0x0005008E, 0x0000000C, 0x00000548, 0x00000544, 0x00000547, 
-0x0003003E, 0x00000541, 0x00000548, 0x00050041, 0x00000013, 0x0000054A, 0x000000DA, 0x000001F3, 
-0x0004003D, 0x00000012, 0x0000054B, 0x0000054A, 0x0008004F, 0x0000000C, 0x0000054C, 0x0000054B, 
-0x0000054B, 0x00000000, 0x00000001, 0x00000002, 0x0004003D, 0x0000000C, 0x0000054D, 0x0000052D, 
-0x00050085, 0x0000000C, 0x0000054E, 0x0000054C, 0x0000054D, 0x0003003E, 0x00000549, 0x0000054E, 
-0x00050041, 0x00000351, 0x00000551, 0x000002CB, 0x00000550, 0x0004003D, 0x00000083, 0x00000552, 
-0x00000551, 0x0003003E, 0x0000054F, 0x00000552, 0x0004003D, 0x0000052F, 0x00000555, 0x00000554, 
-0x0004003D, 0x0000000C, 0x00000556, 0x000000D9, 0x00050041, 0x00000007, 0x00000557, 0x000000DA, 
-0x0000043F, 0x0004003D, 0x00000006, 0x00000558, 0x00000557, 0x0004003D, 0x00000083, 0x00000559, 
-0x0000054F, 0x0004006F, 0x00000006, 0x0000055A, 0x00000559, 0x00050085, 0x00000006, 0x0000055B, 
-0x00000558, 0x0000055A, 0x00070058, 0x00000012, 0x0000055C, 0x00000555, 0x00000556, 0x00000002, 
-0x0000055B, 0x0008004F, 0x0000000C, 0x0000055D, 0x0000055C, 0x0000055C, 0x00000000, 0x00000001, 
-0x00000002, 0x0003003E, 0x00000553, 0x0000055D, 0x0004003D, 0x0000000C, 0x0000055F, 0x00000553, 
-0x0004003D, 0x0000000C, 0x00000560, 0x00000537, 0x00060041, 0x00000007, 0x00000561, 0x000000DA, 
-0x00000350, 0x00000244, 0x0004003D, 0x00000006, 0x00000562, 0x00000561, 0x0005008E, 0x0000000C, 
-0x00000563, 0x00000560, 0x00000562, 0x00060041, 0x00000007, 0x00000565, 0x000000DA, 0x00000350, 
-0x00000564, 0x0004003D, 0x00000006, 0x00000566, 0x00000565, 0x00060050, 0x0000000C, 0x00000567, 
-0x00000566, 0x00000566, 0x00000566, 0x00050081, 0x0000000C, 0x00000568, 0x00000563, 0x00000567, 
-0x00050085, 0x0000000C, 0x00000569, 0x0000055F, 0x00000568, 0x0003003E, 0x0000055E, 0x00000569, 
-0x0004003D, 0x0000000C, 0x0000056A, 0x00000541, 0x0004003D, 0x0000000C, 0x0000056B, 0x00000549, 
-0x00050085, 0x0000000C, 0x0000056C, 0x0000056A, 0x0000056B, 0x0004003D, 0x0000000C, 0x0000056D, 
-0x0000055E, 0x00050081, 0x0000000C, 0x0000056E, 0x0000056C, 0x0000056D, 0x000200FE, 0x0000056E, 
-0x00010038, 
+0x00050005, 0x000005B5, 0x6574616D, 0x6C616972, 0x00000000, 0x00040005, 0x000005B6, 0x6867696C, 
+0x00000074, 0x00030005, 0x000005B7, 0x00000068, 0x00030005, 0x000005B8, 0x00566F4E, 0x00030005, 
+0x000005B9, 0x004C6F4E, 0x00030005, 0x000005BA, 0x00486F4E, 0x00030005, 0x000005BB, 0x00486F4C, 
+0x00040005, 0x000005BE, 0x61726170, 0x0000006D, 0x00040005, 0x000005C0, 0x61726170, 0x0000006D, 
+0x00040005, 0x000005C2, 0x61726170, 0x0000006D, 0x00040005, 0x000005C4, 0x61726170, 0x0000006D, 
+0x00040005, 0x000005C6, 0x61726170, 0x0000006D, 0x00040005, 0x000005C8, 0x61726170, 0x0000006D, 
+0x00040005, 0x000005CA, 0x61726170, 0x0000006D, 0x000A0005, 0x00000478, 0x706D6F43, 0x4D657475, 
+0x6F726369, 0x64616853, 0x6E69776F, 0x31662867, 0x3B31663B, 0x00000000, 0x00030005, 0x000005CE, 
+0x004C6F4E, 0x00050005, 0x000005CF, 0x69736976, 0x696C6962, 0x00007974, 0x00050005, 0x000005D6, 
+0x72657061, 0x65727574, 0x00000000, 0x00040005, 0x000005DA, 0x61726170, 0x0000006D, 0x00050005, 
+0x000005DC, 0x7263696D, 0x6168536F, 0x00776F64, 0x00100005, 0x0000054F, 0x53464350, 0x6F646168, 
+0x72694477, 0x69746365, 0x6C616E6F, 0x6867694C, 0x41732874, 0x763B3132, 0x663B3466, 0x66763B31, 
+0x66763B33, 0x66763B33, 0x31693B33, 0x0000003B, 0x00050005, 0x000005E1, 0x64616873, 0x614D776F, 
+0x00000070, 0x00060005, 0x000005E2, 0x64616873, 0x6F43776F, 0x7364726F, 0x00000000, 0x00050005, 
+0x000005E3, 0x61527675, 0x73756964, 0x00000000, 0x00060005, 0x000005E4, 0x6867696C, 0x72694474, 
+0x69746365, 0x00006E6F, 0x00040005, 0x000005E5, 0x6D726F6E, 0x00006C61, 0x00040005, 0x000005E6, 
+0x6F507377, 0x00000073, 0x00060005, 0x000005E7, 0x63736163, 0x49656461, 0x7865646E, 0x00000000, 
+0x00040005, 0x000005EA, 0x61726170, 0x0000006D, 0x00040005, 0x000005EC, 0x61726170, 0x0000006D, 
+0x00040005, 0x000005EE, 0x61726170, 0x0000006D, 0x00040005, 0x000005F1, 0x73616962, 0x00000000, 
+0x00030005, 0x000005F2, 0x006D7573, 0x00040005, 0x000005F4, 0x61726170, 0x0000006D, 0x00040005, 
+0x000005F8, 0x73696F6E, 0x00000065, 0x00090005, 0x000005F9, 0x53766E69, 0x72617571, 0x6F6F5265, 
+0x6D615374, 0x73656C70, 0x6E756F43, 0x00000074, 0x00050005, 0x000005FF, 0x6F6F6C66, 0x50646572, 
+0x0000736F, 0x00040005, 0x00000602, 0x61726170, 0x0000006D, 0x00040005, 0x00000605, 0x61726170, 
+0x0000006D, 0x00040005, 0x0000060A, 0x65646E69, 0x00000078, 0x00030005, 0x0000060B, 0x00000069, 
+0x00040005, 0x00000614, 0x61726170, 0x0000006D, 0x00040005, 0x00000619, 0x61726170, 0x0000006D, 
+0x00040005, 0x0000061B, 0x61726170, 0x0000006D, 0x00040005, 0x0000061D, 0x61726170, 0x0000006D, 
+0x00040005, 0x00000622, 0x7366666F, 0x00007465, 0x00030005, 0x00000631, 0x0000007A, 0x00080005, 
+0x000005A8, 0x66666944, 0x28657375, 0x663B3166, 0x31663B31, 0x3B31663B, 0x00000000, 0x00050005, 
+0x0000063E, 0x67756F72, 0x73656E68, 0x00000073, 0x00030005, 0x0000063F, 0x00566F4E, 0x00030005, 
+0x00000640, 0x004C6F4E, 0x00030005, 0x00000641, 0x00486F4C, 0x00040005, 0x00000644, 0x61726170, 
+0x0000006D, 0x00040005, 0x00000646, 0x61726170, 0x0000006D, 0x00040005, 0x00000648, 0x61726170, 
+0x0000006D, 0x00040005, 0x0000064A, 0x61726170, 0x0000006D, 0x00230005, 0x000005BD, 0x746F7349, 
+0x69706F72, 0x626F4C63, 0x74732865, 0x74637572, 0x74614D2D, 0x61697265, 0x66762D6C, 0x31662D34, 
+0x2D31662D, 0x662D3166, 0x66762D31, 0x66762D33, 0x31662D33, 0x3366762D, 0x2D31662D, 0x2D336676, 
+0x2D336676, 0x31326676, 0x7274733B, 0x2D746375, 0x6867694C, 0x66762D74, 0x66762D34, 0x66762D34, 
+0x31662D34, 0x2D31662D, 0x662D3166, 0x763B3131, 0x663B3366, 0x31663B31, 0x3B31663B, 0x003B3166, 
+0x00050005, 0x0000064D, 0x6574616D, 0x6C616972, 0x00000000, 0x00040005, 0x0000064E, 0x6867696C, 
+0x00000074, 0x00030005, 0x0000064F, 0x00000068, 0x00030005, 0x00000650, 0x00566F4E, 0x00030005, 
+0x00000651, 0x004C6F4E, 0x00030005, 0x00000652, 0x00486F4E, 0x00030005, 0x00000653, 0x00486F4C, 
+0x00040005, 0x00000656, 0x61726170, 0x0000006D, 0x00040005, 0x00000659, 0x61726170, 0x0000006D, 
+0x00040005, 0x0000065B, 0x61726170, 0x0000006D, 0x00040005, 0x0000065E, 0x61726170, 0x0000006D, 
+0x00030005, 0x00000661, 0x00000044, 0x00040005, 0x00000663, 0x61726170, 0x0000006D, 0x00040005, 
+0x00000666, 0x61726170, 0x0000006D, 0x00040005, 0x00000668, 0x61726170, 0x0000006D, 0x00030005, 
+0x0000066B, 0x00000056, 0x00040005, 0x0000066D, 0x61726170, 0x0000006D, 0x00040005, 0x00000670, 
+0x61726170, 0x0000006D, 0x00030005, 0x00000673, 0x00000046, 0x00090005, 0x000005E9, 0x53746547, 
+0x6F646168, 0x61694277, 0x66762873, 0x66763B33, 0x31693B33, 0x0000003B, 0x00060005, 0x0000067A, 
+0x6867696C, 0x72694474, 0x69746365, 0x00006E6F, 0x00040005, 0x0000067B, 0x6D726F6E, 0x00006C61, 
+0x00050005, 0x0000067C, 0x64616873, 0x6E49776F, 0x00786564, 0x00040005, 0x00000681, 0x426E696D, 
+0x00736169, 0x00040005, 0x0000068A, 0x73616962, 0x00000000, 0x00050005, 0x000005F3, 0x73696F4E, 
+0x66762865, 0x00003B32, 0x00030005, 0x0000068D, 0x00006F63, 0x00060005, 0x00000601, 0x646E6152, 
+0x76286D6F, 0x693B3366, 0x00003B31, 0x00040005, 0x00000699, 0x64656573, 0x00000000, 0x00030005, 
+0x0000069A, 0x00000069, 0x00040005, 0x000006A3, 0x64656573, 0x00000034, 0x00040005, 0x000006A5, 
+0x61726170, 0x0000006D, 0x000A0005, 0x00000613, 0x65746E69, 0x61656C72, 0x47646576, 0x69646172, 
+0x4E746E65, 0x6573696F, 0x32667628, 0x0000003B, 0x00060005, 0x000006A8, 0x69736F70, 0x6E6F6974, 
+0x7263735F, 0x006E6565, 0x00040005, 0x000006AE, 0x6967616D, 0x00000063, 0x00090005, 0x00000618, 
+0x65676F56, 0x7369446C, 0x6D61536B, 0x28656C70, 0x663B3169, 0x31663B31, 0x0000003B, 0x00050005, 
+0x000006B9, 0x706D6173, 0x6E49656C, 0x00786564, 0x00090005, 0x000006BA, 0x53766E69, 0x72617571, 
+0x6F6F5265, 0x6D615374, 0x73656C70, 0x6E756F43, 0x00000074, 0x00030005, 0x000006BB, 0x00696870, 
+0x00050005, 0x000006BE, 0x646C6F47, 0x6E416E65, 0x00656C67, 0x00030005, 0x000006C5, 0x00000072, 
+0x00040005, 0x000006CC, 0x74656874, 0x00000061, 0x00040005, 0x000006CF, 0x656E6973, 0x00000000, 
+0x00040005, 0x000006D2, 0x69736F63, 0x0000656E, 0x00080005, 0x00000643, 0x425F6446, 0x656C7275, 
+0x31662879, 0x3B31663B, 0x663B3166, 0x00003B31, 0x00050005, 0x000006DA, 0x67756F72, 0x73656E68, 
+0x00000073, 0x00030005, 0x000006DB, 0x00566F4E, 0x00030005, 0x000006DC, 0x004C6F4E, 0x00030005, 
+0x000006DD, 0x00486F4C, 0x00030005, 0x000006E6, 0x00303966, 0x00040005, 0x000006E8, 0x61726170, 
+0x0000006D, 0x00040005, 0x000006E9, 0x61726170, 0x0000006D, 0x00040005, 0x000006EB, 0x61726170, 
+0x0000006D, 0x00060005, 0x000006EE, 0x6867696C, 0x61635374, 0x72657474, 0x00000000, 0x00040005, 
+0x000006EF, 0x61726170, 0x0000006D, 0x00040005, 0x000006F0, 0x61726170, 0x0000006D, 0x00040005, 
+0x000006F2, 0x61726170, 0x0000006D, 0x00050005, 0x000006F5, 0x77656976, 0x74616353, 0x00726574, 
+0x00090005, 0x00000655, 0x74736964, 0x75626972, 0x6E6F6974, 0x3B316628, 0x763B3166, 0x763B3366, 
+0x003B3366, 0x00050005, 0x000006FD, 0x67756F72, 0x73656E68, 0x00000073, 0x00030005, 0x000006FE, 
+0x00486F4E, 0x00030005, 0x000006FF, 0x00000068, 0x00040005, 0x00000700, 0x6D726F6E, 0x00006C61, 
+0x00040005, 0x00000703, 0x61726170, 0x0000006D, 0x00040005, 0x00000705, 0x61726170, 0x0000006D, 
+0x00040005, 0x00000707, 0x61726170, 0x0000006D, 0x00040005, 0x00000709, 0x61726170, 0x0000006D, 
+0x00080005, 0x00000662, 0x69736976, 0x696C6962, 0x66287974, 0x31663B31, 0x3B31663B, 0x00000000, 
+0x00050005, 0x0000070D, 0x67756F72, 0x73656E68, 0x00000073, 0x00030005, 0x0000070E, 0x00566F4E, 
+0x00030005, 0x0000070F, 0x004C6F4E, 0x00040005, 0x00000712, 0x61726170, 0x0000006D, 0x00040005, 
+0x00000714, 0x61726170, 0x0000006D, 0x00040005, 0x00000716, 0x61726170, 0x0000006D, 0x00060005, 
+0x0000066C, 0x73657266, 0x286C656E, 0x3B336676, 0x003B3166, 0x00030005, 0x0000071A, 0x00003066, 
+0x00030005, 0x0000071B, 0x00486F4C, 0x00040005, 0x00000723, 0x61726170, 0x0000006D, 0x00030005, 
+0x00000725, 0x00303966, 0x00040005, 0x00000727, 0x61726170, 0x0000006D, 0x00040005, 0x00000729, 
+0x61726170, 0x0000006D, 0x00040005, 0x0000072B, 0x61726170, 0x0000006D, 0x00050005, 0x000006A4, 
+0x646E6152, 0x76286D6F, 0x003B3466, 0x00040005, 0x0000072F, 0x64656573, 0x00000034, 0x00050005, 
+0x00000736, 0x5F746F64, 0x646F7270, 0x00746375, 0x00070005, 0x000006E7, 0x63535F46, 0x63696C68, 
+0x3166286B, 0x3B31663B, 0x003B3166, 0x00030005, 0x0000073B, 0x00000075, 0x00030005, 0x0000073C, 
+0x00003066, 0x00030005, 0x0000073D, 0x00303966, 0x00080005, 0x00000702, 0x47475F44, 0x31662858, 
+0x3B31663B, 0x3B336676, 0x3B336676, 0x00000000, 0x00050005, 0x00000748, 0x67756F72, 0x73656E68, 
+0x00000073, 0x00030005, 0x00000749, 0x00486F4E, 0x00030005, 0x0000074A, 0x0000006E, 0x00030005, 
+0x0000074B, 0x00000068, 0x00030005, 0x00000750, 0x0048784E, 0x00030005, 0x00000754, 0x00000061, 
+0x00030005, 0x0000075E, 0x0000006B, 0x00030005, 0x00000763, 0x00000064, 0x000A0005, 0x00000711, 
+0x6D535F56, 0x47687469, 0x6F435847, 0x6C657272, 0x64657461, 0x3B316628, 0x663B3166, 0x00003B31, 
+0x00030005, 0x00000767, 0x00566F4E, 0x00030005, 0x00000768, 0x004C6F4E, 0x00030005, 0x00000769, 
+0x00000061, 0x00030005, 0x0000076E, 0x00003261, 0x00040005, 0x0000077C, 0x4C584747, 0x00000000, 
+0x00040005, 0x0000078A, 0x56584747, 0x00000000, 0x00080005, 0x00000726, 0x63535F46, 0x63696C68, 
+0x6676286B, 0x31663B33, 0x3B31663B, 0x00000000, 0x00030005, 0x0000078F, 0x00003066, 0x00030005, 
+0x00000790, 0x00303966, 0x00030005, 0x00000791, 0x00486F56, 0x00040005, 0x0000079B, 0x61726170, 
+0x0000006D, 0x00050005, 0x0000079A, 0x35776F70, 0x3B316628, 0x00000000, 0x00030005, 0x0000079F, 
+0x00000078, 0x00030005, 0x000007A4, 0x00003278, 0x00040048, 0x00000007, 0x00000000, 0x00000005, 
+0x00050048, 0x00000007, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000007, 0x00000000, 
+0x00000007, 0x00000010, 0x00030047, 0x00000007, 0x00000002, 0x00040047, 0x00000003, 0x00000022, 
+0x00000000, 0x00040047, 0x00000003, 0x00000021, 0x00000000, 0x00040047, 0x0000000F, 0x00000006, 
+0x00000040, 0x00040048, 0x00000010, 0x00000000, 0x00000005, 0x00050048, 0x00000010, 0x00000000, 
+0x00000023, 0x00000000, 0x00050048, 0x00000010, 0x00000000, 0x00000007, 0x00000010, 0x00030047, 
+0x00000010, 0x00000002, 0x00040047, 0x0000000C, 0x00000022, 0x00000000, 0x00040047, 0x0000000C, 
+0x00000021, 0x00000001, 0x00050048, 0x00000014, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 
+0x00000014, 0x00000001, 0x00000023, 0x00000010, 0x00050048, 0x00000014, 0x00000002, 0x00000023, 
+0x00000014, 0x00050048, 0x00000014, 0x00000003, 0x00000023, 0x00000018, 0x00050048, 0x00000014, 
+0x00000004, 0x00000023, 0x0000001C, 0x00050048, 0x00000014, 0x00000005, 0x00000023, 0x00000020, 
+0x00050048, 0x00000014, 0x00000006, 0x00000023, 0x00000024, 0x00050048, 0x00000014, 0x00000007, 
+0x00000023, 0x00000028, 0x00050048, 0x00000014, 0x00000008, 0x00000023, 0x0000002C, 0x00050048, 
+0x00000014, 0x00000009, 0x00000023, 0x00000030, 0x00050048, 0x00000014, 0x0000000A, 0x00000023, 
+0x00000034, 0x00050048, 0x00000014, 0x0000000B, 0x00000023, 0x00000038, 0x00050048, 0x00000014, 
+0x0000000C, 0x00000023, 0x0000003C, 0x00030047, 0x00000014, 0x00000002, 0x00040047, 0x00000013, 
+0x00000022, 0x00000001, 0x00040047, 0x00000013, 0x00000021, 0x00000006, 0x00050048, 0x00000019, 
+0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000019, 0x00000001, 0x00000023, 0x00000010, 
+0x00050048, 0x00000019, 0x00000002, 0x00000023, 0x00000020, 0x00050048, 0x00000019, 0x00000003, 
+0x00000023, 0x00000030, 0x00050048, 0x00000019, 0x00000004, 0x00000023, 0x00000034, 0x00050048, 
+0x00000019, 0x00000005, 0x00000023, 0x00000038, 0x00050048, 0x00000019, 0x00000006, 0x00000023, 
+0x0000003C, 0x00040047, 0x0000001B, 0x00000006, 0x00000040, 0x00040047, 0x0000001C, 0x00000006, 
+0x00000010, 0x00050048, 0x0000001D, 0x00000000, 0x00000023, 0x00000000, 0x00040048, 0x0000001D, 
+0x00000001, 0x00000005, 0x00050048, 0x0000001D, 0x00000001, 0x00000023, 0x00000800, 0x00050048, 
+0x0000001D, 0x00000001, 0x00000007, 0x00000010, 0x00040048, 0x0000001D, 0x00000002, 0x00000005, 
+0x00050048, 0x0000001D, 0x00000002, 0x00000023, 0x00000900, 0x00050048, 0x0000001D, 0x00000002, 
+0x00000007, 0x00000010, 0x00040048, 0x0000001D, 0x00000003, 0x00000005, 0x00050048, 0x0000001D, 
+0x00000003, 0x00000023, 0x00000940, 0x00050048, 0x0000001D, 0x00000003, 0x00000007, 0x00000010, 
+0x00040048, 0x0000001D, 0x00000004, 0x00000005, 0x00050048, 0x0000001D, 0x00000004, 0x00000023, 
+0x00000980, 0x00050048, 0x0000001D, 0x00000004, 0x00000007, 0x00000010, 0x00050048, 0x0000001D, 
+0x00000005, 0x00000023, 0x000009C0, 0x00050048, 0x0000001D, 0x00000006, 0x00000023, 0x000009D0, 
+0x00050048, 0x0000001D, 0x00000007, 0x00000023, 0x00000A10, 0x00050048, 0x0000001D, 0x00000008, 
+0x00000023, 0x00000A14, 0x00050048, 0x0000001D, 0x00000009, 0x00000023, 0x00000A18, 0x00050048, 
+0x0000001D, 0x0000000A, 0x00000023, 0x00000A1C, 0x00050048, 0x0000001D, 0x0000000B, 0x00000023, 
+0x00000A20, 0x00050048, 0x0000001D, 0x0000000C, 0x00000023, 0x00000A24, 0x00050048, 0x0000001D, 
+0x0000000D, 0x00000023, 0x00000A28, 0x00050048, 0x0000001D, 0x0000000E, 0x00000023, 0x00000A2C, 
+0x00050048, 0x0000001D, 0x0000000F, 0x00000023, 0x00000A30, 0x00050048, 0x0000001D, 0x00000010, 
+0x00000023, 0x00000A34, 0x00050048, 0x0000001D, 0x00000011, 0x00000023, 0x00000A38, 0x00050048, 
+0x0000001D, 0x00000012, 0x00000023, 0x00000A3C, 0x00030047, 0x0000001D, 0x00000002, 0x00040047, 
+0x00000018, 0x00000022, 0x00000002, 0x00040047, 0x00000018, 0x00000021, 0x00000005, 0x00040047, 
+0x00000021, 0x00000022, 0x00000001, 0x00040047, 0x00000021, 0x00000021, 0x00000000, 0x00040047, 
+0x00000025, 0x00000022, 0x00000001, 0x00040047, 0x00000025, 0x00000021, 0x00000001, 0x00040047, 
+0x00000026, 0x00000022, 0x00000001, 0x00040047, 0x00000026, 0x00000021, 0x00000002, 0x00040047, 
+0x00000027, 0x00000022, 0x00000001, 0x00040047, 0x00000027, 0x00000021, 0x00000003, 0x00040047, 
+0x00000029, 0x00000022, 0x00000001, 0x00040047, 0x00000029, 0x00000021, 0x00000004, 0x00040047, 
+0x0000002A, 0x00000022, 0x00000001, 0x00040047, 0x0000002A, 0x00000021, 0x00000005, 0x00040047, 
+0x0000002B, 0x00000022, 0x00000002, 0x00040047, 0x0000002B, 0x00000021, 0x00000000, 0x00040047, 
+0x0000002F, 0x00000022, 0x00000002, 0x00040047, 0x0000002F, 0x00000021, 0x00000001, 0x00040047, 
+0x00000033, 0x00000022, 0x00000002, 0x00040047, 0x00000033, 0x00000021, 0x00000002, 0x00040047, 
+0x00000034, 0x00000022, 0x00000002, 0x00040047, 0x00000034, 0x00000021, 0x00000003, 0x00040047, 
+0x00000035, 0x00000022, 0x00000002, 0x00040047, 0x00000035, 0x00000021, 0x00000004, 0x00040047, 
+0x00000039, 0x00000006, 0x00000040, 0x00050048, 0x0000003A, 0x00000000, 0x00000023, 0x00000000, 
+0x00030047, 0x0000003A, 0x00000002, 0x00040047, 0x00000037, 0x00000022, 0x00000002, 0x00040047, 
+0x00000037, 0x00000021, 0x00000006, 0x00040047, 0x00000045, 0x00000006, 0x00000010, 0x00050048, 
+0x00000046, 0x00000000, 0x00000023, 0x00000000, 0x00050048, 0x00000046, 0x00000001, 0x00000023, 
+0x00000010, 0x00050048, 0x00000046, 0x00000002, 0x00000023, 0x00000020, 0x00030047, 0x00000046, 
+0x00000002, 0x00040047, 0x00000042, 0x00000022, 0x00000002, 0x00040047, 0x00000042, 0x00000021, 
+0x00000007, 0x00040047, 0x0000004E, 0x00000006, 0x00000010, 0x00050048, 0x0000004F, 0x00000000, 
+0x00000023, 0x00000000, 0x00030047, 0x0000004F, 0x00000002, 0x00040047, 0x0000004C, 0x00000022, 
+0x00000002, 0x00040047, 0x0000004C, 0x00000021, 0x00000008, 0x00040047, 0x00000051, 0x0000001E, 
+0x00000000, 0x00040047, 0x00000059, 0x0000001E, 0x00000000, 0x00040047, 0x00000103, 0x0000000B, 
+0x0000000F, 0x00020013, 0x00000002, 0x00030016, 0x00000004, 0x00000020, 0x00040017, 0x00000005, 
+0x00000004, 0x00000004, 0x00040018, 0x00000006, 0x00000005, 0x00000004, 0x0003001E, 0x00000007, 
+0x00000006, 0x00040020, 0x00000008, 0x00000002, 0x00000007, 0x0004003B, 0x00000008, 0x00000003, 
+0x00000002, 0x00040015, 0x00000009, 0x00000020, 0x00000001, 0x0004002B, 0x00000009, 0x0000000A, 
+0x00000000, 0x0004002B, 0x00000009, 0x0000000B, 0x00000004, 0x00040015, 0x0000000D, 0x00000020, 
+0x00000000, 0x0004002B, 0x0000000D, 0x0000000E, 0x00000004, 0x0004001C, 0x0000000F, 0x00000006, 
+0x0000000E, 0x0003001E, 0x00000010, 0x0000000F, 0x00040020, 0x00000011, 0x00000002, 0x00000010, 
+0x0004003B, 0x00000011, 0x0000000C, 0x00000002, 0x0004002B, 0x00000009, 0x00000012, 0x00000001, 
+0x000F001E, 0x00000014, 0x00000005, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 
+0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00040020, 
+0x00000015, 0x00000002, 0x00000014, 0x0004003B, 0x00000015, 0x00000013, 0x00000002, 0x0004002B, 
+0x00000009, 0x00000016, 0x00000006, 0x0004002B, 0x00000009, 0x00000017, 0x00000020, 0x0009001E, 
+0x00000019, 0x00000005, 0x00000005, 0x00000005, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 
+0x0004002B, 0x0000000D, 0x0000001A, 0x00000020, 0x0004001C, 0x0000001B, 0x00000019, 0x0000001A, 
+0x0004001C, 0x0000001C, 0x00000005, 0x0000000E, 0x0015001E, 0x0000001D, 0x0000001B, 0x0000000F, 
+0x00000006, 0x00000006, 0x00000006, 0x00000005, 0x0000001C, 0x00000004, 0x00000004, 0x00000004, 
+0x00000004, 0x00000009, 0x00000009, 0x00000009, 0x00000009, 0x00000004, 0x00000004, 0x00000004, 
+0x00000009, 0x00040020, 0x0000001E, 0x00000002, 0x0000001D, 0x0004003B, 0x0000001E, 0x00000018, 
+0x00000002, 0x0004002B, 0x00000009, 0x0000001F, 0x00000002, 0x0004002B, 0x00000009, 0x00000020, 
+0x00000005, 0x00090019, 0x00000022, 0x00000004, 0x00000001, 0x00000000, 0x00000000, 0x00000000, 
+0x00000001, 0x00000000, 0x0003001B, 0x00000023, 0x00000022, 0x00040020, 0x00000024, 0x00000000, 
+0x00000023, 0x0004003B, 0x00000024, 0x00000021, 0x00000000, 0x0004003B, 0x00000024, 0x00000025, 
+0x00000000, 0x0004003B, 0x00000024, 0x00000026, 0x00000000, 0x0004003B, 0x00000024, 0x00000027, 
+0x00000000, 0x0004002B, 0x00000009, 0x00000028, 0x00000003, 0x0004003B, 0x00000024, 0x00000029, 
+0x00000000, 0x0004003B, 0x00000024, 0x0000002A, 0x00000000, 0x00090019, 0x0000002C, 0x00000004, 
+0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x00000001, 0x00000000, 0x0003001B, 0x0000002D, 
+0x0000002C, 0x00040020, 0x0000002E, 0x00000000, 0x0000002D, 0x0004003B, 0x0000002E, 0x0000002B, 
+0x00000000, 0x00090019, 0x00000030, 0x00000004, 0x00000003, 0x00000000, 0x00000000, 0x00000000, 
+0x00000001, 0x00000000, 0x0003001B, 0x00000031, 0x00000030, 0x00040020, 0x00000032, 0x00000000, 
+0x00000031, 0x0004003B, 0x00000032, 0x0000002F, 0x00000000, 0x0004003B, 0x00000032, 0x00000033, 
+0x00000000, 0x0004003B, 0x00000024, 0x00000034, 0x00000000, 0x0004003B, 0x00000024, 0x00000035, 
+0x00000000, 0x0004002B, 0x00000009, 0x00000036, 0x00000100, 0x0004002B, 0x0000000D, 0x00000038, 
+0x00000100, 0x0004001C, 0x00000039, 0x00000019, 0x00000038, 0x0003001E, 0x0000003A, 0x00000039, 
+0x00040020, 0x0000003B, 0x00000002, 0x0000003A, 0x0004003B, 0x0000003B, 0x00000037, 0x00000002, 
+0x0004002B, 0x00000009, 0x0000003C, 0x00000010, 0x0004002B, 0x00000009, 0x0000003D, 0x00000009, 
+0x0004002B, 0x00000009, 0x0000003E, 0x00000090, 0x0004002B, 0x00000009, 0x0000003F, 0x00000018, 
+0x0004002B, 0x00000009, 0x00000040, 0x00000D80, 0x0004002B, 0x00000009, 0x00000041, 0x00000360, 
+0x00040017, 0x00000043, 0x0000000D, 0x00000004, 0x0004002B, 0x0000000D, 0x00000044, 0x00000360, 
+0x0004001C, 0x00000045, 0x00000043, 0x00000044, 0x0005001E, 0x00000046, 0x00000005, 0x00000043, 
+0x00000045, 0x00040020, 0x00000047, 0x00000002, 0x00000046, 0x0004003B, 0x00000047, 0x00000042, 
+0x00000002, 0x0004002B, 0x00000009, 0x00000048, 0x00000007, 0x0004002B, 0x00000009, 0x00000049, 
+0x00002000, 0x0004002B, 0x00000009, 0x0000004A, 0x00000008, 0x0004002B, 0x00000009, 0x0000004B, 
+0x00000400, 0x0004002B, 0x0000000D, 0x0000004D, 0x00000400, 0x0004001C, 0x0000004E, 0x00000043, 
+0x0000004D, 0x0003001E, 0x0000004F, 0x0000004E, 0x00040020, 0x00000050, 0x00000002, 0x0000004F, 
+0x0004003B, 0x00000050, 0x0000004C, 0x00000002, 0x00040017, 0x00000052, 0x00000004, 0x00000003, 
+0x00040017, 0x00000053, 0x00000004, 0x00000002, 0x00040018, 0x00000054, 0x00000052, 0x00000003, 
+0x0007001E, 0x00000055, 0x00000052, 0x00000053, 0x00000005, 0x00000052, 0x00000054, 0x00040020, 
+0x00000056, 0x00000001, 0x00000055, 0x0004003B, 0x00000056, 0x00000051, 0x00000001, 0x00040020, 
+0x00000058, 0x00000006, 0x00000004, 0x0004003B, 0x00000058, 0x00000057, 0x00000006, 0x00040020, 
+0x0000005A, 0x00000003, 0x00000005, 0x0004003B, 0x0000005A, 0x00000059, 0x00000003, 0x0004003B, 
+0x00000058, 0x0000005B, 0x00000006, 0x00030021, 0x0000005D, 0x00000002, 0x0004002B, 0x00000004, 
+0x0000005F, 0x3F800000, 0x0004002B, 0x00000004, 0x00000060, 0x3FCF1BBD, 0x00040020, 0x00000064, 
+0x00000007, 0x00000005, 0x0004002B, 0x0000000D, 0x00000065, 0x00000003, 0x00040020, 0x00000067, 
+0x00000007, 0x00000004, 0x0004002B, 0x00000009, 0x00000069, 0x0000000B, 0x00040020, 0x0000006B, 
+0x00000002, 0x00000004, 0x00020014, 0x0000006E, 0x0004002B, 0x00000004, 0x00000071, 0x00000000, 
+0x0004002B, 0x00000009, 0x00000074, 0x0000000C, 0x00040020, 0x00000088, 0x00000001, 0x00000053, 
+0x00040020, 0x0000008D, 0x00000007, 0x00000052, 0x0004002B, 0x0000000D, 0x00000096, 0x00000002, 
+0x0004002B, 0x0000000D, 0x000000A3, 0x00000001, 0x0004002B, 0x00000004, 0x000000AA, 0x40000000, 
+0x000F001E, 0x000000CD, 0x00000005, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000052, 
+0x00000052, 0x00000004, 0x00000052, 0x00000004, 0x00000052, 0x00000052, 0x00000053, 0x00040020, 
+0x000000CE, 0x00000007, 0x000000CD, 0x00040020, 0x000000D9, 0x00000001, 0x00000052, 0x0004002B, 
+0x00000004, 0x000000DF, 0x3D23D70A, 0x0006002C, 0x00000052, 0x000000E9, 0x0000005F, 0x0000005F, 
+0x0000005F, 0x00040020, 0x000000EE, 0x00000001, 0x00000054, 0x00040020, 0x00000104, 0x00000001, 
+0x00000005, 0x0004003B, 0x00000104, 0x00000103, 0x00000001, 0x0004002B, 0x00000009, 0x00000109, 
+0x00000011, 0x00040020, 0x0000010F, 0x00000007, 0x00000053, 0x0004002B, 0x00000004, 0x0000011C, 
+0x3D3851EC, 0x0004002B, 0x00000004, 0x00000125, 0x3CA3D70A, 0x0004002B, 0x00000004, 0x0000014A, 
+0x3B04B5DD, 0x00040020, 0x00000152, 0x00000002, 0x00000005, 0x0004002B, 0x00000004, 0x0000015E, 
+0x38D1B717, 0x0004002B, 0x00000009, 0x0000017C, 0x0000000A, 0x0004002B, 0x00000004, 0x00000180, 
+0x3DCCCCCD, 0x0004002B, 0x00000009, 0x000001BF, 0x0000000D, 0x00040020, 0x000001C1, 0x00000002, 
+0x00000009, 0x00040020, 0x000001F8, 0x00000007, 0x00000009, 0x0004002B, 0x00000004, 0x00000200, 
+0x3F4CCCCD, 0x0004002B, 0x00000004, 0x00000201, 0x3E4CCCCD, 0x0007002C, 0x00000005, 0x00000202, 
+0x00000200, 0x00000201, 0x00000201, 0x0000005F, 0x0007002C, 0x00000005, 0x00000205, 0x00000201, 
+0x00000200, 0x00000201, 0x0000005F, 0x0007002C, 0x00000005, 0x00000208, 0x00000201, 0x00000201, 
+0x00000200, 0x0000005F, 0x0007002C, 0x00000005, 0x0000020B, 0x00000200, 0x00000200, 0x00000201, 
+0x0000005F, 0x00030021, 0x0000020D, 0x00000005, 0x0004002B, 0x00000004, 0x00000211, 0x3D4CCCCD, 
+0x00030021, 0x00000224, 0x00000052, 0x00030021, 0x0000023E, 0x00000004, 0x00040021, 0x00000268, 
+0x00000052, 0x0000008D, 0x00040021, 0x00000284, 0x00000004, 0x00000067, 0x0004002B, 0x00000004, 
+0x00000290, 0x3E23D70A, 0x00060021, 0x00000295, 0x00000052, 0x00000064, 0x00000067, 0x00000067, 
+0x00050021, 0x000002A4, 0x00000052, 0x00000064, 0x00000067, 0x00060021, 0x000002AD, 0x00000052, 
+0x0000008D, 0x0000008D, 0x000000CE, 0x0006002C, 0x00000052, 0x000002B2, 0x00000071, 0x00000071, 
+0x00000071, 0x0009001E, 0x000002C1, 0x00000005, 0x00000005, 0x00000005, 0x00000004, 0x00000004, 
+0x00000004, 0x00000004, 0x00040020, 0x000002C2, 0x00000007, 0x000002C1, 0x00040020, 0x000002C4, 
+0x00000002, 0x00000019, 0x00040020, 0x000002D8, 0x00000002, 0x00000006, 0x00040020, 0x000002E8, 
+0x00000007, 0x0000000D, 0x0004002B, 0x0000000D, 0x000002EC, 0x0000FFFF, 0x0004002B, 0x0000000D, 
+0x000002F0, 0x00000010, 0x0004002B, 0x0000000D, 0x000002F3, 0x00000000, 0x0004002B, 0x00000009, 
+0x0000033A, 0x0000000E, 0x00040021, 0x00000358, 0x00000009, 0x0000008D, 0x00040021, 0x0000037D, 
+0x00000005, 0x00000064, 0x0004002B, 0x00000004, 0x0000038D, 0x400CCCCD, 0x0006002C, 0x00000052, 
+0x0000038E, 0x0000038D, 0x0000038D, 0x0000038D, 0x00060021, 0x00000390, 0x00000052, 0x000002C2, 
+0x0000008D, 0x000000CE, 0x0004002B, 0x00000004, 0x000003DF, 0x3F666666, 0x0004002B, 0x00000009, 
+0x000003FA, 0x00000012, 0x00040021, 0x00000481, 0x0000000D, 0x0000008D, 0x00040020, 0x00000485, 
+0x00000002, 0x00000043, 0x00040020, 0x00000488, 0x00000007, 0x00000043, 0x0004002B, 0x00000004, 
+0x000004B2, 0x3F000000, 0x0005002C, 0x00000053, 0x000004B4, 0x000004B2, 0x000004B2, 0x00040017, 
+0x000004B8, 0x0000000D, 0x00000002, 0x0005002C, 0x00000053, 0x000004BB, 0x00000071, 0x00000071, 
+0x0005002C, 0x00000053, 0x000004BF, 0x0000005F, 0x0000005F, 0x00040020, 0x000004C4, 0x00000007, 
+0x000004B8, 0x00040021, 0x000004DD, 0x0000000D, 0x000002E8, 0x00040020, 0x000004E5, 0x00000002, 
+0x0000000D, 0x0004002B, 0x0000000D, 0x000004EA, 0x00000008, 0x00060021, 0x000004F8, 0x00000052, 
+0x0000008D, 0x00000067, 0x00000067, 0x0004002B, 0x00000004, 0x00000508, 0x40A00000, 0x00070021, 
+0x0000050C, 0x00000004, 0x0000008D, 0x000001F8, 0x0000008D, 0x0000008D, 0x0004002B, 0x00000004, 
+0x00000541, 0x3C23D70A, 0x0004002B, 0x00000004, 0x0000054C, 0x3B03126F, 0x00070021, 0x0000059F, 
+0x00000052, 0x000000CE, 0x00000067, 0x00000067, 0x00000067, 0x000A0021, 0x000005B4, 0x00000052, 
+0x000000CE, 0x000002C2, 0x0000008D, 0x00000067, 0x00000067, 0x00000067, 0x00000067, 0x00050021, 
+0x000005CD, 0x00000004, 0x00000067, 0x00000067, 0x0004002B, 0x00000004, 0x000005D2, 0x3F7FF972, 
+0x000A0021, 0x000005E0, 0x00000004, 0x0000002E, 0x00000064, 0x00000067, 0x0000008D, 0x0000008D, 
+0x0000008D, 0x000001F8, 0x0004002B, 0x00000004, 0x000005FC, 0x447A0000, 0x0004002B, 0x00000004, 
+0x00000600, 0x41800000, 0x0004002B, 0x00000004, 0x0000061F, 0x44800000, 0x0005002C, 0x00000053, 
+0x00000620, 0x0000061F, 0x0000061F, 0x0004002B, 0x00000004, 0x0000063B, 0x40800000, 0x00070021, 
+0x0000063D, 0x00000004, 0x00000067, 0x00000067, 0x00000067, 0x00000067, 0x00060021, 0x00000679, 
+0x00000004, 0x0000008D, 0x0000008D, 0x000001F8, 0x0004002B, 0x00000009, 0x0000067E, 0x0000000F, 
+0x00040021, 0x0000068C, 0x00000004, 0x0000010F, 0x0004002B, 0x00000004, 0x00000690, 0x414FD639, 
+0x0004002B, 0x00000004, 0x00000691, 0x429C774C, 0x0005002C, 0x00000053, 0x00000692, 0x00000690, 
+0x00000691, 0x0004002B, 0x00000004, 0x00000695, 0x472AEE8C, 0x00050021, 0x00000698, 0x00000004, 
+0x0000008D, 0x000001F8, 0x0004002B, 0x00000004, 0x000006AA, 0x3D897143, 0x0004002B, 0x00000004, 
+0x000006AB, 0x3BBF4590, 0x0004002B, 0x00000004, 0x000006AC, 0x4253EE82, 0x0006002C, 0x00000052, 
+0x000006AD, 0x000006AA, 0x000006AB, 0x000006AC, 0x00060021, 0x000006B8, 0x00000053, 0x000001F8, 
+0x00000067, 0x00000067, 0x0004002B, 0x00000004, 0x000006BD, 0x4019999A, 0x0004002B, 0x00000004, 
+0x000006F9, 0x40490FDB, 0x0004002B, 0x00000004, 0x000006FA, 0x3EA2F983, 0x00070021, 0x000006FC, 
+0x00000004, 0x00000067, 0x00000067, 0x0000008D, 0x0000008D, 0x00060021, 0x0000070C, 0x00000004, 
+0x00000067, 0x00000067, 0x00000067, 0x00050021, 0x00000719, 0x00000052, 0x0000008D, 0x00000067, 
+0x0004002B, 0x00000004, 0x0000071E, 0x42480000, 0x0004002B, 0x00000004, 0x0000071F, 0x3EA8F5C3, 
+0x0004002B, 0x00000004, 0x00000720, 0x41840000, 0x0006002C, 0x00000052, 0x00000721, 0x00000720, 
+0x00000720, 0x00000720, 0x00040021, 0x0000072E, 0x00000004, 0x00000064, 0x0004002B, 0x00000004, 
+0x00000732, 0x4234A7F0, 0x0004002B, 0x00000004, 0x00000733, 0x42BD5893, 0x0007002C, 0x00000005, 
+0x00000734, 0x00000690, 0x00000691, 0x00000732, 0x00000733, 0x0004002B, 0x00000004, 0x00000765, 
+0x477FE000, 0x00050036, 0x00000002, 0x0000005C, 0x00000000, 0x0000005D, 0x000200F8, 0x0000005E, 
+0x0004003B, 0x00000064, 0x00000063, 0x00000007, 0x0004003B, 0x00000067, 0x00000072, 0x00000007, 
+0x0004003B, 0x00000067, 0x00000073, 0x00000007, 0x0004003B, 0x0000008D, 0x0000008C, 0x00000007, 
+0x0004003B, 0x0000008D, 0x000000B3, 0x00000007, 0x0004003B, 0x000000CE, 0x000000CC, 0x00000007, 
+0x0004003B, 0x0000008D, 0x000000FD, 0x00000007, 0x0004003B, 0x0000010F, 0x0000010E, 0x00000007, 
+0x0004003B, 0x00000067, 0x00000114, 0x00000007, 0x0004003B, 0x00000067, 0x00000120, 0x00000007, 
+0x0004003B, 0x00000067, 0x00000129, 0x00000007, 0x0004003B, 0x0000008D, 0x0000012D, 0x00000007, 
+0x0004003B, 0x0000008D, 0x00000131, 0x00000007, 0x0004003B, 0x00000067, 0x00000139, 0x00000007, 
+0x0004003B, 0x00000067, 0x0000013D, 0x00000007, 0x0004003B, 0x00000067, 0x00000142, 0x00000007, 
+0x0004003B, 0x00000067, 0x00000144, 0x00000007, 0x0004003B, 0x0000008D, 0x00000150, 0x00000007, 
+0x0004003B, 0x00000067, 0x0000016B, 0x00000007, 0x0004003B, 0x00000067, 0x0000016F, 0x00000007, 
+0x0004003B, 0x00000064, 0x00000173, 0x00000007, 0x0004003B, 0x00000067, 0x00000176, 0x00000007, 
+0x0004003B, 0x00000067, 0x00000177, 0x00000007, 0x0004003B, 0x0000008D, 0x0000017A, 0x00000007, 
+0x0004003B, 0x00000064, 0x0000018C, 0x00000007, 0x0004003B, 0x00000067, 0x0000018F, 0x00000007, 
+0x0004003B, 0x0000008D, 0x0000019E, 0x00000007, 0x0004003B, 0x0000008D, 0x000001A0, 0x00000007, 
+0x0004003B, 0x0000008D, 0x000001A3, 0x00000007, 0x0004003B, 0x000000CE, 0x000001A5, 0x00000007, 
+0x0004003B, 0x0000008D, 0x000001A8, 0x00000007, 0x0004003B, 0x0000008D, 0x000001AA, 0x00000007, 
+0x0004003B, 0x0000008D, 0x000001AD, 0x00000007, 0x0004003B, 0x000000CE, 0x000001AF, 0x00000007, 
+0x0004003B, 0x0000008D, 0x000001B2, 0x00000007, 0x0004003B, 0x0000008D, 0x000001B9, 0x00000007, 
+0x0004003B, 0x0000008D, 0x000001F4, 0x00000007, 0x0004003B, 0x000001F8, 0x000001F7, 0x00000007, 
+0x0003003E, 0x00000057, 0x0000005F, 0x0003003E, 0x0000005B, 0x00000060, 0x00040039, 0x00000005, 
+0x00000062, 0x00000061, 0x0003003E, 0x00000063, 0x00000062, 0x00050041, 0x00000067, 0x00000066, 
+0x00000063, 0x00000065, 0x0004003D, 0x00000004, 0x00000068, 0x00000066, 0x00050041, 0x0000006B, 
+0x0000006A, 0x00000013, 0x00000069, 0x0004003D, 0x00000004, 0x0000006C, 0x0000006A, 0x000500B8, 
+0x0000006E, 0x0000006D, 0x00000068, 0x0000006C, 0x000300F7, 0x00000070, 0x00000000, 0x000400FA, 
+0x0000006D, 0x0000006F, 0x00000070, 0x000200F8, 0x0000006F, 0x000100FC, 0x000200F8, 0x00000070, 
+0x0003003E, 0x00000072, 0x00000071, 0x0003003E, 0x00000073, 0x00000071, 0x00050041, 0x0000006B, 
+0x00000075, 0x00000013, 0x00000074, 0x0004003D, 0x00000004, 0x00000076, 0x00000075, 0x000500B4, 
+0x0000006E, 0x00000077, 0x00000076, 0x00000071, 0x000300F7, 0x00000079, 0x00000000, 0x000400FA, 
+0x00000077, 0x00000078, 0x0000007A, 0x000200F8, 0x00000078, 0x00040039, 0x00000052, 0x0000007C, 
+0x0000007B, 0x00050051, 0x00000004, 0x0000007D, 0x0000007C, 0x00000000, 0x0003003E, 0x00000072, 
+0x0000007D, 0x00040039, 0x00000004, 0x0000007F, 0x0000007E, 0x0003003E, 0x00000073, 0x0000007F, 
+0x000200F9, 0x00000079, 0x000200F8, 0x0000007A, 0x00050041, 0x0000006B, 0x00000080, 0x00000013, 
+0x00000074, 0x0004003D, 0x00000004, 0x00000081, 0x00000080, 0x000500B4, 0x0000006E, 0x00000082, 
+0x00000081, 0x0000005F, 0x000300F7, 0x00000084, 0x00000000, 0x000400FA, 0x00000082, 0x00000083, 
+0x00000085, 0x000200F8, 0x00000083, 0x0004003D, 0x00000023, 0x00000086, 0x00000025, 0x00050041, 
+0x00000088, 0x00000087, 0x00000051, 0x00000012, 0x0004003D, 0x00000053, 0x00000089, 0x00000087, 
+0x00050057, 0x00000005, 0x0000008A, 0x00000086, 0x00000089, 0x0008004F, 0x00000052, 0x0000008B, 
+0x0000008A, 0x0000008A, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x0000008C, 0x0000008B, 
+0x00050041, 0x0000006B, 0x0000008E, 0x00000013, 0x00000016, 0x0004003D, 0x00000004, 0x0000008F, 
+0x0000008E, 0x00050083, 0x00000004, 0x00000090, 0x0000005F, 0x0000008F, 0x00050041, 0x0000006B, 
+0x00000091, 0x00000013, 0x0000001F, 0x0004003D, 0x00000004, 0x00000092, 0x00000091, 0x00050085, 
+0x00000004, 0x00000093, 0x00000090, 0x00000092, 0x00050041, 0x0000006B, 0x00000094, 0x00000013, 
+0x00000016, 0x0004003D, 0x00000004, 0x00000095, 0x00000094, 0x00050041, 0x00000067, 0x00000097, 
+0x0000008C, 0x00000096, 0x0004003D, 0x00000004, 0x00000098, 0x00000097, 0x00050085, 0x00000004, 
+0x00000099, 0x00000095, 0x00000098, 0x00050081, 0x00000004, 0x0000009A, 0x00000093, 0x00000099, 
+0x0003003E, 0x00000072, 0x0000009A, 0x00050041, 0x0000006B, 0x0000009B, 0x00000013, 0x00000016, 
+0x0004003D, 0x00000004, 0x0000009C, 0x0000009B, 0x00050083, 0x00000004, 0x0000009D, 0x0000005F, 
+0x0000009C, 0x00050041, 0x0000006B, 0x0000009E, 0x00000013, 0x00000012, 0x0004003D, 0x00000004, 
+0x0000009F, 0x0000009E, 0x00050085, 0x00000004, 0x000000A0, 0x0000009D, 0x0000009F, 0x00050041, 
+0x0000006B, 0x000000A1, 0x00000013, 0x00000016, 0x0004003D, 0x00000004, 0x000000A2, 0x000000A1, 
+0x00050041, 0x00000067, 0x000000A4, 0x0000008C, 0x000000A3, 0x0004003D, 0x00000004, 0x000000A5, 
+0x000000A4, 0x00050085, 0x00000004, 0x000000A6, 0x000000A2, 0x000000A5, 0x00050081, 0x00000004, 
+0x000000A7, 0x000000A0, 0x000000A6, 0x0003003E, 0x00000073, 0x000000A7, 0x000200F9, 0x00000084, 
+0x000200F8, 0x00000085, 0x00050041, 0x0000006B, 0x000000A8, 0x00000013, 0x00000074, 0x0004003D, 
+0x00000004, 0x000000A9, 0x000000A8, 0x000500B4, 0x0000006E, 0x000000AB, 0x000000A9, 0x000000AA, 
+0x000300F7, 0x000000AD, 0x00000000, 0x000400FA, 0x000000AB, 0x000000AC, 0x000000AD, 0x000200F8, 
+0x000000AC, 0x0004003D, 0x00000023, 0x000000AE, 0x00000025, 0x00050041, 0x00000088, 0x000000AF, 
+0x00000051, 0x00000012, 0x0004003D, 0x00000053, 0x000000B0, 0x000000AF, 0x00050057, 0x00000005, 
+0x000000B1, 0x000000AE, 0x000000B0, 0x0008004F, 0x00000052, 0x000000B2, 0x000000B1, 0x000000B1, 
+0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x000000B3, 0x000000B2, 0x00050041, 0x0000006B, 
+0x000000B4, 0x00000013, 0x00000016, 0x0004003D, 0x00000004, 0x000000B5, 0x000000B4, 0x00050083, 
+0x00000004, 0x000000B6, 0x0000005F, 0x000000B5, 0x00050041, 0x0000006B, 0x000000B7, 0x00000013, 
+0x0000001F, 0x0004003D, 0x00000004, 0x000000B8, 0x000000B7, 0x00050085, 0x00000004, 0x000000B9, 
+0x000000B6, 0x000000B8, 0x00050041, 0x0000006B, 0x000000BA, 0x00000013, 0x00000016, 0x0004003D, 
+0x00000004, 0x000000BB, 0x000000BA, 0x00050041, 0x00000067, 0x000000BC, 0x000000B3, 0x00000096, 
+0x0004003D, 0x00000004, 0x000000BD, 0x000000BC, 0x00050085, 0x00000004, 0x000000BE, 0x000000BB, 
+0x000000BD, 0x00050081, 0x00000004, 0x000000BF, 0x000000B9, 0x000000BE, 0x0003003E, 0x00000072, 
+0x000000BF, 0x00050041, 0x0000006B, 0x000000C0, 0x00000013, 0x00000016, 0x0004003D, 0x00000004, 
+0x000000C1, 0x000000C0, 0x00050083, 0x00000004, 0x000000C2, 0x0000005F, 0x000000C1, 0x00050041, 
+0x0000006B, 0x000000C3, 0x00000013, 0x00000012, 0x0004003D, 0x00000004, 0x000000C4, 0x000000C3, 
+0x00050085, 0x00000004, 0x000000C5, 0x000000C2, 0x000000C4, 0x00050041, 0x0000006B, 0x000000C6, 
+0x00000013, 0x00000016, 0x0004003D, 0x00000004, 0x000000C7, 0x000000C6, 0x00050041, 0x00000067, 
+0x000000C8, 0x000000B3, 0x000000A3, 0x0004003D, 0x00000004, 0x000000C9, 0x000000C8, 0x00050085, 
+0x00000004, 0x000000CA, 0x000000C7, 0x000000C9, 0x00050081, 0x00000004, 0x000000CB, 0x000000C5, 
+0x000000CA, 0x0003003E, 0x00000073, 0x000000CB, 0x000200F9, 0x000000AD, 0x000200F8, 0x000000AD, 
+0x000200F9, 0x00000084, 0x000200F8, 0x00000084, 0x000200F9, 0x00000079, 0x000200F8, 0x00000079, 
+0x0004003D, 0x00000005, 0x000000CF, 0x00000063, 0x00050041, 0x00000064, 0x000000D0, 0x000000CC, 
+0x0000000A, 0x0003003E, 0x000000D0, 0x000000CF, 0x0004003D, 0x00000004, 0x000000D1, 0x00000072, 
+0x00050041, 0x00000067, 0x000000D2, 0x000000CC, 0x00000012, 0x0003003E, 0x000000D2, 0x000000D1, 
+0x0004003D, 0x00000004, 0x000000D3, 0x00000073, 0x00050041, 0x00000067, 0x000000D4, 0x000000CC, 
+0x00000028, 0x0003003E, 0x000000D4, 0x000000D3, 0x00050041, 0x0000006B, 0x000000D5, 0x00000013, 
+0x00000028, 0x0004003D, 0x00000004, 0x000000D6, 0x000000D5, 0x00050041, 0x00000067, 0x000000D7, 
+0x000000CC, 0x0000000B, 0x0003003E, 0x000000D7, 0x000000D6, 0x00050041, 0x000000D9, 0x000000D8, 
+0x00000051, 0x00000028, 0x0004003D, 0x00000052, 0x000000DA, 0x000000D8, 0x0006000C, 0x00000052, 
+0x000000DB, 0x00000001, 0x00000045, 0x000000DA, 0x00050041, 0x0000008D, 0x000000DC, 0x000000CC, 
+0x00000016, 0x0003003E, 0x000000DC, 0x000000DB, 0x00050041, 0x0000006B, 0x000000DD, 0x00000013, 
+0x0000004A, 0x0004003D, 0x00000004, 0x000000DE, 0x000000DD, 0x000500BA, 0x0000006E, 0x000000E0, 
+0x000000DE, 0x000000DF, 0x000300F7, 0x000000E2, 0x00000000, 0x000400FA, 0x000000E0, 0x000000E1, 
+0x000000E2, 0x000200F8, 0x000000E1, 0x0004003D, 0x00000023, 0x000000E3, 0x00000027, 0x00050041, 
+0x00000088, 0x000000E4, 0x00000051, 0x00000012, 0x0004003D, 0x00000053, 0x000000E5, 0x000000E4, 
+0x00050057, 0x00000005, 0x000000E6, 0x000000E3, 0x000000E5, 0x0008004F, 0x00000052, 0x000000E7, 
+0x000000E6, 0x000000E6, 0x00000000, 0x00000001, 0x00000002, 0x0005008E, 0x00000052, 0x000000E8, 
+0x000000E7, 0x000000AA, 0x00050083, 0x00000052, 0x000000EA, 0x000000E8, 0x000000E9, 0x0006000C, 
+0x00000052, 0x000000EB, 0x00000001, 0x00000045, 0x000000EA, 0x00050041, 0x0000008D, 0x000000EC, 
+0x000000CC, 0x00000016, 0x0003003E, 0x000000EC, 0x000000EB, 0x00050041, 0x000000EE, 0x000000ED, 
+0x00000051, 0x0000000B, 0x0004003D, 0x00000054, 0x000000EF, 0x000000ED, 0x00050041, 0x0000008D, 
+0x000000F0, 0x000000CC, 0x00000016, 0x0004003D, 0x00000052, 0x000000F1, 0x000000F0, 0x00050091, 
+0x00000052, 0x000000F2, 0x000000EF, 0x000000F1, 0x0006000C, 0x00000052, 0x000000F3, 0x00000001, 
+0x00000045, 0x000000F2, 0x00050041, 0x0000008D, 0x000000F4, 0x000000CC, 0x00000016, 0x0003003E, 
+0x000000F4, 0x000000F3, 0x00050041, 0x0000008D, 0x000000F5, 0x000000CC, 0x00000016, 0x0004003D, 
+0x00000052, 0x000000F6, 0x000000F5, 0x0006000C, 0x00000052, 0x000000F7, 0x00000001, 0x00000045, 
+0x000000F6, 0x00050041, 0x0000008D, 0x000000F8, 0x000000CC, 0x00000016, 0x0003003E, 0x000000F8, 
+0x000000F7, 0x000200F9, 0x000000E2, 0x000200F8, 0x000000E2, 0x00040039, 0x00000004, 0x000000FA, 
+0x000000F9, 0x00050041, 0x00000067, 0x000000FB, 0x000000CC, 0x00000048, 0x0003003E, 0x000000FB, 
+0x000000FA, 0x00050041, 0x00000064, 0x000000FE, 0x000000CC, 0x0000000A, 0x0004003D, 0x00000005, 
+0x000000FF, 0x000000FE, 0x0008004F, 0x00000052, 0x00000100, 0x000000FF, 0x000000FF, 0x00000000, 
+0x00000001, 0x00000002, 0x0003003E, 0x000000FD, 0x00000100, 0x00050039, 0x00000052, 0x00000101, 
+0x000000FC, 0x000000FD, 0x00050041, 0x0000008D, 0x00000102, 0x000000CC, 0x00000020, 0x0003003E, 
+0x00000102, 0x00000101, 0x0004003D, 0x00000005, 0x00000105, 0x00000103, 0x0007004F, 0x00000053, 
+0x00000106, 0x00000105, 0x00000105, 0x00000000, 0x00000001, 0x00050041, 0x0000006B, 0x00000107, 
+0x00000018, 0x0000003C, 0x0004003D, 0x00000004, 0x00000108, 0x00000107, 0x00050041, 0x0000006B, 
+0x0000010A, 0x00000018, 0x00000109, 0x0004003D, 0x00000004, 0x0000010B, 0x0000010A, 0x00050050, 
+0x00000053, 0x0000010C, 0x00000108, 0x0000010B, 0x00050088, 0x00000053, 0x0000010D, 0x00000106, 
+0x0000010C, 0x0003003E, 0x0000010E, 0x0000010D, 0x0004003D, 0x00000023, 0x00000110, 0x00000035, 
+0x0004003D, 0x00000053, 0x00000111, 0x0000010E, 0x00050057, 0x00000005, 0x00000112, 0x00000110, 
+0x00000111, 0x00050051, 0x00000004, 0x00000113, 0x00000112, 0x00000000, 0x0003003E, 0x00000114, 
+0x00000113, 0x0004003D, 0x00000004, 0x00000115, 0x00000114, 0x00050041, 0x00000064, 0x00000116, 
+0x000000CC, 0x0000000A, 0x0004003D, 0x00000005, 0x00000117, 0x00000116, 0x0005008E, 0x00000005, 
+0x00000118, 0x00000117, 0x00000115, 0x00050041, 0x00000064, 0x00000119, 0x000000CC, 0x0000000A, 
+0x0003003E, 0x00000119, 0x00000118, 0x00050041, 0x00000067, 0x0000011A, 0x000000CC, 0x00000028, 
+0x0004003D, 0x00000004, 0x0000011B, 0x0000011A, 0x0008000C, 0x00000004, 0x0000011D, 0x00000001, 
+0x0000002B, 0x0000011B, 0x0000011C, 0x0000005F, 0x00050041, 0x00000067, 0x0000011E, 0x000000CC, 
+0x00000028, 0x0003003E, 0x0000011E, 0x0000011D, 0x00050041, 0x00000067, 0x00000121, 0x000000CC, 
+0x0000001F, 0x0004003D, 0x00000004, 0x00000122, 0x00000121, 0x0003003E, 0x00000120, 0x00000122, 
+0x00050039, 0x00000004, 0x00000123, 0x0000011F, 0x00000120, 0x00050041, 0x00000067, 0x00000124, 
+0x000000CC, 0x0000001F, 0x0003003E, 0x00000124, 0x00000123, 0x0004003D, 0x00000004, 0x00000126, 
+0x00000073, 0x0004003D, 0x00000004, 0x00000127, 0x00000073, 0x00050085, 0x00000004, 0x00000128, 
+0x00000126, 0x00000127, 0x0003003E, 0x00000129, 0x00000128, 0x00050041, 0x0000008D, 0x0000012A, 
+0x000000CC, 0x00000016, 0x0004003D, 0x00000052, 0x0000012B, 0x0000012A, 0x000400CF, 0x00000052, 
+0x0000012C, 0x0000012B, 0x0003003E, 0x0000012D, 0x0000012C, 0x00050041, 0x0000008D, 0x0000012E, 
+0x000000CC, 0x00000016, 0x0004003D, 0x00000052, 0x0000012F, 0x0000012E, 0x000400D0, 0x00000052, 
+0x00000130, 0x0000012F, 0x0003003E, 0x00000131, 0x00000130, 0x0004003D, 0x00000052, 0x00000132, 
+0x0000012D, 0x0004003D, 0x00000052, 0x00000133, 0x0000012D, 0x00050094, 0x00000004, 0x00000134, 
+0x00000132, 0x00000133, 0x0004003D, 0x00000052, 0x00000135, 0x00000131, 0x0004003D, 0x00000052, 
+0x00000136, 0x00000131, 0x00050094, 0x00000004, 0x00000137, 0x00000135, 0x00000136, 0x00050081, 
+0x00000004, 0x00000138, 0x00000134, 0x00000137, 0x0003003E, 0x00000139, 0x00000138, 0x0004003D, 
+0x00000004, 0x0000013A, 0x00000139, 0x00050085, 0x00000004, 0x0000013B, 0x0000013A, 0x0000005F, 
+0x0007000C, 0x00000004, 0x0000013C, 0x00000001, 0x00000025, 0x0000013B, 0x00000125, 0x0003003E, 
+0x0000013D, 0x0000013C, 0x0004003D, 0x00000004, 0x0000013E, 0x00000129, 0x0004003D, 0x00000004, 
+0x0000013F, 0x0000013D, 0x00050081, 0x00000004, 0x00000140, 0x0000013E, 0x0000013F, 0x0003003E, 
+0x00000142, 0x00000140, 0x00050039, 0x00000004, 0x00000143, 0x00000141, 0x00000142, 0x0003003E, 
+0x00000144, 0x00000143, 0x0004003D, 0x00000004, 0x00000145, 0x00000144, 0x0006000C, 0x00000004, 
+0x00000146, 0x00000001, 0x0000001F, 0x00000145, 0x00050041, 0x00000067, 0x00000147, 0x000000CC, 
+0x0000001F, 0x0003003E, 0x00000147, 0x00000146, 0x00050041, 0x00000067, 0x00000148, 0x000000CC, 
+0x0000001F, 0x0004003D, 0x00000004, 0x00000149, 0x00000148, 0x0008000C, 0x00000004, 0x0000014B, 
+0x00000001, 0x0000002B, 0x00000149, 0x0000014A, 0x0000005F, 0x00050041, 0x00000067, 0x0000014C, 
+0x000000CC, 0x0000001F, 0x0003003E, 0x0000014C, 0x0000014B, 0x00050041, 0x00000104, 0x0000014D, 
+0x00000051, 0x0000001F, 0x0004003D, 0x00000005, 0x0000014E, 0x0000014D, 0x0008004F, 0x00000052, 
+0x0000014F, 0x0000014E, 0x0000014E, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x00000150, 
+0x0000014F, 0x00050041, 0x00000152, 0x00000151, 0x00000018, 0x00000020, 0x0004003D, 0x00000005, 
+0x00000153, 0x00000151, 0x0008004F, 0x00000052, 0x00000154, 0x00000153, 0x00000153, 0x00000000, 
+0x00000001, 0x00000002, 0x0004003D, 0x00000052, 0x00000155, 0x00000150, 0x00050083, 0x00000052, 
+0x00000156, 0x00000154, 0x00000155, 0x0006000C, 0x00000052, 0x00000157, 0x00000001, 0x00000045, 
+0x00000156, 0x00050041, 0x0000008D, 0x00000158, 0x000000CC, 0x0000004A, 0x0003003E, 0x00000158, 
+0x00000157, 0x00050041, 0x0000008D, 0x00000159, 0x000000CC, 0x00000016, 0x0004003D, 0x00000052, 
+0x0000015A, 0x00000159, 0x00050041, 0x0000008D, 0x0000015B, 0x000000CC, 0x0000004A, 0x0004003D, 
+0x00000052, 0x0000015C, 0x0000015B, 0x00050094, 0x00000004, 0x0000015D, 0x0000015A, 0x0000015C, 
+0x0007000C, 0x00000004, 0x0000015F, 0x00000001, 0x00000028, 0x0000015D, 0x0000015E, 0x00050041, 
+0x00000067, 0x00000160, 0x000000CC, 0x0000003D, 0x0003003E, 0x00000160, 0x0000015F, 0x0004003D, 
+0x00000023, 0x00000161, 0x00000034, 0x00050041, 0x00000067, 0x00000162, 0x000000CC, 0x0000003D, 
+0x0004003D, 0x00000004, 0x00000163, 0x00000162, 0x00050041, 0x00000067, 0x00000164, 0x000000CC, 
+0x00000028, 0x0004003D, 0x00000004, 0x00000165, 0x00000164, 0x00050050, 0x00000053, 0x00000166, 
+0x00000163, 0x00000165, 0x00050057, 0x00000005, 0x00000167, 0x00000161, 0x00000166, 0x0007004F, 
+0x00000053, 0x00000168, 0x00000167, 0x00000167, 0x00000000, 0x00000001, 0x00050041, 0x0000010F, 
+0x00000169, 0x000000CC, 0x00000074, 0x0003003E, 0x00000169, 0x00000168, 0x00050041, 0x00000067, 
+0x0000016C, 0x000000CC, 0x0000000B, 0x0004003D, 0x00000004, 0x0000016D, 0x0000016C, 0x0003003E, 
+0x0000016B, 0x0000016D, 0x00050039, 0x00000004, 0x0000016E, 0x0000016A, 0x0000016B, 0x0003003E, 
+0x0000016F, 0x0000016E, 0x00050041, 0x00000067, 0x00000170, 0x000000CC, 0x00000012, 0x0004003D, 
+0x00000004, 0x00000171, 0x00000170, 0x00050041, 0x00000064, 0x00000174, 0x000000CC, 0x0000000A, 
+0x0004003D, 0x00000005, 0x00000175, 0x00000174, 0x0003003E, 0x00000173, 0x00000175, 0x0003003E, 
+0x00000176, 0x00000171, 0x0004003D, 0x00000004, 0x00000178, 0x0000016F, 0x0003003E, 0x00000177, 
+0x00000178, 0x00070039, 0x00000052, 0x00000179, 0x00000172, 0x00000173, 0x00000176, 0x00000177, 
+0x0003003E, 0x0000017A, 0x00000179, 0x0004003D, 0x00000052, 0x0000017B, 0x0000017A, 0x00050041, 
+0x0000008D, 0x0000017D, 0x000000CC, 0x0000017C, 0x0003003E, 0x0000017D, 0x0000017B, 0x00050041, 
+0x0000008D, 0x0000017E, 0x000000CC, 0x0000017C, 0x0004003D, 0x00000052, 0x0000017F, 0x0000017E, 
+0x00060041, 0x00000067, 0x00000181, 0x000000CC, 0x00000074, 0x000000A3, 0x0004003D, 0x00000004, 
+0x00000182, 0x00000181, 0x0007000C, 0x00000004, 0x00000183, 0x00000001, 0x00000028, 0x00000180, 
+0x00000182, 0x00050088, 0x00000004, 0x00000184, 0x0000005F, 0x00000183, 0x00050083, 0x00000004, 
+0x00000185, 0x00000184, 0x0000005F, 0x0005008E, 0x00000052, 0x00000186, 0x0000017F, 0x00000185, 
+0x00050081, 0x00000052, 0x00000187, 0x000000E9, 0x00000186, 0x00050041, 0x0000008D, 0x00000188, 
+0x000000CC, 0x00000069, 0x0003003E, 0x00000188, 0x00000187, 0x00050041, 0x00000067, 0x00000189, 
+0x000000CC, 0x00000012, 0x0004003D, 0x00000004, 0x0000018A, 0x00000189, 0x00050041, 0x00000064, 
+0x0000018D, 0x000000CC, 0x0000000A, 0x0004003D, 0x00000005, 0x0000018E, 0x0000018D, 0x0003003E, 
+0x0000018C, 0x0000018E, 0x0003003E, 0x0000018F, 0x0000018A, 0x00060039, 0x00000052, 0x00000190, 
+0x0000018B, 0x0000018C, 0x0000018F, 0x00050041, 0x00000064, 0x00000191, 0x000000CC, 0x0000000A, 
+0x0004003D, 0x00000005, 0x00000192, 0x00000191, 0x0009004F, 0x00000005, 0x00000193, 0x00000192, 
+0x00000190, 0x00000004, 0x00000005, 0x00000006, 0x00000003, 0x00050041, 0x00000064, 0x00000194, 
+0x000000CC, 0x0000000A, 0x0003003E, 0x00000194, 0x00000193, 0x00050041, 0x00000067, 0x00000195, 
+0x000000CC, 0x0000003D, 0x0004003D, 0x00000004, 0x00000196, 0x00000195, 0x00050085, 0x00000004, 
+0x00000197, 0x000000AA, 0x00000196, 0x00050041, 0x0000008D, 0x00000198, 0x000000CC, 0x00000016, 
+0x0004003D, 0x00000052, 0x00000199, 0x00000198, 0x0005008E, 0x00000052, 0x0000019A, 0x00000199, 
+0x00000197, 0x00050041, 0x0000008D, 0x0000019B, 0x000000CC, 0x0000004A, 0x0004003D, 0x00000052, 
+0x0000019C, 0x0000019B, 0x00050083, 0x00000052, 0x0000019D, 0x0000019A, 0x0000019C, 0x0003003E, 
+0x0000019E, 0x0000019D, 0x00050041, 0x0000008D, 0x000001A1, 0x000000CC, 0x0000017C, 0x0004003D, 
+0x00000052, 0x000001A2, 0x000001A1, 0x0003003E, 0x000001A0, 0x000001A2, 0x0004003D, 0x00000052, 
+0x000001A4, 0x00000150, 0x0003003E, 0x000001A3, 0x000001A4, 0x0004003D, 0x000000CD, 0x000001A6, 
+0x000000CC, 0x0003003E, 0x000001A5, 0x000001A6, 0x00070039, 0x00000052, 0x000001A7, 0x0000019F, 
+0x000001A0, 0x000001A3, 0x000001A5, 0x0003003E, 0x000001A8, 0x000001A7, 0x00050041, 0x0000008D, 
+0x000001AB, 0x000000CC, 0x0000017C, 0x0004003D, 0x00000052, 0x000001AC, 0x000001AB, 0x0003003E, 
+0x000001AA, 0x000001AC, 0x0004003D, 0x00000052, 0x000001AE, 0x0000019E, 0x0003003E, 0x000001AD, 
+0x000001AE, 0x0004003D, 0x000000CD, 0x000001B0, 0x000000CC, 0x0003003E, 0x000001AF, 0x000001B0, 
+0x00070039, 0x00000052, 0x000001B1, 0x000001A9, 0x000001AA, 0x000001AD, 0x000001AF, 0x0003003E, 
+0x000001B2, 0x000001B1, 0x0004003D, 0x00000052, 0x000001B3, 0x000001A8, 0x0004003D, 0x00000052, 
+0x000001B4, 0x000001B2, 0x00050081, 0x00000052, 0x000001B5, 0x000001B3, 0x000001B4, 0x00050041, 
+0x0000008D, 0x000001B6, 0x000000CC, 0x00000020, 0x0004003D, 0x00000052, 0x000001B7, 0x000001B6, 
+0x00050081, 0x00000052, 0x000001B8, 0x000001B5, 0x000001B7, 0x0003003E, 0x000001B9, 0x000001B8, 
+0x0004003D, 0x00000052, 0x000001BA, 0x000001B9, 0x00050051, 0x00000004, 0x000001BB, 0x000001BA, 
+0x00000000, 0x00050051, 0x00000004, 0x000001BC, 0x000001BA, 0x00000001, 0x00050051, 0x00000004, 
+0x000001BD, 0x000001BA, 0x00000002, 0x00070050, 0x00000005, 0x000001BE, 0x000001BB, 0x000001BC, 
+0x000001BD, 0x0000005F, 0x0003003E, 0x00000059, 0x000001BE, 0x00050041, 0x000001C1, 0x000001C0, 
+0x00000018, 0x000001BF, 0x0004003D, 0x00000009, 0x000001C2, 0x000001C0, 0x000500AD, 0x0000006E, 
+0x000001C3, 0x000001C2, 0x0000000A, 0x000300F7, 0x000001C5, 0x00000000, 0x000400FA, 0x000001C3, 
+0x000001C4, 0x000001C5, 0x000200F8, 0x000001C4, 0x00050041, 0x000001C1, 0x000001C6, 0x00000018, 
+0x000001BF, 0x0004003D, 0x00000009, 0x000001C7, 0x000001C6, 0x000300F7, 0x000001C8, 0x00000000, 
+0x001100FB, 0x000001C7, 0x000001C8, 0x00000001, 0x000001C9, 0x00000002, 0x000001CA, 0x00000003, 
+0x000001CB, 0x00000004, 0x000001CC, 0x00000005, 0x000001CD, 0x00000006, 0x000001CE, 0x00000007, 
+0x000001CF, 0x000200F8, 0x000001C9, 0x00050041, 0x00000064, 0x000001D0, 0x000000CC, 0x0000000A, 
+0x0004003D, 0x00000005, 0x000001D1, 0x000001D0, 0x0003003E, 0x00000059, 0x000001D1, 0x000200F9, 
+0x000001C8, 0x000200F8, 0x000001CA, 0x00050041, 0x00000067, 0x000001D2, 0x000000CC, 0x00000012, 
+0x0004003D, 0x00000004, 0x000001D3, 0x000001D2, 0x00060050, 0x00000052, 0x000001D4, 0x000001D3, 
+0x000001D3, 0x000001D3, 0x00050051, 0x00000004, 0x000001D5, 0x000001D4, 0x00000000, 0x00050051, 
+0x00000004, 0x000001D6, 0x000001D4, 0x00000001, 0x00050051, 0x00000004, 0x000001D7, 0x000001D4, 
+0x00000002, 0x00070050, 0x00000005, 0x000001D8, 0x000001D5, 0x000001D6, 0x000001D7, 0x0000005F, 
+0x0003003E, 0x00000059, 0x000001D8, 0x000200F9, 0x000001C8, 0x000200F8, 0x000001CB, 0x00050041, 
+0x00000067, 0x000001D9, 0x000000CC, 0x00000028, 0x0004003D, 0x00000004, 0x000001DA, 0x000001D9, 
+0x00060050, 0x00000052, 0x000001DB, 0x000001DA, 0x000001DA, 0x000001DA, 0x00050051, 0x00000004, 
+0x000001DC, 0x000001DB, 0x00000000, 0x00050051, 0x00000004, 0x000001DD, 0x000001DB, 0x00000001, 
+0x00050051, 0x00000004, 0x000001DE, 0x000001DB, 0x00000002, 0x00070050, 0x00000005, 0x000001DF, 
+0x000001DC, 0x000001DD, 0x000001DE, 0x0000005F, 0x0003003E, 0x00000059, 0x000001DF, 0x000200F9, 
+0x000001C8, 0x000200F8, 0x000001CC, 0x00050041, 0x00000067, 0x000001E0, 0x000000CC, 0x00000048, 
+0x0004003D, 0x00000004, 0x000001E1, 0x000001E0, 0x00060050, 0x00000052, 0x000001E2, 0x000001E1, 
+0x000001E1, 0x000001E1, 0x00050051, 0x00000004, 0x000001E3, 0x000001E2, 0x00000000, 0x00050051, 
+0x00000004, 0x000001E4, 0x000001E2, 0x00000001, 0x00050051, 0x00000004, 0x000001E5, 0x000001E2, 
+0x00000002, 0x00070050, 0x00000005, 0x000001E6, 0x000001E3, 0x000001E4, 0x000001E5, 0x0000005F, 
+0x0003003E, 0x00000059, 0x000001E6, 0x000200F9, 0x000001C8, 0x000200F8, 0x000001CD, 0x00050041, 
+0x0000008D, 0x000001E7, 0x000000CC, 0x00000020, 0x0004003D, 0x00000052, 0x000001E8, 0x000001E7, 
+0x00050051, 0x00000004, 0x000001E9, 0x000001E8, 0x00000000, 0x00050051, 0x00000004, 0x000001EA, 
+0x000001E8, 0x00000001, 0x00050051, 0x00000004, 0x000001EB, 0x000001E8, 0x00000002, 0x00070050, 
+0x00000005, 0x000001EC, 0x000001E9, 0x000001EA, 0x000001EB, 0x0000005F, 0x0003003E, 0x00000059, 
+0x000001EC, 0x000200F9, 0x000001C8, 0x000200F8, 0x000001CE, 0x00050041, 0x0000008D, 0x000001ED, 
+0x000000CC, 0x00000016, 0x0004003D, 0x00000052, 0x000001EE, 0x000001ED, 0x00050051, 0x00000004, 
+0x000001EF, 0x000001EE, 0x00000000, 0x00050051, 0x00000004, 0x000001F0, 0x000001EE, 0x00000001, 
+0x00050051, 0x00000004, 0x000001F1, 0x000001EE, 0x00000002, 0x00070050, 0x00000005, 0x000001F2, 
+0x000001EF, 0x000001F0, 0x000001F1, 0x0000005F, 0x0003003E, 0x00000059, 0x000001F2, 0x000200F9, 
+0x000001C8, 0x000200F8, 0x000001CF, 0x0004003D, 0x00000052, 0x000001F5, 0x00000150, 0x0003003E, 
+0x000001F4, 0x000001F5, 0x00050039, 0x00000009, 0x000001F6, 0x000001F3, 0x000001F4, 0x0003003E, 
+0x000001F7, 0x000001F6, 0x0004003D, 0x00000009, 0x000001F9, 0x000001F7, 0x000300F7, 0x000001FA, 
+0x00000000, 0x000B00FB, 0x000001F9, 0x000001FA, 0x00000000, 0x000001FB, 0x00000001, 0x000001FC, 
+0x00000002, 0x000001FD, 0x00000003, 0x000001FE, 0x000200F8, 0x000001FB, 0x0004003D, 0x00000005, 
+0x000001FF, 0x00000059, 0x00050085, 0x00000005, 0x00000203, 0x000001FF, 0x00000202, 0x0003003E, 
+0x00000059, 0x00000203, 0x000200F9, 0x000001FA, 0x000200F8, 0x000001FC, 0x0004003D, 0x00000005, 
+0x00000204, 0x00000059, 0x00050085, 0x00000005, 0x00000206, 0x00000204, 0x00000205, 0x0003003E, 
+0x00000059, 0x00000206, 0x000200F9, 0x000001FA, 0x000200F8, 0x000001FD, 0x0004003D, 0x00000005, 
+0x00000207, 0x00000059, 0x00050085, 0x00000005, 0x00000209, 0x00000207, 0x00000208, 0x0003003E, 
+0x00000059, 0x00000209, 0x000200F9, 0x000001FA, 0x000200F8, 0x000001FE, 0x0004003D, 0x00000005, 
+0x0000020A, 0x00000059, 0x00050085, 0x00000005, 0x0000020C, 0x0000020A, 0x0000020B, 0x0003003E, 
+0x00000059, 0x0000020C, 0x000200F9, 0x000001FA, 0x000200F8, 0x000001FA, 0x000200F9, 0x000001C8, 
+0x000200F8, 0x000001C8, 0x000200F9, 0x000001C5, 0x000200F8, 0x000001C5, 0x000100FD, 0x00010038, 
+0x00050036, 0x00000005, 0x00000061, 0x00000000, 0x0000020D, 0x000200F8, 0x0000020E, 0x0004003B, 
+0x00000064, 0x00000220, 0x00000007, 0x00050041, 0x0000006B, 0x0000020F, 0x00000013, 0x00000020, 
+0x0004003D, 0x00000004, 0x00000210, 0x0000020F, 0x000500B8, 0x0000006E, 0x00000212, 0x00000210, 
+0x00000211, 0x000300F7, 0x00000214, 0x00000000, 0x000400FA, 0x00000212, 0x00000213, 0x00000214, 
+0x000200F8, 0x00000213, 0x00050041, 0x00000152, 0x00000215, 0x00000013, 0x0000000A, 0x0004003D, 
+0x00000005, 0x00000216, 0x00000215, 0x000200FE, 0x00000216, 0x000200F8, 0x00000214, 0x00050041, 
+0x00000152, 0x00000217, 0x00000013, 0x0000000A, 0x0004003D, 0x00000005, 0x00000218, 0x00000217, 
+0x00050041, 0x0000006B, 0x00000219, 0x00000013, 0x00000020, 0x0004003D, 0x00000004, 0x0000021A, 
+0x00000219, 0x0004003D, 0x00000023, 0x0000021B, 0x00000021, 0x00050041, 0x00000088, 0x0000021C, 
+0x00000051, 0x00000012, 0x0004003D, 0x00000053, 0x0000021D, 0x0000021C, 0x00050057, 0x00000005, 
+0x0000021E, 0x0000021B, 0x0000021D, 0x0003003E, 0x00000220, 0x0000021E, 0x00050039, 0x00000005, 
+0x00000221, 0x0000021F, 0x00000220, 0x0005008E, 0x00000005, 0x00000222, 0x00000221, 0x0000021A, 
+0x00050085, 0x00000005, 0x00000223, 0x00000218, 0x00000222, 0x000200FE, 0x00000223, 0x00010038, 
+0x00050036, 0x00000052, 0x0000007B, 0x00000000, 0x00000224, 0x000200F8, 0x00000225, 0x00050041, 
+0x0000006B, 0x00000226, 0x00000013, 0x00000016, 0x0004003D, 0x00000004, 0x00000227, 0x00000226, 
+0x000500B8, 0x0000006E, 0x00000228, 0x00000227, 0x00000211, 0x000300F7, 0x0000022A, 0x00000000, 
+0x000400FA, 0x00000228, 0x00000229, 0x0000022A, 0x000200F8, 0x00000229, 0x00050041, 0x0000006B, 
+0x0000022B, 0x00000013, 0x0000001F, 0x0004003D, 0x00000004, 0x0000022C, 0x0000022B, 0x00060050, 
+0x00000052, 0x0000022D, 0x0000022C, 0x0000022C, 0x0000022C, 0x000200FE, 0x0000022D, 0x000200F8, 
+0x0000022A, 0x00050041, 0x0000006B, 0x0000022E, 0x00000013, 0x00000016, 0x0004003D, 0x00000004, 
+0x0000022F, 0x0000022E, 0x00050083, 0x00000004, 0x00000230, 0x0000005F, 0x0000022F, 0x00050041, 
+0x0000006B, 0x00000231, 0x00000013, 0x0000001F, 0x0004003D, 0x00000004, 0x00000232, 0x00000231, 
+0x00050085, 0x00000004, 0x00000233, 0x00000230, 0x00000232, 0x00050041, 0x0000006B, 0x00000234, 
+0x00000013, 0x00000016, 0x0004003D, 0x00000004, 0x00000235, 0x00000234, 0x0004003D, 0x00000023, 
+0x00000236, 0x00000025, 0x00050041, 0x00000088, 0x00000237, 0x00000051, 0x00000012, 0x0004003D, 
+0x00000053, 0x00000238, 0x00000237, 0x00050057, 0x00000005, 0x00000239, 0x00000236, 0x00000238, 
+0x0008004F, 0x00000052, 0x0000023A, 0x00000239, 0x00000239, 0x00000000, 0x00000001, 0x00000002, 
+0x0005008E, 0x00000052, 0x0000023B, 0x0000023A, 0x00000235, 0x00060050, 0x00000052, 0x0000023C, 
+0x00000233, 0x00000233, 0x00000233, 0x00050081, 0x00000052, 0x0000023D, 0x0000023C, 0x0000023B, 
+0x000200FE, 0x0000023D, 0x00010038, 0x00050036, 0x00000004, 0x0000007E, 0x00000000, 0x0000023E, 
+0x000200F8, 0x0000023F, 0x00050041, 0x0000006B, 0x00000240, 0x00000013, 0x00000048, 0x0004003D, 
+0x00000004, 0x00000241, 0x00000240, 0x000500B8, 0x0000006E, 0x00000242, 0x00000241, 0x00000211, 
+0x000300F7, 0x00000244, 0x00000000, 0x000400FA, 0x00000242, 0x00000243, 0x00000244, 0x000200F8, 
+0x00000243, 0x00050041, 0x0000006B, 0x00000245, 0x00000013, 0x00000012, 0x0004003D, 0x00000004, 
+0x00000246, 0x00000245, 0x000200FE, 0x00000246, 0x000200F8, 0x00000244, 0x00050041, 0x0000006B, 
+0x00000247, 0x00000013, 0x00000048, 0x0004003D, 0x00000004, 0x00000248, 0x00000247, 0x00050083, 
+0x00000004, 0x00000249, 0x0000005F, 0x00000248, 0x00050041, 0x0000006B, 0x0000024A, 0x00000013, 
+0x00000012, 0x0004003D, 0x00000004, 0x0000024B, 0x0000024A, 0x00050085, 0x00000004, 0x0000024C, 
+0x00000249, 0x0000024B, 0x00050041, 0x0000006B, 0x0000024D, 0x00000013, 0x00000048, 0x0004003D, 
+0x00000004, 0x0000024E, 0x0000024D, 0x0004003D, 0x00000023, 0x0000024F, 0x00000026, 0x00050041, 
+0x00000088, 0x00000250, 0x00000051, 0x00000012, 0x0004003D, 0x00000053, 0x00000251, 0x00000250, 
+0x00050057, 0x00000005, 0x00000252, 0x0000024F, 0x00000251, 0x00050051, 0x00000004, 0x00000253, 
+0x00000252, 0x00000000, 0x00050085, 0x00000004, 0x00000254, 0x0000024E, 0x00000253, 0x00050081, 
+0x00000004, 0x00000255, 0x0000024C, 0x00000254, 0x000200FE, 0x00000255, 0x00010038, 0x00050036, 
+0x00000004, 0x000000F9, 0x00000000, 0x0000023E, 0x000200F8, 0x00000256, 0x00050041, 0x0000006B, 
+0x00000257, 0x00000013, 0x0000017C, 0x0004003D, 0x00000004, 0x00000258, 0x00000257, 0x000500B8, 
+0x0000006E, 0x00000259, 0x00000258, 0x00000211, 0x000300F7, 0x0000025B, 0x00000000, 0x000400FA, 
+0x00000259, 0x0000025A, 0x0000025B, 0x000200F8, 0x0000025A, 0x000200FE, 0x0000005F, 0x000200F8, 
+0x0000025B, 0x00050041, 0x0000006B, 0x0000025C, 0x00000013, 0x0000017C, 0x0004003D, 0x00000004, 
+0x0000025D, 0x0000025C, 0x00050083, 0x00000004, 0x0000025E, 0x0000005F, 0x0000025D, 0x00050041, 
+0x0000006B, 0x0000025F, 0x00000013, 0x0000017C, 0x0004003D, 0x00000004, 0x00000260, 0x0000025F, 
+0x0004003D, 0x00000023, 0x00000261, 0x00000029, 0x00050041, 0x00000088, 0x00000262, 0x00000051, 
+0x00000012, 0x0004003D, 0x00000053, 0x00000263, 0x00000262, 0x00050057, 0x00000005, 0x00000264, 
+0x00000261, 0x00000263, 0x00050051, 0x00000004, 0x00000265, 0x00000264, 0x00000000, 0x00050085, 
+0x00000004, 0x00000266, 0x00000260, 0x00000265, 0x00050081, 0x00000004, 0x00000267, 0x0000025E, 
+0x00000266, 0x000200FE, 0x00000267, 0x00010038, 0x00050036, 0x00000052, 0x000000FC, 0x00000000, 
+0x00000268, 0x00030037, 0x0000008D, 0x00000269, 0x000200F8, 0x0000026A, 0x0004003B, 0x0000008D, 
+0x00000280, 0x00000007, 0x00050041, 0x0000006B, 0x0000026B, 0x00000013, 0x0000003D, 0x0004003D, 
+0x00000004, 0x0000026C, 0x0000026B, 0x000500B8, 0x0000006E, 0x0000026D, 0x0000026C, 0x00000211, 
+0x000300F7, 0x0000026F, 0x00000000, 0x000400FA, 0x0000026D, 0x0000026E, 0x0000026F, 0x000200F8, 
+0x0000026E, 0x00050041, 0x0000006B, 0x00000270, 0x00000013, 0x0000000B, 0x0004003D, 0x00000004, 
+0x00000271, 0x00000270, 0x0004003D, 0x00000052, 0x00000272, 0x00000269, 0x0005008E, 0x00000052, 
+0x00000273, 0x00000272, 0x00000271, 0x000200FE, 0x00000273, 0x000200F8, 0x0000026F, 0x00050041, 
+0x0000006B, 0x00000274, 0x00000013, 0x0000000B, 0x0004003D, 0x00000004, 0x00000275, 0x00000274, 
+0x0004003D, 0x00000052, 0x00000276, 0x00000269, 0x0005008E, 0x00000052, 0x00000277, 0x00000276, 
+0x00000275, 0x00050041, 0x0000006B, 0x00000278, 0x00000013, 0x0000003D, 0x0004003D, 0x00000004, 
+0x00000279, 0x00000278, 0x0004003D, 0x00000023, 0x0000027A, 0x0000002A, 0x00050041, 0x00000088, 
+0x0000027B, 0x00000051, 0x00000012, 0x0004003D, 0x00000053, 0x0000027C, 0x0000027B, 0x00050057, 
+0x00000005, 0x0000027D, 0x0000027A, 0x0000027C, 0x0008004F, 0x00000052, 0x0000027E, 0x0000027D, 
+0x0000027D, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x00000280, 0x0000027E, 0x00050039, 
+0x00000052, 0x00000281, 0x0000027F, 0x00000280, 0x0005008E, 0x00000052, 0x00000282, 0x00000281, 
+0x00000279, 0x00050081, 0x00000052, 0x00000283, 0x00000277, 0x00000282, 0x000200FE, 0x00000283, 
+0x00010038, 0x00050036, 0x00000004, 0x0000011F, 0x00000000, 0x00000284, 0x00030037, 0x00000067, 
+0x00000285, 0x000200F8, 0x00000286, 0x0004003D, 0x00000004, 0x00000287, 0x00000285, 0x0004003D, 
+0x00000004, 0x00000288, 0x00000285, 0x00050085, 0x00000004, 0x00000289, 0x00000287, 0x00000288, 
+0x000200FE, 0x00000289, 0x00010038, 0x00050036, 0x00000004, 0x00000141, 0x00000000, 0x00000284, 
+0x00030037, 0x00000067, 0x0000028A, 0x000200F8, 0x0000028B, 0x0004003D, 0x00000004, 0x0000028C, 
+0x0000028A, 0x0008000C, 0x00000004, 0x0000028D, 0x00000001, 0x0000002B, 0x0000028C, 0x00000071, 
+0x0000005F, 0x000200FE, 0x0000028D, 0x00010038, 0x00050036, 0x00000004, 0x0000016A, 0x00000000, 
+0x00000284, 0x00030037, 0x00000067, 0x0000028E, 0x000200F8, 0x0000028F, 0x0004003D, 0x00000004, 
+0x00000291, 0x0000028E, 0x00050085, 0x00000004, 0x00000292, 0x00000290, 0x00000291, 0x0004003D, 
+0x00000004, 0x00000293, 0x0000028E, 0x00050085, 0x00000004, 0x00000294, 0x00000292, 0x00000293, 
+0x000200FE, 0x00000294, 0x00010038, 0x00050036, 0x00000052, 0x00000172, 0x00000000, 0x00000295, 
+0x00030037, 0x00000064, 0x00000296, 0x00030037, 0x00000067, 0x00000297, 0x00030037, 0x00000067, 
+0x00000298, 0x000200F8, 0x00000299, 0x0004003D, 0x00000005, 0x0000029A, 0x00000296, 0x0008004F, 
+0x00000052, 0x0000029B, 0x0000029A, 0x0000029A, 0x00000000, 0x00000001, 0x00000002, 0x0004003D, 
+0x00000004, 0x0000029C, 0x00000297, 0x0005008E, 0x00000052, 0x0000029D, 0x0000029B, 0x0000029C, 
+0x0004003D, 0x00000004, 0x0000029E, 0x00000298, 0x0004003D, 0x00000004, 0x0000029F, 0x00000297, 
+0x00050083, 0x00000004, 0x000002A0, 0x0000005F, 0x0000029F, 0x00050085, 0x00000004, 0x000002A1, 
+0x0000029E, 0x000002A0, 0x00060050, 0x00000052, 0x000002A2, 0x000002A1, 0x000002A1, 0x000002A1, 
+0x00050081, 0x00000052, 0x000002A3, 0x0000029D, 0x000002A2, 0x000200FE, 0x000002A3, 0x00010038, 
+0x00050036, 0x00000052, 0x0000018B, 0x00000000, 0x000002A4, 0x00030037, 0x00000064, 0x000002A5, 
+0x00030037, 0x00000067, 0x000002A6, 0x000200F8, 0x000002A7, 0x0004003D, 0x00000005, 0x000002A8, 
+0x000002A5, 0x0008004F, 0x00000052, 0x000002A9, 0x000002A8, 0x000002A8, 0x00000000, 0x00000001, 
+0x00000002, 0x0004003D, 0x00000004, 0x000002AA, 0x000002A6, 0x00050083, 0x00000004, 0x000002AB, 
+0x0000005F, 0x000002AA, 0x0005008E, 0x00000052, 0x000002AC, 0x000002A9, 0x000002AB, 0x000200FE, 
+0x000002AC, 0x00010038, 0x00050036, 0x00000052, 0x0000019F, 0x00000000, 0x000002AD, 0x00030037, 
+0x0000008D, 0x000002AE, 0x00030037, 0x0000008D, 0x000002AF, 0x00030037, 0x000000CE, 0x000002B0, 
+0x000200F8, 0x000002B1, 0x0004003B, 0x0000008D, 0x000002B3, 0x00000007, 0x0004003B, 0x000001F8, 
+0x000002B4, 0x00000007, 0x0004003B, 0x000002C2, 0x000002C0, 0x00000007, 0x0004003B, 0x0000008D, 
+0x000002CE, 0x00000007, 0x0004003B, 0x000000CE, 0x000002D0, 0x00000007, 0x0004003B, 0x0000008D, 
+0x000002E1, 0x00000007, 0x0004003B, 0x0000008D, 0x000002E3, 0x00000007, 0x0004003B, 0x000002E8, 
+0x000002E7, 0x00000007, 0x0004003B, 0x000002E8, 0x000002EA, 0x00000007, 0x0004003B, 0x000002E8, 
+0x000002EE, 0x00000007, 0x0004003B, 0x000002E8, 0x000002F2, 0x00000007, 0x0004003B, 0x000002E8, 
+0x000002F4, 0x00000007, 0x0004003B, 0x000002E8, 0x00000301, 0x00000007, 0x0004003B, 0x000002C2, 
+0x00000303, 0x00000007, 0x0004003B, 0x0000008D, 0x0000030E, 0x00000007, 0x0004003B, 0x000000CE, 
+0x00000310, 0x00000007, 0x0003003E, 0x000002B3, 0x000002B2, 0x0003003E, 0x000002B4, 0x0000000A, 
+0x000200F9, 0x000002B5, 0x000200F8, 0x000002B5, 0x000400F6, 0x000002B9, 0x000002B8, 0x00000000, 
+0x000200F9, 0x000002B6, 0x000200F8, 0x000002B6, 0x0004003D, 0x00000009, 0x000002BA, 0x000002B4, 
+0x00050041, 0x000001C1, 0x000002BB, 0x00000018, 0x00000069, 0x0004003D, 0x00000009, 0x000002BC, 
+0x000002BB, 0x000500B1, 0x0000006E, 0x000002BD, 0x000002BA, 0x000002BC, 0x000400FA, 0x000002BD, 
+0x000002B7, 0x000002B9, 0x000200F8, 0x000002B7, 0x0004003D, 0x00000009, 0x000002BE, 0x000002B4, 
+0x00060041, 0x000002C4, 0x000002C3, 0x00000018, 0x0000000A, 0x000002BE, 0x0004003D, 0x00000019, 
+0x000002C5, 0x000002C3, 0x00050051, 0x00000005, 0x000002C6, 0x000002C5, 0x00000000, 0x00050051, 
+0x00000005, 0x000002C7, 0x000002C5, 0x00000001, 0x00050051, 0x00000005, 0x000002C8, 0x000002C5, 
+0x00000002, 0x00050051, 0x00000004, 0x000002C9, 0x000002C5, 0x00000003, 0x00050051, 0x00000004, 
+0x000002CA, 0x000002C5, 0x00000004, 0x00050051, 0x00000004, 0x000002CB, 0x000002C5, 0x00000005, 
+0x00050051, 0x00000004, 0x000002CC, 0x000002C5, 0x00000006, 0x000A0050, 0x000002C1, 0x000002CD, 
+0x000002C6, 0x000002C7, 0x000002C8, 0x000002C9, 0x000002CA, 0x000002CB, 0x000002CC, 0x0003003E, 
+0x000002C0, 0x000002CD, 0x0004003D, 0x00000052, 0x000002CF, 0x000002AF, 0x0003003E, 0x000002CE, 
+0x000002CF, 0x0004003D, 0x000000CD, 0x000002D1, 0x000002B0, 0x0003003E, 0x000002D0, 0x000002D1, 
+0x00070039, 0x00000052, 0x000002D2, 0x000002BF, 0x000002C0, 0x000002CE, 0x000002D0, 0x0004003D, 
+0x00000052, 0x000002D3, 0x000002B3, 0x00050081, 0x00000052, 0x000002D4, 0x000002D3, 0x000002D2, 
+0x0003003E, 0x000002B3, 0x000002D4, 0x000200F9, 0x000002B8, 0x000200F8, 0x000002B8, 0x0004003D, 
+0x00000009, 0x000002D5, 0x000002B4, 0x00050080, 0x00000009, 0x000002D6, 0x000002D5, 0x00000012, 
+0x0003003E, 0x000002B4, 0x000002D6, 0x000200F9, 0x000002B5, 0x000200F8, 0x000002B9, 0x00050041, 
+0x000002D8, 0x000002D7, 0x00000018, 0x0000001F, 0x0004003D, 0x00000006, 0x000002D9, 0x000002D7, 
+0x0004003D, 0x00000052, 0x000002DA, 0x000002AF, 0x00050051, 0x00000004, 0x000002DB, 0x000002DA, 
+0x00000000, 0x00050051, 0x00000004, 0x000002DC, 0x000002DA, 0x00000001, 0x00050051, 0x00000004, 
+0x000002DD, 0x000002DA, 0x00000002, 0x00070050, 0x00000005, 0x000002DE, 0x000002DB, 0x000002DC, 
+0x000002DD, 0x0000005F, 0x00050091, 0x00000005, 0x000002DF, 0x000002D9, 0x000002DE, 0x0008004F, 
+0x00000052, 0x000002E0, 0x000002DF, 0x000002DF, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 
+0x000002E1, 0x000002E0, 0x0004003D, 0x00000052, 0x000002E4, 0x000002E1, 0x0003003E, 0x000002E3, 
+0x000002E4, 0x00050039, 0x0000000D, 0x000002E5, 0x000002E2, 0x000002E3, 0x0003003E, 0x000002E7, 
+0x000002E5, 0x00050039, 0x0000000D, 0x000002E9, 0x000002E6, 0x000002E7, 0x0003003E, 0x000002EA, 
+0x000002E9, 0x0004003D, 0x0000000D, 0x000002EB, 0x000002EA, 0x000500C7, 0x0000000D, 0x000002ED, 
+0x000002EB, 0x000002EC, 0x0003003E, 0x000002EE, 0x000002ED, 0x0004003D, 0x0000000D, 0x000002EF, 
+0x000002EA, 0x000500C2, 0x0000000D, 0x000002F1, 0x000002EF, 0x000002F0, 0x0003003E, 0x000002F2, 
+0x000002F1, 0x0003003E, 0x000002F4, 0x000002F3, 0x000200F9, 0x000002F5, 0x000200F8, 0x000002F5, 
+0x000400F6, 0x000002F9, 0x000002F8, 0x00000000, 0x000200F9, 0x000002F6, 0x000200F8, 0x000002F6, 
+0x0004003D, 0x0000000D, 0x000002FA, 0x000002F4, 0x0004003D, 0x0000000D, 0x000002FB, 0x000002F2, 
+0x000500B0, 0x0000006E, 0x000002FC, 0x000002FA, 0x000002FB, 0x000400FA, 0x000002FC, 0x000002F7, 
+0x000002F9, 0x000200F8, 0x000002F7, 0x0004003D, 0x0000000D, 0x000002FD, 0x000002EE, 0x0004003D, 
+0x0000000D, 0x000002FE, 0x000002F4, 0x00050080, 0x0000000D, 0x000002FF, 0x000002FD, 0x000002FE, 
+0x0003003E, 0x00000301, 0x000002FF, 0x00050039, 0x0000000D, 0x00000302, 0x00000300, 0x00000301, 
+0x00060041, 0x000002C4, 0x00000304, 0x00000037, 0x0000000A, 0x00000302, 0x0004003D, 0x00000019, 
+0x00000305, 0x00000304, 0x00050051, 0x00000005, 0x00000306, 0x00000305, 0x00000000, 0x00050051, 
+0x00000005, 0x00000307, 0x00000305, 0x00000001, 0x00050051, 0x00000005, 0x00000308, 0x00000305, 
+0x00000002, 0x00050051, 0x00000004, 0x00000309, 0x00000305, 0x00000003, 0x00050051, 0x00000004, 
+0x0000030A, 0x00000305, 0x00000004, 0x00050051, 0x00000004, 0x0000030B, 0x00000305, 0x00000005, 
+0x00050051, 0x00000004, 0x0000030C, 0x00000305, 0x00000006, 0x000A0050, 0x000002C1, 0x0000030D, 
+0x00000306, 0x00000307, 0x00000308, 0x00000309, 0x0000030A, 0x0000030B, 0x0000030C, 0x0003003E, 
+0x00000303, 0x0000030D, 0x0004003D, 0x00000052, 0x0000030F, 0x000002AF, 0x0003003E, 0x0000030E, 
+0x0000030F, 0x0004003D, 0x000000CD, 0x00000311, 0x000002B0, 0x0003003E, 0x00000310, 0x00000311, 
+0x00070039, 0x00000052, 0x00000312, 0x000002BF, 0x00000303, 0x0000030E, 0x00000310, 0x0004003D, 
+0x00000052, 0x00000313, 0x000002B3, 0x00050081, 0x00000052, 0x00000314, 0x00000313, 0x00000312, 
+0x0003003E, 0x000002B3, 0x00000314, 0x000200F9, 0x000002F8, 0x000200F8, 0x000002F8, 0x0004003D, 
+0x0000000D, 0x00000315, 0x000002F4, 0x00050080, 0x0000000D, 0x00000316, 0x00000315, 0x000000A3, 
+0x0003003E, 0x000002F4, 0x00000316, 0x000200F9, 0x000002F5, 0x000200F8, 0x000002F9, 0x0004003D, 
+0x00000052, 0x00000317, 0x000002B3, 0x000200FE, 0x00000317, 0x00010038, 0x00050036, 0x00000052, 
+0x000001A9, 0x00000000, 0x000002AD, 0x00030037, 0x0000008D, 0x00000318, 0x00030037, 0x0000008D, 
+0x00000319, 0x00030037, 0x000000CE, 0x0000031A, 0x000200F8, 0x0000031B, 0x0004003B, 0x0000008D, 
+0x00000321, 0x00000007, 0x0004003B, 0x0000008D, 0x00000323, 0x00000007, 0x0004003B, 0x00000067, 
+0x00000325, 0x00000007, 0x0004003B, 0x00000067, 0x00000328, 0x00000007, 0x0004003B, 0x0000008D, 
+0x0000032C, 0x00000007, 0x0004003B, 0x0000008D, 0x00000333, 0x00000007, 0x0004003B, 0x0000008D, 
+0x00000339, 0x00000007, 0x0004003B, 0x000001F8, 0x0000033D, 0x00000007, 0x0004003B, 0x0000008D, 
+0x00000347, 0x00000007, 0x0004003B, 0x0000008D, 0x00000352, 0x00000007, 0x0004003D, 0x00000031, 
+0x0000031C, 0x00000033, 0x00050041, 0x0000008D, 0x0000031D, 0x0000031A, 0x00000016, 0x0004003D, 
+0x00000052, 0x0000031E, 0x0000031D, 0x00050057, 0x00000005, 0x0000031F, 0x0000031C, 0x0000031E, 
+0x0008004F, 0x00000052, 0x00000320, 0x0000031F, 0x0000031F, 0x00000000, 0x00000001, 0x00000002, 
+0x0003003E, 0x00000321, 0x00000320, 0x0004003D, 0x00000052, 0x00000324, 0x00000318, 0x0003003E, 
+0x00000323, 0x00000324, 0x00050041, 0x00000067, 0x00000326, 0x0000031A, 0x0000003D, 0x0004003D, 
+0x00000004, 0x00000327, 0x00000326, 0x0003003E, 0x00000325, 0x00000327, 0x00050041, 0x00000067, 
+0x00000329, 0x0000031A, 0x0000001F, 0x0004003D, 0x00000004, 0x0000032A, 0x00000329, 0x0003003E, 
+0x00000328, 0x0000032A, 0x00070039, 0x00000052, 0x0000032B, 0x00000322, 0x00000323, 0x00000325, 
+0x00000328, 0x0003003E, 0x0000032C, 0x0000032B, 0x0004003D, 0x00000052, 0x0000032D, 0x0000032C, 
+0x00050083, 0x00000052, 0x0000032E, 0x000000E9, 0x0000032D, 0x00050041, 0x00000067, 0x0000032F, 
+0x0000031A, 0x00000012, 0x0004003D, 0x00000004, 0x00000330, 0x0000032F, 0x00050083, 0x00000004, 
+0x00000331, 0x0000005F, 0x00000330, 0x0005008E, 0x00000052, 0x00000332, 0x0000032E, 0x00000331, 
+0x0003003E, 0x00000333, 0x00000332, 0x00050041, 0x00000064, 0x00000334, 0x0000031A, 0x0000000A, 
+0x0004003D, 0x00000005, 0x00000335, 0x00000334, 0x0008004F, 0x00000052, 0x00000336, 0x00000335, 
+0x00000335, 0x00000000, 0x00000001, 0x00000002, 0x0004003D, 0x00000052, 0x00000337, 0x00000321, 
+0x00050085, 0x00000052, 0x00000338, 0x00000336, 0x00000337, 0x0003003E, 0x00000339, 0x00000338, 
+0x00050041, 0x000001C1, 0x0000033B, 0x00000018, 0x0000033A, 0x0004003D, 0x00000009, 0x0000033C, 
+0x0000033B, 0x0003003E, 0x0000033D, 0x0000033C, 0x0004003D, 0x00000031, 0x0000033E, 0x0000002F, 
+0x0004003D, 0x00000052, 0x0000033F, 0x00000319, 0x00050041, 0x00000067, 0x00000340, 0x0000031A, 
+0x00000028, 0x0004003D, 0x00000004, 0x00000341, 0x00000340, 0x0004003D, 0x00000009, 0x00000342, 
+0x0000033D, 0x0004006F, 0x00000004, 0x00000343, 0x00000342, 0x00050085, 0x00000004, 0x00000344, 
+0x00000341, 0x00000343, 0x00070058, 0x00000005, 0x00000345, 0x0000033E, 0x0000033F, 0x00000002, 
+0x00000344, 0x0008004F, 0x00000052, 0x00000346, 0x00000345, 0x00000345, 0x00000000, 0x00000001, 
+0x00000002, 0x0003003E, 0x00000347, 0x00000346, 0x0004003D, 0x00000052, 0x00000348, 0x00000347, 
+0x0004003D, 0x00000052, 0x00000349, 0x0000032C, 0x00060041, 0x00000067, 0x0000034A, 0x0000031A, 
+0x00000074, 0x000002F3, 0x0004003D, 0x00000004, 0x0000034B, 0x0000034A, 0x0005008E, 0x00000052, 
+0x0000034C, 0x00000349, 0x0000034B, 0x00060041, 0x00000067, 0x0000034D, 0x0000031A, 0x00000074, 
+0x000000A3, 0x0004003D, 0x00000004, 0x0000034E, 0x0000034D, 0x00060050, 0x00000052, 0x0000034F, 
+0x0000034E, 0x0000034E, 0x0000034E, 0x00050081, 0x00000052, 0x00000350, 0x0000034C, 0x0000034F, 
+0x00050085, 0x00000052, 0x00000351, 0x00000348, 0x00000350, 0x0003003E, 0x00000352, 0x00000351, 
+0x0004003D, 0x00000052, 0x00000353, 0x00000333, 0x0004003D, 0x00000052, 0x00000354, 0x00000339, 
+0x00050085, 0x00000052, 0x00000355, 0x00000353, 0x00000354, 0x0004003D, 0x00000052, 0x00000356, 
+0x00000352, 0x00050081, 0x00000052, 0x00000357, 0x00000355, 0x00000356, 0x000200FE, 0x00000357, 
+0x00010038, 0x00050036, 0x00000009, 0x000001F3, 0x00000000, 0x00000358, 0x00030037, 0x0000008D, 
+0x00000359, 0x000200F8, 0x0000035A, 0x0004003B, 0x000001F8, 0x0000035B, 0x00000007, 0x0004003B, 
+0x00000064, 0x00000364, 0x00000007, 0x0004003B, 0x000001F8, 0x00000365, 0x00000007, 0x0003003E, 
+0x0000035B, 0x0000000A, 0x00050041, 0x000002D8, 0x0000035C, 0x00000018, 0x0000001F, 0x0004003D, 
+0x00000006, 0x0000035D, 0x0000035C, 0x0004003D, 0x00000052, 0x0000035E, 0x00000359, 0x00050051, 
+0x00000004, 0x0000035F, 0x0000035E, 0x00000000, 0x00050051, 0x00000004, 0x00000360, 0x0000035E, 
+0x00000001, 0x00050051, 0x00000004, 0x00000361, 0x0000035E, 0x00000002, 0x00070050, 0x00000005, 
+0x00000362, 0x0000035F, 0x00000360, 0x00000361, 0x0000005F, 0x00050091, 0x00000005, 0x00000363, 
+0x0000035D, 0x00000362, 0x0003003E, 0x00000364, 0x00000363, 0x0003003E, 0x00000365, 0x0000000A, 
+0x000200F9, 0x00000366, 0x000200F8, 0x00000366, 0x000400F6, 0x0000036A, 0x00000369, 0x00000000, 
+0x000200F9, 0x00000367, 0x000200F8, 0x00000367, 0x0004003D, 0x00000009, 0x0000036B, 0x00000365, 
+0x00050041, 0x000001C1, 0x0000036C, 0x00000018, 0x00000074, 0x0004003D, 0x00000009, 0x0000036D, 
+0x0000036C, 0x00050082, 0x00000009, 0x0000036E, 0x0000036D, 0x00000012, 0x000500B1, 0x0000006E, 
+0x0000036F, 0x0000036B, 0x0000036E, 0x000400FA, 0x0000036F, 0x00000368, 0x0000036A, 0x000200F8, 
+0x00000368, 0x00050041, 0x00000067, 0x00000370, 0x00000364, 0x00000096, 0x0004003D, 0x00000004, 
+0x00000371, 0x00000370, 0x0004003D, 0x00000009, 0x00000372, 0x00000365, 0x00070041, 0x0000006B, 
+0x00000373, 0x00000018, 0x00000016, 0x00000372, 0x000002F3, 0x0004003D, 0x00000004, 0x00000374, 
+0x00000373, 0x000500B8, 0x0000006E, 0x00000375, 0x00000371, 0x00000374, 0x000300F7, 0x00000377, 
+0x00000000, 0x000400FA, 0x00000375, 0x00000376, 0x00000377, 0x000200F8, 0x00000376, 0x0004003D, 
+0x00000009, 0x00000378, 0x00000365, 0x00050080, 0x00000009, 0x00000379, 0x00000378, 0x00000012, 
+0x0003003E, 0x0000035B, 0x00000379, 0x000200F9, 0x00000377, 0x000200F8, 0x00000377, 0x000200F9, 
+0x00000369, 0x000200F8, 0x00000369, 0x0004003D, 0x00000009, 0x0000037A, 0x00000365, 0x00050080, 
+0x00000009, 0x0000037B, 0x0000037A, 0x00000012, 0x0003003E, 0x00000365, 0x0000037B, 0x000200F9, 
+0x00000366, 0x000200F8, 0x0000036A, 0x0004003D, 0x00000009, 0x0000037C, 0x0000035B, 0x000200FE, 
+0x0000037C, 0x00010038, 0x00050036, 0x00000005, 0x0000021F, 0x00000000, 0x0000037D, 0x00030037, 
+0x00000064, 0x0000037E, 0x000200F8, 0x0000037F, 0x0004003B, 0x0000008D, 0x00000380, 0x00000007, 
+0x0004003D, 0x00000005, 0x00000381, 0x0000037E, 0x0008004F, 0x00000052, 0x00000382, 0x00000381, 
+0x00000381, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x00000380, 0x00000382, 0x00050039, 
+0x00000052, 0x00000383, 0x0000027F, 0x00000380, 0x00050041, 0x00000067, 0x00000384, 0x0000037E, 
+0x00000065, 0x0004003D, 0x00000004, 0x00000385, 0x00000384, 0x00050051, 0x00000004, 0x00000386, 
+0x00000383, 0x00000000, 0x00050051, 0x00000004, 0x00000387, 0x00000383, 0x00000001, 0x00050051, 
+0x00000004, 0x00000388, 0x00000383, 0x00000002, 0x00070050, 0x00000005, 0x00000389, 0x00000386, 
+0x00000387, 0x00000388, 0x00000385, 0x000200FE, 0x00000389, 0x00010038, 0x00050036, 0x00000052, 
+0x0000027F, 0x00000000, 0x00000268, 0x00030037, 0x0000008D, 0x0000038A, 0x000200F8, 0x0000038B, 
+0x0004003D, 0x00000052, 0x0000038C, 0x0000038A, 0x0007000C, 0x00000052, 0x0000038F, 0x00000001, 
+0x0000001A, 0x0000038C, 0x0000038E, 0x000200FE, 0x0000038F, 0x00010038, 0x00050036, 0x00000052, 
+0x000002BF, 0x00000000, 0x00000390, 0x00030037, 0x000002C2, 0x00000391, 0x00030037, 0x0000008D, 
+0x00000392, 0x00030037, 0x000000CE, 0x00000393, 0x000200F8, 0x00000394, 0x0004003B, 0x00000067, 
+0x00000395, 0x00000007, 0x0004003B, 0x0000008D, 0x000003A1, 0x00000007, 0x0004003B, 0x00000067, 
+0x000003A4, 0x00000007, 0x0004003B, 0x00000067, 0x000003AD, 0x00000007, 0x0004003B, 0x00000067, 
+0x000003B9, 0x00000007, 0x0004003B, 0x0000008D, 0x000003CC, 0x00000007, 0x0004003B, 0x00000067, 
+0x000003D0, 0x00000007, 0x0004003B, 0x00000067, 0x000003D3, 0x00000007, 0x0004003B, 0x00000067, 
+0x000003DC, 0x00000007, 0x0004003B, 0x00000067, 0x000003E2, 0x00000007, 0x0004003B, 0x00000067, 
+0x000003E8, 0x00000007, 0x0004003B, 0x00000067, 0x000003F9, 0x00000007, 0x0004003B, 0x0000008D, 
+0x00000406, 0x00000007, 0x0004003B, 0x000001F8, 0x00000409, 0x00000007, 0x0004003B, 0x0000008D, 
+0x0000040B, 0x00000007, 0x0004003B, 0x000001F8, 0x0000040D, 0x00000007, 0x0004003B, 0x0000008D, 
+0x0000040F, 0x00000007, 0x0004003B, 0x0000008D, 0x00000413, 0x00000007, 0x0004003B, 0x0000008D, 
+0x0000041A, 0x00000007, 0x0004003B, 0x0000008D, 0x00000421, 0x00000007, 0x0004003B, 0x0000008D, 
+0x00000427, 0x00000007, 0x0004003B, 0x00000067, 0x0000042C, 0x00000007, 0x0004003B, 0x00000067, 
+0x0000042E, 0x00000007, 0x0004003B, 0x0000008D, 0x00000434, 0x00000007, 0x0004003B, 0x00000067, 
+0x0000043B, 0x00000007, 0x0004003B, 0x00000067, 0x0000043D, 0x00000007, 0x0004003B, 0x00000067, 
+0x0000043F, 0x00000007, 0x0004003B, 0x00000067, 0x00000440, 0x00000007, 0x0004003B, 0x00000067, 
+0x00000443, 0x00000007, 0x0004003B, 0x00000067, 0x00000448, 0x00000007, 0x0004003B, 0x00000067, 
+0x0000044A, 0x00000007, 0x0004003B, 0x00000067, 0x0000044E, 0x00000007, 0x0004003B, 0x00000067, 
+0x00000450, 0x00000007, 0x0004003B, 0x000000CE, 0x00000452, 0x00000007, 0x0004003B, 0x00000067, 
+0x00000454, 0x00000007, 0x0004003B, 0x00000067, 0x00000456, 0x00000007, 0x0004003B, 0x00000067, 
+0x00000458, 0x00000007, 0x0004003B, 0x0000008D, 0x0000045B, 0x00000007, 0x0004003B, 0x000000CE, 
+0x0000045D, 0x00000007, 0x0004003B, 0x000002C2, 0x0000045F, 0x00000007, 0x0004003B, 0x0000008D, 
+0x00000461, 0x00000007, 0x0004003B, 0x00000067, 0x00000463, 0x00000007, 0x0004003B, 0x00000067, 
+0x00000465, 0x00000007, 0x0004003B, 0x00000067, 0x00000467, 0x00000007, 0x0004003B, 0x00000067, 
+0x00000469, 0x00000007, 0x0004003B, 0x0000008D, 0x0000046C, 0x00000007, 0x0004003B, 0x0000008D, 
+0x00000470, 0x00000007, 0x0004003B, 0x00000067, 0x00000479, 0x00000007, 0x0004003B, 0x00000067, 
+0x0000047B, 0x00000007, 0x0003003E, 0x00000395, 0x00000071, 0x00050041, 0x00000067, 0x00000396, 
+0x00000391, 0x00000020, 0x0004003D, 0x00000004, 0x00000397, 0x00000396, 0x000500B4, 0x0000006E, 
+0x00000398, 0x00000397, 0x000000AA, 0x000300F7, 0x0000039A, 0x00000000, 0x000400FA, 0x00000398, 
+0x00000399, 0x0000039B, 0x000200F8, 0x00000399, 0x00050041, 0x00000064, 0x0000039C, 0x00000391, 
+0x00000012, 0x0004003D, 0x00000005, 0x0000039D, 0x0000039C, 0x0008004F, 0x00000052, 0x0000039E, 
+0x0000039D, 0x0000039D, 0x00000000, 0x00000001, 0x00000002, 0x0004003D, 0x00000052, 0x0000039F, 
+0x00000392, 0x00050083, 0x00000052, 0x000003A0, 0x0000039E, 0x0000039F, 0x0003003E, 0x000003A1, 
+0x000003A0, 0x0004003D, 0x00000052, 0x000003A2, 0x000003A1, 0x0006000C, 0x00000004, 0x000003A3, 
+0x00000001, 0x00000042, 0x000003A2, 0x0003003E, 0x000003A4, 0x000003A3, 0x0004003D, 0x00000052, 
+0x000003A5, 0x000003A1, 0x0006000C, 0x00000052, 0x000003A6, 0x00000001, 0x00000045, 0x000003A5, 
+0x0003003E, 0x000003A1, 0x000003A6, 0x00050041, 0x00000067, 0x000003A7, 0x00000391, 0x0000000B, 
+0x0004003D, 0x00000004, 0x000003A8, 0x000003A7, 0x0004003D, 0x00000004, 0x000003A9, 0x000003A4, 
+0x0007000C, 0x00000004, 0x000003AA, 0x00000001, 0x0000001A, 0x000003A9, 0x000000AA, 0x00050081, 
+0x00000004, 0x000003AB, 0x000003AA, 0x0000005F, 0x00050088, 0x00000004, 0x000003AC, 0x000003A8, 
+0x000003AB, 0x0003003E, 0x000003AD, 0x000003AC, 0x0004003D, 0x00000004, 0x000003AE, 0x000003A4, 
+0x0004003D, 0x00000004, 0x000003AF, 0x000003A4, 0x00050085, 0x00000004, 0x000003B0, 0x000003AE, 
+0x000003AF, 0x00050041, 0x00000067, 0x000003B1, 0x00000391, 0x0000000B, 0x0004003D, 0x00000004, 
+0x000003B2, 0x000003B1, 0x00050041, 0x00000067, 0x000003B3, 0x00000391, 0x0000000B, 0x0004003D, 
+0x00000004, 0x000003B4, 0x000003B3, 0x00050085, 0x00000004, 0x000003B5, 0x000003B2, 0x000003B4, 
+0x00050088, 0x00000004, 0x000003B6, 0x000003B0, 0x000003B5, 0x00050083, 0x00000004, 0x000003B7, 
+0x0000005F, 0x000003B6, 0x0008000C, 0x00000004, 0x000003B8, 0x00000001, 0x0000002B, 0x000003B7, 
+0x00000071, 0x0000005F, 0x0003003E, 0x000003B9, 0x000003B8, 0x0004003D, 0x00000004, 0x000003BA, 
+0x000003B9, 0x0003003E, 0x00000395, 0x000003BA, 0x0004003D, 0x00000052, 0x000003BB, 0x000003A1, 
+0x00050051, 0x00000004, 0x000003BC, 0x000003BB, 0x00000000, 0x00050051, 0x00000004, 0x000003BD, 
+0x000003BB, 0x00000001, 0x00050051, 0x00000004, 0x000003BE, 0x000003BB, 0x00000002, 0x00070050, 
+0x00000005, 0x000003BF, 0x000003BC, 0x000003BD, 0x000003BE, 0x0000005F, 0x00050041, 0x00000064, 
+0x000003C0, 0x00000391, 0x0000001F, 0x0003003E, 0x000003C0, 0x000003BF, 0x000200F9, 0x0000039A, 
+0x000200F8, 0x0000039B, 0x00050041, 0x00000067, 0x000003C1, 0x00000391, 0x00000020, 0x0004003D, 
+0x00000004, 0x000003C2, 0x000003C1, 0x000500B4, 0x0000006E, 0x000003C3, 0x000003C2, 0x0000005F, 
+0x000300F7, 0x000003C5, 0x00000000, 0x000400FA, 0x000003C3, 0x000003C4, 0x000003C6, 0x000200F8, 
+0x000003C4, 0x00050041, 0x00000064, 0x000003C7, 0x00000391, 0x00000012, 0x0004003D, 0x00000005, 
+0x000003C8, 0x000003C7, 0x0008004F, 0x00000052, 0x000003C9, 0x000003C8, 0x000003C8, 0x00000000, 
+0x00000001, 0x00000002, 0x0004003D, 0x00000052, 0x000003CA, 0x00000392, 0x00050083, 0x00000052, 
+0x000003CB, 0x000003C9, 0x000003CA, 0x0003003E, 0x000003CC, 0x000003CB, 0x00050041, 0x00000067, 
+0x000003CD, 0x00000391, 0x00000016, 0x0004003D, 0x00000004, 0x000003CE, 0x000003CD, 0x00050083, 
+0x00000004, 0x000003CF, 0x0000005F, 0x000003CE, 0x0003003E, 0x000003D0, 0x000003CF, 0x0004003D, 
+0x00000052, 0x000003D1, 0x000003CC, 0x0006000C, 0x00000004, 0x000003D2, 0x00000001, 0x00000042, 
+0x000003D1, 0x0003003E, 0x000003D3, 0x000003D2, 0x0004003D, 0x00000052, 0x000003D4, 0x000003CC, 
+0x0006000C, 0x00000052, 0x000003D5, 0x00000001, 0x00000045, 0x000003D4, 0x0003003E, 0x000003CC, 
+0x000003D5, 0x0004003D, 0x00000052, 0x000003D6, 0x000003CC, 0x0008004F, 0x00000052, 0x000003D7, 
+0x000003D6, 0x000003D6, 0x00000000, 0x00000001, 0x00000002, 0x00050041, 0x00000064, 0x000003D8, 
+0x00000391, 0x0000001F, 0x0004003D, 0x00000005, 0x000003D9, 0x000003D8, 0x0008004F, 0x00000052, 
+0x000003DA, 0x000003D9, 0x000003D9, 0x00000000, 0x00000001, 0x00000002, 0x00050094, 0x00000004, 
+0x000003DB, 0x000003D7, 0x000003DA, 0x0003003E, 0x000003DC, 0x000003DB, 0x0004003D, 0x00000004, 
+0x000003DD, 0x000003D0, 0x0004003D, 0x00000004, 0x000003DE, 0x000003D0, 0x00050085, 0x00000004, 
+0x000003E0, 0x000003DE, 0x000003DF, 0x00050083, 0x00000004, 0x000003E1, 0x000003DD, 0x000003E0, 
+0x0003003E, 0x000003E2, 0x000003E1, 0x0004003D, 0x00000004, 0x000003E3, 0x000003DC, 0x0004003D, 
+0x00000004, 0x000003E4, 0x000003D0, 0x00050083, 0x00000004, 0x000003E5, 0x000003E3, 0x000003E4, 
+0x0004003D, 0x00000004, 0x000003E6, 0x000003E2, 0x00050088, 0x00000004, 0x000003E7, 0x000003E5, 
+0x000003E6, 0x0003003E, 0x000003E8, 0x000003E7, 0x00050041, 0x00000067, 0x000003E9, 0x00000391, 
+0x0000000B, 0x0004003D, 0x00000004, 0x000003EA, 0x000003E9, 0x0004003D, 0x00000004, 0x000003EB, 
+0x000003D3, 0x0007000C, 0x00000004, 0x000003EC, 0x00000001, 0x0000001A, 0x000003EB, 0x000000AA, 
+0x00050081, 0x00000004, 0x000003ED, 0x000003EC, 0x0000005F, 0x00050088, 0x00000004, 0x000003EE, 
+0x000003EA, 0x000003ED, 0x0004003D, 0x00000004, 0x000003EF, 0x000003E8, 0x00050085, 0x00000004, 
+0x000003F0, 0x000003EF, 0x000003EE, 0x0003003E, 0x000003E8, 0x000003F0, 0x0004003D, 0x00000004, 
+0x000003F1, 0x000003E8, 0x0008000C, 0x00000004, 0x000003F2, 0x00000001, 0x0000002B, 0x000003F1, 
+0x00000071, 0x0000005F, 0x0003003E, 0x00000395, 0x000003F2, 0x000200F9, 0x000003C5, 0x000200F8, 
+0x000003C6, 0x00050041, 0x0000008D, 0x000003F3, 0x00000393, 0x00000016, 0x0004003D, 0x00000052, 
+0x000003F4, 0x000003F3, 0x00050041, 0x00000064, 0x000003F5, 0x00000391, 0x0000001F, 0x0004003D, 
+0x00000005, 0x000003F6, 0x000003F5, 0x0008004F, 0x00000052, 0x000003F7, 0x000003F6, 0x000003F6, 
+0x00000000, 0x00000001, 0x00000002, 0x00050094, 0x00000004, 0x000003F8, 0x000003F4, 0x000003F7, 
+0x0003003E, 0x000003F9, 0x000003F8, 0x00050041, 0x000001C1, 0x000003FB, 0x00000018, 0x000003FA, 
+0x0004003D, 0x00000009, 0x000003FC, 0x000003FB, 0x000500AD, 0x0000006E, 0x000003FD, 0x000003FC, 
+0x0000000A, 0x000300F7, 0x000003FF, 0x00000000, 0x000400FA, 0x000003FD, 0x000003FE, 0x000003FF, 
+0x000200F8, 0x000003FE, 0x0004003D, 0x00000004, 0x00000400, 0x000003F9, 0x000500BA, 0x0000006E, 
+0x00000401, 0x00000400, 0x00000071, 0x000200F9, 0x000003FF, 0x000200F8, 0x000003FF, 0x000700F5, 
+0x0000006E, 0x00000402, 0x000003FD, 0x000003C6, 0x00000401, 0x000003FE, 0x000300F7, 0x00000404, 
+0x00000000, 0x000400FA, 0x00000402, 0x00000403, 0x00000405, 0x000200F8, 0x00000403, 0x0004003D, 
+0x00000052, 0x00000407, 0x00000392, 0x0003003E, 0x00000406, 0x00000407, 0x00050039, 0x00000009, 
+0x00000408, 0x000001F3, 0x00000406, 0x0003003E, 0x00000409, 0x00000408, 0x0004003D, 0x00000052, 
+0x0000040C, 0x00000392, 0x0003003E, 0x0000040B, 0x0000040C, 0x0004003D, 0x00000009, 0x0000040E, 
+0x00000409, 0x0003003E, 0x0000040D, 0x0000040E, 0x00050041, 0x00000064, 0x00000410, 0x00000391, 
+0x0000001F, 0x0004003D, 0x00000005, 0x00000411, 0x00000410, 0x0008004F, 0x00000052, 0x00000412, 
+0x00000411, 0x00000411, 0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x0000040F, 0x00000412, 
+0x00050041, 0x0000008D, 0x00000414, 0x00000393, 0x00000016, 0x0004003D, 0x00000052, 0x00000415, 
+0x00000414, 0x0003003E, 0x00000413, 0x00000415, 0x00080039, 0x00000004, 0x00000416, 0x0000040A, 
+0x0000040B, 0x0000040D, 0x0000040F, 0x00000413, 0x0003003E, 0x00000395, 0x00000416, 0x000200F9, 
+0x00000404, 0x000200F8, 0x00000405, 0x0003003E, 0x00000395, 0x0000005F, 0x000200F9, 0x00000404, 
+0x000200F8, 0x00000404, 0x000200F9, 0x000003C5, 0x000200F8, 0x000003C5, 0x000200F9, 0x0000039A, 
+0x000200F8, 0x0000039A, 0x00050041, 0x00000064, 0x00000417, 0x00000391, 0x0000001F, 0x0004003D, 
+0x00000005, 0x00000418, 0x00000417, 0x0008004F, 0x00000052, 0x00000419, 0x00000418, 0x00000418, 
+0x00000000, 0x00000001, 0x00000002, 0x0003003E, 0x0000041A, 0x00000419, 0x00050041, 0x00000064, 
+0x0000041B, 0x00000391, 0x0000000A, 0x0004003D, 0x00000005, 0x0000041C, 0x0000041B, 0x0008004F, 
+0x00000052, 0x0000041D, 0x0000041C, 0x0000041C, 0x00000000, 0x00000001, 0x00000002, 0x00050041, 
+0x00000067, 0x0000041E, 0x00000391, 0x00000028, 0x0004003D, 0x00000004, 0x0000041F, 0x0000041E, 
+0x0005008E, 0x00000052, 0x00000420, 0x0000041D, 0x0000041F, 0x0003003E, 0x00000421, 0x00000420, 
+0x0004003D, 0x00000052, 0x00000422, 0x0000041A, 0x00050041, 0x0000008D, 0x00000423, 0x00000393, 
+0x0000004A, 0x0004003D, 0x00000052, 0x00000424, 0x00000423, 0x00050081, 0x00000052, 0x00000425, 
+0x00000422, 0x00000424, 0x0006000C, 0x00000052, 0x00000426, 0x00000001, 0x00000045, 0x00000425, 
+0x0003003E, 0x00000427, 0x00000426, 0x00050041, 0x0000008D, 0x00000428, 0x00000393, 0x00000016, 
+0x0004003D, 0x00000052, 0x00000429, 0x00000428, 0x0004003D, 0x00000052, 0x0000042A, 0x0000041A, 
+0x00050094, 0x00000004, 0x0000042B, 0x00000429, 0x0000042A, 0x0003003E, 0x0000042C, 0x0000042B, 
+0x00050039, 0x00000004, 0x0000042D, 0x00000141, 0x0000042C, 0x0003003E, 0x0000042E, 0x0000042D, 
+0x00050041, 0x0000008D, 0x0000042F, 0x00000393, 0x0000004A, 0x0004003D, 0x00000052, 0x00000430, 
+0x0000042F, 0x0004003D, 0x00000052, 0x00000431, 0x0000041A, 0x00050081, 0x00000052, 0x00000432, 
+0x00000430, 0x00000431, 0x0006000C, 0x00000052, 0x00000433, 0x00000001, 0x00000045, 0x00000432, 
+0x0003003E, 0x00000434, 0x00000433, 0x00050041, 0x0000008D, 0x00000435, 0x00000393, 0x00000016, 
+0x0004003D, 0x00000052, 0x00000436, 0x00000435, 0x00050041, 0x0000008D, 0x00000437, 0x00000393, 
+0x0000004A, 0x0004003D, 0x00000052, 0x00000438, 0x00000437, 0x00050094, 0x00000004, 0x00000439, 
+0x00000436, 0x00000438, 0x0003003E, 0x0000043B, 0x00000439, 0x00050039, 0x00000004, 0x0000043C, 
+0x0000043A, 0x0000043B, 0x0003003E, 0x0000043D, 0x0000043C, 0x0004003D, 0x00000004, 0x0000043E, 
+0x0000043D, 0x0003003E, 0x0000043F, 0x0000043E, 0x0004003D, 0x00000004, 0x00000441, 0x0000042E, 
+0x0003003E, 0x00000440, 0x00000441, 0x00050039, 0x00000004, 0x00000442, 0x00000141, 0x00000440, 
+0x0003003E, 0x00000443, 0x00000442, 0x00050041, 0x0000008D, 0x00000444, 0x00000393, 0x00000016, 
+0x0004003D, 0x00000052, 0x00000445, 0x00000444, 0x0004003D, 0x00000052, 0x00000446, 0x00000434, 
+0x00050094, 0x00000004, 0x00000447, 0x00000445, 0x00000446, 0x0003003E, 0x00000448, 0x00000447, 
+0x00050039, 0x00000004, 0x00000449, 0x00000141, 0x00000448, 0x0003003E, 0x0000044A, 0x00000449, 
+0x0004003D, 0x00000052, 0x0000044B, 0x0000041A, 0x0004003D, 0x00000052, 0x0000044C, 0x00000434, 
+0x00050094, 0x00000004, 0x0000044D, 0x0000044B, 0x0000044C, 0x0003003E, 0x0000044E, 0x0000044D, 
+0x00050039, 0x00000004, 0x0000044F, 0x00000141, 0x0000044E, 0x0003003E, 0x00000450, 0x0000044F, 
+0x0004003D, 0x000000CD, 0x00000453, 0x00000393, 0x0003003E, 0x00000452, 0x00000453, 0x0004003D, 
+0x00000004, 0x00000455, 0x0000043F, 0x0003003E, 0x00000454, 0x00000455, 0x0004003D, 0x00000004, 
+0x00000457, 0x00000443, 0x0003003E, 0x00000456, 0x00000457, 0x0004003D, 0x00000004, 0x00000459, 
+0x00000450, 0x0003003E, 0x00000458, 0x00000459, 0x00080039, 0x00000052, 0x0000045A, 0x00000451, 
+0x00000452, 0x00000454, 0x00000456, 0x00000458, 0x0003003E, 0x0000045B, 0x0000045A, 0x0004003D, 
+0x000000CD, 0x0000045E, 0x00000393, 0x0003003E, 0x0000045D, 0x0000045E, 0x0004003D, 0x000002C1, 
+0x00000460, 0x00000391, 0x0003003E, 0x0000045F, 0x00000460, 0x0004003D, 0x00000052, 0x00000462, 
+0x00000434, 0x0003003E, 0x00000461, 0x00000462, 0x0004003D, 0x00000004, 0x00000464, 0x0000043F, 
+0x0003003E, 0x00000463, 0x00000464, 0x0004003D, 0x00000004, 0x00000466, 0x00000443, 0x0003003E, 
+0x00000465, 0x00000466, 0x0004003D, 0x00000004, 0x00000468, 0x0000044A, 0x0003003E, 0x00000467, 
+0x00000468, 0x0004003D, 0x00000004, 0x0000046A, 0x00000450, 0x0003003E, 0x00000469, 0x0000046A, 
+0x000B0039, 0x00000052, 0x0000046B, 0x0000045C, 0x0000045D, 0x0000045F, 0x00000461, 0x00000463, 
+0x00000465, 0x00000467, 0x00000469, 0x0003003E, 0x0000046C, 0x0000046B, 0x0004003D, 0x00000052, 
+0x0000046D, 0x0000045B, 0x0004003D, 0x00000052, 0x0000046E, 0x0000046C, 0x00050081, 0x00000052, 
+0x0000046F, 0x0000046D, 0x0000046E, 0x0003003E, 0x00000470, 0x0000046F, 0x0004003D, 0x00000052, 
+0x00000471, 0x00000470, 0x0004003D, 0x00000052, 0x00000472, 0x00000421, 0x0008004F, 0x00000052, 
+0x00000473, 0x00000472, 0x00000472, 0x00000000, 0x00000001, 0x00000002, 0x00050085, 0x00000052, 
+0x00000474, 0x00000471, 0x00000473, 0x0004003D, 0x00000004, 0x00000475, 0x00000395, 0x0004003D, 
+0x00000004, 0x00000476, 0x00000443, 0x00050085, 0x00000004, 0x00000477, 0x00000475, 0x00000476, 
+0x0004003D, 0x00000004, 0x0000047A, 0x00000443, 0x0003003E, 0x00000479, 0x0000047A, 0x00050041, 
+0x00000067, 0x0000047C, 0x00000393, 0x00000048, 0x0004003D, 0x00000004, 0x0000047D, 0x0000047C, 
+0x0003003E, 0x0000047B, 0x0000047D, 0x00060039, 0x00000004, 0x0000047E, 0x00000478, 0x00000479, 
+0x0000047B, 0x00050085, 0x00000004, 0x0000047F, 0x00000477, 0x0000047E, 0x0005008E, 0x00000052, 
+0x00000480, 0x00000474, 0x0000047F, 0x000200FE, 0x00000480, 0x00010038, 0x00050036, 0x0000000D, 
+0x000002E2, 0x00000000, 0x00000481, 0x00030037, 0x0000008D, 0x00000482, 0x000200F8, 0x00000483, 
+0x0004003B, 0x00000488, 0x00000487, 0x00000007, 0x0004003B, 0x00000067, 0x0000048D, 0x00000007, 
+0x0004003B, 0x0000010F, 0x00000494, 0x00000007, 0x0004003B, 0x00000067, 0x000004A7, 0x00000007, 
+0x0004003B, 0x00000067, 0x000004A9, 0x00000007, 0x0004003B, 0x000004C4, 0x000004C3, 0x00000007, 
+0x0004003B, 0x000002E8, 0x000004CC, 0x00000007, 0x00050041, 0x00000485, 0x00000484, 0x00000042, 
+0x00000012, 0x0004003D, 0x00000043, 0x00000486, 0x00000484, 0x0003003E, 0x00000487, 0x00000486, 
+0x00050041, 0x00000067, 0x00000489, 0x00000482, 0x00000096, 0x0004003D, 0x00000004, 0x0000048A, 
+0x00000489, 0x0004007F, 0x00000004, 0x0000048B, 0x0000048A, 0x0007000C, 0x00000004, 0x0000048C, 
+0x00000001, 0x00000028, 0x0000048B, 0x0000015E, 0x0003003E, 0x0000048D, 0x0000048C, 0x0004003D, 
+0x00000052, 0x0000048E, 0x00000482, 0x0007004F, 0x00000053, 0x0000048F, 0x0000048E, 0x0000048E, 
+0x00000000, 0x00000001, 0x00050041, 0x00000152, 0x00000490, 0x00000042, 0x0000000A, 0x0004003D, 
+0x00000005, 0x00000491, 0x00000490, 0x0007004F, 0x00000053, 0x00000492, 0x00000491, 0x00000491, 
+0x00000000, 0x00000001, 0x00050085, 0x00000053, 0x00000493, 0x0000048F, 0x00000492, 0x0003003E, 
+0x00000494, 0x00000493, 0x00050041, 0x000002E8, 0x00000495, 0x00000487, 0x00000065, 0x0004003D, 
+0x0000000D, 0x00000496, 0x00000495, 0x000500AA, 0x0000006E, 0x00000497, 0x00000496, 0x000002F3, 
+0x000300F7, 0x00000499, 0x00000000, 0x000400FA, 0x00000497, 0x00000498, 0x00000499, 0x000200F8, 
+0x00000498, 0x0004003D, 0x00000004, 0x0000049A, 0x0000048D, 0x0004003D, 0x00000053, 0x0000049B, 
+0x00000494, 0x00050050, 0x00000053, 0x0000049C, 0x0000049A, 0x0000049A, 0x00050088, 0x00000053, 
+0x0000049D, 0x0000049B, 0x0000049C, 0x0003003E, 0x00000494, 0x0000049D, 0x000200F9, 0x00000499, 
+0x000200F8, 0x00000499, 0x00050041, 0x000002E8, 0x0000049E, 0x00000487, 0x00000065, 0x0004003D, 
+0x0000000D, 0x0000049F, 0x0000049E, 0x000500AA, 0x0000006E, 0x000004A0, 0x0000049F, 0x000002F3, 
+0x000300F7, 0x000004A3, 0x00000000, 0x000400FA, 0x000004A0, 0x000004A1, 0x000004A2, 0x000200F8, 
+0x000004A1, 0x0004003D, 0x00000004, 0x000004A4, 0x0000048D, 0x0006000C, 0x00000004, 0x000004A5, 
+0x00000001, 0x0000001C, 0x000004A4, 0x0003003E, 0x000004A7, 0x000004A5, 0x000200F9, 0x000004A3, 
+0x000200F8, 0x000004A2, 0x0004003D, 0x00000004, 0x000004A6, 0x0000048D, 0x0003003E, 0x000004A7, 
+0x000004A6, 0x000200F9, 0x000004A3, 0x000200F8, 0x000004A3, 0x0004003D, 0x00000004, 0x000004A8, 
+0x000004A7, 0x0003003E, 0x000004A9, 0x000004A8, 0x0004003D, 0x00000004, 0x000004AA, 0x000004A9, 
+0x00060041, 0x0000006B, 0x000004AB, 0x00000042, 0x0000000A, 0x00000096, 0x0004003D, 0x00000004, 
+0x000004AC, 0x000004AB, 0x00050085, 0x00000004, 0x000004AD, 0x000004AA, 0x000004AC, 0x00060041, 
+0x0000006B, 0x000004AE, 0x00000042, 0x0000000A, 0x00000065, 0x0004003D, 0x00000004, 0x000004AF, 
+0x000004AE, 0x00050081, 0x00000004, 0x000004B0, 0x000004AD, 0x000004AF, 0x0003003E, 0x000004A9, 
+0x000004B0, 0x0004003D, 0x00000053, 0x000004B1, 0x00000494, 0x0005008E, 0x00000053, 0x000004B3, 
+0x000004B1, 0x000004B2, 0x00050081, 0x00000053, 0x000004B5, 0x000004B3, 0x000004B4, 0x0004003D, 
+0x00000043, 0x000004B6, 0x00000487, 0x0007004F, 0x000004B8, 0x000004B7, 0x000004B6, 0x000004B6, 
+0x00000000, 0x00000001, 0x00040070, 0x00000053, 0x000004B9, 0x000004B7, 0x00050085, 0x00000053, 
+0x000004BA, 0x000004B5, 0x000004B9, 0x0004003D, 0x00000043, 0x000004BC, 0x00000487, 0x0007004F, 
+0x000004B8, 0x000004BD, 0x000004BC, 0x000004BC, 0x00000000, 0x00000001, 0x00040070, 0x00000053, 
+0x000004BE, 0x000004BD, 0x00050083, 0x00000053, 0x000004C0, 0x000004BE, 0x000004BF, 0x0008000C, 
+0x00000053, 0x000004C1, 0x00000001, 0x0000002B, 0x000004BA, 0x000004BB, 0x000004C0, 0x0004006D, 
+0x000004B8, 0x000004C2, 0x000004C1, 0x0003003E, 0x000004C3, 0x000004C2, 0x0004003D, 0x00000004, 
+0x000004C5, 0x000004A9, 0x00050041, 0x000002E8, 0x000004C6, 0x00000487, 0x00000096, 0x0004003D, 
+0x0000000D, 0x000004C7, 0x000004C6, 0x00040070, 0x00000004, 0x000004C8, 0x000004C7, 0x00050083, 
+0x00000004, 0x000004C9, 0x000004C8, 0x0000005F, 0x0008000C, 0x00000004, 0x000004CA, 0x00000001, 
+0x0000002B, 0x000004C5, 0x00000071, 0x000004C9, 0x0004006D, 0x0000000D, 0x000004CB, 0x000004CA, 
+0x0003003E, 0x000004CC, 0x000004CB, 0x00050041, 0x000002E8, 0x000004CD, 0x000004C3, 0x000002F3, 
+0x0004003D, 0x0000000D, 0x000004CE, 0x000004CD, 0x00050041, 0x000002E8, 0x000004CF, 0x000004C3, 
+0x000000A3, 0x0004003D, 0x0000000D, 0x000004D0, 0x000004CF, 0x00050041, 0x000002E8, 0x000004D1, 
+0x00000487, 0x000002F3, 0x0004003D, 0x0000000D, 0x000004D2, 0x000004D1, 0x00050084, 0x0000000D, 
+0x000004D3, 0x000004D0, 0x000004D2, 0x00050080, 0x0000000D, 0x000004D4, 0x000004CE, 0x000004D3, 
+0x0004003D, 0x0000000D, 0x000004D5, 0x000004CC, 0x00050041, 0x000002E8, 0x000004D6, 0x00000487, 
+0x000002F3, 0x0004003D, 0x0000000D, 0x000004D7, 0x000004D6, 0x00050084, 0x0000000D, 0x000004D8, 
+0x000004D5, 0x000004D7, 0x00050041, 0x000002E8, 0x000004D9, 0x00000487, 0x000000A3, 0x0004003D, 
+0x0000000D, 0x000004DA, 0x000004D9, 0x00050084, 0x0000000D, 0x000004DB, 0x000004D8, 0x000004DA, 
+0x00050080, 0x0000000D, 0x000004DC, 0x000004D4, 0x000004DB, 0x000200FE, 0x000004DC, 0x00010038, 
+0x00050036, 0x0000000D, 0x000002E6, 0x00000000, 0x000004DD, 0x00030037, 0x000002E8, 0x000004DE, 
+0x000200F8, 0x000004DF, 0x0004003D, 0x0000000D, 0x000004E0, 0x000004DE, 0x00050086, 0x0000000D, 
+0x000004E1, 0x000004E0, 0x0000000E, 0x0004003D, 0x0000000D, 0x000004E2, 0x000004DE, 0x00050089, 
+0x0000000D, 0x000004E3, 0x000004E2, 0x0000000E, 0x00070041, 0x000004E5, 0x000004E4, 0x00000042, 
+0x0000001F, 0x000004E1, 0x000004E3, 0x0004003D, 0x0000000D, 0x000004E6, 0x000004E4, 0x000200FE, 
+0x000004E6, 0x00010038, 0x00050036, 0x0000000D, 0x00000300, 0x00000000, 0x000004DD, 0x00030037, 
+0x000002E8, 0x000004E7, 0x000200F8, 0x000004E8, 0x0004003B, 0x000002E8, 0x000004F1, 0x00000007, 
+0x0004003D, 0x0000000D, 0x000004E9, 0x000004E7, 0x00050086, 0x0000000D, 0x000004EB, 0x000004E9, 
+0x000004EA, 0x0004003D, 0x0000000D, 0x000004EC, 0x000004E7, 0x00050086, 0x0000000D, 0x000004ED, 
+0x000004EC, 0x00000096, 0x00050089, 0x0000000D, 0x000004EE, 0x000004ED, 0x0000000E, 0x00070041, 
+0x000004E5, 0x000004EF, 0x0000004C, 0x0000000A, 0x000004EB, 0x000004EE, 0x0004003D, 0x0000000D, 
+0x000004F0, 0x000004EF, 0x0003003E, 0x000004F1, 0x000004F0, 0x0004003D, 0x0000000D, 0x000004F2, 
+0x000004F1, 0x0004003D, 0x0000000D, 0x000004F3, 0x000004E7, 0x00050089, 0x0000000D, 0x000004F4, 
+0x000004F3, 0x00000096, 0x00050084, 0x0000000D, 0x000004F5, 0x000004F4, 0x000002F0, 0x000500C2, 
+0x0000000D, 0x000004F6, 0x000004F2, 0x000004F5, 0x000500C7, 0x0000000D, 0x000004F7, 0x000004F6, 
+0x000002EC, 0x000200FE, 0x000004F7, 0x00010038, 0x00050036, 0x00000052, 0x00000322, 0x00000000, 
+0x000004F8, 0x00030037, 0x0000008D, 0x000004F9, 0x00030037, 0x00000067, 0x000004FA, 0x00030037, 
+0x00000067, 0x000004FB, 0x000200F8, 0x000004FC, 0x0004003D, 0x00000052, 0x000004FD, 0x000004F9, 
+0x0004003D, 0x00000004, 0x000004FE, 0x000004FB, 0x00050083, 0x00000004, 0x000004FF, 0x0000005F, 
+0x000004FE, 0x00060050, 0x00000052, 0x00000500, 0x000004FF, 0x000004FF, 0x000004FF, 0x0004003D, 
+0x00000052, 0x00000501, 0x000004F9, 0x0007000C, 0x00000052, 0x00000502, 0x00000001, 0x00000028, 
+0x00000500, 0x00000501, 0x0004003D, 0x00000052, 0x00000503, 0x000004F9, 0x00050083, 0x00000052, 
+0x00000504, 0x00000502, 0x00000503, 0x0004003D, 0x00000004, 0x00000505, 0x000004FA, 0x00050083, 
+0x00000004, 0x00000506, 0x0000005F, 0x00000505, 0x0007000C, 0x00000004, 0x00000507, 0x00000001, 
+0x00000028, 0x00000506, 0x00000071, 0x0007000C, 0x00000004, 0x00000509, 0x00000001, 0x0000001A, 
+0x00000507, 0x00000508, 0x0005008E, 0x00000052, 0x0000050A, 0x00000504, 0x00000509, 0x00050081, 
+0x00000052, 0x0000050B, 0x000004FD, 0x0000050A, 0x000200FE, 0x0000050B, 0x00010038, 0x00050036, 
+0x00000004, 0x0000040A, 0x00000000, 0x0000050C, 0x00030037, 0x0000008D, 0x0000050D, 0x00030037, 
+0x000001F8, 0x0000050E, 0x00030037, 0x0000008D, 0x0000050F, 0x00030037, 0x0000008D, 0x00000510, 
+0x000200F8, 0x00000511, 0x0004003B, 0x00000067, 0x00000514, 0x00000007, 0x0004003B, 0x00000067, 
+0x00000517, 0x00000007, 0x0004003B, 0x00000064, 0x00000520, 0x00000007, 0x0004003B, 0x00000067, 
+0x00000523, 0x00000007, 0x0004003B, 0x00000064, 0x0000053B, 0x00000007, 0x0004003B, 0x00000067, 
+0x00000542, 0x00000007, 0x0004003B, 0x00000067, 0x0000054A, 0x00000007, 0x0004003B, 0x00000067, 
+0x0000054E, 0x00000007, 0x0004003B, 0x00000064, 0x00000550, 0x00000007, 0x0004003B, 0x00000067, 
+0x00000552, 0x00000007, 0x0004003B, 0x0000008D, 0x00000554, 0x00000007, 0x0004003B, 0x0000008D, 
+0x00000556, 0x00000007, 0x0004003B, 0x0000008D, 0x00000558, 0x00000007, 0x0004003B, 0x000001F8, 
+0x0000055A, 0x00000007, 0x0004003B, 0x00000067, 0x00000569, 0x00000007, 0x0004003B, 0x000001F8, 
+0x0000056C, 0x00000007, 0x0004003B, 0x00000064, 0x00000584, 0x00000007, 0x0004003B, 0x00000067, 
+0x00000586, 0x00000007, 0x0004003B, 0x0000008D, 0x00000588, 0x00000007, 0x0004003B, 0x0000008D, 
+0x0000058A, 0x00000007, 0x0004003B, 0x0000008D, 0x0000058C, 0x00000007, 0x0004003B, 0x000001F8, 
+0x0000058E, 0x00000007, 0x0004003B, 0x00000067, 0x00000591, 0x00000007, 0x00050041, 0x0000006B, 
+0x00000512, 0x00000018, 0x0000004A, 0x0004003D, 0x00000004, 0x00000513, 0x00000512, 0x0003003E, 
+0x00000514, 0x00000513, 0x00050041, 0x0000006B, 0x00000515, 0x00000018, 0x0000003D, 0x0004003D, 
+0x00000004, 0x00000516, 0x00000515, 0x0003003E, 0x00000517, 0x00000516, 0x00050041, 0x000002D8, 
+0x00000518, 0x00000018, 0x0000001F, 0x0004003D, 0x00000006, 0x00000519, 0x00000518, 0x0004003D, 
+0x00000052, 0x0000051A, 0x0000050D, 0x00050051, 0x00000004, 0x0000051B, 0x0000051A, 0x00000000, 
+0x00050051, 0x00000004, 0x0000051C, 0x0000051A, 0x00000001, 0x00050051, 0x00000004, 0x0000051D, 
+0x0000051A, 0x00000002, 0x00070050, 0x00000005, 0x0000051E, 0x0000051B, 0x0000051C, 0x0000051D, 
+0x0000005F, 0x00050091, 0x00000005, 0x0000051F, 0x00000519, 0x0000051E, 0x0003003E, 0x00000520, 
+0x0000051F, 0x0004003D, 0x00000005, 0x00000521, 0x00000520, 0x0006000C, 0x00000004, 0x00000522, 
+0x00000001, 0x00000042, 0x00000521, 0x0003003E, 0x00000523, 0x00000522, 0x0004003D, 0x00000004, 
+0x00000524, 0x00000523, 0x0004003D, 0x00000004, 0x00000525, 0x00000514, 0x0004003D, 0x00000004, 
+0x00000526, 0x00000517, 0x00050083, 0x00000004, 0x00000527, 0x00000525, 0x00000526, 0x00050083, 
+0x00000004, 0x00000528, 0x00000524, 0x00000527, 0x0003003E, 0x00000057, 0x00000528, 0x0004003D, 
+0x00000004, 0x00000529, 0x00000517, 0x0004003D, 0x00000004, 0x0000052A, 0x00000057, 0x00050088, 
+0x00000004, 0x0000052B, 0x0000052A, 0x00000529, 0x0003003E, 0x00000057, 0x0000052B, 0x0004003D, 
+0x00000004, 0x0000052C, 0x00000057, 0x00050083, 0x00000004, 0x0000052D, 0x0000005F, 0x0000052C, 
+0x0008000C, 0x00000004, 0x0000052E, 0x00000001, 0x0000002B, 0x0000052D, 0x00000071, 0x0000005F, 
+0x0003003E, 0x00000057, 0x0000052E, 0x00050041, 0x000002D8, 0x0000052F, 0x00000018, 0x0000000B, 
+0x0004003D, 0x00000006, 0x00000530, 0x0000052F, 0x0004003D, 0x00000009, 0x00000531, 0x0000050E, 
+0x00060041, 0x000002D8, 0x00000532, 0x00000018, 0x00000012, 0x00000531, 0x0004003D, 0x00000006, 
+0x00000533, 0x00000532, 0x00050092, 0x00000006, 0x00000534, 0x00000530, 0x00000533, 0x0004003D, 
+0x00000052, 0x00000535, 0x0000050D, 0x00050051, 0x00000004, 0x00000536, 0x00000535, 0x00000000, 
+0x00050051, 0x00000004, 0x00000537, 0x00000535, 0x00000001, 0x00050051, 0x00000004, 0x00000538, 
+0x00000535, 0x00000002, 0x00070050, 0x00000005, 0x00000539, 0x00000536, 0x00000537, 0x00000538, 
+0x0000005F, 0x00050091, 0x00000005, 0x0000053A, 0x00000534, 0x00000539, 0x0003003E, 0x0000053B, 
+0x0000053A, 0x0004003D, 0x00000005, 0x0000053C, 0x0000053B, 0x00050041, 0x00000067, 0x0000053D, 
+0x0000053B, 0x00000065, 0x0004003D, 0x00000004, 0x0000053E, 0x0000053D, 0x00050088, 0x00000004, 
+0x0000053F, 0x0000005F, 0x0000053E, 0x0005008E, 0x00000005, 0x00000540, 0x0000053C, 0x0000053F, 
+0x0003003E, 0x0000053B, 0x00000540, 0x0003003E, 0x00000542, 0x00000541, 0x00050041, 0x0000006B, 
+0x00000543, 0x00000018, 0x00000048, 0x0004003D, 0x00000004, 0x00000544, 0x00000543, 0x0004003D, 
+0x00000004, 0x00000545, 0x00000542, 0x00050085, 0x00000004, 0x00000546, 0x00000544, 0x00000545, 
+0x00050041, 0x00000067, 0x00000547, 0x0000053B, 0x00000096, 0x0004003D, 0x00000004, 0x00000548, 
+0x00000547, 0x00050088, 0x00000004, 0x00000549, 0x00000546, 0x00000548, 0x0003003E, 0x0000054A, 
+0x00000549, 0x0004003D, 0x00000004, 0x0000054B, 0x0000054A, 0x0007000C, 0x00000004, 0x0000054D, 
+0x00000001, 0x00000025, 0x0000054B, 0x0000054C, 0x0003003E, 0x0000054A, 0x0000054D, 0x0003003E, 
+0x0000054E, 0x0000005F, 0x0004003D, 0x00000005, 0x00000551, 0x0000053B, 0x0003003E, 0x00000550, 
+0x00000551, 0x0004003D, 0x00000004, 0x00000553, 0x0000054A, 0x0003003E, 0x00000552, 0x00000553, 
+0x0004003D, 0x00000052, 0x00000555, 0x0000050F, 0x0003003E, 0x00000554, 0x00000555, 0x0004003D, 
+0x00000052, 0x00000557, 0x00000510, 0x0003003E, 0x00000556, 0x00000557, 0x0004003D, 0x00000052, 
+0x00000559, 0x0000050D, 0x0003003E, 0x00000558, 0x00000559, 0x0004003D, 0x00000009, 0x0000055B, 
+0x0000050E, 0x0003003E, 0x0000055A, 0x0000055B, 0x000B0039, 0x00000004, 0x0000055C, 0x0000054F, 
+0x0000002B, 0x00000550, 0x00000552, 0x00000554, 0x00000556, 0x00000558, 0x0000055A, 0x0003003E, 
+0x0000054E, 0x0000055C, 0x0004003D, 0x00000009, 0x0000055D, 0x0000050E, 0x00070041, 0x0000006B, 
+0x0000055E, 0x00000018, 0x00000016, 0x0000055D, 0x000002F3, 0x0004003D, 0x00000004, 0x0000055F, 
+0x0000055E, 0x00050041, 0x0000006B, 0x00000560, 0x00000018, 0x0000017C, 0x0004003D, 0x00000004, 
+0x00000561, 0x00000560, 0x00050081, 0x00000004, 0x00000562, 0x0000055F, 0x00000561, 0x0004003D, 
+0x00000009, 0x00000563, 0x0000050E, 0x00070041, 0x0000006B, 0x00000564, 0x00000018, 0x00000016, 
+0x00000563, 0x000002F3, 0x0004003D, 0x00000004, 0x00000565, 0x00000564, 0x00050041, 0x00000067, 
+0x00000566, 0x00000520, 0x00000096, 0x0004003D, 0x00000004, 0x00000567, 0x00000566, 0x0008000C, 
+0x00000004, 0x00000568, 0x00000001, 0x00000031, 0x00000562, 0x00000565, 0x00000567, 0x0003003E, 
+0x00000569, 0x00000568, 0x0004003D, 0x00000009, 0x0000056A, 0x0000050E, 0x00050080, 0x00000009, 
+0x0000056B, 0x0000056A, 0x00000012, 0x0003003E, 0x0000056C, 0x0000056B, 0x0004003D, 0x00000004, 
+0x0000056D, 0x00000569, 0x000500BA, 0x0000006E, 0x0000056E, 0x0000056D, 0x00000071, 0x000300F7, 
+0x00000570, 0x00000000, 0x000400FA, 0x0000056E, 0x0000056F, 0x00000570, 0x000200F8, 0x0000056F, 
+0x0004003D, 0x00000009, 0x00000571, 0x0000056C, 0x00050041, 0x000001C1, 0x00000572, 0x00000018, 
+0x00000074, 0x0004003D, 0x00000009, 0x00000573, 0x00000572, 0x000500B1, 0x0000006E, 0x00000574, 
+0x00000571, 0x00000573, 0x000200F9, 0x00000570, 0x000200F8, 0x00000570, 0x000700F5, 0x0000006E, 
+0x00000575, 0x0000056E, 0x00000511, 0x00000574, 0x0000056F, 0x000300F7, 0x00000577, 0x00000000, 
+0x000400FA, 0x00000575, 0x00000576, 0x00000577, 0x000200F8, 0x00000576, 0x00050041, 0x000002D8, 
+0x00000578, 0x00000018, 0x0000000B, 0x0004003D, 0x00000006, 0x00000579, 0x00000578, 0x0004003D, 
+0x00000009, 0x0000057A, 0x0000056C, 0x00060041, 0x000002D8, 0x0000057B, 0x00000018, 0x00000012, 
+0x0000057A, 0x0004003D, 0x00000006, 0x0000057C, 0x0000057B, 0x00050092, 0x00000006, 0x0000057D, 
+0x00000579, 0x0000057C, 0x0004003D, 0x00000052, 0x0000057E, 0x0000050D, 0x00050051, 0x00000004, 
+0x0000057F, 0x0000057E, 0x00000000, 0x00050051, 0x00000004, 0x00000580, 0x0000057E, 0x00000001, 
+0x00050051, 0x00000004, 0x00000581, 0x0000057E, 0x00000002, 0x00070050, 0x00000005, 0x00000582, 
+0x0000057F, 0x00000580, 0x00000581, 0x0000005F, 0x00050091, 0x00000005, 0x00000583, 0x0000057D, 
+0x00000582, 0x0003003E, 0x0000053B, 0x00000583, 0x0004003D, 0x00000005, 0x00000585, 0x0000053B, 
+0x0003003E, 0x00000584, 0x00000585, 0x0004003D, 0x00000004, 0x00000587, 0x0000054A, 0x0003003E, 
+0x00000586, 0x00000587, 0x0004003D, 0x00000052, 0x00000589, 0x0000050F, 0x0003003E, 0x00000588, 
+0x00000589, 0x0004003D, 0x00000052, 0x0000058B, 0x00000510, 0x0003003E, 0x0000058A, 0x0000058B, 
+0x0004003D, 0x00000052, 0x0000058D, 0x0000050D, 0x0003003E, 0x0000058C, 0x0000058D, 0x0004003D, 
+0x00000009, 0x0000058F, 0x0000056C, 0x0003003E, 0x0000058E, 0x0000058F, 0x000B0039, 0x00000004, 
+0x00000590, 0x0000054F, 0x0000002B, 0x00000584, 0x00000586, 0x00000588, 0x0000058A, 0x0000058C, 
+0x0000058E, 0x0003003E, 0x00000591, 0x00000590, 0x0004003D, 0x00000004, 0x00000592, 0x0000054E, 
+0x0004003D, 0x00000004, 0x00000593, 0x00000591, 0x0004003D, 0x00000004, 0x00000594, 0x00000569, 
+0x0008000C, 0x00000004, 0x00000595, 0x00000001, 0x0000002E, 0x00000592, 0x00000593, 0x00000594, 
+0x0003003E, 0x0000054E, 0x00000595, 0x000200F9, 0x00000577, 0x000200F8, 0x00000577, 0x0004003D, 
+0x00000004, 0x00000596, 0x0000054E, 0x00050083, 0x00000004, 0x00000597, 0x0000005F, 0x00000596, 
+0x0004003D, 0x00000004, 0x00000598, 0x00000057, 0x00050085, 0x00000004, 0x00000599, 0x00000597, 
+0x00000598, 0x00050083, 0x00000004, 0x0000059A, 0x0000005F, 0x00000599, 0x000200FE, 0x0000059A, 
+0x00010038, 0x00050036, 0x00000004, 0x0000043A, 0x00000000, 0x00000284, 0x00030037, 0x00000067, 
+0x0000059B, 0x000200F8, 0x0000059C, 0x0004003D, 0x00000004, 0x0000059D, 0x0000059B, 0x0007000C, 
+0x00000004, 0x0000059E, 0x00000001, 0x00000028, 0x0000059D, 0x00000180, 0x000200FE, 0x0000059E, 
+0x00010038, 0x00050036, 0x00000052, 0x00000451, 0x00000000, 0x0000059F, 0x00030037, 0x000000CE, 
+0x000005A0, 0x00030037, 0x00000067, 0x000005A1, 0x00030037, 0x00000067, 0x000005A2, 0x00030037, 
+0x00000067, 0x000005A3, 0x000200F8, 0x000005A4, 0x0004003B, 0x00000067, 0x000005A9, 0x00000007, 
+0x0004003B, 0x00000067, 0x000005AC, 0x00000007, 0x0004003B, 0x00000067, 0x000005AE, 0x00000007, 
+0x0004003B, 0x00000067, 0x000005B0, 0x00000007, 0x00050041, 0x00000064, 0x000005A5, 0x000005A0, 
+0x0000000A, 0x0004003D, 0x00000005, 0x000005A6, 0x000005A5, 0x0008004F, 0x00000052, 0x000005A7, 
+0x000005A6, 0x000005A6, 0x00000000, 0x00000001, 0x00000002, 0x00050041, 0x00000067, 0x000005AA, 
+0x000005A0, 0x0000001F, 0x0004003D, 0x00000004, 0x000005AB, 0x000005AA, 0x0003003E, 0x000005A9, 
+0x000005AB, 0x0004003D, 0x00000004, 0x000005AD, 0x000005A1, 0x0003003E, 0x000005AC, 0x000005AD, 
+0x0004003D, 0x00000004, 0x000005AF, 0x000005A2, 0x0003003E, 0x000005AE, 0x000005AF, 0x0004003D, 
+0x00000004, 0x000005B1, 0x000005A3, 0x0003003E, 0x000005B0, 0x000005B1, 0x00080039, 0x00000004, 
+0x000005B2, 0x000005A8, 0x000005A9, 0x000005AC, 0x000005AE, 0x000005B0, 0x0005008E, 0x00000052, 
+0x000005B3, 0x000005A7, 0x000005B2, 0x000200FE, 0x000005B3, 0x00010038, 0x00050036, 0x00000052, 
+0x0000045C, 0x00000000, 0x000005B4, 0x00030037, 0x000000CE, 0x000005B5, 0x00030037, 0x000002C2, 
+0x000005B6, 0x00030037, 0x0000008D, 0x000005B7, 0x00030037, 0x00000067, 0x000005B8, 0x00030037, 
+0x00000067, 0x000005B9, 0x00030037, 0x00000067, 0x000005BA, 0x00030037, 0x00000067, 0x000005BB, 
+0x000200F8, 0x000005BC, 0x0004003B, 0x000000CE, 0x000005BE, 0x00000007, 0x0004003B, 0x000002C2, 
+0x000005C0, 0x00000007, 0x0004003B, 0x0000008D, 0x000005C2, 0x00000007, 0x0004003B, 0x00000067, 
+0x000005C4, 0x00000007, 0x0004003B, 0x00000067, 0x000005C6, 0x00000007, 0x0004003B, 0x00000067, 
+0x000005C8, 0x00000007, 0x0004003B, 0x00000067, 0x000005CA, 0x00000007, 0x0004003D, 0x000000CD, 
+0x000005BF, 0x000005B5, 0x0003003E, 0x000005BE, 0x000005BF, 0x0004003D, 0x000002C1, 0x000005C1, 
+0x000005B6, 0x0003003E, 0x000005C0, 0x000005C1, 0x0004003D, 0x00000052, 0x000005C3, 0x000005B7, 
+0x0003003E, 0x000005C2, 0x000005C3, 0x0004003D, 0x00000004, 0x000005C5, 0x000005B8, 0x0003003E, 
+0x000005C4, 0x000005C5, 0x0004003D, 0x00000004, 0x000005C7, 0x000005B9, 0x0003003E, 0x000005C6, 
+0x000005C7, 0x0004003D, 0x00000004, 0x000005C9, 0x000005BA, 0x0003003E, 0x000005C8, 0x000005C9, 
+0x0004003D, 0x00000004, 0x000005CB, 0x000005BB, 0x0003003E, 0x000005CA, 0x000005CB, 0x000B0039, 
+0x00000052, 0x000005CC, 0x000005BD, 0x000005BE, 0x000005C0, 0x000005C2, 0x000005C4, 0x000005C6, 
+0x000005C8, 0x000005CA, 0x000200FE, 0x000005CC, 0x00010038, 0x00050036, 0x00000004, 0x00000478, 
+0x00000000, 0x000005CD, 0x00030037, 0x00000067, 0x000005CE, 0x00030037, 0x00000067, 0x000005CF, 
+0x000200F8, 0x000005D0, 0x0004003B, 0x00000067, 0x000005D6, 0x00000007, 0x0004003B, 0x00000067, 
+0x000005DA, 0x00000007, 0x0004003B, 0x00000067, 0x000005DC, 0x00000007, 0x0004003D, 0x00000004, 
+0x000005D1, 0x000005CF, 0x0007000C, 0x00000004, 0x000005D3, 0x00000001, 0x00000025, 0x000005D1, 
+0x000005D2, 0x00050083, 0x00000004, 0x000005D4, 0x0000005F, 0x000005D3, 0x0006000C, 0x00000004, 
+0x000005D5, 0x00000001, 0x00000020, 0x000005D4, 0x0003003E, 0x000005D6, 0x000005D5, 0x0004003D, 
+0x00000004, 0x000005D7, 0x000005CE, 0x0004003D, 0x00000004, 0x000005D8, 0x000005D6, 0x00050085, 
+0x00000004, 0x000005D9, 0x000005D7, 0x000005D8, 0x0003003E, 0x000005DA, 0x000005D9, 0x00050039, 
+0x00000004, 0x000005DB, 0x00000141, 0x000005DA, 0x0003003E, 0x000005DC, 0x000005DB, 0x0004003D, 
+0x00000004, 0x000005DD, 0x000005DC, 0x0004003D, 0x00000004, 0x000005DE, 0x000005DC, 0x00050085, 
+0x00000004, 0x000005DF, 0x000005DD, 0x000005DE, 0x000200FE, 0x000005DF, 0x00010038, 0x00050036, 
+0x00000004, 0x0000054F, 0x00000000, 0x000005E0, 0x00030037, 0x0000002E, 0x000005E1, 0x00030037, 
+0x00000064, 0x000005E2, 0x00030037, 0x00000067, 0x000005E3, 0x00030037, 0x0000008D, 0x000005E4, 
+0x00030037, 0x0000008D, 0x000005E5, 0x00030037, 0x0000008D, 0x000005E6, 0x00030037, 0x000001F8, 
+0x000005E7, 0x000200F8, 0x000005E8, 0x0004003B, 0x0000008D, 0x000005EA, 0x00000007, 0x0004003B, 
+0x0000008D, 0x000005EC, 0x00000007, 0x0004003B, 0x000001F8, 0x000005EE, 0x00000007, 0x0004003B, 
+0x00000067, 0x000005F1, 0x00000007, 0x0004003B, 0x00000067, 0x000005F2, 0x00000007, 0x0004003B, 
+0x0000010F, 0x000005F4, 0x00000007, 0x0004003B, 0x00000067, 0x000005F8, 0x00000007, 0x0004003B, 
+0x00000067, 0x000005F9, 0x00000007, 0x0004003B, 0x0000008D, 0x000005FF, 0x00000007, 0x0004003B, 
+0x0000008D, 0x00000602, 0x00000007, 0x0004003B, 0x000001F8, 0x00000605, 0x00000007, 0x0004003B, 
+0x000001F8, 0x0000060A, 0x00000007, 0x0004003B, 0x000001F8, 0x0000060B, 0x00000007, 0x0004003B, 
+0x0000010F, 0x00000614, 0x00000007, 0x0004003B, 0x000001F8, 0x00000619, 0x00000007, 0x0004003B, 
+0x00000067, 0x0000061B, 0x00000007, 0x0004003B, 0x00000067, 0x0000061D, 0x00000007, 0x0004003B, 
+0x0000010F, 0x00000622, 0x00000007, 0x0004003B, 0x00000067, 0x00000631, 0x00000007, 0x0004003D, 
+0x00000052, 0x000005EB, 0x000005E4, 0x0003003E, 0x000005EA, 0x000005EB, 0x0004003D, 0x00000052, 
+0x000005ED, 0x000005E5, 0x0003003E, 0x000005EC, 0x000005ED, 0x0004003D, 0x00000009, 0x000005EF, 
+0x000005E7, 0x0003003E, 0x000005EE, 0x000005EF, 0x00070039, 0x00000004, 0x000005F0, 0x000005E9, 
+0x000005EA, 0x000005EC, 0x000005EE, 0x0003003E, 0x000005F1, 0x000005F0, 0x0003003E, 0x000005F2, 
+0x00000071, 0x0004003D, 0x00000052, 0x000005F5, 0x000005E6, 0x0007004F, 0x00000053, 0x000005F6, 
+0x000005F5, 0x000005F5, 0x00000000, 0x00000001, 0x0003003E, 0x000005F4, 0x000005F6, 0x00050039, 
+0x00000004, 0x000005F7, 0x000005F3, 0x000005F4, 0x0003003E, 0x000005F8, 0x000005F7, 0x0003003E, 
+0x000005F9, 0x000004B2, 0x0004003D, 0x00000052, 0x000005FA, 0x000005E6, 0x0008004F, 0x00000052, 
+0x000005FB, 0x000005FA, 0x000005FA, 0x00000000, 0x00000001, 0x00000002, 0x0005008E, 0x00000052, 
+0x000005FD, 0x000005FB, 0x000005FC, 0x0006000C, 0x00000052, 0x000005FE, 0x00000001, 0x00000008, 
+0x000005FD, 0x0003003E, 0x000005FF, 0x000005FE, 0x0004003D, 0x00000052, 0x00000603, 0x000005FF, 
+0x0008004F, 0x00000052, 0x00000604, 0x00000603, 0x00000603, 0x00000000, 0x00000001, 0x00000002, 
+0x0003003E, 0x00000602, 0x00000604, 0x0003003E, 0x00000605, 0x00000012, 0x00060039, 0x00000004, 
+0x00000606, 0x00000601, 0x00000602, 0x00000605, 0x00050085, 0x00000004, 0x00000607, 0x00000600, 
+0x00000606, 0x0004006E, 0x00000009, 0x00000608, 0x00000607, 0x0005008B, 0x00000009, 0x00000609, 
+0x00000608, 0x0000003C, 0x0003003E, 0x0000060A, 0x00000609, 0x0003003E, 0x0000060B, 0x0000000A, 
+0x000200F9, 0x0000060C, 0x000200F8, 0x0000060C, 0x000400F6, 0x00000610, 0x0000060F, 0x00000000, 
+0x000200F9, 0x0000060D, 0x000200F8, 0x0000060D, 0x0004003D, 0x00000009, 0x00000611, 0x0000060B, 
+0x000500B1, 0x0000006E, 0x00000612, 0x00000611, 0x0000000B, 0x000400FA, 0x00000612, 0x0000060E, 
+0x00000610, 0x000200F8, 0x0000060E, 0x0004003D, 0x00000005, 0x00000615, 0x00000103, 0x0007004F, 
+0x00000053, 0x00000616, 0x00000615, 0x00000615, 0x00000000, 0x00000001, 0x0003003E, 0x00000614, 
+0x00000616, 0x00050039, 0x00000004, 0x00000617, 0x00000613, 0x00000614, 0x0004003D, 0x00000009, 
+0x0000061A, 0x0000060B, 0x0003003E, 0x00000619, 0x0000061A, 0x0004003D, 0x00000004, 0x0000061C, 
+0x000005F9, 0x0003003E, 0x0000061B, 0x0000061C, 0x0003003E, 0x0000061D, 0x00000617, 0x00070039, 
+0x00000053, 0x0000061E, 0x00000618, 0x00000619, 0x0000061B, 0x0000061D, 0x00050088, 0x00000053, 
+0x00000621, 0x0000061E, 0x00000620, 0x0003003E, 0x00000622, 0x00000621, 0x0004003D, 0x0000002D, 
+0x00000623, 0x000005E1, 0x0004003D, 0x00000005, 0x00000624, 0x000005E2, 0x0007004F, 0x00000053, 
+0x00000625, 0x00000624, 0x00000624, 0x00000000, 0x00000001, 0x0004003D, 0x00000053, 0x00000626, 
+0x00000622, 0x00050081, 0x00000053, 0x00000627, 0x00000625, 0x00000626, 0x0004003D, 0x00000009, 
+0x00000628, 0x000005E7, 0x00050051, 0x00000004, 0x00000629, 0x00000627, 0x00000000, 0x00050051, 
+0x00000004, 0x0000062A, 0x00000627, 0x00000001, 0x0004006F, 0x00000004, 0x0000062B, 0x00000628, 
+0x00060050, 0x00000052, 0x0000062C, 0x00000629, 0x0000062A, 0x0000062B, 0x00050057, 0x00000005, 
+0x0000062D, 0x00000623, 0x0000062C, 0x00050051, 0x00000004, 0x0000062E, 0x0000062D, 0x00000000, 
+0x0004003D, 0x00000004, 0x0000062F, 0x000005F1, 0x00050083, 0x00000004, 0x00000630, 0x0000062E, 
+0x0000062F, 0x0003003E, 0x00000631, 0x00000630, 0x00050041, 0x00000067, 0x00000632, 0x000005E2, 
+0x00000096, 0x0004003D, 0x00000004, 0x00000633, 0x00000632, 0x0004003D, 0x00000004, 0x00000634, 
+0x00000631, 0x0007000C, 0x00000004, 0x00000635, 0x00000001, 0x00000030, 0x00000633, 0x00000634, 
+0x0004003D, 0x00000004, 0x00000636, 0x000005F2, 0x00050081, 0x00000004, 0x00000637, 0x00000636, 
+0x00000635, 0x0003003E, 0x000005F2, 0x00000637, 0x000200F9, 0x0000060F, 0x000200F8, 0x0000060F, 
+0x0004003D, 0x00000009, 0x00000638, 0x0000060B, 0x00050080, 0x00000009, 0x00000639, 0x00000638, 
+0x00000012, 0x0003003E, 0x0000060B, 0x00000639, 0x000200F9, 0x0000060C, 0x000200F8, 0x00000610, 
+0x0004003D, 0x00000004, 0x0000063A, 0x000005F2, 0x00050088, 0x00000004, 0x0000063C, 0x0000063A, 
+0x0000063B, 0x000200FE, 0x0000063C, 0x00010038, 0x00050036, 0x00000004, 0x000005A8, 0x00000000, 
+0x0000063D, 0x00030037, 0x00000067, 0x0000063E, 0x00030037, 0x00000067, 0x0000063F, 0x00030037, 
+0x00000067, 0x00000640, 0x00030037, 0x00000067, 0x00000641, 0x000200F8, 0x00000642, 0x0004003B, 
+0x00000067, 0x00000644, 0x00000007, 0x0004003B, 0x00000067, 0x00000646, 0x00000007, 0x0004003B, 
+0x00000067, 0x00000648, 0x00000007, 0x0004003B, 0x00000067, 0x0000064A, 0x00000007, 0x0004003D, 
+0x00000004, 0x00000645, 0x0000063E, 0x0003003E, 0x00000644, 0x00000645, 0x0004003D, 0x00000004, 
+0x00000647, 0x0000063F, 0x0003003E, 0x00000646, 0x00000647, 0x0004003D, 0x00000004, 0x00000649, 
+0x00000640, 0x0003003E, 0x00000648, 0x00000649, 0x0004003D, 0x00000004, 0x0000064B, 0x00000641, 
+0x0003003E, 0x0000064A, 0x0000064B, 0x00080039, 0x00000004, 0x0000064C, 0x00000643, 0x00000644, 
+0x00000646, 0x00000648, 0x0000064A, 0x000200FE, 0x0000064C, 0x00010038, 0x00050036, 0x00000052, 
+0x000005BD, 0x00000000, 0x000005B4, 0x00030037, 0x000000CE, 0x0000064D, 0x00030037, 0x000002C2, 
+0x0000064E, 0x00030037, 0x0000008D, 0x0000064F, 0x00030037, 0x00000067, 0x00000650, 0x00030037, 
+0x00000067, 0x00000651, 0x00030037, 0x00000067, 0x00000652, 0x00030037, 0x00000067, 0x00000653, 
+0x000200F8, 0x00000654, 0x0004003B, 0x00000067, 0x00000656, 0x00000007, 0x0004003B, 0x00000067, 
+0x00000659, 0x00000007, 0x0004003B, 0x0000008D, 0x0000065B, 0x00000007, 0x0004003B, 0x0000008D, 
+0x0000065E, 0x00000007, 0x0004003B, 0x00000067, 0x00000661, 0x00000007, 0x0004003B, 0x00000067, 
+0x00000663, 0x00000007, 0x0004003B, 0x00000067, 0x00000666, 0x00000007, 0x0004003B, 0x00000067, 
+0x00000668, 0x00000007, 0x0004003B, 0x00000067, 0x0000066B, 0x00000007, 0x0004003B, 0x0000008D, 
+0x0000066D, 0x00000007, 0x0004003B, 0x00000067, 0x00000670, 0x00000007, 0x0004003B, 0x0000008D, 
+0x00000673, 0x00000007, 0x00050041, 0x00000067, 0x00000657, 0x0000064D, 0x0000001F, 0x0004003D, 
+0x00000004, 0x00000658, 0x00000657, 0x0003003E, 0x00000656, 0x00000658, 0x0004003D, 0x00000004, 
+0x0000065A, 0x00000652, 0x0003003E, 0x00000659, 0x0000065A, 0x00050041, 0x0000008D, 0x0000065C, 
+0x0000064D, 0x00000016, 0x0004003D, 0x00000052, 0x0000065D, 0x0000065C, 0x0003003E, 0x0000065B, 
+0x0000065D, 0x0004003D, 0x00000052, 0x0000065F, 0x0000064F, 0x0003003E, 0x0000065E, 0x0000065F, 
+0x00080039, 0x00000004, 0x00000660, 0x00000655, 0x00000656, 0x00000659, 0x0000065B, 0x0000065E, 
+0x0003003E, 0x00000661, 0x00000660, 0x00050041, 0x00000067, 0x00000664, 0x0000064D, 0x0000001F, 
+0x0004003D, 0x00000004, 0x00000665, 0x00000664, 0x0003003E, 0x00000663, 0x00000665, 0x0004003D, 
+0x00000004, 0x00000667, 0x00000650, 0x0003003E, 0x00000666, 0x00000667, 0x0004003D, 0x00000004, 
+0x00000669, 0x00000651, 0x0003003E, 0x00000668, 0x00000669, 0x00070039, 0x00000004, 0x0000066A, 
+0x00000662, 0x00000663, 0x00000666, 0x00000668, 0x0003003E, 0x0000066B, 0x0000066A, 0x00050041, 
+0x0000008D, 0x0000066E, 0x0000064D, 0x0000017C, 0x0004003D, 0x00000052, 0x0000066F, 0x0000066E, 
+0x0003003E, 0x0000066D, 0x0000066F, 0x0004003D, 0x00000004, 0x00000671, 0x00000653, 0x0003003E, 
+0x00000670, 0x00000671, 0x00060039, 0x00000052, 0x00000672, 0x0000066C, 0x0000066D, 0x00000670, 
+0x0003003E, 0x00000673, 0x00000672, 0x0004003D, 0x00000004, 0x00000674, 0x00000661, 0x0004003D, 
+0x00000004, 0x00000675, 0x0000066B, 0x00050085, 0x00000004, 0x00000676, 0x00000674, 0x00000675, 
+0x0004003D, 0x00000052, 0x00000677, 0x00000673, 0x0005008E, 0x00000052, 0x00000678, 0x00000677, 
+0x00000676, 0x000200FE, 0x00000678, 0x00010038, 0x00050036, 0x00000004, 0x000005E9, 0x00000000, 
+0x00000679, 0x00030037, 0x0000008D, 0x0000067A, 0x00030037, 0x0000008D, 0x0000067B, 0x00030037, 
+0x000001F8, 0x0000067C, 0x000200F8, 0x0000067D, 0x0004003B, 0x00000067, 0x00000681, 0x00000007, 
+0x0004003B, 0x00000067, 0x0000068A, 0x00000007, 0x00050041, 0x0000006B, 0x0000067F, 0x00000018, 
+0x0000067E, 0x0004003D, 0x00000004, 0x00000680, 0x0000067F, 0x0003003E, 0x00000681, 0x00000680, 
+0x0004003D, 0x00000004, 0x00000682, 0x00000681, 0x0004003D, 0x00000052, 0x00000683, 0x0000067B, 
+0x0004003D, 0x00000052, 0x00000684, 0x0000067A, 0x00050094, 0x00000004, 0x00000685, 0x00000683, 
+0x00000684, 0x00050083, 0x00000004, 0x00000686, 0x0000005F, 0x00000685, 0x00050085, 0x00000004, 
+0x00000687, 0x00000682, 0x00000686, 0x0004003D, 0x00000004, 0x00000688, 0x00000681, 0x0007000C, 
+0x00000004, 0x00000689, 0x00000001, 0x00000028, 0x00000687, 0x00000688, 0x0003003E, 0x0000068A, 
+0x00000689, 0x0004003D, 0x00000004, 0x0000068B, 0x0000068A, 0x000200FE, 0x0000068B, 0x00010038, 
+0x00050036, 0x00000004, 0x000005F3, 0x00000000, 0x0000068C, 0x00030037, 0x0000010F, 0x0000068D, 
+0x000200F8, 0x0000068E, 0x0004003D, 0x00000053, 0x0000068F, 0x0000068D, 0x00050094, 0x00000004, 
+0x00000693, 0x0000068F, 0x00000692, 0x0006000C, 0x00000004, 0x00000694, 0x00000001, 0x0000000D, 
+0x00000693, 0x00050085, 0x00000004, 0x00000696, 0x00000694, 0x00000695, 0x0006000C, 0x00000004, 
+0x00000697, 0x00000001, 0x0000000A, 0x00000696, 0x000200FE, 0x00000697, 0x00010038, 0x00050036, 
+0x00000004, 0x00000601, 0x00000000, 0x00000698, 0x00030037, 0x0000008D, 0x00000699, 0x00030037, 
+0x000001F8, 0x0000069A, 0x000200F8, 0x0000069B, 0x0004003B, 0x00000064, 0x000006A3, 0x00000007, 
+0x0004003B, 0x00000064, 0x000006A5, 0x00000007, 0x0004003D, 0x00000052, 0x0000069C, 0x00000699, 
+0x0004003D, 0x00000009, 0x0000069D, 0x0000069A, 0x00050051, 0x00000004, 0x0000069E, 0x0000069C, 
+0x00000000, 0x00050051, 0x00000004, 0x0000069F, 0x0000069C, 0x00000001, 0x00050051, 0x00000004, 
+0x000006A0, 0x0000069C, 0x00000002, 0x0004006F, 0x00000004, 0x000006A1, 0x0000069D, 0x00070050, 
+0x00000005, 0x000006A2, 0x0000069E, 0x0000069F, 0x000006A0, 0x000006A1, 0x0003003E, 0x000006A3, 
+0x000006A2, 0x0004003D, 0x00000005, 0x000006A6, 0x000006A3, 0x0003003E, 0x000006A5, 0x000006A6, 
+0x00050039, 0x00000004, 0x000006A7, 0x000006A4, 0x000006A5, 0x000200FE, 0x000006A7, 0x00010038, 
+0x00050036, 0x00000004, 0x00000613, 0x00000000, 0x0000068C, 0x00030037, 0x0000010F, 0x000006A8, 
+0x000200F8, 0x000006A9, 0x0004003B, 0x0000008D, 0x000006AE, 0x00000007, 0x0003003E, 0x000006AE, 
+0x000006AD, 0x00050041, 0x00000067, 0x000006AF, 0x000006AE, 0x00000096, 0x0004003D, 0x00000004, 
+0x000006B0, 0x000006AF, 0x0004003D, 0x00000053, 0x000006B1, 0x000006A8, 0x0004003D, 0x00000052, 
+0x000006B2, 0x000006AE, 0x0007004F, 0x00000053, 0x000006B3, 0x000006B2, 0x000006B2, 0x00000000, 
+0x00000001, 0x00050094, 0x00000004, 0x000006B4, 0x000006B1, 0x000006B3, 0x0006000C, 0x00000004, 
+0x000006B5, 0x00000001, 0x0000000A, 0x000006B4, 0x00050085, 0x00000004, 0x000006B6, 0x000006B0, 
+0x000006B5, 0x0006000C, 0x00000004, 0x000006B7, 0x00000001, 0x0000000A, 0x000006B6, 0x000200FE, 
+0x000006B7, 0x00010038, 0x00050036, 0x00000053, 0x00000618, 0x00000000, 0x000006B8, 0x00030037, 
+0x000001F8, 0x000006B9, 0x00030037, 0x00000067, 0x000006BA, 0x00030037, 0x00000067, 0x000006BB, 
+0x000200F8, 0x000006BC, 0x0004003B, 0x00000067, 0x000006BE, 0x00000007, 0x0004003B, 0x00000067, 
+0x000006C5, 0x00000007, 0x0004003B, 0x00000067, 0x000006CC, 0x00000007, 0x0004003B, 0x00000067, 
+0x000006CF, 0x00000007, 0x0004003B, 0x00000067, 0x000006D2, 0x00000007, 0x0003003E, 0x000006BE, 
+0x000006BD, 0x0004003D, 0x00000009, 0x000006BF, 0x000006B9, 0x0004006F, 0x00000004, 0x000006C0, 
+0x000006BF, 0x00050081, 0x00000004, 0x000006C1, 0x000006C0, 0x000004B2, 0x0006000C, 0x00000004, 
+0x000006C2, 0x00000001, 0x0000001F, 0x000006C1, 0x0004003D, 0x00000004, 0x000006C3, 0x000006BA, 
+0x00050085, 0x00000004, 0x000006C4, 0x000006C2, 0x000006C3, 0x0003003E, 0x000006C5, 0x000006C4, 
+0x0004003D, 0x00000009, 0x000006C6, 0x000006B9, 0x0004003D, 0x00000004, 0x000006C7, 0x000006BE, 
+0x0004006F, 0x00000004, 0x000006C8, 0x000006C6, 0x00050085, 0x00000004, 0x000006C9, 0x000006C8, 
+0x000006C7, 0x0004003D, 0x00000004, 0x000006CA, 0x000006BB, 0x00050081, 0x00000004, 0x000006CB, 
+0x000006C9, 0x000006CA, 0x0003003E, 0x000006CC, 0x000006CB, 0x0004003D, 0x00000004, 0x000006CD, 
+0x000006CC, 0x0006000C, 0x00000004, 0x000006CE, 0x00000001, 0x0000000D, 0x000006CD, 0x0003003E, 
+0x000006CF, 0x000006CE, 0x0004003D, 0x00000004, 0x000006D0, 0x000006CC, 0x0006000C, 0x00000004, 
+0x000006D1, 0x00000001, 0x0000000E, 0x000006D0, 0x0003003E, 0x000006D2, 0x000006D1, 0x0004003D, 
+0x00000004, 0x000006D3, 0x000006C5, 0x0004003D, 0x00000004, 0x000006D4, 0x000006D2, 0x00050085, 
+0x00000004, 0x000006D5, 0x000006D3, 0x000006D4, 0x0004003D, 0x00000004, 0x000006D6, 0x000006C5, 
+0x0004003D, 0x00000004, 0x000006D7, 0x000006CF, 0x00050085, 0x00000004, 0x000006D8, 0x000006D6, 
+0x000006D7, 0x00050050, 0x00000053, 0x000006D9, 0x000006D5, 0x000006D8, 0x000200FE, 0x000006D9, 
+0x00010038, 0x00050036, 0x00000004, 0x00000643, 0x00000000, 0x0000063D, 0x00030037, 0x00000067, 
+0x000006DA, 0x00030037, 0x00000067, 0x000006DB, 0x00030037, 0x00000067, 0x000006DC, 0x00030037, 
+0x00000067, 0x000006DD, 0x000200F8, 0x000006DE, 0x0004003B, 0x00000067, 0x000006E6, 0x00000007, 
+0x0004003B, 0x00000067, 0x000006E8, 0x00000007, 0x0004003B, 0x00000067, 0x000006E9, 0x00000007, 
+0x0004003B, 0x00000067, 0x000006EB, 0x00000007, 0x0004003B, 0x00000067, 0x000006EE, 0x00000007, 
+0x0004003B, 0x00000067, 0x000006EF, 0x00000007, 0x0004003B, 0x00000067, 0x000006F0, 0x00000007, 
+0x0004003B, 0x00000067, 0x000006F2, 0x00000007, 0x0004003B, 0x00000067, 0x000006F5, 0x00000007, 
+0x0004003D, 0x00000004, 0x000006DF, 0x000006DA, 0x00050085, 0x00000004, 0x000006E0, 0x000000AA, 
+0x000006DF, 0x0004003D, 0x00000004, 0x000006E1, 0x000006DD, 0x00050085, 0x00000004, 0x000006E2, 
+0x000006E0, 0x000006E1, 0x0004003D, 0x00000004, 0x000006E3, 0x000006DD, 0x00050085, 0x00000004, 
+0x000006E4, 0x000006E2, 0x000006E3, 0x00050081, 0x00000004, 0x000006E5, 0x000004B2, 0x000006E4, 
+0x0003003E, 0x000006E6, 0x000006E5, 0x0003003E, 0x000006E8, 0x0000005F, 0x0004003D, 0x00000004, 
+0x000006EA, 0x000006E6, 0x0003003E, 0x000006E9, 0x000006EA, 0x0004003D, 0x00000004, 0x000006EC, 
+0x000006DC, 0x0003003E, 0x000006EB, 0x000006EC, 0x00070039, 0x00000004, 0x000006ED, 0x000006E7, 
+0x000006E8, 0x000006E9, 0x000006EB, 0x0003003E, 0x000006EE, 0x000006ED, 0x0003003E, 0x000006EF, 
+0x0000005F, 0x0004003D, 0x00000004, 0x000006F1, 0x000006E6, 0x0003003E, 0x000006F0, 0x000006F1, 
+0x0004003D, 0x00000004, 0x000006F3, 0x000006DB, 0x0003003E, 0x000006F2, 0x000006F3, 0x00070039, 
+0x00000004, 0x000006F4, 0x000006E7, 0x000006EF, 0x000006F0, 0x000006F2, 0x0003003E, 0x000006F5, 
+0x000006F4, 0x0004003D, 0x00000004, 0x000006F6, 0x000006EE, 0x0004003D, 0x00000004, 0x000006F7, 
+0x000006F5, 0x00050085, 0x00000004, 0x000006F8, 0x000006F6, 0x000006F7, 0x00050085, 0x00000004, 
+0x000006FB, 0x000006F8, 0x000006FA, 0x000200FE, 0x000006FB, 0x00010038, 0x00050036, 0x00000004, 
+0x00000655, 0x00000000, 0x000006FC, 0x00030037, 0x00000067, 0x000006FD, 0x00030037, 0x00000067, 
+0x000006FE, 0x00030037, 0x0000008D, 0x000006FF, 0x00030037, 0x0000008D, 0x00000700, 0x000200F8, 
+0x00000701, 0x0004003B, 0x00000067, 0x00000703, 0x00000007, 0x0004003B, 0x00000067, 0x00000705, 
+0x00000007, 0x0004003B, 0x0000008D, 0x00000707, 0x00000007, 0x0004003B, 0x0000008D, 0x00000709, 
+0x00000007, 0x0004003D, 0x00000004, 0x00000704, 0x000006FD, 0x0003003E, 0x00000703, 0x00000704, 
+0x0004003D, 0x00000004, 0x00000706, 0x000006FE, 0x0003003E, 0x00000705, 0x00000706, 0x0004003D, 
+0x00000052, 0x00000708, 0x00000700, 0x0003003E, 0x00000707, 0x00000708, 0x0004003D, 0x00000052, 
+0x0000070A, 0x000006FF, 0x0003003E, 0x00000709, 0x0000070A, 0x00080039, 0x00000004, 0x0000070B, 
+0x00000702, 0x00000703, 0x00000705, 0x00000707, 0x00000709, 0x000200FE, 0x0000070B, 0x00010038, 
+0x00050036, 0x00000004, 0x00000662, 0x00000000, 0x0000070C, 0x00030037, 0x00000067, 0x0000070D, 
+0x00030037, 0x00000067, 0x0000070E, 0x00030037, 0x00000067, 0x0000070F, 0x000200F8, 0x00000710, 
+0x0004003B, 0x00000067, 0x00000712, 0x00000007, 0x0004003B, 0x00000067, 0x00000714, 0x00000007, 
+0x0004003B, 0x00000067, 0x00000716, 0x00000007, 0x0004003D, 0x00000004, 0x00000713, 0x0000070D, 
+0x0003003E, 0x00000712, 0x00000713, 0x0004003D, 0x00000004, 0x00000715, 0x0000070E, 0x0003003E, 
+0x00000714, 0x00000715, 0x0004003D, 0x00000004, 0x00000717, 0x0000070F, 0x0003003E, 0x00000716, 
+0x00000717, 0x00070039, 0x00000004, 0x00000718, 0x00000711, 0x00000712, 0x00000714, 0x00000716, 
+0x000200FE, 0x00000718, 0x00010038, 0x00050036, 0x00000052, 0x0000066C, 0x00000000, 0x00000719, 
+0x00030037, 0x0000008D, 0x0000071A, 0x00030037, 0x00000067, 0x0000071B, 0x000200F8, 0x0000071C, 
+0x0004003B, 0x00000067, 0x00000723, 0x00000007, 0x0004003B, 0x00000067, 0x00000725, 0x00000007, 
+0x0004003B, 0x0000008D, 0x00000727, 0x00000007, 0x0004003B, 0x00000067, 0x00000729, 0x00000007, 
+0x0004003B, 0x00000067, 0x0000072B, 0x00000007, 0x0004003D, 0x00000052, 0x0000071D, 0x0000071A, 
+0x00050094, 0x00000004, 0x00000722, 0x0000071D, 0x00000721, 0x0003003E, 0x00000723, 0x00000722, 
+0x00050039, 0x00000004, 0x00000724, 0x00000141, 0x00000723, 0x0003003E, 0x00000725, 0x00000724, 
+0x0004003D, 0x00000052, 0x00000728, 0x0000071A, 0x0003003E, 0x00000727, 0x00000728, 0x0004003D, 
+0x00000004, 0x0000072A, 0x00000725, 0x0003003E, 0x00000729, 0x0000072A, 0x0004003D, 0x00000004, 
+0x0000072C, 0x0000071B, 0x0003003E, 0x0000072B, 0x0000072C, 0x00070039, 0x00000052, 0x0000072D, 
+0x00000726, 0x00000727, 0x00000729, 0x0000072B, 0x000200FE, 0x0000072D, 0x00010038, 0x00050036, 
+0x00000004, 0x000006A4, 0x00000000, 0x0000072E, 0x00030037, 0x00000064, 0x0000072F, 0x000200F8, 
+0x00000730, 0x0004003B, 0x00000067, 0x00000736, 0x00000007, 0x0004003D, 0x00000005, 0x00000731, 
+0x0000072F, 0x00050094, 0x00000004, 0x00000735, 0x00000731, 0x00000734, 0x0003003E, 0x00000736, 
+0x00000735, 0x0004003D, 0x00000004, 0x00000737, 0x00000736, 0x0006000C, 0x00000004, 0x00000738, 
+0x00000001, 0x0000000D, 0x00000737, 0x00050085, 0x00000004, 0x00000739, 0x00000738, 0x00000695, 
+0x0006000C, 0x00000004, 0x0000073A, 0x00000001, 0x0000000A, 0x00000739, 0x000200FE, 0x0000073A, 
+0x00010038, 0x00050036, 0x00000004, 0x000006E7, 0x00000000, 0x0000070C, 0x00030037, 0x00000067, 
+0x0000073B, 0x00030037, 0x00000067, 0x0000073C, 0x00030037, 0x00000067, 0x0000073D, 0x000200F8, 
+0x0000073E, 0x0004003D, 0x00000004, 0x0000073F, 0x0000073C, 0x0004003D, 0x00000004, 0x00000740, 
+0x0000073D, 0x0004003D, 0x00000004, 0x00000741, 0x0000073C, 0x00050083, 0x00000004, 0x00000742, 
+0x00000740, 0x00000741, 0x0004003D, 0x00000004, 0x00000743, 0x0000073B, 0x00050083, 0x00000004, 
+0x00000744, 0x0000005F, 0x00000743, 0x0007000C, 0x00000004, 0x00000745, 0x00000001, 0x0000001A, 
+0x00000744, 0x00000508, 0x00050085, 0x00000004, 0x00000746, 0x00000742, 0x00000745, 0x00050081, 
+0x00000004, 0x00000747, 0x0000073F, 0x00000746, 0x000200FE, 0x00000747, 0x00010038, 0x00050036, 
+0x00000004, 0x00000702, 0x00000000, 0x000006FC, 0x00030037, 0x00000067, 0x00000748, 0x00030037, 
+0x00000067, 0x00000749, 0x00030037, 0x0000008D, 0x0000074A, 0x00030037, 0x0000008D, 0x0000074B, 
+0x000200F8, 0x0000074C, 0x0004003B, 0x0000008D, 0x00000750, 0x00000007, 0x0004003B, 0x00000067, 
+0x00000754, 0x00000007, 0x0004003B, 0x00000067, 0x0000075E, 0x00000007, 0x0004003B, 0x00000067, 
+0x00000763, 0x00000007, 0x0004003D, 0x00000052, 0x0000074D, 0x0000074A, 0x0004003D, 0x00000052, 
+0x0000074E, 0x0000074B, 0x0007000C, 0x00000052, 0x0000074F, 0x00000001, 0x00000044, 0x0000074D, 
+0x0000074E, 0x0003003E, 0x00000750, 0x0000074F, 0x0004003D, 0x00000004, 0x00000751, 0x00000749, 
+0x0004003D, 0x00000004, 0x00000752, 0x00000748, 0x00050085, 0x00000004, 0x00000753, 0x00000751, 
+0x00000752, 0x0003003E, 0x00000754, 0x00000753, 0x0004003D, 0x00000004, 0x00000755, 0x00000748, 
+0x0004003D, 0x00000052, 0x00000756, 0x00000750, 0x0004003D, 0x00000052, 0x00000757, 0x00000750, 
+0x00050094, 0x00000004, 0x00000758, 0x00000756, 0x00000757, 0x0004003D, 0x00000004, 0x00000759, 
+0x00000754, 0x0004003D, 0x00000004, 0x0000075A, 0x00000754, 0x00050085, 0x00000004, 0x0000075B, 
+0x00000759, 0x0000075A, 0x00050081, 0x00000004, 0x0000075C, 0x00000758, 0x0000075B, 0x00050088, 
+0x00000004, 0x0000075D, 0x00000755, 0x0000075C, 0x0003003E, 0x0000075E, 0x0000075D, 0x0004003D, 
+0x00000004, 0x0000075F, 0x0000075E, 0x0004003D, 0x00000004, 0x00000760, 0x0000075E, 0x00050085, 
+0x00000004, 0x00000761, 0x0000075F, 0x00000760, 0x00050085, 0x00000004, 0x00000762, 0x00000761, 
+0x000006FA, 0x0003003E, 0x00000763, 0x00000762, 0x0004003D, 0x00000004, 0x00000764, 0x00000763, 
+0x0007000C, 0x00000004, 0x00000766, 0x00000001, 0x00000025, 0x00000764, 0x00000765, 0x000200FE, 
+0x00000766, 0x00010038, 0x00050036, 0x00000004, 0x00000711, 0x00000000, 0x0000070C, 0x00030037, 
+0x00000067, 0x00000767, 0x00030037, 0x00000067, 0x00000768, 0x00030037, 0x00000067, 0x00000769, 
+0x000200F8, 0x0000076A, 0x0004003B, 0x00000067, 0x0000076E, 0x00000007, 0x0004003B, 0x00000067, 
+0x0000077C, 0x00000007, 0x0004003B, 0x00000067, 0x0000078A, 0x00000007, 0x0004003D, 0x00000004, 
+0x0000076B, 0x00000769, 0x0004003D, 0x00000004, 0x0000076C, 0x00000769, 0x00050085, 0x00000004, 
+0x0000076D, 0x0000076B, 0x0000076C, 0x0003003E, 0x0000076E, 0x0000076D, 0x0004003D, 0x00000004, 
+0x0000076F, 0x00000767, 0x0004003D, 0x00000004, 0x00000770, 0x00000768, 0x0004007F, 0x00000004, 
+0x00000771, 0x00000770, 0x0004003D, 0x00000004, 0x00000772, 0x0000076E, 0x00050085, 0x00000004, 
+0x00000773, 0x00000771, 0x00000772, 0x0004003D, 0x00000004, 0x00000774, 0x00000768, 0x00050081, 
+0x00000004, 0x00000775, 0x00000773, 0x00000774, 0x0004003D, 0x00000004, 0x00000776, 0x00000768, 
+0x00050085, 0x00000004, 0x00000777, 0x00000775, 0x00000776, 0x0004003D, 0x00000004, 0x00000778, 
+0x0000076E, 0x00050081, 0x00000004, 0x00000779, 0x00000777, 0x00000778, 0x0006000C, 0x00000004, 
+0x0000077A, 0x00000001, 0x0000001F, 0x00000779, 0x00050085, 0x00000004, 0x0000077B, 0x0000076F, 
+0x0000077A, 0x0003003E, 0x0000077C, 0x0000077B, 0x0004003D, 0x00000004, 0x0000077D, 0x00000768, 
+0x0004003D, 0x00000004, 0x0000077E, 0x00000767, 0x0004007F, 0x00000004, 0x0000077F, 0x0000077E, 
+0x0004003D, 0x00000004, 0x00000780, 0x0000076E, 0x00050085, 0x00000004, 0x00000781, 0x0000077F, 
+0x00000780, 0x0004003D, 0x00000004, 0x00000782, 0x00000767, 0x00050081, 0x00000004, 0x00000783, 
+0x00000781, 0x00000782, 0x0004003D, 0x00000004, 0x00000784, 0x00000767, 0x00050085, 0x00000004, 
+0x00000785, 0x00000783, 0x00000784, 0x0004003D, 0x00000004, 0x00000786, 0x0000076E, 0x00050081, 
+0x00000004, 0x00000787, 0x00000785, 0x00000786, 0x0006000C, 0x00000004, 0x00000788, 0x00000001, 
+0x0000001F, 0x00000787, 0x00050085, 0x00000004, 0x00000789, 0x0000077D, 0x00000788, 0x0003003E, 
+0x0000078A, 0x00000789, 0x0004003D, 0x00000004, 0x0000078B, 0x0000078A, 0x0004003D, 0x00000004, 
+0x0000078C, 0x0000077C, 0x00050081, 0x00000004, 0x0000078D, 0x0000078B, 0x0000078C, 0x00050088, 
+0x00000004, 0x0000078E, 0x000004B2, 0x0000078D, 0x000200FE, 0x0000078E, 0x00010038, 0x00050036, 
+0x00000052, 0x00000726, 0x00000000, 0x000004F8, 0x00030037, 0x0000008D, 0x0000078F, 0x00030037, 
+0x00000067, 0x00000790, 0x00030037, 0x00000067, 0x00000791, 0x000200F8, 0x00000792, 0x0004003B, 
+0x00000067, 0x0000079B, 0x00000007, 0x0004003D, 0x00000052, 0x00000793, 0x0000078F, 0x0004003D, 
+0x00000004, 0x00000794, 0x00000790, 0x0004003D, 0x00000052, 0x00000795, 0x0000078F, 0x00060050, 
+0x00000052, 0x00000796, 0x00000794, 0x00000794, 0x00000794, 0x00050083, 0x00000052, 0x00000797, 
+0x00000796, 0x00000795, 0x0004003D, 0x00000004, 0x00000798, 0x00000791, 0x00050083, 0x00000004, 
+0x00000799, 0x0000005F, 0x00000798, 0x0003003E, 0x0000079B, 0x00000799, 0x00050039, 0x00000004, 
+0x0000079C, 0x0000079A, 0x0000079B, 0x0005008E, 0x00000052, 0x0000079D, 0x00000797, 0x0000079C, 
+0x00050081, 0x00000052, 0x0000079E, 0x00000793, 0x0000079D, 0x000200FE, 0x0000079E, 0x00010038, 
+0x00050036, 0x00000004, 0x0000079A, 0x00000000, 0x00000284, 0x00030037, 0x00000067, 0x0000079F, 
+0x000200F8, 0x000007A0, 0x0004003B, 0x00000067, 0x000007A4, 0x00000007, 0x0004003D, 0x00000004, 
+0x000007A1, 0x0000079F, 0x0004003D, 0x00000004, 0x000007A2, 0x0000079F, 0x00050085, 0x00000004, 
+0x000007A3, 0x000007A1, 0x000007A2, 0x0003003E, 0x000007A4, 0x000007A3, 0x0004003D, 0x00000004, 
+0x000007A5, 0x000007A4, 0x0004003D, 0x00000004, 0x000007A6, 0x000007A4, 0x00050085, 0x00000004, 
+0x000007A7, 0x000007A5, 0x000007A6, 0x0004003D, 0x00000004, 0x000007A8, 0x0000079F, 0x00050085, 
+0x00000004, 0x000007A9, 0x000007A7, 0x000007A8, 0x000200FE, 0x000007A9, 0x00010038, 
     };
\ No newline at end of file
@@ -0,0 +1,7 @@
+#shader vertex
+CompiledSPV/ForwardPBRAnimCompact.vert.spv
+#shader end
+
+#shader fragment
+CompiledSPV/DepthPrePassAlpha.frag.spv
+#shader end
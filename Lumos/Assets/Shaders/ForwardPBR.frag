@@ -1,7 +1,9 @@
 #version 450
+#define FRAGMENT_SHADER
 #include "Buffers.glslh"
 #include "PBR.glslh"
 #include "PBRResources.glslh"
+#include "Clusters.glslh"
 
 #extension GL_ARB_separate_shader_objects : enable
 #extension GL_ARB_shading_language_420pack : enable
@@ -319,105 +321,117 @@ vec3 SpecularLobe(const Material material, const Light light, const vec3 h, floa
 
 #define NEW_LIGHTING 1
 
-vec3 Lighting(vec3 F0, vec3 wsPos, Material material)
+vec3 LightContribution(Light light, vec3 wsPos, Material material)
 {
-	vec3 result = vec3(0.0);
+	float value = 0.0;
 
-	for(int i = 0; i < u_SceneData.LightCount; i++)
+	if(light.type == 2.0)
 	{
-		Light light = u_SceneData.lights[i];
-		float value = 0.0;
+	    // Vector to light
+		vec3 L = light.position.xyz - wsPos;
+		// Distance from light to fragment position
+		float dist = length(L);
 
-		if(light.type == 2.0)
-		{
-		    // Vector to light
-			vec3 L = light.position.xyz - wsPos;
-			// Distance from light to fragment position
-			float dist = length(L);
+		// Light to fragment
+		L = normalize(L);
 
-			// Light to fragment
-			L = normalize(L);
+		// Attenuation
+		float atten = light.radius / (pow(dist, 2.0) + 1.0);
+		float attenuation = clamp(1.0 - (dist * dist) / (light.radius * light.radius), 0.0, 1.0);
 
-			// Attenuation
-			float atten = light.radius / (pow(dist, 2.0) + 1.0);
-			float attenuation = clamp(1.0 - (dist * dist) / (light.radius * light.radius), 0.0, 1.0);
+		value = attenuation;
 
-			value = attenuation;
+		light.direction = vec4(L,1.0);
+	}
+	else if (light.type == 1.0)
+	{
+		vec3 L = light.position.xyz - wsPos;
+		float cutoffAngle   = 1.0f - light.angle;
+		float dist          = length(L);
+		L = normalize(L);
+		float theta         = dot(L.xyz, light.direction.xyz);
+		float epsilon       = cutoffAngle - cutoffAngle * 0.9f;
+		float attenuation 	= ((theta - cutoffAngle) / epsilon); // atteunate when approaching the outer cone
+		attenuation         *= light.radius / (pow(dist, 2.0) + 1.0);//saturate(1.0f - dist / light.range);
+		//float intensity 	= attenuation * attenuation;
+
+		// Erase light if there is no need to compute it
+		//intensity *= step(theta, cutoffAngle);
+
+		value = clamp(attenuation, 0.0, 1.0);
+	}
+	else
+	{
+		float nDotL = dot(material.Normal, light.direction.xyz);
 
-			light.direction = vec4(L,1.0);
-		}
-		else if (light.type == 1.0)
+		if(u_SceneData.shadowEnabled > 0 && nDotL > 0.0f)
 		{
-			vec3 L = light.position.xyz - wsPos;
-			float cutoffAngle   = 1.0f - light.angle;
-			float dist          = length(L);
-			L = normalize(L);
-			float theta         = dot(L.xyz, light.direction.xyz);
-			float epsilon       = cutoffAngle - cutoffAngle * 0.9f;
-			float attenuation 	= ((theta - cutoffAngle) / epsilon); // atteunate when approaching the outer cone
-			attenuation         *= light.radius / (pow(dist, 2.0) + 1.0);//saturate(1.0f - dist / light.range);
-			//float intensity 	= attenuation * attenuation;
-
-			// Erase light if there is no need to compute it
-			//intensity *= step(theta, cutoffAngle);
-
-			value = clamp(attenuation, 0.0, 1.0);
+		int cascadeIndex = CalculateCascadeIndex(wsPos);
+			value = CalculateShadow(wsPos,cascadeIndex, light.direction.xyz, material.Normal);
 		}
 		else
-		{
-			float nDotL = dot(material.Normal, light.direction.xyz);
-
-			if(u_SceneData.shadowEnabled > 0 && nDotL > 0.0f)
-			{
-			int cascadeIndex = CalculateCascadeIndex(wsPos);
-				value = CalculateShadow(wsPos,cascadeIndex, light.direction.xyz, material.Normal);
-			}
-			else
-				value = 1.0;
-		}
+			value = 1.0;
+	}
 
-		vec3 Li = light.direction.xyz;
-		vec3 Lradiance = light.colour.xyz * light.intensity;
-		vec3 Lh = normalize(Li + material.View);
+	vec3 Li = light.direction.xyz;
+	vec3 Lradiance = light.colour.xyz * light.intensity;
+	vec3 Lh = normalize(Li + material.View);
 
 #if NEW_LIGHTING == 0
 
-		// Calculate angles between surface normal and various light vectors.
-		float cosLi = max(0.0, dot(material.Normal, Li));
-		float cosLh = max(0.0, dot(material.Normal, Lh));
+	// Calculate angles between surface normal and various light vectors.
+	float cosLi = max(0.0, dot(material.Normal, Li));
+	float cosLh = max(0.0, dot(material.Normal, Lh));
 
-		vec3 F = fresnelSchlickRoughness(F0, max(0.0, dot(Lh,  material.View)), material.Roughness);
+	vec3 F = fresnelSchlickRoughness(material.F0, max(0.0, dot(Lh,  material.View)), material.Roughness);
 
-		float D = ndfGGX(cosLh, material.Roughness);
-		float G = gaSchlickGGX(cosLi, material.NDotV, material.Roughness);
+	float D = ndfGGX(cosLh, material.Roughness);
+	float G = gaSchlickGGX(cosLi, material.NDotV, material.Roughness);
 
-		vec3 kd = (1.0 - F) * (1.0 - material.Metallic.x);
-		vec3 diffuseBRDF = kd * material.Albedo.xyz;
+	vec3 kd = (1.0 - F) * (1.0 - material.Metallic.x);
+	vec3 diffuseBRDF = kd * material.Albedo.xyz;
 
-		// Cook-Torrance
-		vec3 specularBRDF = (F * D * G) / max(Epsilon, 4.0 * cosLi * material.NDotV);
+	// Cook-Torrance
+	vec3 specularBRDF = (F * D * G) / max(Epsilon, 4.0 * cosLi * material.NDotV);
 
-		specularBRDF = clamp(specularBRDF, vec3(0.0f), vec3(10.0f));//;
-		result += (diffuseBRDF + specularBRDF) * Lradiance * cosLi * value * ComputeMicroShadowing(saturate(cosLi), material.AO);
+	specularBRDF = clamp(specularBRDF, vec3(0.0f), vec3(10.0f));//;
+	return (diffuseBRDF + specularBRDF) * Lradiance * cosLi * value * ComputeMicroShadowing(saturate(cosLi), material.AO);
 
 #else
-		float lightNoL = saturate(dot(material.Normal, Li));
-		vec3 h = normalize(material.View + Li);
+	float lightNoL = saturate(dot(material.Normal, Li));
+	vec3 h = normalize(material.View + Li);
 
-		float shading_NoV = clampNoV(dot(material.Normal, material.View));
-    	float NoV = shading_NoV;
-    	float NoL = saturate(lightNoL);
-    	float NoH = saturate(dot(material.Normal, h));
-    	float LoH = saturate(dot(Li, h));
+	float shading_NoV = clampNoV(dot(material.Normal, material.View));
+	float NoV = shading_NoV;
+	float NoL = saturate(lightNoL);
+	float NoH = saturate(dot(material.Normal, h));
+	float LoH = saturate(dot(Li, h));
 
-    	vec3 Fd = DiffuseLobe(material, NoV, NoL, LoH);
-		vec3 Fr = SpecularLobe(material, light, h, NoV, NoL, NoH, LoH);;
+	vec3 Fd = DiffuseLobe(material, NoV, NoL, LoH);
+	vec3 Fr = SpecularLobe(material, light, h, NoV, NoL, NoH, LoH);;
 
-		vec3 colour = Fd + Fr;// * material.EnergyCompensation;
+	vec3 colour = Fd + Fr;// * material.EnergyCompensation;
 
-		result += (colour * Lradiance.rgb) * (value * NoL * ComputeMicroShadowing(NoL, material.AO));
+	return (colour * Lradiance.rgb) * (value * NoL * ComputeMicroShadowing(NoL, material.AO));
 #endif
-	}
+}
+
+vec3 Lighting(vec3 F0, vec3 wsPos, Material material)
+{
+	vec3 result = vec3(0.0);
+
+	// Directional lights, point and spot lights are read from the cluster grid
+	for(int i = 0; i < u_SceneData.LightCount; i++)
+		result += LightContribution(u_SceneData.lights[i], wsPos, material);
+
+	vec3 viewPos = (u_SceneData.ViewMatrix * vec4(wsPos, 1.0)).xyz;
+	uint range   = GetClusterRange(GetClusterIndex(viewPos));
+	uint offset  = range & 0xFFFFu;
+	uint count   = range >> 16u;
+
+	for(uint i = 0u; i < count; i++)
+		result += LightContribution(u_ClusterLights.Lights[GetClusterLightIndex(offset + i)], wsPos, material);
+
 	return result;
 }
 
@@ -44,10 +44,10 @@ void main()
 	ivec4 boneIn = inBoneIndices;
     vec4 boneWe = inBoneWeights;
 
-	mat4 boneTransform = u_BoneTransforms.BoneTransforms[int(boneIn[0])] * boneWe[0];
-    boneTransform += u_BoneTransforms.BoneTransforms[int(boneIn[1])] * boneWe[1];
-    boneTransform += u_BoneTransforms.BoneTransforms[int(boneIn[2])] * boneWe[2];
-    boneTransform += u_BoneTransforms.BoneTransforms[int(boneIn[3])] * boneWe[3];
+	mat4 boneTransform = GetBoneTransform(int(boneIn[0])) * boneWe[0];
+    boneTransform += GetBoneTransform(int(boneIn[1])) * boneWe[1];
+    boneTransform += GetBoneTransform(int(boneIn[2])) * boneWe[2];
+    boneTransform += GetBoneTransform(int(boneIn[3])) * boneWe[3];
 
 	VertexOutput.Position = pushConsts.transform * boneTransform * vec4(position, 1.0);
     gl_Position = u_CameraData.projView * VertexOutput.Position;
@@ -0,0 +1,51 @@
+#version 450
+#extension GL_ARB_separate_shader_objects : enable
+#extension GL_ARB_shading_language_420pack : enable
+#include "Buffers.glslh"
+#include "CompactVertex.glslh"
+
+layout(push_constant) uniform PushConsts
+{
+	mat4 transform;
+	vec4 positionMin;
+	vec4 positionExtent;
+} pushConsts;
+
+layout(location = 0) in vec4 inPosition;
+layout(location = 1) in vec4 inColor;
+layout(location = 2) in vec2 inTexCoord;
+layout(location = 3) in vec4 inNormalTangent;
+
+struct VertexData
+{
+	vec3 Colour;
+	vec2 TexCoord;
+	vec4 Position;
+	vec3 Normal;
+	mat3 WorldNormal;
+};
+
+layout(location = 0) out VertexData VertexOutput;
+
+out gl_PerVertex
+{
+    vec4 gl_Position;
+};
+
+void main()
+{
+	vec3 position = DecodePosition(inPosition, pushConsts.positionMin, pushConsts.positionExtent);
+	vec3 normal = OctDecode(inNormalTangent.xy);
+	vec3 tangent = OctDecode(inNormalTangent.zw);
+	vec3 bitangent = DecodeBitangent(normal, tangent, inPosition.w);
+
+	VertexOutput.Position = pushConsts.transform * vec4(position, 1.0);
+    gl_Position = u_CameraData.projView * VertexOutput.Position;
+
+	VertexOutput.Colour = inColor.xyz;
+	VertexOutput.TexCoord = inTexCoord;
+	mat3 transposeInv = transpose(inverse(mat3(pushConsts.transform)));
+    VertexOutput.Normal = transposeInv * normal;
+
+    VertexOutput.WorldNormal = transposeInv * mat3(tangent, bitangent, normal);
+}
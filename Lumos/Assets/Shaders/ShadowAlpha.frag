@@ -1,6 +1,7 @@
 #version 450
 #extension GL_ARB_separate_shader_objects : enable
 #extension GL_ARB_shading_language_420pack : enable
+#define FRAGMENT_SHADER
 #include "Buffers.glslh"
 #include "PBRResources.glslh"
 
@@ -0,0 +1,42 @@
+#version 450
+#extension GL_ARB_separate_shader_objects : enable
+#extension GL_ARB_shading_language_420pack : enable
+#include "Buffers.glslh"
+#include "CompactVertex.glslh"
+
+layout(push_constant) uniform PushConsts
+{
+	mat4 transform;
+	uint cascadeIndex;
+    float p0;
+    float p1;
+    float p2;
+	vec4 positionMin;
+	vec4 positionExtent;
+} pushConsts;
+
+out gl_PerVertex
+{
+    vec4 gl_Position;
+};
+
+layout(location = 0) in vec4 inPosition;
+layout(location = 1) in vec4 inColor;
+layout(location = 2) in vec2 inTexCoord;
+layout(location = 3) in vec4 inNormalTangent;
+
+layout(location = 0) out vec2 uv;
+
+void main()
+{
+	vec3 position = DecodePosition(inPosition, pushConsts.positionMin, pushConsts.positionExtent);
+	gl_Position = pushConsts.transform * vec4(position, 1.0);
+
+	vec4 test2 = inColor; //SPV vertex layout incorrect when not used
+    uv = inTexCoord;
+	vec4 test5 = inNormalTangent; //SPV vertex layout incorrect when not used
+    float test6 = pushConsts.p0;
+    float test7 = pushConsts.p1;
+    float test8 = pushConsts.p2;
+    uint test9 = pushConsts.cascadeIndex;
+}
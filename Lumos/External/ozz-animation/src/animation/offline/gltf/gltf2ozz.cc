@@ -474,6 +474,11 @@ class GltfImporter : public ozz::animation::offline::OzzImporter {
     m_loader.SetImageLoader(image_loader, NULL);
   }
 
+  // Lets the caller read the gltf and its buffers through its own file system
+  void SetFsCallbacks(const tinygltf::FsCallbacks& _callbacks) {
+    m_loader.SetFsCallbacks(_callbacks);
+  }
+
  private:
   bool Load(const char* _filename) override {
     bool success = false;
@@ -6,10 +6,26 @@ namespace Lumos
 {
 
     AStar::AStar(const std::vector<PathNode*>& nodes)
+        : m_Nodes(nodes)
     {
-        // Create node data
-        for(auto it = nodes.begin(); it != nodes.end(); ++it)
-            m_NodeData[*it] = new QueueablePathNode(*it);
+        m_NodeIndices.reserve(m_Nodes.size());
+        for(uint32_t i = 0; i < uint32_t(m_Nodes.size()); i++)
+            m_NodeIndices[m_Nodes[i]] = i;
+
+        // Flatten the connections, dropping edges to nodes outside the graph
+        m_FirstEdge.reserve(m_Nodes.size() + 1);
+        for(PathNode* node : m_Nodes)
+        {
+            m_FirstEdge.push_back(uint32_t(m_Edges.size()));
+            for(size_t i = 0; i < node->NumConnections(); i++)
+            {
+                PathEdge* edge = node->Edge(i);
+                auto other     = m_NodeIndices.find(edge->OtherNode(node));
+                if(other != m_NodeIndices.end())
+                    m_Edges.push_back({ other->second, edge });
+            }
+        }
+        m_FirstEdge.push_back(uint32_t(m_Edges.size()));
     }
 
     AStar::~AStar()
@@ -18,103 +34,122 @@ namespace Lumos
 
     void AStar::Reset()
     {
-        // Clear caches
-        m_OpenList = PathNodePriorityQueue();
-        m_ClosedList.clear();
         m_Path.clear();
+        m_PathCost = 0.0f;
+    }
 
-        // Reset node data
-        for(auto it = m_NodeData.begin(); it != m_NodeData.end(); ++it)
-        {
-            it->second->Parent = nullptr;
-            it->second->fScore = std::numeric_limits<float>::max();
-            it->second->gScore = std::numeric_limits<float>::max();
-        }
+    uint32_t AStar::GetNodeIndex(PathNode* node) const
+    {
+        auto it = m_NodeIndices.find(node);
+        return it != m_NodeIndices.end() ? it->second : QueueablePathNode::InvalidIndex;
+    }
+
+    void AStar::PrepareSearch() const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        for(PathNode* node : m_Nodes)
+            node->GetWorldSpaceTransform();
     }
 
     bool AStar::FindPath(PathNode* start, PathNode* end)
     {
-        // Clear caches
         Reset();
+        return FindPath(start, end, m_Scratch, m_Path, m_PathCost);
+    }
+
+    bool AStar::FindPath(PathNode* start, PathNode* end, SearchScratch& scratch, std::vector<PathNode*>& outPath, float& outCost) const
+    {
+        LUMOS_PROFILE_FUNCTION();
+        outPath.clear();
+        outCost               = 0.0f;
+        scratch.NodesExpanded = 0;
+
+        const uint32_t startIndex = GetNodeIndex(start);
+        const uint32_t endIndex   = GetNodeIndex(end);
+        if(startIndex == QueueablePathNode::InvalidIndex || endIndex == QueueablePathNode::InvalidIndex)
+            return false;
+
+        if(scratch.Nodes.size() != m_Nodes.size())
+        {
+            scratch.Nodes.assign(m_Nodes.size(), QueueablePathNode());
+            scratch.Generation = 0;
+        }
 
-        // Add start node to open list
-        m_NodeData[start]->gScore = 0.0f;
-        m_NodeData[start]->fScore = m_NodeData[start]->node->HeuristicValue(*end);
-        m_OpenList.Push(m_NodeData[start]);
+        // Bumping the generation clears every node at once. On wrap around the stale stamps could match again
+        if(++scratch.Generation == 0)
+        {
+            for(QueueablePathNode& node : scratch.Nodes)
+                node.Generation = 0;
+            scratch.Generation = 1;
+        }
 
-        bool success = false;
-        while(!m_OpenList.empty())
+        const uint32_t generation       = scratch.Generation;
+        QueueablePathNode* nodes        = scratch.Nodes.data();
+        PathNodePriorityQueue& openList = scratch.OpenList;
+        openList.Reset(nodes);
+
+        auto visit = [&](uint32_t index) -> QueueablePathNode&
         {
-            QueueablePathNode* p = m_OpenList.Top();
+            QueueablePathNode& node = nodes[index];
+            if(node.Generation != generation)
+            {
+                node            = QueueablePathNode();
+                node.gScore     = FLT_MAX;
+                node.fScore     = FLT_MAX;
+                node.Generation = generation;
+            }
+            return node;
+        };
+
+        QueueablePathNode& startNode = visit(startIndex);
+        startNode.gScore             = 0.0f;
+        startNode.fScore             = start->HeuristicValue(*end);
+        openList.Push(startIndex);
 
-            // Move this node to the closed list
-            m_OpenList.Pop();
-            m_ClosedList.push_back(p);
+        while(!openList.Empty())
+        {
+            const uint32_t current  = openList.Pop();
+            QueueablePathNode& node = nodes[current];
+            scratch.NodesExpanded++;
 
-            // Check if this is the end node
-            if(p->node == end)
+            if(current == endIndex)
             {
-                success = true;
-                break;
+                for(uint32_t index = endIndex; index != QueueablePathNode::InvalidIndex; index = nodes[index].Parent)
+                    outPath.push_back(m_Nodes[index]);
+
+                // Reverse path to be ordered start to end
+                std::reverse(outPath.begin(), outPath.end());
+                outCost = node.gScore;
+                return true;
             }
 
-            // For each node connected to the next node
-            for(size_t i = 0; i < p->node->NumConnections(); i++)
+            for(uint32_t i = m_FirstEdge[current]; i < m_FirstEdge[current + 1]; i++)
             {
-                PathEdge* pq = p->node->Edge(i);
+                const GraphEdge& edge = m_Edges[i];
 
                 // Skip an edge that cannot be traversed
-                if(!pq->Traversable())
+                if(!edge.Edge->Traversable())
                     continue;
 
-                QueueablePathNode* q = m_NodeData[pq->OtherNode(p->node)];
-
-                // Calculate new scores
-                float gScore = p->gScore + pq->Cost();
-                float fScore = gScore + q->node->HeuristicValue(*end);
-
-                // Search for this node on open and closed lists
-                auto closedIt = std::find(m_ClosedList.begin(), m_ClosedList.end(), q);
-                auto openIt   = m_OpenList.Find(q);
-
-                if(closedIt != m_ClosedList.end() || openIt != m_OpenList.end())
-                {
-                    // Check if this path is more efficient that the previous best
-                    if(q->gScore > gScore)
-                    {
-                        q->Parent = p;
-                        q->gScore = gScore;
-                        q->fScore = fScore;
-                        m_OpenList.Update();
-                    }
-                }
-                else
-                {
-                    // Add this path to the open list if it has yet to be considered
-                    q->Parent = p;
-                    q->gScore = gScore;
-                    q->fScore = fScore;
-                    m_OpenList.Push(q);
-                }
-            }
-        }
+                QueueablePathNode& next = visit(edge.Target);
+                const float gScore      = node.gScore + edge.Edge->Cost();
+                if(gScore >= next.gScore)
+                    continue;
 
-        // If successful then reconstruct the best path
-        if(success)
-        {
-            // Add nodes to path
-            QueueablePathNode* n = m_ClosedList.back();
-            while(n)
-            {
-                m_Path.push_back(n->node);
-                n = n->Parent;
-            }
+                next.Parent = current;
+                next.gScore = gScore;
+                next.fScore = gScore + m_Nodes[edge.Target]->HeuristicValue(*end);
 
-            // Reverse path to be ordered start to end
-            std::reverse(m_Path.begin(), m_Path.end());
+                // A node that was already expanded is queued again if it improves, which only happens when
+                // edge weights below one make the heuristic inconsistent
+                if(next.HeapIndex != QueueablePathNode::InvalidIndex)
+                    openList.Update(edge.Target);
+                else
+                    openList.Push(edge.Target);
+            }
         }
 
-        return success;
+        return false;
     }
 
-}
\ No newline at end of file
+}
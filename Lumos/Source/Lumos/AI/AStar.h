@@ -6,24 +6,39 @@
 
 namespace Lumos
 {
-    class AStar
+    class PathEdge;
+
+    // A* over a graph of PathNodes. The connections are flattened into contiguous arrays when the graph is built,
+    // edge traversability, weights and node positions are still read live during each search
+    class LUMOS_EXPORT AStar
     {
     public:
+        // State for one search at a time. Reusing it between searches avoids any per search allocation
+        struct SearchScratch
+        {
+            std::vector<QueueablePathNode> Nodes;
+            PathNodePriorityQueue OpenList;
+            uint32_t Generation    = 0;
+            uint32_t NodesExpanded = 0;
+        };
+
         explicit AStar(const std::vector<PathNode*>& nodes);
         virtual ~AStar();
 
         void Reset();
         bool FindPath(PathNode* start, PathNode* end);
 
-        PathNodePriorityQueue OpenList() const
-        {
-            return m_OpenList;
-        }
+        // Reentrant, searches on different threads each need their own scratch and PrepareSearch called beforehand
+        bool FindPath(PathNode* start, PathNode* end, SearchScratch& scratch, std::vector<PathNode*>& outPath, float& outCost) const;
 
-        const std::vector<QueueablePathNode*>& ClosedList() const
-        {
-            return m_ClosedList;
-        }
+        // Updates the nodes' cached transforms so searches only read them
+        void PrepareSearch() const;
+
+        uint32_t GetNodeIndex(PathNode* node) const;
+        uint32_t GetNodeCount() const { return uint32_t(m_Nodes.size()); }
+
+        // Nodes popped from the open list by the last FindPath(start, end)
+        uint32_t GetNodesExpanded() const { return m_Scratch.NodesExpanded; }
 
         const std::vector<PathNode*>& Path() const
         {
@@ -32,13 +47,23 @@ namespace Lumos
 
         float PathCost() const
         {
-            return m_ClosedList.back()->gScore;
+            return m_PathCost;
         }
 
     private:
-        std::map<PathNode*, QueueablePathNode*> m_NodeData;
-        PathNodePriorityQueue m_OpenList;
-        std::vector<QueueablePathNode*> m_ClosedList;
+        struct GraphEdge
+        {
+            uint32_t Target;
+            PathEdge* Edge;
+        };
+
+        std::vector<PathNode*> m_Nodes;
+        std::vector<uint32_t> m_FirstEdge; // Node i's edges are [m_FirstEdge[i], m_FirstEdge[i + 1])
+        std::vector<GraphEdge> m_Edges;
+        std::unordered_map<PathNode*, uint32_t> m_NodeIndices;
+
+        SearchScratch m_Scratch;
         std::vector<PathNode*> m_Path;
+        float m_PathCost = 0.0f;
     };
 }
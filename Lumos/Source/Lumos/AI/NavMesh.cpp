@@ -0,0 +1,1145 @@
+#include "Precompiled.h"
+#include "NavMesh.h"
+#include "Scene/Scene.h"
+#include "Scene/Entity.h"
+#include "Scene/Component/ModelComponent.h"
+#include "Scene/Component/RigidBody3DComponent.h"
+#include "Physics/LumosPhysicsEngine/RigidBody3D.h"
+#include "Graphics/Model.h"
+#include "Graphics/Mesh.h"
+#include "Graphics/Renderers/DebugRenderer.h"
+#include "Maths/Transform.h"
+#include "Core/JobSystem.h"
+
+#include <entt/entity/registry.hpp>
+
+namespace Lumos
+{
+    // Polygon references keep the polygon below these bits, enough for a full 255 cell tile
+    static const uint32_t PolyBits    = 16;
+    static const uint64_t PolyMask    = (1u << PolyBits) - 1;
+    static const uint32_t MaxTileSize = 255;
+
+    // A triangle clipped to a cell gains at most one vertex per side
+    static const int MaxClipVertices = 8;
+
+    // Spans whose tops are this many voxels apart count as the same surface when merged
+    static const int32_t SurfaceMergeVoxels = 1;
+
+    static const int32_t NoSurface = -1;
+    static const uint32_t NoPoly   = ~0u;
+
+    // -X, +X, -Z, +Z
+    static const int32_t DirX[4] = { -1, 1, 0, 0 };
+    static const int32_t DirZ[4] = { 0, 0, -1, 1 };
+
+    // Solid voxel span in a column of the tile's heightfield
+    struct HeightSpan
+    {
+        uint32_t Column;
+        int32_t Min;
+        int32_t Max;
+        bool Walkable;
+    };
+
+    // Top of a solid span with room above it for an agent
+    struct Surface
+    {
+        int32_t Floor;
+        int32_t Ceiling;
+        int32_t Neighbours[4];
+        uint32_t Distance;
+        uint32_t Poly;
+        bool Walkable;
+    };
+
+    // Sutherland-Hodgman clip against the plane where the axis equals value, keeping the side it points to
+    static int ClipPolygon(const glm::vec3* in, int count, glm::vec3* out, int axis, float value, float side)
+    {
+        int outCount = 0;
+        for(int i = 0, j = count - 1; i < count; j = i, i++)
+        {
+            const float di = (in[i][axis] - value) * side;
+            const float dj = (in[j][axis] - value) * side;
+            if((di >= 0.0f) != (dj >= 0.0f))
+                out[outCount++] = glm::mix(in[j], in[i], dj / (dj - di));
+            if(di >= 0.0f)
+                out[outCount++] = in[i];
+        }
+        return outCount;
+    }
+
+    static float PolygonAreaXZ(const glm::vec3* points, int count)
+    {
+        float area = 0.0f;
+        for(int i = 0, j = count - 1; i < count; j = i, i++)
+            area += points[j].x * points[i].z - points[i].x * points[j].z;
+        return glm::abs(area) * 0.5f;
+    }
+
+    // Twice the signed area of the triangle on the XZ plane
+    static float TriArea2(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c)
+    {
+        const float abx = b.x - a.x;
+        const float abz = b.z - a.z;
+        const float acx = c.x - a.x;
+        const float acz = c.z - a.z;
+        return acx * abz - abx * acz;
+    }
+
+    static bool SamePointXZ(const glm::vec3& a, const glm::vec3& b)
+    {
+        return glm::abs(a.x - b.x) < Maths::M_EPSILON && glm::abs(a.z - b.z) < Maths::M_EPSILON;
+    }
+
+    // Point on the portal ab that minimises the XZ distance from -> point -> to. That is where the straight line
+    // crosses it, with to mirrored onto the other side when both lie on the same side, clamped to the portal
+    static glm::vec3 PortalCrossing(const glm::vec3& a, const glm::vec3& b, const glm::vec3& from, const glm::vec3& to)
+    {
+        const glm::vec2 edge   = glm::vec2(b.x - a.x, b.z - a.z);
+        const float edgeLength = glm::dot(edge, edge);
+        if(edgeLength < Maths::M_EPSILON)
+            return a;
+
+        const glm::vec2 start = glm::vec2(from.x - a.x, from.z - a.z);
+        const glm::vec2 end   = glm::vec2(to.x - a.x, to.z - a.z);
+        const float sideStart = edge.x * start.y - edge.y * start.x;
+        float sideEnd         = edge.x * end.y - edge.y * end.x;
+        if(sideStart * sideEnd > 0.0f)
+            sideEnd = -sideEnd;
+
+        float t;
+        if(glm::abs(sideStart - sideEnd) < Maths::M_EPSILON)
+            t = glm::dot(start, edge) / edgeLength;
+        else
+        {
+            // The mirrored end keeps its position along the edge, only its side changes
+            const float alongStart = glm::dot(start, edge) / edgeLength;
+            const float alongEnd   = glm::dot(end, edge) / edgeLength;
+            t                      = glm::mix(alongStart, alongEnd, sideStart / (sideStart - sideEnd));
+        }
+
+        return glm::mix(a, b, glm::clamp(t, 0.0f, 1.0f));
+    }
+
+    NavMesh::NavMesh(const NavMeshSettings& settings)
+        : m_Settings(settings)
+    {
+        m_Settings.TileSize = glm::clamp(m_Settings.TileSize, 1u, MaxTileSize);
+    }
+
+    NavMesh::~NavMesh()
+    {
+    }
+
+    void NavMesh::ClearGeometry()
+    {
+        m_Vertices.clear();
+        m_Indices.clear();
+    }
+
+    void NavMesh::AddTriangles(const glm::vec3* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount, const glm::mat4& transform)
+    {
+        const uint32_t base = uint32_t(m_Vertices.size());
+        m_Vertices.reserve(m_Vertices.size() + vertexCount);
+        for(uint32_t i = 0; i < vertexCount; i++)
+            m_Vertices.push_back(glm::vec3(transform * glm::vec4(vertices[i], 1.0f)));
+
+        m_Indices.reserve(m_Indices.size() + indexCount);
+        for(uint32_t i = 0; i + 2 < indexCount; i += 3)
+        {
+            m_Indices.push_back(base + indices[i]);
+            m_Indices.push_back(base + indices[i + 1]);
+            m_Indices.push_back(base + indices[i + 2]);
+        }
+    }
+
+    void NavMesh::AddMesh(const Graphics::Mesh* mesh, const glm::mat4& transform)
+    {
+        const auto& vertices = mesh->GetVertices();
+        const auto& indices  = mesh->GetIndices();
+
+        const uint32_t base = uint32_t(m_Vertices.size());
+        m_Vertices.reserve(m_Vertices.size() + vertices.size());
+        for(const auto& vertex : vertices)
+            m_Vertices.push_back(glm::vec3(transform * glm::vec4(vertex.Position, 1.0f)));
+
+        m_Indices.reserve(m_Indices.size() + indices.size());
+        for(size_t i = 0; i + 2 < indices.size(); i += 3)
+        {
+            m_Indices.push_back(base + indices[i]);
+            m_Indices.push_back(base + indices[i + 1]);
+            m_Indices.push_back(base + indices[i + 2]);
+        }
+    }
+
+    void NavMesh::AddScene(Scene* scene)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        auto& registry = scene->GetRegistry();
+
+        auto modelGroup = registry.group<Graphics::ModelComponent>(entt::get<Maths::Transform>);
+        for(auto entity : modelGroup)
+        {
+            const auto& [model, trans] = modelGroup.get<Graphics::ModelComponent, Maths::Transform>(entity);
+            if(!model.ModelRef || !Entity(entity, scene).Active())
+                continue;
+
+            auto body = registry.try_get<RigidBody3DComponent>(entity);
+            if(body && body->GetRigidBody() && !body->GetRigidBody()->GetIsStatic())
+                continue;
+
+            for(auto& mesh : model.ModelRef->GetMeshes())
+            {
+                if(mesh->GetActive())
+                    AddMesh(mesh.get(), trans.GetWorldMatrix());
+            }
+        }
+    }
+
+    int32_t NavMesh::GetErodeCells() const
+    {
+        return m_Settings.AgentRadius > 0.0f ? int32_t(glm::ceil(m_Settings.AgentRadius / m_Settings.CellSize)) : 0;
+    }
+
+    int32_t NavMesh::GetBorderCells() const
+    {
+        // Cells at the edge of a tile's heightfield look like ledges, so the border keeps them out of reach of the erosion
+        return GetErodeCells() + 1;
+    }
+
+    void NavMesh::Build()
+    {
+        LUMOS_PROFILE_FUNCTION();
+        m_Tiles.clear();
+        m_TilesX = 0;
+        m_TilesZ = 0;
+
+        if(m_Indices.size() < 3)
+        {
+            RebuildSearchIndex();
+            return;
+        }
+
+        glm::vec3 min = glm::vec3(FLT_MAX);
+        glm::vec3 max = glm::vec3(-FLT_MAX);
+        for(const glm::vec3& vertex : m_Vertices)
+        {
+            min = glm::min(min, vertex);
+            max = glm::max(max, vertex);
+        }
+
+        const float tileWorldSize = float(m_Settings.TileSize) * m_Settings.CellSize;
+        m_Origin                  = min;
+        m_TilesX                  = glm::max(1, int32_t(glm::ceil((max.x - min.x) / tileWorldSize)));
+        m_TilesZ                  = glm::max(1, int32_t(glm::ceil((max.z - min.z) / tileWorldSize)));
+        m_Tiles.resize(m_TilesX * m_TilesZ);
+
+        // Bucket the triangles by every tile whose heightfield, including its border, they overlap
+        const float border = float(GetBorderCells()) * m_Settings.CellSize;
+        for(uint32_t triangle = 0; triangle + 2 < uint32_t(m_Indices.size()); triangle += 3)
+        {
+            const glm::vec3& a = m_Vertices[m_Indices[triangle]];
+            const glm::vec3& b = m_Vertices[m_Indices[triangle + 1]];
+            const glm::vec3& c = m_Vertices[m_Indices[triangle + 2]];
+
+            const glm::vec3 triMin = glm::min(a, glm::min(b, c)) - m_Origin;
+            const glm::vec3 triMax = glm::max(a, glm::max(b, c)) - m_Origin;
+
+            const int32_t minX = glm::max(0, int32_t(glm::floor((triMin.x - border) / tileWorldSize)));
+            const int32_t minZ = glm::max(0, int32_t(glm::floor((triMin.z - border) / tileWorldSize)));
+            const int32_t maxX = glm::min(m_TilesX - 1, int32_t(glm::floor((triMax.x + border) / tileWorldSize)));
+            const int32_t maxZ = glm::min(m_TilesZ - 1, int32_t(glm::floor((triMax.z + border) / tileWorldSize)));
+
+            for(int32_t z = minZ; z <= maxZ; z++)
+                for(int32_t x = minX; x <= maxX; x++)
+                    m_Tiles[z * m_TilesX + x].Triangles.push_back(triangle);
+        }
+
+        Update();
+    }
+
+    uint32_t NavMesh::AddObstacle(const Maths::BoundingBox& bounds)
+    {
+        const uint32_t obstacle = m_NextObstacle++;
+        m_Obstacles[obstacle]   = bounds;
+        MarkDirty(bounds);
+        return obstacle;
+    }
+
+    void NavMesh::MoveObstacle(uint32_t obstacle, const Maths::BoundingBox& bounds)
+    {
+        auto it = m_Obstacles.find(obstacle);
+        if(it == m_Obstacles.end())
+            return;
+
+        MarkDirty(it->second);
+        MarkDirty(bounds);
+        it->second = bounds;
+    }
+
+    void NavMesh::RemoveObstacle(uint32_t obstacle)
+    {
+        auto it = m_Obstacles.find(obstacle);
+        if(it == m_Obstacles.end())
+            return;
+
+        MarkDirty(it->second);
+        m_Obstacles.erase(it);
+    }
+
+    void NavMesh::MarkDirty(const Maths::BoundingBox& bounds)
+    {
+        if(m_Tiles.empty())
+            return;
+
+        // Erosion spreads an obstacle's effect by the agent radius, so the tiles that far out change too
+        const float tileWorldSize = float(m_Settings.TileSize) * m_Settings.CellSize;
+        const float border        = float(GetBorderCells()) * m_Settings.CellSize;
+
+        const int32_t minX = glm::max(0, int32_t(glm::floor((bounds.m_Min.x - m_Origin.x - border) / tileWorldSize)));
+        const int32_t minZ = glm::max(0, int32_t(glm::floor((bounds.m_Min.z - m_Origin.z - border) / tileWorldSize)));
+        const int32_t maxX = glm::min(m_TilesX - 1, int32_t(glm::floor((bounds.m_Max.x - m_Origin.x + border) / tileWorldSize)));
+        const int32_t maxZ = glm::min(m_TilesZ - 1, int32_t(glm::floor((bounds.m_Max.z - m_Origin.z + border) / tileWorldSize)));
+
+        for(int32_t z = minZ; z <= maxZ; z++)
+            for(int32_t x = minX; x <= maxX; x++)
+                m_Tiles[z * m_TilesX + x].Dirty = true;
+    }
+
+    uint32_t NavMesh::Update()
+    {
+        LUMOS_PROFILE_FUNCTION();
+        std::vector<uint32_t> dirty;
+        for(uint32_t i = 0; i < uint32_t(m_Tiles.size()); i++)
+        {
+            if(m_Tiles[i].Dirty)
+                dirty.push_back(i);
+        }
+
+        if(dirty.empty())
+            return 0;
+
+        // Tiles only write to themselves, so they build in parallel
+        System::JobSystem::Context buildContext;
+        System::JobSystem::Dispatch(buildContext, uint32_t(dirty.size()), 1, [&](JobDispatchArgs args)
+                                    { BuildTile(dirty[args.jobIndex]); });
+        System::JobSystem::Wait(buildContext);
+
+        // Portals into a rebuilt tile are stale in its neighbours as well
+        std::vector<bool> relink(m_Tiles.size(), false);
+        for(uint32_t tileIndex : dirty)
+        {
+            const int32_t x = int32_t(tileIndex) % m_TilesX;
+            const int32_t z = int32_t(tileIndex) / m_TilesX;
+
+            relink[tileIndex] = true;
+            for(int32_t dir = 0; dir < 4; dir++)
+            {
+                const int32_t nx = x + DirX[dir];
+                const int32_t nz = z + DirZ[dir];
+                if(nx >= 0 && nz >= 0 && nx < m_TilesX && nz < m_TilesZ)
+                    relink[nz * m_TilesX + nx] = true;
+            }
+        }
+
+        std::vector<uint32_t> linkTiles;
+        for(uint32_t i = 0; i < uint32_t(relink.size()); i++)
+        {
+            if(relink[i])
+                linkTiles.push_back(i);
+        }
+
+        System::JobSystem::Context linkContext;
+        System::JobSystem::Dispatch(linkContext, uint32_t(linkTiles.size()), 1, [&](JobDispatchArgs args)
+                                    { LinkTile(linkTiles[args.jobIndex]); });
+        System::JobSystem::Wait(linkContext);
+
+        for(uint32_t tileIndex : dirty)
+            m_Tiles[tileIndex].Dirty = false;
+
+        RebuildSearchIndex();
+        return uint32_t(dirty.size());
+    }
+
+    void NavMesh::BuildTile(uint32_t tileIndex)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        Tile& tile = m_Tiles[tileIndex];
+        tile.Polys.clear();
+        tile.Portals.clear();
+        tile.Spans.clear();
+        tile.FirstSpan.assign(m_Settings.TileSize * m_Settings.TileSize + 1, 0);
+
+        const float cellSize   = m_Settings.CellSize;
+        const float cellHeight = m_Settings.CellHeight;
+        const int32_t tileSize = int32_t(m_Settings.TileSize);
+        const int32_t border   = GetBorderCells();
+        const int32_t erode    = GetErodeCells();
+        const int32_t width    = tileSize + border * 2;
+        const int32_t climb    = int32_t(glm::floor(m_Settings.MaxClimb / cellHeight));
+        const int32_t height   = int32_t(glm::ceil(m_Settings.AgentHeight / cellHeight));
+        const float minNormalY = glm::cos(glm::radians(m_Settings.MaxSlope));
+
+        // Cell coordinates of the heightfield's first column, which starts outside the tile by the border
+        const int32_t baseX = (int32_t(tileIndex) % m_TilesX) * tileSize - border;
+        const int32_t baseZ = (int32_t(tileIndex) / m_TilesX) * tileSize - border;
+
+        // Rasterise every triangle into the columns it covers
+        std::vector<HeightSpan> spans;
+        for(uint32_t triangle : tile.Triangles)
+        {
+            glm::vec3 in[MaxClipVertices] = { m_Vertices[m_Indices[triangle]], m_Vertices[m_Indices[triangle + 1]], m_Vertices[m_Indices[triangle + 2]] };
+            glm::vec3 row[MaxClipVertices];
+            glm::vec3 cell[MaxClipVertices];
+            glm::vec3 clipped[MaxClipVertices];
+
+            const glm::vec3 normal = glm::cross(in[1] - in[0], in[2] - in[0]);
+            const float length     = glm::length(normal);
+            if(length <= 0.0f)
+                continue;
+
+            // Either winding is accepted, a surface facing down is cut off by the clearance check instead
+            const bool walkable = glm::abs(normal.y) / length >= minNormalY;
+
+            const glm::vec3 triMin = glm::min(in[0], glm::min(in[1], in[2])) - m_Origin;
+            const glm::vec3 triMax = glm::max(in[0], glm::max(in[1], in[2])) - m_Origin;
+
+            const int32_t minX = glm::max(0, int32_t(glm::floor(triMin.x / cellSize)) - baseX);
+            const int32_t minZ = glm::max(0, int32_t(glm::floor(triMin.z / cellSize)) - baseZ);
+            const int32_t maxX = glm::min(width - 1, int32_t(glm::floor(triMax.x / cellSize)) - baseX);
+            const int32_t maxZ = glm::min(width - 1, int32_t(glm::floor(triMax.z / cellSize)) - baseZ);
+
+            for(int32_t z = minZ; z <= maxZ; z++)
+            {
+                const float cellMinZ = m_Origin.z + float(baseZ + z) * cellSize;
+
+                int rowCount = ClipPolygon(in, 3, clipped, 2, cellMinZ, 1.0f);
+                rowCount     = ClipPolygon(clipped, rowCount, row, 2, cellMinZ + cellSize, -1.0f);
+                if(rowCount == 0)
+                    continue;
+
+                for(int32_t x = minX; x <= maxX; x++)
+                {
+                    const float cellMinX = m_Origin.x + float(baseX + x) * cellSize;
+
+                    int cellCount = ClipPolygon(row, rowCount, clipped, 0, cellMinX, 1.0f);
+                    cellCount     = ClipPolygon(clipped, cellCount, cell, 0, cellMinX + cellSize, -1.0f);
+                    if(cellCount == 0)
+                        continue;
+
+                    // Floors only touching the cell's edge would leak a cell past the end of the geometry.
+                    // Walls are kept as they project to a line, which has no area
+                    if(walkable && PolygonAreaXZ(cell, cellCount) <= Maths::M_EPSILON * cellSize * cellSize)
+                        continue;
+
+                    float minY = cell[0].y;
+                    float maxY = cell[0].y;
+                    for(int i = 1; i < cellCount; i++)
+                    {
+                        minY = glm::min(minY, cell[i].y);
+                        maxY = glm::max(maxY, cell[i].y);
+                    }
+
+                    const int32_t spanMin = int32_t(glm::floor((minY - m_Origin.y) / cellHeight));
+                    const int32_t spanMax = glm::max(int32_t(glm::ceil((maxY - m_Origin.y) / cellHeight)), spanMin + 1);
+                    spans.push_back({ uint32_t(z * width + x), spanMin, spanMax, walkable });
+                }
+            }
+        }
+
+        // Merge overlapping spans into solid spans, the walkable flag comes from the highest top
+        std::sort(spans.begin(), spans.end(), [](const HeightSpan& a, const HeightSpan& b)
+                  { return a.Column != b.Column ? a.Column < b.Column : a.Min < b.Min; });
+
+        std::vector<HeightSpan> solid;
+        for(const HeightSpan& span : spans)
+        {
+            if(solid.empty() || solid.back().Column != span.Column || span.Min > solid.back().Max)
+            {
+                solid.push_back(span);
+                continue;
+            }
+
+            HeightSpan& last = solid.back();
+            if(glm::abs(span.Max - last.Max) <= SurfaceMergeVoxels)
+                last.Walkable = last.Walkable || span.Walkable;
+            else if(span.Max > last.Max)
+                last.Walkable = span.Walkable;
+            last.Max = glm::max(last.Max, span.Max);
+        }
+
+        std::vector<Maths::BoundingBox> obstacles;
+        {
+            const float tileMinX = m_Origin.x + float(baseX) * cellSize;
+            const float tileMinZ = m_Origin.z + float(baseZ) * cellSize;
+            const float tileMaxX = tileMinX + float(width) * cellSize;
+            const float tileMaxZ = tileMinZ + float(width) * cellSize;
+            for(auto& [id, bounds] : m_Obstacles)
+            {
+                if(bounds.m_Min.x < tileMaxX && bounds.m_Max.x > tileMinX && bounds.m_Min.z < tileMaxZ && bounds.m_Max.z > tileMinZ)
+                    obstacles.push_back(bounds);
+            }
+        }
+
+        // Surfaces are the tops of walkable spans with enough clearance that aren't inside an obstacle
+        std::vector<uint32_t> firstSurface(width * width + 1, 0);
+        std::vector<Surface> surfaces;
+        for(size_t i = 0; i < solid.size(); i++)
+        {
+            const HeightSpan& span = solid[i];
+            const int32_t ceiling  = (i + 1 < solid.size() && solid[i + 1].Column == span.Column) ? solid[i + 1].Min : INT32_MAX;
+            if(!span.Walkable || ceiling - span.Max < height)
+                continue;
+
+            const float floorY   = m_Origin.y + float(span.Max) * cellHeight;
+            const float cellMinX = m_Origin.x + float(baseX + int32_t(span.Column) % width) * cellSize;
+            const float cellMinZ = m_Origin.z + float(baseZ + int32_t(span.Column) / width) * cellSize;
+
+            bool blocked = false;
+            for(const Maths::BoundingBox& bounds : obstacles)
+            {
+                if(bounds.m_Min.x < cellMinX + cellSize && bounds.m_Max.x > cellMinX && bounds.m_Min.z < cellMinZ + cellSize && bounds.m_Max.z > cellMinZ
+                   && bounds.m_Max.y >= floorY && bounds.m_Min.y <= floorY + m_Settings.AgentHeight)
+                {
+                    blocked = true;
+                    break;
+                }
+            }
+
+            if(blocked)
+                continue;
+
+            Surface surface;
+            surface.Floor    = span.Max;
+            surface.Ceiling  = ceiling;
+            surface.Distance = UINT32_MAX;
+            surface.Poly     = NoPoly;
+            surface.Walkable = true;
+            surfaces.push_back(surface);
+            firstSurface[span.Column + 1]++;
+        }
+
+        for(int32_t column = 0; column < width * width; column++)
+            firstSurface[column + 1] += firstSurface[column];
+
+        // Connect each surface to the closest one it can step to in the neighbouring columns
+        for(int32_t z = 0; z < width; z++)
+        {
+            for(int32_t x = 0; x < width; x++)
+            {
+                const int32_t column = z * width + x;
+                for(uint32_t s = firstSurface[column]; s < firstSurface[column + 1]; s++)
+                {
+                    Surface& surface = surfaces[s];
+                    for(int32_t dir = 0; dir < 4; dir++)
+                    {
+                        surface.Neighbours[dir] = NoSurface;
+
+                        const int32_t nx = x + DirX[dir];
+                        const int32_t nz = z + DirZ[dir];
+                        if(nx < 0 || nz < 0 || nx >= width || nz >= width)
+                            continue;
+
+                        int32_t bestStep        = climb + 1;
+                        const int32_t neighbour = nz * width + nx;
+                        for(uint32_t n = firstSurface[neighbour]; n < firstSurface[neighbour + 1]; n++)
+                        {
+                            const int32_t step = glm::abs(surfaces[n].Floor - surface.Floor);
+                            const int32_t gap  = glm::min(surfaces[n].Ceiling, surface.Ceiling) - glm::max(surfaces[n].Floor, surface.Floor);
+                            if(step < bestStep && gap >= height)
+                            {
+                                bestStep                = step;
+                                surface.Neighbours[dir] = int32_t(n);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        // Erode the agent radius from walls and ledges with a breadth first distance from the edges
+        if(erode > 0)
+        {
+            std::vector<uint32_t> queue;
+            for(uint32_t s = 0; s < uint32_t(surfaces.size()); s++)
+            {
+                const Surface& surface = surfaces[s];
+                for(int32_t dir = 0; dir < 4; dir++)
+                {
+                    if(surface.Neighbours[dir] == NoSurface)
+                    {
+                        surfaces[s].Distance = 1;
+                        queue.push_back(s);
+                        break;
+                    }
+                }
+            }
+
+            for(size_t head = 0; head < queue.size(); head++)
+            {
+                const Surface& surface = surfaces[queue[head]];
+                for(int32_t dir = 0; dir < 4; dir++)
+                {
+                    const int32_t n = surface.Neighbours[dir];
+                    if(n != NoSurface && surfaces[n].Distance > surface.Distance + 1)
+                    {
+                        surfaces[n].Distance = surface.Distance + 1;
+                        queue.push_back(uint32_t(n));
+                    }
+                }
+            }
+
+            for(Surface& surface : surfaces)
+                surface.Walkable = surface.Distance > uint32_t(erode);
+        }
+
+        auto available = [&](int32_t s)
+        {
+            return s != NoSurface && surfaces[s].Walkable && surfaces[s].Poly == NoPoly;
+        };
+
+        // Greedily cover the tile's own cells with rectangles, first along x then adding whole rows along z
+        const int32_t innerEnd = border + tileSize;
+        std::vector<int32_t> cells;
+        std::vector<int32_t> nextRow;
+        for(int32_t z = border; z < innerEnd; z++)
+        {
+            for(int32_t x = border; x < innerEnd; x++)
+            {
+                const int32_t column = z * width + x;
+                for(uint32_t s = firstSurface[column]; s < firstSurface[column + 1]; s++)
+                {
+                    if(!available(int32_t(s)))
+                        continue;
+
+                    cells.clear();
+                    cells.push_back(int32_t(s));
+                    while(x + int32_t(cells.size()) < innerEnd && available(surfaces[cells.back()].Neighbours[1]))
+                        cells.push_back(surfaces[cells.back()].Neighbours[1]);
+
+                    const int32_t rectWidth = int32_t(cells.size());
+                    int32_t rectDepth       = 1;
+                    while(z + rectDepth < innerEnd)
+                    {
+                        nextRow.clear();
+                        const int32_t* previousRow = &cells[(rectDepth - 1) * rectWidth];
+                        for(int32_t i = 0; i < rectWidth; i++)
+                        {
+                            const int32_t n = surfaces[previousRow[i]].Neighbours[3];
+                            if(!available(n) || (i > 0 && surfaces[nextRow.back()].Neighbours[1] != n))
+                                break;
+                            nextRow.push_back(n);
+                        }
+
+                        if(int32_t(nextRow.size()) != rectWidth)
+                            break;
+
+                        cells.insert(cells.end(), nextRow.begin(), nextRow.end());
+                        rectDepth++;
+                    }
+
+                    const uint32_t polyIndex = uint32_t(tile.Polys.size());
+                    for(int32_t cell : cells)
+                        surfaces[cell].Poly = polyIndex;
+
+                    const int32_t corners[4] = { cells[0], cells[rectWidth - 1], cells.back(), cells[(rectDepth - 1) * rectWidth] };
+
+                    Poly poly;
+                    poly.MinX = baseX + x;
+                    poly.MinZ = baseZ + z;
+                    poly.MaxX = poly.MinX + rectWidth;
+                    poly.MaxZ = poly.MinZ + rectDepth;
+                    for(int i = 0; i < 4; i++)
+                        poly.Heights[i] = m_Origin.y + float(surfaces[corners[i]].Floor) * cellHeight;
+                    tile.Polys.push_back(poly);
+                }
+            }
+        }
+
+        // Keep the covered surfaces of the tile's own cells for linking and point queries
+        for(int32_t z = 0; z < tileSize; z++)
+        {
+            for(int32_t x = 0; x < tileSize; x++)
+            {
+                const int32_t column = (z + border) * width + x + border;
+                const int32_t cell   = z * tileSize + x;
+                for(uint32_t s = firstSurface[column]; s < firstSurface[column + 1]; s++)
+                {
+                    if(surfaces[s].Poly != NoPoly)
+                        tile.Spans.push_back({ m_Origin.y + float(surfaces[s].Floor) * cellHeight, surfaces[s].Poly });
+                }
+                tile.FirstSpan[cell + 1] = uint32_t(tile.Spans.size());
+            }
+        }
+    }
+
+    void NavMesh::LinkTile(uint32_t tileIndex)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        Tile& tile = m_Tiles[tileIndex];
+        tile.Portals.clear();
+
+        struct Contact
+        {
+            PolyRef Target;
+            int32_t First, Last; // Cells along the edge
+            float Heights[2];
+        };
+
+        const float cellSize = m_Settings.CellSize;
+        std::vector<Contact> contacts;
+
+        for(uint32_t polyIndex = 0; polyIndex < uint32_t(tile.Polys.size()); polyIndex++)
+        {
+            Poly& poly       = tile.Polys[polyIndex];
+            poly.FirstPortal = uint32_t(tile.Portals.size());
+
+            for(int32_t dir = 0; dir < 4; dir++)
+            {
+                // Walk the cells just inside this edge and find what each one steps onto across it
+                const bool alongZ   = dir < 2;
+                const int32_t first = alongZ ? poly.MinZ : poly.MinX;
+                const int32_t last  = alongZ ? poly.MaxZ : poly.MaxX;
+                const int32_t edge  = alongZ ? (dir == 0 ? poly.MinX : poly.MaxX - 1) : (dir == 2 ? poly.MinZ : poly.MaxZ - 1);
+
+                contacts.clear();
+                for(int32_t i = first; i < last; i++)
+                {
+                    const int32_t x = alongZ ? edge : i;
+                    const int32_t z = alongZ ? i : edge;
+
+                    const CellSpan* begin;
+                    const CellSpan* end;
+                    uint32_t spanTile;
+                    if(!GetCellSpans(x, z, begin, end, spanTile))
+                        continue;
+
+                    float ownHeight = 0.0f;
+                    for(const CellSpan* span = begin; span != end; span++)
+                    {
+                        if(span->Poly == polyIndex)
+                            ownHeight = span->Height;
+                    }
+
+                    if(!GetCellSpans(x + DirX[dir], z + DirZ[dir], begin, end, spanTile))
+                        continue;
+
+                    const CellSpan* best = nullptr;
+                    float bestStep       = m_Settings.MaxClimb;
+                    for(const CellSpan* span = begin; span != end; span++)
+                    {
+                        const float step = glm::abs(span->Height - ownHeight);
+                        if(step <= bestStep)
+                        {
+                            bestStep = step;
+                            best     = span;
+                        }
+                    }
+
+                    if(!best)
+                        continue;
+
+                    const PolyRef target = (PolyRef(spanTile) << PolyBits) | best->Poly;
+                    const float height   = (ownHeight + best->Height) * 0.5f;
+                    if(!contacts.empty() && contacts.back().Target == target && contacts.back().Last == i - 1)
+                    {
+                        contacts.back().Last       = i;
+                        contacts.back().Heights[1] = height;
+                    }
+                    else
+                        contacts.push_back({ target, i, i, { height, height } });
+                }
+
+                // Portals lie on the shared edge, which is the far side of the cells on the max edges
+                const float edgeWorld = float(alongZ ? (dir == 0 ? poly.MinX : poly.MaxX) : (dir == 2 ? poly.MinZ : poly.MaxZ)) * cellSize;
+                for(const Contact& contact : contacts)
+                {
+                    const float from = float(contact.First) * cellSize;
+                    const float to   = float(contact.Last + 1) * cellSize;
+
+                    Portal portal;
+                    portal.Target = contact.Target;
+                    if(alongZ)
+                    {
+                        portal.Points[0] = m_Origin + glm::vec3(edgeWorld, 0.0f, from);
+                        portal.Points[1] = m_Origin + glm::vec3(edgeWorld, 0.0f, to);
+                    }
+                    else
+                    {
+                        portal.Points[0] = m_Origin + glm::vec3(from, 0.0f, edgeWorld);
+                        portal.Points[1] = m_Origin + glm::vec3(to, 0.0f, edgeWorld);
+                    }
+                    portal.Points[0].y = contact.Heights[0];
+                    portal.Points[1].y = contact.Heights[1];
+                    tile.Portals.push_back(portal);
+                }
+            }
+
+            poly.PortalCount = uint32_t(tile.Portals.size()) - poly.FirstPortal;
+        }
+    }
+
+    void NavMesh::RebuildSearchIndex()
+    {
+        m_PolyRefs.clear();
+        for(uint32_t tileIndex = 0; tileIndex < uint32_t(m_Tiles.size()); tileIndex++)
+        {
+            Tile& tile    = m_Tiles[tileIndex];
+            tile.PolyBase = uint32_t(m_PolyRefs.size());
+            for(uint32_t poly = 0; poly < uint32_t(tile.Polys.size()); poly++)
+                m_PolyRefs.push_back((PolyRef(tileIndex) << PolyBits) | poly);
+        }
+
+        // Stale stamps could match the new indices, so start the search nodes over
+        m_SearchNodes.assign(m_PolyRefs.size(), QueueablePathNode());
+        m_SearchPoints.assign(m_PolyRefs.size(), glm::vec3(0.0f));
+        m_Generation = 0;
+    }
+
+    bool NavMesh::GetCellSpans(int32_t x, int32_t z, const CellSpan*& begin, const CellSpan*& end, uint32_t& tileIndex) const
+    {
+        const int32_t tileSize = int32_t(m_Settings.TileSize);
+        if(x < 0 || z < 0 || x >= m_TilesX * tileSize || z >= m_TilesZ * tileSize)
+            return false;
+
+        const int32_t tileX = x / tileSize;
+        const int32_t tileZ = z / tileSize;
+        tileIndex           = uint32_t(tileZ * m_TilesX + tileX);
+
+        const Tile& tile   = m_Tiles[tileIndex];
+        const int32_t cell = (z - tileZ * tileSize) * tileSize + (x - tileX * tileSize);
+        if(tile.FirstSpan.empty())
+            return false;
+
+        begin = tile.Spans.data() + tile.FirstSpan[cell];
+        end   = tile.Spans.data() + tile.FirstSpan[cell + 1];
+        return true;
+    }
+
+    const NavMesh::Poly& NavMesh::GetPoly(PolyRef ref) const
+    {
+        return m_Tiles[ref >> PolyBits].Polys[ref & PolyMask];
+    }
+
+    glm::vec3 NavMesh::GetPolyCentre(PolyRef ref) const
+    {
+        const Poly& poly = GetPoly(ref);
+        const float x    = float(poly.MinX + poly.MaxX) * 0.5f * m_Settings.CellSize;
+        const float z    = float(poly.MinZ + poly.MaxZ) * 0.5f * m_Settings.CellSize;
+        const float y    = (poly.Heights[0] + poly.Heights[1] + poly.Heights[2] + poly.Heights[3]) * 0.25f;
+        return glm::vec3(m_Origin.x + x, y, m_Origin.z + z);
+    }
+
+    glm::vec3 NavMesh::ClosestPointOnPoly(const Poly& poly, const glm::vec3& position) const
+    {
+        const float minX = m_Origin.x + float(poly.MinX) * m_Settings.CellSize;
+        const float minZ = m_Origin.z + float(poly.MinZ) * m_Settings.CellSize;
+        const float maxX = m_Origin.x + float(poly.MaxX) * m_Settings.CellSize;
+        const float maxZ = m_Origin.z + float(poly.MaxZ) * m_Settings.CellSize;
+
+        glm::vec3 point;
+        point.x = glm::clamp(position.x, minX, maxX);
+        point.z = glm::clamp(position.z, minZ, maxZ);
+
+        // Bilinear between the corner heights
+        const float u = (point.x - minX) / (maxX - minX);
+        const float v = (point.z - minZ) / (maxZ - minZ);
+        point.y       = glm::mix(glm::mix(poly.Heights[0], poly.Heights[1], u), glm::mix(poly.Heights[3], poly.Heights[2], u), v);
+        return point;
+    }
+
+    NavMesh::PolyRef NavMesh::FindNearestPoly(const glm::vec3& position, float maxDistance, glm::vec3& outPoint) const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        if(m_Tiles.empty())
+            return InvalidPoly;
+
+        const float tileWorldSize = float(m_Settings.TileSize) * m_Settings.CellSize;
+        const int32_t minX        = glm::max(0, int32_t(glm::floor((position.x - maxDistance - m_Origin.x) / tileWorldSize)));
+        const int32_t minZ        = glm::max(0, int32_t(glm::floor((position.z - maxDistance - m_Origin.z) / tileWorldSize)));
+        const int32_t maxX        = glm::min(m_TilesX - 1, int32_t(glm::floor((position.x + maxDistance - m_Origin.x) / tileWorldSize)));
+        const int32_t maxZ        = glm::min(m_TilesZ - 1, int32_t(glm::floor((position.z + maxDistance - m_Origin.z) / tileWorldSize)));
+
+        PolyRef nearest = InvalidPoly;
+        float bestDist2 = maxDistance * maxDistance;
+        for(int32_t z = minZ; z <= maxZ; z++)
+        {
+            for(int32_t x = minX; x <= maxX; x++)
+            {
+                const uint32_t tileIndex = uint32_t(z * m_TilesX + x);
+                const Tile& tile         = m_Tiles[tileIndex];
+                for(uint32_t i = 0; i < uint32_t(tile.Polys.size()); i++)
+                {
+                    const glm::vec3 point = ClosestPointOnPoly(tile.Polys[i], position);
+                    const glm::vec3 delta = point - position;
+                    const float dist2     = glm::dot(delta, delta);
+                    if(dist2 <= bestDist2)
+                    {
+                        bestDist2 = dist2;
+                        nearest   = (PolyRef(tileIndex) << PolyBits) | i;
+                        outPoint  = point;
+                    }
+                }
+            }
+        }
+
+        return nearest;
+    }
+
+    bool NavMesh::FindPath(const glm::vec3& start, const glm::vec3& end, std::vector<glm::vec3>& outPath)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        outPath.clear();
+        m_Corridor.clear();
+        m_NodesExpanded = 0;
+
+        // Points up to an agent's height away still snap onto the mesh
+        glm::vec3 startPoint, endPoint;
+        const PolyRef startPoly = FindNearestPoly(start, m_Settings.AgentHeight, startPoint);
+        const PolyRef endPoly   = FindNearestPoly(end, m_Settings.AgentHeight, endPoint);
+        if(startPoly == InvalidPoly || endPoly == InvalidPoly)
+            return false;
+
+        if(!FindCorridor(startPoly, startPoint, endPoly, endPoint))
+            return false;
+
+        StringPull(startPoint, endPoint, outPath);
+        return true;
+    }
+
+    bool NavMesh::FindCorridor(PolyRef start, const glm::vec3& startPoint, PolyRef end, const glm::vec3& endPoint)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+
+        // Bumping the generation clears every node at once. On wrap around the stale stamps could match again
+        if(++m_Generation == 0)
+        {
+            for(QueueablePathNode& node : m_SearchNodes)
+                node.Generation = 0;
+            m_Generation = 1;
+        }
+
+        QueueablePathNode* nodes = m_SearchNodes.data();
+        m_OpenList.Reset(nodes);
+
+        auto indexOf = [&](PolyRef ref)
+        {
+            return m_Tiles[ref >> PolyBits].PolyBase + (ref & PolyMask);
+        };
+
+        auto visit = [&](uint32_t index) -> QueueablePathNode&
+        {
+            QueueablePathNode& node = nodes[index];
+            if(node.Generation != m_Generation)
+            {
+                node            = QueueablePathNode();
+                node.gScore     = FLT_MAX;
+                node.fScore     = FLT_MAX;
+                node.Generation = m_Generation;
+            }
+            return node;
+        };
+
+        const uint32_t startIndex = indexOf(start);
+        const uint32_t endIndex   = indexOf(end);
+
+        // Costs run between the points where the route crosses each portal rather than polygon centres,
+        // which are far off the straight line in long thin polygons and lead the corridor astray
+        QueueablePathNode& startNode = visit(startIndex);
+        startNode.gScore             = 0.0f;
+        startNode.fScore             = glm::distance(startPoint, endPoint);
+        m_SearchPoints[startIndex]   = startPoint;
+        m_OpenList.Push(startIndex);
+
+        while(!m_OpenList.Empty())
+        {
+            const uint32_t current  = m_OpenList.Pop();
+            QueueablePathNode& node = nodes[current];
+            m_NodesExpanded++;
+
+            if(current == endIndex)
+            {
+                for(uint32_t index = endIndex; index != QueueablePathNode::InvalidIndex; index = nodes[index].Parent)
+                    m_Corridor.push_back(m_PolyRefs[index]);
+
+                // Reverse corridor to be ordered start to end
+                std::reverse(m_Corridor.begin(), m_Corridor.end());
+                return true;
+            }
+
+            const PolyRef ref     = m_PolyRefs[current];
+            const Tile& tile      = m_Tiles[ref >> PolyBits];
+            const Poly& poly      = tile.Polys[ref & PolyMask];
+            const glm::vec3 point = m_SearchPoints[current];
+
+            for(uint32_t i = poly.FirstPortal; i < poly.FirstPortal + poly.PortalCount; i++)
+            {
+                const Portal& portal     = tile.Portals[i];
+                const uint32_t nextIndex = indexOf(portal.Target);
+                const glm::vec3 next     = PortalCrossing(portal.Points[0], portal.Points[1], point, endPoint);
+
+                // The last leg to the end point is known exactly, so the end polygon is costed in full
+                QueueablePathNode& nextNode = visit(nextIndex);
+                const float toEnd           = glm::distance(next, endPoint);
+                float gScore                = node.gScore + glm::distance(point, next);
+                if(nextIndex == endIndex)
+                    gScore += toEnd;
+
+                if(gScore >= nextNode.gScore)
+                    continue;
+
+                nextNode.Parent           = current;
+                nextNode.gScore           = gScore;
+                nextNode.fScore           = nextIndex == endIndex ? gScore : gScore + toEnd;
+                m_SearchPoints[nextIndex] = next;
+
+                if(nextNode.HeapIndex != QueueablePathNode::InvalidIndex)
+                    m_OpenList.Update(nextIndex);
+                else
+                    m_OpenList.Push(nextIndex);
+            }
+        }
+
+        return false;
+    }
+
+    void NavMesh::StringPull(const glm::vec3& start, const glm::vec3& end, std::vector<glm::vec3>& outPath) const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+
+        // Portals along the corridor as left and right points seen walking through them,
+        // with the start and end as degenerate portals so the funnel closes on them
+        std::vector<std::pair<glm::vec3, glm::vec3>> portals;
+        portals.reserve(m_Corridor.size() + 1);
+        portals.push_back({ start, start });
+
+        for(size_t i = 0; i + 1 < m_Corridor.size(); i++)
+        {
+            const Tile& tile = m_Tiles[m_Corridor[i] >> PolyBits];
+            const Poly& poly = tile.Polys[m_Corridor[i] & PolyMask];
+            for(uint32_t p = poly.FirstPortal; p < poly.FirstPortal + poly.PortalCount; p++)
+            {
+                const Portal& portal = tile.Portals[p];
+                if(portal.Target != m_Corridor[i + 1])
+                    continue;
+
+                if(TriArea2(GetPolyCentre(m_Corridor[i]), portal.Points[0], portal.Points[1]) < 0.0f)
+                    portals.push_back({ portal.Points[1], portal.Points[0] });
+                else
+                    portals.push_back({ portal.Points[0], portal.Points[1] });
+                break;
+            }
+        }
+
+        portals.push_back({ end, end });
+
+        // Simple stupid funnel algorithm: narrow the funnel portal by portal and add a corner
+        // whenever one side crosses the other, restarting from that corner
+        glm::vec3 apex    = start;
+        glm::vec3 left    = portals[0].first;
+        glm::vec3 right   = portals[0].second;
+        size_t apexIndex  = 0;
+        size_t leftIndex  = 0;
+        size_t rightIndex = 0;
+
+        // Corners in line with the previous two only add a point to walk through
+        auto addCorner = [&](const glm::vec3& corner)
+        {
+            const size_t count = outPath.size();
+            if(count >= 2 && glm::abs(TriArea2(outPath[count - 2], outPath[count - 1], corner)) < Maths::M_EPSILON)
+                outPath.back() = corner;
+            else
+                outPath.push_back(corner);
+        };
+
+        outPath.push_back(start);
+
+        for(size_t i = 1; i < portals.size(); i++)
+        {
+            const glm::vec3& portalLeft  = portals[i].first;
+            const glm::vec3& portalRight = portals[i].second;
+
+            if(TriArea2(apex, right, portalRight) <= 0.0f)
+            {
+                if(SamePointXZ(apex, right) || TriArea2(apex, left, portalRight) > 0.0f)
+                {
+                    right      = portalRight;
+                    rightIndex = i;
+                }
+                else
+                {
+                    apex      = left;
+                    apexIndex = leftIndex;
+                    addCorner(apex);
+
+                    left       = apex;
+                    right      = apex;
+                    leftIndex  = apexIndex;
+                    rightIndex = apexIndex;
+                    i          = apexIndex;
+                    continue;
+                }
+            }
+
+            if(TriArea2(apex, left, portalLeft) >= 0.0f)
+            {
+                if(SamePointXZ(apex, left) || TriArea2(apex, right, portalLeft) < 0.0f)
+                {
+                    left      = portalLeft;
+                    leftIndex = i;
+                }
+                else
+                {
+                    apex      = right;
+                    apexIndex = rightIndex;
+                    addCorner(apex);
+
+                    left       = apex;
+                    right      = apex;
+                    leftIndex  = apexIndex;
+                    rightIndex = apexIndex;
+                    i          = apexIndex;
+                    continue;
+                }
+            }
+        }
+
+        if(!SamePointXZ(outPath.back(), end) || outPath.size() == 1)
+            addCorner(end);
+    }
+
+    void NavMesh::DebugDraw(bool depthTested) const
+    {
+        LUMOS_PROFILE_FUNCTION();
+
+        // Lifted slightly so the outlines aren't hidden in the floor
+        const glm::vec3 lift         = glm::vec3(0.0f, m_Settings.CellHeight, 0.0f);
+        const glm::vec4 polyColour   = glm::vec4(0.0f, 0.6f, 1.0f, 1.0f);
+        const glm::vec4 portalColour = glm::vec4(0.2f, 1.0f, 0.2f, 1.0f);
+
+        for(const Tile& tile : m_Tiles)
+        {
+            for(const Poly& poly : tile.Polys)
+            {
+                const float minX = m_Origin.x + float(poly.MinX) * m_Settings.CellSize;
+                const float minZ = m_Origin.z + float(poly.MinZ) * m_Settings.CellSize;
+                const float maxX = m_Origin.x + float(poly.MaxX) * m_Settings.CellSize;
+                const float maxZ = m_Origin.z + float(poly.MaxZ) * m_Settings.CellSize;
+
+                const glm::vec3 corners[4] = {
+                    glm::vec3(minX, poly.Heights[0], minZ) + lift,
+                    glm::vec3(maxX, poly.Heights[1], minZ) + lift,
+                    glm::vec3(maxX, poly.Heights[2], maxZ) + lift,
+                    glm::vec3(minX, poly.Heights[3], maxZ) + lift
+                };
+
+                for(int i = 0; i < 4; i++)
+                    DebugRenderer::DrawHairLine(corners[i], corners[(i + 1) % 4], depthTested, polyColour);
+            }
+
+            for(const Portal& portal : tile.Portals)
+                DebugRenderer::DrawHairLine(portal.Points[0] + lift * 2.0f, portal.Points[1] + lift * 2.0f, depthTested, portalColour);
+        }
+    }
+}
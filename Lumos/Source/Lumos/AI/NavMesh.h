@@ -0,0 +1,149 @@
+#pragma once
+#include "PathNodePriorityQueue.h"
+#include "Maths/BoundingBox.h"
+#include <glm/ext/vector_float3.hpp>
+#include <glm/ext/matrix_float4x4.hpp>
+#include <unordered_map>
+
+namespace Lumos
+{
+    class Scene;
+
+    namespace Graphics
+    {
+        class Mesh;
+    }
+
+    struct LUMOS_EXPORT NavMeshSettings
+    {
+        float CellSize    = 0.3f;  // Horizontal voxel size
+        float CellHeight  = 0.2f;  // Vertical voxel size
+        float AgentHeight = 2.0f;  // Clearance needed above a walkable surface
+        float AgentRadius = 0.4f;  // Walkable areas are shrunk by this from walls and ledges
+        float MaxClimb    = 0.5f;  // Tallest step an agent can walk up
+        float MaxSlope    = 45.0f; // Steepest walkable slope in degrees
+        uint32_t TileSize = 32;    // Cells along each side of a tile, at most 255
+    };
+
+    // Navigation mesh built by voxelising static triangles into tiles of walkable rectangles.
+    // Tiles only voxelise the triangles around them, so obstacles just rebuild the tiles they touch.
+    // Paths are searched over the polygons and then string pulled through the portals between them
+    class LUMOS_EXPORT NavMesh
+    {
+    public:
+        typedef uint64_t PolyRef; // Tile index in the high bits, polygon in the tile in the low 16 bits
+
+        static const PolyRef InvalidPoly      = ~PolyRef(0);
+        static const uint32_t InvalidObstacle = 0;
+
+        explicit NavMesh(const NavMeshSettings& settings = NavMeshSettings());
+        ~NavMesh();
+
+        // Source geometry is in world space and changing it needs a full Build
+        void ClearGeometry();
+        void AddTriangles(const glm::vec3* vertices, uint32_t vertexCount, const uint32_t* indices, uint32_t indexCount, const glm::mat4& transform = glm::mat4(1.0f));
+        void AddMesh(const Graphics::Mesh* mesh, const glm::mat4& transform);
+
+        // Active models, skipping any on entities with a non static rigid body
+        void AddScene(Scene* scene);
+
+        void Build();
+
+        // Obstacles carve their bounds out of the walkable area once the tiles they touch are rebuilt by Update
+        uint32_t AddObstacle(const Maths::BoundingBox& bounds);
+        void MoveObstacle(uint32_t obstacle, const Maths::BoundingBox& bounds);
+        void RemoveObstacle(uint32_t obstacle);
+
+        // Rebuilds dirty tiles on the job system and returns how many were rebuilt
+        uint32_t Update();
+
+        PolyRef FindNearestPoly(const glm::vec3& position, float maxDistance, glm::vec3& outPoint) const;
+
+        // Shortest straight path through the polygons between the points nearest to start and end.
+        // Uses search state owned by the nav mesh, so calls must not overlap
+        bool FindPath(const glm::vec3& start, const glm::vec3& end, std::vector<glm::vec3>& outPath);
+
+        void DebugDraw(bool depthTested = false) const;
+
+        const NavMeshSettings& GetSettings() const { return m_Settings; }
+        uint32_t GetTileCount() const { return uint32_t(m_Tiles.size()); }
+        uint32_t GetPolyCount() const { return uint32_t(m_PolyRefs.size()); }
+        uint32_t GetNodesExpanded() const { return m_NodesExpanded; }
+        const std::vector<PolyRef>& GetCorridor() const { return m_Corridor; }
+
+    private:
+        struct Portal
+        {
+            PolyRef Target;
+            glm::vec3 Points[2];
+        };
+
+        struct Poly
+        {
+            // Bounds in cells from the mesh origin, max exclusive
+            int32_t MinX, MinZ, MaxX, MaxZ;
+
+            // Surface height at the (min, min), (max, min), (max, max) and (min, max) corners
+            float Heights[4];
+
+            uint32_t FirstPortal = 0;
+            uint32_t PortalCount = 0;
+        };
+
+        // Walkable surface in a cell and the polygon covering it
+        struct CellSpan
+        {
+            float Height;
+            uint32_t Poly;
+        };
+
+        struct Tile
+        {
+            std::vector<Poly> Polys;
+            std::vector<Portal> Portals;
+            std::vector<uint32_t> FirstSpan; // Per cell, one past the end for the last
+            std::vector<CellSpan> Spans;
+            std::vector<uint32_t> Triangles; // Source triangles overlapping the tile and its border
+            uint32_t PolyBase = 0;           // First search node of the tile's polygons
+            bool Dirty        = true;
+        };
+
+        int32_t GetErodeCells() const;
+        int32_t GetBorderCells() const;
+
+        void MarkDirty(const Maths::BoundingBox& bounds);
+        void BuildTile(uint32_t tileIndex);
+        void LinkTile(uint32_t tileIndex);
+        void RebuildSearchIndex();
+
+        bool GetCellSpans(int32_t x, int32_t z, const CellSpan*& begin, const CellSpan*& end, uint32_t& tileIndex) const;
+        const Poly& GetPoly(PolyRef ref) const;
+        glm::vec3 GetPolyCentre(PolyRef ref) const;
+        glm::vec3 ClosestPointOnPoly(const Poly& poly, const glm::vec3& position) const;
+
+        bool FindCorridor(PolyRef start, const glm::vec3& startPoint, PolyRef end, const glm::vec3& endPoint);
+        void StringPull(const glm::vec3& start, const glm::vec3& end, std::vector<glm::vec3>& outPath) const;
+
+        NavMeshSettings m_Settings;
+
+        std::vector<glm::vec3> m_Vertices;
+        std::vector<uint32_t> m_Indices;
+
+        std::unordered_map<uint32_t, Maths::BoundingBox> m_Obstacles;
+        uint32_t m_NextObstacle = 1;
+
+        std::vector<Tile> m_Tiles;
+        glm::vec3 m_Origin = glm::vec3(0.0f);
+        int32_t m_TilesX   = 0;
+        int32_t m_TilesZ   = 0;
+
+        // Search state, indexed by tile PolyBase plus polygon
+        std::vector<PolyRef> m_PolyRefs;
+        std::vector<QueueablePathNode> m_SearchNodes;
+        std::vector<glm::vec3> m_SearchPoints; // Where the best route so far enters each polygon
+        PathNodePriorityQueue m_OpenList;
+        std::vector<PolyRef> m_Corridor;
+        uint32_t m_Generation    = 0;
+        uint32_t m_NodesExpanded = 0;
+    };
+}
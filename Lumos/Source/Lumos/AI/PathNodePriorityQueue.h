@@ -1,48 +1,115 @@
 #pragma once
 #include "QueueablePathNode.h"
 #include <vector>
+
 namespace Lumos
 {
-
-    class PathNodePriorityQueue : public std::vector<QueueablePathNode*>
+    // Binary min-heap of node indices ordered by f score. Every queued node stores its slot in the heap,
+    // so lowering a score is a single sift up rather than a search and a full rebuild
+    class PathNodePriorityQueue
     {
     public:
-        PathNodePriorityQueue()
-            : std::vector<QueueablePathNode*>()
-        //, m_comp()
+        // Nodes must stay valid and unmoved until the next Reset
+        void Reset(QueueablePathNode* nodes)
+        {
+            m_Nodes = nodes;
+            m_Heap.clear();
+        }
+
+        bool Empty() const
         {
-            // std::make_heap(begin(), end(), m_comp);
+            return m_Heap.empty();
         }
 
-        void Push(QueueablePathNode* item)
+        size_t Size() const
         {
-            push_back(item);
-            // std::push_heap(begin(), end(), m_comp);
+            return m_Heap.size();
         }
 
-        void Pop()
+        uint32_t Top() const
         {
-            // std::pop_heap(begin(), end(), m_comp);
-            pop_back();
+            return m_Heap.front();
         }
 
-        QueueablePathNode* Top() const
+        void Push(uint32_t node)
         {
-            return front();
+            m_Heap.push_back(node);
+            m_Nodes[node].HeapIndex = uint32_t(m_Heap.size() - 1);
+            SiftUp(m_Nodes[node].HeapIndex);
         }
 
-        std::vector<QueueablePathNode*>::const_iterator Find(QueueablePathNode* item) const
+        uint32_t Pop()
         {
-            return std::find(cbegin(), cend(), item);
+            const uint32_t top     = m_Heap.front();
+            m_Nodes[top].HeapIndex = QueueablePathNode::InvalidIndex;
+
+            const uint32_t last = m_Heap.back();
+            m_Heap.pop_back();
+
+            if(!m_Heap.empty())
+            {
+                m_Heap[0]               = last;
+                m_Nodes[last].HeapIndex = 0;
+                SiftDown(0);
+            }
+
+            return top;
         }
 
-        void Update()
+        // Restores the heap after a queued node's f score was lowered
+        void Update(uint32_t node)
         {
-            // std::make_heap(begin(), end(), m_comp);
+            SiftUp(m_Nodes[node].HeapIndex);
         }
 
     private:
-        // greater_ptr<QueueablePathNode> m_comp;
-    };
+        bool Less(uint32_t a, uint32_t b) const
+        {
+            return m_Nodes[m_Heap[a]].fScore < m_Nodes[m_Heap[b]].fScore;
+        }
+
+        void Swap(uint32_t a, uint32_t b)
+        {
+            std::swap(m_Heap[a], m_Heap[b]);
+            m_Nodes[m_Heap[a]].HeapIndex = a;
+            m_Nodes[m_Heap[b]].HeapIndex = b;
+        }
+
+        void SiftUp(uint32_t slot)
+        {
+            while(slot > 0)
+            {
+                const uint32_t parent = (slot - 1) / 2;
+                if(!Less(slot, parent))
+                    break;
+
+                Swap(slot, parent);
+                slot = parent;
+            }
+        }
 
-}
\ No newline at end of file
+        void SiftDown(uint32_t slot)
+        {
+            const uint32_t count = uint32_t(m_Heap.size());
+            while(true)
+            {
+                const uint32_t left  = slot * 2 + 1;
+                const uint32_t right = left + 1;
+                uint32_t smallest    = slot;
+
+                if(left < count && Less(left, smallest))
+                    smallest = left;
+                if(right < count && Less(right, smallest))
+                    smallest = right;
+                if(smallest == slot)
+                    break;
+
+                Swap(slot, smallest);
+                slot = smallest;
+            }
+        }
+
+        std::vector<uint32_t> m_Heap;
+        QueueablePathNode* m_Nodes = nullptr;
+    };
+}
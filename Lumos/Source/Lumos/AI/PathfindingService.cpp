@@ -0,0 +1,160 @@
+#include "Precompiled.h"
+#include "PathfindingService.h"
+#include "Core/JobSystem.h"
+#include "Utilities/Timer.h"
+#include "ImGui/ImGuiUtilities.h"
+#include <imgui/imgui.h>
+
+namespace Lumos
+{
+    PathfindingService::PathfindingService()
+    {
+        m_DebugName = "Pathfinding";
+    }
+
+    PathfindingService::~PathfindingService()
+    {
+    }
+
+    bool PathfindingService::OnInit()
+    {
+        return true;
+    }
+
+    uint32_t PathfindingService::RequestPath(const SharedPtr<AStar>& graph, PathNode* start, PathNode* end, const PathCallback& callback)
+    {
+        std::scoped_lock<std::mutex> lock(m_Mutex);
+
+        Request request;
+        request.Graph    = graph;
+        request.Start    = start;
+        request.End      = end;
+        request.Callback = callback;
+        request.ID       = m_NextRequest++;
+
+        if(m_NextRequest == InvalidRequest)
+            m_NextRequest++;
+
+        m_Incoming.push_back(std::move(request));
+        return m_Incoming.back().ID;
+    }
+
+    void PathfindingService::CancelRequest(uint32_t request)
+    {
+        std::scoped_lock<std::mutex> lock(m_Mutex);
+        auto matches = [request](const Request& r)
+        { return r.ID == request; };
+
+        m_Incoming.erase(std::remove_if(m_Incoming.begin(), m_Incoming.end(), matches), m_Incoming.end());
+        m_Queue.erase(std::remove_if(m_Queue.begin(), m_Queue.end(), matches), m_Queue.end());
+
+        for(Request& completed : m_Completed)
+        {
+            if(matches(completed))
+                completed.Callback = nullptr;
+        }
+    }
+
+    void PathfindingService::OnUpdate(const TimeStep& dt, Scene* scene)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        m_SolvedLastFrame    = 0;
+        m_SolveTimeLastFrame = 0.0f;
+
+        {
+            std::scoped_lock<std::mutex> lock(m_Mutex);
+            for(Request& request : m_Incoming)
+                m_Queue.push_back(std::move(request));
+            m_Incoming.clear();
+        }
+
+        if(m_Queue.empty())
+            return;
+
+        // Workers only read the graphs, so bring their lazily cached data up to date first
+        std::vector<AStar*> preparedGraphs;
+        for(Request& request : m_Queue)
+        {
+            if(std::find(preparedGraphs.begin(), preparedGraphs.end(), request.Graph.get()) != preparedGraphs.end())
+                continue;
+
+            request.Graph->PrepareSearch();
+            preparedGraphs.push_back(request.Graph.get());
+        }
+
+        const uint32_t requestCount = uint32_t(m_Queue.size());
+        const uint32_t workerCount  = Maths::Min(System::JobSystem::GetThreadCount(), requestCount);
+        if(m_Scratch.size() < workerCount)
+            m_Scratch.resize(workerCount);
+
+        Timer timer;
+        std::atomic<uint32_t> nextRequest(0);
+
+        // Each worker pulls requests until the queue or the budget runs out. The first request always runs so
+        // a budget smaller than one search still makes progress
+        auto solve = [&](uint32_t worker)
+        {
+            while(true)
+            {
+                const uint32_t index = nextRequest.fetch_add(1);
+                if(index >= requestCount || (index > 0 && timer.GetElapsedMS() >= m_TimeBudget))
+                    break;
+
+                Request& request = m_Queue[index];
+                request.Found    = request.Graph->FindPath(request.Start, request.End, m_Scratch[worker], request.Path, request.Cost);
+                request.Solved   = true;
+            }
+        };
+
+        if(workerCount > 1)
+        {
+            System::JobSystem::Context ctx;
+            System::JobSystem::Dispatch(ctx, workerCount, 1, [&](JobDispatchArgs args)
+                                        { solve(args.jobIndex); });
+            System::JobSystem::Wait(ctx);
+        }
+        else
+            solve(0);
+
+        m_SolveTimeLastFrame = timer.GetElapsedMS();
+
+        // Split off the results before running callbacks, which may queue or cancel requests
+        {
+            std::scoped_lock<std::mutex> lock(m_Mutex);
+            auto firstSolved = std::stable_partition(m_Queue.begin(), m_Queue.end(), [](const Request& request)
+                                                     { return !request.Solved; });
+
+            m_Completed.insert(m_Completed.end(), std::make_move_iterator(firstSolved), std::make_move_iterator(m_Queue.end()));
+            m_Queue.erase(firstSolved, m_Queue.end());
+        }
+
+        m_SolvedLastFrame = uint32_t(m_Completed.size());
+        for(size_t i = 0; i < m_Completed.size(); i++)
+        {
+            PathCallback callback = std::move(m_Completed[i].Callback);
+            if(callback)
+                callback(m_Completed[i].Found, m_Completed[i].Path, m_Completed[i].Cost);
+        }
+
+        m_Completed.clear();
+    }
+
+    void PathfindingService::OnImGui()
+    {
+        ImGui::TextUnformatted("Pathfinding");
+
+        ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(2, 2));
+        ImGui::Columns(2);
+        ImGui::Separator();
+
+        uint32_t queued = uint32_t(m_Queue.size());
+        ImGuiUtilities::Property("Queued Requests", queued, ImGuiUtilities::PropertyFlag::ReadOnly);
+        ImGuiUtilities::Property("Solved Last Frame", m_SolvedLastFrame, ImGuiUtilities::PropertyFlag::ReadOnly);
+        ImGuiUtilities::Property("Solve Time (ms)", m_SolveTimeLastFrame, 0.0f, 0.0f, 0.0f, ImGuiUtilities::PropertyFlag::ReadOnly);
+        ImGuiUtilities::Property("Time Budget (ms)", m_TimeBudget, 0.0f, 100.0f, 0.1f);
+
+        ImGui::Columns(1);
+        ImGui::Separator();
+        ImGui::PopStyleVar();
+    }
+}
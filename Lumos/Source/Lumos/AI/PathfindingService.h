@@ -0,0 +1,62 @@
+#pragma once
+#include "Scene/ISystem.h"
+#include "AStar.h"
+#include <functional>
+#include <mutex>
+
+namespace Lumos
+{
+    // Queues path requests and solves them in parallel on the job system, spending at most the time budget each frame.
+    // Requests that don't fit carry over to the next frame and callbacks always run on the main thread
+    class LUMOS_EXPORT PathfindingService : public ISystem
+    {
+    public:
+        typedef std::function<void(bool found, const std::vector<PathNode*>& path, float cost)> PathCallback;
+
+        static const uint32_t InvalidRequest = 0;
+
+        PathfindingService();
+        ~PathfindingService();
+
+        // Safe to call from any thread. The graph is kept alive until the request completes
+        uint32_t RequestPath(const SharedPtr<AStar>& graph, PathNode* start, PathNode* end, const PathCallback& callback);
+
+        // Main thread only. The callback won't run, even if the request was solved this frame
+        void CancelRequest(uint32_t request);
+
+        void SetTimeBudget(float milliseconds) { m_TimeBudget = milliseconds; }
+        float GetTimeBudget() const { return m_TimeBudget; }
+
+        bool OnInit() override;
+        void OnUpdate(const TimeStep& dt, Scene* scene) override;
+        void OnImGui() override;
+        void OnDebugDraw() override {};
+
+    private:
+        struct Request
+        {
+            SharedPtr<AStar> Graph;
+            PathNode* Start;
+            PathNode* End;
+            PathCallback Callback;
+            uint32_t ID;
+
+            // Written by the worker that solves it
+            std::vector<PathNode*> Path;
+            float Cost  = 0.0f;
+            bool Found  = false;
+            bool Solved = false;
+        };
+
+        std::mutex m_Mutex;
+        std::vector<Request> m_Incoming; // Guarded by m_Mutex
+        std::vector<Request> m_Queue;
+        std::vector<Request> m_Completed;
+        std::vector<AStar::SearchScratch> m_Scratch; // One per worker
+        uint32_t m_NextRequest = 1;
+        float m_TimeBudget     = 2.0f;
+
+        uint32_t m_SolvedLastFrame = 0;
+        float m_SolveTimeLastFrame = 0.0f;
+    };
+}
@@ -1,60 +1,19 @@
 #pragma once
 
-#include "PathNode.h"
-#include <limits>
-
-#undef max
+#include <cstdint>
 
 namespace Lumos
 {
-
-    class LUMOS_EXPORT QueueablePathNode
+    // Per search state for one node of an AStar graph. Entries are reused between searches,
+    // a node whose Generation doesn't match the current search is treated as unvisited
+    struct LUMOS_EXPORT QueueablePathNode
     {
-    public:
-        explicit QueueablePathNode(PathNode* n)
-            : node(n)
-            , Parent(nullptr)
-            , fScore(std::numeric_limits<float>::max())
-            , gScore(std::numeric_limits<float>::max())
-        {
-        }
-
-        virtual ~QueueablePathNode()
-        {
-        }
-
-        bool IsOnList(const std::vector<QueueablePathNode*>& list)
-        {
-            return std::find_if(list.begin(), list.end(), [this](QueueablePathNode* n)
-                                { return n->node == reinterpret_cast<PathNode*>(this); })
-                != list.end();
-        }
-
-        bool operator>(const QueueablePathNode& other) const
-        {
-            return this->fScore > other.fScore;
-        }
+        static const uint32_t InvalidIndex = ~0u;
 
-        bool operator>=(const QueueablePathNode& other) const
-        {
-            return this->fScore >= other.fScore;
-        }
-
-        bool operator<(const QueueablePathNode& other) const
-        {
-            return this->fScore < other.fScore;
-        }
-
-        bool operator<=(const QueueablePathNode& other) const
-        {
-            return this->fScore <= other.fScore;
-        }
-
-    public:
-        PathNode* node;            //!< Wrapped Node
-        QueueablePathNode* Parent; //!< Parent Node in path
-        float fScore;              //!< F score of wrapped node
-        float gScore;              //!< G score of wrapped node
+        float fScore        = 0.0f;         //!< F score of the node
+        float gScore        = 0.0f;         //!< G score of the node
+        uint32_t Parent     = InvalidIndex; //!< Parent node index in path
+        uint32_t HeapIndex  = InvalidIndex; //!< Slot in the open list, invalid while not queued
+        uint32_t Generation = 0;            //!< Search that last touched this node
     };
-
-}
\ No newline at end of file
+}
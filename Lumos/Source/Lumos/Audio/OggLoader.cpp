@@ -8,49 +8,263 @@
 
 namespace Lumos
 {
-    AudioData LoadOgg(const std::string& fileName)
+    // Frames decoded per block when down mixing to mono
+    static const uint32_t DownmixBlockFrames = 1024;
+
+    OggFile::OggFile(const std::string& fileName)
+        : m_FileName(fileName)
+    {
+        m_Data = Lumos::FileSystem::Get().ReadFileVFS(fileName, &m_Size);
+        if(!m_Data)
+            LUMOS_LOG_INFO("Failed to load Ogg file : File Not Found");
+    }
+
+    OggFile::~OggFile()
+    {
+        delete[] m_Data;
+    }
+
+    // stb_vorbis reads from the file as it goes, so the file has to outlive the returned decoder
+    static stb_vorbis* OpenVorbis(const OggFile& file)
+    {
+        if(!file.IsValid())
+            return nullptr;
+
+        int error;
+        stb_vorbis* vorbis = stb_vorbis_open_memory(file.GetData(), int(file.GetSize()), &error, nullptr);
+        if(!vorbis)
+            LUMOS_LOG_CRITICAL("Failed to load OGG file '{0}'! , Error {1}", file.GetFileName(), error);
+
+        return vorbis;
+    }
+
+    // stb_vorbis can only mix down to stereo, so mono is decoded as stereo in blocks and averaged
+    static uint32_t DecodeFrames(stb_vorbis* vorbis, uint32_t fileChannels, uint32_t channels, int16_t* out, uint32_t frameCount)
+    {
+        if(channels == 2 || fileChannels == 1)
+            return uint32_t(stb_vorbis_get_samples_short_interleaved(vorbis, int(channels), out, int(frameCount * channels)));
+
+        int16_t stereo[DownmixBlockFrames * 2];
+        uint32_t decoded = 0;
+        while(decoded < frameCount)
+        {
+            const uint32_t block = glm::min(DownmixBlockFrames, frameCount - decoded);
+            const int frames     = stb_vorbis_get_samples_short_interleaved(vorbis, 2, stereo, int(block * 2));
+            if(frames <= 0)
+                break;
+
+            for(int i = 0; i < frames; i++)
+                out[decoded + i] = int16_t((int32_t(stereo[i * 2]) + int32_t(stereo[i * 2 + 1])) / 2);
+            decoded += uint32_t(frames);
+        }
+        return decoded;
+    }
+
+    static void FillInfo(stb_vorbis* vorbis, bool preserveStereo, AudioData& data)
+    {
+        const stb_vorbis_info vorbisInfo = stb_vorbis_get_info(vorbis);
+        data.Channels                    = preserveStereo && vorbisInfo.channels > 1 ? 2 : 1;
+        data.BitRate                     = 16;
+        data.FreqRate                    = static_cast<float>(vorbisInfo.sample_rate);
+        data.Length                      = stb_vorbis_stream_length_in_seconds(vorbis) * 1000.0f; // Milliseconds
+    }
+
+    // Decodes everything left in the file into one buffer
+    static AudioData DecodeAll(stb_vorbis* vorbis, bool preserveStereo)
     {
         AudioData data = AudioData();
+        FillInfo(vorbis, preserveStereo, data);
+
+        const uint32_t frameCount = stb_vorbis_stream_length_in_samples(vorbis);
+        data.Data.resize(frameCount * data.Channels * sizeof(int16_t));
+
+        const uint32_t decoded = DecodeFrames(vorbis, uint32_t(stb_vorbis_get_info(vorbis).channels), data.Channels, reinterpret_cast<int16_t*>(data.Data.data()), frameCount);
+        data.Size              = decoded * data.Channels * sizeof(int16_t);
+        data.Data.resize(data.Size);
+        return data;
+    }
+
+    AudioData LoadOgg(const std::string& fileName, bool preserveStereo)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        OggFile file(fileName);
+        stb_vorbis* vorbis = OpenVorbis(file);
+        if(!vorbis)
+            return AudioData();
+
+        AudioData data = DecodeAll(vorbis, preserveStereo);
+        stb_vorbis_close(vorbis);
+
+        return data;
+    }
+
+    OggStream::OggStream()
+    {
+    }
+
+    OggStream::~OggStream()
+    {
+        Close();
+    }
+
+    bool OggStream::Open(const std::string& fileName, bool preserveStereo, float chunkSeconds)
+    {
+        return Open(CreateSharedPtr<OggFile>(fileName), preserveStereo, chunkSeconds);
+    }
+
+    bool OggStream::Open(const SharedPtr<OggFile>& file, bool preserveStereo, float chunkSeconds)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        Close();
+
+        m_Vorbis = OpenVorbis(*file);
+        if(!m_Vorbis)
+            return false;
+
+        m_File = file;
+
+        AudioData info;
+        FillInfo(m_Vorbis, preserveStereo, info);
+        m_Channels       = info.Channels;
+        m_SampleRate     = uint32_t(info.FreqRate);
+        m_Length         = info.Length;
+        m_PreserveStereo = preserveStereo;
 
-        std::string physicalPath;
-        if(!Lumos::FileSystem::Get().ResolvePhysicalPath(fileName, physicalPath))
+        // Chunks are allocated by the first decode, a stream that's only read whole never needs them
+        m_ChunkFrames = glm::max(1u, uint32_t(float(m_SampleRate) * chunkSeconds));
+        for(Chunk& chunk : m_Chunks)
         {
-            LUMOS_LOG_INFO("Failed to load Ogg file : File Not Found");
+            chunk.Samples.clear();
+            chunk.SampleCount = 0;
         }
 
-        const auto m_FileHandle = fopen(physicalPath.c_str(), "rb");
+        m_ReadIndex  = 0;
+        m_WriteIndex = 0;
+        m_EndOfFile  = false;
+        return true;
+    }
 
-        if(!m_FileHandle)
+    void OggStream::Close()
+    {
+        System::JobSystem::Wait(m_DecodeContext);
+        if(m_Vorbis)
         {
-            LUMOS_LOG_CRITICAL("Failed to load OGG file '{0}'!", physicalPath);
+            stb_vorbis_close(m_Vorbis);
+            m_Vorbis = nullptr;
         }
-        int error;
-        auto m_StreamHandle = stb_vorbis_open_filename(physicalPath.c_str(), &error, nullptr);
 
-        if(!m_StreamHandle)
+        m_File = nullptr;
+    }
+
+    void OggStream::RequestDecode()
+    {
+        if(!m_Vorbis || m_EndOfFile || System::JobSystem::IsBusy(m_DecodeContext))
+            return;
+
+        if(m_WriteIndex.load() - m_ReadIndex.load() >= ChunkCount)
+            return;
+
+        if(m_Chunks[0].Samples.empty())
         {
-            LUMOS_LOG_CRITICAL("Failed to load OGG file '{0}'! , Error {1}", physicalPath, error);
-            return data;
+            for(Chunk& chunk : m_Chunks)
+                chunk.Samples.resize(m_ChunkFrames * m_Channels);
         }
 
-        // Get file info
-        const stb_vorbis_info m_VorbisInfo = stb_vorbis_get_info(m_StreamHandle);
-        data.Channels                      = m_VorbisInfo.channels;
-        data.BitRate                       = 16;
-        data.FreqRate                      = static_cast<float>(m_VorbisInfo.sample_rate);
-        data.Size                          = stb_vorbis_stream_length_in_samples(m_StreamHandle) * m_VorbisInfo.channels * sizeof(int16_t);
-        data.Data.resize(data.Size);
+        System::JobSystem::Execute(m_DecodeContext, [this](JobDispatchArgs args)
+                                   { DecodeChunks(); });
+    }
 
-        stb_vorbis_get_samples_short_interleaved(m_StreamHandle, m_VorbisInfo.channels, reinterpret_cast<short*>(data.Data.data()), data.Size);
+    void OggStream::DecodeChunks()
+    {
+        LUMOS_PROFILE_FUNCTION();
+        const uint32_t fileChannels = uint32_t(stb_vorbis_get_info(m_Vorbis).channels);
+
+        while(!m_EndOfFile && m_WriteIndex.load(std::memory_order_relaxed) - m_ReadIndex.load(std::memory_order_acquire) < ChunkCount)
+        {
+            Chunk& chunk               = m_Chunks[m_WriteIndex.load(std::memory_order_relaxed) % ChunkCount];
+            const uint32_t chunkFrames = uint32_t(chunk.Samples.size()) / m_Channels;
+            uint32_t frames            = 0;
+            bool rewound               = false;
 
-        Sound::ConvertToMono(data.Data.data(), data.Size, data.Data.data(), data.Channels, data.BitRate);
-        data.Channels = 1;
-        data.Length   = stb_vorbis_stream_length_in_seconds(m_StreamHandle) * 1000.0f; // Milliseconds
+            while(frames < chunkFrames)
+            {
+                const uint32_t decoded = DecodeFrames(m_Vorbis, fileChannels, m_Channels, chunk.Samples.data() + frames * m_Channels, chunkFrames - frames);
+                frames += decoded;
 
-        stb_vorbis_close(m_StreamHandle);
+                if(decoded == 0)
+                {
+                    // Loop seamlessly by carrying on from the start in the same chunk. An empty file would never end
+                    if(m_Looping && !rewound)
+                    {
+                        stb_vorbis_seek_start(m_Vorbis);
+                        rewound = true;
+                        continue;
+                    }
 
-        fclose(m_FileHandle);
+                    m_EndOfFile = true;
+                    break;
+                }
+                rewound = false;
+            }
 
+            if(frames == 0)
+                break;
+
+            chunk.SampleCount = frames * m_Channels;
+            m_WriteIndex.fetch_add(1, std::memory_order_release);
+        }
+    }
+
+    const OggStream::Chunk* OggStream::FrontChunk() const
+    {
+        const uint32_t read = m_ReadIndex.load(std::memory_order_relaxed);
+        if(read == m_WriteIndex.load(std::memory_order_acquire))
+            return nullptr;
+
+        return &m_Chunks[read % ChunkCount];
+    }
+
+    void OggStream::PopChunk()
+    {
+        if(FrontChunk())
+            m_ReadIndex.fetch_add(1, std::memory_order_release);
+    }
+
+    void OggStream::Seek(double milliseconds)
+    {
+        System::JobSystem::Wait(m_DecodeContext);
+        if(m_Vorbis)
+        {
+            const uint32_t sample = uint32_t(milliseconds * 0.001 * m_SampleRate);
+            if(sample == 0 || sample >= stb_vorbis_stream_length_in_samples(m_Vorbis))
+                stb_vorbis_seek_start(m_Vorbis);
+            else
+                stb_vorbis_seek(m_Vorbis, sample);
+        }
+
+        m_ReadIndex  = 0;
+        m_WriteIndex = 0;
+        m_EndOfFile  = false;
+    }
+
+    AudioData OggStream::ReadAll()
+    {
+        LUMOS_PROFILE_FUNCTION();
+        System::JobSystem::Wait(m_DecodeContext);
+        if(!m_Vorbis)
+            return AudioData();
+
+        stb_vorbis_seek_start(m_Vorbis);
+        AudioData data = DecodeAll(m_Vorbis, m_PreserveStereo);
+
+        m_ReadIndex  = 0;
+        m_WriteIndex = 0;
+        m_EndOfFile  = true;
         return data;
     }
+
+    bool OggStream::IsFinished() const
+    {
+        return m_EndOfFile && m_ReadIndex.load() == m_WriteIndex.load();
+    }
 }
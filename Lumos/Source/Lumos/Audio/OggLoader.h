@@ -1,7 +1,102 @@
 #pragma once
 #include "AudioData.h"
+#include "Core/JobSystem.h"
+#include "Core/Reference.h"
+
+#include <atomic>
+
+struct stb_vorbis;
 
 namespace Lumos
 {
-    AudioData LoadOgg(const std::string& fileName);
-}
\ No newline at end of file
+    // Decodes the whole file, down mixed to mono unless stereo is preserved
+    AudioData LoadOgg(const std::string& fileName, bool preserveStereo = false);
+
+    // An encoded file read once through the VFS, shared by every stream decoding it
+    class LUMOS_EXPORT OggFile
+    {
+    public:
+        OggFile(const std::string& fileName);
+        ~OggFile();
+
+        OggFile(const OggFile&)            = delete;
+        OggFile& operator=(const OggFile&) = delete;
+
+        const uint8_t* GetData() const { return m_Data; }
+        int64_t GetSize() const { return m_Size; }
+        const std::string& GetFileName() const { return m_FileName; }
+        bool IsValid() const { return m_Data != nullptr; }
+
+    private:
+        std::string m_FileName;
+        uint8_t* m_Data = nullptr;
+        int64_t m_Size  = 0;
+    };
+
+    // Decodes an OGG file a chunk at a time on the job system into a small ring, so long tracks are never
+    // fully decoded in memory. Doesn't touch the audio device, the backend queues the chunks into its own buffers
+    class LUMOS_EXPORT OggStream
+    {
+    public:
+        static const uint32_t ChunkCount = 4;
+
+        struct Chunk
+        {
+            std::vector<int16_t> Samples; // Interleaved
+            uint32_t SampleCount = 0;     // Less than the capacity for the last chunk of the file
+        };
+
+        OggStream();
+        ~OggStream();
+
+        bool Open(const std::string& fileName, bool preserveStereo, float chunkSeconds = 0.25f);
+
+        // Decodes from a file other streams may be reading too, each keeps its own decoder and chunks
+        bool Open(const SharedPtr<OggFile>& file, bool preserveStereo, float chunkSeconds = 0.25f);
+        void Close();
+
+        // Starts a job filling the free chunks unless one is already running
+        void RequestDecode();
+
+        // Oldest decoded chunk, or null when decoding hasn't caught up
+        const Chunk* FrontChunk() const;
+        void PopChunk();
+
+        // Waits for decoding and restarts from the given position, dropping any decoded chunks
+        void Seek(double milliseconds);
+        void Rewind() { Seek(0.0); }
+
+        void SetLooping(bool looping) { m_Looping = looping; }
+
+        // Decodes the whole file at once on the calling thread, for sounds short enough to keep in memory.
+        // Leaves the stream finished
+        AudioData ReadAll();
+
+        // The whole file was decoded and every chunk consumed
+        bool IsFinished() const;
+
+        uint32_t GetChannels() const { return m_Channels; }
+        uint32_t GetSampleRate() const { return m_SampleRate; }
+        double GetLength() const { return m_Length; }
+
+    private:
+        void DecodeChunks();
+
+        stb_vorbis* m_Vorbis = nullptr;
+        SharedPtr<OggFile> m_File; // Encoded file the decoder reads from
+        Chunk m_Chunks[ChunkCount];
+
+        // Ever increasing, the read index is only advanced by the caller and the write index only by the decode job
+        std::atomic<uint32_t> m_ReadIndex { 0 };
+        std::atomic<uint32_t> m_WriteIndex { 0 };
+        std::atomic<bool> m_Looping { false };
+        std::atomic<bool> m_EndOfFile { false };
+        System::JobSystem::Context m_DecodeContext;
+
+        uint32_t m_Channels    = 0;
+        uint32_t m_SampleRate  = 0;
+        uint32_t m_ChunkFrames = 0;
+        double m_Length        = 0.0; // Milliseconds
+        bool m_PreserveStereo  = false;
+    };
+}
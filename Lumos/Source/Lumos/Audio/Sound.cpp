@@ -10,14 +10,15 @@ namespace Lumos
 {
     Sound::Sound()
         : m_Streaming(false)
+        , m_PreserveStereo(false)
         , m_Data {}
     {
     }
 
-    SharedPtr<Sound> Sound::Create(const std::string& name, const std::string& extension)
+    SharedPtr<Sound> Sound::Create(const std::string& name, const std::string& extension, bool preserveStereo)
     {
 #ifdef LUMOS_OPENAL
-        return SharedPtr<ALSound>(new ALSound(name, extension));
+        return SharedPtr<ALSound>(new ALSound(name, extension, preserveStereo));
 #else
         return nullptr;
 #endif
@@ -10,7 +10,9 @@ namespace Lumos
         friend class SoundManager;
 
     public:
-        static SharedPtr<Sound> Create(const std::string& name, const std::string& extension);
+        // Long OGG files are streamed rather than decoded up front. Stereo is down mixed to mono for 3D
+        // positioning unless preserveStereo is set, e.g. for music
+        static SharedPtr<Sound> Create(const std::string& name, const std::string& extension, bool preserveStereo = false);
         virtual ~Sound() = default;
 
         const std::byte* GetData() const
@@ -37,6 +39,10 @@ namespace Lumos
         {
             return m_Streaming;
         }
+        bool GetPreserveStereo() const
+        {
+            return m_PreserveStereo;
+        }
         double GetLength() const;
         virtual double StreamData(unsigned int buffer, double timeLeft)
         {
@@ -50,6 +56,7 @@ namespace Lumos
     protected:
         Sound();
         bool m_Streaming;
+        bool m_PreserveStereo;
         std::string m_FilePath;
 
         AudioData m_Data;
@@ -1,5 +1,6 @@
 #include "Precompiled.h"
 #include "SoundNode.h"
+#include "VoiceAllocator.h"
 #include "Maths/MathsUtilities.h"
 
 #ifdef LUMOS_OPENAL
@@ -43,6 +44,9 @@ namespace Lumos
         m_ReferenceDistance = 1.0f;
         m_RollOffFactor     = 1.0f;
         m_Velocity          = glm::vec3(0.0f);
+        m_Priority          = 1.0f;
+        m_Voice             = VoiceAllocator::VirtualVoice;
+        m_Playing           = false;
     }
 
     SoundNode::~SoundNode()
@@ -67,4 +71,9 @@ namespace Lumos
     {
         m_Radius = Maths::Max(0.0f, value);
     }
+
+    void SoundNode::SetPriority(float value)
+    {
+        m_Priority = Maths::Max(0.0f, value);
+    }
 }
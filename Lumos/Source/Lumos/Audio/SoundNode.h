@@ -57,6 +57,17 @@ namespace Lumos
 
         double GetTimeLeft() const { return m_TimeLeft; }
 
+        // Scales the emitter's attenuated gain when competing for a real voice
+        float GetPriority() const { return m_Priority; }
+        void SetPriority(float value);
+
+        // Index into the audio manager's voice pool, or VoiceAllocator::VirtualVoice while virtual
+        int32_t GetVoice() const { return m_Voice; }
+        bool IsPlaying() const { return m_Playing; }
+
+        // Milliseconds into the sound, kept advancing while virtual
+        double GetPlaybackPosition() const { return m_StreamPos; }
+
         virtual void OnUpdate(float msec) = 0;
         virtual void Pause()              = 0;
         virtual void Resume()             = 0;
@@ -78,6 +89,9 @@ namespace Lumos
         float m_RollOffFactor;
         bool m_Stationary;
         double m_StreamPos;
+        float m_Priority;
+        int32_t m_Voice;
+        bool m_Playing;
     };
 
 }
@@ -0,0 +1,96 @@
+#include "Precompiled.h"
+#include "VoiceAllocator.h"
+#include <glm/geometric.hpp>
+
+namespace Lumos
+{
+    // Emitters holding a voice score this much higher, so two close candidates don't swap every update
+    static const float VoiceHysteresis = 1.1f;
+
+    // Below this gain an emitter can't be heard and never takes a voice
+    static const float MinAudibleGain = 0.001f;
+
+    VoiceAllocator::VoiceAllocator(uint32_t voiceCount)
+        : m_VoiceCount(voiceCount)
+    {
+    }
+
+    void VoiceAllocator::Allocate(std::vector<Request>& requests)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        auto audible = [](const Request& request)
+        {
+            return request.Playing && request.Gain > MinAudibleGain && request.Priority > 0.0f;
+        };
+
+        m_Ranked.clear();
+        for(uint32_t i = 0; i < uint32_t(requests.size()); i++)
+        {
+            if(audible(requests[i]))
+                m_Ranked.push_back(i);
+        }
+
+        auto score = [&requests](uint32_t index)
+        {
+            const Request& request = requests[index];
+            return request.Priority * request.Gain * (request.Voice != VirtualVoice ? VoiceHysteresis : 1.0f);
+        };
+
+        const uint32_t realCount = glm::min(m_VoiceCount, uint32_t(m_Ranked.size()));
+        if(realCount < m_Ranked.size())
+        {
+            // Only the split between real and virtual matters, not the order either side of it
+            std::nth_element(m_Ranked.begin(), m_Ranked.begin() + realCount, m_Ranked.end(), [&score](uint32_t a, uint32_t b)
+                             { return score(a) > score(b); });
+        }
+
+        // Demote everything outside the winners first so their voices are free to hand out
+        m_VoiceUsed.assign(m_VoiceCount, false);
+        for(Request& request : requests)
+        {
+            if(request.Voice >= int32_t(m_VoiceCount))
+                request.Voice = VirtualVoice;
+        }
+
+        for(uint32_t i = realCount; i < uint32_t(m_Ranked.size()); i++)
+            requests[m_Ranked[i]].Voice = VirtualVoice;
+
+        for(Request& request : requests)
+        {
+            if(request.Voice == VirtualVoice)
+                continue;
+
+            if(!audible(request))
+                request.Voice = VirtualVoice;
+            else
+                m_VoiceUsed[request.Voice] = true;
+        }
+
+        uint32_t nextFree = 0;
+        for(uint32_t i = 0; i < realCount; i++)
+        {
+            Request& request = requests[m_Ranked[i]];
+            if(request.Voice != VirtualVoice)
+                continue;
+
+            while(m_VoiceUsed[nextFree])
+                nextFree++;
+
+            request.Voice           = int32_t(nextFree);
+            m_VoiceUsed[nextFree++] = true;
+        }
+
+        m_RealCount    = realCount;
+        m_VirtualCount = uint32_t(requests.size()) - realCount;
+    }
+
+    float VoiceAllocator::AttenuatedGain(const glm::vec3& listener, const glm::vec3& position, float volume, float referenceDistance, float maxDistance, float rollOff)
+    {
+        if(maxDistance <= referenceDistance)
+            return volume;
+
+        const float distance = glm::clamp(glm::length(position - listener), referenceDistance, maxDistance);
+        const float gain     = 1.0f - rollOff * (distance - referenceDistance) / (maxDistance - referenceDistance);
+        return volume * glm::clamp(gain, 0.0f, 1.0f);
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include "Core/Core.h"
+#include <glm/ext/vector_float3.hpp>
+
+namespace Lumos
+{
+    // Chooses which emitters get one of a fixed number of real voices. Emitters are ranked by
+    // priority × attenuated gain and the rest stay virtual. Holds no device state so it can run without audio
+    class LUMOS_EXPORT VoiceAllocator
+    {
+    public:
+        static const int32_t VirtualVoice = -1;
+
+        struct Request
+        {
+            float Priority = 1.0f;
+            float Gain     = 1.0f;         // Volume after distance attenuation
+            bool Playing   = true;         // Stopped and paused emitters never hold a voice
+            int32_t Voice  = VirtualVoice; // In: the voice held last update. Out: the voice for this update
+        };
+
+        VoiceAllocator(uint32_t voiceCount = 0);
+
+        void SetVoiceCount(uint32_t voiceCount) { m_VoiceCount = voiceCount; }
+        uint32_t GetVoiceCount() const { return m_VoiceCount; }
+
+        // Emitters keeping a voice keep the same index, so only promoted and demoted ones touch the device
+        void Allocate(std::vector<Request>& requests);
+
+        uint32_t GetRealCount() const { return m_RealCount; }
+        uint32_t GetVirtualCount() const { return m_VirtualCount; }
+
+        // Matches AL_LINEAR_DISTANCE_CLAMPED
+        static float AttenuatedGain(const glm::vec3& listener, const glm::vec3& position, float volume, float referenceDistance, float maxDistance, float rollOff);
+
+    private:
+        uint32_t m_VoiceCount;
+        uint32_t m_RealCount    = 0;
+        uint32_t m_VirtualCount = 0;
+
+        std::vector<uint32_t> m_Ranked;
+        std::vector<bool> m_VoiceUsed;
+    };
+}
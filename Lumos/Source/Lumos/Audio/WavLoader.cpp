@@ -1,13 +1,26 @@
 #include "Precompiled.h"
 #include "WavLoader.h"
+#include "Core/OS/FileSystem.h"
 
 namespace Lumos
 {
+    // Reads a chunk header at offset, false if it runs past the end of the file
+    static bool LoadWAVChunkInfo(const uint8_t* file, uint64_t fileSize, uint64_t offset, std::string& name, uint32_t& size)
+    {
+        if(offset + 8 > fileSize)
+            return false;
+
+        name = std::string(reinterpret_cast<const char*>(file + offset), 4);
+        memcpy(&size, file + offset + 4, sizeof(uint32_t));
+        return true;
+    }
+
     AudioData LoadWav(const std::string& fileName)
     {
         AudioData data = AudioData();
 
-        std::ifstream file(fileName.c_str(), std::ios::in | std::ios::binary);
+        int64_t fileSize = 0;
+        uint8_t* file    = FileSystem::Get().ReadFileVFS(fileName, &fileSize);
 
         if(!file)
         {
@@ -17,20 +30,24 @@ namespace Lumos
 
         std::string chunkName;
         uint32_t chunkSize = 0;
+        uint64_t offset    = 0;
 
-        while(!file.eof())
+        while(LoadWAVChunkInfo(file, uint64_t(fileSize), offset, chunkName, chunkSize))
         {
-            LoadWAVChunkInfo(file, chunkName, chunkSize);
+            offset += 8;
 
             if(chunkName == "RIFF")
             {
-                file.seekg(4, std::ios_base::cur);
+                // Only the WAVE tag follows, the sub chunks are read next
+                offset += 4;
+                continue;
             }
-            else if(chunkName == "fmt ")
+
+            const uint64_t available = uint64_t(fileSize) - glm::min(offset, uint64_t(fileSize));
+            if(chunkName == "fmt " && chunkSize >= sizeof(FMTCHUNK) && available >= sizeof(FMTCHUNK))
             {
                 FMTCHUNK fmt {};
-
-                file.read(reinterpret_cast<char*>(&fmt), sizeof(FMTCHUNK));
+                memcpy(&fmt, file + offset, sizeof(FMTCHUNK));
 
                 data.BitRate  = static_cast<uint32_t>(fmt.samp);
                 data.FreqRate = static_cast<float>(fmt.srate);
@@ -38,38 +55,21 @@ namespace Lumos
             }
             else if(chunkName == "data")
             {
-                data.Size = chunkSize;
-                data.Data.resize(data.Size);
-                file.read(reinterpret_cast<char*>(data.Data.data()), chunkSize);
+                data.Size = uint32_t(glm::min(uint64_t(chunkSize), available));
+                data.Data.assign(file + offset, file + offset + data.Size);
                 break;
-                /*
-                                In release mode, ifstream and / or something else were combining
-                                to make this function see another 'data' chunk, filled with
-                                nonsense data, breaking WAV loading. Easiest way to get around it
-                                was to simply break after loading the data chunk. This *should*
-                                be fine for any WAV file you find / use. Not fun to debug.
-                                */
-            }
-            else
-            {
-                file.seekg(chunkSize, std::ios_base::cur);
             }
+
+            // Chunks are padded to an even size
+            offset += uint64_t(chunkSize) + (chunkSize & 1);
         }
 
-        // Milliseconds
-        data.Length = static_cast<float>(data.Size) / (data.Channels * data.FreqRate * (data.BitRate / 8.0f)) * 1000.0f;
+        delete[] file;
 
-        file.close();
+        // Milliseconds
+        if(data.Channels > 0 && data.FreqRate > 0.0f && data.BitRate > 0)
+            data.Length = static_cast<float>(data.Size) / (data.Channels * data.FreqRate * (data.BitRate / 8.0f)) * 1000.0f;
 
         return data;
     }
-
-    void LoadWAVChunkInfo(std::ifstream& file, std::string& name, unsigned int& size)
-    {
-        char chunk[4];
-        file.read(reinterpret_cast<char*>(&chunk), 4);
-        file.read(reinterpret_cast<char*>(&size), 4);
-
-        name = std::string(chunk, 4);
-    }
 }
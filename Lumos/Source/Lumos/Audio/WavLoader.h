@@ -3,14 +3,15 @@
 
 namespace Lumos
 {
+    // Fixed size types, the chunk is copied straight out of the file
     struct FMTCHUNK
     {
-        short format;
-        short channels;
-        unsigned long srate;
-        unsigned long bps;
-        short balign;
-        short samp;
+        uint16_t format;
+        uint16_t channels;
+        uint32_t srate;
+        uint32_t bps;
+        uint16_t balign;
+        uint16_t samp;
     };
 
     struct RIFF_Header
@@ -40,6 +41,4 @@ namespace Lumos
 
     AudioData LoadWav(const std::string& fileName);
 
-    void LoadWAVChunkInfo(std::ifstream& file, std::string& name, unsigned int& size);
-
 }
\ No newline at end of file
@@ -36,6 +36,7 @@
 #include "Audio/Sound.h"
 #include "Physics/B2PhysicsEngine/B2PhysicsEngine.h"
 #include "Physics/LumosPhysicsEngine/LumosPhysicsEngine.h"
+#include "AI/PathfindingService.h"
 #include "Embedded/EmbedAsset.h"
 
 #include "Core/DataStructures/Map.h"
@@ -204,6 +205,8 @@ namespace Lumos
                         m_SystemManager->RegisterSystem<B2PhysicsEngine>();
                         LUMOS_LOG_INFO("Initialised Physics Manager"); });
 
+        m_SystemManager->RegisterSystem<PathfindingService>();
+
         System::JobSystem::Execute(context, [this](JobDispatchArgs args)
                                    { m_SceneManager->LoadCurrentList(); });
 
@@ -362,6 +365,11 @@ namespace Lumos
     void Application::MountFileSystemPaths()
     {
         FileSystem::Get().SetAssetRoot(PushStr8Copy(m_Arena, (m_ProjectSettings.m_ProjectRoot + std::string("Assets")).c_str()));
+
+        FileSystem::Get().UnmountPaks();
+        const std::string pakPath = m_ProjectSettings.m_ProjectRoot + std::string("Assets.lpak");
+        if(FileSystem::FileExists(pakPath))
+            FileSystem::Get().MountPak(pakPath);
     }
 
     Scene* Application::GetCurrentScene() const
@@ -578,6 +586,13 @@ namespace Lumos
             LuaManager::Get().OnUpdate(m_SceneManager->GetCurrentScene());
             m_SceneManager->GetCurrentScene()->OnUpdate(dt);
         }
+
+        // Once per frame after the scene graph has signalled this frame's moves, so culling and picking see them.
+        // Runs while paused so picking follows edits
+        m_SceneManager->GetCurrentScene()->UpdateBVH();
+
+        // Also collects in edit mode, where hot reloads and editor side Lua allocate without any scripts updating
+        LuaManager::Get().StepGarbageCollector();
         m_ImGuiManager->OnUpdate(dt, m_SceneManager->GetCurrentScene());
     }
 
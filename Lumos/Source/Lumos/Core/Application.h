@@ -182,8 +182,9 @@ namespace Lumos
             int ProjectVersion;
             int8_t DesiredGPUIndex = -1;
             std::string IconPath;
-            bool DefaultIcon  = true;
-            bool HideTitleBar = false;
+            bool DefaultIcon          = true;
+            bool HideTitleBar         = false;
+            bool CompactModelVertices = false;
         };
 
         struct RenderConfig
@@ -107,16 +107,19 @@ namespace Lumos
                 std::condition_variable wakeCondition;
                 std::mutex wakeMutex;
                 std::atomic<uint32_t> nextQueue { 0 };
+                std::atomic<uint32_t> runningThreads { 0 };
                 Vector<std::thread> threads;
 
                 ~InternalState()
                 {
                     LUMOS_PROFILE_FUNCTION_LOW();
                     alive.store(false); // indicate that new jobs cannot be started from this point
-                    bool wake_loop = true;
+
+                    // Workers are detached so can't be joined. Keep waking them until every one has left its loop,
+                    // a worker that only starts waiting after the first wake would otherwise block the condition's destructor
                     std::thread waker([&]
                                       {
-                        while (wake_loop)
+                        while (runningThreads.load() > 0)
                         {
                             wakeCondition.notify_all(); // wakes up sleeping worker threads
                         } });
@@ -125,7 +128,6 @@ namespace Lumos
                         if(thread.joinable())
                             thread.join();
                     }
-                    wake_loop = false;
                     if(waker.joinable())
                         waker.join();
                 }
@@ -190,6 +192,7 @@ namespace Lumos
                 // Keep one for update thread
                 internal_state->jobQueuePerThread.reset(new JobQueue[internal_state->numThreads]);
                 internal_state->threads.Reserve(internal_state->numThreads);
+                internal_state->runningThreads.store(internal_state->numThreads);
 
                 for(uint32_t threadID = 0; threadID < internal_state->numThreads; ++threadID)
                 {
@@ -209,7 +212,9 @@ namespace Lumos
                                     std::unique_lock<std::mutex> lock(internal_state->wakeMutex);
                                     internal_state->wakeCondition.wait(lock);
 
-                                } });
+                                }
+
+                                internal_state->runningThreads.fetch_sub(1); });
 
 #ifdef LUMOS_PLATFORM_WINDOWS
                     // Do Windows-specific thread setup:
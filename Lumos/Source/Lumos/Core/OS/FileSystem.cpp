@@ -1,8 +1,120 @@
 #include "Precompiled.h"
 #include "FileSystem.h"
+#include "PakArchive.h"
+
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <thread>
 
 namespace Lumos
 {
+    struct FileSystem::AsyncReadQueue
+    {
+        struct Request
+        {
+            std::string Path;
+            ReadCallback Callback;
+        };
+
+        FileSystem* Owner;
+        std::deque<Request> Requests;
+        std::mutex Mutex;
+        std::condition_variable RequestAdded;
+        std::condition_variable ReadsFinished;
+        std::thread Thread;
+        uint32_t Pending = 0; // Queued plus the one being read
+        bool Stop        = false;
+
+        void Run()
+        {
+            std::unique_lock<std::mutex> lock(Mutex);
+            while(true)
+            {
+                RequestAdded.wait(lock, [this]
+                                  { return Stop || !Requests.empty(); });
+                if(Requests.empty())
+                    break;
+
+                Request request = std::move(Requests.front());
+                Requests.pop_front();
+                const bool stopping = Stop;
+                lock.unlock();
+
+                // Requests still queued at shutdown fail rather than being dropped, so every callback runs and
+                // nothing waiting on them hangs
+                if(stopping)
+                    request.Callback(nullptr, 0);
+                else
+                {
+                    LUMOS_PROFILE_SCOPE("Async File Read");
+                    int64_t size  = 0;
+                    uint8_t* data = Owner->ReadFileVFS(request.Path, &size);
+                    request.Callback(data, data ? size : 0);
+                }
+
+                lock.lock();
+                if(--Pending == 0)
+                    ReadsFinished.notify_all();
+            }
+        }
+    };
+
+    FileSystem::FileSystem()
+        : m_ReadQueue(new AsyncReadQueue())
+    {
+        m_ReadQueue->Owner = this;
+    }
+
+    FileSystem::~FileSystem()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_ReadQueue->Mutex);
+            m_ReadQueue->Stop = true;
+        }
+        m_ReadQueue->RequestAdded.notify_one();
+        if(m_ReadQueue->Thread.joinable())
+            m_ReadQueue->Thread.join();
+
+        delete m_ReadQueue;
+    }
+
+    void FileSystem::ReadFileAsync(const std::string& path, const ReadCallback& callback)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        {
+            std::unique_lock<std::mutex> lock(m_ReadQueue->Mutex);
+            if(m_ReadQueue->Stop)
+            {
+                lock.unlock();
+                callback(nullptr, 0);
+                return;
+            }
+
+            // Started on first use, most runs never read asynchronously
+            if(!m_ReadQueue->Thread.joinable())
+                m_ReadQueue->Thread = std::thread(&AsyncReadQueue::Run, m_ReadQueue);
+
+            m_ReadQueue->Requests.push_back({ path, callback });
+            m_ReadQueue->Pending++;
+        }
+        m_ReadQueue->RequestAdded.notify_one();
+    }
+
+    void FileSystem::WaitForAsyncReads()
+    {
+        LUMOS_PROFILE_FUNCTION();
+        std::unique_lock<std::mutex> lock(m_ReadQueue->Mutex);
+        m_ReadQueue->ReadsFinished.wait(lock, [this]
+                                        { return m_ReadQueue->Pending == 0; });
+    }
+
+    uint32_t FileSystem::GetPendingReadCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_ReadQueue->Mutex);
+        return m_ReadQueue->Pending;
+    }
+
     bool FileSystem::IsRelativePath(const char* path)
     {
         if(!path || path[0] == '/' || path[0] == '\\')
@@ -82,18 +194,133 @@ namespace Lumos
         return false;
     }
 
-    uint8_t* FileSystem::ReadFileVFS(const std::string& path)
+    bool FileSystem::MountPak(const std::string& physicalPath)
     {
         LUMOS_PROFILE_FUNCTION();
+        SharedPtr<PakArchive> pak = CreateSharedPtr<PakArchive>();
+        if(!pak->Open(physicalPath))
+        {
+            LUMOS_LOG_WARN("Failed to mount pak {0}", physicalPath);
+            return false;
+        }
+
+        LUMOS_LOG_INFO("Mounted pak {0} - {1} files", physicalPath, pak->GetFileCount());
+        std::lock_guard<std::mutex> lock(m_PakMutex);
+        m_Paks.push_back(pak);
+        return true;
+    }
+
+    void FileSystem::UnmountPaks()
+    {
+        // Archives still being read on the I/O thread or a job are released when that read drops its copy
+        std::vector<SharedPtr<PakArchive>> paks;
+        {
+            std::lock_guard<std::mutex> lock(m_PakMutex);
+            paks.swap(m_Paks);
+        }
+    }
+
+    uint32_t FileSystem::GetMountedPakCount() const
+    {
+        std::lock_guard<std::mutex> lock(m_PakMutex);
+        return uint32_t(m_Paks.size());
+    }
+
+    std::vector<SharedPtr<PakArchive>> FileSystem::GetMountedPaks() const
+    {
+        std::lock_guard<std::mutex> lock(m_PakMutex);
+        return m_Paks;
+    }
+
+    bool FileSystem::GetPakPath(const std::string& path, std::string& outPakPath)
+    {
+        if(path.empty())
+            return false;
+
+        std::string vfsPath = path;
+        if(!(path[0] == '/' && path.size() > 1 && path[1] == '/') && !AbsolutePathToFileSystem(path, vfsPath))
+            return false;
+
+        // Older scenes can store //Textures/... rather than //Assets/Textures/...
+        // Relative references from models, like "../Textures/Wood.png", are folded away to match the archive's paths
+        const size_t prefix = vfsPath.compare(0, 9, "//Assets/") == 0 ? 9 : 2;
+        outPakPath          = std::filesystem::path(vfsPath.substr(prefix)).lexically_normal().generic_string();
+        return !outPakPath.empty() && outPakPath.compare(0, 2, "..") != 0;
+    }
+
+    uint8_t* FileSystem::ReadFromPaks(const std::string& path, int64_t& size)
+    {
+        const std::vector<SharedPtr<PakArchive>> paks = GetMountedPaks();
+        std::string pakPath;
+        if(paks.empty() || !GetPakPath(path, pakPath))
+            return nullptr;
+
+        for(auto it = paks.rbegin(); it != paks.rend(); ++it)
+        {
+            if(uint8_t* data = (*it)->ReadFile(pakPath, size))
+                return data;
+        }
+        return nullptr;
+    }
+
+    bool FileSystem::FileExistsVFS(const std::string& path)
+    {
         std::string physicalPath;
-        return Get().ResolvePhysicalPath(path, physicalPath) ? FileSystem::ReadFile(physicalPath) : nullptr;
+        if(ResolvePhysicalPath(path, physicalPath))
+            return true;
+
+        const std::vector<SharedPtr<PakArchive>> paks = GetMountedPaks();
+        std::string pakPath;
+        if(paks.empty() || !GetPakPath(path, pakPath))
+            return false;
+
+        for(auto& pak : paks)
+        {
+            if(pak->Contains(pakPath))
+                return true;
+        }
+        return false;
+    }
+
+    uint8_t* FileSystem::ReadFileVFS(const std::string& path, int64_t* outSize)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        int64_t size  = 0;
+        uint8_t* data = nullptr;
+        std::string physicalPath;
+
+        const bool loose = m_LooseFilesOverridePaks && ResolvePhysicalPath(path, physicalPath);
+        if(!loose)
+            data = ReadFromPaks(path, size);
+
+        if(!data && (loose || (!m_LooseFilesOverridePaks && ResolvePhysicalPath(path, physicalPath))))
+        {
+            size = FileSystem::GetFileSize(physicalPath);
+            data = FileSystem::ReadFile(physicalPath);
+        }
+
+        if(outSize)
+            *outSize = data ? size : 0;
+        return data;
     }
 
     std::string FileSystem::ReadTextFileVFS(const std::string& path)
     {
         LUMOS_PROFILE_FUNCTION();
         std::string physicalPath;
-        return Get().ResolvePhysicalPath(path, physicalPath) ? FileSystem::ReadTextFile(physicalPath) : "";
+        if(m_LooseFilesOverridePaks && ResolvePhysicalPath(path, physicalPath))
+            return FileSystem::ReadTextFile(physicalPath);
+
+        int64_t size  = 0;
+        uint8_t* data = ReadFromPaks(path, size);
+        if(!data)
+            return ResolvePhysicalPath(path, physicalPath) ? FileSystem::ReadTextFile(physicalPath) : "";
+
+        // Matches ReadTextFile, which strips carriage returns
+        std::string text(reinterpret_cast<const char*>(data), size_t(size));
+        delete[] data;
+        text.erase(std::remove(text.begin(), text.end(), '\r'), text.end());
+        return text;
     }
 
     bool FileSystem::WriteFileVFS(const std::string& path, uint8_t* buffer, uint32_t size)
@@ -2,6 +2,10 @@
 #include "Core/DataStructures/Vector.h"
 #include "Utilities/TSingleton.h"
 #include "Core/String.h"
+#include "Core/Reference.h"
+
+#include <functional>
+#include <mutex>
 
 namespace Lumos
 {
@@ -13,16 +17,73 @@ namespace Lumos
         WRITE_READ
     };
 
+    // Read only view of a whole file mapped into memory. Pages are loaded on first access, so parsing
+    // straight from GetData() skips the copy into a heap buffer. Implemented in OS specific Files
+    class LUMOS_EXPORT FileView
+    {
+    public:
+        FileView() = default;
+        ~FileView();
+
+        FileView(const FileView&)            = delete;
+        FileView& operator=(const FileView&) = delete;
+
+        bool Open(const std::string& path);
+        void Close();
+
+        bool IsOpen() const { return m_Open; }
+        const uint8_t* GetData() const { return m_Data; }
+        uint64_t GetSize() const { return m_Size; }
+
+    private:
+        const uint8_t* m_Data = nullptr;
+        uint64_t m_Size       = 0;
+        bool m_Open           = false;
+#ifdef LUMOS_PLATFORM_WINDOWS
+        void* m_File    = nullptr;
+        void* m_Mapping = nullptr;
+#endif
+    };
+
+    class PakArchive;
+
     class FileSystem : public ThreadSafeSingleton<FileSystem>
     {
         friend class ThreadSafeSingleton<FileSystem>;
 
     public:
+        // Data is null if the read failed, otherwise the callback owns it and frees it with delete[]
+        typedef std::function<void(uint8_t* data, int64_t size)> ReadCallback;
+
+        FileSystem();
+        ~FileSystem();
+
+        // Reads a whole file through ReadFileVFS on the I/O thread. The callback also runs on the I/O thread,
+        // so it should hand heavy work like decoding to the job system rather than stall other reads.
+        // Reads still queued when the file system shuts down call back with null data
+        void ReadFileAsync(const std::string& path, const ReadCallback& callback);
+
+        // Blocks until every queued read has completed and run its callback
+        void WaitForAsyncReads();
+        uint32_t GetPendingReadCount() const;
+
         bool ResolvePhysicalPath(const std::string& path, std::string& outPhysicalPath, bool folder = false);
         bool AbsolutePathToFileSystem(const std::string& path, std::string& outFileSystemPath, bool folder = false);
         std::string AbsolutePathToFileSystem(const std::string& path, bool folder = false);
 
-        uint8_t* ReadFileVFS(const std::string& path);
+        // Archives built by PakArchive::Build from the asset folder serve //Assets paths, and asset paths given
+        // physically, to the VFS reads below. Later mounts take precedence. Safe to call while reads are in
+        // flight, reads already started keep the paks they began with alive until they finish
+        bool MountPak(const std::string& physicalPath);
+        void UnmountPaks();
+        uint32_t GetMountedPakCount() const;
+
+        // Loose files win over packed ones so edited assets don't need a repack. Off by default in production
+        void SetLooseFilesOverridePaks(bool value) { m_LooseFilesOverridePaks = value; }
+        bool GetLooseFilesOverridePaks() const { return m_LooseFilesOverridePaks; }
+
+        bool FileExistsVFS(const std::string& path);
+        uint8_t* ReadFileVFS(const std::string& path, int64_t* outSize = nullptr);
         std::string ReadTextFileVFS(const std::string& path);
 
         bool WriteFileVFS(const std::string& path, uint8_t* buffer, uint32_t size);
@@ -31,7 +92,24 @@ namespace Lumos
         void SetAssetRoot(String8 root) { m_AssetRootPath = root; };
 
     private:
+        struct AsyncReadQueue;
+
+        // Path inside the mounted paks, false if the path isn't under the asset root
+        bool GetPakPath(const std::string& path, std::string& outPakPath);
+        uint8_t* ReadFromPaks(const std::string& path, int64_t& size);
+
+        // Copy of the mounted paks taken under m_PakMutex, so readers never walk m_Paks while it changes
+        std::vector<SharedPtr<PakArchive>> GetMountedPaks() const;
+
         String8 m_AssetRootPath;
+        AsyncReadQueue* m_ReadQueue = nullptr;
+        std::vector<SharedPtr<PakArchive>> m_Paks;
+        mutable std::mutex m_PakMutex;
+#ifdef LUMOS_PRODUCTION
+        bool m_LooseFilesOverridePaks = false;
+#else
+        bool m_LooseFilesOverridePaks = true;
+#endif
 
     public:
         // Static Helpers. Implemented in OS specific Files
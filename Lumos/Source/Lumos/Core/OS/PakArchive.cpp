@@ -0,0 +1,335 @@
+#include "Precompiled.h"
+#include "PakArchive.h"
+#include "Utilities/Hash.h"
+
+#include <ModelLoaders/OpenFBX/miniz.h>
+#include <filesystem>
+#include <fstream>
+
+namespace Lumos
+{
+    // Seed for path hashes, changing it invalidates built archives along with Version
+    static const uint64_t PakPathSeed = 0x9E3779B97F4A7C15ull;
+
+    // Compressed entries are only kept if they come out at most this fraction of the original size
+    static const float PakMinCompressionRatio = 0.95f;
+
+    struct PakArchive::Header
+    {
+        uint32_t Magic;
+        uint32_t Version;
+        uint32_t EntryCount;
+        uint32_t TableSize; // Power of two, at least twice the entry count
+        uint64_t EntriesOffset;
+        uint64_t TableOffset;
+        uint64_t PathTableOffset;
+        uint64_t PathTableSize;
+    };
+
+    struct PakArchive::Entry
+    {
+        uint64_t PathHash;
+        uint64_t Offset;
+        uint64_t StoredSize;
+        uint64_t Size;
+        uint32_t PathOffset;
+        uint32_t PathLength;
+        uint32_t Compressed;
+        uint32_t Padding;
+    };
+
+    static uint64_t HashPakPath(const std::string& path)
+    {
+        return MurmurHash64A(path.data(), int(path.size()), PakPathSeed);
+    }
+
+    bool PakArchive::Open(const std::string& path)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        Close();
+
+        if(!m_File.Open(path) || m_File.GetSize() < sizeof(Header))
+        {
+            m_File.Close();
+            return false;
+        }
+
+        const uint8_t* data  = m_File.GetData();
+        const uint64_t size  = m_File.GetSize();
+        const Header* header = reinterpret_cast<const Header*>(data);
+
+        // The table has to keep empty slots for FindEntry's probe to end
+        bool valid = header->Magic == Magic && header->Version == Version && header->TableSize > 0 && (header->TableSize & (header->TableSize - 1)) == 0
+                     && uint64_t(header->TableSize) >= uint64_t(header->EntryCount) * 2
+                     && header->EntriesOffset + uint64_t(header->EntryCount) * sizeof(Entry) <= size
+                     && header->TableOffset + uint64_t(header->TableSize) * sizeof(uint32_t) <= size
+                     && header->PathTableOffset + header->PathTableSize <= size;
+
+        const Entry* entries = reinterpret_cast<const Entry*>(data + header->EntriesOffset);
+        for(uint32_t i = 0; valid && i < header->EntryCount; i++)
+        {
+            const Entry& entry = entries[i];
+            valid              = uint64_t(entry.PathOffset) + entry.PathLength <= header->PathTableSize
+                                 && entry.Offset <= size && entry.StoredSize <= size - entry.Offset
+                                 && (entry.Compressed || entry.StoredSize == entry.Size);
+        }
+
+        if(!valid)
+        {
+            LUMOS_LOG_WARN("Invalid pak archive {0}", path);
+            m_File.Close();
+            return false;
+        }
+
+        m_Header      = header;
+        m_Entries     = entries;
+        m_Table       = reinterpret_cast<const uint32_t*>(data + header->TableOffset);
+        m_PathTable   = reinterpret_cast<const char*>(data + header->PathTableOffset);
+        m_ArchivePath = path;
+        return true;
+    }
+
+    void PakArchive::Close()
+    {
+        m_File.Close();
+        m_Header    = nullptr;
+        m_Entries   = nullptr;
+        m_Table     = nullptr;
+        m_PathTable = nullptr;
+        m_ArchivePath.clear();
+    }
+
+    const PakArchive::Entry* PakArchive::FindEntry(const std::string& path) const
+    {
+        if(!m_Header)
+            return nullptr;
+
+        const uint64_t hash = HashPakPath(path);
+        const uint32_t mask = m_Header->TableSize - 1;
+
+        // Slots hold entry index + 1, zero ends the probe. Open checks the table has free slots, the probe count
+        // is bounded anyway so a corrupt table can't loop forever
+        uint32_t slot = uint32_t(hash) & mask;
+        for(uint32_t probe = 0; probe < m_Header->TableSize; probe++, slot = (slot + 1) & mask)
+        {
+            const uint32_t index = m_Table[slot];
+            if(index == 0 || index > m_Header->EntryCount)
+                return nullptr;
+
+            const Entry& entry = m_Entries[index - 1];
+            if(entry.PathHash == hash && entry.PathLength == path.size() && memcmp(m_PathTable + entry.PathOffset, path.data(), path.size()) == 0)
+                return &entry;
+        }
+
+        return nullptr;
+    }
+
+    bool PakArchive::Contains(const std::string& path) const
+    {
+        return FindEntry(path) != nullptr;
+    }
+
+    int64_t PakArchive::GetFileSize(const std::string& path) const
+    {
+        const Entry* entry = FindEntry(path);
+        return entry ? int64_t(entry->Size) : -1;
+    }
+
+    uint8_t* PakArchive::ReadFile(const std::string& path, int64_t& size) const
+    {
+        LUMOS_PROFILE_FUNCTION();
+        size               = 0;
+        const Entry* entry = FindEntry(path);
+        if(!entry)
+            return nullptr;
+
+        const uint8_t* stored = m_File.GetData() + entry->Offset;
+        uint8_t* data         = new uint8_t[entry->Size > 0 ? entry->Size : 1];
+
+        if(entry->Compressed)
+        {
+            mz_ulong length = mz_ulong(entry->Size);
+            if(mz_uncompress(data, &length, stored, mz_ulong(entry->StoredSize)) != MZ_OK || length != entry->Size)
+            {
+                LUMOS_LOG_ERROR("Failed to decompress {0} from {1}", path, m_ArchivePath);
+                delete[] data;
+                return nullptr;
+            }
+        }
+        else
+            memcpy(data, stored, entry->Size);
+
+        size = int64_t(entry->Size);
+        return data;
+    }
+
+    const uint8_t* PakArchive::GetMappedFile(const std::string& path, uint64_t& size) const
+    {
+        const Entry* entry = FindEntry(path);
+        if(!entry || entry->Compressed)
+            return nullptr;
+
+        size = entry->Size;
+        return m_File.GetData() + entry->Offset;
+    }
+
+    uint32_t PakArchive::GetFileCount() const
+    {
+        return m_Header ? m_Header->EntryCount : 0;
+    }
+
+    std::string PakArchive::GetFilePath(uint32_t index) const
+    {
+        if(index >= GetFileCount())
+            return std::string();
+
+        return std::string(m_PathTable + m_Entries[index].PathOffset, m_Entries[index].PathLength);
+    }
+
+    bool PakArchive::Build(const std::string& folder, const std::string& outputPath, bool compress)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        std::error_code error;
+        if(!std::filesystem::is_directory(folder, error))
+        {
+            LUMOS_LOG_ERROR("Can't build pak, {0} is not a folder", folder);
+            return false;
+        }
+
+        // Written to a temporary file and renamed over the output at the end, so a failed build keeps the old
+        // archive. The archive may be written inside the folder it packs
+        const std::string tempPath              = outputPath + ".tmp";
+        const std::filesystem::path output     = std::filesystem::absolute(outputPath, error);
+        const std::filesystem::path tempOutput = std::filesystem::absolute(tempPath, error);
+        std::vector<std::string> paths;
+        for(auto& file : std::filesystem::recursive_directory_iterator(folder, error))
+        {
+            if(!file.is_regular_file())
+                continue;
+
+            const std::filesystem::path absolutePath = std::filesystem::absolute(file.path(), error);
+            if(absolutePath == output || absolutePath == tempOutput)
+                continue;
+
+            std::string path = std::filesystem::relative(file.path(), folder, error).generic_string();
+            if(!path.empty())
+                paths.push_back(path);
+        }
+        std::sort(paths.begin(), paths.end());
+
+        std::ofstream stream(tempPath, std::ios::binary | std::ios::trunc);
+        if(!stream)
+        {
+            LUMOS_LOG_ERROR("Can't write pak {0}", tempPath);
+            return false;
+        }
+
+        Header header     = {};
+        header.Magic      = Magic;
+        header.Version    = Version;
+        header.EntryCount = uint32_t(paths.size());
+        header.TableSize  = 16;
+        while(header.TableSize < header.EntryCount * 2)
+            header.TableSize *= 2;
+
+        // Header is rewritten once the offsets are known
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+
+        std::vector<Entry> entries(paths.size());
+        std::string pathTable;
+        uint64_t offset      = sizeof(Header);
+        uint64_t totalSize   = 0;
+        uint64_t totalStored = 0;
+        std::vector<uint8_t> compressed;
+
+        for(size_t i = 0; i < paths.size(); i++)
+        {
+            const std::string physicalPath = (std::filesystem::path(folder) / paths[i]).string();
+
+            FileView source;
+            if(!source.Open(physicalPath))
+            {
+                LUMOS_LOG_ERROR("Can't read {0} while building pak", physicalPath);
+                stream.close();
+                std::filesystem::remove(tempPath, error);
+                return false;
+            }
+
+            Entry& entry     = entries[i];
+            entry            = {};
+            entry.PathHash   = HashPakPath(paths[i]);
+            entry.PathOffset = uint32_t(pathTable.size());
+            entry.PathLength = uint32_t(paths[i].size());
+            entry.Offset     = offset;
+            entry.Size       = source.GetSize();
+            pathTable += paths[i];
+
+            const uint8_t* stored = source.GetData();
+            entry.StoredSize      = entry.Size;
+
+            if(compress && entry.Size > 0)
+            {
+                mz_ulong length = mz_compressBound(mz_ulong(entry.Size));
+                compressed.resize(length);
+                if(mz_compress2(compressed.data(), &length, source.GetData(), mz_ulong(entry.Size), MZ_DEFAULT_LEVEL) == MZ_OK
+                   && float(length) <= float(entry.Size) * PakMinCompressionRatio)
+                {
+                    stored           = compressed.data();
+                    entry.StoredSize = length;
+                    entry.Compressed = 1;
+                }
+            }
+
+            stream.write(reinterpret_cast<const char*>(stored), std::streamsize(entry.StoredSize));
+            offset += entry.StoredSize;
+            totalSize += entry.Size;
+            totalStored += entry.StoredSize;
+        }
+
+        std::vector<uint32_t> table(header.TableSize, 0);
+        for(uint32_t i = 0; i < header.EntryCount; i++)
+        {
+            uint32_t slot = uint32_t(entries[i].PathHash) & (header.TableSize - 1);
+            while(table[slot] != 0)
+                slot = (slot + 1) & (header.TableSize - 1);
+            table[slot] = i + 1;
+        }
+
+        // Keep the tables 8 byte aligned so they can be read in place from the mapping
+        const uint64_t padding = (8 - offset % 8) % 8;
+        const char zeros[8]    = {};
+        stream.write(zeros, std::streamsize(padding));
+        offset += padding;
+
+        header.EntriesOffset   = offset;
+        header.TableOffset     = header.EntriesOffset + entries.size() * sizeof(Entry);
+        header.PathTableOffset = header.TableOffset + table.size() * sizeof(uint32_t);
+        header.PathTableSize   = pathTable.size();
+
+        stream.write(reinterpret_cast<const char*>(entries.data()), std::streamsize(entries.size() * sizeof(Entry)));
+        stream.write(reinterpret_cast<const char*>(table.data()), std::streamsize(table.size() * sizeof(uint32_t)));
+        stream.write(pathTable.data(), std::streamsize(pathTable.size()));
+
+        stream.seekp(0);
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+        stream.close();
+        if(!stream)
+        {
+            LUMOS_LOG_ERROR("Failed writing pak {0}", tempPath);
+            std::filesystem::remove(tempPath, error);
+            return false;
+        }
+
+        // Fails on Windows while the old archive is still mapped, so unmount it before building
+        std::filesystem::rename(tempPath, outputPath, error);
+        if(error)
+        {
+            LUMOS_LOG_ERROR("Can't replace pak {0} : {1}", outputPath, error.message());
+            std::filesystem::remove(tempPath, error);
+            return false;
+        }
+
+        LUMOS_LOG_INFO("Built pak {0} : {1} files, {2} KB packed to {3} KB", outputPath, header.EntryCount, totalSize / 1024, totalStored / 1024);
+        return true;
+    }
+}
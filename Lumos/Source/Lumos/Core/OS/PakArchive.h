@@ -0,0 +1,53 @@
+#pragma once
+#include "FileSystem.h"
+
+namespace Lumos
+{
+    // Read only archive of a whole asset folder. Entries are stored sorted by path, so loading a folder's files
+    // reads forwards through the archive, and found through an open addressed table of path hashes.
+    // The archive is mapped rather than read, uncompressed entries can be used without copying
+    class LUMOS_EXPORT PakArchive
+    {
+    public:
+        static const uint32_t Magic   = 0x4B41504C; // LPAK
+        static const uint32_t Version = 1;
+
+        PakArchive()  = default;
+        ~PakArchive() = default;
+
+        bool Open(const std::string& path);
+        void Close();
+        bool IsOpen() const { return m_Header != nullptr; }
+
+        // Paths are relative to the packed folder with '/' separators, e.g. "Textures/Ground.png"
+        bool Contains(const std::string& path) const;
+        int64_t GetFileSize(const std::string& path) const;
+
+        // Decompresses if needed. Null if the path isn't in the archive, otherwise free with delete[]
+        uint8_t* ReadFile(const std::string& path, int64_t& size) const;
+
+        // Points into the mapped archive, so only valid while it's open. Null for compressed entries
+        const uint8_t* GetMappedFile(const std::string& path, uint64_t& size) const;
+
+        uint32_t GetFileCount() const;
+        std::string GetFilePath(uint32_t index) const;
+        const std::string& GetArchivePath() const { return m_ArchivePath; }
+
+        // Packs every file under folder. Entries that don't shrink by compressing, like images and audio, are stored as is
+        static bool Build(const std::string& folder, const std::string& outputPath, bool compress = true);
+
+    private:
+        struct Header;
+        struct Entry;
+
+        const Entry* FindEntry(const std::string& path) const;
+
+        FileView m_File;
+        std::string m_ArchivePath;
+
+        const Header* m_Header  = nullptr;
+        const Entry* m_Entries  = nullptr;
+        const uint32_t* m_Table = nullptr;
+        const char* m_PathTable = nullptr;
+    };
+}
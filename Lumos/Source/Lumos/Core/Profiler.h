@@ -21,6 +21,7 @@
 #define LUMOS_PROFILE_LOCKMARKER(var) LockMark(var)
 #define LUMOS_PROFILE_SETTHREADNAME(name) tracy::SetThreadName(name)
 #define LUMOS_PROFILE_MESSAGE(txt, len) TracyMessage(txt, len)
+#define LUMOS_PROFILE_PLOT(name, value) TracyPlot(name, value)
 #if LUMOS_PROFILE_LOW
 #define LUMOS_PROFILE_FUNCTION_LOW() ZoneScoped
 #define LUMOS_PROFILE_SCOPE_LOW(name) ZoneScopedN(name)
@@ -39,4 +40,5 @@
 #define LUMOS_PROFILE_FUNCTION_LOW()
 #define LUMOS_PROFILE_SCOPE_LOW(name)
 #define LUMOS_PROFILE_MESSAGE(txt, len)
+#define LUMOS_PROFILE_PLOT(name, value)
 #endif
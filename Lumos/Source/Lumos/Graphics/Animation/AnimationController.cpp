@@ -2,10 +2,7 @@
 #include "Skeleton.h"
 #include "AnimationController.h"
 #include "Graphics/Renderers/DebugRenderer.h"
-#include "Graphics/RHI/DescriptorSet.h"
-#include "Graphics/RHI/Shader.h"
-#include "Core/Application.h"
-#include "Utilities/AssetManager.h"
+#include "Maths/MathsUtilities.h"
 
 #include <ozz/animation/offline/raw_skeleton.h>
 #include <ozz/animation/offline/skeleton_builder.h>
@@ -14,6 +11,8 @@
 #include <ozz/animation/runtime/animation.h>
 #include <ozz/animation/runtime/local_to_model_job.h>
 #include <ozz/animation/runtime/sampling_job.h>
+#include <ozz/animation/runtime/skeleton_utils.h>
+#include <ozz/base/maths/transform.h>
 #include <ozz/base/span.h>
 
 #define GLM_ENABLE_EXPERIMENTAL
@@ -82,6 +81,8 @@ namespace Lumos
             {
                 m_Size = size;
                 m_Context.Resize(size);
+                for(auto& sampler : m_ClipSamplers)
+                    sampler->Context.Resize(size);
                 LocalTranslations.resize(size);
                 LocalScales.resize(size);
                 LocalRotations.resize(size);
@@ -94,9 +95,27 @@ namespace Lumos
             {
                 m_SaoSize = size;
                 m_LocalSpaceSoaTransforms.resize(size);
+                m_BlendScratch.resize(size);
+                for(auto& sampler : m_ClipSamplers)
+                    sampler->Transforms.resize(size);
             }
         }
 
+        SamplingContext::ClipSampler& SamplingContext::getClipSampler(size_t index)
+        {
+            while(m_ClipSamplers.size() <= index)
+            {
+                m_ClipSamplers.push_back(CreateUniquePtr<ClipSampler>());
+                m_ClipSamplers.back()->Context.Resize(m_Size);
+                m_ClipSamplers.back()->Transforms.resize(m_SaoSize);
+            }
+
+            auto& sampler = *m_ClipSamplers[index];
+            if(sampler.Context.max_tracks() < (int)m_Size)
+                sampler.Context.Resize(m_Size);
+            return sampler;
+        }
+
         AnimationController::AnimationController()
         {
         }
@@ -109,12 +128,23 @@ namespace Lumos
         {
         }
 
-        void AnimationController::Update(float& animationTime, SamplingContext& context)
+        void AnimationController::Update(float& animationTime, SamplingContext& context, float deltaTime)
         {
             LUMOS_PROFILE_FUNCTION();
             if(m_AnimationStates.empty())
                 return;
-            m_JointWorldMats = ozz::vector<ozz::math::Float4x4>();
+
+            if(m_TransitionDuration > 0.0f)
+            {
+                m_TransitionTime += deltaTime;
+                if(m_TransitionTime >= m_TransitionDuration)
+                {
+                    m_TransitionTime     = 0.0f;
+                    m_TransitionDuration = 0.0f;
+                }
+            }
+            else
+                evaluateTransitions(animationTime);
 
             float ratio = animationTime / m_AnimationStates[m_StateIndex]->GetAnimation().duration();
             if(ratio >= 1.0f)
@@ -125,30 +155,112 @@ namespace Lumos
 
             if(m_Skeleton.get() && m_Skeleton->IsValid())
             {
-                context.resize(m_Skeleton->GetSkeleton().num_joints());
-                context.resizeSao(m_Skeleton->GetSkeleton().num_soa_joints());
-                updateSampling(ratio, context);
+                const ozz::animation::Skeleton& skeleton = m_Skeleton->GetSkeleton();
+                const int numJoints                      = skeleton.num_joints();
+                const int lodJoints                      = updateJointLOD();
+
+                context.resize(numJoints);
+                context.resizeSao(skeleton.num_soa_joints());
+
+                // Everything that affects the blended pose. When it matches the previous update the
+                // local and model space transforms are still valid and the whole evaluation is skipped.
+                auto& key = context.m_PendingKey;
+                key.clear();
+                key.push_back((float)m_GraphVersion);
+                key.push_back((float)m_JointLOD);
+                key.push_back((float)m_StateIndex);
+                key.push_back(ratio);
+                if(IsTransitioning())
+                {
+                    key.push_back((float)m_PreviousStateIndex);
+                    key.push_back(getStateRatio(m_PreviousStateIndex, animationTime));
+                    key.push_back(m_TransitionTime / m_TransitionDuration);
+                }
 
-                if(m_JointWorldMats.size() != m_Skeleton->GetSkeleton().num_joints())
-                    m_JointWorldMats.resize(m_Skeleton->GetSkeleton().num_joints());
+                for(const auto& layer : m_Layers)
+                {
+                    key.push_back(layer.Weight);
+                    if(layer.Weight <= 0.0f)
+                        continue;
+
+                    size_t states[2];
+                    float weights[2];
+                    size_t count = 0;
+                    evaluateBlendTree(layer, states, weights, count);
+                    for(size_t i = 0; i < count; i++)
+                    {
+                        key.push_back((float)states[i]);
+                        key.push_back(weights[i]);
+                        key.push_back(getStateRatio(states[i], animationTime));
+                    }
+                }
+
+                if(m_LastContext == &context && (int)m_JointWorldMats.size() == numJoints && key == context.m_EvaluationKey)
+                    return;
+
+                std::swap(context.m_EvaluationKey, context.m_PendingKey);
+                m_LastContext = &context;
+
+                evaluateLayers(animationTime, context, (lodJoints + 3) / 4);
+                updateLocalTransforms(context);
+
+                if(m_JointWorldMats.size() != size_t(numJoints))
+                    m_JointWorldMats.resize(numJoints);
 
                 // Setup local-to-model conversion job.
                 ozz::animation::LocalToModelJob ltmJob;
-                ltmJob.skeleton = &m_Skeleton->GetSkeleton();
+                ltmJob.skeleton = &skeleton;
                 ltmJob.input    = ozz::make_span(context.GetLocalTransforms());
                 ltmJob.output   = ozz::make_span(m_JointWorldMats);
+                ltmJob.to       = lodJoints - 1;
 
                 // Runs ltm job.
                 if(!ltmJob.Run())
                 {
                     LUMOS_LOG_ERROR("Failed to run ozz LocalToModelJob");
                 }
+
+                if(m_JointLOD > 0)
+                    updateCulledJoints();
             }
         }
 
         void AnimationController::SetSkeleton(const SharedPtr<Skeleton>& skeleton)
         {
             m_Skeleton = skeleton;
+            m_RestLocalMats.clear();
+            m_JointDepths.clear();
+            m_GraphVersion++;
+        }
+
+        void AnimationController::SetCurrentState(size_t index)
+        {
+            if(index == m_StateIndex)
+                return;
+
+            m_StateIndex         = index;
+            m_TransitionTime     = 0.0f;
+            m_TransitionDuration = 0.0f;
+        }
+
+        void AnimationController::CrossFade(size_t index, float duration)
+        {
+            if(index >= m_AnimationStates.size())
+            {
+                LUMOS_LOG_ERROR("Invalid animation state index {0}", index);
+                return;
+            }
+
+            if(duration <= 0.0f || index == m_StateIndex)
+            {
+                SetCurrentState(index);
+                return;
+            }
+
+            m_PreviousStateIndex = m_StateIndex;
+            m_StateIndex         = index;
+            m_TransitionTime     = 0.0f;
+            m_TransitionDuration = duration;
         }
 
         void AnimationController::SetCurrentState(const std::string& name)
@@ -157,7 +269,7 @@ namespace Lumos
             {
                 if(m_AnimationNames[i] == name)
                 {
-                    m_StateIndex = i;
+                    SetCurrentState(i);
                     return;
                 }
             }
@@ -174,30 +286,163 @@ namespace Lumos
             }
             m_AnimationNames.push_back(std::string(name));
             m_AnimationStates.push_back(animation);
+            m_GraphVersion++;
         }
 
         void AnimationController::SetState(size_t index, const std::string_view name, const SharedPtr<Animation>& animation)
         {
             m_AnimationNames[index]  = name;
             m_AnimationStates[index] = animation;
+            m_GraphVersion++;
         }
 
-        SharedPtr<DescriptorSet> AnimationController::GetDescriptorSet()
+        size_t AnimationController::AddTransition(const AnimationTransition& transition)
         {
-            LUMOS_PROFILE_FUNCTION_LOW();
-            if(!m_Descriptor)
+            if(!isValidTransition(transition))
+            {
+                LUMOS_LOG_ERROR("Invalid animation transition {0} -> {1}", transition.FromState, transition.ToState);
+                return AnimationTransition::AnyState;
+            }
+
+            m_Transitions.push_back(transition);
+            return m_Transitions.size() - 1;
+        }
+
+        void AnimationController::SetTransition(size_t index, const AnimationTransition& transition)
+        {
+            if(!isValidTransition(transition))
+            {
+                LUMOS_LOG_ERROR("Invalid animation transition {0} -> {1}", transition.FromState, transition.ToState);
+                return;
+            }
+
+            m_Transitions[index] = transition;
+        }
+
+        void AnimationController::RemoveTransition(size_t index)
+        {
+            m_Transitions.erase(m_Transitions.begin() + index);
+        }
+
+        void AnimationController::SetParameter(const std::string& name, float value)
+        {
+            for(auto& parameter : m_Parameters)
+            {
+                if(parameter.Name == name)
+                {
+                    parameter.Value = value;
+                    return;
+                }
+            }
+
+            AnimationParameter parameter;
+            parameter.Name  = name;
+            parameter.Value = value;
+            m_Parameters.push_back(parameter);
+        }
+
+        float AnimationController::GetParameter(const std::string& name) const
+        {
+            for(const auto& parameter : m_Parameters)
+            {
+                if(parameter.Name == name)
+                    return parameter.Value;
+            }
+
+            return 0.0f;
+        }
+
+        void AnimationController::RemoveParameter(const std::string& name)
+        {
+            m_Parameters.erase(std::remove_if(m_Parameters.begin(), m_Parameters.end(), [&name](const AnimationParameter& parameter)
+                                              { return parameter.Name == name; }),
+                               m_Parameters.end());
+        }
+
+        size_t AnimationController::AddLayer(const std::string_view name, AnimationBlendMode mode)
+        {
+            AnimationLayer layer;
+            layer.Name = std::string(name);
+            layer.Mode = mode;
+            m_Layers.push_back(layer);
+            m_GraphVersion++;
+            return m_Layers.size() - 1;
+        }
+
+        void AnimationController::RemoveLayer(size_t index)
+        {
+            m_Layers.erase(m_Layers.begin() + index);
+            m_GraphVersion++;
+        }
+
+        void AnimationController::AddLayerBlendState(size_t index, size_t stateIndex, float threshold)
+        {
+            if(stateIndex >= m_AnimationStates.size())
+            {
+                LUMOS_LOG_ERROR("Invalid animation state index {0}", stateIndex);
+                return;
+            }
+
+            auto& blendTree = m_Layers[index].BlendTree;
+            BlendTreeEntry entry;
+            entry.StateIndex = stateIndex;
+            entry.Threshold  = threshold;
+
+            // Kept sorted by threshold so evaluation only has to find the two neighbouring clips
+            auto it = std::upper_bound(blendTree.begin(), blendTree.end(), threshold, [](float value, const BlendTreeEntry& other)
+                                       { return value < other.Threshold; });
+            blendTree.insert(it, entry);
+            m_GraphVersion++;
+        }
+
+        void AnimationController::SetLayerBlendMode(size_t index, AnimationBlendMode mode)
+        {
+            m_Layers[index].Mode = mode;
+            m_GraphVersion++;
+        }
+
+        void AnimationController::ClearLayerBlendStates(size_t index)
+        {
+            m_Layers[index].BlendTree.clear();
+            m_GraphVersion++;
+        }
+
+        void AnimationController::SetLayerJointMask(size_t index, const std::string& jointName, float weight, bool recursive)
+        {
+            if(!m_Skeleton || !m_Skeleton->IsValid())
+                return;
+
+            const ozz::animation::Skeleton& skeleton = m_Skeleton->GetSkeleton();
+            const int joint                          = ozz::animation::FindJoint(skeleton, jointName.c_str());
+            if(joint < 0)
             {
-                Graphics::DescriptorDesc descriptorDesc {};
-                descriptorDesc.layoutIndex = 3;
-                descriptorDesc.shader      = Application::Get().GetAssetManager()->GetAssetData("ForwardPBRAnim").As<Graphics::Shader>();
-                m_Descriptor               = SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
+                LUMOS_LOG_ERROR("Failed to find joint {0} for layer mask", jointName);
+                return;
             }
 
-            auto test = GetJointMatrices();
-            m_Descriptor->SetUniform("BoneTransforms", "BoneTransforms", test.data(), (uint32_t)(sizeof(glm::mat4) * test.size()));
-            m_Descriptor->Update();
+            // Once a layer has a mask, joints that were never set are excluded from it
+            auto& layer = m_Layers[index];
+            if(layer.m_JointMask.size() != size_t(skeleton.num_joints()))
+                layer.m_JointMask.resize(skeleton.num_joints(), 0.0f);
+
+            if(recursive)
+                ozz::animation::IterateJointsDF(
+                    skeleton, [&layer, weight](int current, int)
+                    { layer.m_JointMask[current] = weight; },
+                    joint);
+            else
+                layer.m_JointMask[joint] = weight;
+
+            layer.m_MaskDirty = true;
+            m_GraphVersion++;
+        }
 
-            return m_Descriptor;
+        void AnimationController::ClearLayerJointMask(size_t index)
+        {
+            auto& layer = m_Layers[index];
+            layer.m_JointMask.clear();
+            layer.m_MaskDirty = true;
+            m_GraphVersion++;
         }
 
         std::vector<glm::mat4> AnimationController::GetJointMatrices()
@@ -219,13 +464,21 @@ namespace Lumos
             return glmMats;
         }
 
-        bool IsLeaf(const ozz::animation::Skeleton& _skeleton, int _joint)
+        uint32_t AnimationController::WriteSkinningPalette(glm::vec4* rows, uint32_t maxJoints) const
         {
-            const int num_joints = _skeleton.num_joints();
-            assert(_joint >= 0 && _joint < num_joints && "_joint index out of range");
-            const ozz::span<const int16_t>& parents = _skeleton.joint_parents();
-            const int next                          = _joint + 1;
-            return next == num_joints || parents[next] != _joint;
+            LUMOS_PROFILE_FUNCTION_LOW();
+            const uint32_t jointCount = Maths::Min((uint32_t)m_JointWorldMats.size(), maxJoints);
+
+            for(uint32_t i = 0; i < jointCount; i++)
+            {
+                // Last row of an affine matrix is implicit, the shader rebuilds it
+                const glm::mat4 skin = ConvertToGLM(m_JointWorldMats[i]) * m_BindPoses[i];
+                rows[i * 3 + 0]      = glm::vec4(skin[0][0], skin[1][0], skin[2][0], skin[3][0]);
+                rows[i * 3 + 1]      = glm::vec4(skin[0][1], skin[1][1], skin[2][1], skin[3][1]);
+                rows[i * 3 + 2]      = glm::vec4(skin[0][2], skin[1][2], skin[2][2], skin[3][2]);
+            }
+
+            return jointCount;
         }
 
         void AnimationController::DebugDraw(const glm::mat4& transform)
@@ -278,7 +531,7 @@ namespace Lumos
                 // uniform += 16;
 
                 // Only the joint is rendered for leaves, the bone model isn't.
-                if(IsLeaf(m_Skeleton->GetSkeleton(), i))
+                if(ozz::animation::IsLeaf(m_Skeleton->GetSkeleton(), i))
                 {
                     // Copy current joint's raw matrix.
                     DebugRenderer::DebugDrawSphere(0.1f, currentPos, glm::vec4(0.0f, 1.0f, 0.0f, 1.0f));
@@ -286,19 +539,275 @@ namespace Lumos
             }
         }
 
-        void AnimationController::updateSampling(float ratio, SamplingContext& context)
+        void AnimationController::sampleClip(const Animation& animation, float ratio, ozz::animation::SamplingJob::Context& samplingContext, const ozz::span<ozz::math::SoaTransform>& output)
         {
-            LUMOS_PROFILE_FUNCTION();
+            LUMOS_PROFILE_FUNCTION_LOW();
             ozz::animation::SamplingJob sampling_job;
-            sampling_job.animation = &m_AnimationStates[m_StateIndex]->GetAnimation();
-            sampling_job.context   = &context.m_Context;
+            sampling_job.animation = &animation.GetAnimation();
+            sampling_job.context   = &samplingContext;
             sampling_job.ratio     = ratio;
-            sampling_job.output    = ozz::make_span(context.m_LocalSpaceSoaTransforms);
+            sampling_job.output    = output;
             if(!sampling_job.Run())
             {
                 LUMOS_LOG_ERROR("ozz animation sampling job failed!");
             }
+        }
+
+        void AnimationController::evaluateLayers(float animationTime, SamplingContext& context, int numSoaJoints)
+        {
+            LUMOS_PROFILE_FUNCTION();
+            const ozz::animation::Skeleton& skeleton = m_Skeleton->GetSkeleton();
+
+            // Only the soa joints inside the LOD range are sampled and blended
+            const ozz::span<const ozz::math::SoaTransform> restPose(skeleton.joint_rest_poses().data(), numSoaJoints);
+            auto output  = ozz::span<ozz::math::SoaTransform>(context.m_LocalSpaceSoaTransforms.data(), numSoaJoints);
+            auto scratch = ozz::span<ozz::math::SoaTransform>(context.m_BlendScratch.data(), numSoaJoints);
+
+            size_t samplerIndex = 0;
+
+            // Base state, cross-faded with the previous one while transitioning
+            if(IsTransitioning())
+            {
+                const float alpha = m_TransitionTime / m_TransitionDuration;
+                auto& from        = context.getClipSampler(samplerIndex++);
+                auto& to          = context.getClipSampler(samplerIndex++);
+                auto fromOutput    = ozz::span<ozz::math::SoaTransform>(from.Transforms.data(), numSoaJoints);
+                auto toOutput      = ozz::span<ozz::math::SoaTransform>(to.Transforms.data(), numSoaJoints);
+                sampleClip(*m_AnimationStates[m_PreviousStateIndex], getStateRatio(m_PreviousStateIndex, animationTime), from.Context, fromOutput);
+                sampleClip(*m_AnimationStates[m_StateIndex], getStateRatio(m_StateIndex, animationTime), to.Context, toOutput);
+
+                ozz::animation::BlendingJob::Layer layers[2];
+                layers[0].transform = fromOutput;
+                layers[0].weight    = 1.0f - alpha;
+                layers[1].transform = toOutput;
+                layers[1].weight    = alpha;
+
+                ozz::animation::BlendingJob blendJob;
+                blendJob.layers    = layers;
+                blendJob.rest_pose = restPose;
+                blendJob.output    = output;
+                if(!blendJob.Run())
+                {
+                    LUMOS_LOG_ERROR("ozz animation blending job failed!");
+                }
+            }
+            else
+            {
+                sampleClip(*m_AnimationStates[m_StateIndex], getStateRatio(m_StateIndex, animationTime), context.m_Context, output);
+            }
+
+            m_AdditiveScratch.clear();
+
+            for(auto& layer : m_Layers)
+            {
+                if(layer.Weight <= 0.0f || layer.BlendTree.empty())
+                    continue;
+
+                size_t states[2];
+                float weights[2];
+                size_t count = 0;
+                evaluateBlendTree(layer, states, weights, count);
+                updateLayerWeights(layer, skeleton.num_soa_joints());
+
+                ozz::animation::BlendingJob::Layer layers[3];
+                for(size_t i = 0; i < count; i++)
+                {
+                    auto& sampler   = context.getClipSampler(samplerIndex++);
+                    auto clipOutput = ozz::span<ozz::math::SoaTransform>(sampler.Transforms.data(), numSoaJoints);
+                    sampleClip(*m_AnimationStates[states[i]], getStateRatio(states[i], animationTime), sampler.Context, clipOutput);
+
+                    auto& blendLayer         = layer.Mode == AnimationBlendMode::Additive ? m_AdditiveScratch.emplace_back() : layers[i + 1];
+                    blendLayer.transform     = clipOutput;
+                    blendLayer.weight        = weights[i];
+                    setJointWeights(blendLayer, layer.m_SoaLayerWeights);
+                }
+
+                if(layer.Mode == AnimationBlendMode::Additive)
+                    continue;
+
+                // Per joint, the pose below keeps (1 - w) and the layer's clips share w,
+                // so the accumulated weight is always one.
+                layers[0].transform     = output;
+                layers[0].weight        = 1.0f;
+                setJointWeights(layers[0], layer.m_SoaBaseWeights);
+
+                ozz::animation::BlendingJob blendJob;
+                blendJob.layers    = ozz::span<const ozz::animation::BlendingJob::Layer>(layers, count + 1);
+                blendJob.rest_pose = restPose;
+                blendJob.output    = scratch;
+                if(!blendJob.Run())
+                {
+                    LUMOS_LOG_ERROR("ozz animation blending job failed!");
+                }
+
+                std::swap(context.m_LocalSpaceSoaTransforms, context.m_BlendScratch);
+                std::swap(output, scratch);
+            }
+
+            if(!m_AdditiveScratch.empty())
+            {
+                ozz::animation::BlendingJob::Layer base;
+                base.transform = output;
+                base.weight    = 1.0f;
+
+                ozz::animation::BlendingJob blendJob;
+                blendJob.layers          = ozz::span<const ozz::animation::BlendingJob::Layer>(base);
+                blendJob.additive_layers = ozz::make_span(m_AdditiveScratch);
+                blendJob.rest_pose       = restPose;
+                blendJob.output          = scratch;
+                if(!blendJob.Run())
+                {
+                    LUMOS_LOG_ERROR("ozz animation additive blending job failed!");
+                }
+
+                std::swap(context.m_LocalSpaceSoaTransforms, context.m_BlendScratch);
+            }
+        }
+
+        void AnimationController::evaluateBlendTree(const AnimationLayer& layer, size_t outStates[2], float outWeights[2], size_t& outCount) const
+        {
+            const auto& blendTree = layer.BlendTree;
+            outCount              = 0;
+            if(blendTree.empty())
+                return;
+
+            if(blendTree.size() == 1 || layer.Parameter <= blendTree.front().Threshold)
+            {
+                outStates[0]  = blendTree.front().StateIndex;
+                outWeights[0] = 1.0f;
+                outCount      = 1;
+                return;
+            }
+
+            if(layer.Parameter >= blendTree.back().Threshold)
+            {
+                outStates[0]  = blendTree.back().StateIndex;
+                outWeights[0] = 1.0f;
+                outCount      = 1;
+                return;
+            }
+
+            size_t next = 1;
+            while(blendTree[next].Threshold < layer.Parameter)
+                next++;
+
+            const BlendTreeEntry& a = blendTree[next - 1];
+            const BlendTreeEntry& b = blendTree[next];
+            const float range       = b.Threshold - a.Threshold;
+            const float alpha       = range > 0.0f ? (layer.Parameter - a.Threshold) / range : 1.0f;
+
+            outStates[0]  = a.StateIndex;
+            outWeights[0] = 1.0f - alpha;
+            outStates[1]  = b.StateIndex;
+            outWeights[1] = alpha;
+            outCount      = 2;
+        }
+
+        void AnimationController::updateLayerWeights(AnimationLayer& layer, int numSoaJoints)
+        {
+            if(!layer.m_MaskDirty && layer.m_CachedWeight == layer.Weight && layer.m_SoaLayerWeights.size() == size_t(numSoaJoints))
+                return;
+
+            LUMOS_PROFILE_FUNCTION_LOW();
+            const float layerWeight = glm::clamp(layer.Weight, 0.0f, 1.0f);
+            layer.m_SoaLayerWeights.resize(numSoaJoints);
+            layer.m_SoaBaseWeights.resize(numSoaJoints);
+
+            for(int i = 0; i < numSoaJoints; i++)
+            {
+                float layerWeights[4];
+                float baseWeights[4];
+                for(int j = 0; j < 4; j++)
+                {
+                    const size_t joint = i * 4 + j;
+                    const float mask   = joint < layer.m_JointMask.size() ? layer.m_JointMask[joint] : (layer.m_JointMask.empty() ? 1.0f : 0.0f);
+                    layerWeights[j]    = layerWeight * mask;
+                    baseWeights[j]     = 1.0f - layerWeights[j];
+                }
+
+                layer.m_SoaLayerWeights[i].Value = ozz::math::simd_float4::LoadPtrU(layerWeights);
+                layer.m_SoaBaseWeights[i].Value  = ozz::math::simd_float4::LoadPtrU(baseWeights);
+            }
+
+            layer.m_CachedWeight = layer.Weight;
+            layer.m_MaskDirty    = false;
+        }
+
+        void AnimationController::setJointWeights(ozz::animation::BlendingJob::Layer& blendLayer, const ozz::vector<AnimationLayer::SoaJointWeights>& weights)
+        {
+            static_assert(sizeof(AnimationLayer::SoaJointWeights) == sizeof(ozz::math::SimdFloat4), "Joint weights must stay tightly packed");
+            auto data                = reinterpret_cast<const ozz::math::SimdFloat4*>(weights.data());
+            blendLayer.joint_weights = { data, data + weights.size() };
+        }
+
+        int AnimationController::updateJointLOD()
+        {
+            const ozz::animation::Skeleton& skeleton = m_Skeleton->GetSkeleton();
+            const int numJoints                      = skeleton.num_joints();
+
+            if(m_JointDepths.size() != size_t(numJoints))
+            {
+                // Parents always come before their children in ozz's depth-first joint order
+                const ozz::span<const int16_t>& parents = skeleton.joint_parents();
+                m_JointDepths.resize(numJoints);
+                for(int i = 0; i < numJoints; i++)
+                    m_JointDepths[i] = parents[i] == ozz::animation::Skeleton::kNoParent ? 0 : m_JointDepths[parents[i]] + 1;
+
+                m_CulledJoints.clear();
+            }
+
+            if(m_CulledJoints.size() != size_t(numJoints) || m_CulledJointLOD != m_JointLOD)
+            {
+                // Children are always deeper than their parent, so a culled joint never has an evaluated child.
+                // Only the prefix up to the last kept joint is sampled, culled joints inside it are overwritten afterwards.
+                m_CulledJoints.assign(numJoints, false);
+                m_CulledJointLOD  = m_JointLOD;
+                m_EvaluatedJoints = m_JointLOD > 0 ? 0 : numJoints;
+                for(int i = 0; i < numJoints; i++)
+                {
+                    if(m_JointLOD > 0 && m_JointDepths[i] >= m_JointLOD)
+                        m_CulledJoints[i] = true;
+                    else
+                        m_EvaluatedJoints = i + 1;
+                }
+            }
 
+            return m_EvaluatedJoints;
+        }
+
+        void AnimationController::updateCulledJoints()
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            const ozz::animation::Skeleton& skeleton = m_Skeleton->GetSkeleton();
+            const int numJoints                      = skeleton.num_joints();
+
+            if(m_RestLocalMats.size() != size_t(numJoints))
+            {
+                m_RestLocalMats.resize(numJoints);
+                for(int i = 0; i < numJoints; i++)
+                {
+                    const ozz::math::Transform rest = ozz::animation::GetJointLocalRestPose(skeleton, i);
+                    m_RestLocalMats[i]              = ozz::math::Float4x4::FromAffine(ozz::math::simd_float4::Load3PtrU(&rest.translation.x),
+                                                                                      ozz::math::simd_float4::LoadPtrU(&rest.rotation.x),
+                                                                                      ozz::math::simd_float4::Load3PtrU(&rest.scale.x));
+                }
+            }
+
+            // Culled joints are not evaluated, they follow their parent rigidly in rest pose
+            const ozz::span<const int16_t>& parents = skeleton.joint_parents();
+            for(int i = 0; i < numJoints; i++)
+            {
+                if(!m_CulledJoints[i])
+                    continue;
+
+                const int16_t parent = parents[i];
+                m_JointWorldMats[i]  = parent == ozz::animation::Skeleton::kNoParent ? m_RestLocalMats[i] : m_JointWorldMats[parent] * m_RestLocalMats[i];
+            }
+        }
+
+        void AnimationController::updateLocalTransforms(SamplingContext& context)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
             for(int i = 0; i < context.m_LocalSpaceSoaTransforms.size(); ++i)
             {
                 ozz::math::SimdFloat4 translations[4];
@@ -321,5 +830,72 @@ namespace Lumos
                 }
             }
         }
+
+        float AnimationController::getStateRatio(size_t stateIndex, float animationTime) const
+        {
+            const float duration = m_AnimationStates[stateIndex]->GetAnimation().duration();
+            if(duration <= 0.0f)
+                return 0.0f;
+
+            return std::fmod(animationTime, duration) / duration;
+        }
+
+        void AnimationController::evaluateTransitions(float animationTime)
+        {
+            for(const auto& transition : m_Transitions)
+            {
+                if(transition.ToState == m_StateIndex || (transition.FromState != AnimationTransition::AnyState && transition.FromState != m_StateIndex))
+                    continue;
+
+                if(transition.ExitTime > 0.0f && getStateRatio(m_StateIndex, animationTime) < transition.ExitTime)
+                    continue;
+
+                if(!transition.Parameter.empty())
+                {
+                    const float value = GetParameter(transition.Parameter);
+                    if(transition.Mode == AnimationConditionMode::Greater ? value <= transition.Threshold : value >= transition.Threshold)
+                        continue;
+                }
+
+                CrossFade(transition.ToState, transition.Duration);
+                return;
+            }
+        }
+
+        bool AnimationController::isValidTransition(const AnimationTransition& transition) const
+        {
+            const bool validFrom = transition.FromState == AnimationTransition::AnyState || transition.FromState < m_AnimationStates.size();
+            return validFrom && transition.ToState < m_AnimationStates.size();
+        }
+
+        void AnimationController::validateGraph()
+        {
+            // A loaded graph may reference states or joints the model no longer has
+            const size_t stateCount = m_AnimationStates.size();
+            if(m_StateIndex >= stateCount)
+                m_StateIndex = 0;
+
+            m_Transitions.erase(std::remove_if(m_Transitions.begin(), m_Transitions.end(), [this](const AnimationTransition& transition)
+                                               { return !isValidTransition(transition); }),
+                                m_Transitions.end());
+
+            const size_t jointCount = m_Skeleton && m_Skeleton->IsValid() ? size_t(m_Skeleton->GetSkeleton().num_joints()) : 0;
+            for(auto& layer : m_Layers)
+            {
+                layer.BlendTree.erase(std::remove_if(layer.BlendTree.begin(), layer.BlendTree.end(), [stateCount](const BlendTreeEntry& entry)
+                                                     { return entry.StateIndex >= stateCount; }),
+                                      layer.BlendTree.end());
+
+                if(!layer.m_JointMask.empty() && layer.m_JointMask.size() != jointCount)
+                {
+                    LUMOS_LOG_WARN("Joint mask of animation layer {0} doesn't match the skeleton, clearing it", layer.Name);
+                    layer.m_JointMask.clear();
+                }
+
+                layer.m_MaskDirty = true;
+            }
+
+            m_GraphVersion++;
+        }
     }
 }
@@ -2,23 +2,155 @@
 #include "Core/Reference.h"
 #include "Utilities/TimeStep.h"
 #include "Animation.h"
+#include "Scene/Serialisation/Serialisation.h"
 
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/glm.hpp>
 #include <glm/gtx/quaternion.hpp>
 
 #include <ozz/animation/runtime/animation.h>
+#include <ozz/animation/runtime/blending_job.h>
 #include <ozz/animation/runtime/sampling_job.h>
 #include <ozz/animation/runtime/skeleton.h>
 #include <ozz/base/containers/vector.h>
 #include <ozz/base/maths/soa_transform.h>
 #include <ozz/base/memory/unique_ptr.h>
 
+#include <cereal/types/string.hpp>
+#include <cereal/types/vector.hpp>
+
 namespace Lumos
 {
     namespace Graphics
     {
-        class DescriptorSet;
+
+        enum class AnimationBlendMode : uint8_t
+        {
+            Override,
+            Additive
+        };
+
+        enum class AnimationConditionMode : uint8_t
+        {
+            Greater,
+            Less
+        };
+
+        // One clip of a 1D blend tree, placed at Threshold along the layer's blend parameter.
+        struct BlendTreeEntry
+        {
+            size_t StateIndex = 0;
+            float Threshold   = 0.0f;
+
+            template <typename Archive>
+            void save(Archive& archive) const
+            {
+                archive(cereal::make_nvp("State", uint32_t(StateIndex)), cereal::make_nvp("Threshold", Threshold));
+            }
+
+            template <typename Archive>
+            void load(Archive& archive)
+            {
+                uint32_t state = 0;
+                archive(cereal::make_nvp("State", state), cereal::make_nvp("Threshold", Threshold));
+                StateIndex = state;
+            }
+        };
+
+        // Named value the state machine's transitions are evaluated against.
+        struct AnimationParameter
+        {
+            std::string Name;
+            float Value = 0.0f;
+
+            template <typename Archive>
+            void serialize(Archive& archive)
+            {
+                archive(cereal::make_nvp("Name", Name), cereal::make_nvp("Value", Value));
+            }
+        };
+
+        // Cross-fades to ToState once the current state matches FromState, the source clip has
+        // passed ExitTime (a ratio, zero for any time) and, if Parameter is set, its condition holds.
+        struct AnimationTransition
+        {
+            static constexpr size_t AnyState = ~size_t(0);
+
+            size_t FromState            = AnyState;
+            size_t ToState              = 0;
+            float Duration              = 0.25f;
+            float ExitTime              = 0.0f;
+            std::string Parameter;
+            AnimationConditionMode Mode = AnimationConditionMode::Greater;
+            float Threshold             = 0.0f;
+
+            template <typename Archive>
+            void save(Archive& archive) const
+            {
+                const uint32_t from = FromState == AnyState ? ~0u : uint32_t(FromState);
+                archive(cereal::make_nvp("From", from), cereal::make_nvp("To", uint32_t(ToState)), cereal::make_nvp("Duration", Duration), cereal::make_nvp("ExitTime", ExitTime),
+                        cereal::make_nvp("Parameter", Parameter), cereal::make_nvp("Mode", Mode), cereal::make_nvp("Threshold", Threshold));
+            }
+
+            template <typename Archive>
+            void load(Archive& archive)
+            {
+                uint32_t from = 0;
+                uint32_t to   = 0;
+                archive(cereal::make_nvp("From", from), cereal::make_nvp("To", to), cereal::make_nvp("Duration", Duration), cereal::make_nvp("ExitTime", ExitTime),
+                        cereal::make_nvp("Parameter", Parameter), cereal::make_nvp("Mode", Mode), cereal::make_nvp("Threshold", Threshold));
+                FromState = from == ~0u ? AnyState : from;
+                ToState   = to;
+            }
+        };
+
+        // A layer blends its blend tree over the result of the layers below it.
+        // Additive layers expect states built as additive (delta) animations.
+        struct AnimationLayer
+        {
+            std::string Name;
+            AnimationBlendMode Mode = AnimationBlendMode::Override;
+            float Weight            = 1.0f;
+            float Parameter         = 0.0f;
+            std::vector<BlendTreeEntry> BlendTree;
+
+            // Per joint weight in [0,1], empty means every joint is affected.
+            // Set through AnimationController::SetLayerJointMask so the cached weights are rebuilt.
+            const std::vector<float>& GetJointMask() const { return m_JointMask; }
+
+            template <typename Archive>
+            void save(Archive& archive) const
+            {
+                archive(cereal::make_nvp("Name", Name), cereal::make_nvp("Mode", Mode), cereal::make_nvp("Weight", Weight), cereal::make_nvp("Parameter", Parameter),
+                        cereal::make_nvp("BlendTree", BlendTree), cereal::make_nvp("JointMask", m_JointMask));
+            }
+
+            template <typename Archive>
+            void load(Archive& archive)
+            {
+                archive(cereal::make_nvp("Name", Name), cereal::make_nvp("Mode", Mode), cereal::make_nvp("Weight", Weight), cereal::make_nvp("Parameter", Parameter),
+                        cereal::make_nvp("BlendTree", BlendTree), cereal::make_nvp("JointMask", m_JointMask));
+                m_MaskDirty = true;
+            }
+
+        private:
+            // Wraps the SIMD type so the vectors below don't drop its alignment attributes.
+            struct SoaJointWeights
+            {
+                ozz::math::SimdFloat4 Value;
+            };
+
+            std::vector<float> m_JointMask;
+
+            // Soa joint weights for the layer and for the pose it is blended over,
+            // rebuilt only when Weight or the joint mask change.
+            ozz::vector<SoaJointWeights> m_SoaLayerWeights;
+            ozz::vector<SoaJointWeights> m_SoaBaseWeights;
+            float m_CachedWeight = -1.0f;
+            bool m_MaskDirty     = true;
+
+            friend class AnimationController;
+        };
 
         struct SamplingContext
         {
@@ -37,12 +169,26 @@ namespace Lumos
             const ozz::vector<ozz::math::SoaTransform>& GetLocalTransforms() const { return m_LocalSpaceSoaTransforms; }
 
         private:
+            // Scratch for every additional clip sampled in the same update (cross-fades, blend trees).
+            struct ClipSampler
+            {
+                ozz::animation::SamplingJob::Context Context;
+                ozz::vector<ozz::math::SoaTransform> Transforms;
+            };
+
             void resize(uint32_t size);
             void resizeSao(uint32_t size);
+            ClipSampler& getClipSampler(size_t index);
 
         private:
             ozz::animation::SamplingJob::Context m_Context;
             ozz::vector<ozz::math::SoaTransform> m_LocalSpaceSoaTransforms;
+            ozz::vector<ozz::math::SoaTransform> m_BlendScratch;
+            std::vector<UniquePtr<ClipSampler>> m_ClipSamplers;
+
+            // Inputs of the last evaluation, the blended pose is reused while they are unchanged.
+            std::vector<float> m_EvaluationKey;
+            std::vector<float> m_PendingKey;
 
             uint32_t m_SaoSize = 0;
             uint32_t m_Size    = 0;
@@ -61,29 +207,97 @@ namespace Lumos
 
             virtual ~AnimationController();
 
-            void Update(float& animationTime, SamplingContext& context);
+            void Update(float& animationTime, SamplingContext& context, float deltaTime = 0.0f);
 
             void SetSkeleton(const SharedPtr<Skeleton>& skeleton);
-            void SetCurrentState(size_t index) { m_StateIndex = index; };
+            void SetCurrentState(size_t index);
             void SetCurrentState(const std::string& name);
+            void CrossFade(size_t index, float duration);
             void AddState(const std::string_view name, const SharedPtr<Animation>& animation);
             void SetState(size_t index, const std::string_view name, const SharedPtr<Animation>& animation);
 
             size_t GetCurrentState() const { return m_StateIndex; }
+            bool IsTransitioning() const { return m_TransitionDuration > 0.0f; }
+
+            // State machine, checked in order on every update that isn't already cross-fading
+            size_t AddTransition(const AnimationTransition& transition);
+            void SetTransition(size_t index, const AnimationTransition& transition);
+            void RemoveTransition(size_t index);
+            const std::vector<AnimationTransition>& GetTransitions() const { return m_Transitions; }
+
+            void SetParameter(const std::string& name, float value);
+            float GetParameter(const std::string& name) const;
+            void RemoveParameter(const std::string& name);
+            const std::vector<AnimationParameter>& GetParameters() const { return m_Parameters; }
+
+            size_t AddLayer(const std::string_view name, AnimationBlendMode mode = AnimationBlendMode::Override);
+            void RemoveLayer(size_t index);
+            // Layers only change through the setters below so a cached pose is never reused after an edit
+            const AnimationLayer& GetLayer(size_t index) const { return m_Layers[index]; }
+            const std::vector<AnimationLayer>& GetLayers() const { return m_Layers; }
+            void SetLayerName(size_t index, const std::string_view name) { m_Layers[index].Name = std::string(name); }
+            void SetLayerWeight(size_t index, float weight) { m_Layers[index].Weight = weight; }
+            void SetLayerParameter(size_t index, float parameter) { m_Layers[index].Parameter = parameter; }
+            void SetLayerBlendMode(size_t index, AnimationBlendMode mode);
+            void AddLayerBlendState(size_t index, size_t stateIndex, float threshold);
+            void ClearLayerBlendStates(size_t index);
+
+            // Sets the mask weight of a joint, and of all its children when recursive is true.
+            void SetLayerJointMask(size_t index, const std::string& jointName, float weight, bool recursive = true);
+            void ClearLayerJointMask(size_t index);
+
+            // Joints more than depth levels below a root are not blended and follow their parent
+            // in rest pose, so whole limbs keep their upper joints. Zero evaluates the full skeleton.
+            void SetJointLOD(uint32_t depth) { m_JointLOD = depth; }
+            uint32_t GetJointLOD() const { return m_JointLOD; }
 
             const SharedPtr<Skeleton>& GetSkeleton() const { return m_Skeleton; }
             const std::vector<std::string>& GetStateNames() const { return m_AnimationNames; }
             const std::vector<SharedPtr<Animation>>& GetAnimationStates() const { return m_AnimationStates; }
-            SharedPtr<DescriptorSet> GetDescriptorSet();
 
             static AssetType GetStaticType() { return AssetType::AnimationController; }
             virtual AssetType GetAssetType() const override { return GetStaticType(); }
 
             std::vector<glm::mat4> GetJointMatrices();
+
+            // Writes up to maxJoints skinning matrices as three transposed rows each, returns the joint count written
+            uint32_t WriteSkinningPalette(glm::vec4* rows, uint32_t maxJoints) const;
             void DebugDraw(const glm::mat4& transform);
 
+            // Only the graph is stored, states come from the model the controller is created for
+            template <typename Archive>
+            void save(Archive& archive) const
+            {
+                archive(cereal::make_nvp("State", uint32_t(m_StateIndex)), cereal::make_nvp("JointLOD", m_JointLOD), cereal::make_nvp("Parameters", m_Parameters),
+                        cereal::make_nvp("Transitions", m_Transitions), cereal::make_nvp("Layers", m_Layers));
+            }
+
+            template <typename Archive>
+            void load(Archive& archive)
+            {
+                uint32_t state = 0;
+                archive(cereal::make_nvp("State", state), cereal::make_nvp("JointLOD", m_JointLOD), cereal::make_nvp("Parameters", m_Parameters),
+                        cereal::make_nvp("Transitions", m_Transitions), cereal::make_nvp("Layers", m_Layers));
+
+                m_StateIndex         = state;
+                m_TransitionTime     = 0.0f;
+                m_TransitionDuration = 0.0f;
+                validateGraph();
+            }
+
         private:
-            void updateSampling(float ratio, SamplingContext& context);
+            void sampleClip(const Animation& animation, float ratio, ozz::animation::SamplingJob::Context& samplingContext, const ozz::span<ozz::math::SoaTransform>& output);
+            void evaluateLayers(float animationTime, SamplingContext& context, int numSoaJoints);
+            void evaluateBlendTree(const AnimationLayer& layer, size_t outStates[2], float outWeights[2], size_t& outCount) const;
+            void updateLayerWeights(AnimationLayer& layer, int numSoaJoints);
+            static void setJointWeights(ozz::animation::BlendingJob::Layer& blendLayer, const ozz::vector<AnimationLayer::SoaJointWeights>& weights);
+            void updateLocalTransforms(SamplingContext& context);
+            int updateJointLOD();
+            void updateCulledJoints();
+            float getStateRatio(size_t stateIndex, float animationTime) const;
+            void evaluateTransitions(float animationTime);
+            bool isValidTransition(const AnimationTransition& transition) const;
+            void validateGraph();
 
         private:
             SharedPtr<Skeleton> m_Skeleton;
@@ -94,9 +308,23 @@ namespace Lumos
             std::vector<glm::mat4> m_BindPoses;
             ozz::vector<uint16_t> m_JointRemap;
 
-            SharedPtr<DescriptorSet> m_Descriptor;
+            std::vector<AnimationParameter> m_Parameters;
+            std::vector<AnimationTransition> m_Transitions;
+            std::vector<AnimationLayer> m_Layers;
+            std::vector<ozz::animation::BlendingJob::Layer> m_AdditiveScratch;
+            ozz::vector<ozz::math::Float4x4> m_RestLocalMats;
+            std::vector<uint16_t> m_JointDepths;
+            std::vector<bool> m_CulledJoints;
+            uint32_t m_CulledJointLOD = 0;
+            int m_EvaluatedJoints     = 0;
+            const SamplingContext* m_LastContext = nullptr;
 
-            size_t m_StateIndex = 0;
+            size_t m_StateIndex         = 0;
+            size_t m_PreviousStateIndex = 0;
+            float m_TransitionTime      = 0.0f;
+            float m_TransitionDuration  = 0.0f;
+            uint32_t m_JointLOD         = 0;
+            uint32_t m_GraphVersion     = 0;
         };
     }
 }
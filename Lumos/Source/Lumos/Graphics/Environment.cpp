@@ -85,8 +85,7 @@ namespace Lumos
                         if(currHeight < 1 || currWidth < 1)
                             break;
 
-                        std::string newPath;
-                        if(!FileSystem::Get().ResolvePhysicalPath(envFiles[i], newPath))
+                        if(!FileSystem::Get().FileExistsVFS(envFiles[i]))
                         {
                             LUMOS_LOG_ERROR("Failed to load {0}", envFiles[i]);
                             failed = true;
@@ -109,8 +108,7 @@ namespace Lumos
                         if(currHeight < 1 || currWidth < 1)
                             break;
 
-                        std::string newPath;
-                        if(!FileSystem::Get().ResolvePhysicalPath(irrFiles[i], newPath))
+                        if(!FileSystem::Get().FileExistsVFS(irrFiles[i]))
                         {
                             LUMOS_LOG_ERROR("Failed to load {0}", irrFiles[i]);
                             failed = true;
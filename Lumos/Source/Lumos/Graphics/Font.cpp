@@ -6,6 +6,7 @@
 #include "RHI/Texture.h"
 #include "Core/OS/FileSystem.h"
 #include "Core/Application.h"
+#include "Utilities/StringUtilities.h"
 
 #if __has_include(<filesystem>)
 #include <filesystem>
@@ -214,6 +215,11 @@ namespace Lumos
 
             // Load fonts
             bool anyCodepointsAvailable = false;
+
+            // Font file read through the VFS. FreeType reads from it until the face is destroyed, so it's declared
+            // before the holder to outlive it
+            std::vector<uint8_t> fileData;
+
             class FontHolder
             {
                 msdfgen::FreetypeHandle* ft;
@@ -275,17 +281,18 @@ namespace Lumos
 
             if(m_FontDataSize == 0)
             {
-                std::string outPath;
-                if(!FileSystem::Get().ResolvePhysicalPath(m_FilePath, outPath))
+                int64_t fileSize = 0;
+                uint8_t* data    = FileSystem::Get().ReadFileVFS(m_FilePath, &fileSize);
+                if(!data)
                     return;
 
                 FONT_LOG("Font: Loading Font {0}", m_FilePath);
-                fontInput.fontFilename = outPath.c_str();
-                m_FilePath             = outPath;
+                fileData.assign(data, data + fileSize);
+                delete[] data;
 
-                if(!font.load(fontInput.fontFilename))
+                if(!font.load(fileData.data(), uint32_t(fileData.size())))
                 {
-                    FONT_LOG("Font: Failed to load font! - {0}", fontInput.fontFilename);
+                    FONT_LOG("Font: Failed to load font! - {0}", m_FilePath);
                     return;
                 }
             }
@@ -403,7 +410,8 @@ namespace Lumos
                 }
             }
 
-            std::string fontName = m_FilePath;
+            // The path may be a VFS one, only the name is used for the cache file
+            std::string fontName = StringUtilities::GetFileName(m_FilePath);
 
             // Check cache here
             Buffer storageBuffer;
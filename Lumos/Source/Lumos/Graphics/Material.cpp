@@ -70,11 +70,7 @@ namespace Lumos::Graphics
     bool FileExists(const std::string& path)
     {
         LUMOS_PROFILE_FUNCTION();
-
-        std::string physicalPath;
-
-        FileSystem::Get().ResolvePhysicalPath(path, physicalPath);
-        return FileSystem::FileExists(physicalPath);
+        return FileSystem::Get().FileExistsVFS(path);
     }
 
     void Material::LoadPBRMaterial(const std::string& name, const std::string& path, const std::string& extension)
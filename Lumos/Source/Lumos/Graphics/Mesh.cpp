@@ -7,11 +7,82 @@
 
 #include <ModelLoaders/meshoptimizer/src/meshoptimizer.h>
 #include <glm/gtx/norm.hpp>
+#include <glm/gtc/packing.hpp>
+#include <atomic>
 
 namespace Lumos
 {
     namespace Graphics
     {
+        static uint16_t ToUnorm16(float value)
+        {
+            return uint16_t(std::round(glm::clamp(value, 0.0f, 1.0f) * 65535.0f));
+        }
+
+        static int16_t ToSnorm16(float value)
+        {
+            return int16_t(std::round(glm::clamp(value, -1.0f, 1.0f) * 32767.0f));
+        }
+
+        static uint8_t ToUnorm8(float value)
+        {
+            return uint8_t(std::round(glm::clamp(value, 0.0f, 1.0f) * 255.0f));
+        }
+
+        // Octahedral encoding, maps a unit vector to [-1, 1]^2
+        static glm::vec2 OctEncode(glm::vec3 n)
+        {
+            float length = std::abs(n.x) + std::abs(n.y) + std::abs(n.z);
+            if(length < Maths::M_EPSILON)
+                return glm::vec2(0.0f, 0.0f);
+
+            n /= length;
+            glm::vec2 result(n.x, n.y);
+            if(n.z < 0.0f)
+            {
+                result.x = (1.0f - std::abs(n.y)) * (n.x >= 0.0f ? 1.0f : -1.0f);
+                result.y = (1.0f - std::abs(n.x)) * (n.y >= 0.0f ? 1.0f : -1.0f);
+            }
+            return result;
+        }
+
+        // Attribute order must match the inputs of the *Compact vertex shaders
+        static BufferLayout CreateCompactVertexLayout(bool animated)
+        {
+            BufferLayout layout;
+            layout.Push("inPosition", RHIFormat::R16G16B16A16_Unorm, sizeof(uint16_t) * 4, true);
+            layout.Push("inColor", RHIFormat::R8G8B8A8_Unorm, sizeof(uint8_t) * 4, true);
+            layout.Push("inTexCoord", RHIFormat::R16G16_Float, sizeof(uint16_t) * 2, false);
+            layout.Push("inNormalTangent", RHIFormat::R16G16B16A16_Snorm, sizeof(int16_t) * 4, true);
+
+            if(animated)
+            {
+                layout.Push("inBoneIndices", RHIFormat::R8G8B8A8_UInt, sizeof(uint8_t) * 4, false);
+                layout.Push("inBoneWeights", RHIFormat::R8G8B8A8_Unorm, sizeof(uint8_t) * 4, true);
+            }
+
+            LUMOS_ASSERT(layout.GetStride() == (animated ? sizeof(CompactAnimVertex) : sizeof(CompactVertex)), "Compact vertex layout mismatch");
+            return layout;
+        }
+
+        static thread_local bool s_Cooking = false;
+        static std::atomic<bool> s_CompactVerticesSupported { false };
+
+        void Mesh::SetCooking(bool cooking)
+        {
+            s_Cooking = cooking;
+        }
+
+        void Mesh::SetCompactVerticesSupported(bool supported)
+        {
+            s_CompactVerticesSupported = supported;
+        }
+
+        bool Mesh::GetCompactVerticesSupported()
+        {
+            return s_CompactVerticesSupported;
+        }
+
         Mesh::Mesh()
             : m_VertexBuffer(nullptr)
             , m_IndexBuffer(nullptr)
@@ -30,10 +101,20 @@ namespace Lumos
             , m_Indices(mesh.m_Indices)
             , m_Vertices(mesh.m_Vertices)
         {
+            m_AnimVertexBuffer = mesh.m_AnimVertexBuffer;
+            m_VertexFormat     = mesh.m_VertexFormat;
+            m_PositionMin      = mesh.m_PositionMin;
+            m_PositionExtent   = mesh.m_PositionExtent;
+            m_LODs             = mesh.m_LODs;
         }
 
-        Mesh::Mesh(const std::vector<uint32_t>& indices, const std::vector<Vertex>& vertices, bool optimise, float optimiseThreshold)
+        Mesh::Mesh(const std::vector<uint32_t>& indices, const std::vector<Vertex>& vertices, bool optimise, float optimiseThreshold, VertexFormat format, uint32_t lodCount)
+            : m_VertexFormat(format)
         {
+            // Keep the full format when the renderer has no compact pipeline
+            if(m_VertexFormat == VertexFormat::Compact && !s_CompactVerticesSupported)
+                m_VertexFormat = VertexFormat::Full;
+
             // int lod = 2;
             // float threshold = powf(0.7f, float(lod));
             m_Indices  = indices;
@@ -71,8 +152,40 @@ namespace Lumos
                 m_BoundingBox->Merge(vertex.Position);
             }
 
-            m_IndexBuffer  = SharedPtr<Graphics::IndexBuffer>(Graphics::IndexBuffer::Create(m_Indices.data(), (uint32_t)m_Indices.size()));
-            m_VertexBuffer = SharedPtr<VertexBuffer>(VertexBuffer::Create((uint32_t)(sizeof(Graphics::Vertex) * m_Vertices.size()), m_Vertices.data(), BufferUsage::STATIC));
+            m_IndexBuffer = SharedPtr<Graphics::IndexBuffer>(Graphics::IndexBuffer::Create(m_Indices.data(), (uint32_t)m_Indices.size()));
+
+            if(s_Cooking)
+            {
+                m_CookedData          = CreateSharedPtr<MeshCookedData>();
+                m_CookedData->Indices = m_Indices;
+            }
+
+            if(lodCount > 1 && !m_Vertices.empty())
+                GenerateLODs((const float*)(&m_Vertices[0]), m_Vertices.size(), sizeof(Graphics::Vertex), lodCount);
+
+            if(m_VertexFormat == VertexFormat::Compact)
+            {
+                SetQuantisationBounds();
+
+                std::vector<CompactVertex> compactVertices(m_Vertices.size());
+                for(size_t i = 0; i < m_Vertices.size(); i++)
+                {
+                    const Vertex& vertex = m_Vertices[i];
+                    compactVertices[i]   = CompressVertex(vertex.Position, vertex.Colours, vertex.TexCoords, vertex.Normal, vertex.Tangent, vertex.Bitangent);
+                }
+
+                m_VertexBuffer = SharedPtr<VertexBuffer>(VertexBuffer::Create((uint32_t)(sizeof(Graphics::CompactVertex) * compactVertices.size()), compactVertices.data(), BufferUsage::STATIC));
+
+                if(m_CookedData)
+                    m_CookedData->Vertices.assign((uint8_t*)compactVertices.data(), (uint8_t*)(compactVertices.data() + compactVertices.size()));
+            }
+            else
+            {
+                m_VertexBuffer = SharedPtr<VertexBuffer>(VertexBuffer::Create((uint32_t)(sizeof(Graphics::Vertex) * m_Vertices.size()), m_Vertices.data(), BufferUsage::STATIC));
+
+                if(m_CookedData)
+                    m_CookedData->Vertices.assign((uint8_t*)m_Vertices.data(), (uint8_t*)(m_Vertices.data() + m_Vertices.size()));
+            }
 
 #ifndef LUMOS_PRODUCTION
             m_Stats.VertexCount       = (uint32_t)m_Vertices.size();
@@ -92,8 +205,29 @@ namespace Lumos
             }
         }
 
-        Mesh::Mesh(const std::vector<uint32_t>& indices, const std::vector<AnimVertex>& vertices)
+        Mesh::Mesh(const std::vector<uint32_t>& indices, const std::vector<AnimVertex>& vertices, VertexFormat format, uint32_t lodCount)
+            : m_VertexFormat(format)
         {
+            if(m_VertexFormat == VertexFormat::Compact && !s_CompactVerticesSupported)
+                m_VertexFormat = VertexFormat::Full;
+
+            // Compact vertices store 8 bit bone indices, a clamped index would skin to the wrong joint
+            if(m_VertexFormat == VertexFormat::Compact)
+            {
+                uint32_t maxBoneIndex = 0;
+                for(auto& vertex : vertices)
+                {
+                    for(int j = 0; j < 4; j++)
+                        maxBoneIndex = Maths::Max(maxBoneIndex, vertex.BoneInfoIndices[j]);
+                }
+
+                if(maxBoneIndex > 255)
+                {
+                    LUMOS_LOG_WARN("Bone index {0} out of range for compact vertex format, using full vertices", maxBoneIndex);
+                    m_VertexFormat = VertexFormat::Full;
+                }
+            }
+
             // int lod = 2;
             // float threshold = powf(0.7f, float(lod));
             m_Indices = indices;
@@ -106,8 +240,58 @@ namespace Lumos
                 m_BoundingBox->Merge(vertex.Position);
             }
 
-            m_IndexBuffer      = SharedPtr<Graphics::IndexBuffer>(Graphics::IndexBuffer::Create(m_Indices.data(), (uint32_t)m_Indices.size()));
-            m_AnimVertexBuffer = SharedPtr<VertexBuffer>(VertexBuffer::Create((uint32_t)(sizeof(Graphics::AnimVertex) * vertices.size()), vertices.data(), BufferUsage::STATIC));
+            m_IndexBuffer = SharedPtr<Graphics::IndexBuffer>(Graphics::IndexBuffer::Create(m_Indices.data(), (uint32_t)m_Indices.size()));
+
+            if(s_Cooking)
+            {
+                m_CookedData          = CreateSharedPtr<MeshCookedData>();
+                m_CookedData->Indices = m_Indices;
+            }
+
+            if(lodCount > 1 && !vertices.empty())
+                GenerateLODs((const float*)(&vertices[0]), vertices.size(), sizeof(Graphics::AnimVertex), lodCount);
+
+            if(m_VertexFormat == VertexFormat::Compact)
+            {
+                SetQuantisationBounds();
+
+                std::vector<CompactAnimVertex> compactVertices(vertices.size());
+                for(size_t i = 0; i < vertices.size(); i++)
+                {
+                    const AnimVertex& vertex      = vertices[i];
+                    CompactAnimVertex& compact    = compactVertices[i];
+                    const CompactVertex attribute = CompressVertex(vertex.Position, vertex.Colours, vertex.TexCoords, vertex.Normal, vertex.Tangent, vertex.Bitangent);
+
+                    memcpy(&compact, &attribute, sizeof(CompactVertex));
+
+                    // Quantise weights then give the rounding error to the largest so they still sum to one
+                    int weightSum = 0;
+                    int largest   = 0;
+                    for(int j = 0; j < 4; j++)
+                    {
+                        compact.BoneInfoIndices[j] = uint8_t(vertex.BoneInfoIndices[j]);
+                        compact.Weights[j]         = ToUnorm8(vertex.Weights[j]);
+                        weightSum += compact.Weights[j];
+                        if(compact.Weights[j] > compact.Weights[largest])
+                            largest = j;
+                    }
+
+                    if(weightSum > 0)
+                        compact.Weights[largest] = uint8_t(glm::clamp(int(compact.Weights[largest]) + 255 - weightSum, 0, 255));
+                }
+
+                m_AnimVertexBuffer = SharedPtr<VertexBuffer>(VertexBuffer::Create((uint32_t)(sizeof(Graphics::CompactAnimVertex) * compactVertices.size()), compactVertices.data(), BufferUsage::STATIC));
+
+                if(m_CookedData)
+                    m_CookedData->Vertices.assign((uint8_t*)compactVertices.data(), (uint8_t*)(compactVertices.data() + compactVertices.size()));
+            }
+            else
+            {
+                m_AnimVertexBuffer = SharedPtr<VertexBuffer>(VertexBuffer::Create((uint32_t)(sizeof(Graphics::AnimVertex) * vertices.size()), vertices.data(), BufferUsage::STATIC));
+
+                if(m_CookedData)
+                    m_CookedData->Vertices.assign((uint8_t*)vertices.data(), (uint8_t*)(vertices.data() + vertices.size()));
+            }
 
 #ifndef LUMOS_PRODUCTION
             m_Stats.VertexCount       = (uint32_t)vertices.size();
@@ -131,6 +315,108 @@ namespace Lumos
         {
         }
 
+        const SharedPtr<IndexBuffer>& Mesh::GetIndexBuffer(uint32_t lod) const
+        {
+            if(lod == 0 || m_LODs.empty())
+                return m_IndexBuffer;
+
+            return m_LODs[Maths::Min(lod, (uint32_t)m_LODs.size()) - 1].Indices;
+        }
+
+        void Mesh::GenerateLODs(const float* positions, size_t vertexCount, size_t stride, uint32_t lodCount)
+        {
+            LUMOS_PROFILE_FUNCTION();
+
+            // Too few triangles to be worth simplifying further
+            const size_t minIndexCount = 3 * 64;
+
+            m_LODs.clear();
+
+            std::vector<uint32_t> source = m_Indices;
+            std::vector<uint32_t> lodIndices(source.size());
+
+            for(uint32_t lod = 1; lod < lodCount; lod++)
+            {
+                // Halve the triangle count each level, allowing a larger error as we go
+                const size_t targetIndexCount = (size_t(source.size() * 0.5f) / 3) * 3;
+                const float targetError       = 1e-2f * float(1 << (lod - 1));
+
+                if(targetIndexCount < minIndexCount)
+                    break;
+
+                float resultError    = 0.0f;
+                size_t newIndexCount = meshopt_simplify(lodIndices.data(), source.data(), source.size(), positions, vertexCount, stride, targetIndexCount, targetError, &resultError);
+
+                // Stop once the simplifier can't make meaningful progress within the error bound
+                if(newIndexCount == 0 || newIndexCount > source.size() * 0.9f)
+                    break;
+
+                MeshLOD meshLOD;
+                meshLOD.Indices    = SharedPtr<Graphics::IndexBuffer>(Graphics::IndexBuffer::Create(lodIndices.data(), (uint32_t)newIndexCount));
+                meshLOD.IndexCount = (uint32_t)newIndexCount;
+                meshLOD.Error      = resultError;
+                m_LODs.push_back(meshLOD);
+
+                if(m_CookedData)
+                    m_CookedData->LODIndices.emplace_back(lodIndices.begin(), lodIndices.begin() + newIndexCount);
+
+                source.assign(lodIndices.begin(), lodIndices.begin() + newIndexCount);
+            }
+        }
+
+        void Mesh::SetQuantisationBounds()
+        {
+            const glm::vec3 min    = m_BoundingBox->Min();
+            const glm::vec3 extent = m_BoundingBox->Max() - min;
+
+            // Avoid dividing by zero for flat meshes
+            m_PositionMin    = glm::vec4(min, 0.0f);
+            m_PositionExtent = glm::vec4(glm::max(extent, glm::vec3(Maths::M_EPSILON)), 0.0f);
+        }
+
+        CompactVertex Mesh::CompressVertex(const glm::vec3& position, const glm::vec4& colour, const glm::vec2& texCoords, const glm::vec3& normal, const glm::vec3& tangent, const glm::vec3& bitangent) const
+        {
+            CompactVertex result;
+
+            const glm::vec3 quantised = (position - glm::vec3(m_PositionMin)) / glm::vec3(m_PositionExtent);
+            const float bitangentSign = glm::dot(glm::cross(normal, tangent), bitangent) < 0.0f ? 0.0f : 1.0f;
+
+            result.Position[0] = ToUnorm16(quantised.x);
+            result.Position[1] = ToUnorm16(quantised.y);
+            result.Position[2] = ToUnorm16(quantised.z);
+            result.Position[3] = ToUnorm16(bitangentSign);
+
+            for(int i = 0; i < 4; i++)
+                result.Colours[i] = ToUnorm8(colour[i]);
+
+            result.TexCoords[0] = glm::packHalf1x16(texCoords.x);
+            result.TexCoords[1] = glm::packHalf1x16(texCoords.y);
+
+            const glm::vec2 octNormal  = OctEncode(normal);
+            const glm::vec2 octTangent = OctEncode(tangent);
+            result.NormalTangent[0]    = ToSnorm16(octNormal.x);
+            result.NormalTangent[1]    = ToSnorm16(octNormal.y);
+            result.NormalTangent[2]    = ToSnorm16(octTangent.x);
+            result.NormalTangent[3]    = ToSnorm16(octTangent.y);
+
+            return result;
+        }
+
+        const BufferLayout* Mesh::GetVertexLayout() const
+        {
+            if(m_VertexFormat == VertexFormat::Compact)
+                return &GetCompactVertexLayout(m_AnimVertexBuffer != nullptr);
+
+            return nullptr;
+        }
+
+        const BufferLayout& Mesh::GetCompactVertexLayout(bool animated)
+        {
+            static const BufferLayout staticLayout = CreateCompactVertexLayout(false);
+            static const BufferLayout animLayout   = CreateCompactVertexLayout(true);
+            return animated ? animLayout : staticLayout;
+        }
+
         void Mesh::GenerateNormals(Vertex* vertices, uint32_t vertexCount, uint32_t* indices, uint32_t indexCount)
         {
             glm::vec3* normals = new glm::vec3[vertexCount];
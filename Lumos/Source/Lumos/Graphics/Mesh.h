@@ -2,6 +2,7 @@
 
 #include "RHI/IndexBuffer.h"
 #include "RHI/VertexBuffer.h"
+#include "RHI/BufferLayout.h"
 #include "Graphics/RHI/CommandBuffer.h"
 #include "Graphics/RHI/DescriptorSet.h"
 #include "Maths/Maths.h"
@@ -111,6 +112,32 @@ namespace Lumos
             }
         };
 
+        enum class VertexFormat : uint8_t
+        {
+            Full,
+            Compact
+        };
+
+        // Position is 16 bit unorm relative to the mesh bounds, w holds the bitangent sign.
+        // Normal and tangent are octahedral encoded as 16 bit snorm pairs.
+        struct CompactVertex
+        {
+            uint16_t Position[4];
+            uint8_t Colours[4];
+            uint16_t TexCoords[2]; // Half float
+            int16_t NormalTangent[4];
+        };
+
+        struct CompactAnimVertex
+        {
+            uint16_t Position[4];
+            uint8_t Colours[4];
+            uint16_t TexCoords[2];
+            int16_t NormalTangent[4];
+            uint8_t BoneInfoIndices[4];
+            uint8_t Weights[4];
+        };
+
         struct Triangle
         {
             Triangle(const Vertex& v0, const Vertex& v1, const Vertex& v2)
@@ -125,6 +152,22 @@ namespace Lumos
             Vertex p2;
         };
 
+        // Simplified index list sharing the base mesh's vertex buffer
+        struct MeshLOD
+        {
+            SharedPtr<IndexBuffer> Indices;
+            uint32_t IndexCount = 0;
+            float Error         = 0.0f; // Relative to the mesh extents
+        };
+
+        // CPU copy of the uploaded buffers, only kept while cooking a model cache
+        struct MeshCookedData
+        {
+            std::vector<uint8_t> Vertices;
+            std::vector<uint32_t> Indices;
+            std::vector<std::vector<uint32_t>> LODIndices;
+        };
+
         struct MeshStats
         {
             uint32_t TriangleCount;
@@ -133,13 +176,17 @@ namespace Lumos
             float OptimiseThreshold;
         };
 
+        class Model;
+
         class LUMOS_EXPORT Mesh
         {
+            friend class Model;
+
         public:
             Mesh();
             Mesh(const Mesh& mesh);
-            Mesh(const std::vector<uint32_t>& indices, const std::vector<Vertex>& vertices, bool optimise = false, float optimiseThreshold = 0.95f);
-            Mesh(const std::vector<uint32_t>& indices, const std::vector<AnimVertex>& vertices);
+            Mesh(const std::vector<uint32_t>& indices, const std::vector<Vertex>& vertices, bool optimise = false, float optimiseThreshold = 0.95f, VertexFormat format = VertexFormat::Full, uint32_t lodCount = 1);
+            Mesh(const std::vector<uint32_t>& indices, const std::vector<AnimVertex>& vertices, VertexFormat format = VertexFormat::Full, uint32_t lodCount = 1);
             virtual ~Mesh();
 
             const SharedPtr<VertexBuffer>& GetVertexBuffer() const { return m_VertexBuffer; }
@@ -151,6 +198,32 @@ namespace Lumos
             void SetMaterial(const SharedPtr<Material>& material) { m_Material = material; }
             void SetAndLoadMaterial(const std::string& filePath);
 
+            VertexFormat GetVertexFormat() const { return m_VertexFormat; }
+            bool IsCompact() const { return m_VertexFormat == VertexFormat::Compact; }
+
+            // Decodes compact positions: position = min + quantised * extent
+            const glm::vec4& GetPositionMin() const { return m_PositionMin; }
+            const glm::vec4& GetPositionExtent() const { return m_PositionExtent; }
+
+            // Vertex buffer layout for compact meshes, null for the full format
+            const BufferLayout* GetVertexLayout() const;
+            static const BufferLayout& GetCompactVertexLayout(bool animated);
+
+            // LOD 0 is the full index buffer, higher levels are progressively simplified
+            uint32_t GetLODCount() const { return 1 + (uint32_t)m_LODs.size(); }
+            const SharedPtr<IndexBuffer>& GetIndexBuffer(uint32_t lod) const;
+            const std::vector<MeshLOD>& GetLODs() const { return m_LODs; }
+
+            // Meshes created on this thread keep their cooked data until released
+            static void SetCooking(bool cooking);
+
+            // Set by the renderer once the compact vertex shaders are created. Compact meshes imported
+            // without them are expanded to the full format
+            static void SetCompactVerticesSupported(bool supported);
+            static bool GetCompactVerticesSupported();
+            const SharedPtr<MeshCookedData>& GetCookedData() const { return m_CookedData; }
+            void ReleaseCookedData() { m_CookedData.reset(); }
+
             bool& GetActive() { return m_Active; }
             void SetName(const std::string& name) { m_Name = name; }
             const std::string& GetName() const { return m_Name; }
@@ -189,6 +262,10 @@ namespace Lumos
             static glm::vec3* GenerateNormals(uint32_t numVertices, glm::vec3* vertices, uint32_t* indices, uint32_t numIndices);
             static glm::vec3* GenerateTangents(uint32_t numVertices, glm::vec3* vertices, uint32_t* indices, uint32_t numIndices, glm::vec2* texCoords);
 
+            void GenerateLODs(const float* positions, size_t vertexCount, size_t stride, uint32_t lodCount);
+            void SetQuantisationBounds();
+            CompactVertex CompressVertex(const glm::vec3& position, const glm::vec4& colour, const glm::vec2& texCoords, const glm::vec3& normal, const glm::vec3& tangent, const glm::vec3& bitangent) const;
+
             SharedPtr<VertexBuffer> m_VertexBuffer;
             SharedPtr<VertexBuffer> m_AnimVertexBuffer;
             SharedPtr<IndexBuffer> m_IndexBuffer;
@@ -197,9 +274,14 @@ namespace Lumos
 
             std::string m_Name;
 
-            bool m_Active = true;
+            bool m_Active               = true;
+            VertexFormat m_VertexFormat = VertexFormat::Full;
+            glm::vec4 m_PositionMin     = glm::vec4(0.0f);
+            glm::vec4 m_PositionExtent  = glm::vec4(1.0f);
             std::vector<uint32_t> m_Indices;
             std::vector<Vertex> m_Vertices;
+            std::vector<MeshLOD> m_LODs;
+            SharedPtr<MeshCookedData> m_CookedData;
 
             // Only calculated on request
             std::vector<Triangle> m_Triangles;
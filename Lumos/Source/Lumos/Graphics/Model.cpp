@@ -7,10 +7,15 @@
 #include "Animation/Skeleton.h"
 #include "Animation/Animation.h"
 #include "Animation/AnimationController.h"
+#include "ModelLoader/ModelCache.h"
 #include "AI/AStar.h"
 
+#include <atomic>
+
 namespace Lumos::Graphics
 {
+    static std::atomic<bool> s_ImportCompactVertices { false };
+
     Model::Model()
         : m_FilePath()
         , m_PrimitiveType(PrimitiveType::None)
@@ -47,29 +52,61 @@ namespace Lumos::Graphics
     Model::Model(Model&&)                 = default;
     Model& Model::operator=(Model&&)      = default;
 
+    void Model::SetImportCompactVertices(bool compact)
+    {
+        s_ImportCompactVertices = compact;
+    }
+
+    bool Model::GetImportCompactVertices()
+    {
+        return s_ImportCompactVertices;
+    }
+
     void Model::LoadModel(const std::string& path)
     {
         LUMOS_PROFILE_FUNCTION();
-        std::string physicalPath;
-        if(!Lumos::FileSystem::Get().ResolvePhysicalPath(path, physicalPath))
+        // The loaders read through the VFS, so the model and the files it references can come from a mounted pak
+        if(!Lumos::FileSystem::Get().FileExistsVFS(path))
         {
             LUMOS_LOG_INFO("Failed to load Model - {0}", path);
             return;
         }
 
-        std::string resolvedPath = physicalPath;
-
         const std::string fileExtension = StringUtilities::GetFilePathExtension(path);
 
+        const uint64_t sourceHash = HashModelSource(path);
+        if(LoadModelCache(path, sourceHash))
+        {
+            LUMOS_LOG_INFO("Loaded Model - {0} (cached)", path);
+            return;
+        }
+
+        // Keep CPU copies of everything uploaded so the cache can be written after import
+        std::vector<CookedTexture> cookedTextures;
+        std::vector<std::string> dependencies;
+        Mesh::SetCooking(true);
+        SetCookedTextureList(&cookedTextures);
+        SetCookedDependencyList(&dependencies);
+
         if(fileExtension == "obj")
-            LoadOBJ(resolvedPath);
+            LoadOBJ(path);
         else if(fileExtension == "gltf" || fileExtension == "glb")
-            LoadGLTF(resolvedPath);
+            LoadGLTF(path);
         else if(fileExtension == "fbx" || fileExtension == "FBX")
-            LoadFBX(resolvedPath);
+            LoadFBX(path);
         else
             LUMOS_LOG_ERROR("Unsupported File Type : {0}", fileExtension);
 
+        Mesh::SetCooking(false);
+        SetCookedTextureList(nullptr);
+        SetCookedDependencyList(nullptr);
+
+        if(sourceHash && !m_Meshes.empty())
+            WriteModelCache(path, sourceHash, cookedTextures, dependencies);
+
+        for(auto& mesh : m_Meshes)
+            mesh->ReleaseCookedData();
+
         LUMOS_LOG_INFO("Loaded Model - {0}", path);
     }
 
@@ -83,21 +120,11 @@ namespace Lumos::Graphics
             m_SamplingContext = CreateSharedPtr<SamplingContext>();
         }
 
-        if(!m_AnimationController)
-        {
-            m_AnimationController = CreateSharedPtr<AnimationController>();
-            m_AnimationController->SetSkeleton(m_Skeleton);
-            for(auto anim : m_Animation)
-            {
-                m_AnimationController->AddState(anim->GetName(), anim);
-            }
-            m_AnimationController->m_BindPoses = m_BindPoses;
-        }
+        GetOrCreateAnimationController();
 
         static float time = 0.0f;
         time += (float)dt.GetSeconds();
-        m_AnimationController->SetCurrentState(m_CurrentAnimation);
-        m_AnimationController->Update(time, *m_SamplingContext.get());
+        m_AnimationController->Update(time, *m_SamplingContext.get(), (float)dt.GetSeconds());
     }
 
     void Model::UpdateAnimation(const TimeStep& dt, float overrideTime)
@@ -110,19 +137,9 @@ namespace Lumos::Graphics
             m_SamplingContext = CreateSharedPtr<SamplingContext>();
         }
 
-        if(!m_AnimationController)
-        {
-            m_AnimationController = CreateSharedPtr<AnimationController>();
-            m_AnimationController->SetSkeleton(m_Skeleton);
-            for(auto anim : m_Animation)
-            {
-                m_AnimationController->AddState(anim->GetName(), anim);
-            }
-            m_AnimationController->m_BindPoses = m_BindPoses;
-        }
+        GetOrCreateAnimationController();
 
-        m_AnimationController->SetCurrentState(m_CurrentAnimation);
-        m_AnimationController->Update(overrideTime, *m_SamplingContext.get());
+        m_AnimationController->Update(overrideTime, *m_SamplingContext.get(), (float)dt.GetSeconds());
     }
 
     std::vector<glm::mat4> Model::GetJointMatrices()
@@ -170,4 +187,34 @@ namespace Lumos::Graphics
     {
         return m_AnimationController;
     }
+
+    SharedPtr<AnimationController> Model::GetOrCreateAnimationController()
+    {
+        if(!m_AnimationController && !m_Animation.empty())
+        {
+            m_AnimationController = CreateSharedPtr<AnimationController>();
+            m_AnimationController->SetSkeleton(m_Skeleton);
+            for(auto anim : m_Animation)
+            {
+                m_AnimationController->AddState(anim->GetName(), anim);
+            }
+            m_AnimationController->m_BindPoses = m_BindPoses;
+            m_AnimationController->SetCurrentState(m_CurrentAnimation);
+        }
+
+        return m_AnimationController;
+    }
+
+    uint32_t Model::GetCurrentAnimationIndex() const
+    {
+        return m_AnimationController ? uint32_t(m_AnimationController->GetCurrentState()) : m_CurrentAnimation;
+    }
+
+    // The controller owns the playing state once it exists, so transitions aren't overridden every update
+    void Model::SetCurrentAnimationIndex(uint32_t index)
+    {
+        m_CurrentAnimation = index;
+        if(m_AnimationController)
+            m_AnimationController->SetCurrentState(index);
+    }
 }
@@ -12,6 +12,7 @@ namespace Lumos
         class Animation;
         class AnimationController;
         struct SamplingContext;
+        struct CookedTexture;
         class Mesh;
 
         class Model : public Asset
@@ -39,14 +40,22 @@ namespace Lumos
             SharedPtr<SamplingContext> GetSamplingContext() const;
             SharedPtr<AnimationController> GetAnimationController() const;
 
-            uint32_t GetCurrentAnimationIndex() const { return m_CurrentAnimation; }
-            void SetCurrentAnimationIndex(uint32_t index) { m_CurrentAnimation = index; }
+            // Creates the controller on first use so its graph can be edited before the model animates,
+            // null when the model has no animations
+            SharedPtr<AnimationController> GetOrCreateAnimationController();
+
+            uint32_t GetCurrentAnimationIndex() const;
+            void SetCurrentAnimationIndex(uint32_t index);
 
             const std::string& GetFilePath() const { return m_FilePath; }
             PrimitiveType GetPrimitiveType() { return m_PrimitiveType; }
             void SetPrimitiveType(PrimitiveType type) { m_PrimitiveType = type; }
             SET_ASSET_TYPE(AssetType::Model);
 
+            // Quantise every imported mesh to VertexFormat::Compact, glTF meshes can also opt in with a "CompactVertices" extra
+            static void SetImportCompactVertices(bool compact);
+            static bool GetImportCompactVertices();
+
             void UpdateAnimation(const TimeStep& dt);
             void UpdateAnimation(const TimeStep& dt, float overrideTime);
 
@@ -76,6 +85,11 @@ namespace Lumos
             void LoadGLTF(const std::string& path);
             void LoadFBX(const std::string& path);
 
+            // Binary cache of the imported model, see ModelLoader/ModelCache.cpp
+            static uint64_t HashModelSource(const std::string& path);
+            bool LoadModelCache(const std::string& path, uint64_t sourceHash);
+            void WriteModelCache(const std::string& path, uint64_t sourceHash, const std::vector<CookedTexture>& cookedTextures, const std::vector<std::string>& dependencies);
+
         public:
             void LoadModel(const std::string& path);
         };
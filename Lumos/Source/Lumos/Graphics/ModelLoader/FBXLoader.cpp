@@ -2,6 +2,7 @@
 #include "Graphics/Model.h"
 #include "Graphics/Mesh.h"
 #include "Graphics/Material.h"
+#include "Graphics/ModelLoader/ModelCache.h"
 #include "Core/OS/FileSystem.h"
 
 #include "Graphics/RHI/Texture.h"
@@ -169,25 +170,26 @@ namespace Lumos::Graphics
 
             bool fileFound = false;
 
-            fileFound = FileSystem::FileExists(stringFilepath);
+            fileFound = FileSystem::Get().FileExistsVFS(stringFilepath);
 
             if(!fileFound)
             {
                 stringFilepath = StringUtilities::GetFileName(stringFilepath);
                 stringFilepath = m_FBXModelDirectory + "/" + stringFilepath;
-                fileFound      = FileSystem::FileExists(stringFilepath);
+                fileFound      = FileSystem::Get().FileExistsVFS(stringFilepath);
             }
 
             if(!fileFound)
             {
                 stringFilepath = StringUtilities::GetFileName(stringFilepath);
                 stringFilepath = m_FBXModelDirectory + "/textures/" + stringFilepath;
-                fileFound      = FileSystem::FileExists(stringFilepath);
+                fileFound      = FileSystem::Get().FileExistsVFS(stringFilepath);
             }
 
             if(fileFound)
             {
                 texture2D = Graphics::Texture2D::CreateFromFile(stringFilepath, stringFilepath);
+                Graphics::CookTexture(texture2D, Graphics::TextureDesc(), stringFilepath, stringFilepath);
             }
         }
 
@@ -335,7 +337,8 @@ namespace Lumos::Graphics
             pbrMaterial = LoadMaterial(material, false);
         }
 
-        auto mesh = CreateSharedPtr<Graphics::Mesh>(indicesArray, tempvertices);
+        const auto vertexFormat = Model::GetImportCompactVertices() ? Graphics::VertexFormat::Compact : Graphics::VertexFormat::Full;
+        auto mesh               = CreateSharedPtr<Graphics::Mesh>(indicesArray, tempvertices, false, 0.95f, vertexFormat, 4);
         mesh->SetName(fbxMesh->name);
         if(material)
             mesh->SetMaterial(pbrMaterial);
@@ -382,8 +385,8 @@ namespace Lumos::Graphics
         std::string name = m_FBXModelDirectory.substr(m_FBXModelDirectory.find_last_of('/') + 1);
 
         std::string ext = StringUtilities::GetFilePathExtension(path);
-        int64_t size    = FileSystem::GetFileSize(path);
-        auto data       = FileSystem::ReadFile(path);
+        int64_t size    = 0;
+        auto data       = FileSystem::Get().ReadFileVFS(path, &size);
 
         if(data == nullptr)
         {
@@ -393,7 +396,9 @@ namespace Lumos::Graphics
         const bool ignoreGeometry = false;
         const uint64_t flags      = ignoreGeometry ? (uint64_t)ofbx::LoadFlags::IGNORE_GEOMETRY : (uint64_t)ofbx::LoadFlags::TRIANGULATE;
 
-        ofbx::IScene* scene                  = ofbx::load(data, uint32_t(size), flags);
+        // The scene keeps its own copy of the file
+        ofbx::IScene* scene = ofbx::load(data, uint32_t(size), flags);
+        delete[] data;
         const ofbx::GlobalSettings* settings = scene->getGlobalSettings();
 
         err = ofbx::getError();
@@ -9,18 +9,22 @@
 #include "Graphics/Material.h"
 #include "Graphics/Animation/Skeleton.h"
 #include "Graphics/Animation/Animation.h"
+#include "Graphics/ModelLoader/ModelCache.h"
 
 #include "Graphics/RHI/Texture.h"
 #include "Maths/MathsBasicTypes.h"
 
 #include "Maths/Transform.h"
 #include "Core/Application.h"
+#include "Core/JobSystem.h"
 #include "Utilities/StringUtilities.h"
 #include "Utilities/AssetManager.h"
 
 #define TINYGLTF_IMPLEMENTATION
 #define TINYGLTF_USE_CPP14
 #define STB_IMAGE_WRITE_IMPLEMENTATION
+// Image files are read asynchronously by DecodeImages rather than while parsing
+#define TINYGLTF_NO_EXTERNAL_IMAGE
 
 #ifdef LUMOS_PRODUCTION
 #define TINYGLTF_NOEXCEPTION
@@ -119,7 +123,214 @@ namespace Lumos::Graphics
         }
     }
 
-    std::vector<SharedPtr<Material>> LoadMaterials(tinygltf::Model& gltfModel)
+    // Encoded bytes of data uri images, kept until DecodeImages. Images in a buffer view are read straight from
+    // the model's buffers instead, and images in their own files are read by DecodeImages
+    struct DeferredImages
+    {
+        std::unordered_map<int, std::vector<uint8_t>> EncodedBytes;
+    };
+
+    // File callbacks so the gltf, its buffers and images are read through the VFS and can come from a mounted pak
+    static bool VFSFileExists(const std::string& path, void*)
+    {
+        return FileSystem::Get().FileExistsVFS(path);
+    }
+
+    static std::string VFSExpandFilePath(const std::string& path, void*)
+    {
+        return path;
+    }
+
+    static bool VFSReadWholeFile(std::vector<unsigned char>* out, std::string* err, const std::string& path, void*)
+    {
+        int64_t size  = 0;
+        uint8_t* data = FileSystem::Get().ReadFileVFS(path, &size);
+        if(!data)
+        {
+            if(err)
+                *err += "File read error : " + path + "\n";
+            return false;
+        }
+
+        out->assign(data, data + size);
+        delete[] data;
+        CookDependency(path);
+        return true;
+    }
+
+    static const tinygltf::FsCallbacks VFSCallbacks = { VFSFileExists, VFSExpandFilePath, VFSReadWholeFile, tinygltf::WriteWholeFile, nullptr };
+
+    // Image loader callback that only records the encoded data, so decoding can happen on the job system
+    static bool DeferImageLoad(tinygltf::Image* image, const int imageIndex, std::string* err, std::string* warn, int reqWidth, int reqHeight, const unsigned char* bytes, int size, void* userData)
+    {
+        // The uri data is a temporary buffer, so it has to be copied
+        if(image->bufferView == -1)
+            static_cast<DeferredImages*>(userData)->EncodedBytes[imageIndex].assign(bytes, bytes + size);
+
+        return true;
+    }
+
+    // Shrinks an 8 bit RGBA image in place to fit within the max dimensions, keeping the aspect ratio
+    static void FitImageToMaxDimensions(tinygltf::Image& image, uint32_t maxWidth, uint32_t maxHeight)
+    {
+        uint32_t texWidth  = image.width;
+        uint32_t texHeight = image.height;
+
+        if(maxWidth == 0 || maxHeight == 0 || (texWidth <= maxWidth && texHeight <= maxHeight))
+            return;
+
+        if(image.component != 4 || image.bits != 8)
+        {
+            LUMOS_LOG_WARN("Can't resize image {0}, only 8 bit RGBA is supported", image.name);
+            return;
+        }
+
+        float aspectRatio = static_cast<float>(texWidth) / static_cast<float>(texHeight);
+        if(texWidth > maxWidth)
+        {
+            texWidth  = maxWidth;
+            texHeight = static_cast<uint32_t>(maxWidth / aspectRatio);
+        }
+        if(texHeight > maxHeight)
+        {
+            texHeight = maxHeight;
+            texWidth  = static_cast<uint32_t>(maxHeight * aspectRatio);
+        }
+
+        std::vector<unsigned char> resizedPixels(texWidth * texHeight * 4);
+        stbir_resize_uint8_linear(image.image.data(), image.width, image.height, 0, resizedPixels.data(), texWidth, texHeight, 0, STBIR_RGBA);
+
+        image.image.swap(resizedPixels);
+        image.width  = int(texWidth);
+        image.height = int(texHeight);
+    }
+
+    // Path of an image stored in its own file, empty for images embedded in the model
+    static std::string GetImagePath(const std::string& directory, const tinygltf::Image& image)
+    {
+        if(image.bufferView != -1 || image.uri.empty())
+            return std::string();
+
+        return directory + tinygltf::dlib::urldecode(image.uri);
+    }
+
+    // Decodes and resizes every image used by a texture in parallel, each shared image only once. Image files
+    // are read on the I/O thread and each is decoded as soon as it arrives, while the rest are still loading
+    static void DecodeImages(tinygltf::Model& gltfModel, DeferredImages& deferred, const std::string& directory)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        std::vector<int> imageIndices;
+        std::vector<bool> referenced(gltfModel.images.size(), false);
+        for(const tinygltf::Texture& gltfTexture : gltfModel.textures)
+        {
+            if(gltfTexture.source >= 0 && gltfTexture.source < int(gltfModel.images.size()) && !referenced[gltfTexture.source])
+            {
+                referenced[gltfTexture.source] = true;
+                imageIndices.push_back(gltfTexture.source);
+            }
+        }
+
+        if(imageIndices.empty())
+            return;
+
+        uint32_t maxWidth, maxHeight;
+        GetMaxImageDimensions(maxWidth, maxHeight);
+
+        std::vector<std::string> errors(imageIndices.size());
+
+        auto Decode = [&](uint32_t slot, const unsigned char* bytes, int size)
+        {
+            LUMOS_PROFILE_SCOPE("Decode GLTF Image");
+            const int imageIndex   = imageIndices[slot];
+            tinygltf::Image& image = gltfModel.images[imageIndex];
+
+            std::string warn;
+            if(tinygltf::LoadImageData(&image, imageIndex, &errors[slot], &warn, 0, 0, bytes, size, nullptr))
+                FitImageToMaxDimensions(image, maxWidth, maxHeight);
+        };
+
+        // Only this model's reads are waited on, other streaming I/O on the queue can still be in flight
+        System::JobSystem::Context ctx;
+        std::mutex readMutex;
+        std::condition_variable readsFinished;
+        uint32_t pendingReads = 0;
+
+        std::vector<uint32_t> embeddedSlots;
+        for(uint32_t slot = 0; slot < uint32_t(imageIndices.size()); slot++)
+        {
+            const std::string path = GetImagePath(directory, gltfModel.images[imageIndices[slot]]);
+            if(path.empty())
+            {
+                embeddedSlots.push_back(slot);
+                continue;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(readMutex);
+                pendingReads++;
+            }
+
+            FileSystem::Get().ReadFileAsync(path, [&, slot, path](uint8_t* data, int64_t size)
+                                            {
+                if(!data)
+                    errors[slot] = "Failed to read image " + path;
+                else
+                    System::JobSystem::Execute(ctx, [&Decode, slot, data, size](JobDispatchArgs args)
+                                               {
+                        Decode(slot, data, int(size));
+                        delete[] data; });
+
+                std::lock_guard<std::mutex> lock(readMutex);
+                if(--pendingReads == 0)
+                    readsFinished.notify_one(); });
+        }
+
+        System::JobSystem::Dispatch(ctx, static_cast<uint32_t>(embeddedSlots.size()), 1, [&](JobDispatchArgs args)
+                                    {
+            const uint32_t slot    = embeddedSlots[args.jobIndex];
+            const int imageIndex   = imageIndices[slot];
+            tinygltf::Image& image = gltfModel.images[imageIndex];
+
+            const unsigned char* bytes = nullptr;
+            int size                   = 0;
+            if(image.bufferView >= 0)
+            {
+                const tinygltf::BufferView& bufferView = gltfModel.bufferViews[image.bufferView];
+                bytes                                  = gltfModel.buffers[bufferView.buffer].data.data() + bufferView.byteOffset;
+                size                                   = static_cast<int>(bufferView.byteLength);
+            }
+            else
+            {
+                auto encoded = deferred.EncodedBytes.find(imageIndex);
+                if(encoded != deferred.EncodedBytes.end() && !encoded->second.empty())
+                {
+                    bytes = encoded->second.data();
+                    size  = static_cast<int>(encoded->second.size());
+                }
+            }
+
+            // tinygltf already reported data uris it couldn't decode
+            if(bytes)
+                Decode(slot, bytes, size); });
+
+        // Once every read has called back all the file decodes have been queued on ctx
+        {
+            std::unique_lock<std::mutex> lock(readMutex);
+            readsFinished.wait(lock, [&]
+                               { return pendingReads == 0; });
+        }
+        System::JobSystem::Wait(ctx);
+
+        for(const std::string& error : errors)
+        {
+            if(!error.empty())
+                LUMOS_LOG_ERROR(error);
+        }
+
+        deferred.EncodedBytes.clear();
+    }
+
+    std::vector<SharedPtr<Material>> LoadMaterials(tinygltf::Model& gltfModel, const std::string& directory)
     {
         LUMOS_PROFILE_FUNCTION();
         std::vector<SharedPtr<Graphics::Texture2D>> loadedTextures;
@@ -132,6 +343,8 @@ namespace Lumos::Graphics
             animated = true;
         }
 
+        // One texture per image and sampler pair, however many textures and materials refer to it
+        std::map<std::pair<int, int>, SharedPtr<Graphics::Texture2D>> texturesByImageAndSampler;
         for(tinygltf::Texture& gltfTexture : gltfModel.textures)
         {
             GLTFTexture imageAndSampler {};
@@ -146,68 +359,55 @@ namespace Lumos::Graphics
                 imageAndSampler.Sampler = &gltfModel.samplers.at(gltfTexture.sampler);
             }
 
-            if(imageAndSampler.Image)
+            SharedPtr<Graphics::Texture2D> texture;
+            if(imageAndSampler.Image && !imageAndSampler.Image->image.empty())
             {
-                Graphics::TextureDesc params;
-                if(gltfTexture.sampler != -1)
-                    params = Graphics::TextureDesc(GetFilter(imageAndSampler.Sampler->minFilter), GetFilter(imageAndSampler.Sampler->magFilter), GetWrapMode(imageAndSampler.Sampler->wrapS));
+                auto cached = texturesByImageAndSampler.find({ gltfTexture.source, gltfTexture.sampler });
+                if(cached != texturesByImageAndSampler.end())
+                {
+                    texture = cached->second;
+                }
                 else
-                    LUMOS_LOG_WARN("MISSING SAMPLER");
-
-                uint32_t texWidth  = imageAndSampler.Image->width;
-                uint32_t texHeight = imageAndSampler.Image->height;
-                uint8_t* pixels    = imageAndSampler.Image->image.data();
-
-                uint32_t maxWidth, maxHeight;
-                GetMaxImageDimensions(maxWidth, maxHeight);
-                bool freeData = false;
-
-                if(maxWidth > 0 && maxHeight > 0 && (texWidth > maxWidth || texHeight > maxHeight))
                 {
-                    uint32_t texWidthOld  = imageAndSampler.Image->width;
-                    uint32_t texHeightOld = imageAndSampler.Image->height;
-
-                    float aspectRatio = static_cast<float>(texWidth) / static_cast<float>(texHeight);
-                    if(texWidth > maxWidth)
-                    {
-                        texWidth  = maxWidth;
-                        texHeight = static_cast<uint32_t>(maxWidth / aspectRatio);
-                    }
-                    if(texHeight > maxHeight)
-                    {
-                        texHeight = maxHeight;
-                        texWidth  = static_cast<uint32_t>(maxHeight * aspectRatio);
-                    }
-
-                    // Resize the image using stbir (a simple image resizing library)
-                    int resizedChannels    = 4; // RGBA format
-                    stbi_uc* resizedPixels = (stbi_uc*)malloc(texWidth * texHeight * resizedChannels);
-                    stbir_resize_uint8_linear(pixels, texWidthOld, texHeightOld, 0, resizedPixels, texWidth, texHeight, 0, STBIR_RGBA);
+                    Graphics::TextureDesc params;
+                    if(gltfTexture.sampler != -1)
+                        params = Graphics::TextureDesc(GetFilter(imageAndSampler.Sampler->minFilter), GetFilter(imageAndSampler.Sampler->magFilter), GetWrapMode(imageAndSampler.Sampler->wrapS));
+                    else
+                        LUMOS_LOG_WARN("MISSING SAMPLER");
+
+                    // Already decoded and resized by DecodeImages
+                    uint32_t texWidth  = imageAndSampler.Image->width;
+                    uint32_t texHeight = imageAndSampler.Image->height;
+                    uint8_t* pixels    = imageAndSampler.Image->image.data();
+
+                    // The cache reloads image files by path rather than storing their decoded pixels
+                    Graphics::Texture2D* texture2D = Graphics::Texture2D::CreateFromSource(texWidth, texHeight, pixels, params);
+                    const std::string imagePath    = GetImagePath(directory, *imageAndSampler.Image);
+                    if(imagePath.empty())
+                        CookTexture(texture2D, params, texWidth, texHeight, pixels);
+                    else
+                        CookTexture(texture2D, params, StringUtilities::GetFileName(imagePath), imagePath);
+                    texture = SharedPtr<Graphics::Texture2D>(texture2D ? texture2D : nullptr);
 
-                    // free(pixels);  // Free the original image
-                    pixels   = resizedPixels;
-                    freeData = true;
+                    texturesByImageAndSampler[{ gltfTexture.source, gltfTexture.sampler }] = texture;
                 }
+            }
 
-                Graphics::Texture2D* texture2D = Graphics::Texture2D::CreateFromSource(texWidth, texHeight, pixels, params);
-                loadedTextures.push_back(SharedPtr<Graphics::Texture2D>(texture2D ? texture2D : nullptr));
-                if(freeData)
-                    free(pixels);
+            loadedTextures.push_back(texture);
+        }
 
-                imageAndSampler.Image->image.clear();
-                imageAndSampler.Image->image.shrink_to_fit();
-            }
+        // Pixels can only be freed once every texture sharing the image has been created
+        for(tinygltf::Image& image : gltfModel.images)
+        {
+            image.image.clear();
+            image.image.shrink_to_fit();
         }
 
         auto TextureName = [&](int index)
         {
-            if(index >= 0)
+            if(index >= 0 && index < int(loadedTextures.size()))
             {
-                const tinygltf::Texture& tex = gltfModel.textures[index];
-                if(tex.source >= 0 && tex.source < loadedTextures.size())
-                {
-                    return loadedTextures[tex.source];
-                }
+                return loadedTextures[index];
             }
             return SharedPtr<Graphics::Texture2D>();
         };
@@ -264,13 +464,13 @@ namespace Lumos::Graphics
                 if(metallicGlossinessWorkflow->second.Has("diffuseTexture"))
                 {
                     int index       = metallicGlossinessWorkflow->second.Get("diffuseTexture").Get("index").Get<int>();
-                    textures.albedo = loadedTextures[gltfModel.textures[index].source];
+                    textures.albedo = TextureName(index);
                 }
 
                 if(metallicGlossinessWorkflow->second.Has("metallicGlossinessTexture"))
                 {
                     int index           = metallicGlossinessWorkflow->second.Get("metallicGlossinessTexture").Get("index").Get<int>();
-                    textures.roughness  = loadedTextures[gltfModel.textures[index].source];
+                    textures.roughness  = TextureName(index);
                     properties.workflow = PBR_WORKFLOW_SPECULAR_GLOSINESS;
                 }
 
@@ -649,6 +849,12 @@ namespace Lumos::Graphics
             // Add mesh
             Graphics::Mesh* lMesh;
 
+            // Meshes can opt in to quantised vertices with "CompactVertices" in their glTF extras, or all at once with the import setting
+            const bool compact = Model::GetImportCompactVertices() || mesh.extras.Has("CompactVertices");
+            auto vertexFormat  = compact ? Graphics::VertexFormat::Compact : Graphics::VertexFormat::Full;
+            // Simplified LOD chain built at import, selected by screen size in RenderPasses
+            const uint32_t lodCount = mesh.extras.Has("NoLODs") ? 1 : 4;
+
             if(hasJoints || hasWeights)
             {
                 for(size_t i = 0; i < vertices.size(); i++)
@@ -661,10 +867,10 @@ namespace Lumos::Graphics
                     animVertices[i].Bitangent = vertices[i].Bitangent;
                     animVertices[i].TexCoords = vertices[i].TexCoords;
                 }
-                lMesh = new Graphics::Mesh(indices, animVertices);
+                lMesh = new Graphics::Mesh(indices, animVertices, vertexFormat, lodCount);
             }
             else
-                lMesh = new Graphics::Mesh(indices, vertices);
+                lMesh = new Graphics::Mesh(indices, vertices, false, 0.95f, vertexFormat, lodCount);
 
             meshes.emplace_back(lMesh);
         }
@@ -800,7 +1006,10 @@ namespace Lumos::Graphics
 
         std::string ext = StringUtilities::GetFilePathExtension(path);
 
-        // loader.SetImageLoader(tinygltf::LoadImageData, nullptr);
+        // Images are only read here and decoded together on the job system before the materials are created
+        DeferredImages deferredImages;
+        loader.SetImageLoader(DeferImageLoad, &deferredImages);
+        loader.SetFsCallbacks(VFSCallbacks);
         // loader.SetImageWriter(tinygltf::WriteImageData, nullptr);
 
         bool ret;
@@ -808,12 +1017,12 @@ namespace Lumos::Graphics
         if(ext == "glb") // assume binary glTF.
         {
             LUMOS_PROFILE_SCOPE(".glb binary loading");
-            ret = tinygltf::TinyGLTF().LoadBinaryFromFile(&model, &err, &warn, path);
+            ret = loader.LoadBinaryFromFile(&model, &err, &warn, path);
         }
         else // assume ascii glTF.
         {
             LUMOS_PROFILE_SCOPE(".gltf loading");
-            ret = tinygltf::TinyGLTF().LoadASCIIFromFile(&model, &err, &warn, path);
+            ret = loader.LoadASCIIFromFile(&model, &err, &warn, path);
         }
 
         if(!err.empty())
@@ -833,7 +1042,8 @@ namespace Lumos::Graphics
         {
             LUMOS_PROFILE_SCOPE("Parse GLTF Model");
 
-            auto LoadedMaterials = LoadMaterials(model);
+            DecodeImages(model, deferredImages, StringUtilities::GetFileLocation(path));
+            auto LoadedMaterials = LoadMaterials(model, StringUtilities::GetFileLocation(path));
 
             std::string name = path.substr(path.find_last_of('/') + 1);
 
@@ -849,6 +1059,7 @@ namespace Lumos::Graphics
             {
                 using namespace ozz::animation::offline;
                 GltfImporter impl;
+                impl.SetFsCallbacks(VFSCallbacks);
                 ozz::animation::offline::OzzImporter& importer = impl;
                 OzzImporter::NodeType types                    = {};
 
@@ -0,0 +1,734 @@
+#include "Precompiled.h"
+#include "ModelCache.h"
+#include "Graphics/Model.h"
+#include "Graphics/Mesh.h"
+#include "Graphics/Material.h"
+#include "Graphics/Animation/Skeleton.h"
+#include "Graphics/Animation/Animation.h"
+#include "Graphics/RHI/Texture.h"
+#include "Core/Application.h"
+#include "Core/Buffer.h"
+#include "Core/OS/FileSystem.h"
+#include "Utilities/AssetManager.h"
+#include "Utilities/StringUtilities.h"
+#include "Utilities/Hash.h"
+#include "Utilities/LoadImage.h"
+
+#include <ozz/animation/runtime/animation.h>
+#include <ozz/animation/runtime/skeleton.h>
+#include <ozz/base/io/archive.h>
+#include <ozz/base/io/stream.h>
+#include <ozz/base/memory/allocator.h>
+
+#include <filesystem>
+#include <fstream>
+
+namespace Lumos::Graphics
+{
+    static thread_local std::vector<CookedTexture>* s_CookedTextures   = nullptr;
+    static thread_local std::vector<std::string>* s_CookedDependencies = nullptr;
+
+    void SetCookedTextureList(std::vector<CookedTexture>* textures)
+    {
+        s_CookedTextures = textures;
+    }
+
+    void SetCookedDependencyList(std::vector<std::string>* paths)
+    {
+        s_CookedDependencies = paths;
+    }
+
+    void CookDependency(const std::string& path)
+    {
+        if(s_CookedDependencies && std::find(s_CookedDependencies->begin(), s_CookedDependencies->end(), path) == s_CookedDependencies->end())
+            s_CookedDependencies->push_back(path);
+    }
+
+    void CookTexture(Texture2D* texture, const TextureDesc& desc, uint32_t width, uint32_t height, const uint8_t* pixels)
+    {
+        if(!s_CookedTextures || !texture || !pixels)
+            return;
+
+        CookedTexture& cooked = s_CookedTextures->emplace_back();
+        cooked.Texture        = texture;
+        cooked.Desc           = desc;
+        cooked.Width          = width;
+        cooked.Height         = height;
+        cooked.Pixels.assign(pixels, pixels + size_t(width) * height * 4);
+    }
+
+    void CookTexture(Texture2D* texture, const TextureDesc& desc, const std::string& name, const std::string& path)
+    {
+        if(!s_CookedTextures || !texture)
+            return;
+
+        CookedTexture& cooked = s_CookedTextures->emplace_back();
+        cooked.Texture        = texture;
+        cooked.Desc           = desc;
+        cooked.Name           = name;
+        cooked.Path           = path;
+    }
+
+    struct ModelCacheHeader
+    {
+        char Magic[4]            = { 'L', 'M', 'C', 'H' };
+        uint32_t Version         = ModelCacheVersion;
+        uint64_t SourceHash      = 0;
+        uint32_t DependencyCount = 0;
+        uint32_t TextureCount    = 0;
+        uint32_t MaterialCount   = 0;
+        uint32_t MeshCount       = 0;
+        uint32_t AnimationCount  = 0;
+        uint32_t VertexSize      = sizeof(Vertex);
+        uint32_t AnimVertexSize  = sizeof(AnimVertex);
+        uint32_t Padding         = 0; // Keeps the size a multiple of 8 with no implicit padding
+    };
+
+    // Blobs are aligned so vertex and index data can be uploaded straight from the file buffer
+    static const uint64_t ModelCacheAlignment = 16;
+
+    class ModelCacheWriter
+    {
+    public:
+        ModelCacheWriter(std::ofstream& stream)
+            : m_Stream(stream)
+        {
+        }
+
+        template <typename T>
+        void Write(const T& value)
+        {
+            m_Stream.write((const char*)&value, sizeof(T));
+            m_Offset += sizeof(T);
+        }
+
+        void WriteBytes(const void* data, uint64_t size)
+        {
+            Write(size);
+
+            static const char padding[ModelCacheAlignment] = {};
+            uint64_t aligned                               = (m_Offset + ModelCacheAlignment - 1) & ~(ModelCacheAlignment - 1);
+            m_Stream.write(padding, aligned - m_Offset);
+            m_Stream.write((const char*)data, size);
+            m_Offset = aligned + size;
+        }
+
+        void WriteString(const std::string& value) { WriteBytes(value.data(), value.size()); }
+
+    private:
+        std::ofstream& m_Stream;
+        uint64_t m_Offset = 0;
+    };
+
+    class ModelCacheReader
+    {
+    public:
+        ModelCacheReader(const uint8_t* data, uint64_t size)
+            : m_Data(data)
+            , m_Size(size)
+        {
+        }
+
+        template <typename T>
+        T Read()
+        {
+            T value {};
+            if(!m_Valid || m_Offset + sizeof(T) > m_Size)
+            {
+                m_Valid = false;
+                return value;
+            }
+
+            memcpy(&value, m_Data + m_Offset, sizeof(T));
+            m_Offset += sizeof(T);
+            return value;
+        }
+
+        const uint8_t* ReadBytes(uint64_t& size)
+        {
+            size             = Read<uint64_t>();
+            uint64_t aligned = (m_Offset + ModelCacheAlignment - 1) & ~(ModelCacheAlignment - 1);
+            if(!m_Valid || aligned + size > m_Size)
+            {
+                m_Valid = false;
+                size    = 0;
+                return nullptr;
+            }
+
+            m_Offset = aligned + size;
+            return m_Data + aligned;
+        }
+
+        std::string ReadString()
+        {
+            uint64_t size;
+            const uint8_t* data = ReadBytes(size);
+            return data ? std::string((const char*)data, size) : std::string();
+        }
+
+        bool IsValid() const { return m_Valid; }
+
+    private:
+        const uint8_t* m_Data;
+        uint64_t m_Size;
+        uint64_t m_Offset = 0;
+        bool m_Valid      = true;
+    };
+
+    // Kept under the project root so it doesn't depend on the working directory. Named by the VFS path, so
+    // the same model has the same cache whether it was given as //Assets/... or as a physical path
+    static std::filesystem::path GetModelCachePath(const std::string& path)
+    {
+        std::string vfsPath = path;
+        FileSystem::Get().AbsolutePathToFileSystem(path, vfsPath);
+
+        std::string filename = fmt::format("{0}-{1:x}.lmc", StringUtilities::GetFileName(vfsPath), MurmurHash64A(vfsPath.c_str(), int(vfsPath.size()), 0));
+        return std::filesystem::path(Application::Get().GetProjectSettings().m_ProjectRoot) / "Resources/Cache/Models" / filename;
+    }
+
+    // Zero when the file can't be read
+    static uint64_t HashFile(const std::string& path, uint64_t seed)
+    {
+        int64_t size  = 0;
+        uint8_t* data = FileSystem::Get().ReadFileVFS(path, &size);
+        if(!data || size == 0)
+        {
+            delete[] data;
+            return 0;
+        }
+
+        const uint64_t hash = MurmurHash64A(data, int(size), seed);
+        delete[] data;
+        return hash;
+    }
+
+    // Size and last write time of a dependency, so checking the cache doesn't read every texture it then loads
+    // again. Files only found in a mounted pak can't be stamped and are hashed instead
+    struct DependencyStamp
+    {
+        uint64_t Size = 0;
+        uint64_t Time = 0;
+
+        bool operator==(const DependencyStamp& other) const { return Size == other.Size && Time == other.Time; }
+        bool operator!=(const DependencyStamp& other) const { return !(*this == other); }
+    };
+
+    static DependencyStamp GetDependencyStamp(const std::string& path)
+    {
+        DependencyStamp stamp;
+        std::string physicalPath;
+        if(FileSystem::Get().ResolvePhysicalPath(path, physicalPath))
+        {
+            std::error_code error;
+            const auto size = std::filesystem::file_size(physicalPath, error);
+            const auto time = std::filesystem::last_write_time(physicalPath, error);
+            if(!error)
+            {
+                stamp.Size = uint64_t(size);
+                stamp.Time = uint64_t(time.time_since_epoch().count());
+            }
+            return stamp;
+        }
+
+        stamp.Time = HashFile(path, ModelCacheVersion);
+        return stamp;
+    }
+
+    uint64_t Model::HashModelSource(const std::string& path)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        const uint64_t hash = HashFile(path, ModelCacheVersion);
+        if(hash == 0)
+            return 0;
+
+        // Embedded images are cooked already resized and vertices already quantised, so both settings are part of the source
+        uint32_t importSettings[3];
+        GetMaxImageDimensions(importSettings[0], importSettings[1]);
+        importSettings[2] = GetImportCompactVertices() ? 1 : 0;
+        return MurmurHash64A(importSettings, sizeof(importSettings), hash);
+    }
+
+    // Written field by field, so the cache doesn't depend on the structs' padding or member order
+    static void WriteTextureDesc(ModelCacheWriter& writer, const TextureDesc& desc)
+    {
+        writer.Write<uint32_t>(uint32_t(desc.format));
+        writer.Write<uint32_t>(uint32_t(desc.minFilter));
+        writer.Write<uint32_t>(uint32_t(desc.magFilter));
+        writer.Write<uint32_t>(uint32_t(desc.wrap));
+        writer.Write<uint8_t>(desc.samples);
+        writer.Write<uint16_t>(desc.flags);
+        writer.Write<uint8_t>(desc.srgb ? 1 : 0);
+        writer.Write<uint8_t>(desc.generateMipMaps ? 1 : 0);
+        writer.Write<uint8_t>(desc.anisotropicFiltering ? 1 : 0);
+    }
+
+    static TextureDesc ReadTextureDesc(ModelCacheReader& reader)
+    {
+        TextureDesc desc;
+        desc.format               = RHIFormat(reader.Read<uint32_t>());
+        desc.minFilter            = TextureFilter(reader.Read<uint32_t>());
+        desc.magFilter            = TextureFilter(reader.Read<uint32_t>());
+        desc.wrap                 = TextureWrap(reader.Read<uint32_t>());
+        desc.samples              = reader.Read<uint8_t>();
+        desc.flags                = reader.Read<uint16_t>();
+        desc.srgb                 = reader.Read<uint8_t>() != 0;
+        desc.generateMipMaps      = reader.Read<uint8_t>() != 0;
+        desc.anisotropicFiltering = reader.Read<uint8_t>() != 0;
+        return desc;
+    }
+
+    static void WriteMaterialProperties(ModelCacheWriter& writer, const MaterialProperties& properties)
+    {
+        writer.Write(properties.albedoColour.x);
+        writer.Write(properties.albedoColour.y);
+        writer.Write(properties.albedoColour.z);
+        writer.Write(properties.albedoColour.w);
+        writer.Write(properties.roughness);
+        writer.Write(properties.metallic);
+        writer.Write(properties.reflectance);
+        writer.Write(properties.emissive);
+        writer.Write(properties.albedoMapFactor);
+        writer.Write(properties.metallicMapFactor);
+        writer.Write(properties.roughnessMapFactor);
+        writer.Write(properties.normalMapFactor);
+        writer.Write(properties.emissiveMapFactor);
+        writer.Write(properties.occlusionMapFactor);
+        writer.Write(properties.alphaCutoff);
+        writer.Write(properties.workflow);
+    }
+
+    static MaterialProperties ReadMaterialProperties(ModelCacheReader& reader)
+    {
+        MaterialProperties properties;
+        properties.albedoColour.x     = reader.Read<float>();
+        properties.albedoColour.y     = reader.Read<float>();
+        properties.albedoColour.z     = reader.Read<float>();
+        properties.albedoColour.w     = reader.Read<float>();
+        properties.roughness          = reader.Read<float>();
+        properties.metallic           = reader.Read<float>();
+        properties.reflectance        = reader.Read<float>();
+        properties.emissive           = reader.Read<float>();
+        properties.albedoMapFactor    = reader.Read<float>();
+        properties.metallicMapFactor  = reader.Read<float>();
+        properties.roughnessMapFactor = reader.Read<float>();
+        properties.normalMapFactor    = reader.Read<float>();
+        properties.emissiveMapFactor  = reader.Read<float>();
+        properties.occlusionMapFactor = reader.Read<float>();
+        properties.alphaCutoff        = reader.Read<float>();
+        properties.workflow           = reader.Read<float>();
+        return properties;
+    }
+
+    template <typename T>
+    static std::vector<uint8_t> SaveOzzObject(const T& object)
+    {
+        ozz::io::MemoryStream stream;
+        {
+            ozz::io::OArchive archive(&stream);
+            archive << object;
+        }
+
+        std::vector<uint8_t> bytes(stream.Size());
+        stream.Seek(0, ozz::io::Stream::kSet);
+        stream.Read(bytes.data(), bytes.size());
+        return bytes;
+    }
+
+    template <typename T>
+    static T* LoadOzzObject(const uint8_t* data, uint64_t size)
+    {
+        ozz::io::MemoryStream stream;
+        stream.Write(data, size);
+        stream.Seek(0, ozz::io::Stream::kSet);
+
+        ozz::io::IArchive archive(&stream);
+        if(!archive.TestTag<T>())
+            return nullptr;
+
+        T* object = ozz::New<T>();
+        archive >> *object;
+        return object;
+    }
+
+    void Model::WriteModelCache(const std::string& path, uint64_t sourceHash, const std::vector<CookedTexture>& cookedTextures, const std::vector<std::string>& dependencies)
+    {
+        LUMOS_PROFILE_FUNCTION();
+
+        std::unordered_map<Texture2D*, int32_t> textureIndices;
+        for(size_t i = 0; i < cookedTextures.size(); i++)
+            textureIndices[cookedTextures[i].Texture] = int32_t(i);
+
+        auto animShader = Application::Get().GetAssetManager()->GetAssetData("ForwardPBRAnim").As<Graphics::Shader>();
+
+        std::vector<Material*> materials;
+        std::unordered_map<Material*, int32_t> materialIndices;
+        for(auto& mesh : m_Meshes)
+        {
+            if(!mesh->GetCookedData())
+            {
+                LUMOS_LOG_WARN("Mesh {0} has no cooked data, not caching {1}", mesh->GetName(), path);
+                return;
+            }
+
+            Material* material = mesh->GetMaterial().get();
+            if(material && materialIndices.find(material) == materialIndices.end())
+            {
+                materialIndices[material] = int32_t(materials.size());
+                materials.push_back(material);
+            }
+        }
+
+        auto TextureIndex = [&](const SharedPtr<Texture2D>& texture)
+        {
+            if(!texture)
+                return -1;
+
+            auto it = textureIndices.find(texture.get());
+            return it == textureIndices.end() ? -2 : it->second;
+        };
+
+        // Every referenced texture needs a cooked source or the cache can't rebuild the materials
+        for(auto material : materials)
+        {
+            const auto& textures = material->GetTextures();
+            for(auto texture : { textures.albedo, textures.normal, textures.metallic, textures.roughness, textures.ao, textures.emissive })
+            {
+                if(TextureIndex(texture) == -2)
+                {
+                    LUMOS_LOG_WARN("Texture in material {0} was not cooked, not caching {1}", material->GetName(), path);
+                    return;
+                }
+            }
+        }
+
+        // Texture files loaded by path are checked along with the other files the import read
+        std::vector<std::string> dependencyPaths = dependencies;
+        for(auto& texture : cookedTextures)
+        {
+            if(texture.Pixels.empty() && std::find(dependencyPaths.begin(), dependencyPaths.end(), texture.Path) == dependencyPaths.end())
+                dependencyPaths.push_back(texture.Path);
+        }
+        dependencyPaths.erase(std::remove(dependencyPaths.begin(), dependencyPaths.end(), path), dependencyPaths.end());
+
+        std::filesystem::path filepath = GetModelCachePath(path);
+        if(!std::filesystem::exists(filepath.parent_path()))
+            std::filesystem::create_directories(filepath.parent_path());
+
+        std::ofstream stream(filepath, std::ios::binary | std::ios::trunc);
+        if(!stream)
+        {
+            LUMOS_LOG_ERROR("Failed to cache model to {0}", filepath.string());
+            return;
+        }
+
+        ModelCacheWriter writer(stream);
+
+        ModelCacheHeader header;
+        header.SourceHash      = sourceHash;
+        header.DependencyCount = uint32_t(dependencyPaths.size());
+        header.TextureCount    = uint32_t(cookedTextures.size());
+        header.MaterialCount   = uint32_t(materials.size());
+        header.MeshCount       = uint32_t(m_Meshes.size());
+        header.AnimationCount  = uint32_t(m_Animation.size());
+        writer.Write(header);
+
+        for(auto& dependency : dependencyPaths)
+        {
+            const DependencyStamp stamp = GetDependencyStamp(dependency);
+            writer.WriteString(dependency);
+            writer.Write(stamp.Size);
+            writer.Write(stamp.Time);
+        }
+
+        for(auto& texture : cookedTextures)
+        {
+            writer.Write<uint8_t>(texture.Pixels.empty() ? 0 : 1);
+            WriteTextureDesc(writer, texture.Desc);
+            if(texture.Pixels.empty())
+            {
+                writer.WriteString(texture.Name);
+                writer.WriteString(texture.Path);
+            }
+            else
+            {
+                writer.Write(texture.Width);
+                writer.Write(texture.Height);
+                writer.WriteBytes(texture.Pixels.data(), texture.Pixels.size());
+            }
+        }
+
+        for(auto material : materials)
+        {
+            const auto& textures = material->GetTextures();
+            writer.WriteString(material->GetName());
+            writer.Write<uint8_t>(animShader && material->GetShader() == animShader ? 1 : 0);
+            WriteMaterialProperties(writer, *material->GetProperties());
+            writer.Write(material->GetFlags());
+            writer.Write<int32_t>(TextureIndex(textures.albedo));
+            writer.Write<int32_t>(TextureIndex(textures.normal));
+            writer.Write<int32_t>(TextureIndex(textures.metallic));
+            writer.Write<int32_t>(TextureIndex(textures.roughness));
+            writer.Write<int32_t>(TextureIndex(textures.ao));
+            writer.Write<int32_t>(TextureIndex(textures.emissive));
+        }
+
+        for(auto& mesh : m_Meshes)
+        {
+            const MeshCookedData& cooked = *mesh->GetCookedData();
+            const bool animated          = mesh->GetAnimVertexBuffer() != nullptr;
+            auto materialIt              = materialIndices.find(mesh->GetMaterial().get());
+
+            writer.WriteString(mesh->GetName());
+            writer.Write<int32_t>(materialIt == materialIndices.end() ? -1 : materialIt->second);
+            writer.Write(mesh->m_VertexFormat);
+            writer.Write<uint8_t>(animated ? 1 : 0);
+            writer.Write(mesh->m_PositionMin);
+            writer.Write(mesh->m_PositionExtent);
+            writer.Write(mesh->m_BoundingBox->Min());
+            writer.Write(mesh->m_BoundingBox->Max());
+            writer.WriteBytes(cooked.Vertices.data(), cooked.Vertices.size());
+            writer.WriteBytes(cooked.Indices.data(), cooked.Indices.size() * sizeof(uint32_t));
+
+            // Compact static meshes still keep full vertices on the CPU for collision
+            bool storeFullVertices = !animated && mesh->IsCompact();
+            writer.WriteBytes(mesh->m_Vertices.data(), storeFullVertices ? mesh->m_Vertices.size() * sizeof(Vertex) : 0);
+
+            writer.Write(uint32_t(mesh->m_LODs.size()));
+            for(size_t i = 0; i < mesh->m_LODs.size(); i++)
+            {
+                writer.Write(mesh->m_LODs[i].Error);
+                writer.WriteBytes(cooked.LODIndices[i].data(), cooked.LODIndices[i].size() * sizeof(uint32_t));
+            }
+        }
+
+        const bool hasSkeleton = m_Skeleton && m_Skeleton->Valid();
+        writer.Write<uint8_t>(hasSkeleton ? 1 : 0);
+        if(hasSkeleton)
+        {
+            auto skeletonData = SaveOzzObject(m_Skeleton->GetSkeleton());
+            writer.WriteBytes(skeletonData.data(), skeletonData.size());
+            writer.WriteBytes(m_BindPoses.data(), m_BindPoses.size() * sizeof(glm::mat4));
+
+            for(auto& animation : m_Animation)
+            {
+                auto animationData = SaveOzzObject(animation->GetAnimation());
+                writer.WriteString(animation->GetName());
+                writer.WriteBytes(animationData.data(), animationData.size());
+            }
+        }
+
+        LUMOS_LOG_INFO("Cached model {0} to {1}", path, filepath.string());
+    }
+
+    bool Model::LoadModelCache(const std::string& path, uint64_t sourceHash)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        std::filesystem::path filepath = GetModelCachePath(path);
+        if(sourceHash == 0 || !std::filesystem::exists(filepath))
+            return false;
+
+        // Parsed straight from the mapped pages, mesh data is only copied once into the GPU buffers
+        FileView storage;
+        if(!storage.Open(filepath.string()) || storage.GetSize() < sizeof(ModelCacheHeader))
+            return false;
+
+        ModelCacheReader reader(storage.GetData(), storage.GetSize());
+        ModelCacheHeader header = reader.Read<ModelCacheHeader>();
+        ModelCacheHeader expected;
+
+        if(memcmp(header.Magic, expected.Magic, sizeof(header.Magic)) != 0 || header.Version != ModelCacheVersion || header.SourceHash != sourceHash
+           || header.VertexSize != expected.VertexSize || header.AnimVertexSize != expected.AnimVertexSize)
+        {
+            return false;
+        }
+
+        // Checked before creating anything. Only the source itself is hashed, a missing dependency stamps as zero
+        for(uint32_t i = 0; i < header.DependencyCount; i++)
+        {
+            std::string dependency = reader.ReadString();
+            DependencyStamp stamp;
+            stamp.Size = reader.Read<uint64_t>();
+            stamp.Time = reader.Read<uint64_t>();
+            if(!reader.IsValid() || stamp == DependencyStamp() || GetDependencyStamp(dependency) != stamp)
+                return false;
+        }
+
+        std::vector<SharedPtr<Texture2D>> textures(header.TextureCount);
+        for(auto& texture : textures)
+        {
+            uint8_t embedded = reader.Read<uint8_t>();
+            TextureDesc desc = ReadTextureDesc(reader);
+            if(embedded)
+            {
+                uint32_t width  = reader.Read<uint32_t>();
+                uint32_t height = reader.Read<uint32_t>();
+                uint64_t size;
+                const uint8_t* pixels = reader.ReadBytes(size);
+                if(pixels && size == uint64_t(width) * height * 4)
+                    texture = SharedPtr<Texture2D>(Texture2D::CreateFromSource(width, height, (void*)pixels, desc));
+            }
+            else
+            {
+                std::string name     = reader.ReadString();
+                std::string filePath = reader.ReadString();
+                if(reader.IsValid())
+                    texture = SharedPtr<Texture2D>(Texture2D::CreateFromFile(name, filePath, desc));
+            }
+        }
+
+        // Same shaders the importers pick, so a cached skinned model matches a fresh import
+        auto shader     = Application::Get().GetAssetManager()->GetAssetData("ForwardPBR").As<Graphics::Shader>();
+        auto animShader = Application::Get().GetAssetManager()->GetAssetData("ForwardPBRAnim").As<Graphics::Shader>();
+        auto TextureAt  = [&](int32_t index)
+        {
+            return index >= 0 && index < int32_t(textures.size()) ? textures[index] : SharedPtr<Texture2D>();
+        };
+
+        std::vector<SharedPtr<Material>> materials(header.MaterialCount);
+        for(auto& material : materials)
+        {
+            std::string name              = reader.ReadString();
+            bool animated                 = reader.Read<uint8_t>() != 0;
+            MaterialProperties properties = ReadMaterialProperties(reader);
+            uint32_t flags                = reader.Read<uint32_t>();
+
+            PBRMataterialTextures pbrTextures;
+            pbrTextures.albedo    = TextureAt(reader.Read<int32_t>());
+            pbrTextures.normal    = TextureAt(reader.Read<int32_t>());
+            pbrTextures.metallic  = TextureAt(reader.Read<int32_t>());
+            pbrTextures.roughness = TextureAt(reader.Read<int32_t>());
+            pbrTextures.ao        = TextureAt(reader.Read<int32_t>());
+            pbrTextures.emissive  = TextureAt(reader.Read<int32_t>());
+
+            material = CreateSharedPtr<Material>(animated ? animShader : shader);
+            material->SetTextures(pbrTextures);
+            material->SetMaterialProperites(properties);
+            material->SetName(name);
+            for(uint32_t bit = 0; bit < 32; bit++)
+            {
+                if(flags & BIT(bit))
+                    material->SetFlag((Material::RenderFlags)BIT(bit));
+            }
+        }
+
+        std::vector<SharedPtr<Mesh>> meshes(header.MeshCount);
+        for(auto& mesh : meshes)
+        {
+            mesh                   = CreateSharedPtr<Mesh>();
+            mesh->m_Name           = reader.ReadString();
+            int32_t materialIndex  = reader.Read<int32_t>();
+            mesh->m_VertexFormat   = reader.Read<VertexFormat>();
+            bool animated          = reader.Read<uint8_t>() != 0;
+            mesh->m_PositionMin    = reader.Read<glm::vec4>();
+            mesh->m_PositionExtent = reader.Read<glm::vec4>();
+            glm::vec3 boundsMin    = reader.Read<glm::vec3>();
+            glm::vec3 boundsMax    = reader.Read<glm::vec3>();
+            mesh->m_BoundingBox    = CreateSharedPtr<Maths::BoundingBox>(boundsMin, boundsMax);
+
+            uint64_t vertexSize, indexSize, fullVertexSize;
+            const uint8_t* vertexData     = reader.ReadBytes(vertexSize);
+            const uint8_t* indexData      = reader.ReadBytes(indexSize);
+            const uint8_t* fullVertexData = reader.ReadBytes(fullVertexSize);
+            if(!reader.IsValid())
+                break;
+
+            // Written while the compact pipeline was available, rebuild from source in the full format
+            if(mesh->IsCompact() && !Mesh::GetCompactVerticesSupported())
+            {
+                LUMOS_LOG_INFO("Model cache {0} uses compact vertices, reloading from source", filepath.string());
+                return false;
+            }
+
+            if(materialIndex >= 0 && materialIndex < int32_t(materials.size()))
+                mesh->m_Material = materials[materialIndex];
+
+            // Upload straight from the file buffer
+            auto vertexBuffer = SharedPtr<VertexBuffer>(VertexBuffer::Create(uint32_t(vertexSize), vertexData, BufferUsage::STATIC));
+            if(animated)
+                mesh->m_AnimVertexBuffer = vertexBuffer;
+            else
+                mesh->m_VertexBuffer = vertexBuffer;
+
+            uint32_t indexCount = uint32_t(indexSize / sizeof(uint32_t));
+            mesh->m_IndexBuffer = SharedPtr<IndexBuffer>(IndexBuffer::Create((uint32_t*)indexData, indexCount));
+
+            // Static meshes keep CPU data, as when built from source
+            if(!animated)
+            {
+                mesh->m_Indices.assign((const uint32_t*)indexData, (const uint32_t*)indexData + indexCount);
+
+                if(!mesh->IsCompact())
+                    mesh->m_Vertices.assign((const Vertex*)vertexData, (const Vertex*)(vertexData + vertexSize));
+                else
+                    mesh->m_Vertices.assign((const Vertex*)fullVertexData, (const Vertex*)(fullVertexData + fullVertexSize));
+            }
+
+            uint32_t lodCount = reader.Read<uint32_t>();
+            for(uint32_t i = 0; i < lodCount && reader.IsValid(); i++)
+            {
+                MeshLOD lod;
+                lod.Error = reader.Read<float>();
+                uint64_t lodSize;
+                const uint8_t* lodData = reader.ReadBytes(lodSize);
+                if(!lodData)
+                    break;
+
+                lod.IndexCount = uint32_t(lodSize / sizeof(uint32_t));
+                lod.Indices    = SharedPtr<IndexBuffer>(IndexBuffer::Create((uint32_t*)lodData, lod.IndexCount));
+                mesh->m_LODs.push_back(lod);
+            }
+
+#ifndef LUMOS_PRODUCTION
+            uint32_t vertexStride           = mesh->IsCompact() ? (animated ? sizeof(CompactAnimVertex) : sizeof(CompactVertex)) : (animated ? sizeof(AnimVertex) : sizeof(Vertex));
+            mesh->m_Stats.VertexCount       = uint32_t(vertexSize / vertexStride);
+            mesh->m_Stats.TriangleCount     = mesh->m_Stats.VertexCount / 3;
+            mesh->m_Stats.IndexCount        = indexCount;
+            mesh->m_Stats.OptimiseThreshold = 1.0f;
+#endif
+        }
+
+        SharedPtr<Skeleton> skeleton;
+        std::vector<glm::mat4> bindPoses;
+        std::vector<SharedPtr<Animation>> animations;
+
+        bool hasSkeleton = reader.IsValid() && reader.Read<uint8_t>() != 0;
+
+        if(hasSkeleton)
+        {
+            uint64_t size;
+            const uint8_t* data = reader.ReadBytes(size);
+            auto ozzSkeleton    = data ? LoadOzzObject<ozz::animation::Skeleton>(data, size) : nullptr;
+            if(ozzSkeleton)
+                skeleton = CreateSharedPtr<Skeleton>(ozzSkeleton);
+
+            const uint8_t* poses = reader.ReadBytes(size);
+            if(poses)
+                bindPoses.assign((const glm::mat4*)poses, (const glm::mat4*)(poses + size));
+
+            for(uint32_t i = 0; i < header.AnimationCount && skeleton; i++)
+            {
+                std::string name  = reader.ReadString();
+                data              = reader.ReadBytes(size);
+                auto ozzAnimation = data ? LoadOzzObject<ozz::animation::Animation>(data, size) : nullptr;
+                if(!ozzAnimation)
+                    break;
+
+                animations.push_back(CreateSharedPtr<Animation>(name, ozzAnimation, skeleton));
+            }
+        }
+
+        storage.Close();
+
+        if(!reader.IsValid() || (hasSkeleton && (!skeleton || animations.size() != header.AnimationCount)))
+        {
+            LUMOS_LOG_WARN("Model cache {0} is corrupt, reloading from source", filepath.string());
+            return false;
+        }
+
+        m_Meshes    = meshes;
+        m_Skeleton  = skeleton;
+        m_BindPoses = bindPoses;
+        m_Animation = animations;
+        return true;
+    }
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include "Graphics/RHI/Definitions.h"
+
+namespace Lumos
+{
+    namespace Graphics
+    {
+        class Texture2D;
+
+        // Bump when the cache layout or anything the importers bake into it changes
+        static const uint32_t ModelCacheVersion = 4;
+
+        // Texture source captured during import, either a file path or the decoded RGBA8 pixels. Pixels are only
+        // kept for images embedded in the model file
+        struct CookedTexture
+        {
+            Texture2D* Texture = nullptr;
+            TextureDesc Desc;
+            std::string Name;
+            std::string Path;
+            uint32_t Width  = 0;
+            uint32_t Height = 0;
+            std::vector<uint8_t> Pixels;
+        };
+
+        // Importers report the textures they create here. Does nothing unless a model is being cooked on this thread
+        void SetCookedTextureList(std::vector<CookedTexture>* textures);
+        void CookTexture(Texture2D* texture, const TextureDesc& desc, uint32_t width, uint32_t height, const uint8_t* pixels);
+        void CookTexture(Texture2D* texture, const TextureDesc& desc, const std::string& name, const std::string& path);
+
+        // Other files read while importing, like glTF buffers and .mtl files. The cache stores their sizes and write
+        // times and is rebuilt when any of them or a cooked texture file changes
+        void SetCookedDependencyList(std::vector<std::string>* paths);
+        void CookDependency(const std::string& path);
+    }
+}
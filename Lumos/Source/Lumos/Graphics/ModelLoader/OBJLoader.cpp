@@ -2,6 +2,7 @@
 #include "Graphics/Model.h"
 #include "Graphics/Mesh.h"
 #include "Graphics/Material.h"
+#include "Graphics/ModelLoader/ModelCache.h"
 #include "Maths/Transform.h"
 #include "Graphics/RHI/Texture.h"
 #include "Maths/Maths.h"
@@ -17,6 +18,38 @@ namespace Lumos
     std::string m_Directory;
     std::vector<SharedPtr<Graphics::Texture2D>> m_Textures;
 
+    // Reads .mtl files next to the model through the VFS, tinyobj's own reader only opens physical files
+    class VFSMaterialReader : public tinyobj::MaterialReader
+    {
+    public:
+        explicit VFSMaterialReader(const std::string& directory)
+            : m_Directory(directory)
+        {
+        }
+
+        bool operator()(const std::string& matId, std::vector<tinyobj::material_t>* materials, std::map<std::string, int>* matMap, std::string* err) override
+        {
+            const std::string filePath = m_Directory + matId;
+            if(!FileSystem::Get().FileExistsVFS(filePath))
+            {
+                if(err)
+                    *err += "WARN: Material file [ " + filePath + " ] not found.\n";
+                return false;
+            }
+
+            Graphics::CookDependency(filePath);
+            std::istringstream stream(FileSystem::Get().ReadTextFileVFS(filePath));
+            std::string warning;
+            tinyobj::LoadMtl(matMap, materials, &stream, &warning);
+            if(err)
+                *err += warning;
+            return true;
+        }
+
+    private:
+        std::string m_Directory;
+    };
+
     SharedPtr<Graphics::Texture2D> LoadMaterialTextures(const std::string& typeName, std::vector<SharedPtr<Graphics::Texture2D>>& textures_loaded, const std::string& name, const std::string& directory, Graphics::TextureDesc format)
     {
         for(uint32_t j = 0; j < textures_loaded.size(); j++)
@@ -32,6 +65,7 @@ namespace Lumos
             std::string filePath = directory + name;
             filePath             = StringUtilities::BackSlashesToSlashes(filePath);
             auto texture         = SharedPtr<Graphics::Texture2D>(Graphics::Texture2D::CreateFromFile(typeName, filePath, format, options));
+            Graphics::CookTexture(texture.get(), format, typeName, filePath);
             textures_loaded.push_back(texture); // Store it as texture loaded for entire model, to ensure we won't unnecessary load duplicate textures.
 
             return texture;
@@ -53,8 +87,9 @@ namespace Lumos
 
         std::string name = StringUtilities::GetFileName(resolvedPath);
 
-        bool ok = tinyobj::LoadObj(
-            &attrib, &shapes, &materials, &error, (resolvedPath).c_str(), (m_Directory).c_str());
+        std::istringstream stream(FileSystem::Get().ReadTextFileVFS(resolvedPath));
+        VFSMaterialReader materialReader(m_Directory);
+        bool ok = tinyobj::LoadObj(&attrib, &shapes, &materials, &error, &stream, &materialReader);
 
         if(!ok)
         {
@@ -179,7 +214,8 @@ namespace Lumos
 
             pbrMaterial->SetTextures(textures);
 
-            auto mesh = CreateSharedPtr<Graphics::Mesh>(indices, vertices);
+            const auto vertexFormat = GetImportCompactVertices() ? Graphics::VertexFormat::Compact : Graphics::VertexFormat::Full;
+            auto mesh               = CreateSharedPtr<Graphics::Mesh>(indices, vertices, false, 0.95f, vertexFormat, 4);
             mesh->SetMaterial(pbrMaterial);
             mesh->GenerateTangentsAndBitangents(vertices.data(), uint32_t(numVertices), indices.data(), uint32_t(numIndices));
 
@@ -41,7 +41,6 @@ namespace Lumos
                 return m_Size;
             }
 
-        private:
             void Push(const std::string& name, RHIFormat format, uint32_t size, bool Normalised);
         };
 
@@ -29,6 +29,9 @@ namespace Lumos
             virtual void UnBindPipeline()                                 = 0;
             virtual void EndCurrentRenderPass()                           = 0;
 
+            // Begins the pipeline's render pass for contents recorded into secondary command buffers. Ended by UnBindPipeline
+            virtual void BeginSecondaryRenderPass(Pipeline* pipeline, uint32_t layer) { }
+
         protected:
             static CommandBuffer* (*CreateFunc)();
         };
@@ -84,6 +84,7 @@ namespace Lumos
             R8G8B8A8_Unorm,
 
             R8_UInt,
+            R8G8B8A8_UInt,
 
             R11G11B10_Float,
             R10G10B10A2_Unorm,
@@ -98,6 +99,9 @@ namespace Lumos
             R32G32B32_UInt,
             R32G32B32A32_UInt,
 
+            R16G16B16A16_Unorm,
+            R16G16B16A16_Snorm,
+
             R16_Float,
             R16G16_Float,
             R16G16B16_Float,
@@ -268,6 +272,26 @@ namespace Lumos
             std::string fullName;
         };
 
+        // A uniform buffer member resolved once with DescriptorSet::GetUniformHandle.
+        // Valid for any descriptor set created from the same shader layout
+        struct UniformHandle
+        {
+            uint32_t BufferIndex = ~0u;
+            uint32_t Offset      = 0;
+            uint32_t Size        = 0;
+
+            bool IsValid() const { return BufferIndex != ~0u; }
+        };
+
+        // A push constant block member resolved once with PushConstant::GetHandle, so per draw writes skip the name lookup
+        struct PushConstantHandle
+        {
+            uint32_t Offset = 0;
+            uint32_t Size   = 0;
+
+            bool IsValid() const { return Size != 0; }
+        };
+
         struct VertexInputDescription
         {
             uint32_t binding;
@@ -470,6 +494,24 @@ namespace Lumos
             {
                 memcpy(data, value, size);
             }
+
+            // Invalid when the block has no member called name, some shader variants leave members out
+            inline PushConstantHandle GetHandle(const std::string& name) const
+            {
+                for(auto& member : m_Members)
+                {
+                    if(member.name == name)
+                        return { member.offset, member.size };
+                }
+                return {};
+            }
+
+            // Writes a resolved member into caller owned storage, does nothing for an invalid handle
+            inline void SetValue(uint8_t* target, const PushConstantHandle& handle, const void* value) const
+            {
+                if(handle.IsValid())
+                    memcpy(&target[handle.Offset], value, handle.Size);
+            }
         };
 
         struct DescriptorSetInfo
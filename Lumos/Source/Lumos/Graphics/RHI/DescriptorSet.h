@@ -6,6 +6,9 @@ namespace Lumos
     struct Buffer;
     namespace Graphics
     {
+        class TransientBuffer;
+        struct TransientAllocation;
+
         class DescriptorSet
         {
         public:
@@ -22,8 +25,14 @@ namespace Lumos
             virtual void SetUniform(const std::string& bufferName, const std::string& uniformName, void* data)                                   = 0;
             virtual void SetUniform(const std::string& bufferName, const std::string& uniformName, void* data, uint32_t size)                    = 0;
             virtual void SetUniformBufferData(const std::string& bufferName, void* data)                                                         = 0;
+            virtual UniformHandle GetUniformHandle(const std::string& bufferName, const std::string& uniformName)                                = 0;
+            virtual void SetUniform(const UniformHandle& handle, const void* data)                                                               = 0;
+            virtual void SetUniform(const UniformHandle& handle, const void* data, uint32_t size)                                                = 0;
             virtual void TransitionImages(CommandBuffer* commandBuffer = nullptr) { }
             virtual void SetUniformDynamic(const std::string& bufferName, uint32_t size) { }
+
+            // Sources the whole block holding the uniform from a transient allocation until another one is set
+            virtual void SetUniformTransient(const UniformHandle& handle, TransientBuffer* buffer, const TransientAllocation& allocation) { }
             virtual Buffer* GetUniformBufferLocalData(const std::string& name) { return nullptr; }
 
         protected:
@@ -7,6 +7,10 @@ namespace Lumos
 {
     namespace Graphics
     {
+        class BufferLayout;
+        class RenderPass;
+        class Framebuffer;
+
         struct PipelineDesc
         {
             SharedPtr<Shader> shader;
@@ -29,6 +33,7 @@ namespace Lumos
             Texture* cubeMapTarget                                 = nullptr;
             Texture* depthTarget                                   = nullptr;
             Texture* depthArrayTarget                              = nullptr;
+            const BufferLayout* vertexLayout                       = nullptr; // Overrides the layout reflected from the shader
             float clearColour[4]                                   = { 0.2f, 0.2f, 0.2f, 1.0f };
             float lineWidth                                        = 1.0f;
             float depthBiasConstantFactor                          = 0.0f;
@@ -56,6 +61,11 @@ namespace Lumos
 
             virtual void ClearRenderTargets(CommandBuffer* commandBuffer) { }
             virtual Shader* GetShader() const = 0;
+            const PipelineDesc& GetDesc() const { return m_Description; }
+
+            // Targets a draw with this pipeline records into, pipelines sharing both can be recorded in one render pass
+            virtual RenderPass* GetRenderPass() const { return nullptr; }
+            virtual Framebuffer* GetFramebuffer(uint32_t layer = 0) const { return nullptr; }
 
             uint32_t GetWidth();
             uint32_t GetHeight();
@@ -15,6 +15,12 @@
 #include "CompiledSPV/Headers/ForwardPBRAnimvertspv.hpp"
 #include "CompiledSPV/Headers/ForwardPBRvertspv.hpp"
 #include "CompiledSPV/Headers/ForwardPBRfragspv.hpp"
+#include "CompiledSPV/Headers/ForwardPBRCompactvertspv.hpp"
+#include "CompiledSPV/Headers/ForwardPBRAnimCompactvertspv.hpp"
+#include "CompiledSPV/Headers/ShadowCompactvertspv.hpp"
+#include "CompiledSPV/Headers/ShadowAnimCompactvertspv.hpp"
+#include "CompiledSPV/Headers/ForwardPBRInstancedvertspv.hpp"
+#include "CompiledSPV/Headers/ShadowInstancedvertspv.hpp"
 
 #include "CompiledSPV/Headers/Skyboxvertspv.hpp"
 #include "CompiledSPV/Headers/Skyboxfragspv.hpp"
@@ -127,6 +133,23 @@ namespace Lumos
                 LoadShaderEmbedded("SSAOBlur", ScreenPass, SSAOBlur);
                 LoadShaderEmbedded("Particle", Particle, Particle);
 
+                // Compact vertex format variants, see Graphics::VertexFormat
+                LoadShaderEmbedded("ForwardPBRCompact", ForwardPBRCompact, ForwardPBR);
+                LoadShaderEmbedded("ForwardPBRAnimCompact", ForwardPBRAnimCompact, ForwardPBR);
+                LoadShaderEmbedded("ShadowCompact", ShadowCompact, Shadow);
+                LoadShaderEmbedded("ShadowAlphaCompact", ShadowCompact, ShadowAlpha);
+                LoadShaderEmbedded("ShadowAnimCompact", ShadowAnimCompact, Shadow);
+                LoadShaderEmbedded("ShadowAnimAlphaCompact", ShadowAnimCompact, ShadowAlpha);
+                LoadShaderEmbedded("DepthPrePassCompact", ForwardPBRCompact, DepthPrePass);
+                LoadShaderEmbedded("DepthPrePassAlphaCompact", ForwardPBRCompact, DepthPrePassAlpha);
+                LoadShaderEmbedded("DepthPrePassAnimCompact", ForwardPBRAnimCompact, DepthPrePass);
+                LoadShaderEmbedded("DepthPrePassAlphaAnimCompact", ForwardPBRAnimCompact, DepthPrePassAlpha);
+
+                // Instanced variants, transforms come from a per frame uniform window
+                LoadShaderEmbedded("ForwardPBRInstanced", ForwardPBRInstanced, ForwardPBR);
+                LoadShaderEmbedded("ShadowInstanced", ShadowInstanced, Shadow);
+                LoadShaderEmbedded("DepthPrePassInstanced", ForwardPBRInstanced, DepthPrePass);
+
                 if(Renderer::GetCapabilities().SupportCompute)
                 {
                     LoadComputeShaderEmbedded("BloomComp", Bloom);
@@ -170,6 +193,23 @@ namespace Lumos
                 LoadShaderFromFile("DepthPrePassAnim", "Shaders/DepthPrePassAnim.shader");
                 LoadShaderFromFile("DepthPrePassAlphaAnim", "Shaders/DepthPrePassAlphaAnim.shader")
 
+                // Compact vertex format variants, see Graphics::VertexFormat
+                LoadShaderFromFile("ForwardPBRCompact", "Shaders/ForwardPBRCompact.shader");
+                LoadShaderFromFile("ForwardPBRAnimCompact", "Shaders/ForwardPBRAnimCompact.shader");
+                LoadShaderFromFile("ShadowCompact", "Shaders/ShadowCompact.shader");
+                LoadShaderFromFile("ShadowAlphaCompact", "Shaders/ShadowAlphaCompact.shader");
+                LoadShaderFromFile("ShadowAnimCompact", "Shaders/ShadowAnimCompact.shader");
+                LoadShaderFromFile("ShadowAnimAlphaCompact", "Shaders/ShadowAnimAlphaCompact.shader");
+                LoadShaderFromFile("DepthPrePassCompact", "Shaders/DepthPrePassCompact.shader");
+                LoadShaderFromFile("DepthPrePassAlphaCompact", "Shaders/DepthPrePassAlphaCompact.shader");
+                LoadShaderFromFile("DepthPrePassAnimCompact", "Shaders/DepthPrePassAnimCompact.shader");
+                LoadShaderFromFile("DepthPrePassAlphaAnimCompact", "Shaders/DepthPrePassAlphaAnimCompact.shader");
+
+                // Instanced variants, transforms come from a per frame uniform window
+                LoadShaderFromFile("ForwardPBRInstanced", "Shaders/ForwardPBRInstanced.shader");
+                LoadShaderFromFile("ShadowInstanced", "Shaders/ShadowInstanced.shader");
+                LoadShaderFromFile("DepthPrePassInstanced", "Shaders/DepthPrePassInstanced.shader");
+
                     if(Renderer::GetCapabilities().SupportCompute)
                 {
                     LoadShaderFromFile("FXAAComp", "Shaders/FXAACompute.shader");
@@ -187,15 +227,17 @@ namespace Lumos
             return Application::Get().GetWindow()->GetSwapChain();
         }
 
-        void Renderer::DrawMesh(CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, Graphics::Mesh* mesh)
+        void Renderer::DrawMesh(CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, Graphics::Mesh* mesh, uint32_t lod, uint32_t instanceCount)
         {
             if(mesh->GetAnimVertexBuffer())
                 mesh->GetAnimVertexBuffer()->Bind(commandBuffer, pipeline);
             else
                 mesh->GetVertexBuffer()->Bind(commandBuffer, pipeline);
-            mesh->GetIndexBuffer()->Bind(commandBuffer);
 
-            Renderer::DrawIndexed(commandBuffer, DrawType::TRIANGLE, mesh->GetIndexBuffer()->GetCount());
+            auto& indexBuffer = mesh->GetIndexBuffer(lod);
+            indexBuffer->Bind(commandBuffer);
+
+            Renderer::DrawIndexed(commandBuffer, DrawType::TRIANGLE, indexBuffer->GetCount(), 0, instanceCount);
             // mesh->GetVertexBuffer()->Unbind();
             // mesh->GetIndexBuffer()->Unbind();
         }
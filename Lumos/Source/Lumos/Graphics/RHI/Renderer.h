@@ -23,6 +23,8 @@ namespace Lumos
             int UniformBufferOffsetAlignment = 0;
             bool WideLines                   = false;
             bool SupportCompute              = false;
+            bool SecondaryCommandBuffers     = false; // Command buffers can be recorded on worker threads and executed from the main one
+            bool TextureLayerCopy            = false; // Single layers of array textures can be copied and cleared on the GPU
         };
 
         class LUMOS_EXPORT Renderer
@@ -38,6 +40,8 @@ namespace Lumos
             virtual void Begin()                                   = 0;
             virtual void OnResize(uint32_t width, uint32_t height) = 0;
             virtual void ClearRenderTarget(Graphics::Texture* texture, Graphics::CommandBuffer* commandBuffer, glm::vec4 clearColour = glm::vec4(0.1f, 0.1f, 0.1f, 1.0f)) { }
+            virtual void ClearRenderTargetLayer(Graphics::Texture* texture, uint32_t layer, Graphics::CommandBuffer* commandBuffer) { }
+            virtual bool CopyTextureLayer(Graphics::Texture* source, Graphics::Texture* destination, uint32_t layer, Graphics::CommandBuffer* commandBuffer) { return false; }
             inline static Renderer* GetRenderer()
             {
                 return s_Instance;
@@ -48,7 +52,7 @@ namespace Lumos
             virtual void BindDescriptorSetsInternal(Graphics::Pipeline* pipeline, Graphics::CommandBuffer* commandBuffer, uint32_t dynamicOffset, Graphics::DescriptorSet** descriptorSets, uint32_t descriptorCount) = 0;
 
             virtual const std::string& GetTitleInternal() const                                                                             = 0;
-            virtual void DrawIndexedInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t start) const             = 0;
+            virtual void DrawIndexedInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t start, uint32_t instanceCount) const = 0;
             virtual void DrawInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, DataType datayType, void* indices) const = 0;
             virtual void Dispatch(CommandBuffer* commandBuffer, uint32_t workGroupSizeX, uint32_t workGroupSizeY, uint32_t workGroupSizeZ) { }
             virtual void DrawSplashScreen(Texture* texture) { }
@@ -73,9 +77,9 @@ namespace Lumos
             {
                 s_Instance->DrawInternal(commandBuffer, type, count, datayType, indices);
             }
-            inline static void DrawIndexed(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t start = 0)
+            inline static void DrawIndexed(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t start = 0, uint32_t instanceCount = 1)
             {
-                s_Instance->DrawIndexedInternal(commandBuffer, type, count, start);
+                s_Instance->DrawIndexedInternal(commandBuffer, type, count, start, instanceCount);
             }
             inline static const std::string& GetTitle()
             {
@@ -90,7 +94,7 @@ namespace Lumos
 
             static GraphicsContext* GetGraphicsContext();
             static SwapChain* GetMainSwapChain();
-            static void DrawMesh(CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, Graphics::Mesh* mesh);
+            static void DrawMesh(CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, Graphics::Mesh* mesh, uint32_t lod = 0, uint32_t instanceCount = 1);
 
         protected:
             static Renderer* (*CreateFunc)();
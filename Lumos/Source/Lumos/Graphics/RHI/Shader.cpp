@@ -74,5 +74,15 @@ namespace Lumos
             return ShaderDataType::NONE;
         }
 
+        DescriptorType Shader::GetUniformBufferType(const std::string& blockName)
+        {
+            // Blocks named "*Dynamic" are bound with a dynamic offset per draw
+            static const std::string dynamicSuffix = "Dynamic";
+            if(blockName.size() > dynamicSuffix.size() && blockName.compare(blockName.size() - dynamicSuffix.size(), dynamicSuffix.size(), dynamicSuffix) == 0)
+                return DescriptorType::UNIFORM_BUFFER_DYNAMIC;
+
+            return DescriptorType::UNIFORM_BUFFER;
+        }
+
     }
 }
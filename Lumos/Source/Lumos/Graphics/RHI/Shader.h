@@ -32,10 +32,23 @@ namespace Lumos
             virtual std::vector<PushConstant>& GetPushConstants() = 0;
             virtual PushConstant* GetPushConstant(uint32_t index) { return nullptr; }
             virtual void BindPushConstants(Graphics::CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline) = 0;
+
+            // Records block index from caller owned data. Backends that record on worker threads override this
+            // so the shared block is never written
+            virtual void BindPushConstantData(Graphics::CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, uint32_t index, const uint8_t* data)
+            {
+                auto& pushConstants = GetPushConstants();
+                if(index >= pushConstants.size())
+                    return;
+
+                memcpy(pushConstants[index].data, data, pushConstants[index].size);
+                BindPushConstants(commandBuffer, pipeline);
+            }
             virtual DescriptorSetInfo GetDescriptorInfo(uint32_t index) { return DescriptorSetInfo(); }
             virtual uint64_t GetHash() const { return 0; };
 
             ShaderDataType SPIRVTypeToLumosDataType(const spirv_cross::SPIRType type);
+            static DescriptorType GetUniformBufferType(const std::string& blockName);
 
             SET_ASSET_TYPE(AssetType::Shader);
 
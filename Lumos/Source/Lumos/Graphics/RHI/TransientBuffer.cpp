@@ -0,0 +1,16 @@
+#include "Precompiled.h"
+#include "TransientBuffer.h"
+
+namespace Lumos
+{
+    namespace Graphics
+    {
+        TransientBuffer* (*TransientBuffer::CreateFunc)(uint32_t) = nullptr;
+
+        TransientBuffer* TransientBuffer::Create(uint32_t blockSize)
+        {
+            LUMOS_ASSERT(CreateFunc, "No TransientBuffer Create Function");
+            return CreateFunc(blockSize);
+        }
+    }
+}
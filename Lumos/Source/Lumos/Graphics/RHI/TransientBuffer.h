@@ -0,0 +1,36 @@
+#pragma once
+#include "Definitions.h"
+
+namespace Lumos
+{
+    namespace Graphics
+    {
+        struct TransientAllocation
+        {
+            uint8_t* Data   = nullptr;
+            uint32_t Offset = 0;
+            uint32_t Size   = 0;
+            uint32_t Block  = 0;
+        };
+
+        // Linear allocator over persistently mapped memory, one set of blocks per frame in flight.
+        // Allocations stay valid until the same frame index is begun again
+        class TransientBuffer
+        {
+        public:
+            virtual ~TransientBuffer() = default;
+            static TransientBuffer* Create(uint32_t blockSize);
+
+            virtual void BeginFrame(uint32_t frameIndex)                                                                                                = 0;
+            virtual TransientAllocation Allocate(uint32_t size, uint32_t alignment = 16)                                                                = 0;
+            virtual void BindVertexBuffer(CommandBuffer* commandBuffer, Pipeline* pipeline, const TransientAllocation& allocation, uint8_t binding = 0) = 0;
+            virtual uint32_t GetAllocatedSize() const                                                                                                   = 0;
+
+            // Gives the unused tail of the most recent allocation back, so a batch can reserve its maximum size up front
+            virtual void Shrink(TransientAllocation& allocation, uint32_t usedSize) = 0;
+
+        protected:
+            static TransientBuffer* (*CreateFunc)(uint32_t);
+        };
+    }
+}
@@ -89,6 +89,9 @@ namespace Lumos
             descriptorDesc.shader      = m_Shader.get();
             m_DescriptorSet.resize(1);
             m_DescriptorSet[0] = SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
+            m_MVPHandle        = m_DescriptorSet[0]->GetUniformHandle("UBO", "u_MVP");
+            m_ViewHandle       = m_DescriptorSet[0]->GetUniformHandle("UBO", "view");
+            m_ProjHandle       = m_DescriptorSet[0]->GetUniformHandle("UBO", "proj");
             UpdateUniformBuffer();
 
             m_CurrentDescriptorSets.resize(1);
@@ -134,9 +137,9 @@ namespace Lumos
             test.maxDistance = m_MaxDistance;
 
             auto invViewProj = proj * view;
-            m_DescriptorSet[0]->SetUniform("UBO", "u_MVP", &invViewProj);
-            m_DescriptorSet[0]->SetUniform("UBO", "view", &view);
-            m_DescriptorSet[0]->SetUniform("UBO", "proj", &proj);
+            m_DescriptorSet[0]->SetUniform(m_MVPHandle, &invViewProj);
+            m_DescriptorSet[0]->SetUniform(m_ViewHandle, &view);
+            m_DescriptorSet[0]->SetUniform(m_ProjHandle, &proj);
 
             m_DescriptorSet[0]->SetUniformBufferData("UniformBuffer", &test);
             m_DescriptorSet[0]->Update();
@@ -51,6 +51,10 @@ namespace Lumos
             float m_GridRes     = 1.0f;
             float m_GridSize    = 1.0f;
             float m_MaxDistance = 100000.0f;
+
+            UniformHandle m_MVPHandle;
+            UniformHandle m_ViewHandle;
+            UniformHandle m_ProjHandle;
         };
     }
 }
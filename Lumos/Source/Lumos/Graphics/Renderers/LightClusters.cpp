@@ -0,0 +1,295 @@
+#include "Precompiled.h"
+#include "LightClusters.h"
+#include "Core/JobSystem.h"
+#include "Maths/MathsUtilities.h"
+
+namespace Lumos
+{
+    namespace Graphics
+    {
+        // Below this the jobs cost more than binning on the calling thread
+        static const uint32_t MinLightsPerBinningJob = 32;
+
+        // Spot attenuation has no hard cut off, use the same reach as the camera frustum cull
+        static const float SpotLightRangeScale = 100.0f;
+
+        // The index list starts this many uvec4s long and doubles when a frame needs more
+        static const uint32_t MinIndexBlocks = 64;
+
+        LightClusters::LightClusters()
+        {
+            m_ClusterCounts.resize(ClusterCount, 0);
+            m_ClusterLights.resize(ClusterCount * MaxLightsPerCluster, 0);
+            m_Ranges.resize(ClusterCount / 4, glm::uvec4(0));
+            m_Indices.resize(MinIndexBlocks, glm::uvec4(0));
+            m_Bounds.reserve(MaxLights);
+        }
+
+        void LightClusters::SetIndexCapacity(uint32_t capacity)
+        {
+            // Whole uvec4s only, and offsets are packed into 16 bits
+            m_IndexCapacity = Maths::Min(capacity, 65536u) & ~7u;
+        }
+
+        void LightClusters::Build(const glm::mat4& view, const glm::mat4& projection, float nearPlane, float farPlane, bool orthographic, const Light* lights, uint32_t lightCount)
+        {
+            LUMOS_PROFILE_FUNCTION();
+            m_View         = view;
+            m_Near         = Maths::Max(nearPlane, 0.001f);
+            m_Far          = Maths::Max(farPlane, m_Near + 0.001f);
+            m_Orthographic = orthographic;
+
+            // Assumes a symmetric projection, which is all Camera creates
+            m_ProjectionParams.x = projection[0][0];
+            m_ProjectionParams.y = projection[1][1];
+            if(m_Orthographic)
+            {
+                m_ProjectionParams.z = float(Slices) / (m_Far - m_Near);
+                m_ProjectionParams.w = -m_Near * m_ProjectionParams.z;
+            }
+            else
+            {
+                m_ProjectionParams.z = float(Slices) / std::log(m_Far / m_Near);
+                m_ProjectionParams.w = -std::log(m_Near) * m_ProjectionParams.z;
+            }
+
+            m_Bounds.clear();
+            lightCount = Maths::Min(lightCount, MaxLights);
+            for(uint32_t i = 0; i < lightCount; i++)
+            {
+                LightBounds bounds;
+                if(ComputeBounds(lights[i], i, bounds))
+                    m_Bounds.push_back(bounds);
+            }
+
+            // Slices don't share clusters, so each job owns its counts and lists
+            if(m_Bounds.size() >= MinLightsPerBinningJob && System::JobSystem::GetThreadCount() > 1)
+            {
+                System::JobSystem::Context context;
+                System::JobSystem::Dispatch(context, Slices, 1, [this](JobDispatchArgs args)
+                                            { BinSlice(args.jobIndex); });
+                System::JobSystem::Wait(context);
+            }
+            else
+            {
+                for(uint32_t slice = 0; slice < Slices; slice++)
+                    BinSlice(slice);
+            }
+
+            uint32_t* ranges = reinterpret_cast<uint32_t*>(m_Ranges.data());
+            uint32_t offset  = 0;
+            m_DroppedCount   = 0;
+
+            for(uint32_t cluster = 0; cluster < ClusterCount; cluster++)
+            {
+                const uint32_t binned = m_ClusterCounts[cluster];
+                const uint32_t tileX  = cluster % TilesX;
+                const uint32_t tileY  = (cluster / TilesX) % TilesY;
+
+                // A light usually covers a run of tiles, so most clusters repeat the list to their left or below
+                uint32_t shared = ~0u;
+                if(binned > 0 && tileX > 0 && SameLights(cluster, cluster - 1))
+                    shared = cluster - 1;
+                else if(binned > 0 && tileY > 0 && SameLights(cluster, cluster - TilesX))
+                    shared = cluster - TilesX;
+
+                if(shared != ~0u)
+                {
+                    ranges[cluster] = ranges[shared];
+                    m_DroppedCount += binned - (ranges[shared] >> 16);
+                    continue;
+                }
+
+                const uint32_t count = Maths::Min(binned, m_IndexCapacity - Maths::Min(offset, m_IndexCapacity));
+                m_DroppedCount += binned - count;
+
+                if((offset + count) > uint32_t(m_Indices.size()) * 8)
+                    m_Indices.resize(Maths::Max(uint32_t(m_Indices.size()) * 2, (offset + count + 7) / 8), glm::uvec4(0));
+
+                uint16_t* indices = reinterpret_cast<uint16_t*>(m_Indices.data());
+                memcpy(indices + offset, &m_ClusterLights[cluster * MaxLightsPerCluster], count * sizeof(uint16_t));
+                ranges[cluster] = offset | (count << 16);
+                offset += count;
+            }
+
+            m_IndexCount = offset;
+        }
+
+        bool LightClusters::ComputeBounds(const Light& light, uint32_t index, LightBounds& bounds) const
+        {
+            if(light.Type == float(LightType::DirectionalLight))
+                return false;
+
+            bounds.Index  = index;
+            bounds.Centre = glm::vec3(m_View * glm::vec4(glm::vec3(light.Position), 1.0f));
+            bounds.Radius = light.Type == float(LightType::SpotLight) ? light.Radius * SpotLightRangeScale : light.Radius;
+
+            // The camera looks down -z
+            const float depth = -bounds.Centre.z;
+            const float r     = bounds.Radius;
+            if(depth + r < m_Near || depth - r > m_Far)
+                return false;
+
+            bounds.MinSlice = SliceIndex(Maths::Max(depth - r, m_Near));
+            bounds.MaxSlice = SliceIndex(Maths::Min(depth + r, m_Far));
+
+            float minX, maxX, minY, maxY;
+            if(m_Orthographic)
+            {
+                minX = (bounds.Centre.x - r) * m_ProjectionParams.x;
+                maxX = (bounds.Centre.x + r) * m_ProjectionParams.x;
+                minY = (bounds.Centre.y - r) * m_ProjectionParams.y;
+                maxY = (bounds.Centre.y + r) * m_ProjectionParams.y;
+            }
+            else if(depth - r <= m_Near)
+            {
+                // Spans the near plane so can cover any part of the screen
+                minX = minY = -1.0f;
+                maxX = maxY = 1.0f;
+            }
+            else
+            {
+                // x / depth is monotonic in both, so the extremes are at the corners of the sphere's bounds
+                const float nearDepth = depth - r;
+                const float farDepth  = depth + r;
+                const float x[2]      = { bounds.Centre.x - r, bounds.Centre.x + r };
+                const float y[2]      = { bounds.Centre.y - r, bounds.Centre.y + r };
+
+                minX = minY = FLT_MAX;
+                maxX = maxY = -FLT_MAX;
+                for(uint32_t i = 0; i < 2; i++)
+                {
+                    for(float d : { nearDepth, farDepth })
+                    {
+                        const float px = x[i] * m_ProjectionParams.x / d;
+                        const float py = y[i] * m_ProjectionParams.y / d;
+                        minX           = Maths::Min(minX, px);
+                        maxX           = Maths::Max(maxX, px);
+                        minY           = Maths::Min(minY, py);
+                        maxY           = Maths::Max(maxY, py);
+                    }
+                }
+            }
+
+            // A negative projection scale flips the axis
+            if(minX > maxX)
+                std::swap(minX, maxX);
+            if(minY > maxY)
+                std::swap(minY, maxY);
+
+            return TileRange(minX, maxX, TilesX, bounds.MinTile[0], bounds.MaxTile[0]) && TileRange(minY, maxY, TilesY, bounds.MinTile[1], bounds.MaxTile[1]);
+        }
+
+        void LightClusters::BinSlice(uint32_t slice)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            const float nearDepth   = SliceDepth(slice);
+            const float farDepth    = SliceDepth(slice + 1);
+            const float tileSize[2] = { 2.0f / float(TilesX), 2.0f / float(TilesY) };
+
+            uint16_t* counts = &m_ClusterCounts[slice * TilesX * TilesY];
+            memset(counts, 0, TilesX * TilesY * sizeof(uint16_t));
+
+            for(const auto& bounds : m_Bounds)
+            {
+                if(slice < bounds.MinSlice || slice > bounds.MaxSlice)
+                    continue;
+
+                const float r2 = bounds.Radius * bounds.Radius;
+
+                // Distance along z is shared by every cluster in the slice
+                const float dz = Maths::Max(Maths::Max(nearDepth + bounds.Centre.z, -farDepth - bounds.Centre.z), 0.0f);
+                if(dz * dz > r2)
+                    continue;
+
+                for(uint32_t y = bounds.MinTile[1]; y <= bounds.MaxTile[1]; y++)
+                {
+                    // View space extent of the tile row across the slice depth range
+                    const float ndcY0 = -1.0f + float(y) * tileSize[1];
+                    const float ndcY1 = ndcY0 + tileSize[1];
+                    float minY, maxY;
+                    if(m_Orthographic)
+                    {
+                        minY = ndcY0 / m_ProjectionParams.y;
+                        maxY = ndcY1 / m_ProjectionParams.y;
+                    }
+                    else
+                    {
+                        const float scale = 1.0f / m_ProjectionParams.y;
+                        minY              = Maths::Min(Maths::Min(ndcY0 * nearDepth, ndcY0 * farDepth), Maths::Min(ndcY1 * nearDepth, ndcY1 * farDepth)) * scale;
+                        maxY              = Maths::Max(Maths::Max(ndcY0 * nearDepth, ndcY0 * farDepth), Maths::Max(ndcY1 * nearDepth, ndcY1 * farDepth)) * scale;
+                    }
+                    if(minY > maxY)
+                        std::swap(minY, maxY);
+
+                    const float dy  = Maths::Max(Maths::Max(minY - bounds.Centre.y, bounds.Centre.y - maxY), 0.0f);
+                    const float dyz = dy * dy + dz * dz;
+                    if(dyz > r2)
+                        continue;
+
+                    for(uint32_t x = bounds.MinTile[0]; x <= bounds.MaxTile[0]; x++)
+                    {
+                        const float ndcX0 = -1.0f + float(x) * tileSize[0];
+                        const float ndcX1 = ndcX0 + tileSize[0];
+                        float minX, maxX;
+                        if(m_Orthographic)
+                        {
+                            minX = ndcX0 / m_ProjectionParams.x;
+                            maxX = ndcX1 / m_ProjectionParams.x;
+                        }
+                        else
+                        {
+                            const float scale = 1.0f / m_ProjectionParams.x;
+                            minX              = Maths::Min(Maths::Min(ndcX0 * nearDepth, ndcX0 * farDepth), Maths::Min(ndcX1 * nearDepth, ndcX1 * farDepth)) * scale;
+                            maxX              = Maths::Max(Maths::Max(ndcX0 * nearDepth, ndcX0 * farDepth), Maths::Max(ndcX1 * nearDepth, ndcX1 * farDepth)) * scale;
+                        }
+                        if(minX > maxX)
+                            std::swap(minX, maxX);
+
+                        const float dx = Maths::Max(Maths::Max(minX - bounds.Centre.x, bounds.Centre.x - maxX), 0.0f);
+                        if(dx * dx + dyz > r2)
+                            continue;
+
+                        const uint32_t tile = x + y * TilesX;
+                        if(counts[tile] < MaxLightsPerCluster)
+                        {
+                            const uint32_t cluster                                        = slice * TilesX * TilesY + tile;
+                            m_ClusterLights[cluster * MaxLightsPerCluster + counts[tile]] = uint16_t(bounds.Index);
+                            counts[tile]++;
+                        }
+                    }
+                }
+            }
+        }
+
+        bool LightClusters::SameLights(uint32_t clusterA, uint32_t clusterB) const
+        {
+            // Lights are binned in the same order for every cluster, so equal sets give equal lists
+            const uint32_t count = m_ClusterCounts[clusterA];
+            return count == m_ClusterCounts[clusterB] && memcmp(&m_ClusterLights[clusterA * MaxLightsPerCluster], &m_ClusterLights[clusterB * MaxLightsPerCluster], count * sizeof(uint16_t)) == 0;
+        }
+
+        uint32_t LightClusters::SliceIndex(float depth) const
+        {
+            const float slice = m_Orthographic ? depth * m_ProjectionParams.z + m_ProjectionParams.w : std::log(depth) * m_ProjectionParams.z + m_ProjectionParams.w;
+            return uint32_t(Maths::Clamp(slice, 0.0f, float(Slices - 1)));
+        }
+
+        float LightClusters::SliceDepth(uint32_t slice) const
+        {
+            const float t = float(slice) / float(Slices);
+            return m_Orthographic ? m_Near + (m_Far - m_Near) * t : m_Near * std::pow(m_Far / m_Near, t);
+        }
+
+        bool LightClusters::TileRange(float minNDC, float maxNDC, uint32_t tiles, uint32_t& minTile, uint32_t& maxTile) const
+        {
+            if(maxNDC < -1.0f || minNDC > 1.0f)
+                return false;
+
+            const float scale = float(tiles) * 0.5f;
+            minTile           = uint32_t(Maths::Clamp((minNDC + 1.0f) * scale, 0.0f, float(tiles - 1)));
+            maxTile           = uint32_t(Maths::Clamp((maxNDC + 1.0f) * scale, 0.0f, float(tiles - 1)));
+            return true;
+        }
+    }
+}
@@ -0,0 +1,89 @@
+#pragma once
+#include "Graphics/Light.h"
+#include <glm/mat4x4.hpp>
+#include <glm/vec4.hpp>
+
+namespace Lumos
+{
+    namespace Graphics
+    {
+        // Splits the view frustum into a grid of froxels and bins point and spot lights into them.
+        // Sizes and packing match Clusters.glslh
+        class LUMOS_EXPORT LightClusters
+        {
+        public:
+            static const uint32_t TilesX       = 16;
+            static const uint32_t TilesY       = 9;
+            static const uint32_t Slices       = 24;
+            static const uint32_t ClusterCount = TilesX * TilesY * Slices;
+
+            // Each stays within the 16KB uniform buffer range every device supports
+            static const uint32_t MaxLights           = 256;
+            static const uint32_t MaxLightsPerCluster = 128;
+
+            // MAX_CLUSTER_INDICES in Clusters.glslh, until the renderer sets the size reflected from the shader
+            static const uint32_t DefaultIndexCapacity = 8192;
+
+            LightClusters();
+
+            // Most indices the shader's index block holds
+            void SetIndexCapacity(uint32_t capacity);
+            uint32_t GetIndexCapacity() const { return m_IndexCapacity; }
+
+            // Indices written to the clusters refer to positions in lights
+            void Build(const glm::mat4& view, const glm::mat4& projection, float nearPlane, float farPlane, bool orthographic, const Light* lights, uint32_t lightCount);
+
+            // One uint per cluster, offset into the index list in the low 16 bits and light count in the high 16.
+            // Neighbouring clusters that see the same lights share one range
+            const glm::uvec4* GetClusterRanges() const { return m_Ranges.data(); }
+            uint32_t GetClusterRangesSize() const { return uint32_t(m_Ranges.size() * sizeof(glm::uvec4)); }
+
+            // 16 bit light indices, eight per uvec4
+            const glm::uvec4* GetLightIndices() const { return m_Indices.data(); }
+            uint32_t GetLightIndicesSize() const { return ((m_IndexCount + 7) / 8) * uint32_t(sizeof(glm::uvec4)); }
+
+            // x, y scale view space to NDC, z, w map view depth to a slice
+            const glm::vec4& GetProjectionParams() const { return m_ProjectionParams; }
+            glm::uvec4 GetDimensions() const { return glm::uvec4(TilesX, TilesY, Slices, m_Orthographic ? 1 : 0); }
+
+            uint32_t GetIndexCount() const { return m_IndexCount; }
+            // Cluster entries left out because the index list reached its capacity
+            uint32_t GetDroppedCount() const { return m_DroppedCount; }
+
+        private:
+            struct LightBounds
+            {
+                glm::vec3 Centre;
+                float Radius;
+                uint32_t Index;
+                uint32_t MinTile[2];
+                uint32_t MaxTile[2];
+                uint32_t MinSlice;
+                uint32_t MaxSlice;
+            };
+
+            bool ComputeBounds(const Light& light, uint32_t index, LightBounds& bounds) const;
+            void BinSlice(uint32_t slice);
+            uint32_t SliceIndex(float depth) const;
+            float SliceDepth(uint32_t slice) const;
+            bool TileRange(float minNDC, float maxNDC, uint32_t tiles, uint32_t& minTile, uint32_t& maxTile) const;
+            bool SameLights(uint32_t clusterA, uint32_t clusterB) const;
+
+            glm::mat4 m_View;
+            glm::vec4 m_ProjectionParams;
+            float m_Near        = 0.1f;
+            float m_Far         = 1000.0f;
+            bool m_Orthographic = false;
+
+            std::vector<LightBounds> m_Bounds;
+            std::vector<uint16_t> m_ClusterCounts;
+            std::vector<uint16_t> m_ClusterLights;
+
+            std::vector<glm::uvec4> m_Ranges;
+            std::vector<glm::uvec4> m_Indices;
+            uint32_t m_IndexCapacity = DefaultIndexCapacity;
+            uint32_t m_IndexCount    = 0;
+            uint32_t m_DroppedCount  = 0;
+        };
+    }
+}
@@ -0,0 +1,306 @@
+#include "Precompiled.h"
+#include "OcclusionCuller.h"
+#include "Graphics/Mesh.h"
+#include "Maths/BoundingBox.h"
+#include "Maths/MathsUtilities.h"
+#include "Core/JobSystem.h"
+
+namespace Lumos
+{
+    namespace Graphics
+    {
+        // Below this the jobs cost more than rasterising on the calling thread
+        static const uint32_t MinTrianglesPerRasterJob = 256;
+
+        // Clip space w below this is treated as crossing the near plane
+        static const float NearClipW = 1e-4f;
+
+        static const float EmptyDepth = FLT_MAX;
+
+        OcclusionCuller::OcclusionCuller()
+        {
+            m_TileTriangles.resize(TilesX * TilesY);
+
+            uint32_t width  = Width;
+            uint32_t height = Height;
+            while(true)
+            {
+                m_Levels.emplace_back(width * height, EmptyDepth);
+                if(width == 1 || height == 1)
+                    break;
+                width /= 2;
+                height /= 2;
+            }
+
+            m_Candidates.reserve(256);
+        }
+
+        void OcclusionCuller::BeginFrame(const glm::mat4& projView)
+        {
+            m_ProjView      = projView;
+            m_OccluderCount = 0;
+            m_Candidates.clear();
+            m_Triangles.clear();
+            for(auto& tile : m_TileTriangles)
+                tile.clear();
+        }
+
+        void OcclusionCuller::AddOccluderCandidate(const Mesh* mesh, const glm::mat4& transform, float screenSize)
+        {
+            AddOccluderCandidate(mesh->GetVertices(), mesh->GetIndices(), transform, screenSize);
+        }
+
+        void OcclusionCuller::AddOccluderCandidate(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, const glm::mat4& transform, float screenSize)
+        {
+            m_Candidates.push_back({ &vertices, &indices, transform, screenSize });
+        }
+
+        void OcclusionCuller::Rasterise()
+        {
+            LUMOS_PROFILE_FUNCTION();
+            if(m_Candidates.size() > MaxOccluders)
+            {
+                std::partial_sort(m_Candidates.begin(), m_Candidates.begin() + MaxOccluders, m_Candidates.end(), [](const Candidate& a, const Candidate& b)
+                                  { return a.ScreenSize > b.ScreenSize; });
+                m_Candidates.resize(MaxOccluders);
+            }
+
+            for(auto& candidate : m_Candidates)
+                AddOccluder(*candidate.Vertices, *candidate.Indices, candidate.Transform);
+
+            // Tiles cover separate pixels, so each job owns its part of the depth buffer
+            if(m_Triangles.size() >= MinTrianglesPerRasterJob && System::JobSystem::GetThreadCount() > 1)
+            {
+                System::JobSystem::Context context;
+                System::JobSystem::Dispatch(context, TilesX * TilesY, 1, [this](JobDispatchArgs args)
+                                            { RasteriseTile(args.jobIndex); });
+                System::JobSystem::Wait(context);
+            }
+            else
+            {
+                for(uint32_t tile = 0; tile < TilesX * TilesY; tile++)
+                    RasteriseTile(tile);
+            }
+
+            BuildPyramid();
+        }
+
+        void OcclusionCuller::AddOccluder(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, const glm::mat4& transform)
+        {
+            if(vertices.empty() || indices.size() < 3)
+                return;
+
+            const glm::mat4 mvp = m_ProjView * transform;
+            m_ClipVertices.resize(vertices.size());
+            for(size_t i = 0; i < vertices.size(); i++)
+                m_ClipVertices[i] = mvp * glm::vec4(vertices[i].Position, 1.0f);
+
+            const float tileWidth  = float(Width / TilesX);
+            const float tileHeight = float(Height / TilesY);
+
+            for(size_t i = 0; i + 2 < indices.size(); i += 3)
+            {
+                ScreenTriangle triangle;
+                bool clipped = false;
+                for(uint32_t j = 0; j < 3; j++)
+                {
+                    const glm::vec4& clip = m_ClipVertices[indices[i + j]];
+
+                    // Dropping triangles that need clipping only ever hides less
+                    if(clip.w < NearClipW || clip.z < 0.0f)
+                    {
+                        clipped = true;
+                        break;
+                    }
+
+                    const float invW = 1.0f / clip.w;
+                    triangle.V[j]    = glm::vec3((clip.x * invW * 0.5f + 0.5f) * float(Width), (clip.y * invW * 0.5f + 0.5f) * float(Height), clip.z * invW);
+                }
+
+                if(clipped)
+                    continue;
+
+                const float minX = Maths::Min(triangle.V[0].x, Maths::Min(triangle.V[1].x, triangle.V[2].x));
+                const float maxX = Maths::Max(triangle.V[0].x, Maths::Max(triangle.V[1].x, triangle.V[2].x));
+                const float minY = Maths::Min(triangle.V[0].y, Maths::Min(triangle.V[1].y, triangle.V[2].y));
+                const float maxY = Maths::Max(triangle.V[0].y, Maths::Max(triangle.V[1].y, triangle.V[2].y));
+
+                if(maxX < 0.0f || maxY < 0.0f || minX >= float(Width) || minY >= float(Height))
+                    continue;
+
+                // Rasterising either winding lets open or flipped meshes occlude too
+                const float area = (triangle.V[1].x - triangle.V[0].x) * (triangle.V[2].y - triangle.V[0].y) - (triangle.V[1].y - triangle.V[0].y) * (triangle.V[2].x - triangle.V[0].x);
+                if(Maths::Abs(area) < 1e-6f)
+                    continue;
+                if(area < 0.0f)
+                    std::swap(triangle.V[1], triangle.V[2]);
+
+                triangle.MinTile[0] = uint32_t(Maths::Clamp(minX / tileWidth, 0.0f, float(TilesX - 1)));
+                triangle.MaxTile[0] = uint32_t(Maths::Clamp(maxX / tileWidth, 0.0f, float(TilesX - 1)));
+                triangle.MinTile[1] = uint32_t(Maths::Clamp(minY / tileHeight, 0.0f, float(TilesY - 1)));
+                triangle.MaxTile[1] = uint32_t(Maths::Clamp(maxY / tileHeight, 0.0f, float(TilesY - 1)));
+
+                const uint32_t index = uint32_t(m_Triangles.size());
+                m_Triangles.push_back(triangle);
+
+                for(uint32_t y = triangle.MinTile[1]; y <= triangle.MaxTile[1]; y++)
+                    for(uint32_t x = triangle.MinTile[0]; x <= triangle.MaxTile[0]; x++)
+                        m_TileTriangles[x + y * TilesX].push_back(index);
+            }
+
+            m_OccluderCount++;
+        }
+
+        void OcclusionCuller::RasteriseTile(uint32_t tile)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            const uint32_t tileWidth  = Width / TilesX;
+            const uint32_t tileHeight = Height / TilesY;
+            const int tileMinX        = int((tile % TilesX) * tileWidth);
+            const int tileMinY        = int((tile / TilesX) * tileHeight);
+            const int tileMaxX        = tileMinX + int(tileWidth) - 1;
+            const int tileMaxY        = tileMinY + int(tileHeight) - 1;
+
+            float* depth = m_Levels[0].data();
+            for(int y = tileMinY; y <= tileMaxY; y++)
+                std::fill(depth + y * Width + tileMinX, depth + y * Width + tileMaxX + 1, EmptyDepth);
+
+            for(uint32_t index : m_TileTriangles[tile])
+            {
+                const ScreenTriangle& triangle = m_Triangles[index];
+                const glm::vec3& v0            = triangle.V[0];
+                const glm::vec3& v1            = triangle.V[1];
+                const glm::vec3& v2            = triangle.V[2];
+
+                const int minX = Maths::Max(tileMinX, int(std::floor(Maths::Min(v0.x, Maths::Min(v1.x, v2.x)))));
+                const int maxX = Maths::Min(tileMaxX, int(std::ceil(Maths::Max(v0.x, Maths::Max(v1.x, v2.x)))));
+                const int minY = Maths::Max(tileMinY, int(std::floor(Maths::Min(v0.y, Maths::Min(v1.y, v2.y)))));
+                const int maxY = Maths::Min(tileMaxY, int(std::ceil(Maths::Max(v0.y, Maths::Max(v1.y, v2.y)))));
+                if(minX > maxX || minY > maxY)
+                    continue;
+
+                // Edge functions, each weights the opposite vertex and steps linearly across the tile
+                const float a0 = v1.y - v2.y, b0 = v2.x - v1.x;
+                const float a1 = v2.y - v0.y, b1 = v0.x - v2.x;
+                const float a2 = v0.y - v1.y, b2 = v1.x - v0.x;
+
+                const float px = float(minX) + 0.5f;
+                const float py = float(minY) + 0.5f;
+                float row0     = a0 * (px - v1.x) + b0 * (py - v1.y);
+                float row1     = a1 * (px - v2.x) + b1 * (py - v2.y);
+                float row2     = a2 * (px - v0.x) + b2 * (py - v0.y);
+
+                const float invArea = 1.0f / (row0 + row1 + row2);
+                const float z0      = v0.z * invArea;
+                const float z1      = v1.z * invArea;
+                const float z2      = v2.z * invArea;
+
+                for(int y = minY; y <= maxY; y++)
+                {
+                    float e0        = row0;
+                    float e1        = row1;
+                    float e2        = row2;
+                    float* depthRow = depth + y * Width;
+
+                    for(int x = minX; x <= maxX; x++)
+                    {
+                        if(e0 >= 0.0f && e1 >= 0.0f && e2 >= 0.0f)
+                        {
+                            const float z = e0 * z0 + e1 * z1 + e2 * z2;
+                            if(z < depthRow[x])
+                                depthRow[x] = z;
+                        }
+
+                        e0 += a0;
+                        e1 += a1;
+                        e2 += a2;
+                    }
+
+                    row0 += b0;
+                    row1 += b1;
+                    row2 += b2;
+                }
+            }
+        }
+
+        void OcclusionCuller::BuildPyramid()
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            uint32_t width  = Width;
+            uint32_t height = Height;
+
+            // Each texel keeps the furthest occluder depth below it
+            for(size_t level = 1; level < m_Levels.size(); level++)
+            {
+                const float* source        = m_Levels[level - 1].data();
+                float* destination         = m_Levels[level].data();
+                const uint32_t sourceWidth = width;
+                width /= 2;
+                height /= 2;
+
+                for(uint32_t y = 0; y < height; y++)
+                {
+                    for(uint32_t x = 0; x < width; x++)
+                    {
+                        const float* texel         = source + (y * 2) * sourceWidth + x * 2;
+                        destination[y * width + x] = Maths::Max(Maths::Max(texel[0], texel[1]), Maths::Max(texel[sourceWidth], texel[sourceWidth + 1]));
+                    }
+                }
+            }
+        }
+
+        bool OcclusionCuller::IsOccluded(const Maths::BoundingBox& worldBounds) const
+        {
+            if(m_Triangles.empty())
+                return false;
+
+            const glm::vec3 boundsMin = worldBounds.Min();
+            const glm::vec3 boundsMax = worldBounds.Max();
+
+            float minX = FLT_MAX, minY = FLT_MAX, minZ = FLT_MAX;
+            float maxX = -FLT_MAX, maxY = -FLT_MAX;
+            for(uint32_t i = 0; i < 8; i++)
+            {
+                const glm::vec4 corner((i & 1) ? boundsMax.x : boundsMin.x, (i & 2) ? boundsMax.y : boundsMin.y, (i & 4) ? boundsMax.z : boundsMin.z, 1.0f);
+                const glm::vec4 clip = m_ProjView * corner;
+                if(clip.w < NearClipW || clip.z < 0.0f)
+                    return false;
+
+                const float invW = 1.0f / clip.w;
+                const float x    = (clip.x * invW * 0.5f + 0.5f) * float(Width);
+                const float y    = (clip.y * invW * 0.5f + 0.5f) * float(Height);
+                minX             = Maths::Min(minX, x);
+                maxX             = Maths::Max(maxX, x);
+                minY             = Maths::Min(minY, y);
+                maxY             = Maths::Max(maxY, y);
+                minZ             = Maths::Min(minZ, clip.z * invW);
+            }
+
+            if(maxX < 0.0f || maxY < 0.0f || minX >= float(Width) || minY >= float(Height))
+                return false;
+
+            uint32_t x0 = uint32_t(Maths::Clamp(minX, 0.0f, float(Width - 1)));
+            uint32_t x1 = uint32_t(Maths::Clamp(maxX, 0.0f, float(Width - 1)));
+            uint32_t y0 = uint32_t(Maths::Clamp(minY, 0.0f, float(Height - 1)));
+            uint32_t y1 = uint32_t(Maths::Clamp(maxY, 0.0f, float(Height - 1)));
+
+            // Coarsest level where the rectangle still covers at most 2x2 texels
+            uint32_t level = 0;
+            while(level + 1 < m_Levels.size() && ((x1 >> level) - (x0 >> level) > 1 || (y1 >> level) - (y0 >> level) > 1))
+                level++;
+
+            const uint32_t levelWidth = Width >> level;
+            const float* depth        = m_Levels[level].data();
+            for(uint32_t y = y0 >> level; y <= (y1 >> level); y++)
+            {
+                for(uint32_t x = x0 >> level; x <= (x1 >> level); x++)
+                {
+                    if(minZ <= depth[y * levelWidth + x])
+                        return false;
+                }
+            }
+
+            return true;
+        }
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <glm/mat4x4.hpp>
+
+namespace Lumos
+{
+    namespace Maths
+    {
+        class BoundingBox;
+    }
+
+    namespace Graphics
+    {
+        class Mesh;
+        struct Vertex;
+
+        // Low resolution software depth buffer of a few large occluders with a max depth pyramid on top.
+        // Depth is NDC z, so larger is further away
+        class LUMOS_EXPORT OcclusionCuller
+        {
+        public:
+            static const uint32_t Width        = 256;
+            static const uint32_t Height       = 128;
+            static const uint32_t TilesX       = 4;
+            static const uint32_t TilesY       = 4;
+            static const uint32_t MaxOccluders = 24;
+
+            OcclusionCuller();
+
+            void BeginFrame(const glm::mat4& projView);
+
+            // Only the largest MaxOccluders candidates are rasterised
+            void AddOccluderCandidate(const Mesh* mesh, const glm::mat4& transform, float screenSize);
+
+            // Geometry without a GPU mesh, it must stay alive until Rasterise returns
+            void AddOccluderCandidate(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, const glm::mat4& transform, float screenSize);
+            void Rasterise();
+
+            // Conservative, anything crossing the near plane or touching an uncovered texel is visible
+            bool IsOccluded(const Maths::BoundingBox& worldBounds) const;
+
+            uint32_t GetOccluderCount() const { return m_OccluderCount; }
+            uint32_t GetTriangleCount() const { return uint32_t(m_Triangles.size()); }
+            uint32_t GetLevelCount() const { return uint32_t(m_Levels.size()); }
+            const float* GetDepth(uint32_t level) const { return m_Levels[level].data(); }
+
+        private:
+            struct Candidate
+            {
+                const std::vector<Vertex>* Vertices;
+                const std::vector<uint32_t>* Indices;
+                glm::mat4 Transform;
+                float ScreenSize;
+            };
+
+            struct ScreenTriangle
+            {
+                glm::vec3 V[3]; // Pixel x, y and NDC z
+                uint32_t MinTile[2];
+                uint32_t MaxTile[2];
+            };
+
+            void AddOccluder(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, const glm::mat4& transform);
+            void RasteriseTile(uint32_t tile);
+            void BuildPyramid();
+
+            glm::mat4 m_ProjView;
+            std::vector<Candidate> m_Candidates;
+            std::vector<glm::vec4> m_ClipVertices;
+            std::vector<ScreenTriangle> m_Triangles;
+            std::vector<std::vector<uint32_t>> m_TileTriangles;
+            std::vector<std::vector<float>> m_Levels;
+            uint32_t m_OccluderCount = 0;
+        };
+    }
+}
@@ -19,8 +19,13 @@ namespace Lumos
             Pipeline* pipeline = nullptr;
             glm::mat4 transform;
             glm::mat4 textureMatrix;
-            bool animated                        = false;
-            DescriptorSet* AnimatedDescriptorSet = nullptr;
+            bool animated       = false;
+            uint32_t BoneOffset = 0;
+            uint32_t LOD        = 0;
+
+            // Set when identical draws are merged, transforms are read from the instance buffer at InstanceOffset
+            uint32_t InstanceCount  = 1;
+            uint32_t InstanceOffset = 0;
         };
     }
 }
@@ -27,7 +27,9 @@
 #include "Utilities/AssetManager.h"
 #include "Core/Application.h"
 #include "Scene/Component/Components.h"
+#include "Scene/SceneBVH.h"
 #include "Maths/Random.h"
+#include "Utilities/CombineHash.h"
 #include "ImGui/ImGuiUtilities.h"
 
 #include <imgui/imgui.h>
@@ -50,6 +52,82 @@ static const uint32_t MAX_LINE_BATCH_DRAW_CALLS = 100;
 static const uint32_t RENDERER_LINE_SIZE        = sizeof(Lumos::Graphics::LineVertexData) * 4;
 static const uint32_t RENDERER_LINE_BUFFER_SIZE = RENDERER_LINE_SIZE * MaxLineVertices;
 
+// Per block, a batch that doesn't fit in the remainder of a block starts a new one
+static const uint32_t TRANSIENT_BUFFER_BLOCK_SIZE = 8 * 1024 * 1024;
+
+static const uint32_t MaxSkinningJoints = 256;
+// The bone palette starts with room for this many animated models and doubles, up to the limit, when a frame needs more
+static const uint32_t InitialSkinnedModels = 64;
+static const uint32_t MaxSkinnedModels     = 1024;
+
+// Instanced draws read a window of this many transforms, matching MAX_INSTANCES in Buffers.glslh
+static const uint32_t MaxInstancesPerDraw    = 256;
+static const uint32_t MaxInstancedTransforms = 16384;
+
+// Fraction of the view height below which each successive mesh LOD is used
+static const float LODScreenSizes[]     = { 0.4f, 0.2f, 0.1f, 0.04f };
+static const uint32_t MaxLODScreenSizes = sizeof(LODScreenSizes) / sizeof(float);
+// Shadow maps tolerate coarser silhouettes, so cascades draw this many levels lower
+static const uint32_t ShadowLODBias = 1;
+// Casters whose world matrix hasn't changed for this many frames are drawn into the static shadow cache
+static const uint32_t StaticCasterFrames = 30;
+// Cached cascades move in steps of this fraction of their radius so static depth stays valid between steps
+static const float ShadowCacheSnapFraction = 0.1f;
+
+// Occluders are rasterised every frame, so only simple meshes covering a good part of the view are used
+static const uint32_t MaxOccluderTriangles = 2048;
+static const float MinOccluderScreenSize   = 0.1f;
+
+// proj[1][1] maps view space height to NDC, so this is the projected diameter over the view height
+static float ScreenSize(const Lumos::Maths::BoundingBox& bounds, const glm::vec3& cameraPosition, float projectionScale, bool orthographic)
+{
+    const float radius   = glm::length(bounds.Size()) * 0.5f;
+    const float distance = orthographic ? 1.0f : Lumos::Maths::Max(glm::length(bounds.Center() - cameraPosition) - radius, 0.0001f);
+    return radius * projectionScale / distance;
+}
+
+static uint32_t SelectMeshLOD(const Lumos::Maths::BoundingBox& bounds, const glm::vec3& cameraPosition, float projectionScale, bool orthographic, uint32_t lodCount)
+{
+    if(lodCount <= 1)
+        return 0;
+
+    const float size = ScreenSize(bounds, cameraPosition, projectionScale, orthographic);
+
+    uint32_t lod = 0;
+    while(lod < MaxLODScreenSizes && lod + 1 < lodCount && size < LODScreenSizes[lod])
+        lod++;
+
+    return lod;
+}
+
+// Queues shorter than this are recorded inline, splitting them costs more than it saves
+static const uint32_t MinCommandsPerRecordingJob = 64;
+// Push constant blocks are written per draw into this much local storage so recording threads never share one
+static const uint32_t MaxPushConstantSize = 128;
+
+// Dequantisation bounds for meshes using Graphics::VertexFormat::Compact
+static void SetCompactPushConstants(const Lumos::Graphics::PushConstant& pushConstant, const Lumos::Graphics::RenderPasses::MeshPushConstants& handles, uint8_t* data, Lumos::Graphics::Mesh* mesh)
+{
+    if(!mesh->IsCompact())
+        return;
+
+    pushConstant.SetValue(data, handles.PositionMin, &mesh->GetPositionMin());
+    pushConstant.SetValue(data, handles.PositionExtent, &mesh->GetPositionExtent());
+}
+
+static Lumos::Graphics::RenderPasses::MeshPushConstants ResolveMeshPushConstants(Lumos::Graphics::Shader* shader)
+{
+    Lumos::Graphics::RenderPasses::MeshPushConstants handles;
+    auto& pushConstants = shader->GetPushConstants();
+    if(pushConstants.empty())
+        return handles;
+
+    handles.Transform      = pushConstants[0].GetHandle("transform");
+    handles.PositionMin    = pushConstants[0].GetHandle("positionMin");
+    handles.PositionExtent = pushConstants[0].GetHandle("positionExtent");
+    return handles;
+}
+
 namespace Lumos::Graphics
 {
     RenderPasses::RenderPasses(uint32_t width, uint32_t height)
@@ -59,6 +137,8 @@ namespace Lumos::Graphics
         m_ClearColour    = glm::vec4(0.2f, 0.2f, 0.2f, 1.0f);
         m_SupportCompute = Renderer::GetCapabilities().SupportCompute;
 
+        m_MultithreadedRecording = Renderer::GetCapabilities().SecondaryCommandBuffers && System::JobSystem::GetThreadCount() > 1;
+
         Graphics::TextureDesc mainRenderTargetDesc;
         mainRenderTargetDesc.format          = Graphics::RHIFormat::R11G11B10_Float;
         mainRenderTargetDesc.flags           = TextureFlags::Texture_RenderTarget;
@@ -118,6 +198,9 @@ namespace Lumos::Graphics
         m_ShadowData.m_CascadeCommandQueue[2].reserve(1000);
         m_ShadowData.m_CascadeCommandQueue[3].reserve(1000);
 
+        if(Renderer::GetCapabilities().TextureLayerCopy)
+            m_ShadowData.m_StaticShadowTex = TextureDepthArray::Create(m_ShadowData.m_ShadowMapSize, m_ShadowData.m_ShadowMapSize, m_ShadowData.m_ShadowMapNum, Renderer::GetRenderer()->GetDepthFormat());
+
         // Setup forward pass data
         m_ForwardData.m_DepthTest    = true;
         m_ForwardData.m_Shader       = Application::Get().GetAssetManager()->GetAssetData("ForwardPBR").As<Graphics::Shader>();
@@ -125,7 +208,8 @@ namespace Lumos::Graphics
         m_ForwardData.m_DepthTexture = TextureDepth::Create(width, height, Renderer::GetRenderer()->GetDepthFormat(), m_MainTextureSamples);
         m_ForwardData.m_CommandQueue.reserve(1000);
 
-        const size_t minUboAlignment = size_t(Graphics::Renderer::GetCapabilities().UniformBufferOffsetAlignment);
+        const size_t minUboAlignment     = size_t(Graphics::Renderer::GetCapabilities().UniformBufferOffsetAlignment);
+        m_ForwardData.m_UniformAlignment = Maths::Max(16u, uint32_t(minUboAlignment));
 
         m_ForwardData.m_DynamicAlignment = sizeof(glm::mat4);
         if(minUboAlignment > 0)
@@ -210,6 +294,18 @@ namespace Lumos::Graphics
 
         auto descriptorSetScene    = m_ForwardData.m_Shader->GetDescriptorInfo(2);
         descriptorDesc.layoutIndex = 0;
+
+        // Shaders compiled before the cluster buffers existed fall back to looping over every light
+        for(auto& descriptor : descriptorSetScene.descriptors)
+        {
+            if(descriptor.name == "UniformClusterGrid")
+                m_ForwardData.m_ClusteredLighting = true;
+        }
+
+        if(m_ForwardData.m_ClusteredLighting)
+            m_ForwardData.m_ClusterLights.resize(LightClusters::MaxLights);
+        else
+            LUMOS_LOG_WARN("ForwardPBR shader has no light clusters, recompile shaders to lift the light limit");
         descriptorDesc.shader      = m_ForwardData.m_Shader.get();
         m_ForwardData.m_DescriptorSet.resize(4);
         m_ForwardData.m_DescriptorSet[0] = SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
@@ -218,12 +314,24 @@ namespace Lumos::Graphics
         descriptorDesc.layoutIndex       = 3;
         descriptorDesc.shader            = m_ForwardData.m_AnimShader;
         m_ForwardData.m_DescriptorSet[3] = SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
-        glm::mat4 boneTransforms[100];
-        for(int i = 0; i < 100; i++)
+
+        // Bone palette shared by all animated models, each one selects its window with a dynamic offset
+        const uint32_t boneWindowSize     = MaxSkinningJoints * 3 * sizeof(glm::vec4);
+        m_ForwardData.m_BonePaletteStride = boneWindowSize;
+        if(minUboAlignment > 0)
+        {
+            m_ForwardData.m_BonePaletteStride = uint32_t((boneWindowSize + minUboAlignment - 1) & ~(minUboAlignment - 1));
+        }
+
+        const uint32_t bonePaletteSize = m_ForwardData.m_BonePaletteStride * (InitialSkinnedModels + 1);
+        m_ForwardData.m_BonePalette.resize(bonePaletteSize / sizeof(glm::vec4), glm::vec4(0.0f));
+        for(uint32_t i = 0; i < MaxSkinningJoints; i++)
         {
-            boneTransforms[i] = glm::mat4(1.0f);
+            m_ForwardData.m_BonePalette[i * 3 + 0] = glm::vec4(1.0f, 0.0f, 0.0f, 0.0f);
+            m_ForwardData.m_BonePalette[i * 3 + 1] = glm::vec4(0.0f, 1.0f, 0.0f, 0.0f);
+            m_ForwardData.m_BonePalette[i * 3 + 2] = glm::vec4(0.0f, 0.0f, 1.0f, 0.0f);
         }
-        m_ForwardData.m_DescriptorSet[3]->SetUniform("BoneTransforms", "BoneTransforms", boneTransforms, sizeof(glm::mat4) * 100);
+
         m_ForwardData.m_DescriptorSet[3]->Update();
 
         m_ForwardData.m_DefaultMaterial  = new Material(m_ForwardData.m_Shader);
@@ -314,6 +422,61 @@ namespace Lumos::Graphics
         m_DepthPrePassAlphaAnimShader = Application::Get().GetAssetManager()->GetAssetData("DepthPrePassAlphaAnim").As<Graphics::Shader>();
 
         m_DepthPrePassAnimShader       = Application::Get().GetAssetManager()->GetAssetData("DepthPrePassAnim").As<Graphics::Shader>();
+
+        auto ShaderReady = [](const SharedPtr<Graphics::Shader>& shader)
+        {
+            return shader && shader->IsCompiled();
+        };
+
+        if(Application::Get().GetAssetManager()->AssetExists("ForwardPBRCompact"))
+        {
+            auto assetManager                     = Application::Get().GetAssetManager();
+            m_ShadowData.m_ShaderCompact          = assetManager->GetAssetData("ShadowCompact").As<Graphics::Shader>();
+            m_ShadowData.m_ShaderAlphaCompact     = assetManager->GetAssetData("ShadowAlphaCompact").As<Graphics::Shader>();
+            m_ShadowData.m_ShaderAnimCompact      = assetManager->GetAssetData("ShadowAnimCompact").As<Graphics::Shader>();
+            m_ShadowData.m_ShaderAnimAlphaCompact = assetManager->GetAssetData("ShadowAnimAlphaCompact").As<Graphics::Shader>();
+            m_ForwardData.m_CompactShader         = assetManager->GetAssetData("ForwardPBRCompact").As<Graphics::Shader>();
+            m_ForwardData.m_AnimCompactShader     = assetManager->GetAssetData("ForwardPBRAnimCompact").As<Graphics::Shader>();
+            m_DepthPrePassCompactShader           = assetManager->GetAssetData("DepthPrePassCompact").As<Graphics::Shader>();
+            m_DepthPrePassAlphaCompactShader      = assetManager->GetAssetData("DepthPrePassAlphaCompact").As<Graphics::Shader>();
+            m_DepthPrePassAnimCompactShader       = assetManager->GetAssetData("DepthPrePassAnimCompact").As<Graphics::Shader>();
+            m_DepthPrePassAlphaAnimCompactShader  = assetManager->GetAssetData("DepthPrePassAlphaAnimCompact").As<Graphics::Shader>();
+
+            m_SupportCompactVertices = ShaderReady(m_ShadowData.m_ShaderCompact) && ShaderReady(m_ShadowData.m_ShaderAlphaCompact)
+                && ShaderReady(m_ShadowData.m_ShaderAnimCompact) && ShaderReady(m_ShadowData.m_ShaderAnimAlphaCompact)
+                && ShaderReady(m_ForwardData.m_CompactShader) && ShaderReady(m_ForwardData.m_AnimCompactShader)
+                && ShaderReady(m_DepthPrePassCompactShader) && ShaderReady(m_DepthPrePassAlphaCompactShader)
+                && ShaderReady(m_DepthPrePassAnimCompactShader) && ShaderReady(m_DepthPrePassAlphaAnimCompactShader);
+        }
+
+        // Meshes imported from here on are expanded to the full format when this is off
+        Graphics::Mesh::SetCompactVerticesSupported(m_SupportCompactVertices);
+        if(!m_SupportCompactVertices)
+            LUMOS_LOG_WARN("Compact vertex shaders not available, compact meshes will use the full vertex format");
+
+        if(Application::Get().GetAssetManager()->AssetExists("ForwardPBRInstanced"))
+        {
+            auto assetManager               = Application::Get().GetAssetManager();
+            m_ForwardData.m_InstancedShader = assetManager->GetAssetData("ForwardPBRInstanced").As<Graphics::Shader>();
+            m_ShadowData.m_ShaderInstanced  = assetManager->GetAssetData("ShadowInstanced").As<Graphics::Shader>();
+            m_DepthPrePassInstancedShader   = assetManager->GetAssetData("DepthPrePassInstanced").As<Graphics::Shader>();
+
+            m_ForwardData.m_SupportInstancing = ShaderReady(m_ForwardData.m_InstancedShader) && ShaderReady(m_ShadowData.m_ShaderInstanced)
+                && ShaderReady(m_DepthPrePassInstancedShader);
+        }
+
+        if(m_ForwardData.m_SupportInstancing)
+        {
+            descriptorDesc.layoutIndex             = 3;
+            descriptorDesc.shader                  = m_ForwardData.m_InstancedShader.get();
+            m_ForwardData.m_InstanceDescriptorSet  = SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
+            m_ForwardData.m_InstanceAlignment      = Maths::Max(1u, uint32_t(minUboAlignment / sizeof(glm::mat4)));
+            m_ForwardData.m_InstanceTransformCount = 0;
+            m_ForwardData.m_InstanceDescriptorSet->Update();
+        }
+        else
+            LUMOS_LOG_WARN("Instanced shaders not available, identical draws will not be merged");
+
         m_FilmicGrainShader            = Application::Get().GetAssetManager()->GetAssetData("FilmicGrain").As<Graphics::Shader>();
         descriptorDesc.layoutIndex     = 0;
         descriptorDesc.shader          = m_FilmicGrainShader.get();
@@ -371,7 +534,8 @@ namespace Lumos::Graphics
             m_Renderer2DData.m_DescriptorSet[i][1] = nullptr; // SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
         }
 
-        m_Renderer2DData.m_VertexBuffers.resize(Renderer::GetMainSwapChain()->GetSwapChainBufferCount());
+        // Batched vertex data for 2D, text, particles and debug draws is written straight into this each frame
+        m_TransientBuffer = UniquePtr<TransientBuffer>(TransientBuffer::Create(TRANSIENT_BUFFER_BLOCK_SIZE));
 
         uint32_t* indices = new uint32_t[m_Renderer2DData.m_Limits.IndiciesSize];
 
@@ -399,19 +563,6 @@ namespace Lumos::Graphics
             }
         }
         m_Renderer2DData.m_IndexBuffer = IndexBuffer::Create(indices, m_Renderer2DData.m_Limits.IndiciesSize);
-        m_2DBufferBase.resize(Renderer::GetMainSwapChain()->GetSwapChainBufferCount());
-
-        for(int currentFrame = 0; currentFrame < Renderer::GetMainSwapChain()->GetSwapChainBufferCount(); currentFrame++)
-        {
-            auto& vertexBuffer = m_Renderer2DData.m_VertexBuffers[currentFrame].emplace_back(Graphics::VertexBuffer::Create(m_Renderer2DData.m_Limits.BufferSize, nullptr, BufferUsage::DYNAMIC));
-
-            m_2DBufferBase[currentFrame].emplace_back(new VertexData[m_Renderer2DData.m_Limits.MaxQuads * 4]);
-        }
-
-        for(int i = 0; i < Renderer::GetMainSwapChain()->GetSwapChainBufferCount(); i++)
-        {
-            TextVertexBufferBase.push_back(new TextVertexData[m_TextRendererData.m_Limits.MaxQuads * 4]);
-        }
 
         delete[] indices;
 
@@ -447,8 +598,6 @@ namespace Lumos::Graphics
                 m_ParticleData.m_DescriptorSet[i][1] = nullptr; // SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
             }
 
-            m_ParticleData.m_VertexBuffers.resize(Renderer::GetMainSwapChain()->GetSwapChainBufferCount());
-
             uint32_t* indices = new uint32_t[m_ParticleData.m_Limits.IndiciesSize];
 
             if(m_ParticleData.m_TriangleIndicies)
@@ -475,14 +624,6 @@ namespace Lumos::Graphics
                 }
             }
             m_ParticleData.m_IndexBuffer = IndexBuffer::Create(indices, m_ParticleData.m_Limits.IndiciesSize);
-            m_ParticleBufferBase.resize(Renderer::GetMainSwapChain()->GetSwapChainBufferCount());
-
-            for(int currentFrame = 0; currentFrame < Renderer::GetMainSwapChain()->GetSwapChainBufferCount(); currentFrame++)
-            {
-                auto& vertexBuffer = m_ParticleData.m_VertexBuffers[currentFrame].emplace_back(Graphics::VertexBuffer::Create(m_ParticleData.m_Limits.BufferSize, nullptr, BufferUsage::DYNAMIC));
-
-                m_ParticleBufferBase[currentFrame].emplace_back(new VertexData[m_ParticleData.m_Limits.MaxQuads * 4]);
-            }
 
             delete[] indices;
         }
@@ -495,8 +636,6 @@ namespace Lumos::Graphics
         m_TextRendererData.m_Limits.SetMaxQuads(10000);
         m_TextRendererData.m_Limits.MaxTextures = 16; // Renderer::GetCapabilities().MaxTextureUnits;
 
-        TextVertexBufferPtr = TextVertexBufferBase[0];
-
         m_TextRendererData.m_Shader = Application::Get().GetAssetManager()->GetAssetData("Text").As<Graphics::Shader>();
 
         m_TextRendererData.m_TransformationStack.emplace_back(glm::mat4(1.0f));
@@ -520,7 +659,6 @@ namespace Lumos::Graphics
             m_TextRendererData.m_DescriptorSet[i][1] = nullptr; // SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
         }
 
-        m_TextRendererData.m_VertexBuffers.resize(Renderer::GetMainSwapChain()->GetSwapChainBufferCount());
         indices = new uint32_t[m_TextRendererData.m_Limits.IndiciesSize];
 
         if(m_TextRendererData.m_TriangleIndicies)
@@ -550,13 +688,108 @@ namespace Lumos::Graphics
 
         delete[] indices;
 
+        ResolveUniformHandles();
         InitDebugRenderData();
     }
 
+    void RenderPasses::ResolveUniformHandles()
+    {
+        LUMOS_PROFILE_FUNCTION();
+        auto& scene             = m_ForwardData.m_Uniforms;
+        DescriptorSet* sceneSet = m_ForwardData.m_DescriptorSet[2].get();
+
+        scene.ProjView        = m_ForwardData.m_DescriptorSet[0]->GetUniformHandle("UBO", "projView");
+        scene.Lights          = sceneSet->GetUniformHandle("UniformSceneData", "lights");
+        scene.CameraPosition  = sceneSet->GetUniformHandle("UniformSceneData", "cameraPosition");
+        scene.ViewMatrix      = sceneSet->GetUniformHandle("UniformSceneData", "ViewMatrix");
+        scene.LightView       = sceneSet->GetUniformHandle("UniformSceneData", "LightView");
+        scene.ShadowTransform = sceneSet->GetUniformHandle("UniformSceneData", "ShadowTransform");
+        scene.SplitDepths     = sceneSet->GetUniformHandle("UniformSceneData", "SplitDepths");
+        scene.BiasMatrix      = sceneSet->GetUniformHandle("UniformSceneData", "BiasMatrix");
+        scene.LightSize       = sceneSet->GetUniformHandle("UniformSceneData", "LightSize");
+        scene.ShadowFade      = sceneSet->GetUniformHandle("UniformSceneData", "ShadowFade");
+        scene.CascadeFade     = sceneSet->GetUniformHandle("UniformSceneData", "CascadeFade");
+        scene.MaxShadowDist   = sceneSet->GetUniformHandle("UniformSceneData", "MaxShadowDist");
+        scene.InitialBias     = sceneSet->GetUniformHandle("UniformSceneData", "InitialBias");
+        scene.Width           = sceneSet->GetUniformHandle("UniformSceneData", "Width");
+        scene.Height          = sceneSet->GetUniformHandle("UniformSceneData", "Height");
+        scene.ShadowEnabled   = sceneSet->GetUniformHandle("UniformSceneData", "shadowEnabled");
+        scene.LightCount      = sceneSet->GetUniformHandle("UniformSceneData", "LightCount");
+        scene.ShadowCount     = sceneSet->GetUniformHandle("UniformSceneData", "ShadowCount");
+        scene.Mode            = sceneSet->GetUniformHandle("UniformSceneData", "Mode");
+        scene.EnvMipCount     = sceneSet->GetUniformHandle("UniformSceneData", "EnvMipCount");
+        scene.BoneTransforms  = m_ForwardData.m_DescriptorSet[3]->GetUniformHandle("BoneTransformsDynamic", "BoneTransforms");
+        if(m_ForwardData.m_InstanceDescriptorSet)
+            scene.InstanceTransforms = m_ForwardData.m_InstanceDescriptorSet->GetUniformHandle("InstanceTransformsDynamic", "Transforms");
+        if(m_ForwardData.m_ClusteredLighting)
+        {
+            scene.ClusterLights     = sceneSet->GetUniformHandle("UniformClusterLights", "Lights");
+            scene.ClusterProjection = sceneSet->GetUniformHandle("UniformClusterGrid", "ProjectionParams");
+            scene.ClusterDimensions = sceneSet->GetUniformHandle("UniformClusterGrid", "Dimensions");
+            scene.ClusterRanges     = sceneSet->GetUniformHandle("UniformClusterGrid", "Ranges");
+            scene.ClusterIndices    = sceneSet->GetUniformHandle("UniformClusterIndices", "Indices");
+
+            // The index list fills whatever the shader declares, so raising MAX_CLUSTER_INDICES needs no change here
+            if(scene.ClusterIndices.IsValid())
+                m_ForwardData.m_LightClusters.SetIndexCapacity(scene.ClusterIndices.Size / uint32_t(sizeof(uint16_t)));
+        }
+
+        m_ShadowData.m_DirLightMatricesHandle[0] = m_ShadowData.m_DescriptorSet[0]->GetUniformHandle("ShadowData", "DirLightMatrices");
+        m_ShadowData.m_DirLightMatricesHandle[1] = m_ShadowData.m_DescriptorSet[1]->GetUniformHandle("ShadowData", "DirLightMatrices");
+
+        m_SkyboxUniforms.InvProjection = m_SkyboxDescriptorSet->GetUniformHandle("UBO", "invProjection");
+        m_SkyboxUniforms.InvView       = m_SkyboxDescriptorSet->GetUniformHandle("UBO", "invView");
+        m_SkyboxUniforms.Mode          = m_SkyboxDescriptorSet->GetUniformHandle("UniformBuffer", "Mode");
+        m_SkyboxUniforms.Exposure      = m_SkyboxDescriptorSet->GetUniformHandle("UniformBuffer", "Exposure");
+        m_SkyboxUniforms.BlurLevel     = m_SkyboxDescriptorSet->GetUniformHandle("UniformBuffer", "BlurLevel");
+
+        if(m_SSAOPassDescriptorSet)
+        {
+            m_SSAOUniforms.InvProj    = m_SSAOPassDescriptorSet->GetUniformHandle("UniformBuffer", "invProj");
+            m_SSAOUniforms.Projection = m_SSAOPassDescriptorSet->GetUniformHandle("UniformBuffer", "projection");
+            m_SSAOUniforms.View       = m_SSAOPassDescriptorSet->GetUniformHandle("UniformBuffer", "view");
+            m_SSAOUniforms.Samples    = m_SSAOPassDescriptorSet->GetUniformHandle("UniformBuffer", "samples");
+            m_SSAOUniforms.Radius     = m_SSAOPassDescriptorSet->GetUniformHandle("UniformBuffer", "ssaoRadius");
+            m_SSAOUniforms.Near       = m_SSAOPassDescriptorSet->GetUniformHandle("UniformBuffer", "near");
+            m_SSAOUniforms.Far        = m_SSAOPassDescriptorSet->GetUniformHandle("UniformBuffer", "far");
+            m_SSAOUniforms.Strength   = m_SSAOPassDescriptorSet->GetUniformHandle("UniformBuffer", "strength");
+        }
+
+        if(m_SSAOBlurPassDescriptorSet)
+        {
+            m_SSAOBlurUniforms.View        = m_SSAOBlurPassDescriptorSet->GetUniformHandle("UniformBuffer", "view");
+            m_SSAOBlurUniforms.TexelOffset = m_SSAOBlurPassDescriptorSet->GetUniformHandle("UniformBuffer", "ssaoTexelOffset");
+            m_SSAOBlurUniforms.BlurRadius  = m_SSAOBlurPassDescriptorSet->GetUniformHandle("UniformBuffer", "ssaoBlurRadius");
+        }
+
+        m_ToneMappingUniforms.BloomIntensity = m_ToneMappingPassDescriptorSet->GetUniformHandle("UniformBuffer", "BloomIntensity");
+        m_ToneMappingUniforms.ToneMapIndex   = m_ToneMappingPassDescriptorSet->GetUniformHandle("UniformBuffer", "ToneMapIndex");
+        m_ToneMappingUniforms.Brightness     = m_ToneMappingPassDescriptorSet->GetUniformHandle("UniformBuffer", "Brightness");
+        m_ToneMappingUniforms.Contrast       = m_ToneMappingPassDescriptorSet->GetUniformHandle("UniformBuffer", "Contrast");
+        m_ToneMappingUniforms.Saturation     = m_ToneMappingPassDescriptorSet->GetUniformHandle("UniformBuffer", "Saturation");
+
+        m_DepthOfFieldUniforms.DOFParams   = m_DepthOfFieldPassDescriptorSet->GetUniformHandle("UniformBuffer", "DOFParams");
+        m_DepthOfFieldUniforms.DepthConsts = m_DepthOfFieldPassDescriptorSet->GetUniformHandle("UniformBuffer", "DepthConsts");
+
+        m_ChromaticAberationUniforms.Intensity      = m_ChromaticAberationPassDescriptorSet->GetUniformHandle("UniformBuffer", "chromaticAberrationIntensity");
+        m_ChromaticAberationUniforms.CameraAperture = m_ChromaticAberationPassDescriptorSet->GetUniformHandle("UniformBuffer", "cameraAperture");
+
+        m_Renderer2DData.m_ProjViewHandle   = m_Renderer2DData.m_DescriptorSet[0][0]->GetUniformHandle("UBO", "projView");
+        m_TextRendererData.m_ProjViewHandle = m_TextRendererData.m_DescriptorSet[0][0]->GetUniformHandle("UBO", "projView");
+        if(!m_ParticleData.m_DescriptorSet.empty() && m_ParticleData.m_DescriptorSet[0][0])
+            m_ParticleData.m_ProjViewHandle = m_ParticleData.m_DescriptorSet[0][0]->GetUniformHandle("UBO", "projView");
+    }
+
     RenderPasses::~RenderPasses()
     {
         Memory::AlignedFree(m_ForwardData.m_TransformData);
 
+        for(auto& commandBuffers : m_SecondaryCommandBuffers)
+        {
+            for(auto commandBuffer : commandBuffers)
+                delete commandBuffer;
+        }
+
         delete m_ForwardData.m_DepthTexture;
         delete m_MainTexture;
         delete m_ResolveTexture;
@@ -570,6 +803,7 @@ namespace Lumos::Graphics
         delete m_NormalTexture;
 
         delete m_ShadowData.m_ShadowTex;
+        delete m_ShadowData.m_StaticShadowTex;
         delete m_ForwardData.m_DefaultMaterial;
         delete m_DefaultTextureCube;
         delete m_ScreenQuad;
@@ -586,72 +820,6 @@ namespace Lumos::Graphics
             delete m_DebugDrawData.m_PointIndexBuffer;
         }
 
-        for(auto data : TextVertexBufferBase)
-            delete[] data;
-        for(auto data : DebugTextVertexBufferBase)
-            delete[] data;
-
-        for(auto& lineBufferBase : m_LineBufferBase)
-            for(auto data : lineBufferBase)
-                delete[] data;
-        for(auto& pointBufferBase : m_PointBufferBase)
-            for(auto data : pointBufferBase)
-                delete[] data;
-        for(auto& quadBufferBase : m_QuadBufferBase)
-            for(auto data : quadBufferBase)
-                delete[] data;
-
-        for(int j = 0; j < Renderer::GetMainSwapChain()->GetSwapChainBufferCount(); j++)
-        {
-            for(size_t i = 0; i < m_Renderer2DData.m_VertexBuffers[j].size(); i++)
-            {
-                delete m_Renderer2DData.m_VertexBuffers[j][i];
-            }
-
-            for(uint32_t i = 0; i < m_TextRendererData.m_VertexBuffers[j].size(); i++)
-            {
-                delete m_TextRendererData.m_VertexBuffers[j][i];
-            }
-
-            for(size_t i = 0; i < m_ParticleData.m_VertexBuffers[j].size(); i++)
-            {
-                delete m_ParticleData.m_VertexBuffers[j][i];
-            }
-
-            if(m_DebugRenderDataInitialised)
-                for(uint32_t i = 0; i < m_DebugTextRendererData.m_VertexBuffers[j].size(); i++)
-                {
-                    delete m_DebugTextRendererData.m_VertexBuffers[j][i];
-                }
-
-            if(m_DebugRenderDataInitialised)
-                for(size_t i = 0; i < m_DebugDrawData.m_Renderer2DData.m_VertexBuffers[j].size(); i++)
-                {
-                    delete m_DebugDrawData.m_Renderer2DData.m_VertexBuffers[j][i];
-                }
-
-            for(auto data : m_2DBufferBase[j])
-                delete[] data;
-
-            for(auto data : m_ParticleBufferBase[j])
-                delete[] data;
-        }
-
-        if(m_DebugRenderDataInitialised)
-        {
-            if(!m_DebugDrawData.m_PointVertexBuffers.empty())
-                for(int i = 0; i < m_DebugDrawData.m_PointVertexBuffers[0].size(); i++)
-                {
-                    delete m_DebugDrawData.m_PointVertexBuffers[0][i];
-                }
-
-            if(!m_DebugDrawData.m_LineVertexBuffers.empty())
-                for(int i = 0; i < m_DebugDrawData.m_LineVertexBuffers[0].size(); i++)
-                {
-                    delete m_DebugDrawData.m_LineVertexBuffers[0][i];
-                }
-        }
-
         DebugRenderer::Release();
     }
 
@@ -694,13 +862,19 @@ namespace Lumos::Graphics
     void RenderPasses::BeginScene(Scene* scene)
     {
         LUMOS_PROFILE_FUNCTION();
-        auto& registry             = scene->GetRegistry();
-        m_CurrentScene             = scene;
-        m_Stats.FramesPerSecond    = 0;
-        m_Stats.NumDrawCalls       = 0;
-        m_Stats.NumRenderedObjects = 0;
-        m_Stats.NumShadowObjects   = 0;
-        m_Stats.UpdatesPerSecond   = 0;
+        auto& registry                  = scene->GetRegistry();
+        m_CurrentScene                  = scene;
+        m_Stats.FramesPerSecond         = 0;
+        m_Stats.NumDrawCalls            = 0;
+        m_Stats.NumRenderedObjects      = 0;
+        m_Stats.NumShadowObjects        = 0;
+        m_Stats.NumClusteredLights      = 0;
+        m_Stats.NumDroppedClusterLights = 0;
+        m_Stats.NumOccludedObjects      = 0;
+        m_Stats.UpdatesPerSecond        = 0;
+
+        // Per draw uniforms are allocated while the command queues are built, so the frame's ring starts here
+        m_TransientBuffer->BeginFrame(Renderer::GetMainSwapChain()->GetCurrentBufferIndex());
 
         m_Renderer2DData.m_BatchDrawCallIndex        = 0;
         m_TextRendererData.m_BatchDrawCallIndex      = 0;
@@ -780,7 +954,7 @@ namespace Lumos::Graphics
 
         if(renderSettings.Renderer3DEnabled)
         {
-            m_ForwardData.m_DescriptorSet[0]->SetUniform("UBO", "projView", &projView);
+            m_ForwardData.m_DescriptorSet[0]->SetUniform(m_ForwardData.m_Uniforms.ProjView, &projView);
             m_ForwardData.m_DescriptorSet[0]->Update();
         }
 
@@ -830,13 +1004,15 @@ namespace Lumos::Graphics
             auto invProj = glm::inverse(proj);
             auto invView = glm::inverse(view);
 
-            m_SkyboxDescriptorSet->SetUniform("UBO", "invProjection", &invProj);
-            m_SkyboxDescriptorSet->SetUniform("UBO", "invView", &invView);
+            m_SkyboxDescriptorSet->SetUniform(m_SkyboxUniforms.InvProjection, &invProj);
+            m_SkyboxDescriptorSet->SetUniform(m_SkyboxUniforms.InvView, &invView);
         }
 
         Light* directionaLight = nullptr;
         static Light lights[256];
-        uint32_t numLights = 0;
+        uint32_t numLights        = 0;
+        uint32_t numClusterLights = 0;
+        const uint32_t maxLights  = Maths::Min(256u, m_ForwardData.m_Uniforms.Lights.Size / uint32_t(sizeof(Graphics::Light)));
 
         m_ForwardData.m_Frustum = m_Camera->GetFrustum(view);
 
@@ -858,9 +1034,6 @@ namespace Lumos::Graphics
                     if(!Entity(lightEntity, scene).Active())
                         continue;
 
-                    if(numLights >= 64)
-                        break;
-
                     const auto& [light, trans] = group.get<Graphics::Light, Maths::Transform>(lightEntity);
                     light.Position             = glm::vec4(trans.GetWorldPosition(), 1.0f);
                     glm::vec3 forward          = glm::vec3(0.0f, 0.0f, 1.0f);
@@ -879,16 +1052,49 @@ namespace Lumos::Graphics
                             continue;
                     }
 
+                    if(m_ForwardData.m_ClusteredLighting && light.Type != float(LightType::DirectionalLight))
+                    {
+                        if(numClusterLights >= LightClusters::MaxLights)
+                            continue;
+
+                        m_ForwardData.m_ClusterLights[numClusterLights] = light;
+                        m_ForwardData.m_ClusterLights[numClusterLights].Intensity *= m_Exposure;
+                        numClusterLights++;
+                        continue;
+                    }
+
+                    if(numLights >= maxLights)
+                        continue;
+
                     lights[numLights] = light;
                     lights[numLights].Intensity *= m_Exposure;
                     numLights++;
                 }
             }
 
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UniformSceneData", "lights", lights, sizeof(Graphics::Light) * numLights);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.Lights, lights, sizeof(Graphics::Light) * numLights);
+
+            if(m_ForwardData.m_ClusteredLighting)
+            {
+                LUMOS_PROFILE_SCOPE("Cluster Lights");
+                auto& clusters = m_ForwardData.m_LightClusters;
+                clusters.Build(view, proj, m_Camera->GetNear(), m_Camera->GetFar(), m_Camera->IsOrthographic(), m_ForwardData.m_ClusterLights.data(), numClusterLights);
+
+                const glm::uvec4 dimensions = clusters.GetDimensions();
+                m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.ClusterLights, m_ForwardData.m_ClusterLights.data(), sizeof(Graphics::Light) * numClusterLights);
+                m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.ClusterProjection, &clusters.GetProjectionParams());
+                m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.ClusterDimensions, &dimensions);
+                m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.ClusterRanges, clusters.GetClusterRanges(), clusters.GetClusterRangesSize());
+                m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.ClusterIndices, clusters.GetLightIndices(), clusters.GetLightIndicesSize());
+
+                m_Stats.NumClusteredLights     = numClusterLights;
+                m_Stats.NumDroppedClusterLights = clusters.GetDroppedCount();
+                if(clusters.GetDroppedCount() > 0)
+                    LUMOS_LOG_WARN("Light cluster index list full ({0} of {1}), {2} light entries dropped", clusters.GetIndexCount(), clusters.GetIndexCapacity(), clusters.GetDroppedCount());
+            }
 
             glm::vec4 cameraPos = glm::vec4(m_CameraTransform->GetWorldPosition(), 1.0f);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UniformSceneData", "cameraPosition", &cameraPos);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.CameraPosition, &cameraPos);
         }
 
         if(renderSettings.ShadowsEnabled)
@@ -896,8 +1102,14 @@ namespace Lumos::Graphics
             for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; i++)
             {
                 m_ShadowData.m_CascadeCommandQueue[i].clear();
+                m_ShadowData.m_StaticCascadeCommandQueue[i].clear();
+                m_ShadowData.m_StaticCascadeHash[i] = 0;
             }
 
+            m_ShadowData.m_UseStaticCache = m_ShadowData.m_CacheStaticCasters && m_ShadowData.m_StaticShadowTex && directionaLight;
+            if(!m_ShadowData.m_UseStaticCache)
+                m_ShadowData.m_ShadowMapsInvalidated = true;
+
             if(directionaLight)
             {
                 UpdateCascades(scene, directionaLight);
@@ -926,41 +1138,36 @@ namespace Lumos::Graphics
         int shadowEnabled = renderSettings.ShadowsEnabled ? 1 : 0;
         if(renderSettings.Renderer3DEnabled)
         {
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UniformSceneData", "ViewMatrix", &view);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UniformSceneData", "LightView", &LightView);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UniformSceneData", "ShadowTransform", shadowTransforms);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UniformSceneData", "SplitDepths", uSplitDepth);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UniformSceneData", "BiasMatrix", &m_ForwardData.m_BiasMatrix);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UniformSceneData", "LightSize", &LightSize);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UniformSceneData", "ShadowFade", &ShadowFade);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UniformSceneData", "CascadeFade", &transitionFade);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UniformSceneData", "MaxShadowDist", &MaxShadowDist);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UniformSceneData", "InitialBias", &bias);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UniformSceneData", "Width", &width);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UniformSceneData", "Height", &height);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UniformSceneData", "shadowEnabled", &shadowEnabled);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.ViewMatrix, &view);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.LightView, &LightView);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.ShadowTransform, shadowTransforms);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.SplitDepths, uSplitDepth);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.BiasMatrix, &m_ForwardData.m_BiasMatrix);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.LightSize, &LightSize);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.ShadowFade, &ShadowFade);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.CascadeFade, &transitionFade);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.MaxShadowDist, &MaxShadowDist);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.InitialBias, &bias);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.Width, &width);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.Height, &height);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.ShadowEnabled, &shadowEnabled);
 
             m_ForwardData.m_DescriptorSet[2]->SetTexture("uShadowMap", reinterpret_cast<Texture*>(shadowData.m_ShadowTex), 0, TextureType::DEPTHARRAY);
 
             int numShadows   = shadowData.m_ShadowMapNum;
             auto EnvMipCount = m_ForwardData.m_EnvironmentMap ? m_ForwardData.m_EnvironmentMap->GetMipMapLevels() : 0;
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UniformSceneData", "LightCount", &numLights);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UniformSceneData", "ShadowCount", &numShadows);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UniformSceneData", "Mode", &m_ForwardData.m_RenderMode);
-            m_ForwardData.m_DescriptorSet[2]->SetUniform("UniformSceneData", "EnvMipCount", &EnvMipCount);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.LightCount, &numLights);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.ShadowCount, &numShadows);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.Mode, &m_ForwardData.m_RenderMode);
+            m_ForwardData.m_DescriptorSet[2]->SetUniform(m_ForwardData.m_Uniforms.EnvMipCount, &EnvMipCount);
             m_ForwardData.m_DescriptorSet[2]->SetTexture("uBRDFLUT", m_ForwardData.m_BRDFLUT.get());
             m_ForwardData.m_DescriptorSet[2]->SetTexture("uSSAOMap", Application::Get().GetCurrentScene()->GetSettings().RenderSettings.SSAOEnabled ? m_SSAOTexture : Material::GetDefaultTexture().get());
             m_ForwardData.m_DescriptorSet[2]->SetTexture("uEnvMap", m_ForwardData.m_EnvironmentMap, 0, TextureType::CUBE);
             m_ForwardData.m_DescriptorSet[2]->SetTexture("uIrrMap", m_ForwardData.m_IrradianceMap, 0, TextureType::CUBE);
             m_ForwardData.m_DescriptorSet[2]->Update();
 
-            glm::mat4 boneTransforms[100];
-            for(int i = 0; i < 100; i++)
-            {
-                boneTransforms[i] = glm::mat4(1.0f);
-            }
-            m_ForwardData.m_DescriptorSet[3]->SetUniform("BoneTransforms", "BoneTransforms", boneTransforms, sizeof(glm::mat4) * 100);
-            m_ForwardData.m_DescriptorSet[3]->Update();
+            // First window is reserved for identity
+            m_ForwardData.m_BonePaletteOffset = m_ForwardData.m_BonePaletteStride;
 
             auto group = registry.group<ModelComponent>(entt::get<Maths::Transform>);
 
@@ -980,9 +1187,64 @@ namespace Lumos::Graphics
             shadowPipelineDesc.DebugName               = "Shadow";
             shadowPipelineDesc.clearTargets            = false;
 
-            for(auto entity : group)
+            const glm::vec3 cameraPosition = m_CameraTransform->GetWorldPosition();
+            const bool cacheStaticCasters  = renderSettings.ShadowsEnabled && m_ShadowData.m_UseStaticCache;
+            const uint64_t casterFrame     = ++m_ShadowData.m_CasterFrame;
+            uint32_t visitedCasters        = 0;
+
+            // Only entities inside the camera or a shadow cascade can add commands
+            Maths::Frustum cullFrustums[SHADOWMAP_MAX + 1];
+            uint32_t cullFrustumCount        = 0;
+            cullFrustums[cullFrustumCount++] = m_ForwardData.m_Frustum;
+            if(directionaLight)
+            {
+                for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; i++)
+                    cullFrustums[cullFrustumCount++] = m_ShadowData.m_CascadeFrustums[i];
+            }
+
+            m_ForwardData.m_VisibleEntities.clear();
+            scene->GetBVH()->QueryFrustums(cullFrustums, cullFrustumCount, m_ForwardData.m_VisibleEntities);
+
+            const bool occlusionCulling = m_ForwardData.m_OcclusionCulling;
+            if(occlusionCulling)
             {
-                if(!Entity(entity, scene).Active())
+                LUMOS_PROFILE_SCOPE("Occlusion Culling");
+                m_ForwardData.m_OcclusionCuller.BeginFrame(projView);
+
+                for(auto entity : m_ForwardData.m_VisibleEntities)
+                {
+                    if(!group.contains(entity) || !Entity(entity, scene).Active())
+                        continue;
+
+                    const auto& [model, trans] = group.get<ModelComponent, Maths::Transform>(entity);
+                    if(!model.ModelRef)
+                        continue;
+
+                    for(auto& mesh : model.ModelRef->GetMeshes())
+                    {
+                        // Animated meshes only keep their indices on the CPU
+                        if(!mesh->GetActive() || mesh->GetAnimVertexBuffer() || mesh->GetVertices().empty() || mesh->GetIndices().size() > MaxOccluderTriangles * 3)
+                            continue;
+
+                        if(mesh->GetMaterial() && mesh->GetMaterial()->GetFlag(Material::RenderFlags::ALPHABLEND))
+                            continue;
+
+                        auto bbCopy = mesh->GetBoundingBox()->Transformed(trans.GetWorldMatrix());
+                        if(!m_ForwardData.m_Frustum.IsInside(bbCopy))
+                            continue;
+
+                        const float size = ScreenSize(bbCopy, cameraPosition, proj[1][1], m_Camera->IsOrthographic());
+                        if(size >= MinOccluderScreenSize)
+                            m_ForwardData.m_OcclusionCuller.AddOccluderCandidate(mesh.get(), trans.GetWorldMatrix(), size);
+                    }
+                }
+
+                m_ForwardData.m_OcclusionCuller.Rasterise();
+            }
+
+            for(auto entity : m_ForwardData.m_VisibleEntities)
+            {
+                if(!group.contains(entity) || !Entity(entity, scene).Active())
                     continue;
 
                 const auto& [model, trans] = group.get<ModelComponent, Maths::Transform>(entity);
@@ -992,16 +1254,45 @@ namespace Lumos::Graphics
 
                 const auto& meshes = model.ModelRef->GetMeshes();
 
+                // Written on first use so culled models don't take palette space
+                uint32_t boneOffset = 0;
+                bool bonesWritten   = false;
+
+                bool staticCaster = false;
+                if(cacheStaticCasters)
+                {
+                    auto& state             = m_ShadowData.m_CasterStates[(uint32_t)entity];
+                    const glm::mat4& matrix = trans.GetWorldMatrix();
+
+                    if(state.LastSeenFrame + 1 == casterFrame && state.Transform == matrix)
+                        state.StillFrames++;
+                    else
+                        state.StillFrames = 0;
+
+                    state.Transform     = matrix;
+                    state.LastSeenFrame = casterFrame;
+                    staticCaster        = state.StillFrames >= StaticCasterFrames;
+                    visitedCasters++;
+                }
+
                 for(auto mesh : meshes)
                 {
                     if(!mesh->GetActive())
                         continue;
 
+                    if(mesh->IsCompact() && !m_SupportCompactVertices)
+                        continue;
+
                     auto& worldTransform = trans.GetWorldMatrix();
                     auto bbCopy          = mesh->GetBoundingBox()->Transformed(worldTransform);
+                    uint32_t lod         = SelectMeshLOD(bbCopy, cameraPosition, proj[1][1], m_Camera->IsOrthographic(), mesh->GetLODCount());
 
                     if(directionaLight)
                     {
+                        // Skinned meshes deform without their transform changing
+                        const bool cached                   = staticCaster && !mesh->GetAnimVertexBuffer();
+                        shadowPipelineDesc.depthArrayTarget = reinterpret_cast<Texture*>(cached ? m_ShadowData.m_StaticShadowTex : m_ShadowData.m_ShadowTex);
+
                         for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; i++)
                         {
                             auto inside = m_ShadowData.m_CascadeFrustums[i].IsInside(bbCopy);
@@ -1021,7 +1312,11 @@ namespace Lumos::Graphics
                             bool alphaBlend    = material->GetFlag(Material::RenderFlags::ALPHABLEND);
 
                             shadowPipelineDesc.transparencyEnabled = alphaBlend;
-                            shadowPipelineDesc.shader              = alphaBlend ? m_ShadowData.m_ShaderAlpha : m_ShadowData.m_Shader;
+                            shadowPipelineDesc.vertexLayout        = mesh->GetVertexLayout();
+                            if(mesh->IsCompact())
+                                shadowPipelineDesc.shader = alphaBlend ? m_ShadowData.m_ShaderAlphaCompact : m_ShadowData.m_ShaderCompact;
+                            else
+                                shadowPipelineDesc.shader = alphaBlend ? m_ShadowData.m_ShaderAlpha : m_ShadowData.m_Shader;
 
                             // Bind here in case not bound in the loop below as meshes will be inside
                             // cascade frustum and not the cameras
@@ -1029,14 +1324,30 @@ namespace Lumos::Graphics
 
                             if(mesh->GetAnimVertexBuffer())
                             {
-                                shadowPipelineDesc.shader = alphaBlend ? m_ShadowData.m_ShaderAnimAlpha : m_ShadowData.m_ShaderAnim;
-
-                                command.animated              = true;
-                                command.AnimatedDescriptorSet = model.ModelRef->GetAnimationController() ? model.ModelRef->GetAnimationController()->GetDescriptorSet() : m_ForwardData.m_DescriptorSet[3];
+                                if(mesh->IsCompact())
+                                    shadowPipelineDesc.shader = alphaBlend ? m_ShadowData.m_ShaderAnimAlphaCompact : m_ShadowData.m_ShaderAnimCompact;
+                                else
+                                    shadowPipelineDesc.shader = alphaBlend ? m_ShadowData.m_ShaderAnimAlpha : m_ShadowData.m_ShaderAnim;
+
+                                if(!bonesWritten)
+                                {
+                                    boneOffset   = WriteBonePalette(model.ModelRef->GetAnimationController().get());
+                                    bonesWritten = true;
+                                }
+
+                                command.animated   = true;
+                                command.BoneOffset = boneOffset;
                             }
+                            command.LOD      = Maths::Min(lod + ShadowLODBias, mesh->GetLODCount() - 1);
                             command.pipeline = Graphics::Pipeline::Get(shadowPipelineDesc);
 
-                            m_ShadowData.m_CascadeCommandQueue[i].push_back(command);
+                            if(cached)
+                            {
+                                HashCombine(m_ShadowData.m_StaticCascadeHash[i], (uint32_t)entity, command.mesh, command.material, command.pipeline, command.LOD);
+                                m_ShadowData.m_StaticCascadeCommandQueue[i].push_back(command);
+                            }
+                            else
+                                m_ShadowData.m_CascadeCommandQueue[i].push_back(command);
                         }
                     }
 
@@ -1046,9 +1357,17 @@ namespace Lumos::Graphics
                         if(!inside)
                             continue;
 
+                        // Shadow casters were queued above, only the camera view is occluded
+                        if(occlusionCulling && m_ForwardData.m_OcclusionCuller.IsOccluded(bbCopy))
+                        {
+                            m_Stats.NumOccludedObjects++;
+                            continue;
+                        }
+
                         RenderCommand command;
                         command.mesh      = mesh;
                         command.transform = worldTransform;
+                        command.LOD       = lod;
                         command.material  = mesh->GetMaterial() ? mesh->GetMaterial().get() : m_ForwardData.m_DefaultMaterial;
 
                         // Update material buffers
@@ -1067,12 +1386,20 @@ namespace Lumos::Graphics
 
                         if(mesh->GetAnimVertexBuffer())
                         {
-                            pipelineDesc.shader           = m_ForwardData.m_AnimShader;
-                            command.animated              = true;
-                            command.AnimatedDescriptorSet = model.ModelRef->GetAnimationController() ? model.ModelRef->GetAnimationController()->GetDescriptorSet() : m_ForwardData.m_DescriptorSet[3];
+                            if(!bonesWritten)
+                            {
+                                boneOffset   = WriteBonePalette(model.ModelRef->GetAnimationController().get());
+                                bonesWritten = true;
+                            }
+
+                            pipelineDesc.shader = mesh->IsCompact() ? m_ForwardData.m_AnimCompactShader : m_ForwardData.m_AnimShader;
+                            command.animated    = true;
+                            command.BoneOffset  = boneOffset;
                         }
                         else
-                            pipelineDesc.shader = m_ForwardData.m_Shader;
+                            pipelineDesc.shader = mesh->IsCompact() ? m_ForwardData.m_CompactShader : m_ForwardData.m_Shader;
+
+                        pipelineDesc.vertexLayout = mesh->GetVertexLayout();
 #ifndef LUMOS_PRODUCTION
                         static const char* debugName0 = "Forward PBR Transparent DepthTested";
                         static const char* debugName1 = "Forward PBR DepthTested";
@@ -1102,6 +1429,35 @@ namespace Lumos::Graphics
                     }
                 }
             }
+
+            // Forget destroyed or inactive entities once they make up most of the map
+            if(m_ShadowData.m_CasterStates.size() > size_t(visitedCasters) * 2 + 64)
+            {
+                for(auto it = m_ShadowData.m_CasterStates.begin(); it != m_ShadowData.m_CasterStates.end();)
+                {
+                    if(it->second.LastSeenFrame != casterFrame)
+                        it = m_ShadowData.m_CasterStates.erase(it);
+                    else
+                        ++it;
+                }
+            }
+
+            // Upload only the windows written this frame
+            TransientAllocation bonePalette = m_TransientBuffer->Allocate(m_ForwardData.m_BonePaletteOffset, m_ForwardData.m_UniformAlignment);
+            memcpy(bonePalette.Data, m_ForwardData.m_BonePalette.data(), m_ForwardData.m_BonePaletteOffset);
+            m_ForwardData.m_DescriptorSet[3]->SetUniformTransient(m_ForwardData.m_Uniforms.BoneTransforms, m_TransientBuffer.get(), bonePalette);
+            m_ForwardData.m_DescriptorSet[3]->Update();
+        }
+
+        if(renderSettings.ShadowsEnabled && m_ShadowData.m_UseStaticCache)
+        {
+            // Static depth is redrawn when the cascade moves, the light turns or the set of static casters changes
+            for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; i++)
+            {
+                m_ShadowData.m_StaticCascadeDirty[i] = m_ShadowData.m_ShadowMapsInvalidated
+                    || m_ShadowData.m_StaticCascadeHash[i] != m_ShadowData.m_CachedCascadeHash[i]
+                    || m_ShadowData.m_ShadowProjView[i] != m_ShadowData.m_CachedShadowProjView[i];
+            }
         }
 
         m_Renderer2DData.m_CommandQueue2D.clear();
@@ -1168,6 +1524,309 @@ namespace Lumos::Graphics
                           });
             }
         }
+
+        if(renderSettings.Renderer3DEnabled && m_ForwardData.m_SupportInstancing)
+        {
+            LUMOS_PROFILE_SCOPE("Batch Instances");
+            m_ForwardData.m_InstanceTransformCount = 0;
+
+            // Padded by one window so a draw near the end never reads past the allocation
+            const uint32_t instancePadding     = MaxInstancesPerDraw * sizeof(glm::mat4);
+            m_ForwardData.m_InstanceAllocation = m_TransientBuffer->Allocate(MaxInstancedTransforms * sizeof(glm::mat4) + instancePadding, m_ForwardData.m_UniformAlignment);
+            m_ForwardData.m_InstanceTransforms = reinterpret_cast<glm::mat4*>(m_ForwardData.m_InstanceAllocation.Data);
+
+            BatchInstances(m_ForwardData.m_CommandQueue, m_ForwardData.m_InstancedShader);
+            for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; i++)
+            {
+                BatchInstances(m_ShadowData.m_CascadeCommandQueue[i], m_ShadowData.m_ShaderInstanced);
+
+                // Cached cascades aren't redrawn, so their transforms don't need instance buffer space
+                if(m_ShadowData.m_UseStaticCache && m_ShadowData.m_StaticCascadeDirty[i])
+                    BatchInstances(m_ShadowData.m_StaticCascadeCommandQueue[i], m_ShadowData.m_ShaderInstanced);
+            }
+
+            if(m_ForwardData.m_InstanceTransformCount == 0)
+                m_TransientBuffer->Shrink(m_ForwardData.m_InstanceAllocation, 0);
+            else
+            {
+                m_TransientBuffer->Shrink(m_ForwardData.m_InstanceAllocation, m_ForwardData.m_InstanceTransformCount * sizeof(glm::mat4) + instancePadding);
+                m_ForwardData.m_InstanceDescriptorSet->SetUniformTransient(m_ForwardData.m_Uniforms.InstanceTransforms, m_TransientBuffer.get(), m_ForwardData.m_InstanceAllocation);
+                m_ForwardData.m_InstanceDescriptorSet->Update();
+            }
+        }
+    }
+
+    uint32_t RenderPasses::WriteBonePalette(AnimationController* controller)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        // Fall back to the identity window when there is no controller
+        if(!controller)
+            return 0;
+
+        const uint32_t paletteSize = uint32_t(m_ForwardData.m_BonePalette.size() * sizeof(glm::vec4));
+        if(m_ForwardData.m_BonePaletteOffset + m_ForwardData.m_BonePaletteStride > paletteSize)
+        {
+            const uint32_t maxPaletteSize = m_ForwardData.m_BonePaletteStride * (MaxSkinnedModels + 1);
+            if(paletteSize >= maxPaletteSize)
+            {
+                if(!m_ForwardData.m_BonePaletteFullLogged)
+                {
+                    LUMOS_LOG_WARN("Bone palette full, animated models past {0} are drawn in their bind pose", MaxSkinnedModels);
+                    m_ForwardData.m_BonePaletteFullLogged = true;
+                }
+                return 0;
+            }
+
+            // Windows already written keep their offsets, the whole palette is copied out once the queues are built
+            const uint32_t newPaletteSize = Maths::Min(paletteSize * 2, maxPaletteSize);
+            m_ForwardData.m_BonePalette.resize(newPaletteSize / sizeof(glm::vec4), glm::vec4(0.0f));
+        }
+
+        // A controller that hasn't been updated yet has no pose, the model stays in its bind pose
+        const uint32_t offset = m_ForwardData.m_BonePaletteOffset;
+        if(controller->WriteSkinningPalette(&m_ForwardData.m_BonePalette[offset / sizeof(glm::vec4)], MaxSkinningJoints) == 0)
+            return 0;
+
+        m_ForwardData.m_BonePaletteOffset += m_ForwardData.m_BonePaletteStride;
+
+        return offset;
+    }
+
+    void RenderPasses::BatchInstances(CommandQueue& commandQueue, const SharedPtr<Shader>& instancedShader)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        const uint32_t commandCount = uint32_t(commandQueue.size());
+        if(commandCount < 2)
+            return;
+
+        auto& leaders = m_ForwardData.m_InstanceBatchLeaders;
+        auto& counts  = m_ForwardData.m_InstanceBatchCounts;
+        auto& cursors = m_ForwardData.m_InstanceBatchCursors;
+        auto& lookup  = m_ForwardData.m_InstanceBatchLookup;
+
+        leaders.resize(commandCount);
+        counts.resize(commandCount);
+        cursors.resize(commandCount);
+        lookup.clear();
+
+        // Attach each command to the first earlier one sharing its mesh, material, pipeline and LOD.
+        // Skinned, compact and transparent draws keep their own path
+        for(uint32_t i = 0; i < commandCount; i++)
+        {
+            const RenderCommand& command = commandQueue[i];
+            leaders[i]                   = i;
+            counts[i]                    = 1;
+
+            if(command.animated || command.mesh->IsCompact() || command.material->GetFlag(Material::RenderFlags::ALPHABLEND))
+                continue;
+
+            uint64_t key = 0;
+            HashCombine(key, command.mesh, command.material, command.pipeline, command.LOD);
+
+            auto itr = lookup.find(key);
+            if(itr != lookup.end())
+            {
+                const uint32_t leader = itr->second;
+                const auto& first     = commandQueue[leader];
+                if(first.mesh == command.mesh && first.material == command.material && first.pipeline == command.pipeline && first.LOD == command.LOD && counts[leader] < MaxInstancesPerDraw)
+                {
+                    leaders[i] = leader;
+                    counts[leader]++;
+                    continue;
+                }
+            }
+
+            lookup[key] = i;
+        }
+
+        // Rebuild the queue in the original order, leaders take their batch's place
+        auto& merged = m_ForwardData.m_InstanceScratchQueue;
+        merged.clear();
+
+        for(uint32_t i = 0; i < commandCount; i++)
+        {
+            const RenderCommand& command = commandQueue[i];
+            const uint32_t leader        = leaders[i];
+
+            if(leader != i)
+            {
+                if(counts[leader] > 1)
+                    m_ForwardData.m_InstanceTransforms[cursors[leader]++] = command.transform;
+                else
+                    merged.push_back(command);
+
+                continue;
+            }
+
+            const uint32_t count = counts[i];
+            const uint32_t start = (m_ForwardData.m_InstanceTransformCount + m_ForwardData.m_InstanceAlignment - 1) / m_ForwardData.m_InstanceAlignment * m_ForwardData.m_InstanceAlignment;
+
+            // Draw the batch individually when the instance buffer is full
+            if(count == 1 || start + count > MaxInstancedTransforms)
+            {
+                counts[i] = 1;
+                merged.push_back(command);
+                continue;
+            }
+
+            m_ForwardData.m_InstanceTransforms[start] = command.transform;
+            m_ForwardData.m_InstanceTransformCount    = start + count;
+            cursors[i]                                = start + 1;
+
+            Graphics::PipelineDesc pipelineDesc = command.pipeline->GetDesc();
+            pipelineDesc.shader                 = instancedShader;
+
+            RenderCommand& instanced = merged.emplace_back(command);
+            instanced.pipeline       = Graphics::Pipeline::Get(pipelineDesc);
+            instanced.InstanceCount  = count;
+            instanced.InstanceOffset = start * sizeof(glm::mat4);
+        }
+
+        std::swap(commandQueue, merged);
+    }
+
+    CommandBuffer* RenderPasses::GetSecondaryCommandBuffer()
+    {
+        const uint32_t frame = Renderer::GetMainSwapChain()->GetCurrentBufferIndex();
+        if(frame >= m_SecondaryCommandBuffers.size())
+            m_SecondaryCommandBuffers.resize(frame + 1);
+
+        // A buffer can only be recorded once per submit, so each request gets a new one for this frame
+        auto& commandBuffers = m_SecondaryCommandBuffers[frame];
+        if(m_SecondaryCommandBufferIndex >= commandBuffers.size())
+        {
+            CommandBuffer* commandBuffer = CommandBuffer::Create();
+            commandBuffer->Init(false);
+            commandBuffers.push_back(commandBuffer);
+        }
+
+        return commandBuffers[m_SecondaryCommandBufferIndex++];
+    }
+
+    void RenderPasses::RecordCommandQueue(CommandBuffer* commandBuffer, const CommandQueue& commandQueue, Pipeline** pipelines, uint32_t layer, const RecordCommandFunc& record)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        const uint32_t commandCount = uint32_t(commandQueue.size());
+
+        auto GetPipeline = [&commandQueue, pipelines](uint32_t index)
+        {
+            return pipelines ? pipelines[index] : commandQueue[index].pipeline;
+        };
+
+        // Resolve each shader's push constant members once here, so recording never compares member names.
+        // A queue only uses a handful of shaders, so a linear search finds them
+        Arena* frameArena             = Application::Get().GetFrameArena();
+        uint32_t* pushConstantIndices = PushArrayNoZero(frameArena, uint32_t, commandCount);
+        auto& resolvedShaders         = m_ResolvedPushConstantShaders;
+        auto& resolvedPushConstants   = m_ResolvedPushConstants;
+        resolvedShaders.clear();
+        resolvedPushConstants.clear();
+
+        for(uint32_t i = 0; i < commandCount; i++)
+        {
+            Pipeline* pipeline = GetPipeline(i);
+            if(!pipeline)
+                continue;
+
+            Shader* shader = pipeline->GetShader();
+            uint32_t index = 0;
+            while(index < uint32_t(resolvedShaders.size()) && resolvedShaders[index] != shader)
+                index++;
+
+            if(index == uint32_t(resolvedShaders.size()))
+            {
+                resolvedShaders.push_back(shader);
+                resolvedPushConstants.push_back(ResolveMeshPushConstants(shader));
+            }
+            pushConstantIndices[i] = index;
+        }
+
+        auto RecordRange = [&](CommandBuffer* target, uint32_t begin, uint32_t end)
+        {
+            for(uint32_t i = begin; i < end; i++)
+            {
+                if(Pipeline* pipeline = GetPipeline(i))
+                    record(target, commandQueue[i], pipeline, resolvedPushConstants[pushConstantIndices[i]]);
+            }
+        };
+
+        if(!m_MultithreadedRecording || commandCount < MinCommandsPerRecordingJob * 2)
+        {
+            RecordRange(commandBuffer, 0, commandCount);
+            return;
+        }
+
+        // Secondary buffers inherit a single render pass, so split the queue into runs that share one
+        uint32_t runStart = 0;
+        while(runStart < commandCount)
+        {
+            Pipeline* first = GetPipeline(runStart);
+            if(!first)
+            {
+                runStart++;
+                continue;
+            }
+
+            RenderPass* renderPass   = first->GetRenderPass();
+            Framebuffer* framebuffer = first->GetFramebuffer(layer);
+
+            uint32_t runEnd    = runStart + 1;
+            uint32_t drawCount = 1;
+            while(runEnd < commandCount)
+            {
+                Pipeline* pipeline = GetPipeline(runEnd);
+                if(pipeline && (pipeline->GetRenderPass() != renderPass || pipeline->GetFramebuffer(layer) != framebuffer))
+                    break;
+
+                drawCount += pipeline ? 1 : 0;
+                runEnd++;
+            }
+
+            const uint32_t runLength = runEnd - runStart;
+            const uint32_t jobCount  = Maths::Min(System::JobSystem::GetThreadCount(), (runLength + MinCommandsPerRecordingJob - 1) / MinCommandsPerRecordingJob);
+
+            if(jobCount <= 1 || !renderPass || !framebuffer)
+            {
+                RecordRange(commandBuffer, runStart, runEnd);
+                runStart = runEnd;
+                continue;
+            }
+
+            CommandBuffer** secondaryBuffers = PushArrayNoZero(frameArena, CommandBuffer*, jobCount);
+            for(uint32_t i = 0; i < jobCount; i++)
+                secondaryBuffers[i] = GetSecondaryCommandBuffer();
+
+            const uint32_t jobSize = (runLength + jobCount - 1) / jobCount;
+            const uint32_t width   = first->GetWidth();
+            const uint32_t height  = first->GetHeight();
+            const bool flip        = first->GetDesc().swapchainTarget;
+
+            System::JobSystem::Context context;
+            System::JobSystem::Dispatch(context, jobCount, 1, [&](JobDispatchArgs args)
+                                        {
+                                            const uint32_t begin = runStart + args.jobIndex * jobSize;
+                                            const uint32_t end   = Maths::Min(begin + jobSize, runEnd);
+
+                                            // Viewport and scissor are not inherited from the primary
+                                            CommandBuffer* secondary = secondaryBuffers[args.jobIndex];
+                                            secondary->BeginRecordingSecondary(renderPass, framebuffer);
+                                            secondary->UpdateViewport(width, height, flip);
+                                            RecordRange(secondary, begin, end);
+                                            secondary->EndRecording();
+                                        });
+
+            // Open the render pass while the workers record, then replay their buffers in queue order
+            commandBuffer->BeginSecondaryRenderPass(first, layer);
+            System::JobSystem::Wait(context);
+
+            for(uint32_t i = 0; i < jobCount; i++)
+                secondaryBuffers[i]->ExecuteSecondary(commandBuffer);
+
+            commandBuffer->UnBindPipeline();
+            Engine::Get().Statistics().NumDrawCalls += drawCount;
+
+            runStart = runEnd;
+        }
     }
 
     void RenderPasses::SetRenderTarget(Graphics::Texture* texture, bool onlyIfTargetsScreen, bool rebuildFramebuffer)
@@ -1183,6 +1842,8 @@ namespace Lumos::Graphics
 
         auto& sceneRenderSettings = Application::Get().GetCurrentScene()->GetSettings().RenderSettings;
 
+        m_SecondaryCommandBufferIndex = 0;
+
         {
             LUMOS_PROFILE_GPU("Clear Main Texture Pass");
             Renderer::GetRenderer()->ClearRenderTarget(m_MainTexture, Renderer::GetMainSwapChain()->GetCurrentCommandBuffer());
@@ -1195,7 +1856,8 @@ namespace Lumos::Graphics
             Renderer::GetRenderer()->ClearRenderTarget(m_NormalTexture, Renderer::GetMainSwapChain()->GetCurrentCommandBuffer());
         }
 
-        if(sceneRenderSettings.ShadowsEnabled)
+        // The static cache rewrites every cascade layer it draws to, see ShadowPass
+        if(sceneRenderSettings.ShadowsEnabled && !m_ShadowData.m_UseStaticCache)
         {
             LUMOS_PROFILE_GPU("Clear Shadow Texture Pass");
             Renderer::GetMainSwapChain()->GetCurrentCommandBuffer()->UnBindPipeline();
@@ -1393,6 +2055,11 @@ namespace Lumos::Graphics
         ImGuiUtilities::Property("Number of draw calls", (int&)m_Renderer2DData.m_BatchDrawCallIndex, ImGuiUtilities::PropertyFlag::ReadOnly);
         ImGuiUtilities::Property("Max textures Per draw call", (int&)m_Renderer2DData.m_Limits.MaxTextures, 1, 16);
         ImGuiUtilities::Property("Exposure", m_Exposure);
+        if(Renderer::GetCapabilities().SecondaryCommandBuffers)
+            ImGuiUtilities::Property("Multithreaded Recording", m_MultithreadedRecording);
+        if(Renderer::GetCapabilities().TextureLayerCopy)
+            ImGuiUtilities::Property("Cache Static Shadows", m_ShadowData.m_CacheStaticCasters);
+        ImGuiUtilities::Property("Occlusion Culling", m_ForwardData.m_OcclusionCulling);
 
         ImGui::Columns(1);
         ImGui::Separator();
@@ -1414,6 +2081,9 @@ namespace Lumos::Graphics
         descriptorDesc.layoutIndex              = 0;
         descriptorDesc.shader                   = m_SkyboxShader.get();
         m_SkyboxDescriptorSet                   = SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
+
+        m_ShadowData.m_ShadowMapsInvalidated = true;
+        m_ShadowData.m_CasterStates.clear();
     }
 
     float RoundUpToNearestMultipleOf5(float value)
@@ -1514,12 +2184,26 @@ namespace Lumos::Graphics
             static const float roundTo[8] = { 5.0f, 5.0f, 20.0f, 200.0f, 400.0f, 400.0f, 400.0f, 400.0f };
             radius                        = RoundUpToNearestMultipleOf5(radius);
 
+            glm::vec3 lightDir = glm::normalize(-light->Direction);
+
+            if(m_ShadowData.m_UseStaticCache)
+            {
+                // Snap the center to a light space grid so the cascade matrix only changes once the
+                // camera has moved a whole step, the radius grows by a step to keep the frustum covered
+                const float snap          = radius * ShadowCacheSnapFraction;
+                const glm::mat4 lightView = glm::lookAt(glm::vec3(0.0f), lightDir, glm::vec3(0.0f, 0.0f, 1.0f));
+
+                glm::vec3 lightSpaceCenter = glm::vec3(lightView * glm::vec4(frustumCenter, 1.0f));
+                lightSpaceCenter           = glm::floor(lightSpaceCenter / snap + 0.5f) * snap;
+                frustumCenter              = glm::vec3(glm::inverse(lightView) * glm::vec4(lightSpaceCenter, 1.0f));
+                radius += snap;
+            }
+
             cascadeRadius[i] = radius;
 
             glm::vec3 maxExtents = glm::vec3(radius);
             glm::vec3 minExtents = -maxExtents;
 
-            glm::vec3 lightDir         = glm::normalize(-light->Direction);
             glm::mat4 lightOrthoMatrix = glm::ortho(minExtents.x, maxExtents.x, minExtents.y, maxExtents.y, m_ShadowData.CascadeNearPlaneOffset, maxExtents.z - minExtents.z + m_ShadowData.CascadeFarPlaneOffset);
             glm::mat4 LightViewMatrix  = glm::lookAt(frustumCenter - lightDir * -minExtents.z, frustumCenter, glm::vec3(0.0f, 0.0f, 1.0f));
 
@@ -1583,11 +2267,16 @@ namespace Lumos::Graphics
         LUMOS_PROFILE_FUNCTION();
         LUMOS_PROFILE_GPU("Shadow Pass");
 
+        const bool useCache = m_ShadowData.m_UseStaticCache;
+
         bool empty = true;
         for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; ++i)
         {
             if(!m_ShadowData.m_CascadeCommandQueue[i].empty())
                 empty = false;
+
+            if(useCache && (m_ShadowData.m_StaticCascadeDirty[i] || !m_ShadowData.m_LiveCascadeMatchesCache[i]))
+                empty = false;
         }
 
         if(empty)
@@ -1597,59 +2286,103 @@ namespace Lumos::Graphics
         commandBuffer->UnBindPipeline();
         commandBuffer->EndCurrentRenderPass();
 
-        m_ShadowData.m_DescriptorSet[0]->SetUniform("ShadowData", "DirLightMatrices", m_ShadowData.m_ShadowProjView);
+        m_ShadowData.m_DescriptorSet[0]->SetUniform(m_ShadowData.m_DirLightMatricesHandle[0], m_ShadowData.m_ShadowProjView);
         m_ShadowData.m_DescriptorSet[0]->Update();
 
-        m_ShadowData.m_DescriptorSet[1]->SetUniform("ShadowData", "DirLightMatrices", m_ShadowData.m_ShadowProjView);
+        m_ShadowData.m_DescriptorSet[1]->SetUniform(m_ShadowData.m_DirLightMatricesHandle[1], m_ShadowData.m_ShadowProjView);
         m_ShadowData.m_DescriptorSet[1]->Update();
 
-        Arena* frameArena                  = Application::Get().GetFrameArena();
-        DescriptorSet** currentDescriptors = PushArrayNoZero(frameArena, DescriptorSet*, 4);
-
         for(uint32_t i = 0; i < m_ShadowData.m_ShadowMapNum; ++i)
         {
             LUMOS_PROFILE_GPU("Shadow Layer Pass");
 
             m_ShadowData.m_Layer = i;
 
-            for(auto& command : m_ShadowData.m_CascadeCommandQueue[m_ShadowData.m_Layer])
+            const uint32_t layer = m_ShadowData.m_Layer;
+
+            auto RecordShadow = [this, layer](CommandBuffer* recordBuffer, const RenderCommand& command, Pipeline* pipeline, const MeshPushConstants& pushHandles)
             {
-                Material* material    = command.material ? command.material : m_ForwardData.m_DefaultMaterial;
-                currentDescriptors[1] = material->GetDescriptorSet();
-                bool alphaBlend       = material->GetFlag(Material::RenderFlags::ALPHABLEND);
+                Material* material = command.material ? command.material : m_ForwardData.m_DefaultMaterial;
+                bool alphaBlend    = material->GetFlag(Material::RenderFlags::ALPHABLEND);
 
-                uint32_t layer      = static_cast<uint32_t>(m_ShadowData.m_Layer);
-                auto& pushConstants = command.pipeline->GetShader()->GetPushConstants();
-                memcpy(pushConstants[0].data + sizeof(glm::mat4), &layer, sizeof(uint32_t));
+                DescriptorSet* currentDescriptors[3];
                 currentDescriptors[0] = alphaBlend ? m_ShadowData.m_DescriptorSet[1].get() : m_ShadowData.m_DescriptorSet[0].get();
+                currentDescriptors[1] = material->GetDescriptorSet();
 
                 if(command.animated)
                 {
                     if(alphaBlend)
                     {
-                        currentDescriptors[2] = command.AnimatedDescriptorSet;
+                        currentDescriptors[2] = m_ForwardData.m_DescriptorSet[3].get();
                     }
                     else
                     {
-                        currentDescriptors[1] = command.AnimatedDescriptorSet;
+                        currentDescriptors[1] = m_ForwardData.m_DescriptorSet[3].get();
                     }
                 }
 
-                auto pipeline = command.pipeline;
-                commandBuffer->BindPipeline(pipeline, m_ShadowData.m_Layer);
+                // Instanced batches are never alpha blended, see BatchInstances
+                const bool instanced = command.InstanceCount > 1;
+                if(instanced)
+                    currentDescriptors[1] = m_ForwardData.m_InstanceDescriptorSet.get();
+
+                recordBuffer->BindPipeline(pipeline, layer);
+
+                // Instanced shaders apply the model matrix themselves
+                Mesh* mesh          = command.mesh;
+                auto& pushConstants = pipeline->GetShader()->GetPushConstants()[0];
+                auto transform      = instanced ? m_ShadowData.m_ShadowProjView[layer] : m_ShadowData.m_ShadowProjView[layer] * command.transform;
+
+                uint8_t pushData[MaxPushConstantSize] = {};
+                memcpy(pushData, &transform, sizeof(glm::mat4));
+                memcpy(pushData + sizeof(glm::mat4), &layer, sizeof(uint32_t));
+                SetCompactPushConstants(pushConstants, pushHandles, pushData, mesh);
+
+                pipeline->GetShader()->BindPushConstantData(recordBuffer, pipeline, 0, pushData);
+                Renderer::BindDescriptorSets(pipeline, recordBuffer, instanced ? command.InstanceOffset : command.BoneOffset, currentDescriptors, (command.animated || instanced) ? (alphaBlend ? 3 : 2) : (alphaBlend ? 2 : 1));
+                Renderer::DrawMesh(recordBuffer, pipeline, mesh, command.LOD, command.InstanceCount);
+            };
+
+            if(useCache)
+            {
+                if(m_ShadowData.m_StaticCascadeDirty[layer])
+                {
+                    LUMOS_PROFILE_GPU("Static Shadow Layer Pass");
+                    Renderer::GetRenderer()->ClearRenderTargetLayer(m_ShadowData.m_StaticShadowTex, layer, commandBuffer);
+
+                    for(auto& command : m_ShadowData.m_StaticCascadeCommandQueue[layer])
+                        m_Stats.NumShadowObjects += command.InstanceCount;
+
+                    RecordCommandQueue(commandBuffer, m_ShadowData.m_StaticCascadeCommandQueue[layer], nullptr, layer, RecordShadow);
+                    commandBuffer->UnBindPipeline();
+                    commandBuffer->EndCurrentRenderPass();
+
+                    m_ShadowData.m_CachedCascadeHash[layer]       = m_ShadowData.m_StaticCascadeHash[layer];
+                    m_ShadowData.m_CachedShadowProjView[layer]    = m_ShadowData.m_ShadowProjView[layer];
+                    m_ShadowData.m_LiveCascadeMatchesCache[layer] = false;
+                }
+
+                // Without dynamic casters the live layer can keep last frame's copy
+                if(m_ShadowData.m_CascadeCommandQueue[layer].empty() && m_ShadowData.m_LiveCascadeMatchesCache[layer])
+                    continue;
 
-                Mesh* mesh     = command.mesh;
-                auto transform = m_ShadowData.m_ShadowProjView[m_ShadowData.m_Layer] * command.transform;
-                memcpy(pushConstants[0].data, &transform, sizeof(glm::mat4));
+                if(!Renderer::GetRenderer()->CopyTextureLayer(m_ShadowData.m_StaticShadowTex, m_ShadowData.m_ShadowTex, layer, commandBuffer))
+                    Renderer::GetRenderer()->ClearRenderTargetLayer(m_ShadowData.m_ShadowTex, layer, commandBuffer);
 
-                command.pipeline->GetShader()->BindPushConstants(commandBuffer, pipeline);
-                Renderer::BindDescriptorSets(pipeline, commandBuffer, 0, currentDescriptors, command.animated ? (alphaBlend ? 3 : 2) : (alphaBlend ? 2 : 1));
-                Renderer::DrawMesh(commandBuffer, pipeline, mesh);
-                m_Stats.NumShadowObjects++;
+                m_ShadowData.m_LiveCascadeMatchesCache[layer] = m_ShadowData.m_CascadeCommandQueue[layer].empty();
             }
+
+            for(auto& command : m_ShadowData.m_CascadeCommandQueue[m_ShadowData.m_Layer])
+                m_Stats.NumShadowObjects += command.InstanceCount;
+
+            RecordCommandQueue(commandBuffer, m_ShadowData.m_CascadeCommandQueue[layer], nullptr, layer, RecordShadow);
+
             commandBuffer->UnBindPipeline();
             commandBuffer->EndCurrentRenderPass();
         }
+
+        if(useCache)
+            m_ShadowData.m_ShadowMapsInvalidated = false;
     }
 
     void RenderPasses::DepthPrePass()
@@ -1669,42 +2402,81 @@ namespace Lumos::Graphics
         pipelineDesc.DebugName        = "Depth Prepass";
         pipelineDesc.samples          = m_MainTextureSamples;
 
-        DescriptorSet* sets[3];
-        sets[0] = m_ForwardData.m_DescriptorSet[0].get();
+        // Pipelines are looked up here as the cache can't be touched from the recording threads
+        const uint32_t commandCount = uint32_t(m_ForwardData.m_CommandQueue.size());
+        Arena* frameArena           = Application::Get().GetFrameArena();
+        Pipeline** pipelines        = PushArrayNoZero(frameArena, Pipeline*, commandCount);
 
-        for(auto& command : m_ForwardData.m_CommandQueue)
+        for(uint32_t i = 0; i < commandCount; i++)
         {
+            auto& command      = m_ForwardData.m_CommandQueue[i];
             Material* material = command.material ? command.material : m_ForwardData.m_DefaultMaterial;
-            sets[1]            = material->GetDescriptorSet();
+            pipelines[i]       = nullptr;
+
             if(!material->GetFlag(Material::RenderFlags::DEPTHTEST)) // || command.material->GetFlag(Material::RenderFlags::ALPHABLEND))
                 continue;
 
             bool alphaBlend = material->GetFlag(Material::RenderFlags::ALPHABLEND);
-
-            if(command.animated)
-            {
-                if(alphaBlend)
-                    sets[2] = command.AnimatedDescriptorSet;
-                else
-                    sets[1] = command.AnimatedDescriptorSet;
-            }
+            Mesh* mesh      = command.mesh;
 
             pipelineDesc.transparencyEnabled = alphaBlend;
-            pipelineDesc.shader              = command.animated ? (alphaBlend ? m_DepthPrePassAlphaAnimShader : m_DepthPrePassAnimShader) : (alphaBlend ? m_DepthPrePassAlphaShader : m_DepthPrePassShader);
-
-            auto pipeline = Graphics::Pipeline::Get(pipelineDesc);
-            commandBuffer->BindPipeline(pipeline);
-
-            Mesh* mesh           = command.mesh;
-            auto& worldTransform = command.transform;
-
-            auto& pushConstants = m_DepthPrePassShader->GetPushConstants()[0];
-            pushConstants.SetValue("transform", (void*)&worldTransform);
+            pipelineDesc.vertexLayout        = mesh->GetVertexLayout();
+            if(command.InstanceCount > 1)
+                pipelineDesc.shader = m_DepthPrePassInstancedShader;
+            else if(mesh->IsCompact())
+                pipelineDesc.shader = command.animated ? (alphaBlend ? m_DepthPrePassAlphaAnimCompactShader : m_DepthPrePassAnimCompactShader) : (alphaBlend ? m_DepthPrePassAlphaCompactShader : m_DepthPrePassCompactShader);
+            else
+                pipelineDesc.shader = command.animated ? (alphaBlend ? m_DepthPrePassAlphaAnimShader : m_DepthPrePassAnimShader) : (alphaBlend ? m_DepthPrePassAlphaShader : m_DepthPrePassShader);
 
-            m_DepthPrePassShader->BindPushConstants(commandBuffer, pipeline);
-            Renderer::BindDescriptorSets(pipeline, commandBuffer, 0, sets, command.animated ? (alphaBlend ? 3 : 2) : (alphaBlend ? 2 : 1));
-            Renderer::DrawMesh(commandBuffer, pipeline, mesh);
+            pipelines[i] = Graphics::Pipeline::Get(pipelineDesc);
         }
+
+        // Non compact draws share the base shader's push block
+        const MeshPushConstants basePushHandles = ResolveMeshPushConstants(m_DepthPrePassShader.get());
+
+        RecordCommandQueue(commandBuffer, m_ForwardData.m_CommandQueue, pipelines, 0,
+                           [this, &basePushHandles](CommandBuffer* recordBuffer, const RenderCommand& command, Pipeline* pipeline, const MeshPushConstants& pushHandles)
+                           {
+                               Material* material = command.material ? command.material : m_ForwardData.m_DefaultMaterial;
+                               bool alphaBlend    = material->GetFlag(Material::RenderFlags::ALPHABLEND);
+
+                               DescriptorSet* sets[3];
+                               sets[0] = m_ForwardData.m_DescriptorSet[0].get();
+                               sets[1] = material->GetDescriptorSet();
+
+                               if(command.animated)
+                               {
+                                   if(alphaBlend)
+                                       sets[2] = m_ForwardData.m_DescriptorSet[3].get();
+                                   else
+                                       sets[1] = m_ForwardData.m_DescriptorSet[3].get();
+                               }
+
+                               const bool instanced = command.InstanceCount > 1;
+                               if(instanced)
+                                   sets[1] = m_ForwardData.m_InstanceDescriptorSet.get();
+
+                               Mesh* mesh = command.mesh;
+                               recordBuffer->BindPipeline(pipeline);
+
+                               // Compact shaders have a larger push block, so use the pipeline's own
+                               if(!instanced)
+                               {
+                                   const bool compact               = mesh->IsCompact();
+                                   Shader* shader                   = compact ? pipeline->GetShader() : m_DepthPrePassShader.get();
+                                   const MeshPushConstants& handles = compact ? pushHandles : basePushHandles;
+                                   auto& pushConstants              = shader->GetPushConstants()[0];
+
+                                   uint8_t pushData[MaxPushConstantSize];
+                                   pushConstants.SetValue(pushData, handles.Transform, &command.transform);
+                                   SetCompactPushConstants(pushConstants, handles, pushData, mesh);
+
+                                   shader->BindPushConstantData(recordBuffer, pipeline, 0, pushData);
+                               }
+
+                               Renderer::BindDescriptorSets(pipeline, recordBuffer, instanced ? command.InstanceOffset : command.BoneOffset, sets, (command.animated || instanced) ? (alphaBlend ? 3 : 2) : (alphaBlend ? 2 : 1));
+                               Renderer::DrawMesh(recordBuffer, pipeline, mesh, command.LOD, command.InstanceCount);
+                           });
     }
 
     void RenderPasses::SSAOPass()
@@ -1751,16 +2523,16 @@ namespace Lumos::Graphics
 
         Scene::SceneRenderSettings& renderSettings = m_CurrentScene->GetSettings().RenderSettings;
 
-        m_SSAOPassDescriptorSet->SetUniform("UniformBuffer", "invProj", &invProj);
-        m_SSAOPassDescriptorSet->SetUniform("UniformBuffer", "projection", &projection);
-        m_SSAOPassDescriptorSet->SetUniform("UniformBuffer", "view", &view);
+        m_SSAOPassDescriptorSet->SetUniform(m_SSAOUniforms.InvProj, &invProj);
+        m_SSAOPassDescriptorSet->SetUniform(m_SSAOUniforms.Projection, &projection);
+        m_SSAOPassDescriptorSet->SetUniform(m_SSAOUniforms.View, &view);
 
-        m_SSAOPassDescriptorSet->SetUniform("UniformBuffer", "samples", &samples);
-        m_SSAOPassDescriptorSet->SetUniform("UniformBuffer", "ssaoRadius", &renderSettings.SSAOSampleRadius);
+        m_SSAOPassDescriptorSet->SetUniform(m_SSAOUniforms.Samples, &samples);
+        m_SSAOPassDescriptorSet->SetUniform(m_SSAOUniforms.Radius, &renderSettings.SSAOSampleRadius);
 
-        m_SSAOPassDescriptorSet->SetUniform("UniformBuffer", "near", &nearC);
-        m_SSAOPassDescriptorSet->SetUniform("UniformBuffer", "far", &farC);
-        m_SSAOPassDescriptorSet->SetUniform("UniformBuffer", "strength", &renderSettings.SSAOStrength);
+        m_SSAOPassDescriptorSet->SetUniform(m_SSAOUniforms.Near, &nearC);
+        m_SSAOPassDescriptorSet->SetUniform(m_SSAOUniforms.Far, &farC);
+        m_SSAOPassDescriptorSet->SetUniform(m_SSAOUniforms.Strength, &renderSettings.SSAOStrength);
 
         m_SSAOPassDescriptorSet->SetTexture("in_Depth", m_ForwardData.m_DepthTexture);
         m_SSAOPassDescriptorSet->SetTexture("in_Noise", m_NoiseTexture);
@@ -1798,9 +2570,9 @@ namespace Lumos::Graphics
         Scene::SceneRenderSettings& renderSettings = m_CurrentScene->GetSettings().RenderSettings;
         auto view                                  = glm::inverse(m_CameraTransform->GetWorldMatrix());
 
-        m_SSAOBlurPassDescriptorSet->SetUniform("UniformBuffer", "view", &view);
-        m_SSAOBlurPassDescriptorSet->SetUniform("UniformBuffer", "ssaoTexelOffset", &ssaoTexelOffset);
-        m_SSAOBlurPassDescriptorSet->SetUniform("UniformBuffer", "ssaoBlurRadius", &renderSettings.SSAOBlurRadius);
+        m_SSAOBlurPassDescriptorSet->SetUniform(m_SSAOBlurUniforms.View, &view);
+        m_SSAOBlurPassDescriptorSet->SetUniform(m_SSAOBlurUniforms.TexelOffset, &ssaoTexelOffset);
+        m_SSAOBlurPassDescriptorSet->SetUniform(m_SSAOBlurUniforms.BlurRadius, &renderSettings.SSAOBlurRadius);
 
         m_SSAOBlurPassDescriptorSet->SetTexture("in_Depth", m_ForwardData.m_DepthTexture);
         m_SSAOBlurPassDescriptorSet->SetTexture("in_SSAO", m_SSAOTexture);
@@ -1810,9 +2582,9 @@ namespace Lumos::Graphics
 
         ssaoTexelOffset = glm::vec2(0.0f, 2.0f / m_SSAOTexture->GetHeight());
 
-        m_SSAOBlurPassDescriptorSet2->SetUniform("UniformBuffer", "view", &view);
-        m_SSAOBlurPassDescriptorSet2->SetUniform("UniformBuffer", "ssaoTexelOffset", &ssaoTexelOffset);
-        m_SSAOBlurPassDescriptorSet2->SetUniform("UniformBuffer", "ssaoBlurRadius", &renderSettings.SSAOBlurRadius);
+        m_SSAOBlurPassDescriptorSet2->SetUniform(m_SSAOBlurUniforms.View, &view);
+        m_SSAOBlurPassDescriptorSet2->SetUniform(m_SSAOBlurUniforms.TexelOffset, &ssaoTexelOffset);
+        m_SSAOBlurPassDescriptorSet2->SetUniform(m_SSAOBlurUniforms.BlurRadius, &renderSettings.SSAOBlurRadius);
 
         m_SSAOBlurPassDescriptorSet2->SetTexture("in_Depth", m_ForwardData.m_DepthTexture);
         m_SSAOBlurPassDescriptorSet2->SetTexture("in_SSAO", m_SSAOTexture1);
@@ -1848,33 +2620,45 @@ namespace Lumos::Graphics
         Graphics::CommandBuffer* commandBuffer = Renderer::GetMainSwapChain()->GetCurrentCommandBuffer();
         m_ForwardData.m_DescriptorSet[2]->TransitionImages(commandBuffer);
 
-        Arena* frameArena                  = Application::Get().GetFrameArena();
-        DescriptorSet** currentDescriptors = PushArrayNoZero(frameArena, DescriptorSet*, 4);
-
         for(auto& command : m_ForwardData.m_CommandQueue)
-        {
-            m_Stats.NumRenderedObjects++;
-
-            Mesh* mesh           = command.mesh;
-            auto& worldTransform = command.transform;
-            Material* material   = command.material ? command.material : m_ForwardData.m_DefaultMaterial;
-            auto pipeline        = command.pipeline;
-            commandBuffer->BindPipeline(pipeline);
-
-            currentDescriptors[0] = m_ForwardData.m_DescriptorSet[0].get();
-            currentDescriptors[1] = material->GetDescriptorSet();
-            currentDescriptors[2] = m_ForwardData.m_DescriptorSet[2].get();
-
-            if(command.animated)
-                currentDescriptors[3] = command.AnimatedDescriptorSet ? command.AnimatedDescriptorSet : m_ForwardData.m_DescriptorSet[3].get();
-
-            auto& pushConstants = m_ForwardData.m_Shader->GetPushConstants()[0];
-            pushConstants.SetData((void*)&worldTransform);
-
-            m_ForwardData.m_Shader->BindPushConstants(commandBuffer, pipeline);
-            Renderer::BindDescriptorSets(pipeline, commandBuffer, 0, currentDescriptors, command.animated ? 4 : 3);
-            Renderer::DrawMesh(commandBuffer, pipeline, mesh);
-        }
+            m_Stats.NumRenderedObjects += command.InstanceCount;
+
+        RecordCommandQueue(commandBuffer, m_ForwardData.m_CommandQueue, nullptr, 0,
+                           [this](CommandBuffer* recordBuffer, const RenderCommand& command, Pipeline* pipeline, const MeshPushConstants& pushHandles)
+                           {
+                               Mesh* mesh         = command.mesh;
+                               Material* material = command.material ? command.material : m_ForwardData.m_DefaultMaterial;
+                               recordBuffer->BindPipeline(pipeline);
+
+                               DescriptorSet* currentDescriptors[4];
+                               currentDescriptors[0] = m_ForwardData.m_DescriptorSet[0].get();
+                               currentDescriptors[1] = material->GetDescriptorSet();
+                               currentDescriptors[2] = m_ForwardData.m_DescriptorSet[2].get();
+
+                               const bool instanced = command.InstanceCount > 1;
+                               if(command.animated)
+                                   currentDescriptors[3] = m_ForwardData.m_DescriptorSet[3].get();
+                               else if(instanced)
+                                   currentDescriptors[3] = m_ForwardData.m_InstanceDescriptorSet.get();
+
+                               // Instanced shaders read their transforms from the instance buffer instead
+                               uint8_t pushData[MaxPushConstantSize];
+                               if(mesh->IsCompact())
+                               {
+                                   auto& pushConstants = pipeline->GetShader()->GetPushConstants()[0];
+                                   pushConstants.SetValue(pushData, pushHandles.Transform, &command.transform);
+                                   SetCompactPushConstants(pushConstants, pushHandles, pushData, mesh);
+                                   pipeline->GetShader()->BindPushConstantData(recordBuffer, pipeline, 0, pushData);
+                               }
+                               else if(!instanced)
+                               {
+                                   memcpy(pushData, &command.transform, sizeof(glm::mat4));
+                                   m_ForwardData.m_Shader->BindPushConstantData(recordBuffer, pipeline, 0, pushData);
+                               }
+
+                               Renderer::BindDescriptorSets(pipeline, recordBuffer, instanced ? command.InstanceOffset : command.BoneOffset, currentDescriptors, (command.animated || instanced) ? 4 : 3);
+                               Renderer::DrawMesh(recordBuffer, pipeline, mesh, command.LOD, command.InstanceCount);
+                           });
     }
 
     void RenderPasses::SkyboxPass()
@@ -1891,9 +2675,9 @@ namespace Lumos::Graphics
         int mode        = 0;
         float exposure  = m_Exposure * 120000.0f;
         float blurLevel = m_CurrentScene->GetSettings().RenderSettings.SkyboxMipLevel;
-        m_SkyboxDescriptorSet->SetUniform("UniformBuffer", "Mode", &mode);
-        m_SkyboxDescriptorSet->SetUniform("UniformBuffer", "Exposure", &exposure);
-        m_SkyboxDescriptorSet->SetUniform("UniformBuffer", "BlurLevel", &blurLevel);
+        m_SkyboxDescriptorSet->SetUniform(m_SkyboxUniforms.Mode, &mode);
+        m_SkyboxDescriptorSet->SetUniform(m_SkyboxUniforms.Exposure, &exposure);
+        m_SkyboxDescriptorSet->SetUniform(m_SkyboxUniforms.BlurLevel, &blurLevel);
         m_SkyboxDescriptorSet->SetTexture("u_CubeMap", m_CubeMap, 0, TextureType::CUBE);
         m_SkyboxDescriptorSet->Update();
 
@@ -1949,8 +2733,8 @@ namespace Lumos::Graphics
         glm::vec2 DepthConsts = { depthLinearizeMul, depthLinearizeAdd };
         glm::vec2 DOFParams   = { renderSettings.DepthOfFieldDistance, renderSettings.DepthOfFieldStrength };
 
-        m_DepthOfFieldPassDescriptorSet->SetUniform("UniformBuffer", "DOFParams", &DOFParams);
-        m_DepthOfFieldPassDescriptorSet->SetUniform("UniformBuffer", "DepthConsts", &DepthConsts);
+        m_DepthOfFieldPassDescriptorSet->SetUniform(m_DepthOfFieldUniforms.DOFParams, &DOFParams);
+        m_DepthOfFieldPassDescriptorSet->SetUniform(m_DepthOfFieldUniforms.DepthConsts, &DepthConsts);
 
         m_DepthOfFieldPassDescriptorSet->SetTexture("u_Texture", m_LastRenderTarget);
         m_DepthOfFieldPassDescriptorSet->SetTexture("u_DepthTexture", m_ForwardData.m_DepthTexture);
@@ -2018,11 +2802,11 @@ namespace Lumos::Graphics
         float Brightness     = m_CurrentScene->GetSettings().RenderSettings.Brightness;
         float Contrast       = m_CurrentScene->GetSettings().RenderSettings.Contrast;
 
-        m_ToneMappingPassDescriptorSet->SetUniform("UniformBuffer", "BloomIntensity", &bloomIntensity);
-        m_ToneMappingPassDescriptorSet->SetUniform("UniformBuffer", "ToneMapIndex", &m_ToneMapIndex);
-        m_ToneMappingPassDescriptorSet->SetUniform("UniformBuffer", "Brightness", &Brightness);
-        m_ToneMappingPassDescriptorSet->SetUniform("UniformBuffer", "Contrast", &Contrast);
-        m_ToneMappingPassDescriptorSet->SetUniform("UniformBuffer", "Saturation", &Saturation);
+        m_ToneMappingPassDescriptorSet->SetUniform(m_ToneMappingUniforms.BloomIntensity, &bloomIntensity);
+        m_ToneMappingPassDescriptorSet->SetUniform(m_ToneMappingUniforms.ToneMapIndex, &m_ToneMapIndex);
+        m_ToneMappingPassDescriptorSet->SetUniform(m_ToneMappingUniforms.Brightness, &Brightness);
+        m_ToneMappingPassDescriptorSet->SetUniform(m_ToneMappingUniforms.Contrast, &Contrast);
+        m_ToneMappingPassDescriptorSet->SetUniform(m_ToneMappingUniforms.Saturation, &Saturation);
 
         m_ToneMappingPassDescriptorSet->SetTexture("u_Texture", m_LastRenderTarget);
         m_ToneMappingPassDescriptorSet->SetTexture("u_BloomTexture", m_BloomTextureLastRenderered);
@@ -2647,8 +3431,8 @@ namespace Lumos::Graphics
         float intensity      = 100.0f;
 
         set->SetTexture("u_Texture", m_LastRenderTarget);
-        set->SetUniform("UniformBuffer", "chromaticAberrationIntensity", &intensity);
-        set->SetUniform("UniformBuffer", "cameraAperture", &cameraAperture);
+        set->SetUniform(m_ChromaticAberationUniforms.Intensity, &intensity);
+        set->SetUniform(m_ChromaticAberationUniforms.CameraAperture, &cameraAperture);
         set->Update();
 
         Graphics::PipelineDesc pipelineDesc {};
@@ -2729,7 +3513,7 @@ namespace Lumos::Graphics
         Renderer2DBeginBatch();
 
         auto projView = m_Camera->GetProjectionMatrix() * glm::inverse(m_CameraTransform->GetWorldMatrix());
-        m_Renderer2DData.m_DescriptorSet[0][0]->SetUniform("UBO", "projView", &projView);
+        m_Renderer2DData.m_DescriptorSet[0][0]->SetUniform(m_Renderer2DData.m_ProjViewHandle, &projView);
         m_Renderer2DData.m_DescriptorSet[0][0]->Update();
 
         for(auto& command : m_Renderer2DData.m_CommandQueue2D)
@@ -2801,32 +3585,22 @@ namespace Lumos::Graphics
 
     void RenderPasses::Renderer2DBeginBatch()
     {
-        uint32_t currentFrame = Renderer::GetMainSwapChain()->GetCurrentBufferIndex();
-
         m_Renderer2DData.m_IndexCount   = 0;
         m_Renderer2DData.m_TextureCount = 0;
 
-        if((int)m_Renderer2DData.m_VertexBuffers[currentFrame].size() - 1 < (int)m_Renderer2DData.m_BatchDrawCallIndex)
-        {
-            auto& vertexBuffer = m_Renderer2DData.m_VertexBuffers[currentFrame].emplace_back(Graphics::VertexBuffer::Create(BufferUsage::DYNAMIC));
-            vertexBuffer->Resize(m_Renderer2DData.m_Limits.BufferSize);
-
-            m_2DBufferBase[currentFrame].emplace_back(new VertexData[m_Renderer2DData.m_Limits.MaxQuads * 4]);
-        }
-
-        m_Renderer2DData.m_VertexBuffers[currentFrame][m_Renderer2DData.m_BatchDrawCallIndex]->Bind(Renderer::GetMainSwapChain()->GetCurrentCommandBuffer(), m_Renderer2DData.m_Pipeline.get());
-        m_Renderer2DData.m_Buffer = m_2DBufferBase[currentFrame][m_Renderer2DData.m_BatchDrawCallIndex];
+        // Reserve a full batch, the unused tail is given back on flush
+        m_Renderer2DData.m_Allocation = m_TransientBuffer->Allocate(m_Renderer2DData.m_Limits.BufferSize);
+        m_Renderer2DData.m_Buffer     = (VertexData*)m_Renderer2DData.m_Allocation.Data;
     }
 
     void RenderPasses::Render2DFlush()
     {
         LUMOS_PROFILE_FUNCTION();
-        uint32_t currentFrame                  = Renderer::GetMainSwapChain()->GetCurrentBufferIndex();
         Graphics::CommandBuffer* commandBuffer = Renderer::GetMainSwapChain()->GetCurrentCommandBuffer();
         commandBuffer->UnBindPipeline();
 
-        uint32_t dataSize = (uint32_t)((uint8_t*)m_Renderer2DData.m_Buffer - (uint8_t*)m_2DBufferBase[currentFrame][m_Renderer2DData.m_BatchDrawCallIndex]);
-        m_Renderer2DData.m_VertexBuffers[currentFrame][m_Renderer2DData.m_BatchDrawCallIndex]->SetData(dataSize, (void*)m_2DBufferBase[currentFrame][m_Renderer2DData.m_BatchDrawCallIndex], true);
+        uint32_t dataSize = (uint32_t)((uint8_t*)m_Renderer2DData.m_Buffer - m_Renderer2DData.m_Allocation.Data);
+        m_TransientBuffer->Shrink(m_Renderer2DData.m_Allocation, dataSize);
         commandBuffer->BindPipeline(m_Renderer2DData.m_Pipeline);
 
         if(m_Renderer2DData.m_DescriptorSet[m_Renderer2DData.m_BatchDrawCallIndex][1] == nullptr || m_Renderer2DData.m_TextureCount != m_Renderer2DData.m_PreviousFrameTextureCount[m_Renderer2DData.m_BatchDrawCallIndex])
@@ -2867,24 +3641,28 @@ namespace Lumos::Graphics
         currentDescriptors[0] = m_Renderer2DData.m_DescriptorSet[0][0].get();
         currentDescriptors[1] = m_Renderer2DData.m_DescriptorSet[m_Renderer2DData.m_BatchDrawCallIndex][1].get();
 
+        m_TransientBuffer->BindVertexBuffer(commandBuffer, m_Renderer2DData.m_Pipeline.get(), m_Renderer2DData.m_Allocation);
         m_Renderer2DData.m_IndexBuffer->SetCount(m_Renderer2DData.m_IndexCount);
         m_Renderer2DData.m_IndexBuffer->Bind(commandBuffer);
 
         Renderer::BindDescriptorSets(m_Renderer2DData.m_Pipeline.get(), commandBuffer, 0, currentDescriptors, 2);
         Renderer::DrawIndexed(commandBuffer, DrawType::TRIANGLE, m_Renderer2DData.m_IndexCount);
 
-        m_Renderer2DData.m_VertexBuffers[currentFrame][m_Renderer2DData.m_BatchDrawCallIndex]->Unbind();
         m_Renderer2DData.m_IndexBuffer->Unbind();
 
         m_Renderer2DData.m_BatchDrawCallIndex++;
         m_Renderer2DData.m_TextureCount = 0;
     }
 
-    void RenderPasses::TextFlush(Renderer2DData& textRenderData, std::vector<TextVertexData*>& textVertexBufferBase, TextVertexData*& textVertexBufferPtr)
+    void RenderPasses::TextBeginBatch(Renderer2DData& textRenderData, TextVertexData*& textVertexBufferPtr)
     {
-        LUMOS_PROFILE_FUNCTION();
-        uint32_t currentFrame = Renderer::GetMainSwapChain()->GetCurrentBufferIndex();
+        textRenderData.m_Allocation = m_TransientBuffer->Allocate(textRenderData.m_Limits.MaxQuads * 4 * sizeof(TextVertexData));
+        textVertexBufferPtr         = (TextVertexData*)textRenderData.m_Allocation.Data;
+    }
 
+    void RenderPasses::TextFlush(Renderer2DData& textRenderData, TextVertexData*& textVertexBufferPtr)
+    {
+        LUMOS_PROFILE_FUNCTION();
         if(textRenderData.m_DescriptorSet[textRenderData.m_BatchDrawCallIndex][1] == nullptr)
         {
             /*
@@ -2919,16 +3697,10 @@ namespace Lumos::Graphics
 
         Graphics::CommandBuffer* commandBuffer = Renderer::GetMainSwapChain()->GetCurrentCommandBuffer();
 
-        if((int)textRenderData.m_VertexBuffers[currentFrame].size() - 1 < (int)textRenderData.m_BatchDrawCallIndex)
-        {
-            auto& vertexBuffer = textRenderData.m_VertexBuffers[currentFrame].emplace_back(Graphics::VertexBuffer::Create(RENDERER_LINE_BUFFER_SIZE, nullptr, BufferUsage::DYNAMIC));
-            // vertexBuffer->Resize(RENDERER_LINE_BUFFER_SIZE);
-        }
-
         commandBuffer->UnBindPipeline();
 
-        uint32_t dataSize = (uint32_t)((uint8_t*)textVertexBufferPtr - (uint8_t*)textVertexBufferBase[currentFrame]);
-        textRenderData.m_VertexBuffers[currentFrame][textRenderData.m_BatchDrawCallIndex]->SetData(dataSize, (void*)textVertexBufferBase[currentFrame], true);
+        uint32_t dataSize = (uint32_t)((uint8_t*)textVertexBufferPtr - textRenderData.m_Allocation.Data);
+        m_TransientBuffer->Shrink(textRenderData.m_Allocation, dataSize);
 
         commandBuffer->BindPipeline(textRenderData.m_Pipeline);
 
@@ -2938,7 +3710,7 @@ namespace Lumos::Graphics
         currentDescriptors[0] = textRenderData.m_DescriptorSet[textRenderData.m_BatchDrawCallIndex][0].get();
         currentDescriptors[1] = textRenderData.m_DescriptorSet[textRenderData.m_BatchDrawCallIndex][1].get();
 
-        textRenderData.m_VertexBuffers[currentFrame][textRenderData.m_BatchDrawCallIndex]->Bind(Renderer::GetMainSwapChain()->GetCurrentCommandBuffer(), textRenderData.m_Pipeline.get());
+        m_TransientBuffer->BindVertexBuffer(commandBuffer, textRenderData.m_Pipeline.get(), textRenderData.m_Allocation);
 
         textRenderData.m_IndexBuffer->SetCount(textRenderData.m_IndexCount);
         textRenderData.m_IndexBuffer->Bind(commandBuffer);
@@ -2946,10 +3718,9 @@ namespace Lumos::Graphics
         Renderer::BindDescriptorSets(textRenderData.m_Pipeline.get(), commandBuffer, 0, currentDescriptors, 2);
         Renderer::DrawIndexed(commandBuffer, DrawType::TRIANGLE, textRenderData.m_IndexCount);
 
-        textRenderData.m_VertexBuffers[currentFrame][textRenderData.m_BatchDrawCallIndex]->Unbind();
         textRenderData.m_IndexBuffer->Unbind();
 
-        textVertexBufferPtr         = textVertexBufferBase[currentFrame];
+        textVertexBufferPtr         = nullptr;
         textRenderData.m_IndexCount = 0;
         textRenderData.m_BatchDrawCallIndex++;
 
@@ -2984,20 +3755,10 @@ namespace Lumos::Graphics
 
         m_TextRendererData.m_Pipeline = Graphics::Pipeline::Get(pipelineDesc);
 
-        uint32_t currentFrame = Renderer::GetMainSwapChain()->GetCurrentBufferIndex();
-
-        if((int)m_TextRendererData.m_VertexBuffers[currentFrame].size() - 1 < (int)m_TextRendererData.m_BatchDrawCallIndex)
-        {
-            auto& vertexBuffer = m_TextRendererData.m_VertexBuffers[currentFrame].emplace_back(Graphics::VertexBuffer::Create(RENDERER_LINE_BUFFER_SIZE, nullptr, BufferUsage::DYNAMIC));
-            // vertexBuffer->Resize(RENDERER_LINE_BUFFER_SIZE);
-        }
-
-        m_TextRendererData.m_VertexBuffers[currentFrame][m_TextRendererData.m_BatchDrawCallIndex]->Bind(Renderer::GetMainSwapChain()->GetCurrentCommandBuffer(), m_TextRendererData.m_Pipeline.get());
-        TextVertexBufferPtr = TextVertexBufferBase[currentFrame];
-        // m_TextBuffer = m_TextRendererData.m_VertexBuffers[currentFrame][m_TextRendererData.m_BatchDrawCallIndex]->GetPointer<TextVertexData>();
+        TextBeginBatch(m_TextRendererData, TextVertexBufferPtr);
 
         auto projView = m_Camera->GetProjectionMatrix() * glm::inverse(m_CameraTransform->GetWorldMatrix());
-        m_TextRendererData.m_DescriptorSet[0][0]->SetUniform("UBO", "projView", &projView);
+        m_TextRendererData.m_DescriptorSet[0][0]->SetUniform(m_TextRendererData.m_ProjViewHandle, &projView);
         m_TextRendererData.m_DescriptorSet[0][0]->Update();
 
         m_TextRendererData.m_TextureCount = 0;
@@ -3009,7 +3770,10 @@ namespace Lumos::Graphics
             m_Stats.NumRenderedObjects++;
 
             if(m_TextRendererData.m_IndexCount >= m_TextRendererData.m_Limits.IndiciesSize)
-                TextFlush(m_TextRendererData, TextVertexBufferBase, TextVertexBufferPtr);
+            {
+                TextFlush(m_TextRendererData, TextVertexBufferPtr);
+                TextBeginBatch(m_TextRendererData, TextVertexBufferPtr);
+            }
 
             int textureIndex       = -1;
             auto& string           = textComp.TextString;
@@ -3134,13 +3898,11 @@ namespace Lumos::Graphics
 
         if(m_TextRendererData.m_IndexCount == 0)
         {
-            // m_TextRendererData.m_VertexBuffers[currentFrame][m_TextRendererData.m_BatchDrawCallIndex]->ReleasePointer();
             return;
         }
 
-        TextFlush(m_TextRendererData, TextVertexBufferBase, TextVertexBufferPtr);
+        TextFlush(m_TextRendererData, TextVertexBufferPtr);
 
-        // m_TextRendererData.m_VertexBuffers[currentFrame][m_TextRendererData.m_BatchDrawCallIndex]->ReleasePointer();
     }
 
     void RenderPasses::DebugPass()
@@ -3174,7 +3936,7 @@ namespace Lumos::Graphics
             if(!lines.empty())
             {
                 LUMOS_PROFILE_SCOPE("Debug Lines");
-                m_DebugDrawData.m_LineDescriptorSet[0]->SetUniform("UBO", "projView", &projView);
+                m_DebugDrawData.m_LineDescriptorSet[0]->SetUniform(m_DebugDrawData.m_LineProjViewHandle, &projView);
                 m_DebugDrawData.m_LineDescriptorSet[0]->Update();
 
                 Graphics::CommandBuffer* commandBuffer = Renderer::GetMainSwapChain()->GetCurrentCommandBuffer();
@@ -3199,23 +3961,15 @@ namespace Lumos::Graphics
                 auto pipeline = Graphics::Pipeline::Get(pipelineDesc);
                 Renderer::GetMainSwapChain()->GetCurrentCommandBuffer()->BindPipeline(pipeline);
 
-                if(m_DebugDrawData.m_LineVertexBuffers.empty())
-                    m_DebugDrawData.m_LineVertexBuffers.emplace_back();
-                if((int)m_DebugDrawData.m_LineVertexBuffers[0].size() - 1 < (int)m_DebugDrawData.m_LineBatchDrawCallIndex)
-                {
-                    auto& vertexBuffer = m_DebugDrawData.m_LineVertexBuffers[0].emplace_back(Graphics::VertexBuffer::Create(RENDERER_LINE_BUFFER_SIZE, nullptr, BufferUsage::DYNAMIC));
-                    // vertexBuffer->Resize(RENDERER_LINE_BUFFER_SIZE);
-                }
-
-                m_DebugDrawData.m_LineVertexBuffers[0][m_DebugDrawData.m_LineBatchDrawCallIndex]->Bind(Renderer::GetMainSwapChain()->GetCurrentCommandBuffer(), pipeline.get());
-                m_DebugDrawData.m_LineBuffer = m_LineBufferBase[0][0]; //[m_DebugDrawData.m_LineBatchDrawCallIndex];
-
-                // m_DebugDrawData.m_LineBuffer = m_DebugDrawData.m_LineVertexBuffers[m_DebugDrawData.m_LineBatchDrawCallIndex]->GetPointer<LineVertexData>();
+                DebugLineBeginBatch();
 
                 for(auto& line : lines)
                 {
                     if(m_DebugDrawData.LineIndexCount >= MaxLineIndices)
-                        DebugLineFlush(pipeline);
+                    {
+                        DebugLineFlush(pipeline.get());
+                        DebugLineBeginBatch();
+                    }
 
                     m_DebugDrawData.m_LineBuffer->vertex = line.p1;
                     m_DebugDrawData.m_LineBuffer->colour = line.col;
@@ -3228,18 +3982,14 @@ namespace Lumos::Graphics
                     m_DebugDrawData.LineIndexCount += 2;
                 }
 
-                // m_DebugDrawData.m_LineVertexBuffers[m_DebugDrawData.m_LineBatchDrawCallIndex]->ReleasePointer();
-                // m_DebugDrawData.m_LineVertexBuffers[m_DebugDrawData.m_LineBatchDrawCallIndex]->Unbind();
-                // m_DebugDrawData.m_LineVertexBuffers[m_DebugDrawData.m_LineBatchDrawCallIndex]->Bind(commandBuffer, pipeline.get());
-
-                DebugLineFlush(pipeline);
+                DebugLineFlush(pipeline.get());
             }
 
             if(!thickLines.empty())
             {
                 LUMOS_PROFILE_SCOPE("Debug Thick Lines");
 
-                m_DebugDrawData.m_LineDescriptorSet[0]->SetUniform("UBO", "projView", &projView);
+                m_DebugDrawData.m_LineDescriptorSet[0]->SetUniform(m_DebugDrawData.m_LineProjViewHandle, &projView);
                 m_DebugDrawData.m_LineDescriptorSet[0]->Update();
 
                 Graphics::CommandBuffer* commandBuffer = Renderer::GetMainSwapChain()->GetCurrentCommandBuffer();
@@ -3265,21 +4015,15 @@ namespace Lumos::Graphics
                 auto pipeline = Graphics::Pipeline::Get(pipelineDesc);
                 Renderer::GetMainSwapChain()->GetCurrentCommandBuffer()->BindPipeline(pipeline);
 
-                if(m_DebugDrawData.m_LineVertexBuffers.empty())
-                    m_DebugDrawData.m_LineVertexBuffers.emplace_back();
-                if((int)m_DebugDrawData.m_LineVertexBuffers[0].size() - 1 < (int)m_DebugDrawData.m_LineBatchDrawCallIndex)
-                {
-                    auto& vertexBuffer = m_DebugDrawData.m_LineVertexBuffers[0].emplace_back(Graphics::VertexBuffer::Create(RENDERER_LINE_BUFFER_SIZE, nullptr, BufferUsage::DYNAMIC));
-                    // vertexBuffer->Resize(RENDERER_LINE_BUFFER_SIZE);
-                }
-
-                m_DebugDrawData.m_LineVertexBuffers[0][m_DebugDrawData.m_LineBatchDrawCallIndex]->Bind(Renderer::GetMainSwapChain()->GetCurrentCommandBuffer(), pipeline.get());
-                m_DebugDrawData.m_LineBuffer = m_LineBufferBase[0][0]; //[m_DebugDrawData.m_LineBatchDrawCallIndex];
+                DebugLineBeginBatch();
 
                 for(auto& line : thickLines)
                 {
                     if(m_DebugDrawData.LineIndexCount >= MaxLineIndices)
-                        DebugLineFlush(pipeline);
+                    {
+                        DebugLineFlush(pipeline.get());
+                        DebugLineBeginBatch();
+                    }
 
                     m_DebugDrawData.m_LineBuffer->vertex = line.p1;
                     m_DebugDrawData.m_LineBuffer->colour = line.col;
@@ -3298,7 +4042,7 @@ namespace Lumos::Graphics
             if(!points.empty())
             {
                 LUMOS_PROFILE_SCOPE("Debug Points");
-                m_DebugDrawData.m_PointDescriptorSet[0]->SetUniform("UBO", "projView", &projView);
+                m_DebugDrawData.m_PointDescriptorSet[0]->SetUniform(m_DebugDrawData.m_PointProjViewHandle, &projView);
                 m_DebugDrawData.m_PointDescriptorSet[0]->Update();
 
                 Graphics::CommandBuffer* commandBuffer = Renderer::GetMainSwapChain()->GetCurrentCommandBuffer();
@@ -3322,23 +4066,15 @@ namespace Lumos::Graphics
                 auto pipeline = Graphics::Pipeline::Get(pipelineDesc);
                 commandBuffer->BindPipeline(pipeline);
 
-                if(m_DebugDrawData.m_PointVertexBuffers.empty())
-                    m_DebugDrawData.m_PointVertexBuffers.emplace_back();
-
-                int bufferCount = 0;
-                bufferCount     = (int)m_DebugDrawData.m_PointVertexBuffers[0].size();
-                if((bufferCount - 1) < (int)m_DebugDrawData.m_PointBatchDrawCallIndex)
-                {
-                    m_DebugDrawData.m_PointVertexBuffers[0].emplace_back(Graphics::VertexBuffer::Create(RENDERER_POINT_BUFFER_SIZE, nullptr, BufferUsage::DYNAMIC));
-                }
-
-                m_DebugDrawData.m_PointVertexBuffers[0][m_DebugDrawData.m_PointBatchDrawCallIndex]->Bind(commandBuffer, pipeline.get());
-                m_DebugDrawData.m_PointBuffer = m_PointBufferBase[0][0]; // m_DebugDrawData.m_PointVertexBuffers[m_DebugDrawData.m_PointBatchDrawCallIndex]->GetPointer<PointVertexData>();
+                DebugPointBeginBatch();
 
                 for(auto& pointInfo : points)
                 {
                     if(m_DebugDrawData.PointIndexCount >= MaxPointIndices)
-                        DebugPointFlush(pipeline);
+                    {
+                        DebugPointFlush(pipeline.get());
+                        DebugPointBeginBatch();
+                    }
 
                     glm::vec3 right = pointInfo.size * m_CameraTransform->GetRightDirection();
                     glm::vec3 up    = pointInfo.size * m_CameraTransform->GetUpDirection();
@@ -3377,7 +4113,7 @@ namespace Lumos::Graphics
             {
                 LUMOS_PROFILE_SCOPE("Triangles Lines");
 
-                m_DebugDrawData.m_Renderer2DData.m_DescriptorSet[0][0]->SetUniform("UBO", "projView", &projView);
+                m_DebugDrawData.m_Renderer2DData.m_DescriptorSet[0][0]->SetUniform(m_DebugDrawData.m_Renderer2DData.m_ProjViewHandle, &projView);
                 m_DebugDrawData.m_Renderer2DData.m_DescriptorSet[0][0]->Update();
                 m_DebugDrawData.m_Renderer2DData.m_DescriptorSet[0][1]->Update();
 
@@ -3402,16 +4138,8 @@ namespace Lumos::Graphics
 
                 auto pipeline                                   = Graphics::Pipeline::Get(pipelineDesc);
                 m_DebugDrawData.m_Renderer2DData.m_TextureCount = 0;
-                uint32_t currentFrame                           = Renderer::GetMainSwapChain()->GetCurrentBufferIndex();
-
-                if((int)m_DebugDrawData.m_Renderer2DData.m_VertexBuffers[currentFrame].size() - 1 < (int)m_DebugDrawData.m_Renderer2DData.m_BatchDrawCallIndex)
-                {
-                    auto& vertexBuffer = m_DebugDrawData.m_Renderer2DData.m_VertexBuffers[currentFrame].emplace_back(Graphics::VertexBuffer::Create(RENDERER_LINE_BUFFER_SIZE, nullptr, BufferUsage::DYNAMIC));
-                }
-
-                m_DebugDrawData.m_Renderer2DData.m_VertexBuffers[currentFrame][m_DebugDrawData.m_Renderer2DData.m_BatchDrawCallIndex]->Bind(Renderer::GetMainSwapChain()->GetCurrentCommandBuffer(), pipeline.get());
-                // m_DebugDrawData.m_Renderer2DData.m_Buffer = m_DebugDrawData.m_Renderer2DData.m_VertexBuffers[currentFrame][m_DebugDrawData.m_Renderer2DData.m_BatchDrawCallIndex]->GetPointer<VertexData>();
-                m_DebugDrawData.m_Renderer2DData.m_Buffer = m_QuadBufferBase[currentFrame][m_DebugDrawData.m_Renderer2DData.m_BatchDrawCallIndex];
+                m_DebugDrawData.m_Renderer2DData.m_Allocation   = m_TransientBuffer->Allocate(uint32_t(triangles.size() * 3 * sizeof(VertexData)));
+                m_DebugDrawData.m_Renderer2DData.m_Buffer       = (VertexData*)m_DebugDrawData.m_Renderer2DData.m_Allocation.Data;
 
                 Arena* frameArena                  = Application::Get().GetFrameArena();
                 DescriptorSet** currentDescriptors = PushArrayNoZero(frameArena, DescriptorSet*, 2);
@@ -3448,19 +4176,15 @@ namespace Lumos::Graphics
                 m_DebugDrawData.m_Renderer2DData.m_IndexBuffer->SetCount(m_DebugDrawData.m_Renderer2DData.m_IndexCount);
                 m_DebugDrawData.m_Renderer2DData.m_IndexBuffer->Bind(commandBuffer);
 
-                uint32_t dataSize = (uint32_t)((uint8_t*)m_DebugDrawData.m_Renderer2DData.m_Buffer - (uint8_t*)m_QuadBufferBase[currentFrame][m_DebugDrawData.m_Renderer2DData.m_BatchDrawCallIndex]);
-                m_DebugDrawData.m_Renderer2DData.m_VertexBuffers[currentFrame][m_DebugDrawData.m_Renderer2DData.m_BatchDrawCallIndex]->SetData(dataSize, (void*)m_QuadBufferBase[currentFrame][m_DebugDrawData.m_Renderer2DData.m_BatchDrawCallIndex], true);
-
                 commandBuffer->BindPipeline(pipeline);
+                m_TransientBuffer->BindVertexBuffer(commandBuffer, pipeline.get(), m_DebugDrawData.m_Renderer2DData.m_Allocation);
 
                 Renderer::BindDescriptorSets(pipeline.get(), commandBuffer, 0, currentDescriptors, 2);
                 Renderer::DrawIndexed(commandBuffer, DrawType::TRIANGLE, m_DebugDrawData.m_Renderer2DData.m_IndexCount);
 
-                m_DebugDrawData.m_Renderer2DData.m_VertexBuffers[currentFrame][m_DebugDrawData.m_Renderer2DData.m_BatchDrawCallIndex]->Unbind();
                 m_DebugDrawData.m_Renderer2DData.m_IndexBuffer->Unbind();
 
-                // m_DebugDrawData.m_Renderer2DData.m_BatchDrawCallIndex++;
-                m_DebugDrawData.m_Renderer2DData.m_Buffer     = m_QuadBufferBase[currentFrame][m_DebugDrawData.m_Renderer2DData.m_BatchDrawCallIndex];
+                m_DebugDrawData.m_Renderer2DData.m_Buffer     = nullptr;
                 m_DebugDrawData.m_Renderer2DData.m_IndexCount = 0;
             }
         }
@@ -3489,26 +4213,20 @@ namespace Lumos::Graphics
             // pipelineDesc.depthTarget           = m_ForwardData.m_DepthTexture;
             m_DebugTextRendererData.m_Pipeline = Graphics::Pipeline::Get(pipelineDesc);
 
-            uint32_t currentFrame = Renderer::GetMainSwapChain()->GetCurrentBufferIndex();
-
-            while((int)m_DebugTextRendererData.m_VertexBuffers[currentFrame].size() - 1 < (int)m_DebugTextRendererData.m_BatchDrawCallIndex)
-            {
-                auto& vertexBuffer = m_DebugTextRendererData.m_VertexBuffers[currentFrame].emplace_back(Graphics::VertexBuffer::Create(BufferUsage::DYNAMIC));
-                vertexBuffer->Resize(RENDERER_LINE_BUFFER_SIZE);
-            }
-
-            m_DebugTextRendererData.m_VertexBuffers[currentFrame][m_DebugTextRendererData.m_BatchDrawCallIndex]->Bind(Renderer::GetMainSwapChain()->GetCurrentCommandBuffer(), m_DebugTextRendererData.m_Pipeline.get());
-            DebugTextVertexBufferPtr = DebugTextVertexBufferBase[currentFrame];
+            TextBeginBatch(m_DebugTextRendererData, DebugTextVertexBufferPtr);
             auto projView            = m_Camera->GetProjectionMatrix() * glm::inverse(m_CameraTransform->GetWorldMatrix());
 
-            m_DebugTextRendererData.m_DescriptorSet[m_DebugTextRendererData.m_BatchDrawCallIndex][0]->SetUniform("UBO", "projView", &projView);
+            m_DebugTextRendererData.m_DescriptorSet[m_DebugTextRendererData.m_BatchDrawCallIndex][0]->SetUniform(m_DebugTextRendererData.m_ProjViewHandle, &projView);
             m_DebugTextRendererData.m_DescriptorSet[m_DebugTextRendererData.m_BatchDrawCallIndex][0]->Update();
 
             m_DebugTextRendererData.m_TextureCount = 0;
             m_Stats.NumRenderedObjects++;
 
             if(m_DebugTextRendererData.m_IndexCount >= m_DebugTextRendererData.m_Limits.IndiciesSize)
-                TextFlush(m_DebugTextRendererData, DebugTextVertexBufferBase, DebugTextVertexBufferPtr);
+            {
+                TextFlush(m_DebugTextRendererData, DebugTextVertexBufferPtr);
+                TextBeginBatch(m_DebugTextRendererData, DebugTextVertexBufferPtr);
+            }
 
             int textureIndex = -1;
             // auto& string = textComp.TextString;
@@ -3634,11 +4352,10 @@ namespace Lumos::Graphics
 
             if(m_DebugTextRendererData.m_IndexCount == 0)
             {
-                // m_DebugTextRendererData.m_VertexBuffers[currentFrame][m_DebugTextRendererData.m_BatchDrawCallIndex]->ReleasePointer();
                 return;
             }
 
-            TextFlush(m_DebugTextRendererData, DebugTextVertexBufferBase, DebugTextVertexBufferPtr);
+            TextFlush(m_DebugTextRendererData, DebugTextVertexBufferPtr);
         }
 
         auto& ndtDebugText = DebugRenderer::GetInstance()->GetDebugTextNDT();
@@ -3660,28 +4377,22 @@ namespace Lumos::Graphics
             pipelineDesc.samples               = m_MainTextureSamples;
             m_DebugTextRendererData.m_Pipeline = Graphics::Pipeline::Get(pipelineDesc);
 
-            uint32_t currentFrame = Renderer::GetMainSwapChain()->GetCurrentBufferIndex();
-
-            while((int)m_DebugTextRendererData.m_VertexBuffers[currentFrame].size() - 1 < (int)m_DebugTextRendererData.m_BatchDrawCallIndex)
-            {
-                auto& vertexBuffer = m_DebugTextRendererData.m_VertexBuffers[currentFrame].emplace_back(Graphics::VertexBuffer::Create(BufferUsage::DYNAMIC));
-                vertexBuffer->Resize(RENDERER_LINE_BUFFER_SIZE);
-            }
-
-            m_DebugTextRendererData.m_VertexBuffers[currentFrame][m_DebugTextRendererData.m_BatchDrawCallIndex]->Bind(Renderer::GetMainSwapChain()->GetCurrentCommandBuffer(), m_DebugTextRendererData.m_Pipeline.get());
-            DebugTextVertexBufferPtr = DebugTextVertexBufferBase[currentFrame];
+            TextBeginBatch(m_DebugTextRendererData, DebugTextVertexBufferPtr);
             auto projView            = m_Camera->GetProjectionMatrix() * glm::inverse(m_CameraTransform->GetWorldMatrix());
             DebugRenderer::GetInstance()->SetProjView(projView);
             DebugRenderer::SortLists();
 
-            m_DebugTextRendererData.m_DescriptorSet[m_DebugTextRendererData.m_BatchDrawCallIndex][0]->SetUniform("UBO", "projView", &projView);
+            m_DebugTextRendererData.m_DescriptorSet[m_DebugTextRendererData.m_BatchDrawCallIndex][0]->SetUniform(m_DebugTextRendererData.m_ProjViewHandle, &projView);
             m_DebugTextRendererData.m_DescriptorSet[m_DebugTextRendererData.m_BatchDrawCallIndex][0]->Update();
 
             m_DebugTextRendererData.m_TextureCount = 0;
             m_Stats.NumRenderedObjects++;
 
             if(m_DebugTextRendererData.m_IndexCount >= m_DebugTextRendererData.m_Limits.IndiciesSize)
-                TextFlush(m_DebugTextRendererData, DebugTextVertexBufferBase, DebugTextVertexBufferPtr);
+            {
+                TextFlush(m_DebugTextRendererData, DebugTextVertexBufferPtr);
+                TextBeginBatch(m_DebugTextRendererData, DebugTextVertexBufferPtr);
+            }
 
             int textureIndex = -1;
             // auto& string = textComp.TextString;
@@ -3806,11 +4517,10 @@ namespace Lumos::Graphics
 
             if(m_DebugTextRendererData.m_IndexCount == 0)
             {
-                // m_DebugTextRendererData.m_VertexBuffers[currentFrame][m_DebugTextRendererData.m_BatchDrawCallIndex]->ReleasePointer();
                 return;
             }
 
-            TextFlush(m_DebugTextRendererData, DebugTextVertexBufferBase, DebugTextVertexBufferPtr);
+            TextFlush(m_DebugTextRendererData, DebugTextVertexBufferPtr);
         }
 
         glm::mat4 csProjection = glm::ortho(0.0f, (float)m_MainTexture->GetWidth(), 0.0f, (float)m_MainTexture->GetHeight(), -100.0f, 100.0f);
@@ -3843,25 +4553,19 @@ namespace Lumos::Graphics
             pipelineDesc.samples               = m_MainTextureSamples;
             m_DebugTextRendererData.m_Pipeline = Graphics::Pipeline::Get(pipelineDesc);
 
-            uint32_t currentFrame = Renderer::GetMainSwapChain()->GetCurrentBufferIndex();
-
-            while((int)m_DebugTextRendererData.m_VertexBuffers[currentFrame].size() - 1 < (int)m_DebugTextRendererData.m_BatchDrawCallIndex)
-            {
-                auto& vertexBuffer = m_DebugTextRendererData.m_VertexBuffers[currentFrame].emplace_back(Graphics::VertexBuffer::Create(BufferUsage::DYNAMIC));
-                vertexBuffer->Resize(RENDERER_LINE_BUFFER_SIZE);
-            }
-
-            m_DebugTextRendererData.m_VertexBuffers[currentFrame][m_DebugTextRendererData.m_BatchDrawCallIndex]->Bind(Renderer::GetMainSwapChain()->GetCurrentCommandBuffer(), m_DebugTextRendererData.m_Pipeline.get());
-            DebugTextVertexBufferPtr = DebugTextVertexBufferBase[currentFrame];
+            TextBeginBatch(m_DebugTextRendererData, DebugTextVertexBufferPtr);
 
-            m_DebugTextRendererData.m_DescriptorSet[m_DebugTextRendererData.m_BatchDrawCallIndex][0]->SetUniform("UBO", "projView", &projView);
+            m_DebugTextRendererData.m_DescriptorSet[m_DebugTextRendererData.m_BatchDrawCallIndex][0]->SetUniform(m_DebugTextRendererData.m_ProjViewHandle, &projView);
             m_DebugTextRendererData.m_DescriptorSet[m_DebugTextRendererData.m_BatchDrawCallIndex][0]->Update();
 
             m_DebugTextRendererData.m_TextureCount = 0;
             m_Stats.NumRenderedObjects++;
 
             if(m_DebugTextRendererData.m_IndexCount >= m_DebugTextRendererData.m_Limits.IndiciesSize)
-                TextFlush(m_DebugTextRendererData, DebugTextVertexBufferBase, DebugTextVertexBufferPtr);
+            {
+                TextFlush(m_DebugTextRendererData, DebugTextVertexBufferPtr);
+                TextBeginBatch(m_DebugTextRendererData, DebugTextVertexBufferPtr);
+            }
 
             int textureIndex = -1;
             // auto& string = textComp.TextString;
@@ -3986,78 +4690,70 @@ namespace Lumos::Graphics
 
             if(m_DebugTextRendererData.m_IndexCount == 0)
             {
-                // m_DebugTextRendererData.m_VertexBuffers[currentFrame][m_DebugTextRendererData.m_BatchDrawCallIndex]->ReleasePointer();
                 return;
             }
 
-            TextFlush(m_DebugTextRendererData, DebugTextVertexBufferBase, DebugTextVertexBufferPtr);
+            TextFlush(m_DebugTextRendererData, DebugTextVertexBufferPtr);
         }
     }
 
+    void RenderPasses::DebugLineBeginBatch()
+    {
+        m_DebugDrawData.m_LineAllocation = m_TransientBuffer->Allocate(MaxLineVertices * sizeof(LineVertexData));
+        m_DebugDrawData.m_LineBuffer     = (LineVertexData*)m_DebugDrawData.m_LineAllocation.Data;
+        m_DebugDrawData.LineIndexCount   = 0;
+    }
+
     void RenderPasses::DebugLineFlush(Graphics::Pipeline* pipeline)
     {
         LUMOS_PROFILE_FUNCTION();
+        Graphics::CommandBuffer* commandBuffer = Renderer::GetMainSwapChain()->GetCurrentCommandBuffer();
 
-        m_DebugDrawData.m_LineIndexBuffer->SetCount(m_DebugDrawData.LineIndexCount);
-        m_DebugDrawData.m_LineIndexBuffer->Bind(Renderer::GetMainSwapChain()->GetCurrentCommandBuffer());
+        uint32_t dataSize = (uint32_t)((uint8_t*)m_DebugDrawData.m_LineBuffer - m_DebugDrawData.m_LineAllocation.Data);
+        m_TransientBuffer->Shrink(m_DebugDrawData.m_LineAllocation, dataSize);
+        m_TransientBuffer->BindVertexBuffer(commandBuffer, pipeline, m_DebugDrawData.m_LineAllocation);
 
-        uint32_t dataSize = (uint32_t)((uint8_t*)m_DebugDrawData.m_LineBuffer - (uint8_t*)m_LineBufferBase[0][0]);
-        m_DebugDrawData.m_LineVertexBuffers[0][m_DebugDrawData.m_LineBatchDrawCallIndex]->SetData(dataSize, (void*)m_LineBufferBase[0][0]);
+        m_DebugDrawData.m_LineIndexBuffer->SetCount(m_DebugDrawData.LineIndexCount);
+        m_DebugDrawData.m_LineIndexBuffer->Bind(commandBuffer);
 
         auto* desc = m_DebugDrawData.m_LineDescriptorSet[0].get();
-        Renderer::BindDescriptorSets(pipeline, Renderer::GetMainSwapChain()->GetCurrentCommandBuffer(), 0, &desc, 1);
-        Renderer::DrawIndexed(Renderer::GetMainSwapChain()->GetCurrentCommandBuffer(), DrawType::LINES, m_DebugDrawData.LineIndexCount);
+        Renderer::BindDescriptorSets(pipeline, commandBuffer, 0, &desc, 1);
+        Renderer::DrawIndexed(commandBuffer, DrawType::LINES, m_DebugDrawData.LineIndexCount);
 
-        m_DebugDrawData.m_LineVertexBuffers[0][m_DebugDrawData.m_LineBatchDrawCallIndex]->Unbind();
         m_DebugDrawData.m_LineIndexBuffer->Unbind();
 
         m_DebugDrawData.m_LineBatchDrawCallIndex++;
-        m_DebugDrawData.m_LineBuffer   = m_LineBufferBase[0][0]; //[m_DebugDrawData.m_LineBatchDrawCallIndex];
+        m_DebugDrawData.m_LineBuffer   = nullptr;
         m_DebugDrawData.LineIndexCount = 0;
+    }
 
-        if(m_DebugDrawData.m_LineVertexBuffers.empty())
-            m_DebugDrawData.m_LineVertexBuffers.emplace_back();
-        if((int)m_DebugDrawData.m_LineVertexBuffers[0].size() - 1 < (int)m_DebugDrawData.m_LineBatchDrawCallIndex)
-        {
-            auto& vertexBuffer = m_DebugDrawData.m_LineVertexBuffers[0].emplace_back(Graphics::VertexBuffer::Create(RENDERER_LINE_BUFFER_SIZE, nullptr, BufferUsage::DYNAMIC));
-            // vertexBuffer->Resize(RENDERER_LINE_BUFFER_SIZE);
-        }
-
-        m_DebugDrawData.m_LineVertexBuffers[0][m_DebugDrawData.m_LineBatchDrawCallIndex]->Bind(Renderer::GetMainSwapChain()->GetCurrentCommandBuffer(), pipeline);
-        m_DebugDrawData.m_LineBuffer   = m_LineBufferBase[0][0]; //[m_DebugDrawData.m_LineBatchDrawCallIndex];
-        m_DebugDrawData.LineIndexCount = 0;
+    void RenderPasses::DebugPointBeginBatch()
+    {
+        m_DebugDrawData.m_PointAllocation = m_TransientBuffer->Allocate(MaxPointVertices * sizeof(PointVertexData));
+        m_DebugDrawData.m_PointBuffer     = (PointVertexData*)m_DebugDrawData.m_PointAllocation.Data;
+        m_DebugDrawData.PointIndexCount   = 0;
     }
 
     void RenderPasses::DebugPointFlush(Graphics::Pipeline* pipeline)
     {
         LUMOS_PROFILE_FUNCTION();
+        Graphics::CommandBuffer* commandBuffer = Renderer::GetMainSwapChain()->GetCurrentCommandBuffer();
 
-        // m_DebugDrawData.m_PointVertexBuffers[m_DebugDrawData.m_PointBatchDrawCallIndex]->ReleasePointer();
-        m_DebugDrawData.m_PointIndexBuffer->SetCount(m_DebugDrawData.PointIndexCount);
-        m_DebugDrawData.m_PointIndexBuffer->Bind(Renderer::GetMainSwapChain()->GetCurrentCommandBuffer());
+        uint32_t dataSize = (uint32_t)((uint8_t*)m_DebugDrawData.m_PointBuffer - m_DebugDrawData.m_PointAllocation.Data);
+        m_TransientBuffer->Shrink(m_DebugDrawData.m_PointAllocation, dataSize);
+        m_TransientBuffer->BindVertexBuffer(commandBuffer, pipeline, m_DebugDrawData.m_PointAllocation);
 
-        uint32_t dataSize = (uint32_t)((uint8_t*)m_DebugDrawData.m_PointBuffer - (uint8_t*)m_PointBufferBase[0][0]);
-        m_DebugDrawData.m_PointVertexBuffers[0][m_DebugDrawData.m_PointBatchDrawCallIndex]->SetData(dataSize, (void*)m_PointBufferBase[0][0]);
+        m_DebugDrawData.m_PointIndexBuffer->SetCount(m_DebugDrawData.PointIndexCount);
+        m_DebugDrawData.m_PointIndexBuffer->Bind(commandBuffer);
 
         auto* desc = m_DebugDrawData.m_PointDescriptorSet[0].get();
-        Renderer::BindDescriptorSets(pipeline, Renderer::GetMainSwapChain()->GetCurrentCommandBuffer(), 0, &desc, 1);
-        Renderer::DrawIndexed(Renderer::GetMainSwapChain()->GetCurrentCommandBuffer(), DrawType::TRIANGLE, m_DebugDrawData.PointIndexCount);
+        Renderer::BindDescriptorSets(pipeline, commandBuffer, 0, &desc, 1);
+        Renderer::DrawIndexed(commandBuffer, DrawType::TRIANGLE, m_DebugDrawData.PointIndexCount);
 
-        m_DebugDrawData.m_PointVertexBuffers[0][m_DebugDrawData.m_PointBatchDrawCallIndex]->Unbind();
         m_DebugDrawData.m_PointIndexBuffer->Unbind();
 
         m_DebugDrawData.m_PointBatchDrawCallIndex++;
-
-        if(m_DebugDrawData.m_PointVertexBuffers.empty())
-            m_DebugDrawData.m_PointVertexBuffers.emplace_back();
-
-        if((int)m_DebugDrawData.m_PointVertexBuffers[0].size() - 1 < (int)m_DebugDrawData.m_PointBatchDrawCallIndex)
-        {
-            m_DebugDrawData.m_PointVertexBuffers[0].emplace_back(Graphics::VertexBuffer::Create(RENDERER_POINT_BUFFER_SIZE, nullptr, BufferUsage::DYNAMIC));
-        }
-
-        m_DebugDrawData.m_PointVertexBuffers[0][m_DebugDrawData.m_PointBatchDrawCallIndex]->Bind(Renderer::GetMainSwapChain()->GetCurrentCommandBuffer(), pipeline);
-        m_DebugDrawData.m_PointBuffer   = m_PointBufferBase[0][0];
+        m_DebugDrawData.m_PointBuffer   = nullptr;
         m_DebugDrawData.PointIndexCount = 0;
     }
 
@@ -4245,18 +4941,6 @@ namespace Lumos::Graphics
         if(m_DebugRenderDataInitialised || !m_DebugRenderEnabled)
             return;
 
-        for(int i = 0; i < Renderer::GetMainSwapChain()->GetSwapChainBufferCount(); i++)
-        {
-            if(m_DebugRenderEnabled)
-            {
-                m_QuadBufferBase.emplace_back().push_back(new VertexData[m_DebugDrawData.m_Renderer2DData.m_Limits.MaxQuads * 4]);
-
-                // m_2DBufferBase.push_back(new VertexData[m_Renderer2DData.m_Limits.MaxQuads  * 4]);
-                m_LineBufferBase.emplace_back().push_back(new LineVertexData[m_DebugDrawData.m_Renderer2DData.m_Limits.MaxQuads * 4]);
-                m_PointBufferBase.emplace_back().push_back(new PointVertexData[m_DebugDrawData.m_Renderer2DData.m_Limits.MaxQuads * 4]);
-                DebugTextVertexBufferBase.push_back(new TextVertexData[m_DebugTextRendererData.m_Limits.MaxQuads * 4]);
-            }
-        }
         // Points
         m_DebugDrawData.m_PointShader           = Application::Get().GetAssetManager()->GetAssetData("Batch2DPoint").As<Graphics::Shader>();
         Graphics::DescriptorDesc descriptorDesc = {};
@@ -4265,6 +4949,7 @@ namespace Lumos::Graphics
 
         m_DebugDrawData.m_PointDescriptorSet.resize(1);
         m_DebugDrawData.m_PointDescriptorSet[0] = SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
+        m_DebugDrawData.m_PointProjViewHandle   = m_DebugDrawData.m_PointDescriptorSet[0]->GetUniformHandle("UBO", "projView");
 
         uint32_t* indices = new uint32_t[MaxPointIndices];
 
@@ -4291,6 +4976,7 @@ namespace Lumos::Graphics
         descriptorDesc.shader        = m_DebugDrawData.m_LineShader.get();
         m_DebugDrawData.m_LineDescriptorSet.resize(1);
         m_DebugDrawData.m_LineDescriptorSet[0] = SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
+        m_DebugDrawData.m_LineProjViewHandle   = m_DebugDrawData.m_LineDescriptorSet[0]->GetUniformHandle("UBO", "projView");
 
         indices = new uint32_t[MaxLineIndices];
 
@@ -4316,11 +5002,10 @@ namespace Lumos::Graphics
 
         m_DebugDrawData.m_Renderer2DData.m_DescriptorSet[0].resize(2);
         m_DebugDrawData.m_Renderer2DData.m_DescriptorSet[0][0] = SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
+        m_DebugDrawData.m_Renderer2DData.m_ProjViewHandle      = m_DebugDrawData.m_Renderer2DData.m_DescriptorSet[0][0]->GetUniformHandle("UBO", "projView");
         descriptorDesc.layoutIndex                             = 1;
         m_DebugDrawData.m_Renderer2DData.m_DescriptorSet[0][1] = SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
 
-        m_DebugDrawData.m_Renderer2DData.m_VertexBuffers.resize(3);
-
         indices = new uint32_t[m_DebugDrawData.m_Renderer2DData.m_Limits.IndiciesSize];
 
         {
@@ -4341,8 +5026,6 @@ namespace Lumos::Graphics
         m_DebugTextRendererData.m_Limits.SetMaxQuads(10000);
         m_DebugTextRendererData.m_Limits.MaxTextures = 16; // Renderer::GetCapabilities().MaxTextureUnits;
 
-        DebugTextVertexBufferPtr = DebugTextVertexBufferBase[0];
-
         m_DebugTextRendererData.m_Shader = Application::Get().GetAssetManager()->GetAssetData("Text").As<Graphics::Shader>();
 
         m_DebugTextRendererData.m_TransformationStack.emplace_back(glm::mat4(1.0f));
@@ -4365,8 +5048,8 @@ namespace Lumos::Graphics
             descriptorDesc.layoutIndex                    = 1;
             m_DebugTextRendererData.m_DescriptorSet[i][1] = nullptr; // SharedPtr<Graphics::DescriptorSet>(Graphics::DescriptorSet::Create(descriptorDesc));
         }
+        m_DebugTextRendererData.m_ProjViewHandle = m_DebugTextRendererData.m_DescriptorSet[0][0]->GetUniformHandle("UBO", "projView");
 
-        m_DebugTextRendererData.m_VertexBuffers.resize(Renderer::GetMainSwapChain()->GetSwapChainBufferCount());
         indices = new uint32_t[m_DebugTextRendererData.m_Limits.IndiciesSize];
 
         if(m_DebugTextRendererData.m_TriangleIndicies)
@@ -4424,7 +5107,7 @@ namespace Lumos::Graphics
         {
             if(m_ParticleData.m_TextureCount >= m_ParticleData.m_Limits.MaxTextures)
             {
-                Render2DFlush();
+                ParticleFlush();
                 ParticleBeginBatch();
             }
             m_ParticleData.m_Textures[m_ParticleData.m_TextureCount] = texture;
@@ -4477,7 +5160,7 @@ namespace Lumos::Graphics
         auto projView = m_Camera->GetProjectionMatrix() * glm::inverse(m_CameraTransform->GetWorldMatrix());
 
         auto cameraPos = m_CameraTransform->GetWorldPosition();
-        m_ParticleData.m_DescriptorSet[0][0]->SetUniform("UBO", "projView", &projView);
+        m_ParticleData.m_DescriptorSet[0][0]->SetUniform(m_ParticleData.m_ProjViewHandle, &projView);
         m_ParticleData.m_DescriptorSet[0][0]->Update();
 
         for(auto& emitterEntity : emitterGroup)
@@ -4657,27 +5340,16 @@ namespace Lumos::Graphics
 
     void RenderPasses::ParticleBeginBatch()
     {
-        uint32_t currentFrame = Renderer::GetMainSwapChain()->GetCurrentBufferIndex();
-
         m_ParticleData.m_IndexCount   = 0;
         m_ParticleData.m_TextureCount = 0;
 
-        while((int)m_ParticleData.m_VertexBuffers[currentFrame].size() - 1 < (int)m_ParticleData.m_BatchDrawCallIndex)
-        {
-            auto& vertexBuffer = m_ParticleData.m_VertexBuffers[currentFrame].emplace_back(Graphics::VertexBuffer::Create(BufferUsage::DYNAMIC));
-            vertexBuffer->Resize(m_ParticleData.m_Limits.BufferSize);
-
-            m_ParticleBufferBase[currentFrame].emplace_back(new VertexData[m_ParticleData.m_Limits.MaxQuads * 4]);
-        }
-
-        m_ParticleData.m_VertexBuffers[currentFrame][m_ParticleData.m_BatchDrawCallIndex]->Bind(Renderer::GetMainSwapChain()->GetCurrentCommandBuffer(), m_ParticleData.m_Pipeline.get());
-        m_ParticleData.m_Buffer = m_ParticleBufferBase[currentFrame][m_ParticleData.m_BatchDrawCallIndex];
+        m_ParticleData.m_Allocation = m_TransientBuffer->Allocate(m_ParticleData.m_Limits.BufferSize);
+        m_ParticleData.m_Buffer     = (VertexData*)m_ParticleData.m_Allocation.Data;
     }
 
     void RenderPasses::ParticleFlush()
     {
         LUMOS_PROFILE_FUNCTION();
-        uint32_t currentFrame = Renderer::GetMainSwapChain()->GetCurrentBufferIndex();
         for(int i = m_ParticleData.m_TextureCount; i < 16; i++)
         {
             m_ParticleData.m_Textures[i] = Material::GetDefaultTexture();
@@ -4713,8 +5385,8 @@ namespace Lumos::Graphics
         Graphics::CommandBuffer* commandBuffer = Renderer::GetMainSwapChain()->GetCurrentCommandBuffer();
 
         commandBuffer->UnBindPipeline();
-        uint32_t dataSize = (uint32_t)((uint8_t*)m_ParticleData.m_Buffer - (uint8_t*)m_ParticleBufferBase[currentFrame][m_ParticleData.m_BatchDrawCallIndex]);
-        m_ParticleData.m_VertexBuffers[currentFrame][m_ParticleData.m_BatchDrawCallIndex]->SetData(dataSize, (void*)m_ParticleBufferBase[currentFrame][m_ParticleData.m_BatchDrawCallIndex], true);
+        uint32_t dataSize = (uint32_t)((uint8_t*)m_ParticleData.m_Buffer - m_ParticleData.m_Allocation.Data);
+        m_TransientBuffer->Shrink(m_ParticleData.m_Allocation, dataSize);
         commandBuffer->BindPipeline(m_ParticleData.m_Pipeline);
 
         Arena* frameArena                  = Application::Get().GetFrameArena();
@@ -4723,13 +5395,13 @@ namespace Lumos::Graphics
         currentDescriptors[0] = m_ParticleData.m_DescriptorSet[0][0].get();
         currentDescriptors[1] = m_ParticleData.m_DescriptorSet[m_ParticleData.m_BatchDrawCallIndex][1].get();
 
+        m_TransientBuffer->BindVertexBuffer(commandBuffer, m_ParticleData.m_Pipeline.get(), m_ParticleData.m_Allocation);
         m_ParticleData.m_IndexBuffer->SetCount(m_ParticleData.m_IndexCount);
         m_ParticleData.m_IndexBuffer->Bind(commandBuffer);
 
         Renderer::BindDescriptorSets(m_ParticleData.m_Pipeline.get(), commandBuffer, 0, currentDescriptors, 2);
         Renderer::DrawIndexed(commandBuffer, DrawType::TRIANGLE, m_ParticleData.m_IndexCount);
 
-        m_ParticleData.m_VertexBuffers[currentFrame][m_ParticleData.m_BatchDrawCallIndex]->Unbind();
         m_ParticleData.m_IndexBuffer->Unbind();
 
         m_ParticleData.m_BatchDrawCallIndex++;
@@ -1,6 +1,10 @@
 #pragma once
 #include "Graphics/Renderers/IRenderer.h"
 #include "Graphics/Renderable2D.h"
+#include "Graphics/RHI/TransientBuffer.h"
+#include "Graphics/Renderers/LightClusters.h"
+#include "Graphics/Renderers/OcclusionCuller.h"
+#include <entt/entity/fwd.hpp>
 
 #define MAX_BOUND_TEXTURES 16
 
@@ -28,6 +32,7 @@ namespace Lumos
         class SkyboxRenderer;
         class CommandBuffer;
         class Model;
+        class AnimationController;
         struct Light;
 
         struct LineVertexData
@@ -58,9 +63,12 @@ namespace Lumos
         {
             uint32_t UpdatesPerSecond;
             uint32_t FramesPerSecond;
-            uint32_t NumRenderedObjects = 0;
-            uint32_t NumShadowObjects   = 0;
-            uint32_t NumDrawCalls       = 0;
+            uint32_t NumRenderedObjects      = 0;
+            uint32_t NumShadowObjects        = 0;
+            uint32_t NumDrawCalls            = 0;
+            uint32_t NumClusteredLights      = 0;
+            uint32_t NumDroppedClusterLights = 0;
+            uint32_t NumOccludedObjects      = 0;
         };
 
         class RenderPasses
@@ -104,7 +112,9 @@ namespace Lumos
             void ParticlePass();
             void ParticleFlush();
             void DebugPass();
+            void DebugLineBeginBatch();
             void DebugLineFlush(Graphics::Pipeline* pipeline);
+            void DebugPointBeginBatch();
             void DebugPointFlush(Graphics::Pipeline* pipeline);
             void FinalPass();
             void TextPass();
@@ -124,6 +134,24 @@ namespace Lumos
             float SubmitTexture(Texture* texture);
             float SubmitParticleTexture(Texture* texture);
             void UpdateCascades(Scene* scene, Light* light);
+            uint32_t WriteBonePalette(AnimationController* controller);
+            void BatchInstances(CommandQueue& commandQueue, const SharedPtr<Shader>& instancedShader);
+
+            // Push constant members written per draw, resolved for each pipeline's shader before a queue is recorded
+            struct MeshPushConstants
+            {
+                PushConstantHandle Transform;
+                PushConstantHandle PositionMin;
+                PushConstantHandle PositionExtent;
+            };
+
+            // Records one command, may be called from job system workers so must only read shared state
+            typedef std::function<void(CommandBuffer* commandBuffer, const RenderCommand& command, Pipeline* pipeline, const MeshPushConstants& pushConstants)> RecordCommandFunc;
+
+            // Records a queue into commandBuffer, splitting it across secondary command buffers when supported.
+            // pipelines overrides each command's pipeline when set, a null entry skips that command
+            void RecordCommandQueue(CommandBuffer* commandBuffer, const CommandQueue& commandQueue, Pipeline** pipelines, uint32_t layer, const RecordCommandFunc& record);
+            CommandBuffer* GetSecondaryCommandBuffer();
 
             bool m_DebugRenderEnabled = false;
 
@@ -172,13 +200,42 @@ namespace Lumos
                 glm::vec4 m_SplitDepth[SHADOWMAP_MAX];
                 glm::mat4 m_LightMatrix;
                 std::vector<SharedPtr<Graphics::DescriptorSet>> m_DescriptorSet;
+                UniformHandle m_DirLightMatricesHandle[2];
 
                 SharedPtr<Shader> m_Shader          = nullptr;
                 SharedPtr<Shader> m_ShaderAlpha     = nullptr;
                 SharedPtr<Shader> m_ShaderAnim      = nullptr;
                 SharedPtr<Shader> m_ShaderAnimAlpha = nullptr;
 
+                SharedPtr<Shader> m_ShaderCompact          = nullptr;
+                SharedPtr<Shader> m_ShaderAlphaCompact     = nullptr;
+                SharedPtr<Shader> m_ShaderAnimCompact      = nullptr;
+                SharedPtr<Shader> m_ShaderAnimAlphaCompact = nullptr;
+
+                SharedPtr<Shader> m_ShaderInstanced = nullptr;
+
                 Maths::Frustum m_CascadeFrustums[SHADOWMAP_MAX];
+
+                // Static caster depth is kept per cascade in m_StaticShadowTex and copied into
+                // m_ShadowTex before dynamic casters are drawn on top
+                struct CasterState
+                {
+                    glm::mat4 Transform;
+                    uint32_t StillFrames   = 0;
+                    uint64_t LastSeenFrame = 0;
+                };
+
+                bool m_CacheStaticCasters            = true;
+                bool m_UseStaticCache                = false;
+                TextureDepthArray* m_StaticShadowTex = nullptr;
+                CommandQueue m_StaticCascadeCommandQueue[SHADOWMAP_MAX];
+                uint64_t m_StaticCascadeHash[SHADOWMAP_MAX] = {};
+                uint64_t m_CachedCascadeHash[SHADOWMAP_MAX] = {};
+                glm::mat4 m_CachedShadowProjView[SHADOWMAP_MAX];
+                bool m_StaticCascadeDirty[SHADOWMAP_MAX]      = {};
+                bool m_LiveCascadeMatchesCache[SHADOWMAP_MAX] = {};
+                std::unordered_map<uint32_t, CasterState> m_CasterStates;
+                uint64_t m_CasterFrame = 0;
             };
 
             struct ForwardData
@@ -197,10 +254,46 @@ namespace Lumos
 
                 std::vector<SharedPtr<Graphics::DescriptorSet>> m_DescriptorSet;
 
-                SharedPtr<Shader> m_Shader     = nullptr;
-                SharedPtr<Shader> m_AnimShader = nullptr;
-                Texture* m_RenderTexture       = nullptr;
-                TextureDepth* m_DepthTexture   = nullptr;
+                // The scene set is recreated from the same layout when the environment changes, so these stay valid
+                struct SceneUniforms
+                {
+                    UniformHandle ProjView;
+                    UniformHandle Lights;
+                    UniformHandle CameraPosition;
+                    UniformHandle ViewMatrix;
+                    UniformHandle LightView;
+                    UniformHandle ShadowTransform;
+                    UniformHandle SplitDepths;
+                    UniformHandle BiasMatrix;
+                    UniformHandle LightSize;
+                    UniformHandle ShadowFade;
+                    UniformHandle CascadeFade;
+                    UniformHandle MaxShadowDist;
+                    UniformHandle InitialBias;
+                    UniformHandle Width;
+                    UniformHandle Height;
+                    UniformHandle ShadowEnabled;
+                    UniformHandle LightCount;
+                    UniformHandle ShadowCount;
+                    UniformHandle Mode;
+                    UniformHandle EnvMipCount;
+                    UniformHandle BoneTransforms;
+                    UniformHandle InstanceTransforms;
+                    UniformHandle ClusterLights;
+                    UniformHandle ClusterProjection;
+                    UniformHandle ClusterDimensions;
+                    UniformHandle ClusterRanges;
+                    UniformHandle ClusterIndices;
+                };
+                SceneUniforms m_Uniforms;
+
+                SharedPtr<Shader> m_Shader            = nullptr;
+                SharedPtr<Shader> m_AnimShader        = nullptr;
+                SharedPtr<Shader> m_CompactShader     = nullptr;
+                SharedPtr<Shader> m_AnimCompactShader = nullptr;
+                SharedPtr<Shader> m_InstancedShader   = nullptr;
+                Texture* m_RenderTexture              = nullptr;
+                TextureDepth* m_DepthTexture          = nullptr;
 
                 Maths::Frustum m_Frustum;
 
@@ -208,13 +301,50 @@ namespace Lumos
                 uint32_t m_CurrentBufferID = 0;
                 bool m_DepthTest           = false;
                 size_t m_DynamicAlignment;
-                glm::mat4* m_TransformData = nullptr;
+                uint32_t m_UniformAlignment = 16;
+                glm::mat4* m_TransformData  = nullptr;
+
+                // Skinning rows for every animated model this frame, window 0 is identity.
+                // Copied into the transient buffer once the command queues are built
+                std::vector<glm::vec4> m_BonePalette;
+                uint32_t m_BonePaletteStride = 0;
+                uint32_t m_BonePaletteOffset = 0;
+                bool m_BonePaletteFullLogged = false;
+
+                // Transforms of every merged draw this frame, written straight into a transient allocation.
+                // Each draw selects its window with a dynamic offset
+                SharedPtr<Graphics::DescriptorSet> m_InstanceDescriptorSet;
+                TransientAllocation m_InstanceAllocation;
+                glm::mat4* m_InstanceTransforms   = nullptr;
+                uint32_t m_InstanceTransformCount = 0;
+                uint32_t m_InstanceAlignment      = 1;
+                bool m_SupportInstancing          = false;
+
+                // Scratch used while merging a command queue, each command's batch leader, the leader's instance
+                // count and its next free slot, and the first command seen for each mesh/material/pipeline/LOD key
+                CommandQueue m_InstanceScratchQueue;
+                std::vector<uint32_t> m_InstanceBatchLeaders;
+                std::vector<uint32_t> m_InstanceBatchCounts;
+                std::vector<uint32_t> m_InstanceBatchCursors;
+                std::unordered_map<uint64_t, uint32_t> m_InstanceBatchLookup;
+
+                // Point and spot lights binned into a froxel grid, directional lights stay in the scene buffer
+                LightClusters m_LightClusters;
+                std::vector<Light> m_ClusterLights;
+                bool m_ClusteredLighting = false;
+
+                // Entities the scene BVH found inside the camera or a shadow cascade this frame
+                std::vector<entt::entity> m_VisibleEntities;
+
+                // Large opaque meshes rasterised on the CPU so draws hidden behind them can be skipped
+                OcclusionCuller m_OcclusionCuller;
+                bool m_OcclusionCulling = true;
             };
 
             struct Renderer2DData
             {
                 CommandQueue2D m_CommandQueue2D;
-                std::vector<std::vector<VertexBuffer*>> m_VertexBuffers;
+                TransientAllocation m_Allocation;
 
                 uint32_t m_BatchDrawCallIndex = 0;
                 uint32_t m_IndexCount         = 0;
@@ -241,18 +371,21 @@ namespace Lumos
                 SharedPtr<Pipeline> m_Pipeline = nullptr;
 
                 std::vector<std::vector<SharedPtr<Graphics::DescriptorSet>>> m_DescriptorSet;
+                UniformHandle m_ProjViewHandle;
             };
 
             struct DebugDrawData
             {
-                std::vector<std::vector<Graphics::VertexBuffer*>> m_LineVertexBuffers;
+                TransientAllocation m_LineAllocation;
                 Graphics::IndexBuffer* m_LineIndexBuffer;
 
                 Graphics::IndexBuffer* m_PointIndexBuffer = nullptr;
-                std::vector<std::vector<Graphics::VertexBuffer*>> m_PointVertexBuffers;
+                TransientAllocation m_PointAllocation;
 
                 std::vector<SharedPtr<Graphics::DescriptorSet>> m_LineDescriptorSet;
                 std::vector<SharedPtr<Graphics::DescriptorSet>> m_PointDescriptorSet;
+                UniformHandle m_LineProjViewHandle;
+                UniformHandle m_PointProjViewHandle;
 
                 LineVertexData* m_LineBuffer   = nullptr;
                 PointVertexData* m_PointBuffer = nullptr;
@@ -283,6 +416,9 @@ namespace Lumos
             void Init2DRenderData();
             bool m_2DRenderDataInitialised = false;
 
+            // Resolves the uniform handles written every frame, so updates skip the name lookups
+            void ResolveUniformHandles();
+
             Texture2D* m_MainTexture         = nullptr;
             Texture2D* m_ResolveTexture      = nullptr;
             Texture2D* m_LastRenderTarget    = nullptr;
@@ -303,16 +439,9 @@ namespace Lumos
             Renderer2DData m_DebugTextRendererData;
             Renderer2DData m_ParticleData;
 
-            TextVertexData* TextVertexBufferPtr = nullptr;
-
-            // Vertex data per frame in flight, per batch
-            std::vector<std::vector<VertexData*>> m_ParticleBufferBase;
-            std::vector<std::vector<VertexData*>> m_2DBufferBase;
-            std::vector<std::vector<LineVertexData*>> m_LineBufferBase;
-            std::vector<std::vector<PointVertexData*>> m_PointBufferBase;
-            std::vector<std::vector<VertexData*>> m_QuadBufferBase;
-            std::vector<TextVertexData*> TextVertexBufferBase;
-            std::vector<TextVertexData*> DebugTextVertexBufferBase;
+            // Batched vertex data is written straight into per-frame transient memory
+            UniquePtr<TransientBuffer> m_TransientBuffer;
+            TextVertexData* TextVertexBufferPtr      = nullptr;
             TextVertexData* DebugTextVertexBufferPtr = nullptr;
 
             glm::vec4 m_ClearColour;
@@ -332,6 +461,14 @@ namespace Lumos
             Texture* m_DefaultTextureCube;
             SharedPtr<Graphics::Shader> m_SkyboxShader;
             SharedPtr<Graphics::DescriptorSet> m_SkyboxDescriptorSet;
+            struct SkyboxUniforms
+            {
+                UniformHandle InvProjection;
+                UniformHandle InvView;
+                UniformHandle Mode;
+                UniformHandle Exposure;
+                UniformHandle BlurLevel;
+            } m_SkyboxUniforms;
 
             SharedPtr<Graphics::Shader> m_FinalPassShader;
             SharedPtr<Graphics::DescriptorSet> m_FinalPassDescriptorSet;
@@ -353,6 +490,11 @@ namespace Lumos
 
             SharedPtr<Graphics::DescriptorSet> m_ChromaticAberationPassDescriptorSet;
             SharedPtr<Graphics::Shader> m_ChromaticAberationShader;
+            struct ChromaticAberationUniforms
+            {
+                UniformHandle Intensity;
+                UniformHandle CameraAperture;
+            } m_ChromaticAberationUniforms;
 
             SharedPtr<Graphics::DescriptorSet> m_DepthPrePassDescriptorSet;
             SharedPtr<Graphics::DescriptorSet> m_DepthPrePassAlphaDescriptorSet;
@@ -361,6 +503,24 @@ namespace Lumos
             SharedPtr<Graphics::Shader> m_DepthPrePassAlphaShader;
             SharedPtr<Graphics::Shader> m_DepthPrePassAnimShader;
             SharedPtr<Graphics::Shader> m_DepthPrePassAlphaAnimShader;
+            SharedPtr<Graphics::Shader> m_DepthPrePassCompactShader;
+            SharedPtr<Graphics::Shader> m_DepthPrePassAlphaCompactShader;
+            SharedPtr<Graphics::Shader> m_DepthPrePassAnimCompactShader;
+            SharedPtr<Graphics::Shader> m_DepthPrePassAlphaAnimCompactShader;
+            SharedPtr<Graphics::Shader> m_DepthPrePassInstancedShader;
+
+            // Set only when every compact vertex shader was created
+            bool m_SupportCompactVertices = false;
+
+            // Secondary command buffers handed out this frame, one list per frame in flight
+            bool m_MultithreadedRecording = false;
+            std::vector<std::vector<CommandBuffer*>> m_SecondaryCommandBuffers;
+            uint32_t m_SecondaryCommandBufferIndex = 0;
+
+            // Push constant members of each shader in the queue being recorded
+            std::vector<Shader*> m_ResolvedPushConstantShaders;
+            std::vector<MeshPushConstants> m_ResolvedPushConstants;
+
             Texture2D* m_SSAOTexture  = nullptr;
             Texture2D* m_SSAOTexture1 = nullptr;
 
@@ -369,13 +529,39 @@ namespace Lumos
 
             SharedPtr<Graphics::Shader> m_SSAOShader;
             SharedPtr<Graphics::DescriptorSet> m_SSAOPassDescriptorSet;
-
+            struct SSAOUniforms
+            {
+                UniformHandle InvProj;
+                UniformHandle Projection;
+                UniformHandle View;
+                UniformHandle Samples;
+                UniformHandle Radius;
+                UniformHandle Near;
+                UniformHandle Far;
+                UniformHandle Strength;
+            } m_SSAOUniforms;
+
+            // Both blur sets share the blur shader layout
             SharedPtr<Graphics::Shader> m_SSAOBlurShader;
             SharedPtr<Graphics::DescriptorSet> m_SSAOBlurPassDescriptorSet;
             SharedPtr<Graphics::DescriptorSet> m_SSAOBlurPassDescriptorSet2;
+            struct SSAOBlurUniforms
+            {
+                UniformHandle View;
+                UniformHandle TexelOffset;
+                UniformHandle BlurRadius;
+            } m_SSAOBlurUniforms;
 
             SharedPtr<Graphics::Shader> m_ToneMappingPassShader;
             SharedPtr<Graphics::DescriptorSet> m_ToneMappingPassDescriptorSet;
+            struct ToneMappingUniforms
+            {
+                UniformHandle BloomIntensity;
+                UniformHandle ToneMapIndex;
+                UniformHandle Brightness;
+                UniformHandle Contrast;
+                UniformHandle Saturation;
+            } m_ToneMappingUniforms;
 
             SharedPtr<Graphics::DescriptorSet> m_FilmicGrainPassDescriptorSet;
             SharedPtr<Graphics::Shader> m_FilmicGrainShader;
@@ -385,6 +571,11 @@ namespace Lumos
 
             SharedPtr<Graphics::DescriptorSet> m_DepthOfFieldPassDescriptorSet;
             SharedPtr<Graphics::Shader> m_DepthOfFieldShader;
+            struct DepthOfFieldUniforms
+            {
+                UniformHandle DOFParams;
+                UniformHandle DepthConsts;
+            } m_DepthOfFieldUniforms;
 
             SharedPtr<Graphics::DescriptorSet> m_SharpenPassDescriptorSet;
             SharedPtr<Graphics::Shader> m_SharpenShader;
@@ -403,7 +594,8 @@ namespace Lumos
 
             SceneRenderSettings* m_OverrideSceneRenderSettings = nullptr; // For editor viewport
 
-            void TextFlush(Renderer2DData& textRenderData, std::vector<TextVertexData*>& textVertexBufferBase, TextVertexData*& textVertexBufferPtr);
+            void TextBeginBatch(Renderer2DData& textRenderData, TextVertexData*& textVertexBufferPtr);
+            void TextFlush(Renderer2DData& textRenderData, TextVertexData*& textVertexBufferPtr);
         };
     }
 }
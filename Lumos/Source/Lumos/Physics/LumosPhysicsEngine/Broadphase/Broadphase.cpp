@@ -0,0 +1,44 @@
+#include "Precompiled.h"
+#include "Broadphase.h"
+
+namespace Lumos
+{
+    bool Broadphase::Overlaps(const Maths::BoundingBox& a, const Maths::BoundingBox& b)
+    {
+        return glm::all(glm::lessThanEqual(a.m_Min, b.m_Max)) && glm::all(glm::lessThanEqual(b.m_Min, a.m_Max));
+    }
+
+    // Slab test against the box grown by radius, a conservative bound for swept spheres
+    bool Broadphase::SegmentOverlaps(const Maths::BoundingBox& box, const glm::vec3& origin, const glm::vec3& invDirection, float length, float radius)
+    {
+        const glm::vec3 t0   = (box.m_Min - glm::vec3(radius) - origin) * invDirection;
+        const glm::vec3 t1   = (box.m_Max + glm::vec3(radius) - origin) * invDirection;
+        const glm::vec3 tMin = glm::min(t0, t1);
+        const glm::vec3 tMax = glm::max(t0, t1);
+
+        const float entry = Maths::Max(Maths::Max(tMin.x, tMin.y), Maths::Max(tMin.z, 0.0f));
+        const float exit  = Maths::Min(Maths::Min(tMax.x, tMax.y), Maths::Min(tMax.z, length));
+        return entry <= exit;
+    }
+
+    void Broadphase::QueryAABB(const Maths::BoundingBox& box, std::vector<RigidBody3D*>& bodies) const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        for(RigidBody3D* current = m_QueryRoot; current; current = current->m_Next)
+        {
+            if(current->GetCollisionShape() && Overlaps(current->GetWorldSpaceAABB(), box))
+                bodies.push_back(current);
+        }
+    }
+
+    void Broadphase::QuerySegment(const glm::vec3& origin, const glm::vec3& direction, float length, float radius, std::vector<RigidBody3D*>& bodies) const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        const glm::vec3 invDirection = 1.0f / direction;
+        for(RigidBody3D* current = m_QueryRoot; current; current = current->m_Next)
+        {
+            if(current->GetCollisionShape() && SegmentOverlaps(current->GetWorldSpaceAABB(), origin, invDirection, length, radius))
+                bodies.push_back(current);
+        }
+    }
+}
@@ -18,5 +18,19 @@ namespace Lumos
         virtual ~Broadphase()                                                                                                                  = default;
         virtual void FindPotentialCollisionPairs(RigidBody3D* rootObject, Vector<CollisionPair>& collisionPairs, uint32_t totalRigidBodyCount) = 0;
         virtual void DebugDraw()                                                                                                               = 0;
+
+        // Scene queries see the bodies as they were when the structure was last built.
+        // The default keeps no structure and tests every body
+        virtual void BuildQueryStructure(RigidBody3D* rootObject, uint32_t totalRigidBodyCount) { m_QueryRoot = rootObject; }
+        virtual void QueryAABB(const Maths::BoundingBox& box, std::vector<RigidBody3D*>& bodies) const;
+
+        // Bodies whose bounds, grown by radius, touch the segment. Direction is normalised
+        virtual void QuerySegment(const glm::vec3& origin, const glm::vec3& direction, float length, float radius, std::vector<RigidBody3D*>& bodies) const;
+
+    protected:
+        static bool Overlaps(const Maths::BoundingBox& a, const Maths::BoundingBox& b);
+        static bool SegmentOverlaps(const Maths::BoundingBox& box, const glm::vec3& origin, const glm::vec3& invDirection, float length, float radius);
+
+        RigidBody3D* m_QueryRoot = nullptr;
     };
 }
@@ -2,6 +2,7 @@
 
 #include "Maths/Maths.h"
 #include "OctreeBroadphase.h"
+#include "Physics/LumosPhysicsEngine/LumosPhysicsEngine.h"
 #include "Graphics/Renderers/DebugRenderer.h"
 
 #include "Core/DataStructures/Set.h"
@@ -10,6 +11,12 @@
 namespace Lumos
 {
 
+    // Continuous collision bodies are placed by the bounds of their whole step so pairs along their path are found
+    static Maths::BoundingBox BroadphaseBounds(RigidBody3D* body)
+    {
+        return body->GetSweptAABB(LumosPhysicsEngine::GetDeltaTime());
+    }
+
     OctreeBroadphase::OctreeBroadphase(const u32 maxObjectsPerPartition, const u32 maxPartitionDepth)
         : m_MaxObjectsPerPartition(maxObjectsPerPartition)
         , m_MaxPartitionDepth(maxPartitionDepth)
@@ -24,8 +31,7 @@ namespace Lumos
         ArenaRelease(m_Arena);
     }
 
-    void OctreeBroadphase::FindPotentialCollisionPairs(RigidBody3D* rootObject,
-                                                       Vector<CollisionPair>& collisionPairs, uint32_t totalRigidBodyCount)
+    void OctreeBroadphase::BuildTree(RigidBody3D* rootObject, uint32_t totalRigidBodyCount)
     {
         LUMOS_PROFILE_FUNCTION();
         ArenaClear(m_Arena);
@@ -44,7 +50,7 @@ namespace Lumos
             if(current->GetCollisionShape())
             {
                 LUMOS_PROFILE_SCOPE_LOW("Merge Bounding box and add Physics Object");
-                m_RootNode.boundingBox.Merge(current->GetWorldSpaceAABB());
+                m_RootNode.boundingBox.Merge(BroadphaseBounds(current));
                 m_RootNode.PhysicsObjects[m_RootNode.PhysicsObjectCount] = current;
                 m_RootNode.PhysicsObjectCount++;
             }
@@ -56,6 +62,13 @@ namespace Lumos
 
         // Recursively divide world
         Divide(m_RootNode, 0);
+    }
+
+    void OctreeBroadphase::FindPotentialCollisionPairs(RigidBody3D* rootObject,
+                                                       Vector<CollisionPair>& collisionPairs, uint32_t totalRigidBodyCount)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        BuildTree(rootObject, totalRigidBodyCount);
 
         HashSet(size_t) collisionPairHashSet = { 0 };
         collisionPairHashSet.arena           = m_Arena;
@@ -86,7 +99,7 @@ namespace Lumos
                     if(obj1.GetIsAtRest() && obj2.GetIsAtRest())
                         continue;
 
-                    if(!obj1.GetWorldSpaceAABB().IsInsideFast(obj2.GetWorldSpaceAABB()))
+                    if(!BroadphaseBounds(&obj1).IsInsideFast(BroadphaseBounds(&obj2)))
                         continue;
 
                     CollisionPair pair;
@@ -129,6 +142,63 @@ namespace Lumos
         }
     }
 
+    void OctreeBroadphase::BuildQueryStructure(RigidBody3D* rootObject, uint32_t totalRigidBodyCount)
+    {
+        m_QueryRoot = rootObject;
+        BuildTree(rootObject, totalRigidBodyCount);
+    }
+
+    void OctreeBroadphase::QueryAABB(const Maths::BoundingBox& box, std::vector<RigidBody3D*>& bodies) const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        const size_t first = bodies.size();
+        QueryNode(
+            m_RootNode, [&box](const Maths::BoundingBox& bounds)
+            { return Overlaps(bounds, box); },
+            bodies);
+        RemoveDuplicates(bodies, first);
+    }
+
+    void OctreeBroadphase::QuerySegment(const glm::vec3& origin, const glm::vec3& direction, float length, float radius, std::vector<RigidBody3D*>& bodies) const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        const glm::vec3 invDirection = 1.0f / direction;
+        const size_t first           = bodies.size();
+        QueryNode(
+            m_RootNode, [&](const Maths::BoundingBox& bounds)
+            { return SegmentOverlaps(bounds, origin, invDirection, length, radius); },
+            bodies);
+        RemoveDuplicates(bodies, first);
+    }
+
+    template <typename OverlapFunc>
+    void OctreeBroadphase::QueryNode(const OctreeNode& node, const OverlapFunc& overlaps, std::vector<RigidBody3D*>& bodies) const
+    {
+        if(!overlaps(node.boundingBox))
+            return;
+
+        // Every object is kept by each leaf it touches, so parents can be skipped
+        if(node.ChildCount > 0)
+        {
+            for(uint32_t i = 0; i < node.ChildCount; i++)
+                QueryNode(node.Children[i], overlaps, bodies);
+            return;
+        }
+
+        for(uint32_t i = 0; i < node.PhysicsObjectCount; i++)
+        {
+            RigidBody3D* physicsObject = node.PhysicsObjects[i];
+            if(physicsObject && overlaps(physicsObject->GetWorldSpaceAABB()))
+                bodies.push_back(physicsObject);
+        }
+    }
+
+    void OctreeBroadphase::RemoveDuplicates(std::vector<RigidBody3D*>& bodies, size_t first)
+    {
+        std::sort(bodies.begin() + first, bodies.end());
+        bodies.erase(std::unique(bodies.begin() + first, bodies.end()), bodies.end());
+    }
+
     void OctreeBroadphase::DebugDraw()
     {
         DebugDrawOctreeNode(m_RootNode);
@@ -196,8 +266,8 @@ namespace Lumos
                 if(!physicsObject || !physicsObject->GetCollisionShape())
                     continue;
 
-                const Maths::BoundingBox& boundingBox = physicsObject->GetWorldSpaceAABB();
-                Intersection intersection             = chileNode.boundingBox.IsInside(boundingBox);
+                const Maths::BoundingBox boundingBox = BroadphaseBounds(physicsObject);
+                Intersection intersection            = chileNode.boundingBox.IsInside(boundingBox);
                 if(intersection != OUTSIDE)
                 {
                     chileNode.PhysicsObjects[chileNode.PhysicsObjectCount] = physicsObject;
@@ -42,10 +42,21 @@ namespace Lumos
 
         void FindPotentialCollisionPairs(RigidBody3D* rootObject, Vector<CollisionPair>& collisionPairs, uint32_t totalRigidBodyCount) override;
         void DebugDraw() override;
+
+        void BuildQueryStructure(RigidBody3D* rootObject, uint32_t totalRigidBodyCount) override;
+        void QueryAABB(const Maths::BoundingBox& box, std::vector<RigidBody3D*>& bodies) const override;
+        void QuerySegment(const glm::vec3& origin, const glm::vec3& direction, float length, float radius, std::vector<RigidBody3D*>& bodies) const override;
+
         void Divide(OctreeNode& node, size_t iteration);
         void DebugDrawOctreeNode(const OctreeNode& node);
 
     private:
+        void BuildTree(RigidBody3D* rootObject, uint32_t totalRigidBodyCount);
+
+        template <typename OverlapFunc>
+        void QueryNode(const OctreeNode& node, const OverlapFunc& overlaps, std::vector<RigidBody3D*>& bodies) const;
+        static void RemoveDuplicates(std::vector<RigidBody3D*>& bodies, size_t first);
+
         u32 m_MaxObjectsPerPartition;
         u32 m_MaxPartitionDepth;
         u32 m_MinPartitionSize;
@@ -14,8 +14,8 @@ namespace Lumos
         // Collision Shape Functionality
         virtual glm::mat3 BuildInverseInertia(float invMass) const override;
 
-        virtual std::vector<glm::vec3>& GetCollisionAxes(const RigidBody3D* currentObject) override;
-        virtual std::vector<CollisionEdge>& GetEdges(const RigidBody3D* currentObject) override;
+        virtual void GetCollisionAxes(const RigidBody3D* currentObject, Vector<glm::vec3>& axes) const override;
+        virtual void GetEdges(const RigidBody3D* currentObject, Vector<CollisionEdge>& edges) const override;
 
         virtual void GetMinMaxVertexOnAxis(const RigidBody3D* currentObject, const glm::vec3& axis, glm::vec3* out_min, glm::vec3* out_max) const override;
         virtual void GetIncidentReferencePolygon(const RigidBody3D* currentObject, const glm::vec3& axis, ReferencePolygon& refPolygon) const override;
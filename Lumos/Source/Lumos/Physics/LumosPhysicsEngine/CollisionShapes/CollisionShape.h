@@ -2,6 +2,7 @@
 
 #include "Maths/Maths.h"
 #include "Maths/Plane.h"
+#include "Core/DataStructures/Vector.h"
 #include <vector>
 #include <glm/ext/vector_float3.hpp>
 #include <glm/ext/matrix_float4x4.hpp>
@@ -62,14 +63,17 @@ namespace Lumos
         virtual void DebugDraw(const RigidBody3D* currentObject) const = 0;
 
         //<----- USED BY COLLISION DETECTION ----->
+        // These only read the shape and the body's cached transform and write to caller owned storage,
+        // so narrowphase can query the same shape from several threads at once
+
         // Get all possible collision axes
-        //	- This is a list of all the face normals ignoring any duplicates and parallel vectors.
-        virtual std::vector<glm::vec3>& GetCollisionAxes(const RigidBody3D* currentObject) = 0;
+        //	- Appends all the face normals ignoring any duplicates and parallel vectors.
+        virtual void GetCollisionAxes(const RigidBody3D* currentObject, Vector<glm::vec3>& axes) const = 0;
 
         // Get all shape Edges
-        //	- Returns a list of all edges AB that form the convex hull of the collision shape. These are
+        //	- Appends all edges AB that form the convex hull of the collision shape. These are
         //    used to check edge/edge collisions aswell as finding the closest point to a sphere. */
-        virtual std::vector<CollisionEdge>& GetEdges(const RigidBody3D* currentObject) = 0;
+        virtual void GetEdges(const RigidBody3D* currentObject, Vector<CollisionEdge>& edges) const = 0;
 
         // Get the min/max vertices along a given axis
         virtual void GetMinMaxVertexOnAxis(
@@ -113,7 +117,5 @@ namespace Lumos
     protected:
         CollisionShapeType m_Type;
         glm::mat4 m_LocalTransform;
-        std::vector<CollisionEdge> m_Edges;
-        std::vector<glm::vec3> m_Axes;
     };
 }
@@ -13,8 +13,6 @@ namespace Lumos
         m_CubeHull             = CreateSharedPtr<BoundingBoxHull>();
         m_CubeHull->Set(-m_CuboidHalfDimensions, m_CuboidHalfDimensions);
         m_CubeHull->UpdateHull();
-        m_Axes.resize(3);
-        m_Edges.resize(m_CubeHull->GetNumEdges());
     }
 
     CuboidCollisionShape::CuboidCollisionShape(const glm::vec3& halfdims)
@@ -26,9 +24,6 @@ namespace Lumos
         m_CubeHull = CreateSharedPtr<BoundingBoxHull>();
         m_CubeHull->Set(-m_CuboidHalfDimensions, m_CuboidHalfDimensions);
         m_CubeHull->UpdateHull();
-
-        m_Axes.resize(3);
-        m_Edges.resize(m_CubeHull->GetNumEdges());
     }
 
     CuboidCollisionShape::~CuboidCollisionShape()
@@ -51,36 +46,27 @@ namespace Lumos
         return inertia;
     }
 
-    std::vector<glm::vec3>& CuboidCollisionShape::GetCollisionAxes(const RigidBody3D* currentObject)
+    void CuboidCollisionShape::GetCollisionAxes(const RigidBody3D* currentObject, Vector<glm::vec3>& axes) const
     {
         LUMOS_PROFILE_FUNCTION_LOW();
-        {
-            m_Axes.resize(3);
-
-            glm::mat3 objOrientation = glm::toMat3(currentObject->GetOrientation());   //.RotationMatrix();
-            m_Axes[0]                = (objOrientation * glm::vec3(1.0f, 0.0f, 0.0f)); // X - Axis
-            m_Axes[1]                = (objOrientation * glm::vec3(0.0f, 1.0f, 0.0f)); // Y - Axis
-            m_Axes[2]                = (objOrientation * glm::vec3(0.0f, 0.0f, 1.0f)); // Z - Axis
-        }
-
-        return m_Axes;
+        glm::mat3 objOrientation = glm::toMat3(currentObject->GetOrientation());
+        axes.PushBack(objOrientation * glm::vec3(1.0f, 0.0f, 0.0f)); // X - Axis
+        axes.PushBack(objOrientation * glm::vec3(0.0f, 1.0f, 0.0f)); // Y - Axis
+        axes.PushBack(objOrientation * glm::vec3(0.0f, 0.0f, 1.0f)); // Z - Axis
     }
 
-    std::vector<CollisionEdge>& CuboidCollisionShape::GetEdges(const RigidBody3D* currentObject)
+    void CuboidCollisionShape::GetEdges(const RigidBody3D* currentObject, Vector<CollisionEdge>& edges) const
     {
         LUMOS_PROFILE_FUNCTION_LOW();
+        glm::mat4 transform = currentObject->GetWorldSpaceTransform() * m_LocalTransform;
+        for(unsigned int i = 0; i < m_CubeHull->GetNumEdges(); ++i)
         {
-            glm::mat4 transform = currentObject->GetWorldSpaceTransform() * m_LocalTransform;
-            for(unsigned int i = 0; i < m_CubeHull->GetNumEdges(); ++i)
-            {
-                const HullEdge& edge = m_CubeHull->GetEdge(i);
-                glm::vec3 A          = transform * glm::vec4(m_CubeHull->GetVertex(edge.vStart).pos, 1.0f);
-                glm::vec3 B          = transform * glm::vec4(m_CubeHull->GetVertex(edge.vEnd).pos, 1.0f);
+            const HullEdge& edge = m_CubeHull->GetEdge(i);
+            glm::vec3 A          = transform * glm::vec4(m_CubeHull->GetVertex(edge.vStart).pos, 1.0f);
+            glm::vec3 B          = transform * glm::vec4(m_CubeHull->GetVertex(edge.vEnd).pos, 1.0f);
 
-                m_Edges[i] = { A, B };
-            }
+            edges.EmplaceBack(A, B);
         }
-        return m_Edges;
     }
 
     void CuboidCollisionShape::GetMinMaxVertexOnAxis(const RigidBody3D* currentObject, const glm::vec3& axis, glm::vec3* out_min, glm::vec3* out_max) const
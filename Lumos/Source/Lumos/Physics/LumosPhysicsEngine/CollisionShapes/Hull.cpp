@@ -134,7 +134,7 @@ namespace Lumos
         }
     }
 
-    void Hull::GetMinMaxVerticesInAxis(const glm::vec3& local_axis, int* out_min_vert, int* out_max_vert)
+    void Hull::GetMinMaxVerticesInAxis(const glm::vec3& local_axis, int* out_min_vert, int* out_max_vert) const
     {
         LUMOS_PROFILE_FUNCTION_LOW();
         int minVertex = 0, maxVertex = 0;
@@ -48,15 +48,15 @@ namespace Lumos
 
         int FindEdge(int v0_idx, int v1_idx);
 
-        const HullVertex& GetVertex(int idx) { return m_Vertices[idx]; }
-        const HullEdge& GetEdge(int idx) { return m_Edges[idx]; }
-        const HullFace& GetFace(int idx) { return m_Faces[idx]; }
+        const HullVertex& GetVertex(int idx) const { return m_Vertices[idx]; }
+        const HullEdge& GetEdge(int idx) const { return m_Edges[idx]; }
+        const HullFace& GetFace(int idx) const { return m_Faces[idx]; }
 
         size_t GetNumVertices() const { return m_Vertices.size(); }
         size_t GetNumEdges() const { return m_Edges.size(); }
         size_t GetNumFaces() const { return m_Faces.size(); }
 
-        void GetMinMaxVerticesInAxis(const glm::vec3& local_axis, int* out_min_vert, int* out_max_vert);
+        void GetMinMaxVerticesInAxis(const glm::vec3& local_axis, int* out_min_vert, int* out_max_vert) const;
 
         void DebugDraw(const glm::mat4& transform);
 
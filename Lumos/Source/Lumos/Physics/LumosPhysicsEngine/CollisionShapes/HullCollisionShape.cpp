@@ -12,13 +12,11 @@ namespace Lumos
     {
         m_HalfDimensions = glm::vec3(1.0f);
         m_Type           = CollisionShapeType::CollisionHull;
-        m_Axes.resize(3);
 
         auto test = Lumos::SharedPtr<Lumos::Graphics::Mesh>(Lumos::Graphics::CreatePrimative(Lumos::Graphics::PrimitiveType::Cube));
         BuildFromMesh(test.get());
 
         m_LocalTransform = glm::scale(glm::mat4(1.0), m_HalfDimensions);
-        m_Edges.resize(m_Hull->GetNumEdges());
     }
 
     HullCollisionShape::~HullCollisionShape()
@@ -55,8 +53,6 @@ namespace Lumos
             int vertexIdx[] = { (int)indices[i], (int)indices[i + 1], (int)indices[i + 2] };
             m_Hull->AddFace(normal, 3, vertexIdx);
         }
-
-        m_Edges.resize(m_Hull->GetNumEdges());
     }
 
     // glm::mat3 HullCollisionShape::GetLocalInertiaTensor(float mass)
@@ -88,34 +84,27 @@ namespace Lumos
         return inertia;
     }
 
-    std::vector<glm::vec3>& HullCollisionShape::GetCollisionAxes(const RigidBody3D* currentObject)
+    void HullCollisionShape::GetCollisionAxes(const RigidBody3D* currentObject, Vector<glm::vec3>& axes) const
     {
         LUMOS_PROFILE_FUNCTION_LOW();
-        {
-            glm::mat3 objOrientation = glm::toMat3(currentObject->GetOrientation());
-            m_Axes[0]                = (objOrientation * glm::vec3(1.0f, 0.0f, 0.0f)); // X - Axis
-            m_Axes[1]                = (objOrientation * glm::vec3(0.0f, 1.0f, 0.0f)); // Y - Axis
-            m_Axes[2]                = (objOrientation * glm::vec3(0.0f, 0.0f, 1.0f)); // Z - Axis
-        }
-
-        return m_Axes;
+        glm::mat3 objOrientation = glm::toMat3(currentObject->GetOrientation());
+        axes.PushBack(objOrientation * glm::vec3(1.0f, 0.0f, 0.0f)); // X - Axis
+        axes.PushBack(objOrientation * glm::vec3(0.0f, 1.0f, 0.0f)); // Y - Axis
+        axes.PushBack(objOrientation * glm::vec3(0.0f, 0.0f, 1.0f)); // Z - Axis
     }
 
-    std::vector<CollisionEdge>& HullCollisionShape::GetEdges(const RigidBody3D* currentObject)
+    void HullCollisionShape::GetEdges(const RigidBody3D* currentObject, Vector<CollisionEdge>& edges) const
     {
         LUMOS_PROFILE_FUNCTION_LOW();
+        glm::mat4 transform = currentObject->GetWorldSpaceTransform() * m_LocalTransform;
+        for(unsigned int i = 0; i < m_Hull->GetNumEdges(); ++i)
         {
-            glm::mat4 transform = currentObject->GetWorldSpaceTransform() * m_LocalTransform;
-            for(unsigned int i = 0; i < m_Hull->GetNumEdges(); ++i)
-            {
-                const HullEdge& edge = m_Hull->GetEdge(i);
-                glm::vec3 A          = transform * glm::vec4(m_Hull->GetVertex(edge.vStart).pos, 1.0f);
-                glm::vec3 B          = transform * glm::vec4(m_Hull->GetVertex(edge.vEnd).pos, 1.0f);
+            const HullEdge& edge = m_Hull->GetEdge(i);
+            glm::vec3 A          = transform * glm::vec4(m_Hull->GetVertex(edge.vStart).pos, 1.0f);
+            glm::vec3 B          = transform * glm::vec4(m_Hull->GetVertex(edge.vEnd).pos, 1.0f);
 
-                m_Edges[i] = { A, B };
-            }
+            edges.EmplaceBack(A, B);
         }
-        return m_Edges;
     }
 
     void HullCollisionShape::GetMinMaxVertexOnAxis(const RigidBody3D* currentObject, const glm::vec3& axis, glm::vec3* out_min, glm::vec3* out_max) const
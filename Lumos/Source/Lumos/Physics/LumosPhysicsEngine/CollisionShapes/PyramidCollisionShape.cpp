@@ -17,9 +17,6 @@ namespace Lumos
         {
             ConstructPyramidHull();
         }
-
-        m_Axes.resize(5);
-        m_Edges.resize(m_PyramidHull->GetNumEdges());
     }
 
     PyramidCollisionShape::PyramidCollisionShape(const glm::vec3& halfdims)
@@ -48,9 +45,6 @@ namespace Lumos
         {
             ConstructPyramidHull();
         }
-
-        m_Axes.resize(5);
-        m_Edges.resize(m_PyramidHull->GetNumEdges());
     }
 
     PyramidCollisionShape::~PyramidCollisionShape()
@@ -72,38 +66,26 @@ namespace Lumos
         return inertia;
     }
 
-    std::vector<CollisionEdge>& PyramidCollisionShape::GetEdges(const RigidBody3D* currentObject)
+    void PyramidCollisionShape::GetEdges(const RigidBody3D* currentObject, Vector<CollisionEdge>& edges) const
     {
         LUMOS_PROFILE_FUNCTION_LOW();
+        glm::mat4 transform = currentObject->GetWorldSpaceTransform() * m_LocalTransform;
+        for(unsigned int i = 0; i < m_PyramidHull->GetNumEdges(); ++i)
         {
-            glm::mat4 transform = currentObject->GetWorldSpaceTransform() * m_LocalTransform;
-            for(unsigned int i = 0; i < m_PyramidHull->GetNumEdges(); ++i)
-            {
-                const HullEdge& edge = m_PyramidHull->GetEdge(i);
-                glm::vec3 A          = transform * glm::vec4(m_PyramidHull->GetVertex(edge.vStart).pos, 1.0f);
-                glm::vec3 B          = transform * glm::vec4(m_PyramidHull->GetVertex(edge.vEnd).pos, 1.0f);
+            const HullEdge& edge = m_PyramidHull->GetEdge(i);
+            glm::vec3 A          = transform * glm::vec4(m_PyramidHull->GetVertex(edge.vStart).pos, 1.0f);
+            glm::vec3 B          = transform * glm::vec4(m_PyramidHull->GetVertex(edge.vEnd).pos, 1.0f);
 
-                m_Edges[i] = { A, B };
-            }
+            edges.EmplaceBack(A, B);
         }
-        return m_Edges;
     }
 
-    std::vector<glm::vec3>& PyramidCollisionShape::GetCollisionAxes(const RigidBody3D* currentObject)
+    void PyramidCollisionShape::GetCollisionAxes(const RigidBody3D* currentObject, Vector<glm::vec3>& axes) const
     {
         LUMOS_PROFILE_FUNCTION_LOW();
-        {
-            m_Axes.clear();
-            m_Axes.resize(5);
-            const glm::mat3 objOrientation = glm::toMat3(currentObject->GetOrientation());
-            m_Axes[0]                      = (objOrientation * m_Normals[0]);
-            m_Axes[1]                      = (objOrientation * m_Normals[1]);
-            m_Axes[2]                      = (objOrientation * m_Normals[2]);
-            m_Axes[3]                      = (objOrientation * m_Normals[3]);
-            m_Axes[4]                      = (objOrientation * m_Normals[4]);
-        }
-
-        return m_Axes;
+        const glm::mat3 objOrientation = glm::toMat3(currentObject->GetOrientation());
+        for(uint32_t i = 0; i < 5; i++)
+            axes.PushBack(objOrientation * m_Normals[i]);
     }
 
     void PyramidCollisionShape::GetMinMaxVertexOnAxis(const RigidBody3D* currentObject, const glm::vec3& axis, glm::vec3* out_min, glm::vec3* out_max) const
@@ -40,17 +40,14 @@ namespace Lumos
         return inertia;
     }
 
-    std::vector<glm::vec3>& SphereCollisionShape::GetCollisionAxes(const RigidBody3D* currentObject)
+    void SphereCollisionShape::GetCollisionAxes(const RigidBody3D* currentObject, Vector<glm::vec3>& axes) const
     {
         /* There is infinite edges so handle seperately */
-        m_Axes.clear();
-        return m_Axes;
     }
 
-    std::vector<CollisionEdge>& SphereCollisionShape::GetEdges(const RigidBody3D* currentObject)
+    void SphereCollisionShape::GetEdges(const RigidBody3D* currentObject, Vector<CollisionEdge>& edges) const
     {
         /* There is infinite edges on a sphere so handle seperately */
-        return m_Edges;
     }
 
     void SphereCollisionShape::GetMinMaxVertexOnAxis(const RigidBody3D* currentObject, const glm::vec3& axis, glm::vec3* out_min, glm::vec3* out_max) const
@@ -2,6 +2,7 @@
 #include "LumosPhysicsEngine.h"
 #include "RigidBody3D.h"
 #include "Narrowphase/CollisionDetection.h"
+#include "Narrowphase/GJK.h"
 #include "Broadphase/BruteForceBroadphase.h"
 #include "Broadphase/OctreeBroadphase.h"
 #include "RigidBody3D.h"
@@ -28,6 +29,13 @@ namespace Lumos
 
     float LumosPhysicsEngine::s_UpdateTimestep = 1.0f / 60.0f;
 
+    // Below this the jobs cost more than casting on the calling thread
+    static const uint32_t MinRaycastsPerBatchJob = 64;
+    static const uint32_t RaycastsPerJob         = 16;
+
+    // Time of impact searches per continuous collision body each step
+    static const uint32_t MaxContinuousSubSteps = 4;
+
     LumosPhysicsEngine::LumosPhysicsEngine(const LumosPhysicsEngineConfig& config)
         : m_IsPaused(true)
         , m_UpdateAccum(0.0f)
@@ -66,6 +74,9 @@ namespace Lumos
     void LumosPhysicsEngine::OnUpdate(const TimeStep& timeStep, Scene* scene)
     {
         LUMOS_PROFILE_FUNCTION();
+        // Bodies may have been stepped or moved by hand since the last query
+        m_QueryStructureDirty = true;
+
         if(!m_IsPaused)
         {
             auto& registry    = scene->GetRegistry();
@@ -147,10 +158,20 @@ namespace Lumos
 
         // Solve collision constraints
         SolveConstraints();
+
+        m_SweptBodies.clear();
+        for(RigidBody3D* current = m_RootBody; current; current = current->m_Next)
+        {
+            if(current->m_ContinuousCollision && !current->m_Static && current->IsAwake() && current->GetCollisionShape())
+                m_SweptBodies.push_back({ current, current->m_Position });
+        }
+
         // Update movement
         for(uint32_t i = 0; i < m_PositionIterations; i++)
             UpdateRigidBodys();
 
+        SolveContinuousCollisions();
+
         RigidBody3D* current = m_RootBody;
         while(current)
         {
@@ -185,6 +206,7 @@ namespace Lumos
     RigidBody3D* LumosPhysicsEngine::CreateBody(const RigidBody3DProperties& properties)
     {
         m_RigidBodyCount++;
+        m_QueryStructureDirty = true;
 
         void* mem = m_Allocator->Allocate();
 
@@ -204,6 +226,7 @@ namespace Lumos
     void LumosPhysicsEngine::DestroyBody(RigidBody3D* body)
     {
         m_RigidBodyCount--;
+        m_QueryStructureDirty = true;
 
         // Remove world body list.
         if(body->m_Prev)
@@ -529,6 +552,95 @@ namespace Lumos
         }
     }
 
+    void LumosPhysicsEngine::SolveContinuousCollisions()
+    {
+        LUMOS_PROFILE_FUNCTION();
+        m_Stats.ContinuousHitCount = 0;
+
+        for(const SweptBody& swept : m_SweptBodies)
+        {
+            RigidBody3D* body = swept.Body;
+            glm::vec3 motion  = body->m_Position - swept.Start;
+            float distance    = glm::length(motion);
+
+            // Discrete detection already catches bodies moving less than half their size in a step
+            const glm::vec3 size = body->m_LocalBoundingBox.Size();
+            if(distance < Maths::Min(size.x, Maths::Min(size.y, size.z)) * 0.5f)
+                continue;
+
+            // The broadphase used the swept bounds, so anything on the path is already paired with the body
+            m_SweptCandidates.clear();
+            for(const CollisionPair& pair : m_BroadphaseCollisionPairs)
+            {
+                RigidBody3D* other = pair.pObjectA == body ? pair.pObjectB : (pair.pObjectB == body ? pair.pObjectA : nullptr);
+                if(other && other->GetCollisionShape() && !other->GetIsTrigger())
+                    m_SweptCandidates.push_back(other);
+            }
+
+            if(m_SweptCandidates.empty())
+                continue;
+
+            glm::vec3 position = swept.Start;
+            float timeLeft     = s_UpdateTimestep;
+
+            for(uint32_t subStep = 0; subStep < MaxContinuousSubSteps && distance > Maths::M_EPSILON; subStep++)
+            {
+                const glm::vec3 direction = motion / distance;
+                body->SetPosition(position);
+                const GJKShape shape = GJKShape::FromBody(body);
+
+                // Other bodies are swept against in their integrated pose, and rotation over the step is ignored
+                RigidBody3D* hitBody = nullptr;
+                float timeOfImpact   = distance;
+                glm::vec3 hitNormal;
+                for(RigidBody3D* other : m_SweptCandidates)
+                {
+                    float hitDistance;
+                    glm::vec3 point, normal;
+
+                    // Bodies already touching at the start are left to the discrete contacts
+                    if(GJK::Cast(shape, direction, timeOfImpact, GJKShape::FromBody(other), hitDistance, point, normal) && hitDistance > 0.0f && hitDistance < timeOfImpact)
+                    {
+                        hitBody      = other;
+                        timeOfImpact = hitDistance;
+                        hitNormal    = normal;
+                    }
+                }
+
+                if(!hitBody || !body->FireOnCollisionEvent(body, hitBody) || !hitBody->FireOnCollisionEvent(hitBody, body))
+                {
+                    position += motion;
+                    break;
+                }
+
+                m_Stats.ContinuousHitCount++;
+                position += direction * timeOfImpact;
+                timeLeft *= 1.0f - timeOfImpact / distance;
+
+                // Bounce off the contact normal with the same restitution the manifolds use
+                const float otherInvMass = hitBody->m_Static ? 0.0f : hitBody->m_InvMass;
+                const float normalSpeed  = glm::dot(body->m_LinearVelocity - hitBody->m_LinearVelocity, hitNormal);
+                if(normalSpeed < 0.0f && body->m_InvMass + otherInvMass > 0.0f)
+                {
+                    const float elasticity = sqrtf(body->GetElasticity() * hitBody->GetElasticity());
+                    const float impulse    = -(1.0f + elasticity) * normalSpeed / (body->m_InvMass + otherInvMass);
+                    body->m_LinearVelocity += hitNormal * impulse * body->m_InvMass;
+
+                    if(otherInvMass > 0.0f)
+                    {
+                        hitBody->m_LinearVelocity -= hitNormal * impulse * otherInvMass;
+                        hitBody->WakeUp();
+                    }
+                }
+
+                motion   = body->m_LinearVelocity * timeLeft;
+                distance = glm::length(motion);
+            }
+
+            body->SetPosition(position);
+        }
+    }
+
     void LumosPhysicsEngine::ClearConstraints()
     {
         m_ConstraintCount = 0;
@@ -585,7 +697,183 @@ namespace Lumos
             break;
         }
 
-        m_BroadphaseType = type;
+        m_BroadphaseType      = type;
+        m_QueryStructureDirty = true;
+    }
+
+    static bool MatchesQuery(const RigidBody3D* body, uint32_t layerMask)
+    {
+        const uint16_t layer = body->GetCollisionLayer();
+        return body->GetCollisionShape() && !body->GetIsTrigger() && layer < 32 && (layerMask & (1u << layer)) != 0;
+    }
+
+    void LumosPhysicsEngine::PrepareQueries()
+    {
+        if(!m_QueryStructureDirty || !m_BroadphaseDetection)
+            return;
+
+        LUMOS_PROFILE_FUNCTION_LOW();
+        m_BroadphaseDetection->BuildQueryStructure(m_RootBody, m_RigidBodyCount);
+        m_QueryStructureDirty = false;
+    }
+
+    bool LumosPhysicsEngine::CastQuery(const RaycastQuery& query, RaycastHit& hit, std::vector<RigidBody3D*>& candidates) const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        hit = RaycastHit();
+        if(!m_BroadphaseDetection)
+            return false;
+
+        // A zero direction, easy to pass from Lua, would normalise to NaNs
+        if(glm::length2(query.Direction) < Maths::M_EPSILON)
+            return false;
+
+        const glm::vec3 direction = glm::normalize(query.Direction);
+        candidates.clear();
+        m_BroadphaseDetection->QuerySegment(query.Origin, direction, query.MaxDistance, query.Radius, candidates);
+
+        const GJKShape caster = GJKShape::Sphere(query.Origin, query.Radius);
+        float closest         = query.MaxDistance;
+
+        for(RigidBody3D* body : candidates)
+        {
+            if(!MatchesQuery(body, query.LayerMask))
+                continue;
+
+            float distance;
+            glm::vec3 point, normal;
+            if(GJK::Cast(caster, direction, closest, GJKShape::FromBody(body), distance, point, normal) && distance <= closest)
+            {
+                closest      = distance;
+                hit.Body     = body;
+                hit.Point    = point;
+                hit.Normal   = normal;
+                hit.Distance = distance;
+            }
+        }
+
+        return hit.Body != nullptr;
+    }
+
+    bool LumosPhysicsEngine::Raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, RaycastHit& hit, uint32_t layerMask)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        PrepareQueries();
+
+        RaycastQuery query;
+        query.Origin      = origin;
+        query.Direction   = direction;
+        query.MaxDistance = maxDistance;
+        query.LayerMask   = layerMask;
+        return CastQuery(query, hit, m_QueryCandidates);
+    }
+
+    bool LumosPhysicsEngine::SphereCast(const glm::vec3& origin, float radius, const glm::vec3& direction, float maxDistance, RaycastHit& hit, uint32_t layerMask)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        PrepareQueries();
+
+        RaycastQuery query;
+        query.Origin      = origin;
+        query.Direction   = direction;
+        query.MaxDistance = maxDistance;
+        query.Radius      = radius;
+        query.LayerMask   = layerMask;
+        return CastQuery(query, hit, m_QueryCandidates);
+    }
+
+    uint32_t LumosPhysicsEngine::RaycastAll(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, std::vector<RaycastHit>& hits, uint32_t layerMask)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        PrepareQueries();
+        if(!m_BroadphaseDetection || glm::length2(direction) < Maths::M_EPSILON)
+            return 0;
+
+        const glm::vec3 normalised = glm::normalize(direction);
+        m_QueryCandidates.clear();
+        m_BroadphaseDetection->QuerySegment(origin, normalised, maxDistance, 0.0f, m_QueryCandidates);
+
+        const GJKShape ray = GJKShape::Sphere(origin, 0.0f);
+        const size_t first = hits.size();
+        for(RigidBody3D* body : m_QueryCandidates)
+        {
+            if(!MatchesQuery(body, layerMask))
+                continue;
+
+            RaycastHit hit;
+            hit.Body = body;
+            if(GJK::Cast(ray, normalised, maxDistance, GJKShape::FromBody(body), hit.Distance, hit.Point, hit.Normal))
+                hits.push_back(hit);
+        }
+
+        std::sort(hits.begin() + first, hits.end(), [](const RaycastHit& a, const RaycastHit& b)
+                  { return a.Distance < b.Distance; });
+        return uint32_t(hits.size() - first);
+    }
+
+    uint32_t LumosPhysicsEngine::OverlapQuery(const GJKShape& shape, const Maths::BoundingBox& bounds, std::vector<RigidBody3D*>& bodies, uint32_t layerMask)
+    {
+        PrepareQueries();
+        if(!m_BroadphaseDetection)
+            return 0;
+
+        m_QueryCandidates.clear();
+        m_BroadphaseDetection->QueryAABB(bounds, m_QueryCandidates);
+
+        uint32_t count = 0;
+        for(RigidBody3D* body : m_QueryCandidates)
+        {
+            if(MatchesQuery(body, layerMask) && GJK::Overlap(shape, GJKShape::FromBody(body)))
+            {
+                bodies.push_back(body);
+                count++;
+            }
+        }
+
+        return count;
+    }
+
+    uint32_t LumosPhysicsEngine::OverlapSphere(const glm::vec3& centre, float radius, std::vector<RigidBody3D*>& bodies, uint32_t layerMask)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        const Maths::BoundingBox bounds(centre - glm::vec3(radius), centre + glm::vec3(radius));
+        return OverlapQuery(GJKShape::Sphere(centre, radius), bounds, bodies, layerMask);
+    }
+
+    uint32_t LumosPhysicsEngine::OverlapBox(const glm::vec3& centre, const glm::vec3& halfExtents, const glm::quat& orientation, std::vector<RigidBody3D*>& bodies, uint32_t layerMask)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        const GJKShape box     = GJKShape::Box(centre, halfExtents, orientation);
+        const glm::vec3 extent = glm::abs(box.Axes[0]) + glm::abs(box.Axes[1]) + glm::abs(box.Axes[2]);
+        return OverlapQuery(box, Maths::BoundingBox(centre - extent, centre + extent), bodies, layerMask);
+    }
+
+    void LumosPhysicsEngine::RaycastBatch(const RaycastQuery* queries, uint32_t count, RaycastHit* hits)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        PrepareQueries();
+
+        if(count >= MinRaycastsPerBatchJob && System::JobSystem::GetThreadCount() > 1)
+        {
+            // Cached transforms and bounds are filled in lazily, so do it here before jobs read them
+            for(RigidBody3D* current = m_RootBody; current; current = current->m_Next)
+            {
+                current->GetWorldSpaceTransform();
+                current->GetWorldSpaceAABB();
+            }
+
+            std::vector<std::vector<RigidBody3D*>> candidates((count + RaycastsPerJob - 1) / RaycastsPerJob);
+
+            System::JobSystem::Context context;
+            System::JobSystem::Dispatch(context, count, RaycastsPerJob, [&](JobDispatchArgs args)
+                                        { CastQuery(queries[args.jobIndex], hits[args.jobIndex], candidates[args.groupID]); });
+            System::JobSystem::Wait(context);
+        }
+        else
+        {
+            for(uint32_t i = 0; i < count; i++)
+                CastQuery(queries[i], hits[i], m_QueryCandidates);
+        }
     }
 
     void LumosPhysicsEngine::OnImGui()
@@ -613,6 +901,7 @@ namespace Lumos
         ImGuiUtilities::Property("Collision Count", m_Stats.CollisionCount, ImGuiUtilities::PropertyFlag::ReadOnly);
         ImGuiUtilities::Property("NarrowPhase Count", m_Stats.NarrowPhaseCount, ImGuiUtilities::PropertyFlag::ReadOnly);
         ImGuiUtilities::Property("Constraint Count", m_Stats.ConstraintCount, ImGuiUtilities::PropertyFlag::ReadOnly);
+        ImGuiUtilities::Property("Continuous Hit Count", m_Stats.ContinuousHitCount, ImGuiUtilities::PropertyFlag::ReadOnly);
 
         ImGui::AlignTextToFramePadding();
         ImGui::TextUnformatted("Paused");
@@ -622,6 +911,16 @@ namespace Lumos
         ImGui::PopItemWidth();
         ImGui::NextColumn();
 
+        ImGui::AlignTextToFramePadding();
+        ImGui::TextUnformatted("GJK Narrowphase");
+        ImGui::NextColumn();
+        ImGui::PushItemWidth(-1);
+        bool useGJK = CollisionDetection::Get().GetUseGJK();
+        if(ImGui::Checkbox("##GJK Narrowphase", &useGJK))
+            CollisionDetection::Get().SetUseGJK(useGJK);
+        ImGui::PopItemWidth();
+        ImGui::NextColumn();
+
         ImGui::AlignTextToFramePadding();
         ImGui::TextUnformatted("Gravity");
         ImGui::NextColumn();
@@ -42,6 +42,7 @@ namespace Lumos
     class Constraint;
     class TimeStep;
     class Scene;
+    struct GJKShape;
 
     struct PhysicsStats3D
     {
@@ -51,6 +52,29 @@ namespace Lumos
         uint32_t StaticCount;
         uint32_t ConstraintCount;
         uint32_t NarrowPhaseCount;
+        uint32_t ContinuousHitCount;
+    };
+
+    // Bit n of a query layer mask matches bodies on collision layer n
+    static const uint32_t AllCollisionLayers = 0xFFFFFFFF;
+
+    // Normal points away from the hit body
+    struct LUMOS_EXPORT RaycastHit
+    {
+        RigidBody3D* Body = nullptr;
+        glm::vec3 Point   = glm::vec3(0.0f);
+        glm::vec3 Normal  = glm::vec3(0.0f);
+        float Distance    = 0.0f;
+    };
+
+    // One cast of a batch, a radius above zero makes it a sphere cast
+    struct LUMOS_EXPORT RaycastQuery
+    {
+        glm::vec3 Origin    = glm::vec3(0.0f);
+        glm::vec3 Direction = glm::vec3(0.0f, 0.0f, -1.0f);
+        float MaxDistance   = 1000.0f;
+        float Radius        = 0.0f;
+        uint32_t LayerMask  = AllCollisionLayers;
     };
 
     struct LumosPhysicsEngineConfig
@@ -124,6 +148,17 @@ namespace Lumos
 
         const PhysicsStats3D& GetStats() const { return m_Stats; }
 
+        // Scene queries, accelerated by the broadphase and rebuilt at most once a frame or when bodies are added or removed.
+        // Triggers are ignored. Bodies moved by hand earlier in the same frame can be missed until the next frame
+        bool Raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, RaycastHit& hit, uint32_t layerMask = AllCollisionLayers);
+        uint32_t RaycastAll(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, std::vector<RaycastHit>& hits, uint32_t layerMask = AllCollisionLayers);
+        bool SphereCast(const glm::vec3& origin, float radius, const glm::vec3& direction, float maxDistance, RaycastHit& hit, uint32_t layerMask = AllCollisionLayers);
+        uint32_t OverlapSphere(const glm::vec3& centre, float radius, std::vector<RigidBody3D*>& bodies, uint32_t layerMask = AllCollisionLayers);
+        uint32_t OverlapBox(const glm::vec3& centre, const glm::vec3& halfExtents, const glm::quat& orientation, std::vector<RigidBody3D*>& bodies, uint32_t layerMask = AllCollisionLayers);
+
+        // Closest hit per query, misses have a null body. Large batches are split across the job system
+        void RaycastBatch(const RaycastQuery* queries, uint32_t count, RaycastHit* hits);
+
     protected:
         // The actual time-independant update function
         void UpdatePhysics();
@@ -141,6 +176,15 @@ namespace Lumos
         // Solves all engine constraints (constraints and manifolds)
         void SolveConstraints();
 
+        // Sweeps continuous collision bodies from their pose before integration, stopping and
+        // bouncing them at the first time of impact. Only these bodies are sub-stepped
+        void SolveContinuousCollisions();
+
+        // Rebuilds the broadphase query structure if bodies were stepped, added or removed since the last build
+        void PrepareQueries();
+        bool CastQuery(const RaycastQuery& query, RaycastHit& hit, std::vector<RigidBody3D*>& candidates) const;
+        uint32_t OverlapQuery(const GJKShape& shape, const Maths::BoundingBox& bounds, std::vector<RigidBody3D*>& bodies, uint32_t layerMask);
+
     protected:
         bool m_IsPaused;
         float m_UpdateAccum;
@@ -175,6 +219,17 @@ namespace Lumos
         Arena* m_Arena;
 
         PhysicsStats3D m_Stats;
+        bool m_QueryStructureDirty = true;
+
+        struct SweptBody
+        {
+            RigidBody3D* Body;
+            glm::vec3 Start;
+        };
+
+        std::vector<SweptBody> m_SweptBodies;
+        std::vector<RigidBody3D*> m_SweptCandidates;
+        std::vector<RigidBody3D*> m_QueryCandidates;
 
         static float s_UpdateTimestep;
     };
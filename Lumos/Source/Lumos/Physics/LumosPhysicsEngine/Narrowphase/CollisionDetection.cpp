@@ -5,6 +5,7 @@
 #include "Physics/LumosPhysicsEngine/CollisionShapes/PyramidCollisionShape.h"
 #include "Physics/LumosPhysicsEngine/CollisionShapes/HullCollisionShape.h"
 #include "Physics/LumosPhysicsEngine/CollisionShapes/CapsuleCollisionShape.h"
+#include "GJK.h"
 #include "Maths/MathsUtilities.h"
 #include <glm/gtx/string_cast.hpp>
 
@@ -39,6 +40,25 @@ namespace Lumos
         return CALL_MEMBER_FN(*this, m_CollisionCheckFunctions[shape1->GetType() | shape2->GetType()])(obj1, obj2, shape1, shape2, out_coldata);
     }
 
+    void CollisionDetection::SetUseGJK(bool useGJK)
+    {
+        m_UseGJK = useGJK;
+
+        const CollisionCheckFunc polyhedronCheck        = useGJK ? &CollisionDetection::CheckConvexCollision : &CollisionDetection::CheckPolyhedronCollision;
+        const CollisionCheckFunc polyhedronSphereCheck  = useGJK ? &CollisionDetection::CheckConvexCollision : &CollisionDetection::CheckPolyhedronSphereCollision;
+        const CollisionCheckFunc polyhedronCapsuleCheck = useGJK ? &CollisionDetection::CheckConvexCollision : &CollisionDetection::CheckPolyhedronCapsuleCheckCollision;
+
+        const CollisionShapeType polyhedra[] = { CollisionCuboid, CollisionPyramid, CollisionHull };
+        for(CollisionShapeType polyhedron : polyhedra)
+        {
+            for(CollisionShapeType other : polyhedra)
+                m_CollisionCheckFunctions[polyhedron | other] = polyhedronCheck;
+
+            m_CollisionCheckFunctions[polyhedron | CollisionSphere]  = polyhedronSphereCheck;
+            m_CollisionCheckFunctions[polyhedron | CollisionCapsule] = polyhedronCapsuleCheck;
+        }
+    }
+
     bool CollisionDetection::InvalidCheckCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata)
     {
         LUMOS_LOG_CRITICAL("Invalid Collision type specified");
@@ -79,7 +99,7 @@ CollisionData colData;
         return true;
     }
 
-    void AddPossibleCollisionAxis(glm::vec3& axis, glm::vec3* possibleCollisionAxes, uint32_t& possibleCollisionAxesCount)
+    void AddPossibleCollisionAxis(glm::vec3& axis, Vector<glm::vec3>& possibleCollisionAxes)
     {
         LUMOS_PROFILE_FUNCTION_LOW();
         if(glm::length2(axis) < Maths::M_EPSILON)
@@ -89,14 +109,13 @@ CollisionData colData;
 
         float value = (1.0f - Maths::M_EPSILON);
 
-        for(uint32_t i = 0; i < possibleCollisionAxesCount; i++)
+        for(const glm::vec3& p_axis : possibleCollisionAxes)
         {
-            const glm::vec3& p_axis = possibleCollisionAxes[i];
             if(glm::abs(glm::dot(axis, p_axis)) >= value)
                 return;
         }
 
-        possibleCollisionAxes[possibleCollisionAxesCount++] = axis;
+        possibleCollisionAxes.PushBack(axis);
     }
 
     bool CollisionDetection::CheckPolyhedronSphereCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata)
@@ -125,34 +144,36 @@ CollisionData colData;
         CollisionData best_colData;
         best_colData.penetration = -FLT_MAX;
 
-        std::vector<glm::vec3>& shapeCollisionAxes      = complexShape->GetCollisionAxes(complexObj);
-        std::vector<CollisionEdge>& complex_shape_edges = complexShape->GetEdges(complexObj);
+        ArenaTemp scratch = ScratchBegin(nullptr, 0);
+        Vector<glm::vec3> possibleCollisionAxes(scratch.arena);
+        Vector<CollisionEdge> complex_shape_edges(scratch.arena);
+        complexShape->GetCollisionAxes(complexObj, possibleCollisionAxes);
+        complexShape->GetEdges(complexObj, complex_shape_edges);
 
         glm::vec3 p   = GetClosestPointOnEdges(sphereObj->GetPosition(), complex_shape_edges);
         glm::vec3 p_t = sphereObj->GetPosition() - p;
         p_t           = glm::normalize(p_t);
 
-        static const int MAX_COLLISION_AXES = 100;
-        static glm::vec3 possibleCollisionAxes[MAX_COLLISION_AXES];
+        AddPossibleCollisionAxis(p_t, possibleCollisionAxes);
 
-        uint32_t possibleCollisionAxesCount = 0;
-        for(const glm::vec3& axis : shapeCollisionAxes)
+        bool colliding = true;
+        for(const glm::vec3& axis : possibleCollisionAxes)
         {
-            possibleCollisionAxes[possibleCollisionAxesCount++] = axis;
-        }
-
-        AddPossibleCollisionAxis(p_t, possibleCollisionAxes, possibleCollisionAxesCount);
-
-        for(uint32_t i = 0; i < possibleCollisionAxesCount; i++)
-        {
-            const glm::vec3& axis = possibleCollisionAxes[i];
             if(!CheckCollisionAxis(axis, obj1, obj2, shape1, shape2, &cur_colData))
-                return false;
+            {
+                colliding = false;
+                break;
+            }
 
             if(cur_colData.penetration > best_colData.penetration)
                 best_colData = cur_colData;
         }
 
+        ScratchEnd(scratch);
+
+        if(!colliding)
+            return false;
+
         if(out_coldata)
             *out_coldata = best_colData;
 
@@ -166,25 +187,10 @@ CollisionData colData;
         CollisionData best_colData;
         best_colData.penetration = -FLT_MAX;
 
-        std::vector<glm::vec3>& shape1CollisionAxes         = shape1->GetCollisionAxes(obj1);
-        std::vector<glm::vec3>& shape2PossibleCollisionAxes = shape2->GetCollisionAxes(obj2);
-
-        static const int MAX_COLLISION_AXES = 100;
-        static glm::vec3 possibleCollisionAxes[MAX_COLLISION_AXES];
-
-        uint32_t possibleCollisionAxesCount = 0;
-        for(const glm::vec3& axis : shape1CollisionAxes)
-        {
-            possibleCollisionAxes[possibleCollisionAxesCount++] = axis;
-        }
-
-        for(const glm::vec3& axis : shape2PossibleCollisionAxes)
-        {
-            possibleCollisionAxes[possibleCollisionAxesCount++] = axis;
-        }
-
-        std::vector<CollisionEdge>& shape1_edges = shape1->GetEdges(obj1);
-        std::vector<CollisionEdge>& shape2_edges = shape2->GetEdges(obj2);
+        ArenaTemp scratch = ScratchBegin(nullptr, 0);
+        Vector<glm::vec3> possibleCollisionAxes(scratch.arena);
+        shape1->GetCollisionAxes(obj1, possibleCollisionAxes);
+        shape2->GetCollisionAxes(obj2, possibleCollisionAxes);
 
         /*     for(const CollisionEdge& edge1 : shape1_edges)
              {
@@ -196,20 +202,28 @@ CollisionData colData;
                      e2           = glm::normalize(e2);
 
                      glm::vec3 temp = glm::cross(e1, e2);
-                     AddPossibleCollisionAxis(temp, possibleCollisionAxes, possibleCollisionAxesCount);
+                     AddPossibleCollisionAxis(temp, possibleCollisionAxes);
                  }
              }*/
 
-        for(uint32_t i = 0; i < possibleCollisionAxesCount; i++)
+        bool colliding = true;
+        for(const glm::vec3& axis : possibleCollisionAxes)
         {
-            const glm::vec3& axis = possibleCollisionAxes[i];
             if(!CheckCollisionAxis(axis, obj1, obj2, shape1, shape2, &cur_colData))
-                return false;
+            {
+                colliding = false;
+                break;
+            }
 
             if(cur_colData.penetration >= best_colData.penetration)
                 best_colData = cur_colData;
         }
 
+        ScratchEnd(scratch);
+
+        if(!colliding)
+            return false;
+
         if(out_coldata)
             *out_coldata = best_colData;
 
@@ -637,23 +651,17 @@ CollisionData colData;
         CollisionData best_colData;
         best_colData.penetration = -FLT_MAX;
 
-        std::vector<glm::vec3>& shapeCollisionAxes      = complexShape->GetCollisionAxes(complexObj);
-        std::vector<CollisionEdge>& complex_shape_edges = complexShape->GetEdges(complexObj);
+        ArenaTemp scratch = ScratchBegin(nullptr, 0);
+        Vector<glm::vec3> possibleCollisionAxes(scratch.arena);
+        Vector<CollisionEdge> complex_shape_edges(scratch.arena);
+        complexShape->GetCollisionAxes(complexObj, possibleCollisionAxes);
+        complexShape->GetEdges(complexObj, complex_shape_edges);
 
         glm::vec3 p   = GetClosestPointOnEdges(capsuleObj->GetPosition(), complex_shape_edges);
         glm::vec3 p_t = capsuleObj->GetPosition() - p;
         p_t           = glm::normalize(p_t);
 
-        static const int MAX_COLLISION_AXES = 100;
-        static glm::vec3 possibleCollisionAxes[MAX_COLLISION_AXES];
-
-        uint32_t possibleCollisionAxesCount = 0;
-        for(const glm::vec3& axis : shapeCollisionAxes)
-        {
-            possibleCollisionAxes[possibleCollisionAxesCount++] = axis;
-        }
-
-        AddPossibleCollisionAxis(p_t, possibleCollisionAxes, possibleCollisionAxesCount);
+        AddPossibleCollisionAxis(p_t, possibleCollisionAxes);
 
         glm::vec3 capsulePos = capsuleObj->GetPosition();
         glm::vec4 forward    = glm::vec4(0.0f, 0.0f, 1.0f, 0.0f);
@@ -665,16 +673,24 @@ CollisionData colData;
         float capsuleTop    = capsulePos.y + capsuleHeight * 0.5f;
         float capsuleBottom = capsulePos.y - capsuleHeight * 0.5f;
 
-        for(uint32_t i = 0; i < possibleCollisionAxesCount; i++)
+        bool colliding = true;
+        for(const glm::vec3& axis : possibleCollisionAxes)
         {
-            const glm::vec3& axis = possibleCollisionAxes[i];
             if(!CheckCollisionAxis(axis, obj1, obj2, shape1, shape2, &cur_colData))
-                return false;
+            {
+                colliding = false;
+                break;
+            }
 
             if(cur_colData.penetration >= best_colData.penetration)
                 best_colData = cur_colData;
         }
 
+        ScratchEnd(scratch);
+
+        if(!colliding)
+            return false;
+
         if(glm::dot(best_colData.normal, capsuleDir) < 0.0f)
             best_colData.normal = -best_colData.normal;
 
@@ -684,6 +700,24 @@ CollisionData colData;
         return true;
     }
 
+    bool CollisionDetection::CheckConvexCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        GJKContact contact;
+        if(!GJK::Penetration(GJKShape::FromBody(obj1), GJKShape::FromBody(obj2), contact))
+            return false;
+
+        // Same conventions as CheckCollisionAxis, the normal points from obj1 to obj2 and overlap is negative
+        if(out_coldata)
+        {
+            out_coldata->normal       = contact.Normal;
+            out_coldata->penetration  = -contact.Depth;
+            out_coldata->pointOnPlane = contact.PointB;
+        }
+
+        return true;
+    }
+
     bool CollisionDetection::CheckCollisionAxis(const glm::vec3& axis, RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata)
     {
         LUMOS_PROFILE_FUNCTION_LOW();
@@ -828,7 +862,7 @@ CollisionData colData;
         return true;
     }
 
-    glm::vec3 CollisionDetection::GetClosestPointOnEdges(const glm::vec3& target, const std::vector<CollisionEdge>& edges)
+    glm::vec3 CollisionDetection::GetClosestPointOnEdges(const glm::vec3& target, const Vector<CollisionEdge>& edges)
     {
         LUMOS_PROFILE_FUNCTION_LOW();
         glm::vec3 closest_point      = glm::vec3(0.0f);
@@ -36,6 +36,10 @@ namespace Lumos
 
         bool BuildCollisionManifold(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData& coldata, Manifold* out_manifold);
 
+        // Pairs with a cuboid, pyramid or hull use GJK/EPA instead of separating axis tests
+        void SetUseGJK(bool useGJK);
+        bool GetUseGJK() const { return m_UseGJK; }
+
         static inline bool CheckSphereOverlap(const glm::vec3& pos1, float radius1, const glm::vec3& pos2, float radius2)
         {
             return glm::distance2(pos2, pos1) <= Maths::Squared(radius1 + radius2);
@@ -129,13 +133,15 @@ namespace Lumos
         bool CheckCapsuleCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata = nullptr);
         bool CheckCapsuleSphereCheckCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata = nullptr);
         bool CheckPolyhedronCapsuleCheckCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata = nullptr);
+        bool CheckConvexCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata = nullptr);
         bool InvalidCheckCollision(RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata = nullptr);
 
         static bool CheckCollisionAxis(const glm::vec3& axis, RigidBody3D* obj1, RigidBody3D* obj2, CollisionShape* shape1, CollisionShape* shape2, CollisionData* out_coldata);
 
-        static glm::vec3 GetClosestPointOnEdges(const glm::vec3& target, const std::vector<CollisionEdge>& edges);
+        static glm::vec3 GetClosestPointOnEdges(const glm::vec3& target, const Vector<CollisionEdge>& edges);
         glm::vec3 PlaneEdgeIntersection(const Plane& plane, const glm::vec3& start, const glm::vec3& end) const;
         void SutherlandHodgesonClipping(Arena* arena, const Vector<glm::vec3>& input_polygon, int num_clip_planes, const Plane* clip_planes, Vector<glm::vec3>* out_polygon, bool removePoints) const;
         uint32_t m_MaxSize = 0;
+        bool m_UseGJK      = false;
     };
 }
@@ -0,0 +1,718 @@
+#include "Precompiled.h"
+#include "GJK.h"
+#include "Physics/LumosPhysicsEngine/RigidBody3D.h"
+#include "Physics/LumosPhysicsEngine/CollisionShapes/SphereCollisionShape.h"
+#include "Physics/LumosPhysicsEngine/CollisionShapes/CapsuleCollisionShape.h"
+#include "Maths/MathsUtilities.h"
+
+#include <glm/gtx/norm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+namespace Lumos
+{
+    static const uint32_t MaxIterations     = 64;
+    static const uint32_t MaxCastIterations = 32;
+    static const float RelativeTolerance    = 1e-6f;
+    static const float OverlapTolerance     = 1e-10f;
+    static const float CastTolerance        = 1e-3f;
+
+    // Expanding polytope limits, sized for stack storage so penetration queries stay reentrant
+    static const uint32_t MaxEPAIterations = 64;
+    static const uint32_t MaxEPAVertices   = MaxEPAIterations + 5;
+    static const uint32_t MaxEPAFaces      = 256;
+    static const uint32_t MaxEPAEdges      = 128;
+    static const float EPATolerance        = 1e-4f;
+
+    struct GJKSimplexVertex
+    {
+        glm::vec3 A;
+        glm::vec3 B;
+        glm::vec3 W; // A - B
+    };
+
+    struct GJKSimplex
+    {
+        GJKSimplexVertex Vertices[4];
+        float Lambdas[4];
+        uint32_t Count = 0;
+
+        void Add(const GJKSimplexVertex& vertex, float lambda)
+        {
+            Vertices[Count] = vertex;
+            Lambdas[Count]  = lambda;
+            Count++;
+        }
+
+        glm::vec3 Closest() const
+        {
+            glm::vec3 closest(0.0f);
+            for(uint32_t i = 0; i < Count; i++)
+                closest += Vertices[i].W * Lambdas[i];
+            return closest;
+        }
+    };
+
+    glm::vec3 GJKShape::Support(const glm::vec3& direction) const
+    {
+        switch(Core)
+        {
+        case CoreType::Segment:
+            return glm::dot(direction, Points[1] - Points[0]) >= 0.0f ? Points[1] : Points[0];
+        case CoreType::Box:
+            return Points[0] + Axes[0] * (glm::dot(direction, Axes[0]) >= 0.0f ? 1.0f : -1.0f)
+                + Axes[1] * (glm::dot(direction, Axes[1]) >= 0.0f ? 1.0f : -1.0f)
+                + Axes[2] * (glm::dot(direction, Axes[2]) >= 0.0f ? 1.0f : -1.0f);
+        case CoreType::Polyhedron:
+        {
+            glm::vec3 max;
+            Shape->GetMinMaxVertexOnAxis(Body, direction, nullptr, &max);
+            return max;
+        }
+        case CoreType::Point:
+        default:
+            return Points[0];
+        }
+    }
+
+    GJKShape GJKShape::FromBody(const RigidBody3D* body)
+    {
+        GJKShape shape;
+        const CollisionShape* collisionShape = body->GetCollisionShape().get();
+        const glm::mat4& transform           = body->GetWorldSpaceTransform();
+
+        switch(collisionShape->GetType())
+        {
+        case CollisionSphere:
+        {
+            // Sphere shapes don't use their local transform, see SphereCollisionShape::GetMinMaxVertexOnAxis
+            const SphereCollisionShape* sphere = static_cast<const SphereCollisionShape*>(collisionShape);
+            shape.Core                         = CoreType::Point;
+            shape.Points[0]                    = transform[3];
+            shape.Radius                       = sphere->GetRadius();
+            break;
+        }
+        case CollisionCapsule:
+        {
+            // Same segment as CollisionDetection::CheckCapsuleCollision
+            const CapsuleCollisionShape* capsule = static_cast<const CapsuleCollisionShape*>(collisionShape);
+            shape.Core                           = CoreType::Segment;
+            shape.Points[0]                      = transform * glm::vec4(0.0f, -capsule->GetHeight() * 0.5f, 0.0f, 1.0f);
+            shape.Points[1]                      = transform * glm::vec4(0.0f, capsule->GetHeight() * 0.5f, 0.0f, 1.0f);
+            shape.Radius                         = capsule->GetRadius();
+            break;
+        }
+        default:
+            shape.Core  = CoreType::Polyhedron;
+            shape.Shape = collisionShape;
+            shape.Body  = body;
+            break;
+        }
+
+        return shape;
+    }
+
+    GJKShape GJKShape::Sphere(const glm::vec3& centre, float radius)
+    {
+        GJKShape shape;
+        shape.Core      = CoreType::Point;
+        shape.Points[0] = centre;
+        shape.Radius    = radius;
+        return shape;
+    }
+
+    GJKShape GJKShape::Box(const glm::vec3& centre, const glm::vec3& halfExtents, const glm::quat& orientation)
+    {
+        const glm::mat3 rotation = glm::mat3_cast(orientation);
+
+        GJKShape shape;
+        shape.Core      = CoreType::Box;
+        shape.Points[0] = centre;
+        shape.Axes[0]   = rotation[0] * halfExtents.x;
+        shape.Axes[1]   = rotation[1] * halfExtents.y;
+        shape.Axes[2]   = rotation[2] * halfExtents.z;
+        return shape;
+    }
+
+    static GJKSimplexVertex SupportVertex(const GJKShape& a, const glm::vec3& offsetA, const GJKShape& b, const glm::vec3& direction)
+    {
+        GJKSimplexVertex vertex;
+        vertex.A = a.Support(direction) + offsetA;
+        vertex.B = b.Support(-direction);
+        vertex.W = vertex.A - vertex.B;
+        return vertex;
+    }
+
+    static void SolveSegment(const GJKSimplexVertex& a, const GJKSimplexVertex& b, GJKSimplex& out)
+    {
+        const glm::vec3 ab = b.W - a.W;
+        const float denom  = glm::dot(ab, ab);
+        float t            = -glm::dot(a.W, ab);
+
+        out.Count = 0;
+        if(t <= 0.0f || denom <= OverlapTolerance)
+            out.Add(a, 1.0f);
+        else if(t >= denom)
+            out.Add(b, 1.0f);
+        else
+        {
+            t /= denom;
+            out.Add(a, 1.0f - t);
+            out.Add(b, t);
+        }
+    }
+
+    // Closest point on a triangle to the origin by Voronoi region, from Real-Time Collision Detection 5.1.5
+    static void SolveTriangle(const GJKSimplexVertex& a, const GJKSimplexVertex& b, const GJKSimplexVertex& c, GJKSimplex& out)
+    {
+        out.Count = 0;
+
+        const glm::vec3 ab = b.W - a.W;
+        const glm::vec3 ac = c.W - a.W;
+
+        const float d1 = -glm::dot(ab, a.W);
+        const float d2 = -glm::dot(ac, a.W);
+        if(d1 <= 0.0f && d2 <= 0.0f)
+        {
+            out.Add(a, 1.0f);
+            return;
+        }
+
+        const float d3 = -glm::dot(ab, b.W);
+        const float d4 = -glm::dot(ac, b.W);
+        if(d3 >= 0.0f && d4 <= d3)
+        {
+            out.Add(b, 1.0f);
+            return;
+        }
+
+        const float vc = d1 * d4 - d3 * d2;
+        if(vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+        {
+            const float v = d1 / (d1 - d3);
+            out.Add(a, 1.0f - v);
+            out.Add(b, v);
+            return;
+        }
+
+        const float d5 = -glm::dot(ab, c.W);
+        const float d6 = -glm::dot(ac, c.W);
+        if(d6 >= 0.0f && d5 <= d6)
+        {
+            out.Add(c, 1.0f);
+            return;
+        }
+
+        const float vb = d5 * d2 - d1 * d6;
+        if(vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+        {
+            const float w = d2 / (d2 - d6);
+            out.Add(a, 1.0f - w);
+            out.Add(c, w);
+            return;
+        }
+
+        const float va = d3 * d6 - d5 * d4;
+        if(va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
+        {
+            const float w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+            out.Add(b, 1.0f - w);
+            out.Add(c, w);
+            return;
+        }
+
+        const float denom = 1.0f / (va + vb + vc);
+        const float v     = vb * denom;
+        const float w     = vc * denom;
+        out.Add(a, 1.0f - v - w);
+        out.Add(b, v);
+        out.Add(c, w);
+    }
+
+    // Returns true if the origin is inside the tetrahedron, otherwise reduces to the closest face
+    static bool SolveTetrahedron(const GJKSimplexVertex* vertices, GJKSimplex& out)
+    {
+        static const uint32_t Faces[4][4] = {
+            { 0, 1, 2, 3 },
+            { 0, 2, 3, 1 },
+            { 0, 3, 1, 2 },
+            { 1, 3, 2, 0 }
+        };
+
+        bool inside        = true;
+        float bestDistance = FLT_MAX;
+
+        for(uint32_t face = 0; face < 4; face++)
+        {
+            const GJKSimplexVertex& a = vertices[Faces[face][0]];
+            const GJKSimplexVertex& b = vertices[Faces[face][1]];
+            const GJKSimplexVertex& c = vertices[Faces[face][2]];
+            const GJKSimplexVertex& d = vertices[Faces[face][3]];
+
+            const glm::vec3 normal = glm::cross(b.W - a.W, c.W - a.W);
+            const float signOrigin = -glm::dot(a.W, normal);
+            const float signOther  = glm::dot(d.W - a.W, normal);
+
+            // A flat tetrahedron has no inside, so every face has to be checked
+            const bool degenerate = Maths::Abs(signOther) <= RelativeTolerance * glm::length2(normal);
+            if(!degenerate && signOrigin * signOther >= 0.0f)
+                continue;
+
+            inside = false;
+
+            GJKSimplex candidate;
+            SolveTriangle(a, b, c, candidate);
+            const float distance = glm::length2(candidate.Closest());
+            if(distance < bestDistance)
+            {
+                bestDistance = distance;
+                out          = candidate;
+            }
+        }
+
+        return inside;
+    }
+
+    // Leaves the simplex enclosing the origin on overlap so EPA can start from it
+    static bool SolveGJK(const GJKShape& a, const glm::vec3& offsetA, const GJKShape& b, GJKSimplex& simplex, float& outDistanceSquared)
+    {
+        simplex.Count = 0;
+        simplex.Add(SupportVertex(a, offsetA, b, glm::vec3(1.0f, 0.0f, 0.0f)), 1.0f);
+
+        glm::vec3 closest     = simplex.Vertices[0].W;
+        float distanceSquared = glm::length2(closest);
+        bool overlap          = false;
+
+        for(uint32_t iteration = 0; iteration < MaxIterations; iteration++)
+        {
+            if(distanceSquared <= OverlapTolerance)
+            {
+                overlap = true;
+                break;
+            }
+
+            const GJKSimplexVertex vertex = SupportVertex(a, offsetA, b, -closest);
+
+            // The new support point gets no closer to the origin than the current feature
+            if(distanceSquared - glm::dot(closest, vertex.W) <= RelativeTolerance * distanceSquared)
+                break;
+
+            bool duplicate = false;
+            for(uint32_t i = 0; i < simplex.Count; i++)
+                duplicate |= simplex.Vertices[i].W == vertex.W;
+            if(duplicate)
+                break;
+
+            GJKSimplexVertex vertices[4];
+            for(uint32_t i = 0; i < simplex.Count; i++)
+                vertices[i] = simplex.Vertices[i];
+            vertices[simplex.Count] = vertex;
+
+            switch(simplex.Count + 1)
+            {
+            case 2:
+                SolveSegment(vertices[0], vertices[1], simplex);
+                break;
+            case 3:
+                SolveTriangle(vertices[0], vertices[1], vertices[2], simplex);
+                break;
+            default:
+                overlap = SolveTetrahedron(vertices, simplex);
+                if(overlap)
+                {
+                    simplex.Count = 0;
+                    for(uint32_t i = 0; i < 4; i++)
+                        simplex.Add(vertices[i], 0.25f);
+                }
+                break;
+            }
+
+            if(overlap)
+                break;
+
+            closest                        = simplex.Closest();
+            const float newDistanceSquared = glm::length2(closest);
+            if(newDistanceSquared >= distanceSquared)
+            {
+                distanceSquared = newDistanceSquared;
+                break;
+            }
+
+            distanceSquared = newDistanceSquared;
+        }
+
+        outDistanceSquared = overlap ? 0.0f : distanceSquared;
+        return overlap;
+    }
+
+    static void ClosestPoints(const GJKSimplex& simplex, glm::vec3& outPointA, glm::vec3& outPointB)
+    {
+        outPointA = glm::vec3(0.0f);
+        outPointB = glm::vec3(0.0f);
+        for(uint32_t i = 0; i < simplex.Count; i++)
+        {
+            outPointA += simplex.Vertices[i].A * simplex.Lambdas[i];
+            outPointB += simplex.Vertices[i].B * simplex.Lambdas[i];
+        }
+    }
+
+    bool GJK::CoreDistance(const GJKShape& a, const glm::vec3& offsetA, const GJKShape& b, glm::vec3& outPointA, glm::vec3& outPointB, float& outDistance)
+    {
+        GJKSimplex simplex;
+        float distanceSquared;
+        const bool overlap = SolveGJK(a, offsetA, b, simplex, distanceSquared);
+        ClosestPoints(simplex, outPointA, outPointB);
+
+        outDistance = glm::sqrt(distanceSquared);
+        return overlap;
+    }
+
+    struct EPAFace
+    {
+        uint32_t Vertices[3];
+        glm::vec3 Normal;
+        float Distance; // From the origin to the face plane
+    };
+
+    // Convex polytope in Minkowski difference space that encloses the origin
+    struct EPAPolytope
+    {
+        GJKSimplexVertex Vertices[MaxEPAVertices];
+        EPAFace Faces[MaxEPAFaces];
+        uint32_t VertexCount = 0;
+        uint32_t FaceCount   = 0;
+        glm::vec3 Interior;
+
+        bool AddFace(uint32_t a, uint32_t b, uint32_t c)
+        {
+            if(FaceCount == MaxEPAFaces)
+                return false;
+
+            glm::vec3 normal   = glm::cross(Vertices[b].W - Vertices[a].W, Vertices[c].W - Vertices[a].W);
+            const float length = glm::length(normal);
+
+            // Wind every face outwards so the edges of neighbouring faces run in opposite directions
+            if(glm::dot(normal, Vertices[a].W - Interior) < 0.0f)
+            {
+                std::swap(b, c);
+                normal = -normal;
+            }
+
+            EPAFace& face    = Faces[FaceCount++];
+            face.Vertices[0] = a;
+            face.Vertices[1] = b;
+            face.Vertices[2] = c;
+
+            // A sliver has no reliable normal, so it is never expanded or picked as the closest face
+            if(length <= Maths::M_EPSILON * Maths::M_EPSILON)
+            {
+                face.Normal   = glm::vec3(0.0f);
+                face.Distance = FLT_MAX;
+            }
+            else
+            {
+                face.Normal   = normal / length;
+                face.Distance = glm::dot(face.Normal, Vertices[a].W);
+            }
+
+            return true;
+        }
+
+        uint32_t ClosestFace() const
+        {
+            uint32_t closest = 0;
+            for(uint32_t i = 1; i < FaceCount; i++)
+            {
+                if(Faces[i].Distance < Faces[closest].Distance)
+                    closest = i;
+            }
+            return closest;
+        }
+    };
+
+    static bool ExpandPolytope(const GJKShape& a, const GJKShape& b, const GJKSimplex& simplex, GJKContact& outContact)
+    {
+        static const uint32_t TetrahedronFaces[4][3] = {
+            { 0, 1, 2 },
+            { 0, 1, 3 },
+            { 0, 2, 3 },
+            { 1, 2, 3 }
+        };
+
+        // Two apexes (0 and 1) around a ring of three vertices
+        static const uint32_t BipyramidFaces[6][3] = {
+            { 0, 2, 3 },
+            { 0, 3, 4 },
+            { 0, 4, 2 },
+            { 1, 2, 3 },
+            { 1, 3, 4 },
+            { 1, 4, 2 }
+        };
+
+        const glm::vec3 noOffset(0.0f);
+
+        EPAPolytope polytope;
+        switch(simplex.Count)
+        {
+        case 2:
+        {
+            // Origin on a segment, add a ring of support points around it
+            const glm::vec3 axis      = glm::normalize(simplex.Vertices[1].W - simplex.Vertices[0].W);
+            const glm::vec3 reference = Maths::Abs(axis.x) < 0.57735f ? glm::vec3(1.0f, 0.0f, 0.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+            const glm::quat rotation  = glm::angleAxis(glm::radians(120.0f), axis);
+            glm::vec3 direction       = glm::normalize(glm::cross(axis, reference));
+
+            polytope.Vertices[polytope.VertexCount++] = simplex.Vertices[0];
+            polytope.Vertices[polytope.VertexCount++] = simplex.Vertices[1];
+            for(uint32_t i = 0; i < 3; i++)
+            {
+                polytope.Vertices[polytope.VertexCount++] = SupportVertex(a, noOffset, b, direction);
+                direction                                 = rotation * direction;
+            }
+            break;
+        }
+        case 3:
+        {
+            // Origin on a triangle, add a support point either side of it
+            const glm::vec3 normal = glm::cross(simplex.Vertices[1].W - simplex.Vertices[0].W, simplex.Vertices[2].W - simplex.Vertices[0].W);
+
+            polytope.Vertices[polytope.VertexCount++] = SupportVertex(a, noOffset, b, normal);
+            polytope.Vertices[polytope.VertexCount++] = SupportVertex(a, noOffset, b, -normal);
+            for(uint32_t i = 0; i < 3; i++)
+                polytope.Vertices[polytope.VertexCount++] = simplex.Vertices[i];
+            break;
+        }
+        case 4:
+            for(uint32_t i = 0; i < 4; i++)
+                polytope.Vertices[polytope.VertexCount++] = simplex.Vertices[i];
+            break;
+        default:
+            // Touching at a single point, there is no depth to resolve
+            return false;
+        }
+
+        polytope.Interior = glm::vec3(0.0f);
+        for(uint32_t i = 0; i < polytope.VertexCount; i++)
+            polytope.Interior += polytope.Vertices[i].W;
+        polytope.Interior /= float(polytope.VertexCount);
+
+        if(simplex.Count == 4)
+        {
+            for(uint32_t i = 0; i < 4; i++)
+                polytope.AddFace(TetrahedronFaces[i][0], TetrahedronFaces[i][1], TetrahedronFaces[i][2]);
+        }
+        else
+        {
+            for(uint32_t i = 0; i < 6; i++)
+                polytope.AddFace(BipyramidFaces[i][0], BipyramidFaces[i][1], BipyramidFaces[i][2]);
+        }
+
+        uint32_t horizon[MaxEPAEdges][2];
+        for(uint32_t iteration = 0; iteration < MaxEPAIterations && polytope.VertexCount < MaxEPAVertices; iteration++)
+        {
+            const EPAFace& closest = polytope.Faces[polytope.ClosestFace()];
+            if(closest.Distance == FLT_MAX)
+                return false;
+
+            // The face already lies on the boundary of the Minkowski difference
+            const GJKSimplexVertex vertex = SupportVertex(a, noOffset, b, closest.Normal);
+            if(glm::dot(vertex.W, closest.Normal) - closest.Distance <= EPATolerance)
+                break;
+
+            const uint32_t index     = polytope.VertexCount++;
+            polytope.Vertices[index] = vertex;
+
+            uint32_t horizonCount = 0;
+            bool overflow         = false;
+
+            // Remove every face the new vertex can see, keeping the edges around the hole they leave
+            for(uint32_t i = 0; i < polytope.FaceCount;)
+            {
+                const EPAFace& face = polytope.Faces[i];
+                if(glm::dot(face.Normal, vertex.W - polytope.Vertices[face.Vertices[0]].W) <= 0.0f)
+                {
+                    i++;
+                    continue;
+                }
+
+                for(uint32_t edge = 0; edge < 3; edge++)
+                {
+                    const uint32_t start = face.Vertices[edge];
+                    const uint32_t end   = face.Vertices[(edge + 1) % 3];
+
+                    // An edge shared with another visible face is inside the hole
+                    bool shared = false;
+                    for(uint32_t h = 0; h < horizonCount; h++)
+                    {
+                        if(horizon[h][0] == end && horizon[h][1] == start)
+                        {
+                            horizonCount--;
+                            horizon[h][0] = horizon[horizonCount][0];
+                            horizon[h][1] = horizon[horizonCount][1];
+                            shared        = true;
+                            break;
+                        }
+                    }
+
+                    if(shared)
+                        continue;
+
+                    if(horizonCount == MaxEPAEdges)
+                    {
+                        overflow = true;
+                        continue;
+                    }
+
+                    horizon[horizonCount][0] = start;
+                    horizon[horizonCount][1] = end;
+                    horizonCount++;
+                }
+
+                polytope.Faces[i] = polytope.Faces[--polytope.FaceCount];
+            }
+
+            for(uint32_t h = 0; h < horizonCount; h++)
+                overflow |= !polytope.AddFace(horizon[h][0], horizon[h][1], index);
+
+            // Out of storage, the closest face found so far is still a valid lower bound
+            if(overflow)
+                break;
+        }
+
+        const EPAFace& face = polytope.Faces[polytope.ClosestFace()];
+        if(polytope.FaceCount == 0 || face.Distance == FLT_MAX)
+            return false;
+
+        // Barycentric coordinates of the origin projected onto the face give the points on each shape
+        const GJKSimplexVertex& v0 = polytope.Vertices[face.Vertices[0]];
+        const GJKSimplexVertex& v1 = polytope.Vertices[face.Vertices[1]];
+        const GJKSimplexVertex& v2 = polytope.Vertices[face.Vertices[2]];
+
+        const glm::vec3 e0 = v1.W - v0.W;
+        const glm::vec3 e1 = v2.W - v0.W;
+        const glm::vec3 e2 = face.Normal * face.Distance - v0.W;
+        const float d00    = glm::dot(e0, e0);
+        const float d01    = glm::dot(e0, e1);
+        const float d11    = glm::dot(e1, e1);
+        const float d20    = glm::dot(e2, e0);
+        const float d21    = glm::dot(e2, e1);
+        const float denom  = d00 * d11 - d01 * d01;
+        const float v      = denom > OverlapTolerance ? (d11 * d20 - d01 * d21) / denom : 0.0f;
+        const float w      = denom > OverlapTolerance ? (d00 * d21 - d01 * d20) / denom : 0.0f;
+        const float u      = 1.0f - v - w;
+
+        outContact.Normal = face.Normal;
+        outContact.Depth  = Maths::Max(face.Distance, 0.0f);
+        outContact.PointA = v0.A * u + v1.A * v + v2.A * w;
+        outContact.PointB = v0.B * u + v1.B * v + v2.B * w;
+        return true;
+    }
+
+    GJKResult GJK::Distance(const GJKShape& a, const GJKShape& b)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        GJKResult result;
+        float coreDistance;
+        result.Overlap = CoreDistance(a, glm::vec3(0.0f), b, result.PointA, result.PointB, coreDistance);
+        if(result.Overlap)
+            return result;
+
+        // Move the closest core points out to the surfaces
+        const glm::vec3 normal = (result.PointA - result.PointB) / coreDistance;
+        result.PointA -= normal * a.Radius;
+        result.PointB += normal * b.Radius;
+        result.Distance = Maths::Max(coreDistance - a.Radius - b.Radius, 0.0f);
+        result.Overlap  = result.Distance <= 0.0f;
+        return result;
+    }
+
+    bool GJK::Overlap(const GJKShape& a, const GJKShape& b)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        glm::vec3 pointA, pointB;
+        float coreDistance;
+        if(CoreDistance(a, glm::vec3(0.0f), b, pointA, pointB, coreDistance))
+            return true;
+
+        return coreDistance <= a.Radius + b.Radius;
+    }
+
+    bool GJK::Cast(const GJKShape& a, const glm::vec3& direction, float maxDistance, const GJKShape& b, float& outDistance, glm::vec3& outPoint, glm::vec3& outNormal)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        const float radius = a.Radius + b.Radius;
+        glm::vec3 normal   = -direction;
+        float t            = 0.0f;
+
+        for(uint32_t iteration = 0; iteration < MaxCastIterations; iteration++)
+        {
+            glm::vec3 pointA, pointB;
+            float coreDistance;
+            const bool overlap = CoreDistance(a, direction * t, b, pointA, pointB, coreDistance);
+
+            // Keep the last well defined normal, the closest points converge as the gap closes
+            if(!overlap && coreDistance > CastTolerance * 0.01f)
+                normal = (pointA - pointB) / coreDistance;
+
+            const float gap = overlap ? 0.0f : coreDistance - radius;
+            if(gap <= CastTolerance)
+            {
+                outDistance = t;
+                outNormal   = normal;
+                outPoint    = pointB + normal * b.Radius;
+                return true;
+            }
+
+            // a can't reach b before crossing the separating plane through the closest points
+            const float approach = -glm::dot(direction, normal);
+            if(approach <= 0.0f)
+                return false;
+
+            t += gap / approach;
+            if(t > maxDistance)
+                return false;
+        }
+
+        return false;
+    }
+
+    bool GJK::Penetration(const GJKShape& a, const GJKShape& b, GJKContact& outContact)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        GJKSimplex simplex;
+        float distanceSquared;
+        const float radius = a.Radius + b.Radius;
+
+        if(!SolveGJK(a, glm::vec3(0.0f), b, simplex, distanceSquared))
+        {
+            // Separated cores can still overlap by the radii of spheres and capsules
+            const float distance = glm::sqrt(distanceSquared);
+            if(distance >= radius)
+                return false;
+
+            glm::vec3 pointA, pointB;
+            ClosestPoints(simplex, pointA, pointB);
+
+            outContact.Normal = (pointB - pointA) / distance;
+            outContact.Depth  = radius - distance;
+            outContact.PointA = pointA + outContact.Normal * a.Radius;
+            outContact.PointB = pointB - outContact.Normal * b.Radius;
+            return true;
+        }
+
+        if(!ExpandPolytope(a, b, simplex, outContact))
+        {
+            // Cores meeting at a single point, only the radii give any depth and every direction is as good
+            if(radius <= 0.0f)
+                return false;
+
+            ClosestPoints(simplex, outContact.PointA, outContact.PointB);
+            outContact.Normal = glm::vec3(0.0f, 1.0f, 0.0f);
+            outContact.Depth  = 0.0f;
+        }
+
+        outContact.Depth += radius;
+        outContact.PointA += outContact.Normal * a.Radius;
+        outContact.PointB -= outContact.Normal * b.Radius;
+        return outContact.Depth > 0.0f;
+    }
+}
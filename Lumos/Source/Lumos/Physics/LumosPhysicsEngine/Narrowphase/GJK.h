@@ -0,0 +1,74 @@
+#pragma once
+#include <glm/ext/vector_float3.hpp>
+#include <glm/ext/matrix_float3x3.hpp>
+#include <glm/ext/quaternion_float.hpp>
+
+namespace Lumos
+{
+    class RigidBody3D;
+    class CollisionShape;
+
+    // Convex shape as a core (point, segment, box or collision shape hull) swept by a radius,
+    // so spheres and capsules are exact rather than tessellated
+    struct LUMOS_EXPORT GJKShape
+    {
+        enum class CoreType : uint8_t
+        {
+            Point,
+            Segment,
+            Box,
+            Polyhedron
+        };
+
+        CoreType Core = CoreType::Point;
+        glm::vec3 Points[2];       // Point, segment end points or box centre
+        glm::mat3 Axes;            // Box axes scaled by the half extents
+        const CollisionShape* Shape = nullptr;
+        const RigidBody3D* Body     = nullptr;
+        float Radius                = 0.0f;
+
+        // Furthest point of the core along direction, which doesn't need to be normalised
+        glm::vec3 Support(const glm::vec3& direction) const;
+
+        // Only reads the body's cached world transform, so is safe across threads once that is up to date
+        static GJKShape FromBody(const RigidBody3D* body);
+        static GJKShape Sphere(const glm::vec3& centre, float radius);
+        static GJKShape Box(const glm::vec3& centre, const glm::vec3& halfExtents, const glm::quat& orientation);
+    };
+
+    struct LUMOS_EXPORT GJKResult
+    {
+        glm::vec3 PointA;
+        glm::vec3 PointB;
+        float Distance = 0.0f; // Zero when the shapes touch or overlap
+        bool Overlap   = false;
+    };
+
+    struct LUMOS_EXPORT GJKContact
+    {
+        glm::vec3 PointA; // Deepest point of a inside b
+        glm::vec3 PointB; // Deepest point of b inside a
+        glm::vec3 Normal; // From a towards b
+        float Depth = 0.0f;
+    };
+
+    // Gilbert-Johnson-Keerthi distance between two convex shapes. Stateless and reentrant
+    class LUMOS_EXPORT GJK
+    {
+    public:
+        static GJKResult Distance(const GJKShape& a, const GJKShape& b);
+        static bool Overlap(const GJKShape& a, const GJKShape& b);
+
+        // Sweeps a along the normalised direction against b using conservative advancement.
+        // The normal points from b towards a, a shape starting inside b hits at zero distance
+        static bool Cast(const GJKShape& a, const glm::vec3& direction, float maxDistance, const GJKShape& b, float& outDistance, glm::vec3& outPoint, glm::vec3& outNormal);
+
+        // Penetration depth and normal of overlapping shapes. Cores that overlap are resolved with the
+        // expanding polytope algorithm, shapes that only overlap by their radii use the closest core points
+        static bool Penetration(const GJKShape& a, const GJKShape& b, GJKContact& outContact);
+
+    private:
+        // Closest points between the cores with a translated by offsetA, returns true if they overlap
+        static bool CoreDistance(const GJKShape& a, const glm::vec3& offsetA, const GJKShape& b, glm::vec3& outPointA, glm::vec3& outPointB, float& outDistance);
+    };
+}
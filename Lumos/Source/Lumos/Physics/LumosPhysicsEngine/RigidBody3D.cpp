@@ -42,6 +42,8 @@ namespace Lumos
         m_Friction   = properties.Friction;
         m_UUID       = UUID();
 
+        m_ContinuousCollision = properties.ContinuousCollision;
+
         if(m_Static)
             m_AtRest = true;
     }
@@ -67,6 +69,18 @@ namespace Lumos
         return m_WSAabb;
     }
 
+    Maths::BoundingBox RigidBody3D::GetSweptAABB(float timeStep)
+    {
+        Maths::BoundingBox box = GetWorldSpaceAABB();
+        if(!m_ContinuousCollision || m_Static || m_AtRest)
+            return box;
+
+        const glm::vec3 motion = m_LinearVelocity * timeStep;
+        box.m_Min += glm::min(motion, glm::vec3(0.0f));
+        box.m_Max += glm::max(motion, glm::vec3(0.0f));
+        return box;
+    }
+
     void RigidBody3D::WakeUp()
     {
         SetIsAtRest(false);
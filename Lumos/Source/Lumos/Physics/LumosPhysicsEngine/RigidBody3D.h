@@ -42,6 +42,7 @@ namespace Lumos
         float Friction            = 0.5f;
         bool AtRest               = false;
         bool isTrigger            = false;
+        bool ContinuousCollision  = false;
         SharedPtr<CollisionShape> Shape;
     };
 
@@ -181,6 +182,13 @@ namespace Lumos
         bool GetIsTrigger() const { return m_Trigger; }
         void SetIsTrigger(bool trigger) { m_Trigger = trigger; }
 
+        // Sweeps the body's motion each step so it can't pass through thin geometry. For fast movers only
+        bool GetContinuousCollision() const { return m_ContinuousCollision; }
+        void SetContinuousCollision(bool enabled) { m_ContinuousCollision = enabled; }
+
+        // World space bounds grown to cover the motion of the next step when continuous collision is on
+        Maths::BoundingBox GetSweptAABB(float timeStep);
+
         float GetAngularFactor() const { return m_AngularFactor; }
         void SetAngularFactor(float factor) { m_AngularFactor = factor; }
 
@@ -206,6 +214,7 @@ namespace Lumos
 
         bool Valid() const { return m_UUID != 0; }
 
+        // Layer index 0-31, matched against the layer masks of scene queries
         uint16_t GetCollisionLayer() const { return m_CollisionLayer; }
         void SetCollisionLayer(u16 layer) { m_CollisionLayer = layer; }
 
@@ -235,7 +244,8 @@ namespace Lumos
         glm::vec3 m_Position;
         float m_InvMass;
         glm::vec3 m_LinearVelocity;
-        bool m_Trigger = false;
+        bool m_Trigger             = false;
+        bool m_ContinuousCollision = false;
         glm::vec3 m_Force;
 
         glm::quat m_Orientation;
@@ -25,6 +25,8 @@ namespace Lumos
 
         ALManager::~ALManager()
         {
+            if(!m_Voices.empty())
+                alDeleteSources(ALsizei(m_Voices.size()), m_Voices.data());
             alcDestroyContext(m_Context);
             alcCloseDevice(m_Device);
         }
@@ -44,6 +46,18 @@ namespace Lumos
             alcMakeContextCurrent(m_Context);
             alDistanceModel(AL_LINEAR_DISTANCE_CLAMPED);
 
+            // Devices can have fewer sources than requested, so the pool stops at the first failure
+            alGetError();
+            for(int i = 0; i < m_NumChannels; i++)
+            {
+                ALuint source = 0;
+                alGenSources(1, &source);
+                if(alGetError() != AL_NO_ERROR)
+                    break;
+                m_Voices.push_back(source);
+            }
+            m_VoiceAllocator.SetVoiceCount(uint32_t(m_Voices.size()));
+
             LUMOS_LOG_INFO("Initialised AudioManager - {0}", alcGetString(m_Device, ALC_DEVICE_SPECIFIER));
             return true;
         }
@@ -61,12 +75,42 @@ namespace Lumos
 
             auto soundsView = registry.view<SoundComponent, Maths::Transform>();
 
+            m_VoiceRequests.clear();
+            m_VoiceNodes.clear();
             for(auto entity : soundsView)
             {
-                auto soundNode = soundsView.get<SoundComponent>(entity).GetSoundNode();
+                auto soundNode = static_cast<ALSoundNode*>(soundsView.get<SoundComponent>(entity).GetSoundNode());
                 soundNode->SetPosition(soundsView.get<Maths::Transform>(entity).GetWorldPosition());
-                soundNode->OnUpdate((float)dt.GetMillis());
+
+                VoiceAllocator::Request request;
+                request.Priority = soundNode->GetPriority();
+                request.Gain     = soundNode->GetIsGlobal() ? soundNode->GetVolume() : VoiceAllocator::AttenuatedGain(m_ListenerPosition, soundNode->GetPosition(), soundNode->GetVolume(), soundNode->GetReferenceDistance(), soundNode->GetRadius(), soundNode->GetRollOffFactor());
+                request.Playing  = soundNode->IsPlaying();
+                request.Voice    = soundNode->GetVoice();
+
+                m_VoiceRequests.push_back(request);
+                m_VoiceNodes.push_back(soundNode);
+            }
+
+            m_VoiceAllocator.Allocate(m_VoiceRequests);
+
+            // Demote before promoting, a promoted node may take a source freed this update
+            for(size_t i = 0; i < m_VoiceNodes.size(); i++)
+            {
+                if(m_VoiceNodes[i]->GetVoice() != m_VoiceRequests[i].Voice)
+                    m_VoiceNodes[i]->ReleaseVoice();
             }
+
+            for(size_t i = 0; i < m_VoiceNodes.size(); i++)
+            {
+                const int32_t voice = m_VoiceRequests[i].Voice;
+                if(voice != VoiceAllocator::VirtualVoice && m_VoiceNodes[i]->GetVoice() != voice)
+                    m_VoiceNodes[i]->AssignVoice(m_Voices[voice], voice);
+            }
+
+            // Virtual nodes only advance their playback position
+            for(auto soundNode : m_VoiceNodes)
+                soundNode->OnUpdate((float)dt.GetMillis());
         }
 
         void ALManager::UpdateListener(Scene* scene)
@@ -87,6 +131,7 @@ namespace Lumos
             {
                 glm::vec3 worldPos = listenerTransform.GetWorldPosition();
                 glm::vec3 velocity = glm::vec3(0.0f); // TODO: m_Listener->GetVelocity();
+                m_ListenerPosition = worldPos;
 
                 ALfloat direction[6];
 
@@ -130,6 +175,22 @@ namespace Lumos
             ImGui::PopItemWidth();
             ImGui::NextColumn();
 
+            ImGui::AlignTextToFramePadding();
+            ImGui::TextUnformatted("Real Voices");
+            ImGui::NextColumn();
+            ImGui::PushItemWidth(-1);
+            ImGui::Text("%u / %u", m_VoiceAllocator.GetRealCount(), m_VoiceAllocator.GetVoiceCount());
+            ImGui::PopItemWidth();
+            ImGui::NextColumn();
+
+            ImGui::AlignTextToFramePadding();
+            ImGui::TextUnformatted("Virtual Voices");
+            ImGui::NextColumn();
+            ImGui::PushItemWidth(-1);
+            ImGui::Text("%u", m_VoiceAllocator.GetVirtualCount());
+            ImGui::PopItemWidth();
+            ImGui::NextColumn();
+
             ImGui::Columns(1);
             ImGui::Separator();
             ImGui::PopStyleVar();
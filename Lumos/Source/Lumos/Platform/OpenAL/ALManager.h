@@ -1,11 +1,14 @@
 
 #include "Audio/AudioManager.h"
+#include "Audio/VoiceAllocator.h"
 
 #include <AL/al.h>
 #include <AL/alc.h>
 
 namespace Lumos
 {
+    class ALSoundNode;
+
     namespace Maths
     {
         class Transform;
@@ -16,7 +19,7 @@ namespace Lumos
         class ALManager : public AudioManager
         {
         public:
-            ALManager(int numChannels = 8);
+            ALManager(int numChannels = 32);
             ~ALManager();
 
             bool OnInit() override;
@@ -30,6 +33,13 @@ namespace Lumos
             ALCdevice* m_Device;
 
             int m_NumChannels = 0;
+
+            // One AL source per real voice, lent to the sound nodes the allocator picks each update
+            std::vector<ALuint> m_Voices;
+            VoiceAllocator m_VoiceAllocator;
+            std::vector<VoiceAllocator::Request> m_VoiceRequests;
+            std::vector<ALSoundNode*> m_VoiceNodes;
+            glm::vec3 m_ListenerPosition = glm::vec3(0.0f);
         };
     }
 }
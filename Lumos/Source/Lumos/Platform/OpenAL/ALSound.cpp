@@ -6,14 +6,41 @@
 
 namespace Lumos
 {
-    ALSound::ALSound(const std::string& fileName, const std::string& format)
-        : m_Format(0)
+    // OGG files longer than this (ms) are decoded while playing by each sound node instead of up front
+    static const double StreamingThreshold = 10000.0;
+
+    ALSound::ALSound(const std::string& fileName, const std::string& format, bool preserveStereo)
+        : m_Buffer(0)
+        , m_Format(0)
     {
-        m_FilePath = fileName;
-        if(format == "wav")
+        m_FilePath       = fileName;
+        m_PreserveStereo = preserveStereo;
+
+        if(format == "ogg")
+        {
+            // The file is read once. Short sounds are decoded from it here, long ones keep it for every
+            // node streaming them to decode from
+            SharedPtr<OggFile> file     = CreateSharedPtr<OggFile>(fileName);
+            UniquePtr<OggStream> stream = CreateUniquePtr<OggStream>();
+            if(stream->Open(file, preserveStereo))
+            {
+                if(stream->GetLength() > StreamingThreshold)
+                {
+                    m_Data.Channels = stream->GetChannels();
+                    m_Data.BitRate  = 16;
+                    m_Data.FreqRate = float(stream->GetSampleRate());
+                    m_Data.Length   = stream->GetLength();
+                    m_File          = file;
+                    m_Stream        = std::move(stream);
+                    m_Streaming     = true;
+                    return;
+                }
+
+                m_Data = stream->ReadAll();
+            }
+        }
+        else if(format == "wav")
             m_Data = LoadWav(fileName);
-        else if(format == "ogg")
-            m_Data = LoadOgg(fileName);
 
         alGenBuffers(1, &m_Buffer);
         alBufferData(m_Buffer, GetOALFormat(m_Data.BitRate, m_Data.Channels), m_Data.Data.data(), m_Data.Size, static_cast<ALsizei>(m_Data.FreqRate));
@@ -21,7 +48,23 @@ namespace Lumos
 
     ALSound::~ALSound()
     {
-        alDeleteBuffers(1, &m_Buffer);
+        if(m_Buffer)
+            alDeleteBuffers(1, &m_Buffer);
+    }
+
+    UniquePtr<OggStream> ALSound::CreateStream()
+    {
+        if(m_Stream)
+            return std::move(m_Stream);
+
+        if(!m_File)
+            return nullptr;
+
+        UniquePtr<OggStream> stream = CreateUniquePtr<OggStream>();
+        if(!stream->Open(m_File, m_PreserveStereo))
+            return nullptr;
+
+        return stream;
     }
 
     ALenum ALSound::GetOALFormat(uint32_t bitRate, uint32_t channels)
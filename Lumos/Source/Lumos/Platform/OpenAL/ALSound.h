@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Audio/Sound.h"
+#include "Audio/OggLoader.h"
 
 #include <AL/al.h>
 
@@ -9,7 +10,7 @@ namespace Lumos
     class ALSound : public Sound
     {
     public:
-        ALSound(const std::string& fileName, const std::string& format);
+        ALSound(const std::string& fileName, const std::string& format, bool preserveStereo = false);
         virtual ~ALSound();
 
         unsigned int GetBuffer() const
@@ -17,9 +18,16 @@ namespace Lumos
             return m_Buffer;
         }
 
-    private:
         static ALenum GetOALFormat(uint32_t bitRate, uint32_t channels);
+
+        // A stream for one node playing a streaming sound. The first node takes the stream opened while
+        // loading, later ones open their own decoder over the same encoded file. Null if it can't be decoded
+        UniquePtr<OggStream> CreateStream();
+
+    private:
         unsigned int m_Buffer;
         int m_Format;
+        SharedPtr<OggFile> m_File;
+        UniquePtr<OggStream> m_Stream;
     };
 }
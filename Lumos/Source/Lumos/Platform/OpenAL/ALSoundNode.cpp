@@ -1,87 +1,271 @@
-#include "Precompiled.h"
-#include "ALSoundNode.h"
-#include "ALSound.h"
-#include "ALManager.h"
-
-#include "Core/Application.h"
-
-#include "Graphics/Camera/Camera.h"
-
-namespace Lumos
-{
-    ALSoundNode::ALSoundNode()
-    {
-        alGenSources(1, &m_Source);
-    }
-
-    ALSoundNode::~ALSoundNode()
-    {
-        alDeleteSources(1, &m_Source);
-    }
-
-    void ALSoundNode::OnUpdate(float msec)
-    {
-        alSourcef(m_Source, AL_GAIN, m_Volume);
-        alSourcef(m_Source, AL_PITCH, m_Pitch);
-        alSourcef(m_Source, AL_MAX_DISTANCE, m_Radius);
-        alSourcef(m_Source, AL_REFERENCE_DISTANCE, m_ReferenceDistance);
-
-        glm::vec3 position;
-        glm::vec3 velocity;
-
-        if(m_IsGlobal)
-        {
-            // position = Application::Get().GetSystem<AudioManager>()->GetListener()->GetPosition();
-        }
-        else
-        {
-            position = GetPosition();
-        }
-
-        if(m_Stationary)
-        {
-            velocity = glm::vec3(0.0f);
-        }
-        else
-        {
-            velocity = m_Velocity;
-        }
-
-        alSourcefv(m_Source, AL_POSITION, reinterpret_cast<float*>(&position));
-        alSourcefv(m_Source, AL_VELOCITY, reinterpret_cast<float*>(&velocity));
-    }
-
-    void ALSoundNode::Pause()
-    {
-        alSourcePause(m_Source);
-        m_Paused = true;
-    }
-
-    void ALSoundNode::Resume()
-    {
-        alSourcePlay(m_Source);
-        m_Paused = false;
-    }
-
-    void ALSoundNode::Stop()
-    {
-        alSourceStop(m_Source);
-    }
-
-    void ALSoundNode::SetSound(SharedPtr<Sound> s)
-    {
-        m_Sound = s;
-        if(m_Sound)
-        {
-            m_TimeLeft = m_Sound->GetLength();
-            alSourcei(m_Source, AL_BUFFER, m_Sound.As<ALSound>()->GetBuffer());
-            alSourcef(m_Source, AL_MAX_DISTANCE, m_Radius);
-            alSourcef(m_Source, AL_ROLLOFF_FACTOR, m_RollOffFactor);
-            alSourcef(m_Source, AL_REFERENCE_DISTANCE, m_ReferenceDistance);
-            alSourcei(m_Source, AL_LOOPING, m_IsLooping ? 1 : 0);
-            alSourcef(m_Source, AL_GAIN, m_Volume);
-            alSourcef(m_Source, AL_PITCH, m_Pitch);
-            // alSourcePlay(m_Source);
-        }
-    }
-}
+#include "Precompiled.h"
+#include "ALSoundNode.h"
+#include "ALSound.h"
+#include "ALManager.h"
+#include "Audio/VoiceAllocator.h"
+
+#include "Core/Application.h"
+
+#include "Graphics/Camera/Camera.h"
+
+namespace Lumos
+{
+    ALSoundNode::ALSoundNode()
+    {
+        alGenBuffers(NUM_STREAM_BUFFERS, m_StreamBuffers);
+        ResetStream();
+    }
+
+    ALSoundNode::~ALSoundNode()
+    {
+        // The decode job has to finish before the buffers go away
+        m_Stream.reset();
+        ReleaseVoice();
+        alDeleteBuffers(NUM_STREAM_BUFFERS, m_StreamBuffers);
+    }
+
+    void ALSoundNode::OnUpdate(float msec)
+    {
+        if(m_Playing && m_Sound)
+        {
+            // Only a virtual node finishes by the clock, a real one waits for its source to stop
+            const double length = m_Sound->GetLength();
+            m_StreamPos += double(msec) * double(m_Pitch);
+            if(m_StreamPos >= length)
+            {
+                if(m_IsLooping && length > 0.0)
+                    m_StreamPos = fmod(m_StreamPos, length);
+                else if(!m_Source)
+                {
+                    m_Playing   = false;
+                    m_StreamPos = 0.0;
+                }
+                else
+                    m_StreamPos = length;
+            }
+        }
+
+        if(!m_Source)
+            return;
+
+        alSourcef(m_Source, AL_GAIN, m_Volume);
+        alSourcef(m_Source, AL_PITCH, m_Pitch);
+        alSourcef(m_Source, AL_MAX_DISTANCE, m_Radius);
+        alSourcef(m_Source, AL_REFERENCE_DISTANCE, m_ReferenceDistance);
+
+        glm::vec3 position;
+        glm::vec3 velocity;
+
+        if(m_IsGlobal)
+        {
+            // position = Application::Get().GetSystem<AudioManager>()->GetListener()->GetPosition();
+        }
+        else
+        {
+            position = GetPosition();
+        }
+
+        if(m_Stationary)
+        {
+            velocity = glm::vec3(0.0f);
+        }
+        else
+        {
+            velocity = m_Velocity;
+        }
+
+        alSourcefv(m_Source, AL_POSITION, reinterpret_cast<float*>(&position));
+        alSourcefv(m_Source, AL_VELOCITY, reinterpret_cast<float*>(&velocity));
+
+        if(m_Stream)
+            UpdateStream();
+        else if(m_Playing)
+        {
+            ALint state = 0;
+            alGetSourcei(m_Source, AL_SOURCE_STATE, &state);
+            if(state == AL_STOPPED)
+            {
+                m_Playing   = false;
+                m_StreamPos = 0.0;
+            }
+        }
+    }
+
+    void ALSoundNode::UpdateStream()
+    {
+        LUMOS_PROFILE_FUNCTION();
+        m_Stream->SetLooping(m_IsLooping);
+
+        ALint processed = 0;
+        alGetSourcei(m_Source, AL_BUFFERS_PROCESSED, &processed);
+        if(processed > 0)
+        {
+            alSourceUnqueueBuffers(m_Source, processed, m_FreeBuffers + m_FreeBufferCount);
+            m_FreeBufferCount += uint32_t(processed);
+        }
+
+        const ALenum format = ALSound::GetOALFormat(16, m_Stream->GetChannels());
+        while(m_FreeBufferCount > 0)
+        {
+            const OggStream::Chunk* chunk = m_Stream->FrontChunk();
+            if(!chunk)
+                break;
+
+            ALuint buffer = m_FreeBuffers[--m_FreeBufferCount];
+            alBufferData(buffer, format, chunk->Samples.data(), ALsizei(chunk->SampleCount * sizeof(int16_t)), ALsizei(m_Stream->GetSampleRate()));
+            alSourceQueueBuffers(m_Source, 1, &buffer);
+            m_Stream->PopChunk();
+        }
+
+        // Decoding runs on a job so the chunks for the next update are ready without blocking this one
+        m_Stream->RequestDecode();
+
+        if(!m_Playing)
+            return;
+
+        ALint state = 0;
+        alGetSourcei(m_Source, AL_SOURCE_STATE, &state);
+        if(state == AL_PLAYING)
+            return;
+
+        ALint queued = 0;
+        alGetSourcei(m_Source, AL_BUFFERS_QUEUED, &queued);
+        if(queued > 0)
+        {
+            // Starting up, or the decoder fell behind and the source ran dry
+            alSourcePlay(m_Source);
+        }
+        else if(m_Stream->IsFinished())
+        {
+            m_Playing   = false;
+            m_StreamPos = 0.0;
+            m_Stream->Rewind();
+        }
+    }
+
+    void ALSoundNode::ResetStream()
+    {
+        for(uint32_t i = 0; i < NUM_STREAM_BUFFERS; i++)
+            m_FreeBuffers[i] = m_StreamBuffers[i];
+        m_FreeBufferCount = NUM_STREAM_BUFFERS;
+    }
+
+    void ALSoundNode::AssignVoice(ALuint source, int32_t voice)
+    {
+        m_Source = source;
+        m_Voice  = voice;
+        BindSource();
+    }
+
+    void ALSoundNode::ReleaseVoice()
+    {
+        if(!m_Source)
+            return;
+
+        ALint state = 0;
+        alGetSourcei(m_Source, AL_SOURCE_STATE, &state);
+        if(!m_Stream && (state == AL_PLAYING || state == AL_PAUSED))
+        {
+            // More accurate than the clock, which drifts with frame timing
+            ALfloat offset = 0.0f;
+            alGetSourcef(m_Source, AL_SEC_OFFSET, &offset);
+            m_StreamPos = double(offset) * 1000.0;
+        }
+
+        // Stopping marks every queued buffer processed, detaching them hands all of them back at once
+        alSourceStop(m_Source);
+        alSourcei(m_Source, AL_BUFFER, 0);
+        ResetStream();
+
+        m_Source = 0;
+        m_Voice  = VoiceAllocator::VirtualVoice;
+    }
+
+    void ALSoundNode::BindSource()
+    {
+        alSourcei(m_Source, AL_BUFFER, 0);
+        alSourcef(m_Source, AL_MAX_DISTANCE, m_Radius);
+        alSourcef(m_Source, AL_ROLLOFF_FACTOR, m_RollOffFactor);
+        alSourcef(m_Source, AL_REFERENCE_DISTANCE, m_ReferenceDistance);
+        alSourcef(m_Source, AL_GAIN, m_Volume);
+        alSourcef(m_Source, AL_PITCH, m_Pitch);
+
+        if(!m_Sound)
+            return;
+
+        if(m_Stream)
+        {
+            // Looping is handled by the decoder, a looping source would replay the queue instead
+            alSourcei(m_Source, AL_LOOPING, 0);
+            ResetStream();
+            m_Stream->Seek(m_StreamPos);
+            m_Stream->RequestDecode();
+        }
+        else
+        {
+            alSourcei(m_Source, AL_BUFFER, m_Sound.As<ALSound>()->GetBuffer());
+            alSourcei(m_Source, AL_LOOPING, m_IsLooping ? 1 : 0);
+            alSourcef(m_Source, AL_SEC_OFFSET, float(m_StreamPos * 0.001));
+            if(m_Playing)
+                alSourcePlay(m_Source);
+        }
+    }
+
+    void ALSoundNode::Pause()
+    {
+        if(m_Source)
+            alSourcePause(m_Source);
+        m_Paused  = true;
+        m_Playing = false;
+    }
+
+    void ALSoundNode::Resume()
+    {
+        m_Paused  = false;
+        m_Playing = m_Sound != nullptr;
+
+        // Streams start from UpdateStream once their first chunks are queued
+        if(m_Source && !m_Stream)
+            alSourcePlay(m_Source);
+    }
+
+    void ALSoundNode::Stop()
+    {
+        m_Playing   = false;
+        m_StreamPos = 0.0;
+
+        if(!m_Source)
+            return;
+
+        alSourceStop(m_Source);
+        if(m_Stream)
+        {
+            alSourcei(m_Source, AL_BUFFER, 0);
+            m_Stream->Rewind();
+            ResetStream();
+        }
+    }
+
+    void ALSoundNode::SetSound(SharedPtr<Sound> s)
+    {
+        m_Sound     = s;
+        m_StreamPos = 0.0;
+        m_Stream.reset();
+
+        if(m_Sound)
+        {
+            m_TimeLeft = m_Sound->GetLength();
+
+            if(m_Sound->IsStreaming())
+            {
+                m_Stream = m_Sound.As<ALSound>()->CreateStream();
+            }
+        }
+
+        if(m_Source)
+        {
+            alSourceStop(m_Source);
+            BindSource();
+        }
+    }
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Audio/SoundNode.h"
+#include "Audio/OggLoader.h"
 
 #include <AL/al.h>
 
@@ -20,8 +21,22 @@ namespace Lumos
         void Stop() override;
         void SetSound(SharedPtr<Sound> s) override;
 
+        // Sources belong to the ALManager's voice pool and are lent to the most audible nodes.
+        // Promotion resumes from the playback position the node kept advancing while virtual
+        void AssignVoice(ALuint source, int32_t voice);
+        void ReleaseVoice();
+
     private:
-        ALuint m_Source;
+        void BindSource();
+        void UpdateStream();
+        void ResetStream();
+
+        ALuint m_Source = 0;
         ALuint m_StreamBuffers[NUM_STREAM_BUFFERS];
+
+        // Streaming sounds decode into m_Stream and cycle its chunks through the queued buffers
+        UniquePtr<OggStream> m_Stream;
+        ALuint m_FreeBuffers[NUM_STREAM_BUFFERS];
+        uint32_t m_FreeBufferCount = 0;
     };
 }
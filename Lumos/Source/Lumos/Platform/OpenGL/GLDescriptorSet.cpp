@@ -3,7 +3,9 @@
 #include "GLShader.h"
 #include "GLTexture.h"
 #include "GLUniformBuffer.h"
+#include "Graphics/RHI/TransientBuffer.h"
 #include "GL.h"
+#include "Maths/MathsUtilities.h"
 namespace Lumos
 {
     namespace Graphics
@@ -15,7 +17,7 @@ namespace Lumos
 
             for(auto& descriptor : m_Descriptors)
             {
-                if(descriptor.type == DescriptorType::UNIFORM_BUFFER)
+                if(descriptor.type == DescriptorType::UNIFORM_BUFFER || descriptor.type == DescriptorType::UNIFORM_BUFFER_DYNAMIC)
                 {
                     auto buffer = SharedPtr<Graphics::UniformBuffer>(Graphics::UniformBuffer::Create());
                     buffer->Init(descriptor.size, nullptr);
@@ -29,8 +31,10 @@ namespace Lumos
                     info.UB           = buffer;
                     info.LocalStorage = localStorage;
                     info.HasUpdated   = false;
+                    info.DirtySize    = 0;
                     info.m_Members    = descriptor.m_Members;
-                    m_UniformBuffers.emplace(descriptor.name, info);
+                    info.Index        = uint32_t(m_UniformBufferList.size());
+                    m_UniformBufferList.push_back(&m_UniformBuffers.emplace(descriptor.name, info).first->second);
 
                     if(descriptor.name != "")
                     {
@@ -50,8 +54,14 @@ namespace Lumos
             {
                 if(bufferInfo.second.HasUpdated)
                 {
-                    bufferInfo.second.UB->SetData(bufferInfo.second.LocalStorage.Data);
+                    auto* buffer = static_cast<GLUniformBuffer*>(bufferInfo.second.UB.get());
+                    if(buffer->GetDynamic())
+                        buffer->SetSubData(bufferInfo.second.DirtySize, 0, bufferInfo.second.LocalStorage.Data);
+                    else
+                        buffer->SetData(bufferInfo.second.LocalStorage.Data);
+
                     bufferInfo.second.HasUpdated = false;
+                    bufferInfo.second.DirtySize  = 0;
                 }
             }
         }
@@ -115,6 +125,7 @@ namespace Lumos
                     {
                         itr->second.LocalStorage.Write(data, member.size, member.offset);
                         itr->second.HasUpdated = true;
+                        itr->second.DirtySize  = Maths::Max(itr->second.DirtySize, member.offset + member.size);
                         return;
                     }
                 }
@@ -134,6 +145,7 @@ namespace Lumos
                     {
                         itr->second.LocalStorage.Write(data, size, member.offset);
                         itr->second.HasUpdated = true;
+                        itr->second.DirtySize  = Maths::Max(itr->second.DirtySize, member.offset + size);
                         return;
                     }
                 }
@@ -142,6 +154,53 @@ namespace Lumos
             LUMOS_LOG_WARN("Uniform not found {0}.{1}", bufferName, uniformName);
         }
 
+        UniformHandle GLDescriptorSet::GetUniformHandle(const std::string& bufferName, const std::string& uniformName)
+        {
+            UniformHandle handle;
+            std::unordered_map<std::string, UniformBufferInfo>::iterator itr = m_UniformBuffers.find(bufferName);
+            if(itr != m_UniformBuffers.end())
+            {
+                for(auto& member : itr->second.m_Members)
+                {
+                    if(member.name == uniformName)
+                    {
+                        handle.BufferIndex = itr->second.Index;
+                        handle.Offset      = member.offset;
+                        handle.Size        = member.size;
+                        return handle;
+                    }
+                }
+            }
+
+            LUMOS_LOG_WARN("Uniform not found {0}.{1}", bufferName, uniformName);
+            return handle;
+        }
+
+        void GLDescriptorSet::SetUniform(const UniformHandle& handle, const void* data)
+        {
+            SetUniform(handle, data, handle.Size);
+        }
+
+        void GLDescriptorSet::SetUniform(const UniformHandle& handle, const void* data, uint32_t size)
+        {
+            if(handle.BufferIndex >= m_UniformBufferList.size())
+            {
+                LUMOS_LOG_WARN("Invalid uniform handle");
+                return;
+            }
+
+            UniformBufferInfo& info = *m_UniformBufferList[handle.BufferIndex];
+            if(handle.Offset + size > info.LocalStorage.GetSize())
+            {
+                LUMOS_LOG_WARN("Uniform write out of bounds {0} + {1} > {2}", handle.Offset, size, info.LocalStorage.GetSize());
+                return;
+            }
+
+            memcpy(info.LocalStorage.Data + handle.Offset, data, size);
+            info.HasUpdated = true;
+            info.DirtySize  = Maths::Max(info.DirtySize, handle.Offset + size);
+        }
+
         void GLDescriptorSet::SetUniformBufferData(const std::string& bufferName, void* data)
         {
             std::unordered_map<std::string, UniformBufferInfo>::iterator itr = m_UniformBuffers.find(bufferName);
@@ -149,12 +208,69 @@ namespace Lumos
             {
                 itr->second.LocalStorage.Write(data, itr->second.LocalStorage.GetSize(), 0);
                 itr->second.HasUpdated = true;
+                itr->second.DirtySize  = itr->second.LocalStorage.GetSize();
                 return;
             }
 
             LUMOS_LOG_WARN("Uniform not found {0}.{1}", bufferName);
         }
 
+        void GLDescriptorSet::SetUniformDynamic(const std::string& bufferName, uint32_t size)
+        {
+            LUMOS_PROFILE_FUNCTION();
+            std::unordered_map<std::string, UniformBufferInfo>::iterator itr = m_UniformBuffers.find(bufferName);
+            if(itr != m_UniformBuffers.end())
+            {
+                itr->second.LocalStorage.Allocate(size);
+                itr->second.LocalStorage.InitialiseEmpty();
+                for(auto& member : itr->second.m_Members)
+                {
+                    member.size = size;
+                }
+
+                // Bound range stays at the reflected block size, the dynamic offset selects the window
+                for(auto& descriptor : m_Descriptors)
+                {
+                    if(descriptor.name == bufferName)
+                    {
+                        itr->second.UB->Init(size, nullptr);
+                        itr->second.UB->SetDynamicData(size, descriptor.size, itr->second.LocalStorage.Data);
+                        break;
+                    }
+                }
+            }
+        }
+
+        void GLDescriptorSet::SetUniformTransient(const UniformHandle& handle, TransientBuffer* buffer, const TransientAllocation& allocation)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            LUMOS_UNUSED(buffer);
+            if(handle.BufferIndex >= m_UniformBufferList.size())
+            {
+                LUMOS_LOG_WARN("Invalid uniform handle");
+                return;
+            }
+
+            // Transient blocks are system memory here, so the allocation is copied into the block's own buffer
+            UniformBufferInfo& info = *m_UniformBufferList[handle.BufferIndex];
+            auto* uniformBuffer     = static_cast<GLUniformBuffer*>(info.UB.get());
+            if(uniformBuffer->GetDynamic() && allocation.Size <= uniformBuffer->GetSize())
+            {
+                uniformBuffer->SetSubData(allocation.Size, 0, allocation.Data);
+                return;
+            }
+
+            for(auto& descriptor : m_Descriptors)
+            {
+                if(descriptor.buffer == uniformBuffer)
+                {
+                    uniformBuffer->Init(allocation.Size, nullptr);
+                    uniformBuffer->SetDynamicData(allocation.Size, descriptor.size, allocation.Data);
+                    break;
+                }
+            }
+        }
+
         Graphics::UniformBuffer* GLDescriptorSet::GetUniformBuffer(const std::string& name)
         {
             LUMOS_PROFILE_FUNCTION();
@@ -215,10 +331,12 @@ namespace Lumos
                     uint8_t* data;
                     uint32_t size;
 
+                    uint32_t bufferOffset = 0;
                     if(buffer->GetDynamic())
                     {
-                        data = reinterpret_cast<uint8_t*>(buffer->GetBuffer()) + offset;
-                        size = buffer->GetTypeSize();
+                        data         = reinterpret_cast<uint8_t*>(buffer->GetBuffer()) + offset;
+                        size         = buffer->GetTypeSize();
+                        bufferOffset = offset;
                     }
                     else
                     {
@@ -238,7 +356,7 @@ namespace Lumos
                         // if(buffer->GetDynamic())
                         {
                             LUMOS_PROFILE_SCOPE("glBindBufferRange");
-                            GLCall(glBindBufferRange(GL_UNIFORM_BUFFER, slot, bufferHandle, offset, size));
+                            GLCall(glBindBufferRange(GL_UNIFORM_BUFFER, slot, bufferHandle, bufferOffset, size));
                         }
 
                         //                        if(descriptor.name != "")
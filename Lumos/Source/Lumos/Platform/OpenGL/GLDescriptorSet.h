@@ -23,6 +23,11 @@ namespace Lumos
             void SetUniform(const std::string& bufferName, const std::string& uniformName, void* data) override;
             void SetUniform(const std::string& bufferName, const std::string& uniformName, void* data, uint32_t size) override;
             void SetUniformBufferData(const std::string& bufferName, void* data) override;
+            UniformHandle GetUniformHandle(const std::string& bufferName, const std::string& uniformName) override;
+            void SetUniform(const UniformHandle& handle, const void* data) override;
+            void SetUniform(const UniformHandle& handle, const void* data, uint32_t size) override;
+            void SetUniformDynamic(const std::string& bufferName, uint32_t size) override;
+            void SetUniformTransient(const UniformHandle& handle, TransientBuffer* buffer, const TransientAllocation& allocation) override;
 
             Graphics::UniformBuffer* GetUniformBuffer(const std::string& name) override;
             void Bind(uint32_t offset = 0);
@@ -47,8 +52,11 @@ namespace Lumos
                 Vector<BufferMemberInfo> m_Members;
                 Buffer LocalStorage;
                 bool HasUpdated;
+                uint32_t DirtySize;
+                uint32_t Index = 0;
             };
             std::unordered_map<std::string, UniformBufferInfo> m_UniformBuffers;
+            std::vector<UniformBufferInfo*> m_UniformBufferList; // Indexed by UniformHandle::BufferIndex
         };
     }
 }
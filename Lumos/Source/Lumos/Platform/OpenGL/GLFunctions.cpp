@@ -13,6 +13,7 @@
 #include "GLShader.h"
 #include "GLSwapChain.h"
 #include "GLTexture.h"
+#include "GLTransientBuffer.h"
 #include "GLUniformBuffer.h"
 #include "GLVertexBuffer.h"
 
@@ -34,6 +35,7 @@ void Lumos::Graphics::GL::MakeDefault()
     GLTextureCube::MakeDefault();
     GLTextureDepth::MakeDefault();
     GLTextureDepthArray::MakeDefault();
+    GLTransientBuffer::MakeDefault();
     GLUniformBuffer::MakeDefault();
     GLVertexBuffer::MakeDefault();
 }
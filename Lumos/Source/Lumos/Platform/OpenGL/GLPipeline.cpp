@@ -42,6 +42,21 @@ namespace Lumos
             case RHIFormat::R8_UInt:
                 GLCall(glVertexAttribPointer(index, 1, GL_UNSIGNED_BYTE, false, stride, (const void*)(intptr_t)(offset)));
                 break;
+            case RHIFormat::R8G8B8A8_Unorm:
+                GLCall(glVertexAttribPointer(index, 4, GL_UNSIGNED_BYTE, true, stride, (const void*)(intptr_t)(offset)));
+                break;
+            case RHIFormat::R8G8B8A8_UInt:
+                GLCall(glVertexAttribIPointer(index, 4, GL_UNSIGNED_BYTE, stride, (const void*)(intptr_t)(offset)));
+                break;
+            case RHIFormat::R16G16_Float:
+                GLCall(glVertexAttribPointer(index, 2, GL_HALF_FLOAT, false, stride, (const void*)(intptr_t)(offset)));
+                break;
+            case RHIFormat::R16G16B16A16_Unorm:
+                GLCall(glVertexAttribPointer(index, 4, GL_UNSIGNED_SHORT, true, stride, (const void*)(intptr_t)(offset)));
+                break;
+            case RHIFormat::R16G16B16A16_Snorm:
+                GLCall(glVertexAttribPointer(index, 4, GL_SHORT, true, stride, (const void*)(intptr_t)(offset)));
+                break;
             case RHIFormat::R32_UInt:
                 GLCall(glVertexAttribPointer(index, 1, GL_UNSIGNED_INT, false, stride, (const void*)(intptr_t)(offset)));
                 break;
@@ -87,14 +102,16 @@ namespace Lumos
         void GLPipeline::BindVertexArray()
         {
             GLCall(glBindVertexArray(m_VertexArray));
-            auto& vertexLayout = ((GLShader*)m_Shader)->GetBufferLayout().GetLayout();
-            uint32_t count     = 0;
+            // Meshes with a non default vertex format override the layout reflected from the shader
+            const BufferLayout& bufferLayout = m_Description.vertexLayout ? *m_Description.vertexLayout : ((GLShader*)m_Shader)->GetBufferLayout();
+            auto& vertexLayout               = bufferLayout.GetLayout();
+            uint32_t count                   = 0;
 
             for(auto& layout : vertexLayout)
             {
                 GLCall(glEnableVertexAttribArray(count));
                 size_t offset = static_cast<size_t>(layout.offset);
-                VertexAtrribPointer(layout.format, count, offset, ((GLShader*)m_Shader)->GetBufferLayout().GetStride());
+                VertexAtrribPointer(layout.format, count, offset, bufferLayout.GetStride());
                 count++;
             }
         }
@@ -239,7 +239,7 @@ namespace Lumos
             // GLCall(glDrawElements(GLUtilities::DrawTypeToGL(type), count, GLUtilities::DataTypeToGL(dataType), indices));
         }
 
-        void GLRenderer::DrawIndexedInternal(CommandBuffer* commandBuffer, const DrawType type, uint32_t count, uint32_t start) const
+        void GLRenderer::DrawIndexedInternal(CommandBuffer* commandBuffer, const DrawType type, uint32_t count, uint32_t start, uint32_t instanceCount) const
         {
             LUMOS_PROFILE_FUNCTION();
 
@@ -254,7 +254,10 @@ namespace Lumos
             }
 
             Engine::Get().Statistics().NumDrawCalls++;
-            GLCall(glDrawElements(GLUtilities::DrawTypeToGL(type), count, GLUtilities::DataTypeToGL(DataType::UNSIGNED_INT), nullptr));
+            if(instanceCount > 1)
+                GLCall(glDrawElementsInstanced(GLUtilities::DrawTypeToGL(type), count, GLUtilities::DataTypeToGL(DataType::UNSIGNED_INT), nullptr, instanceCount));
+            else
+                GLCall(glDrawElements(GLUtilities::DrawTypeToGL(type), count, GLUtilities::DataTypeToGL(DataType::UNSIGNED_INT), nullptr));
             // GLCall(glDrawArrays(GLTools::DrawTypeToGL(type), start, count));
         }
 
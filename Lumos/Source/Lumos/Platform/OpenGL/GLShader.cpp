@@ -80,7 +80,7 @@ namespace Lumos
             m_Name = StringUtilities::GetFileName(filePath);
             m_Path = StringUtilities::GetFileLocation(filePath);
 
-            m_Source = FileSystem::Get().ReadTextFile(filePath);
+            m_Source = FileSystem::Get().ReadTextFileVFS(filePath);
 
             Init();
         }
@@ -161,9 +161,19 @@ namespace Lumos
 
             for(auto& file : *sources)
             {
-                auto fileSize    = FileSystem::GetFileSize(m_Path + file.second); // TODO: once process
-                uint32_t* source = reinterpret_cast<uint32_t*>(FileSystem::ReadFile(m_Path + file.second));
+                int64_t fileSize = 0;
+                uint32_t* source = reinterpret_cast<uint32_t*>(FileSystem::Get().ReadFileVFS(m_Path + file.second, &fileSize));
+
+                // Left without a program so IsCompiled() reports the failure
+                if(!source)
+                {
+                    LUMOS_LOG_ERROR("Failed to load shader {0} - {1}", m_Name, file.second);
+                    delete sources;
+                    return;
+                }
+
                 LoadFromData(source, uint32_t(fileSize), file.first, *sources);
+                delete[] source;
             }
 
             for(auto& source : *sources)
@@ -445,8 +455,7 @@ namespace Lumos
                             file.erase(j, rem.length());
                         file = StringUtilities::StringReplace(file, '\"');
                         LUMOS_LOG_WARN("Including file \'{0}\' into shader.", file);
-                        FileSystem::Get().ReadTextFile(file);
-                        ReadShaderFile(StringUtilities::GetLines(FileSystem::Get().ReadTextFile(file)), shaders);
+                        ReadShaderFile(StringUtilities::GetLines(FileSystem::Get().ReadTextFileVFS(file)), shaders);
                     }
                 }
                 else if(StringUtilities::StartsWith(str, "#if"))
@@ -846,7 +855,7 @@ namespace Lumos
                 descriptor.name       = uniform_buffer.name;
                 descriptor.offset     = 0;
                 descriptor.shaderType = type;
-                descriptor.type       = Graphics::DescriptorType::UNIFORM_BUFFER;
+                descriptor.type       = GetUniformBufferType(uniform_buffer.name);
                 descriptor.buffer     = nullptr;
 
                 for(int i = 0; i < memberCount; i++)
@@ -942,7 +951,7 @@ namespace Lumos
                         if(i > 0)
                             descriptor.binding = descriptor.binding + imageCount[i - 1];
                     }
-                    else if(descriptor.type == DescriptorType::UNIFORM_BUFFER)
+                    else if(descriptor.type == DescriptorType::UNIFORM_BUFFER || descriptor.type == DescriptorType::UNIFORM_BUFFER_DYNAMIC)
                     {
                         bufferCount[i]++;
 
@@ -971,9 +980,8 @@ namespace Lumos
 
         Shader* GLShader::CreateFuncGL(const std::string& filePath)
         {
-            std::string physicalPath;
-            Lumos::FileSystem::Get().ResolvePhysicalPath(filePath, physicalPath);
-            GLShader* result = new GLShader(physicalPath);
+            // Read through the VFS, so the path is kept as given
+            GLShader* result = new GLShader(filePath);
             return result;
         }
 
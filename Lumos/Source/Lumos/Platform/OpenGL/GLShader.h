@@ -57,6 +57,11 @@ namespace Lumos
                 return m_ShaderTypes;
             }
 
+            bool IsCompiled() const override
+            {
+                return m_Handle != 0;
+            }
+
             static uint32_t CompileShader(ShaderType type, std::string source, uint32_t program, GLShaderErrorInfo& info);
             static uint32_t Compile(std::map<ShaderType, std::string>* sources, GLShaderErrorInfo& info);
             static void PreProcess(const std::string& source, std::map<ShaderType, std::string>* sources);
@@ -131,7 +136,7 @@ namespace Lumos
             uint64_t GetHash() const override { return m_Hash; }
 
         private:
-            uint32_t m_Handle;
+            uint32_t m_Handle = 0;
             std::string m_Name, m_Path;
             std::string m_Source;
 
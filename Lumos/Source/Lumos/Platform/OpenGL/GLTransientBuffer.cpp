@@ -0,0 +1,109 @@
+#include "Precompiled.h"
+#include "GLTransientBuffer.h"
+#include "GLPipeline.h"
+#include "GLRenderer.h"
+#include "Maths/MathsUtilities.h"
+
+#include "GL.h"
+
+namespace Lumos
+{
+    namespace Graphics
+    {
+        GLTransientBuffer::GLTransientBuffer(uint32_t blockSize)
+            : m_BlockSize(blockSize)
+        {
+            LUMOS_PROFILE_FUNCTION();
+            GLCall(glGenBuffers(1, &m_Handle));
+        }
+
+        GLTransientBuffer::~GLTransientBuffer()
+        {
+            LUMOS_PROFILE_FUNCTION();
+            for(auto& block : m_Blocks)
+                delete[] block.Data;
+
+            GLCall(glDeleteBuffers(1, &m_Handle));
+        }
+
+        void GLTransientBuffer::BeginFrame(uint32_t frameIndex)
+        {
+            LUMOS_UNUSED(frameIndex);
+            m_CurrentBlock  = 0;
+            m_Cursor        = 0;
+            m_AllocatedSize = 0;
+        }
+
+        TransientAllocation GLTransientBuffer::Allocate(uint32_t size, uint32_t alignment)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            alignment       = alignment ? alignment : 1;
+            uint32_t offset = (m_Cursor + alignment - 1) / alignment * alignment;
+
+            while(m_CurrentBlock < m_Blocks.size() && offset + size > m_Blocks[m_CurrentBlock].Size)
+            {
+                m_CurrentBlock++;
+                offset = 0;
+            }
+
+            if(m_CurrentBlock == m_Blocks.size())
+            {
+                Block block;
+                block.Size = Maths::Max(m_BlockSize, size);
+                block.Data = new uint8_t[block.Size];
+                m_Blocks.push_back(block);
+            }
+
+            TransientAllocation allocation;
+            allocation.Data   = m_Blocks[m_CurrentBlock].Data + offset;
+            allocation.Offset = offset;
+            allocation.Size   = size;
+            allocation.Block  = m_CurrentBlock;
+
+            m_Cursor = offset + size;
+            m_AllocatedSize += size;
+            return allocation;
+        }
+
+        void GLTransientBuffer::Shrink(TransientAllocation& allocation, uint32_t usedSize)
+        {
+            if(usedSize >= allocation.Size)
+                return;
+
+            if(allocation.Block == m_CurrentBlock && allocation.Offset + allocation.Size == m_Cursor)
+            {
+                m_Cursor = allocation.Offset + usedSize;
+                m_AllocatedSize -= allocation.Size - usedSize;
+            }
+
+            allocation.Size = usedSize;
+        }
+
+        void GLTransientBuffer::BindVertexBuffer(CommandBuffer* commandBuffer, Pipeline* pipeline, const TransientAllocation& allocation, uint8_t binding)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            LUMOS_UNUSED(commandBuffer);
+            LUMOS_UNUSED(binding);
+            if(allocation.Size == 0)
+                return;
+
+            // Orphan and refill the stream buffer so the driver doesn't stall on the previous draw
+            GLCall(glBindBuffer(GL_ARRAY_BUFFER, m_Handle));
+            GLCall(glBufferData(GL_ARRAY_BUFFER, allocation.Size, allocation.Data, GL_STREAM_DRAW));
+            GLRenderer::Instance()->GetBoundVertexBuffer() = m_Handle;
+
+            if(pipeline)
+                ((GLPipeline*)pipeline)->BindVertexArray();
+        }
+
+        void GLTransientBuffer::MakeDefault()
+        {
+            CreateFunc = CreateFuncGL;
+        }
+
+        TransientBuffer* GLTransientBuffer::CreateFuncGL(uint32_t blockSize)
+        {
+            return new GLTransientBuffer(blockSize);
+        }
+    }
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Graphics/RHI/TransientBuffer.h"
+#include "GLDebug.h"
+
+namespace Lumos
+{
+    namespace Graphics
+    {
+        // GL copies the data on upload, so the blocks live in system memory and are reused every frame
+        class GLTransientBuffer : public TransientBuffer
+        {
+        public:
+            explicit GLTransientBuffer(uint32_t blockSize);
+            ~GLTransientBuffer();
+
+            void BeginFrame(uint32_t frameIndex) override;
+            TransientAllocation Allocate(uint32_t size, uint32_t alignment = 16) override;
+            void BindVertexBuffer(CommandBuffer* commandBuffer, Pipeline* pipeline, const TransientAllocation& allocation, uint8_t binding = 0) override;
+            uint32_t GetAllocatedSize() const override { return m_AllocatedSize; }
+            void Shrink(TransientAllocation& allocation, uint32_t usedSize) override;
+
+            static void MakeDefault();
+
+        protected:
+            static TransientBuffer* CreateFuncGL(uint32_t blockSize);
+
+        private:
+            struct Block
+            {
+                uint8_t* Data = nullptr;
+                uint32_t Size = 0;
+            };
+
+            std::vector<Block> m_Blocks;
+            uint32_t m_Handle        = 0;
+            uint32_t m_BlockSize     = 0;
+            uint32_t m_CurrentBlock  = 0;
+            uint32_t m_Cursor        = 0;
+            uint32_t m_AllocatedSize = 0;
+        };
+    }
+}
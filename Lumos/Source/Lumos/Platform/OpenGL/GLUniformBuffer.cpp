@@ -85,6 +85,13 @@ namespace Lumos
             }
         }
 
+        void GLUniformBuffer::SetSubData(uint32_t size, uint32_t offset, const void* data)
+        {
+            LUMOS_PROFILE_FUNCTION();
+            glBindBuffer(GL_UNIFORM_BUFFER, m_Handle);
+            glBufferSubData(GL_UNIFORM_BUFFER, offset, size, data);
+        }
+
         void GLUniformBuffer::Bind(uint32_t slot, GLShader* shader, std::string& name)
         {
             LUMOS_PROFILE_FUNCTION();
@@ -18,6 +18,7 @@ namespace Lumos
             void SetDynamicData(uint32_t size, uint32_t typeSize, const void* data) override;
 
             void SetData(const void* data) override { SetData(m_Size, data); }
+            void SetSubData(uint32_t size, uint32_t offset, const void* data);
 
             void Bind(uint32_t slot, GLShader* shader, std::string& name);
 
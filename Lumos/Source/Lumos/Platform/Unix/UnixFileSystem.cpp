@@ -6,6 +6,7 @@
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <sys/mman.h>
 #include <iostream>
 
 namespace Lumos
@@ -28,6 +29,57 @@ namespace Lumos
             return true;
     }
 
+    FileView::~FileView()
+    {
+        Close();
+    }
+
+    bool FileView::Open(const std::string& path)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        Close();
+
+        int fd = open(path.c_str(), O_RDONLY);
+        if(fd < 0)
+            return false;
+
+        struct stat info;
+        if(fstat(fd, &info) != 0)
+        {
+            close(fd);
+            return false;
+        }
+
+        // mmap can't map zero bytes, an empty file is still a valid empty view
+        m_Size = uint64_t(info.st_size);
+        if(m_Size > 0)
+        {
+            void* data = mmap(nullptr, size_t(m_Size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if(data == MAP_FAILED)
+            {
+                close(fd);
+                m_Size = 0;
+                return false;
+            }
+            m_Data = static_cast<const uint8_t*>(data);
+        }
+
+        // The mapping keeps its own reference to the file
+        close(fd);
+        m_Open = true;
+        return true;
+    }
+
+    void FileView::Close()
+    {
+        if(m_Data)
+            munmap(const_cast<uint8_t*>(m_Data), size_t(m_Size));
+
+        m_Data = nullptr;
+        m_Size = 0;
+        m_Open = false;
+    }
+
     bool FileSystem::FileExists(const std::string& path)
     {
         struct stat buffer;
@@ -52,11 +104,10 @@ namespace Lumos
 
     bool FileSystem::ReadFile(const std::string& path, void* buffer, int64_t size)
     {
-        if(!FileExists(path))
+        if(!FileExists(path) || !buffer)
             return false;
         if(size < 0)
             size = GetFileSize(path);
-        buffer      = new uint8_t[size + 1];
         FILE* file  = fopen(path.c_str(), FileSystem::GetFileOpenModeString(FileOpenFlags::READ));
         bool result = false;
         if(file)
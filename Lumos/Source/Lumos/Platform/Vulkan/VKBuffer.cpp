@@ -38,6 +38,9 @@ namespace Lumos
             LUMOS_PROFILE_FUNCTION();
             if(m_Buffer)
             {
+                // Persistently mapped buffers have to be unmapped before the allocation is freed
+                UnMap();
+
                 DeletionQueue& currentDeletionQueue = VKRenderer::GetCurrentDeletionQueue();
 
                 auto buffer = m_Buffer;
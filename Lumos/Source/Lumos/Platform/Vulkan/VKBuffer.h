@@ -19,6 +19,7 @@ namespace Lumos
             const VkBuffer& GetBuffer() const { return m_Buffer; }
 
             const VkDescriptorBufferInfo& GetBufferInfo() const { return m_DesciptorBufferInfo; };
+            void* GetMappedData() const { return m_Mapped; }
 
             void Map(VkDeviceSize size = VK_WHOLE_SIZE, VkDeviceSize offset = 0);
             void UnMap();
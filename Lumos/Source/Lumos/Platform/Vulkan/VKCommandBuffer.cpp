@@ -47,8 +47,15 @@ namespace Lumos
         bool VKCommandBuffer::Init(bool primary)
         {
             LUMOS_PROFILE_FUNCTION_LOW();
-            m_Primary     = primary;
-            m_CommandPool = VKDevice::Get().GetCommandPool()->GetHandle();
+            m_Primary = primary;
+
+            if(primary)
+                m_CommandPool = VKDevice::Get().GetCommandPool()->GetHandle();
+            else
+            {
+                m_OwnedCommandPool = CreateSharedPtr<VKCommandPool>(VKDevice::Get().GetPhysicalDevice()->GetGraphicsQueueFamilyIndex(), VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+                m_CommandPool      = m_OwnedCommandPool->GetHandle();
+            }
 
             VkCommandBufferAllocateInfo cmdBufferCreateInfo = VKInitialisers::CommandBufferAllocateInfo(m_CommandPool, primary ? VK_COMMAND_BUFFER_LEVEL_PRIMARY : VK_COMMAND_BUFFER_LEVEL_SECONDARY, 1);
 
@@ -82,12 +89,14 @@ namespace Lumos
             LUMOS_PROFILE_FUNCTION_LOW();
             VKUtilities::WaitIdle();
 
-            if(m_State == CommandBufferState::Submitted)
+            // Secondary buffers are never submitted with their own fence
+            if(m_Primary && m_State == CommandBufferState::Submitted)
                 Wait();
 
             m_Fence     = nullptr;
             m_Semaphore = nullptr;
             vkFreeCommandBuffers(VKDevice::Get().GetDevice(), m_CommandPool, 1, &m_CommandBuffer);
+            m_OwnedCommandPool = nullptr;
         }
 
         void VKCommandBuffer::BeginRecording()
@@ -105,7 +114,8 @@ namespace Lumos
         {
             LUMOS_PROFILE_FUNCTION_LOW();
             LUMOS_ASSERT(!m_Primary, "BeginRecordingSecondary() called from a primary command buffer!");
-            m_State = CommandBufferState::Recording;
+            m_State         = CommandBufferState::Recording;
+            m_BoundPipeline = nullptr;
 
             VkCommandBufferInheritanceInfo inheritanceInfo = VKInitialisers::CommandBufferInheritanceInfo();
             inheritanceInfo.subpass                        = 0;
@@ -130,7 +140,9 @@ namespace Lumos
             m_BoundPipeline = nullptr;
 #if LUMOS_PROFILE
 #if LUMOS_PROFILE_GPU_TIMINGS
-            TracyVkCollect(VKDevice::Get().GetTracyContext(), m_CommandBuffer);
+            // Collecting resets queries, which secondary buffers inside a render pass can't do
+            if(m_Primary)
+                TracyVkCollect(VKDevice::Get().GetTracyContext(), m_CommandBuffer);
 #endif
 #endif
 
@@ -225,6 +237,19 @@ namespace Lumos
             m_BoundRenderPass = nullptr;
         }
 
+        void VKCommandBuffer::BeginSecondaryRenderPass(Pipeline* pipeline, uint32_t layer)
+        {
+            LUMOS_PROFILE_FUNCTION();
+            LUMOS_ASSERT(m_Primary, "BeginSecondaryRenderPass() called from a secondary command buffer!");
+
+            if(m_BoundPipeline)
+                m_BoundPipeline->End(this);
+
+            m_BoundPipeline      = pipeline;
+            m_BoundPipelineLayer = layer;
+            static_cast<VKPipeline*>(pipeline)->BeginRenderPass(this, layer, Graphics::SECONDARY);
+        }
+
         void VKCommandBuffer::BeginRenderPass(RenderPass* renderpass, float* clearColour, Framebuffer* framebuffer, uint32_t width, uint32_t height)
         {
             LUMOS_PROFILE_FUNCTION();
@@ -19,6 +19,7 @@ namespace Lumos
         class RenderPass;
         class Pipeline;
         class VKSemaphore;
+        class VKCommandPool;
 
         class VKCommandBuffer : public CommandBuffer
         {
@@ -43,6 +44,7 @@ namespace Lumos
             void BindPipeline(Pipeline* pipeline, uint32_t layer) override;
             void UnBindPipeline() override;
             void EndCurrentRenderPass() override;
+            void BeginSecondaryRenderPass(Pipeline* pipeline, uint32_t layer) override;
 
             void BeginRenderPass(RenderPass* renderpass, float* clearColour, Framebuffer* framebuffer, uint32_t width, uint32_t height);
 
@@ -53,6 +55,7 @@ namespace Lumos
 
             VkCommandBuffer GetHandle() const { return m_CommandBuffer; };
             CommandBufferState GetState() const { return m_State; }
+            bool IsPrimary() const { return m_Primary; }
 
             VkSemaphore GetSemaphore() const;
 
@@ -69,6 +72,9 @@ namespace Lumos
             SharedPtr<VKFence> m_Fence;
             SharedPtr<VKSemaphore> m_Semaphore;
 
+            // Secondary buffers own their pool so each can be recorded on a different thread
+            SharedPtr<VKCommandPool> m_OwnedCommandPool;
+
             uint32_t m_BoundPipelineLayer = 0;
             Pipeline* m_BoundPipeline     = nullptr;
 
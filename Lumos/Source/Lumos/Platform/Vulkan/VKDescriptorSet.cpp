@@ -7,6 +7,8 @@
 #include "VKDevice.h"
 #include "VKRenderer.h"
 #include "VKShader.h"
+#include "VKTransientBuffer.h"
+#include "Maths/MathsUtilities.h"
 
 namespace Lumos
 {
@@ -23,8 +25,11 @@ namespace Lumos
 
             for(auto& descriptor : m_Descriptors.descriptors)
             {
-                if(descriptor.type == DescriptorType::UNIFORM_BUFFER)
+                if(descriptor.type == DescriptorType::UNIFORM_BUFFER || descriptor.type == DescriptorType::UNIFORM_BUFFER_DYNAMIC)
                 {
+                    if(descriptor.type == DescriptorType::UNIFORM_BUFFER_DYNAMIC)
+                        m_Dynamic = true;
+
                     for(uint32_t frame = 0; frame < m_FramesInFlight; frame++)
                     {
                         // Uniform Buffer per frame in flight
@@ -42,8 +47,19 @@ namespace Lumos
                     info.HasUpdated[0]                    = false;
                     info.HasUpdated[1]                    = false;
                     info.HasUpdated[2]                    = false;
+                    info.DirtySize[0]                     = 0;
+                    info.DirtySize[1]                     = 0;
+                    info.DirtySize[2]                     = 0;
+                    info.TransientBuffer[0]               = VK_NULL_HANDLE;
+                    info.TransientBuffer[1]               = VK_NULL_HANDLE;
+                    info.TransientBuffer[2]               = VK_NULL_HANDLE;
+                    info.TransientOffset[0]               = 0;
+                    info.TransientOffset[1]               = 0;
+                    info.TransientOffset[2]               = 0;
                     info.m_Members                        = descriptor.m_Members;
+                    info.Index                            = uint32_t(m_UniformBufferList.size());
                     m_UniformBuffersData[descriptor.name] = info;
+                    m_UniformBufferList.push_back(&m_UniformBuffersData[descriptor.name]);
                 }
             }
 
@@ -127,7 +143,6 @@ namespace Lumos
         void VKDescriptorSet::Update(CommandBuffer* cmdBuffer)
         {
             LUMOS_PROFILE_FUNCTION_LOW();
-            m_Dynamic                 = false;
             int descriptorWritesCount = 0;
             uint32_t currentFrame     = Renderer::GetMainSwapChain()->GetCurrentBufferIndex();
 
@@ -135,8 +150,10 @@ namespace Lumos
             {
                 if(bufferInfo.second.HasUpdated[currentFrame])
                 {
-                    m_UniformBuffers[currentFrame][bufferInfo.first]->SetData(bufferInfo.second.LocalStorage.Data);
+                    // Only upload up to the furthest byte written since this frame's buffer was last updated
+                    m_UniformBuffers[currentFrame][bufferInfo.first]->SetData(bufferInfo.second.DirtySize[currentFrame], bufferInfo.second.LocalStorage.Data);
                     bufferInfo.second.HasUpdated[currentFrame] = false;
+                    bufferInfo.second.DirtySize[currentFrame]  = 0;
                 }
             }
 
@@ -221,13 +238,20 @@ namespace Lumos
                         descriptorWritesCount++;
                     }
 
-                    else if(imageInfo.type == DescriptorType::UNIFORM_BUFFER)
+                    else if(imageInfo.type == DescriptorType::UNIFORM_BUFFER || imageInfo.type == DescriptorType::UNIFORM_BUFFER_DYNAMIC)
                     {
                         VKUniformBuffer* vkUniformBuffer = m_UniformBuffers[currentFrame][imageInfo.name].As<VKUniformBuffer>().get();
                         bufferInfos[index].buffer        = *vkUniformBuffer->GetBuffer();
                         bufferInfos[index].offset        = imageInfo.offset;
                         bufferInfos[index].range         = imageInfo.size;
 
+                        const UniformBufferInfo& info = m_UniformBuffersData[imageInfo.name];
+                        if(info.TransientBuffer[currentFrame] != VK_NULL_HANDLE)
+                        {
+                            bufferInfos[index].buffer = info.TransientBuffer[currentFrame];
+                            bufferInfos[index].offset = info.TransientOffset[currentFrame];
+                        }
+
                         VkWriteDescriptorSet writeDescriptorSet = {};
                         writeDescriptorSet.sType                = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
                         writeDescriptorSet.dstSet               = m_DescriptorSet[currentFrame];
@@ -332,10 +356,7 @@ namespace Lumos
             std::map<std::string, UniformBufferInfo>::iterator itr = m_UniformBuffersData.find(name);
             if(itr != m_UniformBuffersData.end())
             {
-                itr->second.HasUpdated[0] = true;
-                itr->second.HasUpdated[1] = true;
-                itr->second.HasUpdated[2] = true;
-
+                MarkUpdated(itr->second, itr->second.LocalStorage.GetSize());
                 return &itr->second.LocalStorage;
             }
 
@@ -370,10 +391,7 @@ namespace Lumos
                     if(member.name == uniformName)
                     {
                         itr->second.LocalStorage.Write(data, member.size, member.offset);
-
-                        itr->second.HasUpdated[0] = true;
-                        itr->second.HasUpdated[1] = true;
-                        itr->second.HasUpdated[2] = true;
+                        MarkUpdated(itr->second, member.offset + member.size);
                         return;
                     }
                 }
@@ -394,9 +412,7 @@ namespace Lumos
                     if(member.name == uniformName)
                     {
                         itr->second.LocalStorage.Write(data, size, member.offset);
-                        itr->second.HasUpdated[0] = true;
-                        itr->second.HasUpdated[1] = true;
-                        itr->second.HasUpdated[2] = true;
+                        MarkUpdated(itr->second, member.offset + size);
                         return;
                     }
                 }
@@ -405,6 +421,53 @@ namespace Lumos
             LUMOS_LOG_WARN("Uniform not found {0}.{1}", bufferName, uniformName);
         }
 
+        UniformHandle VKDescriptorSet::GetUniformHandle(const std::string& bufferName, const std::string& uniformName)
+        {
+            LUMOS_PROFILE_FUNCTION();
+            UniformHandle handle;
+            std::map<std::string, UniformBufferInfo>::iterator itr = m_UniformBuffersData.find(bufferName);
+            if(itr != m_UniformBuffersData.end())
+            {
+                for(auto& member : itr->second.m_Members)
+                {
+                    if(member.name == uniformName)
+                    {
+                        handle.BufferIndex = itr->second.Index;
+                        handle.Offset      = member.offset;
+                        handle.Size        = member.size;
+                        return handle;
+                    }
+                }
+            }
+
+            LUMOS_LOG_WARN("Uniform not found {0}.{1}", bufferName, uniformName);
+            return handle;
+        }
+
+        void VKDescriptorSet::SetUniform(const UniformHandle& handle, const void* data)
+        {
+            SetUniform(handle, data, handle.Size);
+        }
+
+        void VKDescriptorSet::SetUniform(const UniformHandle& handle, const void* data, uint32_t size)
+        {
+            if(handle.BufferIndex >= m_UniformBufferList.size())
+            {
+                LUMOS_LOG_WARN("Invalid uniform handle");
+                return;
+            }
+
+            UniformBufferInfo& info = *m_UniformBufferList[handle.BufferIndex];
+            if(handle.Offset + size > info.LocalStorage.GetSize())
+            {
+                LUMOS_LOG_WARN("Uniform write out of bounds {0} + {1} > {2}", handle.Offset, size, info.LocalStorage.GetSize());
+                return;
+            }
+
+            memcpy(info.LocalStorage.Data + handle.Offset, data, size);
+            MarkUpdated(info, handle.Offset + size);
+        }
+
         void VKDescriptorSet::SetUniformBufferData(const std::string& bufferName, void* data)
         {
             LUMOS_PROFILE_FUNCTION();
@@ -413,9 +476,7 @@ namespace Lumos
             if(itr != m_UniformBuffersData.end())
             {
                 itr->second.LocalStorage.Write(data, itr->second.LocalStorage.GetSize(), 0);
-                itr->second.HasUpdated[0] = true;
-                itr->second.HasUpdated[1] = true;
-                itr->second.HasUpdated[2] = true;
+                MarkUpdated(itr->second, itr->second.LocalStorage.GetSize());
                 return;
             }
 
@@ -424,14 +485,57 @@ namespace Lumos
 
         void VKDescriptorSet::SetUniformDynamic(const std::string& bufferName, uint32_t size)
         {
+            LUMOS_PROFILE_FUNCTION();
             std::map<std::string, UniformBufferInfo>::iterator itr = m_UniformBuffersData.find(bufferName);
             if(itr != m_UniformBuffersData.end())
             {
                 itr->second.LocalStorage.Allocate(size);
+                itr->second.LocalStorage.InitialiseEmpty();
                 for(auto& member : itr->second.m_Members)
                 {
                     member.size = size;
                 }
+
+                // The descriptor range stays at the reflected block size, the dynamic offset selects the window
+                for(uint32_t frame = 0; frame < m_FramesInFlight; frame++)
+                {
+                    auto buffer = SharedPtr<Graphics::UniformBuffer>(Graphics::UniformBuffer::Create());
+                    buffer->Init(size, nullptr);
+                    m_UniformBuffers[frame][bufferName] = buffer;
+                    m_DescriptorDirty[frame]            = true;
+                }
+            }
+        }
+
+        void VKDescriptorSet::SetUniformTransient(const UniformHandle& handle, TransientBuffer* buffer, const TransientAllocation& allocation)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            if(handle.BufferIndex >= m_UniformBufferList.size())
+            {
+                LUMOS_LOG_WARN("Invalid uniform handle");
+                return;
+            }
+
+            VKBuffer* blockBuffer = static_cast<VKTransientBuffer*>(buffer)->GetBlockBuffer(allocation);
+            blockBuffer->Flush(allocation.Size, allocation.Offset);
+
+            // The descriptor is only rewritten when the allocation moves, steady frames land on the same offset
+            uint32_t currentFrame   = Renderer::GetMainSwapChain()->GetCurrentBufferIndex();
+            UniformBufferInfo& info = *m_UniformBufferList[handle.BufferIndex];
+            if(info.TransientBuffer[currentFrame] != blockBuffer->GetBuffer() || info.TransientOffset[currentFrame] != allocation.Offset)
+            {
+                info.TransientBuffer[currentFrame] = blockBuffer->GetBuffer();
+                info.TransientOffset[currentFrame] = allocation.Offset;
+                m_DescriptorDirty[currentFrame]    = true;
+            }
+        }
+
+        void VKDescriptorSet::MarkUpdated(UniformBufferInfo& info, uint32_t writeEnd)
+        {
+            for(uint32_t frame = 0; frame < MAX_FRAMES_FLIGHT; frame++)
+            {
+                info.HasUpdated[frame] = true;
+                info.DirtySize[frame]  = Maths::Max(info.DirtySize[frame], writeEnd);
             }
         }
     }
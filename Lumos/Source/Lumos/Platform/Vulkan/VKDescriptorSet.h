@@ -27,6 +27,9 @@ namespace Lumos
             void SetUniform(const std::string& bufferName, const std::string& uniformName, void* data) override;
             void SetUniform(const std::string& bufferName, const std::string& uniformName, void* data, uint32_t size) override;
             void SetUniformBufferData(const std::string& bufferName, void* data) override;
+            UniformHandle GetUniformHandle(const std::string& bufferName, const std::string& uniformName) override;
+            void SetUniform(const UniformHandle& handle, const void* data) override;
+            void SetUniform(const UniformHandle& handle, const void* data, uint32_t size) override;
             void TransitionImages(CommandBuffer* commandBuffer) override;
 
             Buffer* GetUniformBufferLocalData(const std::string& name) override;
@@ -37,6 +40,7 @@ namespace Lumos
             uint32_t GetDynamicOffset() const override { return m_DynamicOffset; }
             bool GetHasUpdated(uint32_t frame) { return m_DescriptorUpdated[frame]; }
             void SetUniformDynamic(const std::string& bufferName, uint32_t size) override;
+            void SetUniformTransient(const UniformHandle& handle, TransientBuffer* buffer, const TransientAllocation& allocation) override;
 
             static void MakeDefault();
 
@@ -56,13 +60,20 @@ namespace Lumos
             {
                 Vector<BufferMemberInfo> m_Members;
                 Buffer LocalStorage;
+                uint32_t Index = 0;
 
                 // Per frame in flight
                 bool HasUpdated[MAX_FRAMES_FLIGHT];
+                uint32_t DirtySize[MAX_FRAMES_FLIGHT];
+                VkBuffer TransientBuffer[MAX_FRAMES_FLIGHT];
+                uint32_t TransientOffset[MAX_FRAMES_FLIGHT];
             };
 
+            void MarkUpdated(UniformBufferInfo& info, uint32_t writeEnd);
+
             DescriptorSetInfo m_Descriptors;
             std::map<std::string, UniformBufferInfo> m_UniformBuffersData;
+            std::vector<UniformBufferInfo*> m_UniformBufferList; // Indexed by UniformHandle::BufferIndex
 
             std::map<std::string, SharedPtr<UniformBuffer>> m_UniformBuffers[MAX_FRAMES_FLIGHT];
             VkDescriptorSet m_DescriptorSet[MAX_FRAMES_FLIGHT];
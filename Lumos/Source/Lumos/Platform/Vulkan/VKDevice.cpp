@@ -176,6 +176,8 @@ namespace Lumos
             caps.MaxTextureUnits              = m_PhysicalDeviceProperties.limits.maxDescriptorSetSamplers;
             caps.UniformBufferOffsetAlignment = int(m_PhysicalDeviceProperties.limits.minUniformBufferOffsetAlignment);
             caps.SupportCompute               = false; // true; //Need to sort descriptor set management first
+            caps.SecondaryCommandBuffers      = true;
+            caps.TextureLayerCopy             = true;
 
             uint32_t queueFamilyCount;
             vkGetPhysicalDeviceQueueFamilyProperties(m_Handle, &queueFamilyCount, nullptr);
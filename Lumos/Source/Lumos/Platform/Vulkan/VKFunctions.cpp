@@ -13,6 +13,7 @@
 #include "VKShader.h"
 #include "VKSwapChain.h"
 #include "VKTexture.h"
+#include "VKTransientBuffer.h"
 #include "VKUniformBuffer.h"
 #include "VKVertexBuffer.h"
 
@@ -34,6 +35,7 @@ void Lumos::Graphics::Vulkan::MakeDefault()
     VKTextureCube::MakeDefault();
     VKTextureDepth::MakeDefault();
     VKTextureDepthArray::MakeDefault();
+    VKTransientBuffer::MakeDefault();
     VKUniformBuffer::MakeDefault();
     VKVertexBuffer::MakeDefault();
 }
@@ -9,6 +9,7 @@
 #include "VKTexture.h"
 #include "VKUtilities.h"
 #include "Graphics/RHI/DescriptorSet.h"
+#include "Graphics/RHI/BufferLayout.h"
 #include "VKInitialisers.h"
 #include "Core/Engine.h"
 
@@ -67,6 +68,22 @@ namespace Lumos
 
                 uint32_t stride = m_Shader.As<VKShader>()->GetVertexInputStride();
 
+                // Meshes with a non default vertex format override the layout reflected from the shader
+                if(pipelineDesc.vertexLayout)
+                {
+                    stride = pipelineDesc.vertexLayout->GetStride();
+
+                    uint32_t location = 0;
+                    for(auto& element : pipelineDesc.vertexLayout->GetLayout())
+                    {
+                        VkVertexInputAttributeDescription& description = vertexInputDescription.emplace_back();
+                        description.binding                            = 0;
+                        description.location                           = location++;
+                        description.offset                             = element.offset;
+                        description.format                             = VKUtilities::FormatToVK(element.format);
+                    }
+                }
+
                 // Vertex layout
                 VkVertexInputBindingDescription vertexBindingDescription;
 
@@ -74,10 +91,10 @@ namespace Lumos
                 {
                     vertexBindingDescription.binding   = 0;
                     vertexBindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
-                    vertexBindingDescription.stride    = m_Shader.As<VKShader>()->GetVertexInputStride();
+                    vertexBindingDescription.stride    = stride;
                 }
 
-                const std::vector<VkVertexInputAttributeDescription>& vertexInputAttributeDescription = m_Shader.As<VKShader>()->GetVertexInputAttributeDescription();
+                const std::vector<VkVertexInputAttributeDescription>& vertexInputAttributeDescription = pipelineDesc.vertexLayout ? vertexInputDescription : m_Shader.As<VKShader>()->GetVertexInputAttributeDescription();
 
                 VkPipelineVertexInputStateCreateInfo vi {};
                 vi.sType                           = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
@@ -270,32 +287,39 @@ namespace Lumos
             return true;
         }
 
+        Framebuffer* VKPipeline::GetFramebuffer(uint32_t layer) const
+        {
+            if(m_Framebuffers.empty())
+                return nullptr;
+
+            if(m_Description.swapchainTarget)
+                return m_Framebuffers[Renderer::GetMainSwapChain()->GetCurrentImageIndex()].get();
+            else if(m_Description.depthArrayTarget || m_Description.cubeMapTarget)
+                return m_Framebuffers[layer].get();
+
+            return m_Framebuffers[0].get();
+        }
+
+        void VKPipeline::BeginRenderPass(CommandBuffer* commandBuffer, uint32_t layer, SubPassContents contents)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            TransitionAttachments();
+            m_RenderPass->BeginRenderPass(commandBuffer, m_Description.clearColour, GetFramebuffer(layer), contents, GetWidth(), GetHeight());
+        }
+
         void VKPipeline::Bind(CommandBuffer* commandBuffer, uint32_t layer)
         {
             LUMOS_PROFILE_FUNCTION_LOW();
-            Engine::Get().Statistics().BoundPipelines++;
 
-            VKFramebuffer* framebuffer;
+            // Secondary buffers run inside a render pass the primary already began
+            const bool primary = static_cast<VKCommandBuffer*>(commandBuffer)->IsPrimary();
+            if(primary)
+                Engine::Get().Statistics().BoundPipelines++;
 
             if(!m_Compute)
             {
-                TransitionAttachments();
-
-                if(m_Description.swapchainTarget)
-                {
-                    framebuffer = m_Framebuffers[Renderer::GetMainSwapChain()->GetCurrentImageIndex()];
-                }
-                else if(m_Description.depthArrayTarget || m_Description.cubeMapTarget)
-                {
-                    framebuffer = m_Framebuffers[layer];
-                }
-                else
-                {
-                    framebuffer = m_Framebuffers[0];
-                }
-
-                //((VKCommandBuffer*)commandBuffer)->BeginRenderPass(m_RenderPass, m_Description.clearColour, framebuffer, GetWidth(), GetHeight());
-                m_RenderPass->BeginRenderPass(commandBuffer, m_Description.clearColour, framebuffer, Graphics::INLINE, GetWidth(), GetHeight());
+                if(primary)
+                    BeginRenderPass(commandBuffer, layer, Graphics::INLINE);
             }
             else
             {
@@ -434,7 +458,7 @@ namespace Lumos
         void VKPipeline::End(CommandBuffer* commandBuffer)
         {
             LUMOS_PROFILE_FUNCTION();
-            if(!m_Compute)
+            if(!m_Compute && static_cast<VKCommandBuffer*>(commandBuffer)->IsPrimary())
             {
                 m_RenderPass->EndRenderPass(commandBuffer);
             }
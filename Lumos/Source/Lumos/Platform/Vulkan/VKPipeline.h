@@ -22,6 +22,10 @@ namespace Lumos
             bool Init(const PipelineDesc& pipelineDesc);
             void Bind(CommandBuffer* commandBuffer, uint32_t layer) override;
             void End(CommandBuffer* commandBuffer) override;
+            void BeginRenderPass(CommandBuffer* commandBuffer, uint32_t layer, SubPassContents contents);
+
+            RenderPass* GetRenderPass() const override { return m_RenderPass.get(); }
+            Framebuffer* GetFramebuffer(uint32_t layer) const override;
 
             const VkPipelineLayout& GetPipelineLayout() const
             {
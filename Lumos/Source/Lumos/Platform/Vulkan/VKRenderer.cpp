@@ -92,6 +92,80 @@ namespace Lumos
             }
         }
 
+        void VKRenderer::ClearRenderTargetLayer(Graphics::Texture* texture, uint32_t layer, Graphics::CommandBuffer* commandBuffer)
+        {
+            LUMOS_PROFILE_FUNCTION();
+            if(texture->GetType() != TextureType::DEPTHARRAY)
+            {
+                LUMOS_LOG_WARN("Layer clears are only supported for depth array textures");
+                return;
+            }
+
+            VKTextureDepthArray* depthArray = static_cast<VKTextureDepthArray*>(texture);
+            VkImageLayout layout            = depthArray->GetImageLayout();
+
+            VkImageSubresourceRange subresourceRange = {};
+            subresourceRange.aspectMask              = VK_IMAGE_ASPECT_DEPTH_BIT;
+            subresourceRange.baseMipLevel            = 0;
+            subresourceRange.levelCount              = 1;
+            subresourceRange.baseArrayLayer          = layer;
+            subresourceRange.layerCount              = 1;
+
+            if(VKUtilities::HasStencilComponent(depthArray->GetVKFormat()))
+                subresourceRange.aspectMask |= VK_IMAGE_ASPECT_STENCIL_BIT;
+
+            VkClearDepthStencilValue clear_depth_stencil = { 1.0f, 1 };
+
+            depthArray->TransitionImage(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, (VKCommandBuffer*)commandBuffer);
+            vkCmdClearDepthStencilImage(((VKCommandBuffer*)commandBuffer)->GetHandle(), depthArray->GetImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &clear_depth_stencil, 1, &subresourceRange);
+            depthArray->TransitionImage(layout, (VKCommandBuffer*)commandBuffer);
+        }
+
+        bool VKRenderer::CopyTextureLayer(Graphics::Texture* source, Graphics::Texture* destination, uint32_t layer, Graphics::CommandBuffer* commandBuffer)
+        {
+            LUMOS_PROFILE_FUNCTION();
+            if(source->GetType() != TextureType::DEPTHARRAY || destination->GetType() != TextureType::DEPTHARRAY)
+            {
+                LUMOS_LOG_WARN("Layer copies are only supported between depth array textures");
+                return false;
+            }
+
+            VKTextureDepthArray* src = static_cast<VKTextureDepthArray*>(source);
+            VKTextureDepthArray* dst = static_cast<VKTextureDepthArray*>(destination);
+
+            if(src->GetWidth(0) != dst->GetWidth(0) || src->GetHeight(0) != dst->GetHeight(0) || src->GetVKFormat() != dst->GetVKFormat())
+            {
+                LUMOS_LOG_WARN("Layer copy between textures with different sizes or formats");
+                return false;
+            }
+
+            VkImageLayout srcLayout = src->GetImageLayout();
+            VkImageLayout dstLayout = dst->GetImageLayout();
+
+            src->TransitionImage(VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, (VKCommandBuffer*)commandBuffer);
+            dst->TransitionImage(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, (VKCommandBuffer*)commandBuffer);
+
+            VkImageCopy region                   = {};
+            region.srcSubresource.aspectMask     = VK_IMAGE_ASPECT_DEPTH_BIT;
+            region.srcSubresource.mipLevel       = 0;
+            region.srcSubresource.baseArrayLayer = layer;
+            region.srcSubresource.layerCount     = 1;
+            region.dstSubresource                = region.srcSubresource;
+            region.extent                        = { src->GetWidth(0), src->GetHeight(0), 1 };
+
+            if(VKUtilities::HasStencilComponent(src->GetVKFormat()))
+            {
+                region.srcSubresource.aspectMask |= VK_IMAGE_ASPECT_STENCIL_BIT;
+                region.dstSubresource.aspectMask |= VK_IMAGE_ASPECT_STENCIL_BIT;
+            }
+
+            vkCmdCopyImage(((VKCommandBuffer*)commandBuffer)->GetHandle(), src->GetImage(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, dst->GetImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+            src->TransitionImage(srcLayout, (VKCommandBuffer*)commandBuffer);
+            dst->TransitionImage(dstLayout, (VKCommandBuffer*)commandBuffer);
+            return true;
+        }
+
         void VKRenderer::ClearSwapChainImage() const
         {
             LUMOS_PROFILE_FUNCTION_LOW();
@@ -424,11 +498,13 @@ file.close();
             vkCmdBindDescriptorSets(static_cast<Graphics::VKCommandBuffer*>(commandBuffer)->GetHandle(), static_cast<Graphics::VKPipeline*>(pipeline)->IsCompute() ? VK_PIPELINE_BIND_POINT_COMPUTE : VK_PIPELINE_BIND_POINT_GRAPHICS, static_cast<Graphics::VKPipeline*>(pipeline)->GetPipelineLayout(), 0, numDescriptorSets, lCurrentDescriptorSets, numDynamicDescriptorSets, &dynamicOffset);
         }
 
-        void VKRenderer::DrawIndexedInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t start) const
+        void VKRenderer::DrawIndexedInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t start, uint32_t instanceCount) const
         {
             LUMOS_PROFILE_FUNCTION_LOW();
-            Engine::Get().Statistics().NumDrawCalls++;
-            vkCmdDrawIndexed(static_cast<VKCommandBuffer*>(commandBuffer)->GetHandle(), count, 1, 0, 0, 0);
+            // Secondary buffers are recorded on worker threads, their draws are counted by the caller
+            if(static_cast<VKCommandBuffer*>(commandBuffer)->IsPrimary())
+                Engine::Get().Statistics().NumDrawCalls++;
+            vkCmdDrawIndexed(static_cast<VKCommandBuffer*>(commandBuffer)->GetHandle(), count, instanceCount, 0, 0, 0);
         }
 
         void VKRenderer::DrawInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, DataType datayType, void* indices) const
@@ -48,6 +48,8 @@ namespace Lumos
             void PresentInternal(CommandBuffer* commandBuffer) override;
 
             void ClearRenderTarget(Graphics::Texture* texture, Graphics::CommandBuffer* commandBuffer, glm::vec4 clearColour) override;
+            void ClearRenderTargetLayer(Graphics::Texture* texture, uint32_t layer, Graphics::CommandBuffer* commandBuffer) override;
+            bool CopyTextureLayer(Graphics::Texture* source, Graphics::Texture* destination, uint32_t layer, Graphics::CommandBuffer* commandBuffer) override;
             void ClearSwapChainImage() const;
 
             void SaveScreenshot(const std::string& path, Graphics::Texture* texture = nullptr) override;
@@ -55,7 +57,7 @@ namespace Lumos
             const std::string& GetTitleInternal() const override;
 
             void BindDescriptorSetsInternal(Graphics::Pipeline* pipeline, Graphics::CommandBuffer* commandBuffer, uint32_t dynamicOffset, Graphics::DescriptorSet** descriptorSets, uint32_t descriptorCount) override;
-            void DrawIndexedInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t start) const override;
+            void DrawIndexedInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, uint32_t start, uint32_t instanceCount) const override;
             void DrawInternal(CommandBuffer* commandBuffer, DrawType type, uint32_t count, DataType datayType, void* indices) const override;
             void DrawSplashScreen(Texture* texture) override;
             uint32_t GetGPUCount() const override;
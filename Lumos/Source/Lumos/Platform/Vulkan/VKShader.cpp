@@ -388,7 +388,7 @@ namespace Lumos
         {
             m_Name     = StringUtilities::GetFileName(filePath);
             m_FilePath = StringUtilities::GetFileLocation(filePath);
-            m_Source   = FileSystem::Get().ReadTextFile(filePath);
+            m_Source   = FileSystem::Get().ReadTextFileVFS(filePath);
 
             if(m_Source.empty())
             {
@@ -467,27 +467,37 @@ namespace Lumos
             LUMOS_LOG_INFO("Loading Shader : {0}", m_Name);
 
             uint32_t currentShaderStage = 0;
+            bool missingStage           = false;
             HashCombine(m_Hash, m_Name);
 
             for(auto& file : files)
             {
                 HashCombine(m_Hash, m_FilePath + file.second);
 
-                uint32_t fileSize = uint32_t(FileSystem::GetFileSize(m_FilePath + file.second));
-                uint32_t* source  = reinterpret_cast<uint32_t*>(FileSystem::ReadFile(m_FilePath + file.second));
+                int64_t fileSize = 0;
+                uint32_t* source = reinterpret_cast<uint32_t*>(FileSystem::Get().ReadFileVFS(m_FilePath + file.second, &fileSize));
 
                 if(source)
                 {
-                    LoadFromData(source, fileSize, file.first, currentShaderStage);
+                    LoadFromData(source, uint32_t(fileSize), file.first, currentShaderStage);
 
                     currentShaderStage++;
                     delete[] source;
                 }
+                else
+                {
+                    LUMOS_LOG_ERROR("Failed to load shader {0} - {1}", m_Name, file.second);
+                    missingStage = true;
+                }
             }
 
             if(files.empty())
                 LUMOS_LOG_ERROR("Failed to load shader {0}", m_Name);
 
+            // A pipeline can't be built with a stage missing
+            if(files.empty() || missingStage)
+                m_Compiled = false;
+
             CreatePipelineLayout();
 
             return true;
@@ -641,8 +651,10 @@ namespace Lumos
                 uint32_t binding = comp.get_decoration(u.id, spv::DecorationBinding);
                 auto& type       = comp.get_type(u.type_id);
 
+                auto descriptorType = GetUniformBufferType(u.name);
+
                 SHADER_LOG(LUMOS_LOG_INFO("Found UBO {0} at set = {1}, binding = {2}", u.name.c_str(), set, binding));
-                m_DescriptorLayoutInfo.push_back({ Graphics::DescriptorType::UNIFORM_BUFFER, shaderType, binding, set, type.array.size() ? uint32_t(type.array[0]) : 1 });
+                m_DescriptorLayoutInfo.push_back({ descriptorType, shaderType, binding, set, type.array.size() ? uint32_t(type.array[0]) : 1 });
 
                 auto& bufferType      = comp.get_type(u.base_type_id);
                 auto bufferSize       = comp.get_declared_struct_size(bufferType);
@@ -654,7 +666,7 @@ namespace Lumos
                 descriptor.name       = u.name;
                 descriptor.offset     = 0;
                 descriptor.shaderType = shaderType;
-                descriptor.type       = Graphics::DescriptorType::UNIFORM_BUFFER;
+                descriptor.type       = descriptorType;
                 descriptor.buffer     = nullptr;
 
                 for(int i = 0; i < memberCount; i++)
@@ -809,6 +821,16 @@ namespace Lumos
             }
         }
 
+        void VKShader::BindPushConstantData(Graphics::CommandBuffer* commandBuffer, Graphics::Pipeline* pipeline, uint32_t index, const uint8_t* data)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            if(index >= m_PushConstants.size())
+                return;
+
+            auto& pc = m_PushConstants[index];
+            vkCmdPushConstants(static_cast<Graphics::VKCommandBuffer*>(commandBuffer)->GetHandle(), static_cast<Graphics::VKPipeline*>(pipeline)->GetPipelineLayout(), VKUtilities::ShaderTypeToVK(pc.shaderStage), 0, pc.size, data);
+        }
+
         VkPipelineShaderStageCreateInfo* VKShader::GetShaderStages() const
         {
             return m_ShaderStages;
@@ -893,9 +915,8 @@ namespace Lumos
 
         Shader* VKShader::CreateFuncVulkan(const std::string& filepath)
         {
-            std::string physicalPath;
-            Lumos::FileSystem::Get().ResolvePhysicalPath(filepath, physicalPath, false);
-            return new VKShader(physicalPath);
+            // Read through the VFS, so the path is kept as given
+            return new VKShader(filepath);
         }
 
         Shader* VKShader::CreateFromEmbeddedFuncVulkan(const uint32_t* vertData, uint32_t vertDataSize, const uint32_t* fragData, uint32_t fragDataSize)
@@ -0,0 +1,107 @@
+#include "Precompiled.h"
+#include "VKTransientBuffer.h"
+#include "VKCommandBuffer.h"
+#include "Maths/MathsUtilities.h"
+
+namespace Lumos
+{
+    namespace Graphics
+    {
+        VKTransientBuffer::VKTransientBuffer(uint32_t blockSize)
+            : m_BlockSize(blockSize)
+        {
+        }
+
+        VKTransientBuffer::~VKTransientBuffer()
+        {
+            for(auto& blocks : m_Blocks)
+            {
+                for(auto& block : blocks)
+                    delete block.Buffer;
+            }
+        }
+
+        void VKTransientBuffer::BeginFrame(uint32_t frameIndex)
+        {
+            LUMOS_ASSERT(frameIndex < MAX_FRAMES_FLIGHT, "Frame index out of range");
+            m_Frame         = frameIndex;
+            m_CurrentBlock  = 0;
+            m_Cursor        = 0;
+            m_AllocatedSize = 0;
+        }
+
+        TransientAllocation VKTransientBuffer::Allocate(uint32_t size, uint32_t alignment)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            auto& blocks    = m_Blocks[m_Frame];
+            alignment       = alignment ? alignment : 1;
+            uint32_t offset = (m_Cursor + alignment - 1) / alignment * alignment;
+
+            // Move on to the next block once this one is full, earlier blocks may still be referenced this frame
+            while(m_CurrentBlock < blocks.size() && offset + size > blocks[m_CurrentBlock].Size)
+            {
+                m_CurrentBlock++;
+                offset = 0;
+            }
+
+            if(m_CurrentBlock == blocks.size())
+            {
+                Block block;
+                block.Size   = Maths::Max(m_BlockSize, size);
+                block.Buffer = new VKBuffer(VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+                                            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, block.Size, nullptr);
+                block.Buffer->Map();
+                block.Data = static_cast<uint8_t*>(block.Buffer->GetMappedData());
+                blocks.push_back(block);
+            }
+
+            TransientAllocation allocation;
+            allocation.Data   = blocks[m_CurrentBlock].Data + offset;
+            allocation.Offset = offset;
+            allocation.Size   = size;
+            allocation.Block  = m_CurrentBlock;
+
+            m_Cursor = offset + size;
+            m_AllocatedSize += size;
+            return allocation;
+        }
+
+        void VKTransientBuffer::Shrink(TransientAllocation& allocation, uint32_t usedSize)
+        {
+            if(usedSize >= allocation.Size)
+                return;
+
+            if(allocation.Block == m_CurrentBlock && allocation.Offset + allocation.Size == m_Cursor)
+            {
+                m_Cursor = allocation.Offset + usedSize;
+                m_AllocatedSize -= allocation.Size - usedSize;
+            }
+
+            allocation.Size = usedSize;
+        }
+
+        void VKTransientBuffer::BindVertexBuffer(CommandBuffer* commandBuffer, Pipeline* pipeline, const TransientAllocation& allocation, uint8_t binding)
+        {
+            LUMOS_PROFILE_FUNCTION_LOW();
+            if(!commandBuffer || allocation.Size == 0)
+                return;
+
+            // Only needed when the allocator could not give us coherent memory
+            VKBuffer* buffer = m_Blocks[m_Frame][allocation.Block].Buffer;
+            buffer->Flush(allocation.Size, allocation.Offset);
+
+            VkDeviceSize offsets[1] = { allocation.Offset };
+            vkCmdBindVertexBuffers(static_cast<VKCommandBuffer*>(commandBuffer)->GetHandle(), binding, 1, &buffer->GetBuffer(), offsets);
+        }
+
+        void VKTransientBuffer::MakeDefault()
+        {
+            CreateFunc = CreateFuncVulkan;
+        }
+
+        TransientBuffer* VKTransientBuffer::CreateFuncVulkan(uint32_t blockSize)
+        {
+            return new VKTransientBuffer(blockSize);
+        }
+    }
+}
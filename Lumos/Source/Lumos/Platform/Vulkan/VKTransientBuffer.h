@@ -0,0 +1,46 @@
+#pragma once
+
+#include "VKBuffer.h"
+#include "Graphics/RHI/TransientBuffer.h"
+#include "Graphics/RHI/SwapChain.h"
+
+namespace Lumos
+{
+    namespace Graphics
+    {
+        class VKTransientBuffer : public TransientBuffer
+        {
+        public:
+            explicit VKTransientBuffer(uint32_t blockSize);
+            ~VKTransientBuffer();
+
+            void BeginFrame(uint32_t frameIndex) override;
+            TransientAllocation Allocate(uint32_t size, uint32_t alignment = 16) override;
+            void BindVertexBuffer(CommandBuffer* commandBuffer, Pipeline* pipeline, const TransientAllocation& allocation, uint8_t binding = 0) override;
+            uint32_t GetAllocatedSize() const override { return m_AllocatedSize; }
+            void Shrink(TransientAllocation& allocation, uint32_t usedSize) override;
+
+            VKBuffer* GetBlockBuffer(const TransientAllocation& allocation) const { return m_Blocks[m_Frame][allocation.Block].Buffer; }
+
+            static void MakeDefault();
+
+        protected:
+            static TransientBuffer* CreateFuncVulkan(uint32_t blockSize);
+
+        private:
+            struct Block
+            {
+                VKBuffer* Buffer = nullptr;
+                uint8_t* Data    = nullptr;
+                uint32_t Size    = 0;
+            };
+
+            std::vector<Block> m_Blocks[MAX_FRAMES_FLIGHT];
+            uint32_t m_BlockSize     = 0;
+            uint32_t m_Frame         = 0;
+            uint32_t m_CurrentBlock  = 0;
+            uint32_t m_Cursor        = 0;
+            uint32_t m_AllocatedSize = 0;
+        };
+    }
+}
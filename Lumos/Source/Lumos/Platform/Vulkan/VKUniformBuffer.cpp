@@ -30,17 +30,18 @@ namespace Lumos
 
         void VKUniformBuffer::SetData(uint32_t size, const void* data)
         {
-            VKBuffer::Map();
+            // Stays mapped for the lifetime of the buffer, VKBuffer::Destroy unmaps it
+            if(!m_Mapped)
+                VKBuffer::Map();
             memcpy(m_Mapped, data, static_cast<size_t>(size));
-            VKBuffer::UnMap();
         }
 
         void VKUniformBuffer::SetDynamicData(uint32_t size, uint32_t typeSize, const void* data)
         {
-            VKBuffer::Map();
+            if(!m_Mapped)
+                VKBuffer::Map();
             memcpy(m_Mapped, data, size);
             VKBuffer::Flush(size);
-            VKBuffer::UnMap();
         }
 
         void VKUniformBuffer::MakeDefault()
@@ -677,6 +677,12 @@ namespace Lumos
                     return VK_FORMAT_R8G8B8A8_UNORM;
                 case RHIFormat::R8G8B8A8_Unorm:
                     return VK_FORMAT_R8G8B8A8_UNORM;
+                case RHIFormat::R8G8B8A8_UInt:
+                    return VK_FORMAT_R8G8B8A8_UINT;
+                case RHIFormat::R16G16B16A16_Unorm:
+                    return VK_FORMAT_R16G16B16A16_UNORM;
+                case RHIFormat::R16G16B16A16_Snorm:
+                    return VK_FORMAT_R16G16B16A16_SNORM;
                 case RHIFormat::R11G11B10_Float:
                     return VK_FORMAT_B10G11R11_UFLOAT_PACK32;
                 case RHIFormat::R10G10B10A2_Unorm:
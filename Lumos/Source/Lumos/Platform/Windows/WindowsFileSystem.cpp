@@ -31,6 +31,57 @@ namespace Lumos
         return ReadFileEx(file, buffer, static_cast<DWORD>(size), &ol, nullptr) != 0;
     }
 
+    FileView::~FileView()
+    {
+        Close();
+    }
+
+    bool FileView::Open(const std::string& path)
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        Close();
+
+        HANDLE file = CreateFile(WindowsUtilities::StringToWString(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+        if(file == INVALID_HANDLE_VALUE)
+            return false;
+
+        m_File = file;
+        m_Size = uint64_t(GetFileSizeInternal(file));
+
+        // Zero length files can't be mapped, an empty file is still a valid empty view
+        if(m_Size > 0)
+        {
+            m_Mapping = CreateFileMapping(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if(m_Mapping)
+                m_Data = static_cast<const uint8_t*>(MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0));
+
+            if(!m_Data)
+            {
+                Close();
+                return false;
+            }
+        }
+
+        m_Open = true;
+        return true;
+    }
+
+    void FileView::Close()
+    {
+        if(m_Data)
+            UnmapViewOfFile(m_Data);
+        if(m_Mapping)
+            CloseHandle(m_Mapping);
+        if(m_File)
+            CloseHandle(m_File);
+
+        m_Data    = nullptr;
+        m_Mapping = nullptr;
+        m_File    = nullptr;
+        m_Size    = 0;
+        m_Open    = false;
+    }
+
     bool FileSystem::FileExists(const std::string& path)
     {
         DWORD dwAttrib = GetFileAttributes(WindowsUtilities::StringToWString(path).c_str());
@@ -56,16 +107,20 @@ namespace Lumos
 
     bool FileSystem::ReadFile(const std::string& path, void* buffer, int64_t size)
     {
+        if(!buffer)
+            return false;
+
         std::ifstream stream(path, std::ios::binary | std::ios::ate);
+        if(!stream)
+            return false;
 
         auto end = stream.tellg();
         stream.seekg(0, std::ios::beg);
-        size   = end - stream.tellg();
-        buffer = new char[size];
+        if(size < 0)
+            size = end - stream.tellg();
         stream.read((char*)buffer, size);
-        stream.close();
 
-        return buffer;
+        return stream.gcount() == size;
     }
 
     uint8_t* FileSystem::ReadFile(const std::string& path)
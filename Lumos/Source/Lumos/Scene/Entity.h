@@ -126,7 +126,8 @@ namespace Lumos
         void SetActive(bool isActive)
         {
             LUMOS_PROFILE_FUNCTION_LOW();
-            GetOrAddComponent<ActiveComponent>().active = isActive;
+            // Replaced rather than edited in place so listeners see the change
+            m_Scene->GetRegistry().emplace_or_replace<ActiveComponent>(m_EntityHandle, isActive);
         }
 
         Maths::Transform& GetTransform()
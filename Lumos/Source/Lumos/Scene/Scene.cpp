@@ -34,6 +34,7 @@
 #include "Scene/Component/SoundComponent.h"
 #include "Scene/Component/ModelComponent.h"
 #include "SceneGraph.h"
+#include "SceneBVH.h"
 #include "Serialisation/SerialisationImplementation.h"
 
 #include "Scene/Component/SoundComponent.h"
@@ -231,6 +232,9 @@ namespace Lumos
 
         m_SceneGraph = CreateUniquePtr<SceneGraph>();
         m_SceneGraph->Init(m_EntityManager->GetRegistry());
+
+        m_BVH = CreateUniquePtr<SceneBVH>();
+        m_BVH->Init(m_EntityManager->GetRegistry());
     }
 
     Scene::~Scene()
@@ -277,6 +281,12 @@ namespace Lumos
     {
         LUMOS_PROFILE_FUNCTION();
         m_EntityManager->Clear();
+        m_BVH->Clear();
+    }
+
+    void Scene::UpdateBVH()
+    {
+        m_BVH->Update(this);
     }
 
     void Scene::OnUpdate(const TimeStep& timeStep)
@@ -496,14 +506,15 @@ namespace Lumos
         {
             path += std::string(".lsn");
 
-            if(!FileSystem::FileExists(path))
+            // Through the VFS so shipped scenes can come from a mounted pak
+            if(!FileSystem::Get().FileExistsVFS(path))
             {
                 LUMOS_LOG_ERROR("No saved scene file found {0}", path);
                 return;
             }
             try
             {
-                std::string data = FileSystem::ReadTextFile(path);
+                std::string data = FileSystem::Get().ReadTextFileVFS(path);
                 std::istringstream istr;
                 istr.str(data);
                 cereal::JSONInputArchive input(istr);
@@ -13,6 +13,7 @@ namespace Lumos
     class EntityManager;
     class Entity;
     class SceneGraph;
+    class SceneBVH;
     class Event;
     class WindowResizeEvent;
 
@@ -108,6 +109,10 @@ namespace Lumos
 
         EntityManager* GetEntityManager() { return m_EntityManager.get(); }
 
+        // Spatial index for ray, overlap and frustum queries, refit once per frame
+        SceneBVH* GetBVH() { return m_BVH.get(); }
+        void UpdateBVH();
+
         virtual void Serialise(const std::string& filePath, bool binary = false);
         virtual void Deserialise(const std::string& filePath, bool binary = false);
 
@@ -218,6 +223,7 @@ namespace Lumos
 
         UniquePtr<EntityManager> m_EntityManager;
         UniquePtr<SceneGraph> m_SceneGraph;
+        UniquePtr<SceneBVH> m_BVH;
 
         uint32_t m_ScreenWidth;
         uint32_t m_ScreenHeight;
@@ -0,0 +1,636 @@
+#include "Precompiled.h"
+#include "SceneBVH.h"
+#include "Scene.h"
+#include "Entity.h"
+#include "SceneGraph.h"
+#include "Scene/Component/ModelComponent.h"
+#include "Scene/Component/RigidBody3DComponent.h"
+#include "Physics/LumosPhysicsEngine/RigidBody3D.h"
+#include "Graphics/Model.h"
+#include "Graphics/Mesh.h"
+#include "Graphics/Sprite.h"
+#include "Graphics/AnimatedSprite.h"
+#include "Maths/Transform.h"
+#include "Maths/Ray.h"
+#include "Maths/Frustum.h"
+#include "Maths/BoundingSphere.h"
+#include "Core/JobSystem.h"
+
+#include <entt/entity/registry.hpp>
+#include <entt/signal/sigh.hpp>
+
+namespace Lumos
+{
+    // Leaves grow by this fraction of their size, plus a minimum, before they need reinserting
+    static const float FatMarginScale = 0.1f;
+    static const float MinFatMargin   = 0.05f;
+
+    // A balanced tree stays far below this for any realistic scene
+    static const uint32_t MaxTraversalDepth = 256;
+
+    // Below this the jobs cost more than casting on the calling thread
+    static const uint32_t MinRaysPerBatchJob = 64;
+    static const uint32_t RaysPerJob         = 16;
+
+    static bool IsEmpty(const Maths::BoundingBox& box)
+    {
+        return box.m_Min.x > box.m_Max.x;
+    }
+
+    static bool SameBox(const Maths::BoundingBox& a, const Maths::BoundingBox& b)
+    {
+        return a.m_Min == b.m_Min && a.m_Max == b.m_Max;
+    }
+
+    static Maths::BoundingBox Union(const Maths::BoundingBox& a, const Maths::BoundingBox& b)
+    {
+        return Maths::BoundingBox(glm::min(a.m_Min, b.m_Min), glm::max(a.m_Max, b.m_Max));
+    }
+
+    static float SurfaceArea(const Maths::BoundingBox& box)
+    {
+        const glm::vec3 size = box.m_Max - box.m_Min;
+        return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+    }
+
+    static bool Contains(const Maths::BoundingBox& outer, const Maths::BoundingBox& inner)
+    {
+        return glm::all(glm::lessThanEqual(outer.m_Min, inner.m_Min)) && glm::all(glm::lessThanEqual(inner.m_Max, outer.m_Max));
+    }
+
+    static bool Overlaps(const Maths::BoundingBox& a, const Maths::BoundingBox& b)
+    {
+        return glm::all(glm::lessThanEqual(a.m_Min, b.m_Max)) && glm::all(glm::lessThanEqual(b.m_Min, a.m_Max));
+    }
+
+    static bool Overlaps(const Maths::BoundingBox& box, const glm::vec3& centre, float radius)
+    {
+        const glm::vec3 closest = glm::clamp(centre, box.m_Min, box.m_Max);
+        const glm::vec3 offset  = closest - centre;
+        return glm::dot(offset, offset) <= radius * radius;
+    }
+
+    // Slab test against a precomputed inverse direction, distance is clamped to the ray origin
+    static bool IntersectRay(const glm::vec3& origin, const glm::vec3& invDirection, float maxDistance, const Maths::BoundingBox& box, float& distance)
+    {
+        const glm::vec3 t0   = (box.m_Min - origin) * invDirection;
+        const glm::vec3 t1   = (box.m_Max - origin) * invDirection;
+        const glm::vec3 tMin = glm::min(t0, t1);
+        const glm::vec3 tMax = glm::max(t0, t1);
+
+        const float entry = Maths::Max(Maths::Max(tMin.x, tMin.y), Maths::Max(tMin.z, 0.0f));
+        const float exit  = Maths::Min(Maths::Min(tMax.x, tMax.y), Maths::Min(tMax.z, maxDistance));
+        distance          = entry;
+        return entry <= exit;
+    }
+
+    SceneBVH::SceneBVH()
+    {
+        m_Nodes.reserve(256);
+    }
+
+    SceneBVH::~SceneBVH()
+    {
+    }
+
+    void SceneBVH::Clear()
+    {
+        m_Nodes.clear();
+        m_Proxies.clear();
+        m_Dirty.clear();
+        m_Root     = NullNode;
+        m_FreeList = NullNode;
+    }
+
+    template <typename Component, void (SceneBVH::*Callback)(entt::registry&, entt::entity)>
+    void SceneBVH::Connect(entt::registry& registry)
+    {
+        m_Connections.emplace_back(registry.on_construct<Component>().template connect<Callback>(*this));
+        m_Connections.emplace_back(registry.on_update<Component>().template connect<Callback>(*this));
+        m_Connections.emplace_back(registry.on_destroy<Component>().template connect<Callback>(*this));
+    }
+
+    void SceneBVH::Init(entt::registry& registry)
+    {
+        Connect<Maths::Transform, &SceneBVH::OnChanged>(registry);
+        Connect<Graphics::ModelComponent, &SceneBVH::OnChanged>(registry);
+        Connect<Graphics::Sprite, &SceneBVH::OnChanged>(registry);
+        Connect<Graphics::AnimatedSprite, &SceneBVH::OnChanged>(registry);
+        Connect<RigidBody3DComponent, &SceneBVH::OnChanged>(registry);
+        Connect<ActiveComponent, &SceneBVH::OnActiveChanged>(registry);
+    }
+
+    void SceneBVH::OnChanged(entt::registry&, entt::entity entity)
+    {
+        // Only recorded here, components may still be half initialised while loading
+        m_Dirty.push_back(entity);
+    }
+
+    void SceneBVH::OnActiveChanged(entt::registry& registry, entt::entity entity)
+    {
+        // Children inherit the active state so the whole subtree needs refitting
+        m_Dirty.push_back(entity);
+
+        const Hierarchy* hierarchy = registry.try_get<Hierarchy>(entity);
+        entt::entity child         = hierarchy ? hierarchy->First() : entt::null;
+        while(child != entt::null)
+        {
+            OnActiveChanged(registry, child);
+
+            const Hierarchy* childHierarchy = registry.try_get<Hierarchy>(child);
+            child                           = childHierarchy ? childHierarchy->Next() : entt::null;
+        }
+    }
+
+    bool SceneBVH::GatherBounds(Scene* scene, entt::entity entity, Proxy& proxy) const
+    {
+        auto& registry = scene->GetRegistry();
+        if(!registry.valid(entity))
+            return false;
+
+        Maths::Transform* trans = registry.try_get<Maths::Transform>(entity);
+        if(!trans || !Entity(entity, scene).Active())
+            return false;
+
+        proxy.Transform = trans->GetWorldMatrix();
+        proxy.Local.Clear();
+        proxy.Collider.Clear();
+
+        const Graphics::ModelComponent* model = registry.try_get<Graphics::ModelComponent>(entity);
+        if(model && model->ModelRef)
+        {
+            for(auto& mesh : model->ModelRef->GetMeshes())
+            {
+                if(mesh->GetActive())
+                    proxy.Local.Merge(*mesh->GetBoundingBox());
+            }
+        }
+
+        if(const Graphics::Sprite* sprite = registry.try_get<Graphics::Sprite>(entity))
+            proxy.Local.Merge(Maths::BoundingBox(Maths::Rect(sprite->GetPosition(), sprite->GetPosition() + sprite->GetScale())));
+
+        if(const Graphics::AnimatedSprite* sprite = registry.try_get<Graphics::AnimatedSprite>(entity))
+            proxy.Local.Merge(Maths::BoundingBox(Maths::Rect(sprite->GetPosition(), sprite->GetPosition() + sprite->GetScale())));
+
+        // Collider bounds come from the physics body, which ignores the transform's scale
+        const RigidBody3DComponent* body = registry.try_get<RigidBody3DComponent>(entity);
+        if(body && body->GetRigidBody())
+            proxy.Collider.Merge(body->GetRigidBody()->GetWorldSpaceAABB());
+
+        return !IsEmpty(proxy.Local) || !IsEmpty(proxy.Collider);
+    }
+
+    void SceneBVH::Update(Scene* scene)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        if(m_Dirty.empty())
+            return;
+
+        // An entity can be signalled many times between updates
+        std::sort(m_Dirty.begin(), m_Dirty.end());
+        m_Dirty.erase(std::unique(m_Dirty.begin(), m_Dirty.end()), m_Dirty.end());
+
+        Proxy gathered;
+        for(auto entity : m_Dirty)
+        {
+            if(!GatherBounds(scene, entity, gathered))
+            {
+                RemoveProxy(entity);
+                continue;
+            }
+
+            Proxy& proxy    = m_Proxies[entity];
+            proxy.Transform = gathered.Transform;
+            proxy.Local     = gathered.Local;
+            proxy.Collider  = gathered.Collider;
+            Refit(entity, proxy);
+        }
+
+        m_Dirty.clear();
+    }
+
+    void SceneBVH::RemoveProxy(entt::entity entity)
+    {
+        auto it = m_Proxies.find(entity);
+        if(it == m_Proxies.end())
+            return;
+
+        if(it->second.Node != NullNode)
+        {
+            RemoveLeaf(it->second.Node);
+            FreeNode(it->second.Node);
+        }
+        m_Proxies.erase(it);
+    }
+
+    void SceneBVH::Refit(entt::entity entity, Proxy& proxy)
+    {
+        if(proxy.Node != NullNode && proxy.Transform == proxy.CachedTransform && SameBox(proxy.Local, proxy.CachedLocal) && SameBox(proxy.Collider, proxy.CachedCollider))
+            return;
+
+        proxy.CachedTransform = proxy.Transform;
+        proxy.CachedLocal     = proxy.Local;
+        proxy.CachedCollider  = proxy.Collider;
+
+        Maths::BoundingBox tight = proxy.Collider;
+        if(!IsEmpty(proxy.Local))
+            tight.Merge(proxy.Local.Transformed(proxy.Transform));
+
+        if(IsEmpty(tight))
+        {
+            if(proxy.Node != NullNode)
+            {
+                RemoveLeaf(proxy.Node);
+                FreeNode(proxy.Node);
+                proxy.Node = NullNode;
+            }
+            return;
+        }
+
+        if(proxy.Node != NullNode)
+        {
+            m_Nodes[proxy.Node].Tight = tight;
+            if(Contains(m_Nodes[proxy.Node].Bounds, tight))
+                return;
+
+            RemoveLeaf(proxy.Node);
+        }
+        else
+        {
+            proxy.Node                 = AllocateNode();
+            m_Nodes[proxy.Node].Entity = entity;
+        }
+
+        const glm::vec3 margin     = (tight.m_Max - tight.m_Min) * FatMarginScale + glm::vec3(MinFatMargin);
+        m_Nodes[proxy.Node].Tight  = tight;
+        m_Nodes[proxy.Node].Bounds = Maths::BoundingBox(tight.m_Min - margin, tight.m_Max + margin);
+        InsertLeaf(proxy.Node);
+    }
+
+    int32_t SceneBVH::AllocateNode()
+    {
+        int32_t node;
+        if(m_FreeList == NullNode)
+        {
+            node = int32_t(m_Nodes.size());
+            m_Nodes.emplace_back();
+        }
+        else
+        {
+            node       = m_FreeList;
+            m_FreeList = m_Nodes[node].Parent;
+        }
+
+        m_Nodes[node] = Node();
+        return node;
+    }
+
+    void SceneBVH::FreeNode(int32_t node)
+    {
+        m_Nodes[node].Parent = m_FreeList;
+        m_Nodes[node].Height = -1;
+        m_FreeList           = node;
+    }
+
+    void SceneBVH::InsertLeaf(int32_t leaf)
+    {
+        if(m_Root == NullNode)
+        {
+            m_Root               = leaf;
+            m_Nodes[leaf].Parent = NullNode;
+            return;
+        }
+
+        // Walk down towards the sibling that grows the total surface area the least
+        const Maths::BoundingBox leafBounds = m_Nodes[leaf].Bounds;
+        int32_t index                       = m_Root;
+        while(!m_Nodes[index].IsLeaf())
+        {
+            const Node& node = m_Nodes[index];
+
+            const float area         = SurfaceArea(node.Bounds);
+            const float combinedArea = SurfaceArea(Union(node.Bounds, leafBounds));
+
+            // Cost of pairing with this node, and of pushing the leaf further down
+            const float cost            = 2.0f * combinedArea;
+            const float inheritanceCost = 2.0f * (combinedArea - area);
+
+            float childCost[2];
+            for(uint32_t i = 0; i < 2; i++)
+            {
+                const Node& child = m_Nodes[node.Children[i]];
+                childCost[i]      = SurfaceArea(Union(child.Bounds, leafBounds)) + inheritanceCost;
+                if(!child.IsLeaf())
+                    childCost[i] -= SurfaceArea(child.Bounds);
+            }
+
+            if(cost < childCost[0] && cost < childCost[1])
+                break;
+
+            index = childCost[0] < childCost[1] ? node.Children[0] : node.Children[1];
+        }
+
+        const int32_t sibling   = index;
+        const int32_t oldParent = m_Nodes[sibling].Parent;
+        const int32_t newParent = AllocateNode();
+
+        m_Nodes[newParent].Parent      = oldParent;
+        m_Nodes[newParent].Bounds      = Union(leafBounds, m_Nodes[sibling].Bounds);
+        m_Nodes[newParent].Height      = m_Nodes[sibling].Height + 1;
+        m_Nodes[newParent].Children[0] = sibling;
+        m_Nodes[newParent].Children[1] = leaf;
+        m_Nodes[sibling].Parent        = newParent;
+        m_Nodes[leaf].Parent           = newParent;
+
+        if(oldParent == NullNode)
+            m_Root = newParent;
+        else if(m_Nodes[oldParent].Children[0] == sibling)
+            m_Nodes[oldParent].Children[0] = newParent;
+        else
+            m_Nodes[oldParent].Children[1] = newParent;
+
+        for(index = m_Nodes[leaf].Parent; index != NullNode; index = m_Nodes[index].Parent)
+        {
+            index = Balance(index);
+
+            Node& node        = m_Nodes[index];
+            const Node& left  = m_Nodes[node.Children[0]];
+            const Node& right = m_Nodes[node.Children[1]];
+            node.Height       = 1 + Maths::Max(left.Height, right.Height);
+            node.Bounds       = Union(left.Bounds, right.Bounds);
+        }
+    }
+
+    void SceneBVH::RemoveLeaf(int32_t leaf)
+    {
+        if(leaf == m_Root)
+        {
+            m_Root = NullNode;
+            return;
+        }
+
+        const int32_t parent      = m_Nodes[leaf].Parent;
+        const int32_t grandParent = m_Nodes[parent].Parent;
+        const int32_t sibling     = m_Nodes[parent].Children[0] == leaf ? m_Nodes[parent].Children[1] : m_Nodes[parent].Children[0];
+
+        FreeNode(parent);
+        m_Nodes[sibling].Parent = grandParent;
+
+        if(grandParent == NullNode)
+        {
+            m_Root = sibling;
+            return;
+        }
+
+        if(m_Nodes[grandParent].Children[0] == parent)
+            m_Nodes[grandParent].Children[0] = sibling;
+        else
+            m_Nodes[grandParent].Children[1] = sibling;
+
+        for(int32_t index = grandParent; index != NullNode; index = m_Nodes[index].Parent)
+        {
+            index = Balance(index);
+
+            Node& node        = m_Nodes[index];
+            const Node& left  = m_Nodes[node.Children[0]];
+            const Node& right = m_Nodes[node.Children[1]];
+            node.Height       = 1 + Maths::Max(left.Height, right.Height);
+            node.Bounds       = Union(left.Bounds, right.Bounds);
+        }
+    }
+
+    // Rotates the taller child up when the subtree heights differ by more than one
+    int32_t SceneBVH::Balance(int32_t a)
+    {
+        Node& nodeA = m_Nodes[a];
+        if(nodeA.IsLeaf() || nodeA.Height < 2)
+            return a;
+
+        const int32_t b = nodeA.Children[0];
+        const int32_t c = nodeA.Children[1];
+        Node& nodeB     = m_Nodes[b];
+        Node& nodeC     = m_Nodes[c];
+
+        const int32_t balance = nodeC.Height - nodeB.Height;
+        if(balance > -2 && balance < 2)
+            return a;
+
+        // The taller child takes A's place and A takes the shorter of its children
+        const bool rotateC    = balance > 1;
+        const int32_t up      = rotateC ? c : b;
+        const int32_t other   = rotateC ? b : c;
+        const int32_t upSlot  = rotateC ? 1 : 0;
+        Node& nodeUp          = m_Nodes[up];
+        const int32_t f       = nodeUp.Children[0];
+        const int32_t g       = nodeUp.Children[1];
+        const Node& nodeOther = m_Nodes[other];
+
+        nodeUp.Children[0] = a;
+        nodeUp.Parent      = nodeA.Parent;
+        nodeA.Parent       = up;
+
+        if(nodeUp.Parent == NullNode)
+            m_Root = up;
+        else if(m_Nodes[nodeUp.Parent].Children[0] == a)
+            m_Nodes[nodeUp.Parent].Children[0] = up;
+        else
+            m_Nodes[nodeUp.Parent].Children[1] = up;
+
+        const int32_t keep = m_Nodes[f].Height > m_Nodes[g].Height ? f : g;
+        const int32_t give = keep == f ? g : f;
+
+        nodeUp.Children[1]     = keep;
+        nodeA.Children[upSlot] = give;
+        m_Nodes[give].Parent   = a;
+
+        nodeA.Bounds  = Union(nodeOther.Bounds, m_Nodes[give].Bounds);
+        nodeA.Height  = 1 + Maths::Max(nodeOther.Height, m_Nodes[give].Height);
+        nodeUp.Bounds = Union(nodeA.Bounds, m_Nodes[keep].Bounds);
+        nodeUp.Height = 1 + Maths::Max(nodeA.Height, m_Nodes[keep].Height);
+
+        return up;
+    }
+
+    template <typename OverlapFunc, typename LeafFunc>
+    void SceneBVH::Traverse(const OverlapFunc& overlaps, const LeafFunc& visit) const
+    {
+        if(m_Root == NullNode)
+            return;
+
+        int32_t stack[MaxTraversalDepth];
+        uint32_t stackSize = 0;
+        stack[stackSize++] = m_Root;
+
+        while(stackSize > 0)
+        {
+            const Node& node = m_Nodes[stack[--stackSize]];
+            if(!overlaps(node.Bounds))
+                continue;
+
+            if(node.IsLeaf())
+            {
+                if(overlaps(node.Tight))
+                    visit(node.Entity);
+            }
+            else if(stackSize + 2 <= MaxTraversalDepth)
+            {
+                stack[stackSize++] = node.Children[0];
+                stack[stackSize++] = node.Children[1];
+            }
+        }
+    }
+
+    bool SceneBVH::RayCast(const Maths::Ray& ray, float maxDistance, RayHit& hit) const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        hit.Entity   = entt::null;
+        hit.Distance = maxDistance;
+        if(m_Root == NullNode)
+            return false;
+
+        const glm::vec3 invDirection = 1.0f / ray.Direction;
+
+        struct Entry
+        {
+            int32_t Node;
+            float Distance;
+        };
+
+        Entry stack[MaxTraversalDepth];
+        uint32_t stackSize = 0;
+
+        float distance;
+        if(!IntersectRay(ray.Origin, invDirection, maxDistance, m_Nodes[m_Root].Bounds, distance))
+            return false;
+        stack[stackSize++] = { m_Root, distance };
+
+        while(stackSize > 0)
+        {
+            const Entry entry = stack[--stackSize];
+            if(entry.Distance > hit.Distance)
+                continue;
+
+            const Node& node = m_Nodes[entry.Node];
+            if(node.IsLeaf())
+            {
+                if(IntersectRay(ray.Origin, invDirection, hit.Distance, node.Tight, distance))
+                {
+                    hit.Entity   = node.Entity;
+                    hit.Distance = distance;
+                }
+                continue;
+            }
+
+            // Push the nearer child last so it is visited first and tightens the search sooner
+            Entry children[2];
+            uint32_t childCount = 0;
+            for(uint32_t i = 0; i < 2; i++)
+            {
+                if(IntersectRay(ray.Origin, invDirection, hit.Distance, m_Nodes[node.Children[i]].Bounds, distance))
+                    children[childCount++] = { node.Children[i], distance };
+            }
+
+            if(childCount == 2 && children[0].Distance < children[1].Distance)
+                std::swap(children[0], children[1]);
+
+            for(uint32_t i = 0; i < childCount && stackSize < MaxTraversalDepth; i++)
+                stack[stackSize++] = children[i];
+        }
+
+        return hit.Entity != entt::null;
+    }
+
+    void SceneBVH::RayCastAll(const Maths::Ray& ray, float maxDistance, std::vector<RayHit>& hits) const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        const glm::vec3 invDirection = 1.0f / ray.Direction;
+        const size_t firstHit        = hits.size();
+        float distance               = 0.0f;
+
+        Traverse([&](const Maths::BoundingBox& box)
+                 { return IntersectRay(ray.Origin, invDirection, maxDistance, box, distance); },
+                 [&](entt::entity entity)
+                 { hits.push_back({ entity, distance }); });
+
+        std::sort(hits.begin() + firstHit, hits.end(), [](const RayHit& a, const RayHit& b)
+                  { return a.Distance < b.Distance; });
+    }
+
+    void SceneBVH::QuerySphere(const Maths::BoundingSphere& sphere, std::vector<entt::entity>& entities) const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        const glm::vec3& centre = sphere.GetCenter();
+        const float radius      = sphere.GetRadius();
+
+        Traverse([&](const Maths::BoundingBox& box)
+                 { return Overlaps(box, centre, radius); },
+                 [&](entt::entity entity)
+                 { entities.push_back(entity); });
+    }
+
+    void SceneBVH::QueryAABB(const Maths::BoundingBox& queryBox, std::vector<entt::entity>& entities) const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        Traverse([&](const Maths::BoundingBox& box)
+                 { return Overlaps(box, queryBox); },
+                 [&](entt::entity entity)
+                 { entities.push_back(entity); });
+    }
+
+    void SceneBVH::QueryFrustum(const Maths::Frustum& frustum, std::vector<entt::entity>& entities) const
+    {
+        LUMOS_PROFILE_FUNCTION_LOW();
+        Traverse([&](const Maths::BoundingBox& box)
+                 { return frustum.IsInside(box); },
+                 [&](entt::entity entity)
+                 { entities.push_back(entity); });
+    }
+
+    void SceneBVH::RayCastBatch(const Maths::Ray* rays, uint32_t count, float maxDistance, RayHit* hits) const
+    {
+        LUMOS_PROFILE_FUNCTION();
+        // The tree is only read, so rays can be cast from any number of jobs at once
+        if(count >= MinRaysPerBatchJob && System::JobSystem::GetThreadCount() > 1)
+        {
+            System::JobSystem::Context context;
+            System::JobSystem::Dispatch(context, count, RaysPerJob, [&](JobDispatchArgs args)
+                                        { RayCast(rays[args.jobIndex], maxDistance, hits[args.jobIndex]); });
+            System::JobSystem::Wait(context);
+        }
+        else
+        {
+            for(uint32_t i = 0; i < count; i++)
+                RayCast(rays[i], maxDistance, hits[i]);
+        }
+    }
+
+    void SceneBVH::QueryFrustums(const Maths::Frustum* frustums, uint32_t count, std::vector<entt::entity>& entities) const
+    {
+        LUMOS_PROFILE_FUNCTION();
+        if(count > 1 && System::JobSystem::GetThreadCount() > 1)
+        {
+            std::vector<std::vector<entt::entity>> results(count);
+
+            System::JobSystem::Context context;
+            System::JobSystem::Dispatch(context, count, 1, [&](JobDispatchArgs args)
+                                        { QueryFrustum(frustums[args.jobIndex], results[args.jobIndex]); });
+            System::JobSystem::Wait(context);
+
+            for(auto& result : results)
+                entities.insert(entities.end(), result.begin(), result.end());
+        }
+        else
+        {
+            for(uint32_t i = 0; i < count; i++)
+                QueryFrustum(frustums[i], entities);
+        }
+
+        std::sort(entities.begin(), entities.end());
+        entities.erase(std::unique(entities.begin(), entities.end()), entities.end());
+    }
+
+    uint32_t SceneBVH::GetHeight() const
+    {
+        return m_Root == NullNode ? 0 : uint32_t(m_Nodes[m_Root].Height);
+    }
+}
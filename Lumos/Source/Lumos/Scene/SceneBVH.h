@@ -0,0 +1,114 @@
+#pragma once
+#include "Maths/BoundingBox.h"
+#include <entt/entity/fwd.hpp>
+#include <entt/signal/fwd.hpp>
+#include <glm/mat4x4.hpp>
+
+namespace Lumos
+{
+    class Scene;
+
+    namespace Maths
+    {
+        class Ray;
+        class Frustum;
+        class BoundingSphere;
+    }
+
+    // Dynamic AABB tree over the world bounds of models, sprites and 3D rigid bodies.
+    // Leaves are fattened so small movements only refit the cached bounds instead of reinserting.
+    // Registry signals mark entities dirty, so an update only visits what changed since the last one
+    class LUMOS_EXPORT SceneBVH
+    {
+    public:
+        struct RayHit
+        {
+            entt::entity Entity;
+            float Distance;
+        };
+
+        SceneBVH();
+        ~SceneBVH();
+
+        // Listens for changes to transforms and the components that give an entity bounds.
+        // In place edits need registry.patch so they are seen, the scene graph does this for world matrices
+        void Init(entt::registry& registry);
+
+        // Refits entities marked dirty since the last update and drops ones that were removed or disabled
+        void Update(Scene* scene);
+        void Clear();
+
+        // Distances are to the entity's bounds along the ray, zero when the origin is inside
+        bool RayCast(const Maths::Ray& ray, float maxDistance, RayHit& hit) const;
+        void RayCastAll(const Maths::Ray& ray, float maxDistance, std::vector<RayHit>& hits) const;
+
+        void QuerySphere(const Maths::BoundingSphere& sphere, std::vector<entt::entity>& entities) const;
+        void QueryAABB(const Maths::BoundingBox& box, std::vector<entt::entity>& entities) const;
+        void QueryFrustum(const Maths::Frustum& frustum, std::vector<entt::entity>& entities) const;
+
+        // Closest hit per ray, misses have entt::null. Large batches are split across the job system
+        void RayCastBatch(const Maths::Ray* rays, uint32_t count, float maxDistance, RayHit* hits) const;
+
+        // Entities inside any of the frustums, sorted and without duplicates
+        void QueryFrustums(const Maths::Frustum* frustums, uint32_t count, std::vector<entt::entity>& entities) const;
+
+        uint32_t GetEntityCount() const { return uint32_t(m_Proxies.size()); }
+        uint32_t GetHeight() const;
+
+    private:
+        static const int32_t NullNode = -1;
+
+        struct Node
+        {
+            Maths::BoundingBox Bounds; // Fattened for leaves
+            Maths::BoundingBox Tight;  // Leaves only
+            entt::entity Entity;
+            int32_t Parent      = NullNode; // Next free node while unused
+            int32_t Children[2] = { NullNode, NullNode };
+            int32_t Height      = 0;
+
+            bool IsLeaf() const { return Children[0] == NullNode; }
+        };
+
+        struct Proxy
+        {
+            int32_t Node = NullNode;
+
+            // Inputs gathered this update
+            Maths::BoundingBox Local;
+            Maths::BoundingBox Collider;
+            glm::mat4 Transform;
+
+            // Inputs the leaf was last built from
+            Maths::BoundingBox CachedLocal;
+            Maths::BoundingBox CachedCollider;
+            glm::mat4 CachedTransform;
+        };
+
+        template <typename Component, void (SceneBVH::*Callback)(entt::registry&, entt::entity)>
+        void Connect(entt::registry& registry);
+
+        void OnChanged(entt::registry& registry, entt::entity entity);
+        void OnActiveChanged(entt::registry& registry, entt::entity entity);
+
+        bool GatherBounds(Scene* scene, entt::entity entity, Proxy& proxy) const;
+        void Refit(entt::entity entity, Proxy& proxy);
+        void RemoveProxy(entt::entity entity);
+
+        int32_t AllocateNode();
+        void FreeNode(int32_t node);
+        void InsertLeaf(int32_t leaf);
+        void RemoveLeaf(int32_t leaf);
+        int32_t Balance(int32_t node);
+
+        template <typename OverlapFunc, typename LeafFunc>
+        void Traverse(const OverlapFunc& overlaps, const LeafFunc& visit) const;
+
+        std::vector<Node> m_Nodes;
+        std::unordered_map<entt::entity, Proxy> m_Proxies;
+        std::vector<entt::entity> m_Dirty;
+        std::vector<entt::scoped_connection> m_Connections;
+        int32_t m_Root     = NullNode;
+        int32_t m_FreeList = NullNode;
+    };
+}
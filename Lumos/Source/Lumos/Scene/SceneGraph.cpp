@@ -29,6 +29,15 @@ namespace Lumos
     {
     }
 
+    // Signals world matrix changes through on_update so listeners like the scene BVH only visit what moved
+    static void SetWorldMatrix(entt::registry& registry, entt::entity entity, Maths::Transform& transform, const glm::mat4& parent)
+    {
+        const glm::mat4 previous = transform.GetWorldMatrix();
+        transform.SetWorldMatrix(parent);
+        if(transform.GetWorldMatrix() != previous)
+            registry.patch<Maths::Transform>(entity);
+    }
+
     void SceneGraph::Init(entt::registry& registry)
     {
         registry.on_construct<Hierarchy>().connect<&Hierarchy::OnConstruct>();
@@ -43,7 +52,7 @@ namespace Lumos
 
         for(auto entity : nonHierarchyView)
         {
-            registry.get<Maths::Transform>(entity).SetWorldMatrix(glm::mat4(1.0f));
+            SetWorldMatrix(registry, entity, registry.get<Maths::Transform>(entity), glm::mat4(1.0f));
         }
 
         auto view = registry.view<Hierarchy>();
@@ -72,16 +81,16 @@ namespace Lumos
                     auto parentTransform = registry.try_get<Maths::Transform>(hierarchyComponent->Parent());
                     if(parentTransform)
                     {
-                        transform->SetWorldMatrix(parentTransform->GetWorldMatrix());
+                        SetWorldMatrix(registry, entity, *transform, parentTransform->GetWorldMatrix());
                     }
                     else
                     {
-                        transform->SetWorldMatrix(glm::mat4(1.0f));
+                        SetWorldMatrix(registry, entity, *transform, glm::mat4(1.0f));
                     }
                 }
                 else
                 {
-                    transform->SetWorldMatrix(glm::mat4(1.0f));
+                    SetWorldMatrix(registry, entity, *transform, glm::mat4(1.0f));
                 }
             }
 
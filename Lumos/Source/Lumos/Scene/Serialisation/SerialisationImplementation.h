@@ -9,6 +9,7 @@
 #include "Graphics/Material.h"
 #include "Graphics/Sprite.h"
 #include "Graphics/AnimatedSprite.h"
+#include "Graphics/Animation/AnimationController.h"
 #include "Utilities/AssetManager.h"
 #include "Utilities/StringUtilities.h"
 #include "Scene/Component/ModelComponent.h"
@@ -42,6 +43,9 @@ namespace Lumos
 
         archive(cereal::make_nvp("Position", node.m_Position), cereal::make_nvp("Radius", node.m_Radius), cereal::make_nvp("Pitch", node.m_Pitch), cereal::make_nvp("Volume", node.m_Volume), cereal::make_nvp("Velocity", node.m_Velocity), cereal::make_nvp("Looping", node.m_IsLooping), cereal::make_nvp("Paused", node.m_Paused), cereal::make_nvp("ReferenceDistance", node.m_ReferenceDistance), cereal::make_nvp("Global", node.m_IsGlobal), cereal::make_nvp("TimeLeft", node.m_TimeLeft), cereal::make_nvp("Stationary", node.m_Stationary),
                 cereal::make_nvp("SoundNodePath", path), cereal::make_nvp("RollOffFactor", node.m_RollOffFactor));
+        archive(cereal::make_nvp("Priority", node.m_Priority));
+        const bool preserveStereo = node.m_Sound && node.m_Sound->GetPreserveStereo();
+        archive(cereal::make_nvp("PreserveStereo", preserveStereo));
     }
 
     template <typename Archive>
@@ -51,9 +55,16 @@ namespace Lumos
         archive(cereal::make_nvp("Position", node.m_Position), cereal::make_nvp("Radius", node.m_Radius), cereal::make_nvp("Pitch", node.m_Pitch), cereal::make_nvp("Volume", node.m_Volume), cereal::make_nvp("Velocity", node.m_Velocity), cereal::make_nvp("Looping", node.m_IsLooping), cereal::make_nvp("Paused", node.m_Paused), cereal::make_nvp("ReferenceDistance", node.m_ReferenceDistance), cereal::make_nvp("Global", node.m_IsGlobal), cereal::make_nvp("TimeLeft", 0.0f), cereal::make_nvp("Stationary", node.m_Stationary),
                 cereal::make_nvp("SoundNodePath", soundFilePath), cereal::make_nvp("RollOffFactor", node.m_RollOffFactor));
 
+        if(Serialisation::CurrentSceneVersion > 25)
+            archive(cereal::make_nvp("Priority", node.m_Priority));
+
+        bool preserveStereo = false;
+        if(Serialisation::CurrentSceneVersion > 26)
+            archive(cereal::make_nvp("PreserveStereo", preserveStereo));
+
         if(!soundFilePath.empty())
         {
-            node.SetSound(Sound::Create(soundFilePath, StringUtilities::GetFilePathExtension(soundFilePath)));
+            node.SetSound(Sound::Create(soundFilePath, StringUtilities::GetFilePathExtension(soundFilePath), preserveStereo));
         }
     }
 
@@ -136,11 +147,13 @@ namespace Lumos
     {
         auto shape = std::unique_ptr<CollisionShape>(rigidBody.m_CollisionShape.get());
 
-        const int Version = 2;
+        const int Version = 4;
 
         archive(cereal::make_nvp("Version", Version));
         archive(cereal::make_nvp("Position", rigidBody.m_Position), cereal::make_nvp("Orientation", rigidBody.m_Orientation), cereal::make_nvp("LinearVelocity", rigidBody.m_LinearVelocity), cereal::make_nvp("Force", rigidBody.m_Force), cereal::make_nvp("Mass", 1.0f / rigidBody.m_InvMass), cereal::make_nvp("AngularVelocity", rigidBody.m_AngularVelocity), cereal::make_nvp("Torque", rigidBody.m_Torque), cereal::make_nvp("Static", rigidBody.m_Static), cereal::make_nvp("Friction", rigidBody.m_Friction), cereal::make_nvp("Elasticity", rigidBody.m_Elasticity), cereal::make_nvp("CollisionShape", shape), cereal::make_nvp("Trigger", rigidBody.m_Trigger), cereal::make_nvp("AngularFactor", rigidBody.m_AngularFactor));
         archive(cereal::make_nvp("UUID", (uint64_t)rigidBody.m_UUID));
+        archive(cereal::make_nvp("ContinuousCollision", rigidBody.m_ContinuousCollision));
+        archive(cereal::make_nvp("CollisionLayer", rigidBody.m_CollisionLayer));
         shape.release();
     }
 
@@ -159,6 +172,12 @@ namespace Lumos
 
         if(Version > 1)
             archive(cereal::make_nvp("UUID", (uint64_t)rigidBody.m_UUID));
+
+        if(Version > 2)
+            archive(cereal::make_nvp("ContinuousCollision", rigidBody.m_ContinuousCollision));
+
+        if(Version > 3)
+            archive(cereal::make_nvp("CollisionLayer", rigidBody.m_CollisionLayer));
     }
 
     template <typename Archive>
@@ -500,6 +519,11 @@ namespace Lumos
                 archive(cereal::make_nvp("PrimitiveType", component.ModelRef->GetPrimitiveType()), cereal::make_nvp("FilePath", newPath), cereal::make_nvp("Material", material));
                 material.release();
             }
+
+            auto controller = component.ModelRef->GetAnimationController();
+            archive(cereal::make_nvp("HasAnimationController", bool(controller)));
+            if(controller)
+                archive(cereal::make_nvp("AnimationController", *controller));
         }
 
         template <typename Archive>
@@ -522,6 +546,19 @@ namespace Lumos
             {
                 component.LoadFromLibrary(filePath);
             }
+
+            if(Serialisation::CurrentSceneVersion > 27)
+            {
+                bool hasController = false;
+                archive(cereal::make_nvp("HasAnimationController", hasController));
+                if(hasController)
+                {
+                    // Read even when the model failed to load or lost its animations, so the archive stays in step
+                    Graphics::AnimationController loaded;
+                    auto controller = component.ModelRef ? component.ModelRef->GetOrCreateAnimationController() : nullptr;
+                    archive(cereal::make_nvp("AnimationController", controller ? *controller : loaded));
+                }
+            }
         }
     }
 
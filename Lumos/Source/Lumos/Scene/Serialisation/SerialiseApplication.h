@@ -1,11 +1,12 @@
 #pragma once
 #include "Core/Application.h"
+#include "Graphics/Model.h"
 namespace Lumos
 {
     template <typename Archive>
     void save(Archive& archive, const Application& application)
     {
-        int projectVersion = 8;
+        int projectVersion = 9;
 
         archive(cereal::make_nvp("Project Version", projectVersion));
 
@@ -40,6 +41,8 @@ namespace Lumos
         archive(cereal::make_nvp("EngineAssetPath", application.m_ProjectSettings.m_EngineAssetPath));
         // Version 6
         archive(cereal::make_nvp("GPUIndex", application.m_ProjectSettings.DesiredGPUIndex));
+        // Version 9
+        archive(cereal::make_nvp("CompactModelVertices", application.m_ProjectSettings.CompactModelVertices));
     }
 
     template <typename Archive>
@@ -99,5 +102,9 @@ namespace Lumos
 
         if(application.m_ProjectSettings.ProjectVersion > 6)
             archive(cereal::make_nvp("GPUIndex", application.m_ProjectSettings.DesiredGPUIndex));
+
+        if(application.m_ProjectSettings.ProjectVersion > 8)
+            archive(cereal::make_nvp("CompactModelVertices", application.m_ProjectSettings.CompactModelVertices));
+        Graphics::Model::SetImportCompactVertices(application.m_ProjectSettings.CompactModelVertices);
     }
 }
\ No newline at end of file
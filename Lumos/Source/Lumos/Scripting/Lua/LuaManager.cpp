@@ -10,7 +10,13 @@
 #include "Scene/SceneManager.h"
 #include "LuaScriptComponent.h"
 #include "Scene/SceneGraph.h"
+#include "Scene/SceneBVH.h"
+#include "Maths/Ray.h"
+#include "Maths/BoundingSphere.h"
 #include "Graphics/Camera/ThirdPersonCamera.h"
+#include "Utilities/Timer.h"
+#include "Utilities/Hash.h"
+#include "Utilities/StringUtilities.h"
 
 #include "Scene/Component/Components.h"
 #include "Graphics/Camera/Camera.h"
@@ -21,6 +27,7 @@
 #include "Graphics/RHI/Texture.h"
 #include "Graphics/Mesh.h"
 #include "Graphics/Model.h"
+#include "Graphics/Animation/AnimationController.h"
 #include "Graphics/Material.h"
 #include "Maths/Random.h"
 #include "Scene/Entity.h"
@@ -40,6 +47,7 @@
 
 #include <imgui/imgui.h>
 #include <sol/sol.hpp>
+#include <fstream>
 #if LUMOS_PROFILE
 #include <Tracy/public/tracy/TracyLua.hpp>
 #endif
@@ -188,7 +196,61 @@ namespace Lumos
         "LuaScriptComponent",
         "GetLuaScriptComponent",
         "Transform",
-        "GetTransform"
+        "GetTransform",
+        "RayCast",
+        "QuerySphere",
+        "QueryBox",
+        "RaycastHit",
+        "RaycastQuery",
+        "Raycast3D",
+        "RaycastAll3D",
+        "SphereCast3D",
+        "OverlapSphere3D",
+        "OverlapBox3D",
+        "RaycastBatch3D"
+    };
+
+    // Runs every update function of a batch in one call, collecting errors instead of stopping at the first
+    static const char* BatchUpdateSource = R"(
+        local pcall = pcall
+        return function(functions, count, dt, errors)
+            local errorCount = 0
+            for i = 1, count do
+                local ok, err = pcall(functions[i], dt)
+                if not ok then
+                    errorCount = errorCount + 1
+                    errors[errorCount] = tostring(err)
+                end
+            end
+            return errorCount
+        end
+    )";
+
+    // Work per incremental collector step, the budget is checked between steps
+    static const int GCStepKB = 8;
+
+    // When memory doubles since the last finished cycle the budget is ignored until the cycle completes
+    static const uint32_t GCGrowthLimit  = 2;
+    static const uint32_t GCMinimumLimit = 4096;
+
+    // Bump to invalidate cached bytecode, the Lua version is folded into the hash as bytecode isn't portable across it
+    static const uint64_t BytecodeCacheVersion = 2;
+    static const uint32_t BytecodeCacheMagic   = 0x4342554C; // LUBC
+
+    struct BytecodeCacheHeader
+    {
+        uint32_t Magic;
+        uint32_t PointerSize;
+        uint64_t SourceHash;
+        uint64_t BytecodeSize;
+        uint64_t BytecodeHash; // Lua doesn't verify bytecode, so a damaged body is caught here instead of run
+    };
+
+    struct LuaManager::ScriptBatch
+    {
+        std::string FilePath;
+        sol::table Functions;
+        uint32_t Count = 0;
     };
 
     LuaManager::LuaManager()
@@ -227,10 +289,27 @@ namespace Lumos
         BindLogLua(*m_State);
         BindSceneLua(*m_State);
         BindPhysicsLua(*m_State);
+
+        sol::protected_function_result batchUpdate = m_State->safe_script(BatchUpdateSource, sol::script_pass_on_error);
+        if(batchUpdate.valid())
+            m_BatchUpdateFunc = CreateSharedPtr<sol::protected_function>(batchUpdate.get<sol::protected_function>());
+        else
+        {
+            sol::error err = batchUpdate;
+            LUMOS_LOG_ERROR("Failed to compile Lua batch update : {0}", err.what());
+        }
+        m_BatchErrors = CreateSharedPtr<sol::table>(*m_State, sol::create);
+
+        // Garbage is collected in budgeted steps each frame instead of whenever allocations trip the collector
+        lua_gc(m_State->lua_state(), LUA_GCSTOP, 0);
     }
 
     LuaManager::~LuaManager()
     {
+        // References into the state have to go before it does
+        m_ScriptBatches.clear();
+        m_BatchUpdateFunc.reset();
+        m_BatchErrors.reset();
         delete m_State;
     }
 
@@ -274,21 +353,213 @@ namespace Lumos
 
         auto view = registry.view<LuaScriptComponent>();
 
-        if(view.empty())
-            return;
+        if(!view.empty())
+        {
+            if(m_ScriptBatchesDirty || m_BatchedScriptCount != uint32_t(view.size()))
+                RebuildScriptBatches(scene);
+
+            float dt = (float)Engine::Get().GetTimeStep().GetSeconds();
+
+            if(m_BatchUpdateFunc)
+            {
+                for(auto& batch : m_ScriptBatches)
+                {
+                    LUMOS_PROFILE_SCOPE("Lua Script Batch");
+                    sol::protected_function_result result = (*m_BatchUpdateFunc)(batch.Functions, batch.Count, dt, *m_BatchErrors);
+                    if(!result.valid())
+                    {
+                        sol::error err = result;
+                        LUMOS_LOG_ERROR("Failed to Execute Lua batch update for {0}", batch.FilePath);
+                        LUMOS_LOG_ERROR("Error : {0}", err.what());
+                        continue;
+                    }
+
+                    const int errorCount = result;
+                    for(int i = 1; i <= errorCount; i++)
+                    {
+                        LUMOS_LOG_ERROR("Failed to Execute Script Lua OnUpdate in {0}", batch.FilePath);
+                        LUMOS_LOG_ERROR("Error : {0}", m_BatchErrors->get<std::string>(i));
+                        (*m_BatchErrors)[i] = sol::lua_nil;
+                    }
+                }
+            }
+            else
+            {
+                for(auto entity : view)
+                {
+                    auto& luaScript = registry.get<LuaScriptComponent>(entity);
+                    luaScript.OnUpdate(dt);
+                }
+            }
+        }
+    }
+
+    void LuaManager::RebuildScriptBatches(Scene* scene)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        auto& registry = scene->GetRegistry();
+        auto view      = registry.view<LuaScriptComponent>();
 
-        float dt = (float)Engine::Get().GetTimeStep().GetSeconds();
+        m_ScriptBatches.clear();
+        std::unordered_map<std::string, uint32_t> batchIndices;
 
         for(auto entity : view)
         {
-            auto& luaScript = registry.get<LuaScriptComponent>(entity);
-            luaScript.OnUpdate(dt);
+            auto& luaScript                 = registry.get<LuaScriptComponent>(entity);
+            sol::protected_function* update = luaScript.GetUpdateFunction();
+            if(!update)
+                continue;
+
+            auto it = batchIndices.find(luaScript.GetFilePath());
+            if(it == batchIndices.end())
+            {
+                it = batchIndices.emplace(luaScript.GetFilePath(), uint32_t(m_ScriptBatches.size())).first;
+                m_ScriptBatches.push_back({ luaScript.GetFilePath(), sol::table(*m_State, sol::create), 0 });
+            }
+
+            ScriptBatch& batch = m_ScriptBatches[it->second];
+            batch.Functions.raw_set(++batch.Count, *update);
+        }
+
+        m_BatchedScriptCount = uint32_t(view.size());
+        m_ScriptBatchesDirty = false;
+    }
+
+    void LuaManager::StepGarbageCollector()
+    {
+        LUMOS_PROFILE_FUNCTION();
+        lua_State* L = m_State->lua_state();
+
+        Timer timer;
+        const uint32_t memoryKB = uint32_t(lua_gc(L, LUA_GCCOUNT, 0));
+        const bool overLimit    = memoryKB > glm::max(m_MemoryAfterCycleKB * GCGrowthLimit, GCMinimumLimit);
+
+        // Always make some progress so the collector can't fall behind on a slow frame
+        while(true)
+        {
+            if(lua_gc(L, LUA_GCSTEP, GCStepKB))
+            {
+                m_MemoryAfterCycleKB = uint32_t(lua_gc(L, LUA_GCCOUNT, 0));
+                break;
+            }
+
+            if(!overLimit && timer.GetElapsedMSD() * 1000.0 >= double(m_GCBudget))
+                break;
         }
+
+        m_GCStepTime    = float(timer.GetElapsedMSD());
+        m_MemoryUsageKB = uint32_t(lua_gc(L, LUA_GCCOUNT, 0));
+
+        LUMOS_PROFILE_PLOT("Lua GC Step (ms)", m_GCStepTime);
+        LUMOS_PROFILE_PLOT("Lua Memory (KB)", int64_t(m_MemoryUsageKB));
     }
 
     void LuaManager::CollectGarbage()
     {
+        LUMOS_PROFILE_FUNCTION();
         m_State->collect_garbage();
+        m_MemoryAfterCycleKB = uint32_t(lua_gc(m_State->lua_state(), LUA_GCCOUNT, 0));
+    }
+
+    static std::filesystem::path GetBytecodeCachePath(const std::string& path)
+    {
+        std::string filename = fmt::format("{0}-{1:x}.lbc", StringUtilities::GetFileName(path), MurmurHash64A(path.c_str(), int(path.size()), 0));
+        return std::filesystem::path("Resources/Cache/Scripts") / filename;
+    }
+
+    // Skips a UTF-8 BOM and a first line starting with '#' the same way luaL_loadfilex does.
+    // The newline ending a skipped line is kept so line numbers still match the file
+    static size_t GetSourceStart(const std::string& source)
+    {
+        size_t start = 0;
+        if(source.compare(0, 3, "\xEF\xBB\xBF") == 0)
+            start = 3;
+
+        if(start < source.size() && source[start] == '#')
+        {
+            const size_t lineEnd = source.find('\n', start);
+            start                = lineEnd == std::string::npos ? source.size() : lineEnd;
+        }
+        return start;
+    }
+
+    static int WriteBytecode(lua_State* L, const void* data, size_t size, void* userData)
+    {
+        auto bytes = (std::vector<uint8_t>*)userData;
+        bytes->insert(bytes->end(), (const uint8_t*)data, (const uint8_t*)data + size);
+        return 0;
+    }
+
+    sol::load_result LuaManager::LoadScriptFile(const std::string& path)
+    {
+        LUMOS_PROFILE_FUNCTION();
+        lua_State* L = m_State->lua_state();
+
+        // Chunk names match script_file so error messages keep the same file:line format
+        const std::string chunkName = "@" + path;
+        const std::string source    = FileSystem::Get().ReadTextFileVFS(path);
+        const uint64_t sourceHash   = MurmurHash64A(source.data(), int(source.size()), BytecodeCacheVersion * 1000 + LUA_VERSION_NUM);
+
+        std::filesystem::path cachePath = GetBytecodeCachePath(path);
+        FileView cache;
+        if(cache.Open(cachePath.string()) && cache.GetSize() > sizeof(BytecodeCacheHeader))
+        {
+            BytecodeCacheHeader header;
+            memcpy(&header, cache.GetData(), sizeof(BytecodeCacheHeader));
+            const char* bytecode = (const char*)cache.GetData() + sizeof(BytecodeCacheHeader);
+
+            bool matches = header.Magic == BytecodeCacheMagic && header.PointerSize == sizeof(void*) && header.SourceHash == sourceHash
+                           && header.BytecodeSize == cache.GetSize() - sizeof(BytecodeCacheHeader);
+            matches      = matches && MurmurHash64A(bytecode, int(header.BytecodeSize), 0) == header.BytecodeHash;
+
+            int status = LUA_OK;
+            if(matches)
+            {
+                LUMOS_PROFILE_SCOPE("Load Cached Bytecode");
+                status = luaL_loadbufferx(L, bytecode, size_t(header.BytecodeSize), chunkName.c_str(), "b");
+            }
+            cache.Close();
+
+            if(matches && status == LUA_OK)
+            {
+                m_BytecodeCacheHits++;
+                return sol::load_result(L, lua_absindex(L, -1), 1, 1, sol::load_status::ok);
+            }
+
+            // A corrupt cache only costs a recompile, drop its error message
+            if(matches)
+                lua_pop(L, 1);
+        }
+
+        m_BytecodeCacheMisses++;
+        const size_t sourceStart = GetSourceStart(source);
+        const int status         = luaL_loadbufferx(L, source.data() + sourceStart, source.size() - sourceStart, chunkName.c_str(), "t");
+        if(status != LUA_OK)
+            return sol::load_result(L, lua_absindex(L, -1), 1, 1, static_cast<sol::load_status>(status));
+
+        // Debug info is kept so runtime errors still report lines
+        std::vector<uint8_t> bytecode;
+        lua_dump(L, WriteBytecode, &bytecode, 0);
+
+        if(!std::filesystem::exists(cachePath.parent_path()))
+            std::filesystem::create_directories(cachePath.parent_path());
+
+        std::ofstream stream(cachePath, std::ios::binary | std::ios::trunc);
+        if(stream)
+        {
+            BytecodeCacheHeader header;
+            header.Magic        = BytecodeCacheMagic;
+            header.PointerSize  = uint32_t(sizeof(void*));
+            header.SourceHash   = sourceHash;
+            header.BytecodeSize = uint64_t(bytecode.size());
+            header.BytecodeHash = MurmurHash64A(bytecode.data(), int(bytecode.size()), 0);
+            stream.write((const char*)&header, sizeof(BytecodeCacheHeader));
+            stream.write((const char*)bytecode.data(), bytecode.size());
+        }
+        else
+            LUMOS_LOG_WARN("Failed to cache Lua bytecode to {0}", cachePath.string());
+
+        return sol::load_result(L, lua_absindex(L, -1), 1, 1, sol::load_status::ok);
     }
 
     void LuaManager::OnNewProject(const std::string& projectPath)
@@ -587,7 +858,42 @@ namespace Lumos
                                   "primitive_type", sol::property(&Lumos::Graphics::Model::GetPrimitiveType, &Lumos::Graphics::Model::SetPrimitiveType),
                                   // Methods
                                   "add_mesh", &Lumos::Graphics::Model::AddMesh,
-                                  "load_model", &Lumos::Graphics::Model::LoadModel);
+                                  "load_model", &Lumos::Graphics::Model::LoadModel,
+                                  "animation_controller", &Lumos::Graphics::Model::GetOrCreateAnimationController);
+
+        state.new_enum<AnimationBlendMode, false>("AnimationBlendMode", { { "Override", AnimationBlendMode::Override }, { "Additive", AnimationBlendMode::Additive } });
+        state.new_enum<AnimationConditionMode, false>("AnimationConditionMode", { { "Greater", AnimationConditionMode::Greater }, { "Less", AnimationConditionMode::Less } });
+
+        sol::usertype<AnimationTransition> transition_type = state.new_usertype<AnimationTransition>("AnimationTransition");
+        transition_type["AnyState"]                        = sol::var(AnimationTransition::AnyState);
+        transition_type["FromState"]                       = &AnimationTransition::FromState;
+        transition_type["ToState"]                         = &AnimationTransition::ToState;
+        transition_type["Duration"]                        = &AnimationTransition::Duration;
+        transition_type["ExitTime"]                        = &AnimationTransition::ExitTime;
+        transition_type["Parameter"]                       = &AnimationTransition::Parameter;
+        transition_type["Mode"]                            = &AnimationTransition::Mode;
+        transition_type["Threshold"]                       = &AnimationTransition::Threshold;
+
+        sol::usertype<AnimationController> animationController_type = state.new_usertype<AnimationController>("AnimationController");
+        animationController_type.set_function("SetCurrentState", sol::overload(static_cast<void (AnimationController::*)(size_t)>(&AnimationController::SetCurrentState), static_cast<void (AnimationController::*)(const std::string&)>(&AnimationController::SetCurrentState)));
+        animationController_type.set_function("GetCurrentState", &AnimationController::GetCurrentState);
+        animationController_type.set_function("CrossFade", &AnimationController::CrossFade);
+        animationController_type.set_function("IsTransitioning", &AnimationController::IsTransitioning);
+        animationController_type.set_function("AddTransition", &AnimationController::AddTransition);
+        animationController_type.set_function("RemoveTransition", &AnimationController::RemoveTransition);
+        animationController_type.set_function("SetParameter", &AnimationController::SetParameter);
+        animationController_type.set_function("GetParameter", &AnimationController::GetParameter);
+        animationController_type.set_function("AddLayer", &AnimationController::AddLayer);
+        animationController_type.set_function("RemoveLayer", &AnimationController::RemoveLayer);
+        animationController_type.set_function("SetLayerWeight", &AnimationController::SetLayerWeight);
+        animationController_type.set_function("SetLayerParameter", &AnimationController::SetLayerParameter);
+        animationController_type.set_function("SetLayerBlendMode", &AnimationController::SetLayerBlendMode);
+        animationController_type.set_function("AddLayerBlendState", &AnimationController::AddLayerBlendState);
+        animationController_type.set_function("ClearLayerBlendStates", &AnimationController::ClearLayerBlendStates);
+        animationController_type.set_function("SetLayerJointMask", &AnimationController::SetLayerJointMask);
+        animationController_type.set_function("ClearLayerJointMask", &AnimationController::ClearLayerJointMask);
+        animationController_type.set_function("SetJointLOD", &AnimationController::SetJointLOD);
+        animationController_type.set_function("GetJointLOD", &AnimationController::GetJointLOD);
 
         REGISTER_COMPONENT_WITH_ECS(state, Model, static_cast<Model& (Entity::*)(const std::string&)>(&Entity::AddComponent<Model, const std::string&>));
 
@@ -698,11 +1004,50 @@ namespace Lumos
         return Random32::Rand(a, b);
     }
 
+    // Closest entity whose bounds the ray hits and the distance to them, the entity is invalid on a miss
+    static std::tuple<Entity, float> SceneRayCast(Scene* scene, const glm::vec3& origin, const glm::vec3& direction, float maxDistance)
+    {
+        // A zero direction from a script would normalise to NaNs
+        if(glm::length2(direction) < Maths::M_EPSILON)
+            return { Entity(entt::null, scene), maxDistance };
+
+        SceneBVH::RayHit hit;
+        scene->GetBVH()->RayCast(Maths::Ray(origin, glm::normalize(direction)), maxDistance, hit);
+        return { Entity(hit.Entity, scene), hit.Distance };
+    }
+
+    static sol::as_table_t<std::vector<Entity>> ToEntityTable(Scene* scene, const std::vector<entt::entity>& handles)
+    {
+        std::vector<Entity> entities;
+        entities.reserve(handles.size());
+        for(auto handle : handles)
+            entities.emplace_back(handle, scene);
+
+        return sol::as_table(std::move(entities));
+    }
+
+    static sol::as_table_t<std::vector<Entity>> SceneQuerySphere(Scene* scene, const glm::vec3& centre, float radius)
+    {
+        std::vector<entt::entity> handles;
+        scene->GetBVH()->QuerySphere(Maths::BoundingSphere(centre, radius), handles);
+        return ToEntityTable(scene, handles);
+    }
+
+    static sol::as_table_t<std::vector<Entity>> SceneQueryBox(Scene* scene, const glm::vec3& min, const glm::vec3& max)
+    {
+        std::vector<entt::entity> handles;
+        scene->GetBVH()->QueryAABB(Maths::BoundingBox(min, max), handles);
+        return ToEntityTable(scene, handles);
+    }
+
     void LuaManager::BindSceneLua(sol::state& state)
     {
         sol::usertype<Scene> scene_type = state.new_usertype<Scene>("Scene");
         scene_type.set_function("GetRegistry", &Scene::GetRegistry);
         scene_type.set_function("GetEntityManager", &Scene::GetEntityManager);
+        scene_type.set_function("RayCast", &SceneRayCast);
+        scene_type.set_function("QuerySphere", &SceneQuerySphere);
+        scene_type.set_function("QueryBox", &SceneQueryBox);
 
         sol::usertype<Graphics::Texture2D> texture2D_type = state.new_usertype<Graphics::Texture2D>("Texture2D");
         texture2D_type.set_function("CreateFromFile", &Graphics::Texture2D::CreateFromFile);
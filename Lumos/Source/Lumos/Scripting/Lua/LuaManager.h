@@ -2,9 +2,11 @@
 
 #include "Utilities/TSingleton.h"
 
+#include <sol/forward.hpp>
+
 namespace sol
 {
-    class state;
+    struct load_result;
 }
 
 namespace Lumos
@@ -23,8 +25,28 @@ namespace Lumos
         void OnInit(Scene* scene);
         void OnUpdate(Scene* scene);
 
+        // Full collection, for loading screens and scene changes rather than every frame
         void CollectGarbage();
 
+        // Runs the incremental collector for at most the GC budget. Called every frame whatever the editor state,
+        // the automatic collector is stopped so nothing else frees Lua memory
+        void StepGarbageCollector();
+
+        // The collector only runs in incremental steps from StepGarbageCollector, for at most this long each frame
+        void SetGCBudget(uint32_t microseconds) { m_GCBudget = microseconds; }
+        uint32_t GetGCBudget() const { return m_GCBudget; }
+        float GetGCStepTime() const { return m_GCStepTime; }
+        uint32_t GetMemoryUsageKB() const { return m_MemoryUsageKB; }
+
+        // Compiles a script file, read through the VFS, without running it. The bytecode is cached on disk by the
+        // hash of the source, so unchanged scripts skip parsing and edited ones fall back to compiling the source
+        sol::load_result LoadScriptFile(const std::string& path);
+        uint32_t GetBytecodeCacheHits() const { return m_BytecodeCacheHits; }
+        uint32_t GetBytecodeCacheMisses() const { return m_BytecodeCacheMisses; }
+
+        // Rebuilds the per script update batches on the next update
+        void MarkScriptBatchesDirty() { m_ScriptBatchesDirty = true; }
+
         void OnNewProject(const std::string& projectPath);
 
         void BindECSLua(sol::state& state);
@@ -41,8 +63,27 @@ namespace Lumos
         }
 
     private:
+        struct ScriptBatch;
+
+        void RebuildScriptBatches(Scene* scene);
+
         static std::vector<std::string> s_Identifiers;
 
         sol::state* m_State;
+
+        // Update functions grouped by script file, so each file costs one call into Lua per frame
+        std::vector<ScriptBatch> m_ScriptBatches;
+        SharedPtr<sol::protected_function> m_BatchUpdateFunc;
+        SharedPtr<sol::table> m_BatchErrors;
+        uint32_t m_BatchedScriptCount = 0;
+        bool m_ScriptBatchesDirty     = true;
+
+        uint32_t m_GCBudget           = 500;
+        float m_GCStepTime            = 0.0f;
+        uint32_t m_MemoryUsageKB      = 0;
+        uint32_t m_MemoryAfterCycleKB = 0;
+
+        uint32_t m_BytecodeCacheHits   = 0;
+        uint32_t m_BytecodeCacheMisses = 0;
     };
 }
@@ -40,14 +40,15 @@ namespace Lumos
             sol::protected_function releaseFunc = (*m_Env)["OnRelease"];
             if(releaseFunc.valid())
                 releaseFunc.call();
+
+            LuaManager::Get().MarkScriptBatchesDirty();
         }
     }
 
     void LuaScriptComponent::LoadScript(const std::string& fileName)
     {
         m_FileName = fileName;
-        std::string physicalPath;
-        if(!FileSystem::Get().ResolvePhysicalPath(fileName, physicalPath))
+        if(!FileSystem::Get().FileExistsVFS(fileName))
         {
             LUMOS_LOG_ERROR("Failed to Load Lua script {0}", fileName);
             m_Env = nullptr;
@@ -58,14 +59,33 @@ namespace Lumos
 
         m_Env = CreateSharedPtr<sol::environment>(LuaManager::Get().GetState(), sol::create, LuaManager::Get().GetState().globals());
 
-        auto loadFileResult = LuaManager::Get().GetState().script_file(physicalPath, *m_Env, sol::script_pass_on_error);
-        if(!loadFileResult.valid())
+        // Compiled through the bytecode cache, then run inside this component's environment
+        std::string loadError;
+        sol::load_result chunk = LuaManager::Get().LoadScriptFile(fileName);
+        if(chunk.valid())
+        {
+            sol::protected_function script = chunk;
+            sol::set_environment(*m_Env, script);
+
+            sol::protected_function_result result = script();
+            if(!result.valid())
+            {
+                sol::error err = result;
+                loadError      = err.what();
+            }
+        }
+        else
+        {
+            sol::error err = chunk;
+            loadError      = err.what();
+        }
+
+        if(!loadError.empty())
         {
-            sol::error err = loadFileResult;
-            LUMOS_LOG_ERROR("Failed to Execute Lua script {0}", physicalPath);
-            LUMOS_LOG_ERROR("Error : {0}", err.what());
+            LUMOS_LOG_ERROR("Failed to Execute Lua script {0}", fileName);
+            LUMOS_LOG_ERROR("Error : {0}", loadError);
             std::string filename = StringUtilities::GetFileName(m_FileName);
-            std::string error    = std::string(err.what());
+            std::string error    = loadError;
 
             int line              = 1;
             auto linepos          = error.find(".lua:");
@@ -110,7 +130,8 @@ namespace Lumos
         if(!m_Phys3DEndFunc->valid())
             m_Phys3DEndFunc.reset();
 
-        LuaManager::Get().GetState().collect_garbage();
+        // The old environment is left to the incremental collector, but the batches need the new update function
+        LuaManager::Get().MarkScriptBatchesDirty();
     }
 
     void LuaScriptComponent::OnInit()
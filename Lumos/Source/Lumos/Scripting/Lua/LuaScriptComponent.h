@@ -61,6 +61,12 @@ namespace Lumos
             return m_Env.get() != nullptr;
         }
 
+        // Null when the script has no OnUpdate
+        sol::protected_function* GetUpdateFunction() const
+        {
+            return m_UpdateFunc.get();
+        }
+
         template <typename Archive>
         void save(Archive& archive) const
         {
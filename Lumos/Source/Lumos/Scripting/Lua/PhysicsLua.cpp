@@ -4,6 +4,7 @@
 #include "Scene/Component/RigidBody3DComponent.h"
 #include "Core/Application.h"
 #include "Physics/B2PhysicsEngine/B2PhysicsEngine.h"
+#include "Physics/LumosPhysicsEngine/LumosPhysicsEngine.h"
 
 #include <box2d/box2d.h>
 #include <sol/sol.hpp>
@@ -317,6 +318,55 @@ namespace Lumos
         return SharedPtr<RigidBody3D>(Application::Get().GetSystem<LumosPhysicsEngine>()->CreateBody({}));
     }
 
+    // Misses return a hit with a nil body
+    static RaycastHit Raycast3D(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, sol::optional<uint32_t> layerMask)
+    {
+        RaycastHit hit;
+        Application::Get().GetSystem<LumosPhysicsEngine>()->Raycast(origin, direction, maxDistance, hit, layerMask.value_or(AllCollisionLayers));
+        return hit;
+    }
+
+    static sol::as_table_t<std::vector<RaycastHit>> RaycastAll3D(const glm::vec3& origin, const glm::vec3& direction, float maxDistance, sol::optional<uint32_t> layerMask)
+    {
+        std::vector<RaycastHit> hits;
+        Application::Get().GetSystem<LumosPhysicsEngine>()->RaycastAll(origin, direction, maxDistance, hits, layerMask.value_or(AllCollisionLayers));
+        return sol::as_table(std::move(hits));
+    }
+
+    static RaycastHit SphereCast3D(const glm::vec3& origin, float radius, const glm::vec3& direction, float maxDistance, sol::optional<uint32_t> layerMask)
+    {
+        RaycastHit hit;
+        Application::Get().GetSystem<LumosPhysicsEngine>()->SphereCast(origin, radius, direction, maxDistance, hit, layerMask.value_or(AllCollisionLayers));
+        return hit;
+    }
+
+    static sol::as_table_t<std::vector<RigidBody3D*>> OverlapSphere3D(const glm::vec3& centre, float radius, sol::optional<uint32_t> layerMask)
+    {
+        std::vector<RigidBody3D*> bodies;
+        Application::Get().GetSystem<LumosPhysicsEngine>()->OverlapSphere(centre, radius, bodies, layerMask.value_or(AllCollisionLayers));
+        return sol::as_table(std::move(bodies));
+    }
+
+    static sol::as_table_t<std::vector<RigidBody3D*>> OverlapBox3D(const glm::vec3& centre, const glm::vec3& halfExtents, const glm::quat& orientation, sol::optional<uint32_t> layerMask)
+    {
+        std::vector<RigidBody3D*> bodies;
+        Application::Get().GetSystem<LumosPhysicsEngine>()->OverlapBox(centre, halfExtents, orientation, bodies, layerMask.value_or(AllCollisionLayers));
+        return sol::as_table(std::move(bodies));
+    }
+
+    // Takes an array of RaycastQuery and returns one hit per query in the same order
+    static sol::as_table_t<std::vector<RaycastHit>> RaycastBatch3D(const sol::table& queryTable)
+    {
+        std::vector<RaycastQuery> queries;
+        queries.reserve(queryTable.size());
+        for(size_t i = 1; i <= queryTable.size(); i++)
+            queries.push_back(queryTable.get<RaycastQuery>(i));
+
+        std::vector<RaycastHit> hits(queries.size());
+        Application::Get().GetSystem<LumosPhysicsEngine>()->RaycastBatch(queries.data(), uint32_t(queries.size()), hits.data());
+        return sol::as_table(std::move(hits));
+    }
+
     void BindPhysicsLua(sol::state& state)
     {
         register_type_b2Vec2(state);
@@ -354,6 +404,30 @@ namespace Lumos
         physics3D_type.set_function("GetPosition", &RigidBody3D::GetPosition);
         physics3D_type.set_function("GetFriction", &RigidBody3D::GetFriction);
         physics3D_type.set_function("GetIsStatic", &RigidBody3D::GetIsStatic);
+        physics3D_type.set_function("SetCollisionLayer", &RigidBody3D::SetCollisionLayer);
+        physics3D_type.set_function("GetCollisionLayer", &RigidBody3D::GetCollisionLayer);
+        physics3D_type.set_function("SetContinuousCollision", &RigidBody3D::SetContinuousCollision);
+        physics3D_type.set_function("GetContinuousCollision", &RigidBody3D::GetContinuousCollision);
+
+        sol::usertype<RaycastHit> raycastHit_type = state.new_usertype<RaycastHit>("RaycastHit");
+        raycastHit_type["body"]                   = &RaycastHit::Body;
+        raycastHit_type["point"]                  = &RaycastHit::Point;
+        raycastHit_type["normal"]                 = &RaycastHit::Normal;
+        raycastHit_type["distance"]               = &RaycastHit::Distance;
+
+        sol::usertype<RaycastQuery> raycastQuery_type = state.new_usertype<RaycastQuery>("RaycastQuery");
+        raycastQuery_type["origin"]                   = &RaycastQuery::Origin;
+        raycastQuery_type["direction"]                = &RaycastQuery::Direction;
+        raycastQuery_type["maxDistance"]              = &RaycastQuery::MaxDistance;
+        raycastQuery_type["radius"]                   = &RaycastQuery::Radius;
+        raycastQuery_type["layerMask"]                = &RaycastQuery::LayerMask;
+
+        state.set_function("Raycast3D", &Raycast3D);
+        state.set_function("RaycastAll3D", &RaycastAll3D);
+        state.set_function("SphereCast3D", &SphereCast3D);
+        state.set_function("OverlapSphere3D", &OverlapSphere3D);
+        state.set_function("OverlapBox3D", &OverlapBox3D);
+        state.set_function("RaycastBatch3D", &RaycastBatch3D);
 
         std::initializer_list<std::pair<sol::string_view, Shape>> shapes = {
             { "Square", Shape::Square },
@@ -25,31 +25,31 @@ namespace Lumos
     uint8_t* LoadImageFromFile(const char* filename, uint32_t* width, uint32_t* height, uint32_t* bits, bool* isHDR, bool flipY, bool srgb)
     {
         LUMOS_PROFILE_FUNCTION();
-        std::string filePath = std::string(filename);
-        std::string physicalPath;
-        if(!FileSystem::Get().ResolvePhysicalPath(filePath, physicalPath))
+        // Read through the VFS so images can come from a mounted pak as well as the asset folder
+        int64_t fileSize  = 0;
+        uint8_t* fileData = FileSystem::Get().ReadFileVFS(filename, &fileSize);
+        if(!fileData)
             return nullptr;
 
-        filename = physicalPath.c_str();
-
         int texWidth = 0, texHeight = 0, texChannels = 0;
         stbi_uc* pixels   = nullptr;
         int sizeOfChannel = 8;
-        if(stbi_is_hdr(filename))
+        if(stbi_is_hdr_from_memory(fileData, int(fileSize)))
         {
             sizeOfChannel = 32;
-            pixels        = (uint8_t*)stbi_loadf(filename, &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
+            pixels        = (uint8_t*)stbi_loadf_from_memory(fileData, int(fileSize), &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
 
             if(isHDR)
                 *isHDR = true;
         }
         else
         {
-            pixels = stbi_load(filename, &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
+            pixels = stbi_load_from_memory(fileData, int(fileSize), &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
 
             if(isHDR)
                 *isHDR = false;
         }
+        delete[] fileData;
 
         // Resize the image if it exceeds the maximum width or height
         if(!isHDR && s_MaxWidth > 0 && s_MaxHeight > 0 && ((uint32_t)texWidth > s_MaxWidth || (uint32_t)texHeight > s_MaxHeight))
@@ -140,29 +140,28 @@ namespace Lumos
     bool LoadImageFromFile(ImageLoadDesc& desc)
     {
         LUMOS_PROFILE_FUNCTION();
-        std::string filePath = std::string(desc.filePath);
-        std::string physicalPath;
         stbi_uc* pixels = nullptr;
         int texWidth = 0, texHeight = 0, texChannels = 0;
 
         int sizeOfChannel = 8;
-        if(FileSystem::Get().ResolvePhysicalPath(filePath, physicalPath))
+        int64_t fileSize  = 0;
+        uint8_t* fileData = FileSystem::Get().ReadFileVFS(desc.filePath, &fileSize);
+        if(fileData)
         {
-            desc.filePath = physicalPath.c_str();
-
-            if(stbi_is_hdr(desc.filePath))
+            if(stbi_is_hdr_from_memory(fileData, int(fileSize)))
             {
                 sizeOfChannel = 32;
-                pixels        = (uint8_t*)stbi_loadf(desc.filePath, &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
+                pixels        = (uint8_t*)stbi_loadf_from_memory(fileData, int(fileSize), &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
 
                 desc.isHDR = true;
             }
             else
             {
-                pixels = stbi_load(desc.filePath, &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
+                pixels = stbi_load_from_memory(fileData, int(fileSize), &texWidth, &texHeight, &texChannels, STBI_rgb_alpha);
 
                 desc.isHDR = false;
             }
+            delete[] fileData;
 
             // Resize the image if it exceeds the maximum width or height
             if(!desc.isHDR && desc.maxWidth > 0 && desc.maxHeight > 0 && ((uint32_t)texWidth > desc.maxWidth || (uint32_t)texHeight > desc.maxHeight))
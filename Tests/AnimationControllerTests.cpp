@@ -0,0 +1,163 @@
+#include "Tests.h"
+#include <Lumos/Core/Core.h>
+#include <Lumos/Graphics/Animation/AnimationController.h>
+#include <Lumos/Graphics/Animation/Skeleton.h>
+
+#include <ozz/animation/offline/animation_builder.h>
+#include <ozz/animation/offline/raw_animation.h>
+#include <ozz/animation/offline/raw_skeleton.h>
+#include <ozz/animation/offline/skeleton_builder.h>
+
+#include <cereal/archives/json.hpp>
+#include <cmath>
+#include <sstream>
+
+// Evaluates a controller over a two joint skeleton (Root -> Child) and two constant clips, A with the
+// root at x = 0 and the child at y = 1, B with the root at x = 1 and the child at y = 2, so every
+// blended pose can be read straight from the local translations.
+
+using namespace Lumos;
+using namespace Lumos::Graphics;
+
+namespace
+{
+    SharedPtr<Skeleton> BuildSkeleton()
+    {
+        ozz::animation::offline::RawSkeleton raw;
+        raw.roots.resize(1);
+        raw.roots[0].name = "Root";
+        raw.roots[0].children.resize(1);
+        raw.roots[0].children[0].name = "Child";
+
+        ozz::animation::offline::SkeletonBuilder builder;
+        return CreateSharedPtr<Skeleton>(builder(raw).release());
+    }
+
+    SharedPtr<Animation> BuildClip(const std::string& name, const SharedPtr<Skeleton>& skeleton, float rootX, float childY)
+    {
+        ozz::animation::offline::RawAnimation raw;
+        raw.duration = 1.0f;
+        raw.tracks.resize(2);
+        raw.tracks[0].translations.push_back({ 0.0f, ozz::math::Float3(rootX, 0.0f, 0.0f) });
+        raw.tracks[1].translations.push_back({ 0.0f, ozz::math::Float3(0.0f, childY, 0.0f) });
+
+        ozz::animation::offline::AnimationBuilder builder;
+        return CreateSharedPtr<Animation>(name, builder(raw).release(), skeleton);
+    }
+
+    SharedPtr<AnimationController> BuildController()
+    {
+        const SharedPtr<Skeleton> skeleton = BuildSkeleton();
+
+        SharedPtr<AnimationController> controller = CreateSharedPtr<AnimationController>();
+        controller->SetSkeleton(skeleton);
+        controller->AddState("A", BuildClip("A", skeleton, 0.0f, 1.0f));
+        controller->AddState("B", BuildClip("B", skeleton, 1.0f, 2.0f));
+        return controller;
+    }
+
+    bool Near(float a, float b)
+    {
+        return std::abs(a - b) < 1e-3f;
+    }
+}
+
+uint32_t RunAnimationControllerTests()
+{
+    uint32_t failures = 0;
+
+    {
+        SharedPtr<AnimationController> controller = BuildController();
+        SamplingContext context;
+        float time = 0.0f;
+
+        controller->Update(time, context, 0.0f);
+        failures += !Check("first state is sampled", Near(context.LocalTranslations[0].x, 0.0f) && Near(context.LocalTranslations[1].y, 1.0f));
+
+        controller->CrossFade(1, 1.0f);
+        controller->Update(time, context, 0.5f);
+        failures += !Check("cross-fade blends both states halfway", controller->IsTransitioning() && Near(context.LocalTranslations[0].x, 0.5f) && Near(context.LocalTranslations[1].y, 1.5f));
+
+        controller->Update(time, context, 0.25f);
+        failures += !Check("cross-fade weight follows the transition time", Near(context.LocalTranslations[0].x, 0.75f));
+
+        controller->Update(time, context, 0.25f);
+        failures += !Check("cross-fade ends on the target state", !controller->IsTransitioning() && controller->GetCurrentState() == 1 && Near(context.LocalTranslations[0].x, 1.0f));
+    }
+
+    {
+        SharedPtr<AnimationController> controller = BuildController();
+        SamplingContext context;
+        float time = 0.0f;
+
+        AnimationTransition transition;
+        transition.FromState = 0;
+        transition.ToState   = 1;
+        transition.Duration  = 0.5f;
+        transition.Parameter = "Speed";
+        transition.Threshold = 0.5f;
+        controller->AddTransition(transition);
+
+        AnimationTransition invalid;
+        invalid.ToState = 5;
+        failures += !Check("transition to a missing state is rejected", controller->AddTransition(invalid) == AnimationTransition::AnyState && controller->GetTransitions().size() == 1);
+
+        controller->Update(time, context, 0.0f);
+        failures += !Check("transition waits for its condition", !controller->IsTransitioning() && controller->GetCurrentState() == 0);
+
+        controller->SetParameter("Speed", 1.0f);
+        controller->Update(time, context, 0.0f);
+        controller->Update(time, context, 0.25f);
+        failures += !Check("parameter starts the transition", controller->IsTransitioning() && controller->GetCurrentState() == 1 && Near(context.LocalTranslations[0].x, 0.5f));
+    }
+
+    {
+        SharedPtr<AnimationController> controller = BuildController();
+        SamplingContext context;
+        float time = 0.0f;
+
+        const size_t layer = controller->AddLayer("Upper");
+        controller->AddLayerBlendState(layer, 1, 0.0f);
+        controller->SetLayerJointMask(layer, "Child", 1.0f);
+        controller->Update(time, context, 0.0f);
+        failures += !Check("masked layer only drives its joints", Near(context.LocalTranslations[0].x, 0.0f) && Near(context.LocalTranslations[1].y, 2.0f));
+
+        controller->ClearLayerJointMask(layer);
+        controller->SetLayerWeight(layer, 0.5f);
+        controller->Update(time, context, 0.0f);
+        failures += !Check("layer weight blends over the base", Near(context.LocalTranslations[0].x, 0.5f) && Near(context.LocalTranslations[1].y, 1.5f));
+
+        controller->SetLayerWeight(layer, 1.0f);
+        controller->SetLayerJointMask(layer, "Child", 1.0f);
+        controller->SetJointLOD(3);
+        controller->SetParameter("Speed", 2.0f);
+        AnimationTransition transition;
+        transition.ToState   = 1;
+        transition.Parameter = "Speed";
+        transition.Threshold = 5.0f;
+        controller->AddTransition(transition);
+
+        std::stringstream stream;
+        {
+            cereal::JSONOutputArchive output(stream);
+            output(cereal::make_nvp("Controller", *controller));
+        }
+
+        SharedPtr<AnimationController> loaded = BuildController();
+        {
+            cereal::JSONInputArchive input(stream);
+            input(cereal::make_nvp("Controller", *loaded));
+        }
+
+        const bool graph  = loaded->GetJointLOD() == 3 && Near(loaded->GetParameter("Speed"), 2.0f) && loaded->GetTransitions().size() == 1 && loaded->GetTransitions()[0].FromState == AnimationTransition::AnyState;
+        const bool layers = loaded->GetLayers().size() == 1 && loaded->GetLayer(0).Name == "Upper" && loaded->GetLayer(0).BlendTree.size() == 1 && loaded->GetLayer(0).GetJointMask().size() == 2;
+        failures += !Check("graph survives serialisation", graph && layers);
+
+        SamplingContext loadedContext;
+        float loadedTime = 0.0f;
+        loaded->Update(loadedTime, loadedContext, 0.0f);
+        failures += !Check("loaded layer and mask are applied", !loaded->IsTransitioning() && Near(loadedContext.LocalTranslations[0].x, 0.0f) && Near(loadedContext.LocalTranslations[1].y, 2.0f));
+    }
+
+    return failures;
+}
@@ -0,0 +1,151 @@
+#include "Tests.h"
+#include <Lumos/Core/Core.h>
+#include <Lumos/Core/OS/FileSystem.h>
+#include <Lumos/Core/OS/PakArchive.h>
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+// Checks mapped file views, the async read queue and a pak build/open/read round trip on files in a temporary folder
+
+using namespace Lumos;
+
+namespace
+{
+    bool WriteTestFile(const std::filesystem::path& path, const std::vector<uint8_t>& contents)
+    {
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+        stream.write(reinterpret_cast<const char*>(contents.data()), std::streamsize(contents.size()));
+        return bool(stream);
+    }
+
+    bool SameContents(const uint8_t* data, int64_t size, const std::vector<uint8_t>& expected)
+    {
+        return data && size == int64_t(expected.size()) && memcmp(data, expected.data(), expected.size()) == 0;
+    }
+
+    // Compresses well, so the pak stores it compressed
+    std::vector<uint8_t> MakeTextContents()
+    {
+        std::string text;
+        while(text.size() < 64 * 1024)
+            text += "Lumos packs repeated text into a much smaller entry. ";
+        return std::vector<uint8_t>(text.begin(), text.end());
+    }
+
+    // Doesn't compress, so the pak stores it as is
+    std::vector<uint8_t> MakeRandomContents()
+    {
+        std::mt19937 generator(1234);
+        std::vector<uint8_t> bytes(16 * 1024);
+        for(auto& byte : bytes)
+            byte = uint8_t(generator());
+        return bytes;
+    }
+
+    uint32_t RunFileViewTests(const std::filesystem::path& folder, const std::vector<uint8_t>& contents)
+    {
+        const std::string path = (folder / "View.bin").string();
+        uint32_t failures      = 0;
+
+        FileView view;
+        failures += !Check("file view opens", view.Open(path) && view.IsOpen());
+        failures += !Check("file view maps contents", SameContents(view.GetData(), int64_t(view.GetSize()), contents));
+        view.Close();
+        failures += !Check("file view closes", !view.IsOpen() && view.GetData() == nullptr);
+
+        FileView missing;
+        failures += !Check("file view fails on a missing file", !missing.Open((folder / "Missing.bin").string()));
+        return failures;
+    }
+
+    uint32_t RunAsyncReadTests(const std::filesystem::path& folder, const std::vector<uint8_t>& contents)
+    {
+        uint32_t failures = 0;
+        bool read         = false;
+        bool readMatches  = false;
+        bool missingRead  = false;
+        bool missingNull  = false;
+
+        // Callbacks run on the I/O thread, WaitForAsyncReads orders their writes before the checks below
+        FileSystem::Get().ReadFileAsync((folder / "View.bin").string(), [&](uint8_t* data, int64_t size)
+                                        {
+            read        = true;
+            readMatches = SameContents(data, size, contents);
+            delete[] data; });
+
+        FileSystem::Get().ReadFileAsync((folder / "Missing.bin").string(), [&](uint8_t* data, int64_t size)
+                                        {
+            missingRead = true;
+            missingNull = data == nullptr && size == 0;
+            delete[] data; });
+
+        FileSystem::Get().WaitForAsyncReads();
+
+        failures += !Check("async read calls back with the file", read && readMatches);
+        failures += !Check("async read of a missing file calls back with null", missingRead && missingNull);
+        failures += !Check("async reads drain", FileSystem::Get().GetPendingReadCount() == 0);
+        return failures;
+    }
+
+    uint32_t RunPakTests(const std::filesystem::path& folder, const std::vector<uint8_t>& text, const std::vector<uint8_t>& random)
+    {
+        const std::filesystem::path assets = folder / "Assets";
+        const std::string pakPath          = (folder / "Assets.lpak").string();
+        uint32_t failures                  = 0;
+
+        WriteTestFile(assets / "Text" / "Repeated.txt", text);
+        WriteTestFile(assets / "Data" / "Random.bin", random);
+
+        failures += !Check("pak builds", PakArchive::Build(assets.string(), pakPath));
+
+        PakArchive pak;
+        failures += !Check("pak opens", pak.Open(pakPath) && pak.GetFileCount() == 2);
+
+        uint64_t mappedSize = 0;
+        failures += !Check("pak compresses repeated text", pak.Contains("Text/Repeated.txt") && pak.GetMappedFile("Text/Repeated.txt", mappedSize) == nullptr);
+        failures += !Check("pak stores random bytes as is", pak.GetMappedFile("Data/Random.bin", mappedSize) != nullptr && mappedSize == random.size());
+
+        int64_t size  = 0;
+        uint8_t* data = pak.ReadFile("Text/Repeated.txt", size);
+        failures += !Check("pak reads a compressed entry", SameContents(data, size, text));
+        delete[] data;
+
+        data = pak.ReadFile("Data/Random.bin", size);
+        failures += !Check("pak reads a stored entry", SameContents(data, size, random));
+        delete[] data;
+
+        data = pak.ReadFile("Text/Missing.txt", size);
+        failures += !Check("pak misses an unknown path", data == nullptr && size == 0 && !pak.Contains("Text/Missing.txt") && pak.GetFileSize("Text/Missing.txt") == -1);
+        delete[] data;
+
+        pak.Close();
+        return failures;
+    }
+}
+
+uint32_t RunFileSystemTests()
+{
+    std::error_code error;
+    const std::filesystem::path folder = std::filesystem::temp_directory_path(error) / "LumosFileSystemTests";
+    std::filesystem::remove_all(folder, error);
+
+    const std::vector<uint8_t> text   = MakeTextContents();
+    const std::vector<uint8_t> random = MakeRandomContents();
+
+    uint32_t failures = 0;
+    if(!Check("test files are written", WriteTestFile(folder / "View.bin", random)))
+        return 1;
+
+    failures += RunFileViewTests(folder, random);
+    failures += RunAsyncReadTests(folder, random);
+    failures += RunPakTests(folder, text, random);
+
+    FileSystem::Release();
+    std::filesystem::remove_all(folder, error);
+    return failures;
+}
@@ -0,0 +1,134 @@
+#include "Tests.h"
+#include <Lumos/Core/Core.h>
+#include <Lumos/Graphics/Light.h>
+#include <Lumos/Graphics/Renderers/LightClusters.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+// Bins point lights into the froxel grid from a camera at the origin looking down -z and checks
+// which clusters list them, using the same cluster lookup as Clusters.glslh
+
+using namespace Lumos;
+using Graphics::LightClusters;
+
+namespace
+{
+    const float NearPlane = 0.1f;
+    const float FarPlane  = 100.0f;
+
+    Graphics::Light PointLight(const glm::vec3& position, float radius)
+    {
+        return Graphics::Light(glm::vec3(0.0f), glm::vec4(1.0f), 1.0f, Graphics::LightType::PointLight, position, radius);
+    }
+
+    // GetClusterIndex from Clusters.glslh
+    uint32_t ClusterAt(const LightClusters& clusters, const glm::vec3& viewPos)
+    {
+        const glm::vec4& params = clusters.GetProjectionParams();
+        const glm::uvec4 dims   = clusters.GetDimensions();
+        const float depth       = std::max(-viewPos.z, 1e-4f);
+
+        glm::vec2 ndc = glm::vec2(viewPos) * glm::vec2(params);
+        if(dims.w == 0)
+            ndc /= depth;
+
+        const float slice   = (dims.w == 0 ? std::log(depth) : depth) * params.z + params.w;
+        const glm::vec2 pos = glm::clamp((ndc * 0.5f + 0.5f) * glm::vec2(dims), glm::vec2(0.0f), glm::vec2(dims) - 1.0f);
+        const uint32_t z    = uint32_t(glm::clamp(slice, 0.0f, float(dims.z) - 1.0f));
+        return uint32_t(pos.x) + uint32_t(pos.y) * dims.x + z * dims.x * dims.y;
+    }
+
+    std::vector<uint32_t> LightsIn(const LightClusters& clusters, uint32_t cluster)
+    {
+        const uint32_t range    = reinterpret_cast<const uint32_t*>(clusters.GetClusterRanges())[cluster];
+        const uint16_t* indices = reinterpret_cast<const uint16_t*>(clusters.GetLightIndices());
+
+        std::vector<uint32_t> lights;
+        for(uint32_t i = 0; i < (range >> 16); i++)
+            lights.push_back(indices[(range & 0xFFFF) + i]);
+        return lights;
+    }
+
+    bool Lists(const LightClusters& clusters, const glm::vec3& viewPos, uint32_t light)
+    {
+        const std::vector<uint32_t> lights = LightsIn(clusters, ClusterAt(clusters, viewPos));
+        return std::find(lights.begin(), lights.end(), light) != lights.end();
+    }
+}
+
+uint32_t RunLightClustersTests()
+{
+    const glm::mat4 view        = glm::mat4(1.0f);
+    const glm::mat4 perspective = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, NearPlane, FarPlane);
+
+    LightClusters clusters;
+    uint32_t failures = 0;
+
+    {
+        const Graphics::Light lights[] = {
+            PointLight(glm::vec3(0.0f, 0.0f, -10.0f), 1.0f),
+            PointLight(glm::vec3(-5.0f, 2.0f, -20.0f), 0.5f),
+            Graphics::Light(glm::vec3(0.0f, -1.0f, 0.0f)),
+            PointLight(glm::vec3(0.0f, 0.0f, 10.0f), 1.0f),
+        };
+        clusters.Build(view, perspective, NearPlane, FarPlane, false, lights, 4);
+
+        failures += !Check("light is listed at its centre", Lists(clusters, glm::vec3(0.0f, 0.0f, -10.0f), 0));
+        failures += !Check("light is listed inside its radius", Lists(clusters, glm::vec3(0.0f, 0.9f, -10.0f), 0) && Lists(clusters, glm::vec3(0.0f, 0.0f, -10.9f), 0));
+        failures += !Check("light is not listed beside it", !Lists(clusters, glm::vec3(3.0f, 0.0f, -10.0f), 0));
+        failures += !Check("light is not listed in front of or behind it", !Lists(clusters, glm::vec3(0.0f, 0.0f, -5.0f), 0) && !Lists(clusters, glm::vec3(0.0f, 0.0f, -20.0f), 0));
+        failures += !Check("off centre light is listed at its centre", Lists(clusters, glm::vec3(-5.0f, 2.0f, -20.0f), 1) && !Lists(clusters, glm::vec3(-5.0f, 2.0f, -20.0f), 0));
+
+        bool unbinned = true;
+        for(uint32_t cluster = 0; cluster < LightClusters::ClusterCount; cluster++)
+        {
+            for(uint32_t light : LightsIn(clusters, cluster))
+                unbinned &= light < 2;
+        }
+        failures += !Check("directional and behind camera lights are not binned", unbinned);
+        failures += !Check("nothing dropped", clusters.GetDroppedCount() == 0);
+    }
+
+    {
+        // Covers the whole near slice, so every tile there has the same list
+        const Graphics::Light lights[] = { PointLight(glm::vec3(0.0f, 0.0f, 0.0f), 0.5f) };
+        clusters.Build(view, perspective, NearPlane, FarPlane, false, lights, 1);
+
+        failures += !Check("light around the camera fills the screen", Lists(clusters, glm::vec3(-0.1f, -0.05f, -0.15f), 0) && Lists(clusters, glm::vec3(0.1f, 0.05f, -0.15f), 0));
+        failures += !Check("clusters with the same lights share indices", clusters.GetIndexCount() < LightClusters::TilesX * LightClusters::TilesY);
+    }
+
+    {
+        const glm::mat4 orthographic   = glm::ortho(-10.0f, 10.0f, -10.0f, 10.0f, NearPlane, FarPlane);
+        const Graphics::Light lights[] = { PointLight(glm::vec3(4.0f, -4.0f, -50.0f), 1.0f) };
+        clusters.Build(view, orthographic, NearPlane, FarPlane, true, lights, 1);
+
+        failures += !Check("orthographic light is listed at its centre", Lists(clusters, glm::vec3(4.0f, -4.0f, -50.0f), 0));
+        failures += !Check("orthographic light is not listed across the view", !Lists(clusters, glm::vec3(-4.0f, 4.0f, -50.0f), 0));
+    }
+
+    {
+        // A small light in the middle of each cluster along one row, so no two clusters share a list
+        const float depth = NearPlane * std::pow(FarPlane / NearPlane, 16.5f / float(LightClusters::Slices));
+        std::vector<Graphics::Light> lights;
+        for(uint32_t x = 0; x < LightClusters::TilesX; x++)
+        {
+            const float ndcX = -1.0f + (float(x) + 0.5f) * 2.0f / float(LightClusters::TilesX);
+            lights.push_back(PointLight(glm::vec3(ndcX * depth / perspective[0][0], 0.0f, -depth), 0.1f));
+        }
+
+        clusters.SetIndexCapacity(8);
+        clusters.Build(view, perspective, NearPlane, FarPlane, false, lights.data(), uint32_t(lights.size()));
+        failures += !Check("full index list drops the overflow", clusters.GetIndexCount() == 8 && clusters.GetDroppedCount() == LightClusters::TilesX - 8);
+
+        clusters.SetIndexCapacity(LightClusters::DefaultIndexCapacity);
+        clusters.Build(view, perspective, NearPlane, FarPlane, false, lights.data(), uint32_t(lights.size()));
+        failures += !Check("every light is kept once the capacity allows", clusters.GetIndexCount() == LightClusters::TilesX && clusters.GetDroppedCount() == 0 && Lists(clusters, glm::vec3(lights.back().Position), LightClusters::TilesX - 1));
+    }
+
+    return failures;
+}
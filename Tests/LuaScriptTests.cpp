@@ -0,0 +1,226 @@
+#include "Tests.h"
+#include <Lumos/Core/Core.h>
+#include <Lumos/Core/OS/FileSystem.h>
+#include <Lumos/Scene/Scene.h>
+#include <Lumos/Scene/Entity.h>
+#include <Lumos/Scene/EntityManager.h>
+#include <Lumos/Scripting/Lua/LuaManager.h>
+#include <Lumos/Scripting/Lua/LuaScriptComponent.h>
+
+#include <sol/sol.hpp>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+// Runs the batched script updates over thousands of script instances spread across a few files,
+// and checks the incremental collector keeps to its per frame budget while they make garbage.
+// Then loads a script through the bytecode cache as it's first compiled, reused, edited and corrupted
+
+using namespace Lumos;
+
+namespace
+{
+    const uint32_t InstancesPerScript = 1000;
+    const uint32_t FrameCount         = 60;
+    const uint32_t RemovedInstances   = 250;
+
+    // The budget is checked between collector steps, so a frame can run over by about one step. The atomic
+    // step that ends a cycle can't be split, so a few frames may go further over
+    const uint32_t GCBudget      = 500;
+    const uint32_t GCStepSlack   = 250;
+    const uint32_t MaxGCOverruns = FrameCount / 10;
+
+    // Memory by the last frame, relative to right after a full collection
+    const uint32_t MaxGCGrowth = 2;
+
+    // Each update leaves a small table and string behind for the collector
+    const char* CounterScript = R"(
+Updates = 0
+
+function OnUpdate(dt)
+    Updates = Updates + 1
+    Garbage = { dt, tostring(Updates) }
+end
+)";
+
+    const char* NoUpdateScript = R"(
+Updates = 0
+)";
+
+    bool WriteScript(const std::filesystem::path& path, const char* source)
+    {
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream stream(path, std::ios::trunc);
+        stream << source;
+        return bool(stream);
+    }
+
+    // Loading goes through the bytecode cache, which lives under the working directory rather than the test folder
+    std::filesystem::path FindCachedBytecode(const std::string& scriptName)
+    {
+        const std::filesystem::path cacheFolder = "Resources/Cache/Scripts";
+        if(std::filesystem::exists(cacheFolder))
+        {
+            for(auto& entry : std::filesystem::directory_iterator(cacheFolder))
+            {
+                if(entry.path().filename().string().rfind(scriptName + "-", 0) == 0)
+                    return entry.path();
+            }
+        }
+        return {};
+    }
+
+    void RemoveCachedBytecode(const std::string& scriptName)
+    {
+        for(std::filesystem::path path = FindCachedBytecode(scriptName); !path.empty(); path = FindCachedBytecode(scriptName))
+            std::filesystem::remove(path);
+    }
+
+    // Flips bytes at the end of the blob, inside the bytecode rather than the header
+    bool CorruptCachedBytecode(const std::filesystem::path& path)
+    {
+        std::fstream stream(path, std::ios::in | std::ios::out | std::ios::binary);
+        stream.seekg(-8, std::ios::end);
+        char bytes[8];
+        stream.read(bytes, sizeof(bytes));
+        for(char& byte : bytes)
+            byte = char(~byte);
+        stream.seekp(-8, std::ios::end);
+        stream.write(bytes, sizeof(bytes));
+        return bool(stream);
+    }
+
+    // Loads through the bytecode cache and runs the chunk, -1 if either fails
+    int RunScriptFile(const std::string& path)
+    {
+        sol::load_result chunk = LuaManager::Get().LoadScriptFile(path);
+        if(!chunk.valid())
+            return -1;
+
+        sol::protected_function script        = chunk;
+        sol::protected_function_result result = script();
+        return result.valid() ? result.get<int>() : -1;
+    }
+
+    // Every script instance with an OnUpdate has to have run it exactly once per frame
+    bool UpdatedEveryFrame(Scene& scene, uint32_t frames)
+    {
+        auto view = scene.GetRegistry().view<LuaScriptComponent>();
+        for(auto entity : view)
+        {
+            auto& script            = view.get<LuaScriptComponent>(entity);
+            const uint32_t expected = script.GetUpdateFunction() ? frames : 0;
+            if(script.GetSolEnvironment().get_or("Updates", UINT32_MAX) != expected)
+                return false;
+        }
+        return true;
+    }
+}
+
+uint32_t RunLuaScriptTests()
+{
+    // Scripts are referenced through //Assets like a project's, with the asset root pointed at a temporary folder
+    const std::filesystem::path folder = std::filesystem::temp_directory_path() / "LumosLuaScriptTests";
+    const std::string assetRoot        = folder.generic_string();
+    FileSystem::Get().SetAssetRoot(Str8StdS(assetRoot));
+
+    const std::string counterPath      = "//Assets/Scripts/Counter.lua";
+    const std::string otherCounterPath = "//Assets/Scripts/OtherCounter.lua";
+    const std::string noUpdatePath     = "//Assets/Scripts/NoUpdate.lua";
+
+    uint32_t failures = 0;
+    failures += !Check("lua test scripts written", WriteScript(folder / "Scripts/Counter.lua", CounterScript) && WriteScript(folder / "Scripts/OtherCounter.lua", CounterScript) && WriteScript(folder / "Scripts/NoUpdate.lua", NoUpdateScript));
+
+    LuaManager::Get().OnInit();
+    LuaManager::Get().SetGCBudget(GCBudget);
+
+    {
+        Scene scene("LuaScriptTests");
+        std::vector<Entity> entities;
+        for(const std::string& path : { counterPath, otherCounterPath, noUpdatePath })
+        {
+            for(uint32_t i = 0; i < InstancesPerScript; i++)
+            {
+                entities.push_back(scene.GetEntityManager()->Create());
+                entities.back().AddComponent<LuaScriptComponent>(path, &scene);
+            }
+        }
+
+        bool allLoaded = true;
+        for(auto& entity : entities)
+            allLoaded &= entity.GetComponent<LuaScriptComponent>().Loaded();
+        failures += !Check("lua script instances load", allLoaded);
+
+        // Measured from a finished cycle so the growth limit doesn't lift the budget
+        LuaManager::Get().CollectGarbage();
+        const uint32_t collectedKB = uint32_t(LuaManager::Get().GetState().memory_used() / 1024);
+
+        bool updatedOnce  = true;
+        uint32_t overruns = 0;
+        float slowestStep = 0.0f;
+        for(uint32_t frame = 1; frame <= FrameCount; frame++)
+        {
+            LuaManager::Get().OnUpdate(&scene);
+            updatedOnce &= UpdatedEveryFrame(scene, frame);
+
+            LuaManager::Get().StepGarbageCollector();
+            slowestStep = std::max(slowestStep, LuaManager::Get().GetGCStepTime());
+            if(LuaManager::Get().GetGCStepTime() * 1000.0f > float(GCBudget + GCStepSlack))
+                overruns++;
+        }
+
+        printf("lua batches: %u instances, %u frames, %u GC steps over budget, slowest %.3fms, %uKB in use\n", uint32_t(entities.size()), FrameCount, overruns, slowestStep, LuaManager::Get().GetMemoryUsageKB());
+        failures += !Check("batched OnUpdate runs exactly once per frame for every instance", updatedOnce);
+        failures += !Check("scripts without OnUpdate are never called", entities.back().GetComponent<LuaScriptComponent>().GetSolEnvironment().get_or("Updates", UINT32_MAX) == 0);
+        failures += !Check("incremental GC steps stay within their budget", overruns <= MaxGCOverruns);
+        failures += !Check("budgeted GC keeps up with the garbage scripts make", LuaManager::Get().GetMemoryUsageKB() < collectedKB * MaxGCGrowth);
+
+        // Removing instances changes the count, so the batches are rebuilt without the removed ones
+        for(uint32_t i = 0; i < RemovedInstances; i++)
+        {
+            entities.front().Destroy();
+            entities.erase(entities.begin());
+        }
+
+        LuaManager::Get().OnUpdate(&scene);
+        failures += !Check("rebuilt batches still run each remaining instance once", UpdatedEveryFrame(scene, FrameCount + 1));
+
+        // Reloading swaps the update function, the dirty batches must not keep calling the old one
+        LuaScriptComponent& reloaded = entities.front().GetComponent<LuaScriptComponent>();
+        reloaded.Reload();
+        LuaManager::Get().OnUpdate(&scene);
+        const uint32_t reloadedUpdates = reloaded.GetSolEnvironment().get_or("Updates", UINT32_MAX);
+        failures += !Check("a reloaded script is updated through its new environment", reloadedUpdates == 1);
+    }
+
+    // The first load compiles the source and writes a blob, unchanged source then loads from the blob
+    const std::string cachedPath = "//Assets/Scripts/Cached.lua";
+    RemoveCachedBytecode("Cached.lua");
+    WriteScript(folder / "Scripts/Cached.lua", "return 1");
+
+    uint32_t hits   = LuaManager::Get().GetBytecodeCacheHits();
+    uint32_t misses = LuaManager::Get().GetBytecodeCacheMisses();
+    failures += !Check("first load misses the bytecode cache and writes a blob", RunScriptFile(cachedPath) == 1 && LuaManager::Get().GetBytecodeCacheMisses() == misses + 1 && LuaManager::Get().GetBytecodeCacheHits() == hits && !FindCachedBytecode("Cached.lua").empty());
+    failures += !Check("second load hits the bytecode cache", RunScriptFile(cachedPath) == 1 && LuaManager::Get().GetBytecodeCacheHits() == hits + 1);
+
+    // Editing the script changes the source hash, so the stale blob is ignored and replaced
+    WriteScript(folder / "Scripts/Cached.lua", "return 2");
+    misses = LuaManager::Get().GetBytecodeCacheMisses();
+    failures += !Check("edited source misses the bytecode cache", RunScriptFile(cachedPath) == 2 && LuaManager::Get().GetBytecodeCacheMisses() == misses + 1);
+    hits = LuaManager::Get().GetBytecodeCacheHits();
+    failures += !Check("edited source is cached again", RunScriptFile(cachedPath) == 2 && LuaManager::Get().GetBytecodeCacheHits() == hits + 1);
+
+    // A damaged blob has to be caught before Lua runs it, and the source compiled instead
+    hits   = LuaManager::Get().GetBytecodeCacheHits();
+    misses = LuaManager::Get().GetBytecodeCacheMisses();
+    failures += !Check("cached blob corrupted", CorruptCachedBytecode(FindCachedBytecode("Cached.lua")));
+    failures += !Check("corrupt blob falls back to the source", RunScriptFile(cachedPath) == 2 && LuaManager::Get().GetBytecodeCacheMisses() == misses + 1 && LuaManager::Get().GetBytecodeCacheHits() == hits);
+    failures += !Check("corrupt blob is replaced", RunScriptFile(cachedPath) == 2 && LuaManager::Get().GetBytecodeCacheHits() == hits + 1);
+
+    LuaManager::Release();
+    for(const char* name : { "Counter.lua", "OtherCounter.lua", "NoUpdate.lua", "Cached.lua" })
+        RemoveCachedBytecode(name);
+    std::filesystem::remove_all(folder);
+    FileSystem::Get().SetAssetRoot(String8());
+    return failures;
+}
@@ -0,0 +1,44 @@
+#include "Tests.h"
+#include <Lumos/Core/Core.h>
+#include <Lumos/Core/Thread.h>
+#include <Lumos/Core/JobSystem.h>
+#include <Lumos/Core/LMLog.h>
+
+#include <cstdio>
+
+// Runs headless, the exit code is the number of failed checks
+
+using namespace Lumos;
+
+bool Check(const char* name, bool passed)
+{
+    printf("%s %s\n", passed ? "PASS" : "FAIL", name);
+    return passed;
+}
+
+int main(int argc, char** argv)
+{
+    Debug::Log::OnInit();
+    ThreadContext mainThread = ThreadContextAlloc();
+    SetThreadContext(&mainThread);
+    System::JobSystem::OnInit();
+
+    uint32_t failures = 0;
+    failures += RunNarrowphaseTests();
+    failures += RunFileSystemTests();
+    failures += RunOcclusionCullerTests();
+    failures += RunLightClustersTests();
+    failures += RunPathfindingTests();
+    failures += RunNavMeshTests();
+    failures += RunLuaScriptTests();
+    failures += RunVoiceAllocatorTests();
+    failures += RunOggStreamTests();
+    failures += RunAnimationControllerTests();
+
+    printf("%u failed\n", failures);
+
+    System::JobSystem::Release();
+    ThreadContextRelease(&mainThread);
+    Debug::Log::OnRelease();
+    return int(failures);
+}
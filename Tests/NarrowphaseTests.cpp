@@ -0,0 +1,129 @@
+#include "Tests.h"
+#include <Lumos/Core/Core.h>
+#include <Lumos/Core/Reference.h>
+#include <Lumos/Physics/LumosPhysicsEngine/RigidBody3D.h>
+#include <Lumos/Physics/LumosPhysicsEngine/Narrowphase/CollisionDetection.h>
+#include <Lumos/Physics/LumosPhysicsEngine/CollisionShapes/SphereCollisionShape.h>
+#include <Lumos/Physics/LumosPhysicsEngine/CollisionShapes/CuboidCollisionShape.h>
+#include <Lumos/Physics/LumosPhysicsEngine/CollisionShapes/PyramidCollisionShape.h>
+
+#include <glm/gtc/quaternion.hpp>
+#include <cstdio>
+
+// Checks the GJK/EPA narrowphase against the separating axis tests it can replace
+
+using namespace Lumos;
+
+namespace
+{
+    const float DepthTolerance  = 1e-3f;
+    const float NormalTolerance = 0.999f;
+
+    // Negative expected depths mark pairs that shouldn't collide
+    const float Separated = -1.0f;
+
+    // The physics engine owns bodies normally, so the constructor is only reachable from a subclass
+    class TestBody : public RigidBody3D
+    {
+    public:
+        TestBody(const SharedPtr<CollisionShape>& shape, const glm::vec3& position, const glm::quat& orientation)
+            : RigidBody3D(MakeProperties(shape, position, orientation))
+        {
+        }
+
+    private:
+        static RigidBody3DProperties MakeProperties(const SharedPtr<CollisionShape>& shape, const glm::vec3& position, const glm::quat& orientation)
+        {
+            RigidBody3DProperties properties;
+            properties.Shape       = shape;
+            properties.Position    = position;
+            properties.Orientation = orientation;
+            return properties;
+        }
+    };
+
+    struct NarrowphaseResult
+    {
+        bool Hit = false;
+        CollisionData Data;
+    };
+
+    NarrowphaseResult RunNarrowphase(TestBody& a, TestBody& b, bool useGJK)
+    {
+        CollisionDetection::Get().SetUseGJK(useGJK);
+
+        NarrowphaseResult result;
+        result.Hit = CollisionDetection::Get().CheckCollision(&a, &b, a.GetCollisionShape().get(), b.GetCollisionShape().get(), &result.Data);
+        return result;
+    }
+
+    bool CheckPair(const char* name, const SharedPtr<CollisionShape>& shapeA, const glm::vec3& positionA, const glm::quat& orientationA,
+                   const SharedPtr<CollisionShape>& shapeB, const glm::vec3& positionB, const glm::quat& orientationB, float expectedDepth)
+    {
+        TestBody a(shapeA, positionA, orientationA);
+        TestBody b(shapeB, positionB, orientationB);
+
+        const NarrowphaseResult sat = RunNarrowphase(a, b, false);
+        const NarrowphaseResult gjk = RunNarrowphase(a, b, true);
+
+        // Both report overlap as a negative penetration along a normal from a to b
+        const float satDepth = -sat.Data.penetration;
+        const float gjkDepth = -gjk.Data.penetration;
+
+        bool passed = sat.Hit == gjk.Hit && sat.Hit == (expectedDepth >= 0.0f);
+        if(passed && sat.Hit)
+        {
+            passed = glm::abs(satDepth - expectedDepth) < DepthTolerance
+                && glm::abs(gjkDepth - expectedDepth) < DepthTolerance
+                && glm::dot(sat.Data.normal, gjk.Data.normal) > NormalTolerance;
+        }
+
+        if(sat.Hit || gjk.Hit)
+        {
+            printf("%s %s: expected %.4f, SAT %d %.4f (%.3f %.3f %.3f), GJK %d %.4f (%.3f %.3f %.3f)\n", passed ? "PASS" : "FAIL", name, expectedDepth,
+                   sat.Hit, satDepth, sat.Data.normal.x, sat.Data.normal.y, sat.Data.normal.z,
+                   gjk.Hit, gjkDepth, gjk.Data.normal.x, gjk.Data.normal.y, gjk.Data.normal.z);
+        }
+        else
+            printf("%s %s: no collision\n", passed ? "PASS" : "FAIL", name);
+
+        return passed;
+    }
+}
+
+uint32_t RunNarrowphaseTests()
+{
+    const glm::quat identity     = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+    const glm::quat rotatedZ     = glm::angleAxis(glm::radians(45.0f), glm::vec3(0.0f, 0.0f, 1.0f));
+    const glm::quat upsideDown   = glm::angleAxis(glm::radians(180.0f), glm::vec3(1.0f, 0.0f, 0.0f));
+    const glm::quat rotatedY     = glm::angleAxis(glm::radians(30.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    const float sqrt2            = glm::sqrt(2.0f);
+
+    SharedPtr<CollisionShape> cube     = CreateSharedPtr<CuboidCollisionShape>(glm::vec3(1.0f));
+    SharedPtr<CollisionShape> slab     = CreateSharedPtr<CuboidCollisionShape>(glm::vec3(2.0f, 1.0f, 2.0f));
+    SharedPtr<CollisionShape> sphere   = CreateSharedPtr<SphereCollisionShape>(1.0f);
+    SharedPtr<CollisionShape> pyramid  = CreateSharedPtr<PyramidCollisionShape>(glm::vec3(1.0f));
+
+    uint32_t failures = 0;
+
+    // Box-box
+    failures += !CheckPair("box-box face", cube, glm::vec3(0.0f), identity, cube, glm::vec3(1.5f, 0.2f, 0.1f), identity, 0.5f);
+    failures += !CheckPair("box-box slab", slab, glm::vec3(0.0f), identity, cube, glm::vec3(0.3f, 1.7f, 0.0f), identity, 0.3f);
+    failures += !CheckPair("box-box rotated", cube, glm::vec3(0.0f), identity, cube, glm::vec3(0.0f, 2.2f, 0.0f), rotatedZ, sqrt2 - 1.2f);
+    failures += !CheckPair("box-box separated", cube, glm::vec3(0.0f), identity, cube, glm::vec3(2.5f, 0.0f, 0.0f), identity, Separated);
+
+    // Sphere-box
+    failures += !CheckPair("sphere-box face", sphere, glm::vec3(0.0f, 1.8f, 0.0f), identity, cube, glm::vec3(0.0f), identity, 0.2f);
+    failures += !CheckPair("sphere-box edge", sphere, glm::vec3(1.5f, 1.5f, 0.0f), identity, cube, glm::vec3(0.0f), identity, 1.0f - glm::sqrt(0.5f));
+    failures += !CheckPair("box-sphere rotated", cube, glm::vec3(0.0f), rotatedY, sphere, glm::vec3(0.0f, 0.0f, 1.6f), identity, 2.0f - 1.6f * glm::cos(glm::radians(30.0f)));
+    failures += !CheckPair("sphere-box separated", sphere, glm::vec3(0.0f, 2.5f, 0.0f), identity, cube, glm::vec3(0.0f), identity, Separated);
+
+    // Hulls. The pyramid's slanted faces have normals (2, 1, 0) / sqrt(5) and its rotations
+    failures += !CheckPair("pyramid-box base", pyramid, glm::vec3(0.0f, 1.7f, 0.0f), identity, cube, glm::vec3(0.0f), identity, 0.3f);
+    failures += !CheckPair("pyramid-pyramid tips", pyramid, glm::vec3(0.0f), identity, pyramid, glm::vec3(0.0f, 1.8f, 0.0f), upsideDown, 0.2f / glm::sqrt(5.0f));
+    failures += !CheckPair("pyramid-box side", pyramid, glm::vec3(0.0f), identity, cube, glm::vec3(1.5f, 0.0f, 0.0f), identity, 1.0f / glm::sqrt(5.0f));
+    failures += !CheckPair("pyramid-box separated", pyramid, glm::vec3(0.0f), identity, cube, glm::vec3(0.0f, 2.5f, 0.0f), identity, Separated);
+
+    CollisionDetection::Release();
+    return failures;
+}
@@ -0,0 +1,146 @@
+#include "Tests.h"
+#include <Lumos/Core/Core.h>
+#include <Lumos/AI/NavMesh.h>
+#include <Lumos/Maths/BoundingBox.h>
+
+#include <cstdio>
+
+// Builds a nav mesh over a generated level, checks string pulled paths around its walls
+// and that moving an obstacle only rebuilds the tiles it touches
+
+using namespace Lumos;
+
+namespace
+{
+    // 20m square floor split into 4m tiles, with a wall that leaves a gap at the far end
+    const float LevelSize      = 20.0f;
+    const glm::vec3 WallMin    = glm::vec3(9.0f, 0.0f, 0.0f);
+    const glm::vec3 WallMax    = glm::vec3(11.0f, 3.0f, 16.0f);
+    const glm::vec3 LedgeMin   = glm::vec3(0.5f, 0.0f, 9.0f);
+    const glm::vec3 LedgeMax   = glm::vec3(3.0f, 4.0f, 12.0f);
+    const float PointTolerance = 0.3f;
+
+    // Bounds on the path length around the wall
+    const float MinDetourLength = 34.0f;
+    const float MaxDetourLength = 37.0f;
+
+    void AddQuad(std::vector<glm::vec3>& vertices, std::vector<uint32_t>& indices, const glm::vec3& a, const glm::vec3& b, const glm::vec3& c, const glm::vec3& d)
+    {
+        const uint32_t base = uint32_t(vertices.size());
+        vertices.insert(vertices.end(), { a, b, c, d });
+        indices.insert(indices.end(), { base, base + 1, base + 2, base, base + 2, base + 3 });
+    }
+
+    void AddBox(std::vector<glm::vec3>& vertices, std::vector<uint32_t>& indices, const glm::vec3& min, const glm::vec3& max)
+    {
+        const glm::vec3 corner[8] = {
+            { min.x, min.y, min.z }, { max.x, min.y, min.z }, { max.x, min.y, max.z }, { min.x, min.y, max.z },
+            { min.x, max.y, min.z }, { max.x, max.y, min.z }, { max.x, max.y, max.z }, { min.x, max.y, max.z }
+        };
+
+        AddQuad(vertices, indices, corner[4], corner[5], corner[6], corner[7]);
+        AddQuad(vertices, indices, corner[0], corner[1], corner[5], corner[4]);
+        AddQuad(vertices, indices, corner[1], corner[2], corner[6], corner[5]);
+        AddQuad(vertices, indices, corner[2], corner[3], corner[7], corner[6]);
+        AddQuad(vertices, indices, corner[3], corner[0], corner[4], corner[7]);
+    }
+
+    bool NearXZ(const glm::vec3& a, const glm::vec3& b)
+    {
+        return glm::length(glm::vec2(a.x - b.x, a.z - b.z)) < PointTolerance;
+    }
+
+    float PathLength(const std::vector<glm::vec3>& path)
+    {
+        float length = 0.0f;
+        for(size_t i = 0; i + 1 < path.size(); i++)
+            length += glm::length(path[i + 1] - path[i]);
+        return length;
+    }
+
+    // Samples every segment and fails if any sample is inside the box on the XZ plane
+    bool AvoidsBoxXZ(const std::vector<glm::vec3>& path, const glm::vec3& min, const glm::vec3& max)
+    {
+        for(size_t i = 0; i + 1 < path.size(); i++)
+        {
+            for(int step = 0; step <= 64; step++)
+            {
+                const glm::vec3 point = glm::mix(path[i], path[i + 1], float(step) / 64.0f);
+                if(point.x > min.x && point.x < max.x && point.z > min.z && point.z < max.z)
+                    return false;
+            }
+        }
+        return true;
+    }
+}
+
+uint32_t RunNavMeshTests()
+{
+    std::vector<glm::vec3> vertices;
+    std::vector<uint32_t> indices;
+    AddQuad(vertices, indices, glm::vec3(0.0f), glm::vec3(LevelSize, 0.0f, 0.0f), glm::vec3(LevelSize, 0.0f, LevelSize), glm::vec3(0.0f, 0.0f, LevelSize));
+    AddBox(vertices, indices, WallMin, WallMax);
+    AddBox(vertices, indices, LedgeMin, LedgeMax);
+
+    NavMeshSettings settings;
+    settings.CellSize   = 0.25f;
+    settings.CellHeight = 0.1f;
+    settings.TileSize   = 16;
+
+    NavMesh navMesh(settings);
+    navMesh.AddTriangles(vertices.data(), uint32_t(vertices.size()), indices.data(), uint32_t(indices.size()));
+    navMesh.Build();
+
+    uint32_t failures = 0;
+    failures += !Check("nav mesh builds 5x5 tiles of polygons", navMesh.GetTileCount() == 25 && navMesh.GetPolyCount() > 0);
+
+    // Around the wall through the gap at its far end
+    const glm::vec3 start = glm::vec3(2.0f, 0.0f, 2.0f);
+    const glm::vec3 end   = glm::vec3(18.0f, 0.0f, 2.0f);
+    std::vector<glm::vec3> path;
+
+    const bool found = navMesh.FindPath(start, end, path);
+    failures += !Check("nav mesh finds a path around the wall", found && path.size() >= 3 && NearXZ(path.front(), start) && NearXZ(path.back(), end));
+
+    // Every corner the funnel keeps is a real turn, and one of them wraps round the end of the wall
+    bool cornersTurn   = found;
+    bool roundsWallEnd = false;
+    for(size_t i = 1; i + 1 < path.size(); i++)
+    {
+        const glm::vec2 in  = glm::vec2(path[i].x - path[i - 1].x, path[i].z - path[i - 1].z);
+        const glm::vec2 out = glm::vec2(path[i + 1].x - path[i].x, path[i + 1].z - path[i].z);
+        cornersTurn &= glm::abs(in.x * out.y - in.y * out.x) > 1e-3f;
+        roundsWallEnd |= path[i].z > WallMax.z && path[i].x > WallMin.x - 1.0f && path[i].x < WallMax.x + 1.0f;
+    }
+    failures += !Check("string pulled corners are turns and round the end of the wall", cornersTurn && roundsWallEnd);
+
+    // Polygon corridors aren't exactly shortest, the taut path past the eroded wall corners is about 34.8
+    const float length = PathLength(path);
+    printf("nav mesh path: %u points, length %.2f\n", uint32_t(path.size()), length);
+    failures += !Check("string pulled path is close to the shortest way round", length > MinDetourLength && length < MaxDetourLength);
+    failures += !Check("nav mesh path stays out of the wall and the ledge", AvoidsBoxXZ(path, WallMin, WallMax) && AvoidsBoxXZ(path, LedgeMin, LedgeMax));
+
+    // Crosses several tiles in the open, so string pulling leaves just the two end points
+    std::vector<glm::vec3> straight;
+    failures += !Check("open ground gives a straight path", navMesh.FindPath(glm::vec3(2.0f, 0.0f, 18.5f), glm::vec3(18.0f, 0.0f, 18.5f), straight) && straight.size() == 2);
+
+    std::vector<glm::vec3> ledgePath;
+    failures += !Check("nav mesh finds no path onto a ledge too tall to climb", !navMesh.FindPath(start, glm::vec3(1.75f, LedgeMax.y, 10.5f), ledgePath));
+
+    // Blocking the gap dirties only the tile it sits in, well inside the tile's border
+    const Maths::BoundingBox gapBlocker(glm::vec3(8.8f, -1.0f, 16.8f), glm::vec3(11.2f, 3.0f, 20.5f));
+    const uint32_t obstacle = navMesh.AddObstacle(gapBlocker);
+    failures += !Check("adding an obstacle rebuilds one tile", navMesh.Update() == 1);
+    failures += !Check("an obstacle in the gap blocks the path", !navMesh.FindPath(start, end, path));
+    failures += !Check("nothing is left to rebuild", navMesh.Update() == 0);
+
+    // Moving it rebuilds the tile it left and the one it moved to
+    navMesh.MoveObstacle(obstacle, Maths::BoundingBox(glm::vec3(0.8f, -1.0f, 16.8f), glm::vec3(3.2f, 3.0f, 19.2f)));
+    failures += !Check("moving an obstacle rebuilds the old and new tiles", navMesh.Update() == 2);
+    failures += !Check("the path reopens once the obstacle moves away", navMesh.FindPath(start, end, path) && NearXZ(path.back(), end) && PathLength(path) < MaxDetourLength);
+
+    navMesh.RemoveObstacle(obstacle);
+    failures += !Check("removing an obstacle rebuilds its tile", navMesh.Update() == 1);
+
+    return failures;
+}
@@ -0,0 +1,60 @@
+#include "Tests.h"
+#include <Lumos/Core/Core.h>
+#include <Lumos/Graphics/Mesh.h>
+#include <Lumos/Graphics/Renderers/OcclusionCuller.h>
+#include <Lumos/Maths/BoundingBox.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <cstdio>
+
+// Rasterises one large occluder quad on the CPU and checks boxes behind, in front of and beside it
+
+using namespace Lumos;
+
+namespace
+{
+    bool CheckOccluded(const char* name, const Graphics::OcclusionCuller& culler, const glm::vec3& centre, float halfExtent, bool expected)
+    {
+        const Maths::BoundingBox bounds(centre - glm::vec3(halfExtent), centre + glm::vec3(halfExtent));
+        return Check(name, culler.IsOccluded(bounds) == expected);
+    }
+}
+
+uint32_t RunOcclusionCullerTests()
+{
+    // Looking down -z, the quad fills the middle of the view 10 units away
+    const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 2.0f, 0.1f, 100.0f);
+    const glm::mat4 view       = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+    std::vector<Graphics::Vertex> vertices(4);
+    vertices[0].Position = glm::vec3(-5.0f, -5.0f, 0.0f);
+    vertices[1].Position = glm::vec3(5.0f, -5.0f, 0.0f);
+    vertices[2].Position = glm::vec3(5.0f, 5.0f, 0.0f);
+    vertices[3].Position = glm::vec3(-5.0f, 5.0f, 0.0f);
+
+    const std::vector<uint32_t> indices = { 0, 1, 2, 0, 2, 3 };
+    const glm::mat4 transform           = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -10.0f));
+
+    Graphics::OcclusionCuller culler;
+    uint32_t failures = 0;
+
+    culler.BeginFrame(projection * view);
+    failures += !CheckOccluded("nothing occludes before rasterising", culler, glm::vec3(0.0f, 0.0f, -20.0f), 1.0f, false);
+
+    culler.AddOccluderCandidate(vertices, indices, transform, 1.0f);
+    culler.Rasterise();
+
+    failures += !Check("occluder rasterised", culler.GetOccluderCount() == 1 && culler.GetTriangleCount() == 2);
+    failures += !CheckOccluded("box behind the occluder is hidden", culler, glm::vec3(0.0f, 0.0f, -20.0f), 1.0f, true);
+    failures += !CheckOccluded("box in front of the occluder is visible", culler, glm::vec3(0.0f, 0.0f, -5.0f), 0.5f, false);
+    failures += !CheckOccluded("box beside the occluder is visible", culler, glm::vec3(15.0f, 0.0f, -20.0f), 1.0f, false);
+    failures += !CheckOccluded("box straddling the occluder edge is visible", culler, glm::vec3(9.5f, 0.0f, -20.0f), 1.0f, false);
+    failures += !CheckOccluded("box crossing the occluder plane is visible", culler, glm::vec3(0.0f, 0.0f, -10.0f), 1.0f, false);
+
+    // Nothing carries over into the next frame
+    culler.BeginFrame(projection * view);
+    culler.Rasterise();
+    failures += !CheckOccluded("box is visible once the occluder is gone", culler, glm::vec3(0.0f, 0.0f, -20.0f), 1.0f, false);
+
+    return failures;
+}
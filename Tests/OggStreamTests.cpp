@@ -0,0 +1,128 @@
+#include "Tests.h"
+#include <Lumos/Core/Core.h>
+#include <Lumos/Audio/OggLoader.h>
+#include <Lumos/Utilities/Timer.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <thread>
+
+// Decodes the example project's music through OggStream into a null sink, with no audio device.
+// Prints how much faster than real time it decodes, and checks the streamed samples match a whole file decode
+
+using namespace Lumos;
+
+namespace
+{
+    const char* MusicFile = "ExampleProject/Assets/Sounds/ambientguitar.ogg";
+
+    // How far above the working directory to look for the example project
+    const uint32_t SearchDepth = 4;
+
+    // Decoding has to keep up with playback by a wide margin
+    const double MinRealTimeFactor = 4.0;
+
+    std::string FindExampleFile(const char* relativePath)
+    {
+        std::filesystem::path folder = std::filesystem::current_path();
+        for(uint32_t i = 0; i <= SearchDepth; i++)
+        {
+            if(std::filesystem::exists(folder / relativePath))
+                return (folder / relativePath).string();
+            folder = folder.parent_path();
+        }
+        return "";
+    }
+
+    // Consumes chunks as fast as the decode jobs produce them, the way a source drains its queued buffers.
+    // Stops after maxSamples so a looping stream ends
+    std::vector<int16_t> DrainStream(OggStream& stream, size_t maxSamples)
+    {
+        std::vector<int16_t> samples;
+        stream.RequestDecode();
+        while(!stream.IsFinished() && samples.size() < maxSamples)
+        {
+            const OggStream::Chunk* chunk = stream.FrontChunk();
+            if(!chunk)
+            {
+                std::this_thread::yield();
+                stream.RequestDecode();
+                continue;
+            }
+
+            samples.insert(samples.end(), chunk->Samples.begin(), chunk->Samples.begin() + chunk->SampleCount);
+            stream.PopChunk();
+            stream.RequestDecode();
+        }
+        return samples;
+    }
+
+    bool SameSamples(const std::vector<int16_t>& samples, const AudioData& data)
+    {
+        return samples.size() * sizeof(int16_t) == data.Data.size() && memcmp(samples.data(), data.Data.data(), data.Data.size()) == 0;
+    }
+}
+
+uint32_t RunOggStreamTests()
+{
+    const std::string musicPath = FindExampleFile(MusicFile);
+    if(musicPath.empty())
+    {
+        printf("ogg stream: %s not found, skipped\n", MusicFile);
+        return 0;
+    }
+
+    uint32_t failures = 0;
+    for(bool preserveStereo : { false, true })
+    {
+        OggStream stream;
+        if(!Check(preserveStereo ? "ogg stream opens in stereo" : "ogg stream opens down mixed to mono", stream.Open(musicPath, preserveStereo) && stream.GetChannels() == (preserveStereo ? 2u : 1u)))
+        {
+            failures++;
+            continue;
+        }
+
+        Timer timer;
+        const std::vector<int16_t> streamed = DrainStream(stream, SIZE_MAX);
+        const double decodeTime             = timer.GetElapsedMSD();
+        const double factor                 = stream.GetLength() / std::max(decodeTime, 1e-3);
+        printf("ogg stream: %u channel %.1fs decoded to a null sink in %.1fms, %.0fx real time\n", stream.GetChannels(), stream.GetLength() * 0.001, decodeTime, factor);
+
+        failures += !Check("ogg stream decodes faster than real time", factor > MinRealTimeFactor);
+        failures += !Check("ogg stream finishes the file", stream.IsFinished() && !stream.FrontChunk());
+        failures += !Check("streamed samples match a whole file decode", SameSamples(streamed, LoadOgg(musicPath, preserveStereo)));
+
+        // The same handle can still be decoded whole, the way short sounds are loaded
+        failures += !Check("ogg stream reads the whole file after streaming", SameSamples(streamed, stream.ReadAll()));
+    }
+
+    // Voices playing the same sound read one encoded file, each through its own decoder. Seeking one mustn't move the other
+    {
+        SharedPtr<OggFile> file = CreateSharedPtr<OggFile>(musicPath);
+        OggStream first;
+        OggStream second;
+        const bool opened = first.Open(file, false) && second.Open(file, false);
+        first.Seek(first.GetLength() * 0.5);
+
+        const std::vector<int16_t> whole = DrainStream(second, SIZE_MAX);
+        const std::vector<int16_t> half  = DrainStream(first, SIZE_MAX);
+        failures += !Check("streams sharing an encoded file decode independently", opened && SameSamples(whole, LoadOgg(musicPath, false)) && half.size() < whole.size() * 55 / 100);
+    }
+
+    // Looping carries on past the end of the file, seeking restarts part way through
+    OggStream stream;
+    stream.Open(musicPath, false);
+    const size_t fileSamples = size_t(stream.GetLength() * 0.001 * stream.GetSampleRate());
+
+    stream.SetLooping(true);
+    failures += !Check("looping ogg stream runs past the end of the file", DrainStream(stream, fileSamples * 2).size() >= fileSamples * 2 && !stream.IsFinished());
+
+    stream.SetLooping(false);
+    stream.Seek(stream.GetLength() * 0.5);
+    const size_t remaining = DrainStream(stream, SIZE_MAX).size();
+    failures += !Check("seeking half way leaves half the file", remaining > fileSamples * 45 / 100 && remaining < fileSamples * 55 / 100);
+
+    return failures;
+}
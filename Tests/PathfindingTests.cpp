@@ -0,0 +1,210 @@
+#include "Tests.h"
+#include <Lumos/Core/Core.h>
+#include <Lumos/Core/Reference.h>
+#include <Lumos/AI/AStar.h>
+#include <Lumos/AI/PathEdge.h>
+#include <Lumos/AI/PathNode.h>
+
+#include <cfloat>
+#include <cstdio>
+#include <random>
+
+// Checks A* on a synthetic grid with blocked and weighted edges against a brute force Dijkstra
+
+using namespace Lumos;
+
+namespace
+{
+    const uint32_t GridSize     = 24;
+    const uint32_t SearchCount  = 64;
+    const float CostTolerance   = 1e-3f;
+    const float BlockedFraction = 0.4f;
+
+    struct Grid
+    {
+        std::vector<UniquePtr<PathNode>> Nodes;
+        std::vector<UniquePtr<PathEdge>> Edges;
+        std::vector<PathNode*> NodePointers;
+
+        uint32_t Index(uint32_t x, uint32_t y) const { return x + y * GridSize; }
+    };
+
+    // Weights stay at or above one so the straight line heuristic is admissible. Enough edges are
+    // blocked to cut some nodes off from the rest
+    void BuildGrid(Grid& grid)
+    {
+        std::mt19937 generator(42);
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+        for(uint32_t y = 0; y < GridSize; y++)
+        {
+            for(uint32_t x = 0; x < GridSize; x++)
+            {
+                grid.Nodes.push_back(CreateUniquePtr<PathNode>(glm::vec3(float(x), 0.0f, float(y))));
+                grid.NodePointers.push_back(grid.Nodes.back().get());
+            }
+        }
+
+        auto connect = [&](uint32_t a, uint32_t b)
+        {
+            grid.Edges.push_back(CreateUniquePtr<PathEdge>(grid.NodePointers[a], grid.NodePointers[b]));
+            grid.Edges.back()->SetWeight(1.0f + 2.0f * unit(generator));
+            grid.Edges.back()->SetTraversable(unit(generator) > BlockedFraction);
+        };
+
+        for(uint32_t y = 0; y < GridSize; y++)
+        {
+            for(uint32_t x = 0; x < GridSize; x++)
+            {
+                if(x + 1 < GridSize)
+                    connect(grid.Index(x, y), grid.Index(x + 1, y));
+                if(y + 1 < GridSize)
+                    connect(grid.Index(x, y), grid.Index(x, y + 1));
+            }
+        }
+    }
+
+    // O(n^2) Dijkstra over the same edges, FLT_MAX when unreachable
+    float Dijkstra(const Grid& grid, uint32_t start, uint32_t end)
+    {
+        const size_t count = grid.NodePointers.size();
+        std::vector<float> distance(count, FLT_MAX);
+        std::vector<bool> done(count, false);
+        distance[start] = 0.0f;
+
+        for(size_t iteration = 0; iteration < count; iteration++)
+        {
+            uint32_t current = QueueablePathNode::InvalidIndex;
+            for(uint32_t i = 0; i < count; i++)
+            {
+                if(!done[i] && distance[i] < FLT_MAX && (current == QueueablePathNode::InvalidIndex || distance[i] < distance[current]))
+                    current = i;
+            }
+
+            if(current == QueueablePathNode::InvalidIndex || current == end)
+                break;
+
+            done[current]  = true;
+            PathNode* node = grid.NodePointers[current];
+            for(size_t i = 0; i < node->NumConnections(); i++)
+            {
+                PathEdge* edge = node->Edge(i);
+                if(!edge->Traversable())
+                    continue;
+
+                const auto other  = std::find(grid.NodePointers.begin(), grid.NodePointers.end(), edge->OtherNode(node));
+                const size_t next = size_t(other - grid.NodePointers.begin());
+                distance[next]    = std::min(distance[next], distance[current] + edge->Cost());
+            }
+        }
+
+        return distance[end];
+    }
+
+    // Every step has to follow a traversable edge, and their costs have to add up to the reported cost
+    bool IsValidPath(const std::vector<PathNode*>& path, PathNode* start, PathNode* end, float cost)
+    {
+        if(path.empty() || path.front() != start || path.back() != end)
+            return false;
+
+        float total = 0.0f;
+        for(size_t i = 0; i + 1 < path.size(); i++)
+        {
+            float step = FLT_MAX;
+            for(size_t j = 0; j < path[i]->NumConnections(); j++)
+            {
+                PathEdge* edge = path[i]->Edge(j);
+                if(edge->Traversable() && edge->OtherNode(path[i]) == path[i + 1])
+                    step = std::min(step, edge->Cost());
+            }
+
+            if(step == FLT_MAX)
+                return false;
+            total += step;
+        }
+
+        return std::abs(total - cost) < CostTolerance;
+    }
+}
+
+uint32_t RunPathfindingTests()
+{
+    Grid grid;
+    BuildGrid(grid);
+
+    AStar astar(grid.NodePointers);
+    astar.PrepareSearch();
+
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<uint32_t> pickNode(0, GridSize * GridSize - 1);
+
+    uint32_t failures = 0;
+    uint32_t found    = 0;
+    uint32_t missed   = 0;
+    bool costsMatch   = true;
+    bool pathsValid   = true;
+    bool reuseMatches = true;
+
+    // The AStar's own scratch is reused for every search, a fresh one per search must agree with it
+    for(uint32_t i = 0; i < SearchCount; i++)
+    {
+        PathNode* start = grid.NodePointers[pickNode(generator)];
+        PathNode* end   = grid.NodePointers[pickNode(generator)];
+
+        const bool hit      = astar.FindPath(start, end);
+        const float optimal = Dijkstra(grid, astar.GetNodeIndex(start), astar.GetNodeIndex(end));
+
+        if(hit != (optimal < FLT_MAX) || (hit && std::abs(astar.PathCost() - optimal) > CostTolerance))
+            costsMatch = false;
+        if(hit && !IsValidPath(astar.Path(), start, end, astar.PathCost()))
+            pathsValid = false;
+        if(!hit && !astar.Path().empty())
+            pathsValid = false;
+
+        AStar::SearchScratch fresh;
+        std::vector<PathNode*> freshPath;
+        float freshCost = 0.0f;
+        if(astar.FindPath(start, end, fresh, freshPath, freshCost) != hit || freshPath != astar.Path() || freshCost != astar.PathCost())
+            reuseMatches = false;
+
+        hit ? found++ : missed++;
+    }
+
+    printf("A* searches: %u found, %u unreachable\n", found, missed);
+    failures += !Check("A* finds exactly the reachable pairs at the Dijkstra cost", costsMatch);
+    failures += !Check("A* paths follow traversable edges and sum to their cost", pathsValid);
+    failures += !Check("A* covers both reachable and unreachable pairs", found > 0 && missed > 0);
+    failures += !Check("A* reused scratch matches a fresh scratch", reuseMatches);
+
+    // Walling off a node leaves it unreachable from everywhere else
+    PathNode* walled = grid.NodePointers[grid.Index(GridSize / 2, GridSize / 2)];
+    for(size_t i = 0; i < walled->NumConnections(); i++)
+        walled->Edge(i)->SetTraversable(false);
+
+    failures += !Check("A* reports no path to a walled off node", !astar.FindPath(grid.NodePointers[0], walled) && astar.Path().empty() && astar.PathCost() == 0.0f);
+    failures += !Check("A* finds the trivial path from a walled off node to itself", astar.FindPath(walled, walled) && astar.Path().size() == 1);
+
+    PathNode outsider(glm::vec3(-1.0f));
+    failures += !Check("A* rejects nodes outside the graph", !astar.FindPath(&outsider, grid.NodePointers[0]));
+
+    // Stamps left by earlier searches must not leak into a search after the generation wraps around
+    AStar::SearchScratch wrapping;
+    std::vector<PathNode*> path;
+    float cost          = 0.0f;
+    PathNode* start     = grid.NodePointers[grid.Index(1, 1)];
+    PathNode* end       = grid.NodePointers[grid.Index(GridSize - 2, GridSize - 2)];
+    const float optimal = Dijkstra(grid, astar.GetNodeIndex(start), astar.GetNodeIndex(end));
+
+    bool wrapMatches = true;
+    astar.FindPath(start, end, wrapping, path, cost);
+    wrapping.Generation = UINT32_MAX;
+    for(uint32_t i = 0; i < 3; i++)
+    {
+        const bool hit = astar.FindPath(start, end, wrapping, path, cost);
+        if(hit != (optimal < FLT_MAX) || (hit && std::abs(cost - optimal) > CostTolerance))
+            wrapMatches = false;
+    }
+    failures += !Check("A* scratch stays valid across a generation wrap", wrapMatches && wrapping.Generation == 3);
+
+    return failures;
+}
@@ -0,0 +1,17 @@
+#pragma once
+#include <cstdint>
+
+// Prints a PASS or FAIL line for one check and returns whether it passed
+bool Check(const char* name, bool passed);
+
+// Each suite prints a PASS or FAIL line per check and returns how many failed
+uint32_t RunNarrowphaseTests();
+uint32_t RunFileSystemTests();
+uint32_t RunOcclusionCullerTests();
+uint32_t RunLightClustersTests();
+uint32_t RunPathfindingTests();
+uint32_t RunNavMeshTests();
+uint32_t RunLuaScriptTests();
+uint32_t RunVoiceAllocatorTests();
+uint32_t RunOggStreamTests();
+uint32_t RunAnimationControllerTests();
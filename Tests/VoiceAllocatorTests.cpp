@@ -0,0 +1,212 @@
+#include "Tests.h"
+#include <Lumos/Core/Core.h>
+#include <Lumos/Audio/Sound.h>
+#include <Lumos/Audio/SoundNode.h>
+#include <Lumos/Audio/VoiceAllocator.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+// Ranks emitters into a small voice pool, moves them across the real/virtual split as their
+// loudness changes, and checks a virtual sound node keeps its place in the sound
+
+using namespace Lumos;
+
+namespace
+{
+    const uint32_t VoiceCount   = 8;
+    const uint32_t EmitterCount = 32;
+
+    // Virtual nodes advance by the clock, in milliseconds scaled by pitch
+    const double ClipLength        = 1000.0;
+    const float FrameTime          = 10.0f;
+    const float Pitch              = 1.5f;
+    const double PositionTolerance = 1e-3;
+
+    // A sound with a length and no data, enough for a node that never gets a voice
+    class ClipSound : public Sound
+    {
+    public:
+        ClipSound(double length) { m_Data.Length = length; }
+    };
+
+    float Score(const VoiceAllocator::Request& request)
+    {
+        return request.Priority * request.Gain;
+    }
+
+    // Real voices are in range and no two emitters share one
+    bool VoicesUnique(const std::vector<VoiceAllocator::Request>& requests, uint32_t voiceCount)
+    {
+        std::vector<bool> used(voiceCount, false);
+        for(const auto& request : requests)
+        {
+            if(request.Voice == VoiceAllocator::VirtualVoice)
+                continue;
+            if(request.Voice < 0 || request.Voice >= int32_t(voiceCount) || used[request.Voice])
+                return false;
+            used[request.Voice] = true;
+        }
+        return true;
+    }
+
+    // The real emitters are exactly the loudest ones by priority × gain
+    bool LoudestAreReal(const std::vector<VoiceAllocator::Request>& requests, uint32_t voiceCount)
+    {
+        std::vector<float> scores;
+        for(const auto& request : requests)
+            scores.push_back(Score(request));
+        std::sort(scores.begin(), scores.end(), std::greater<float>());
+        const float threshold = scores[std::min(voiceCount, uint32_t(scores.size())) - 1];
+
+        for(const auto& request : requests)
+        {
+            if((request.Voice != VoiceAllocator::VirtualVoice) != (Score(request) >= threshold))
+                return false;
+        }
+        return true;
+    }
+
+    uint32_t RealCount(const std::vector<VoiceAllocator::Request>& requests)
+    {
+        return uint32_t(std::count_if(requests.begin(), requests.end(), [](const VoiceAllocator::Request& request)
+                                      { return request.Voice != VoiceAllocator::VirtualVoice; }));
+    }
+
+    uint32_t WeakestReal(const std::vector<VoiceAllocator::Request>& requests)
+    {
+        uint32_t weakest = UINT32_MAX;
+        for(uint32_t i = 0; i < uint32_t(requests.size()); i++)
+        {
+            if(requests[i].Voice != VoiceAllocator::VirtualVoice && (weakest == UINT32_MAX || Score(requests[i]) < Score(requests[weakest])))
+                weakest = i;
+        }
+        return weakest;
+    }
+
+    uint32_t FirstVirtual(const std::vector<VoiceAllocator::Request>& requests)
+    {
+        for(uint32_t i = 0; i < uint32_t(requests.size()); i++)
+        {
+            if(requests[i].Voice == VoiceAllocator::VirtualVoice)
+                return i;
+        }
+        return UINT32_MAX;
+    }
+
+    // Advances a node by whole frames
+    void Advance(SoundNode* node, uint32_t frames)
+    {
+        for(uint32_t i = 0; i < frames; i++)
+            node->OnUpdate(FrameTime);
+    }
+}
+
+uint32_t RunVoiceAllocatorTests()
+{
+    std::mt19937 generator(11);
+    std::uniform_real_distribution<float> priority(0.5f, 4.0f);
+    std::uniform_real_distribution<float> gain(0.05f, 1.0f);
+
+    // Distinct scores, so the loudest set is well defined
+    std::vector<VoiceAllocator::Request> requests(EmitterCount);
+    for(auto& request : requests)
+    {
+        request.Priority = priority(generator);
+        request.Gain     = gain(generator);
+    }
+
+    VoiceAllocator allocator(VoiceCount);
+    allocator.Allocate(requests);
+
+    uint32_t failures = 0;
+    failures += !Check("allocator fills the pool and leaves the rest virtual", allocator.GetRealCount() == VoiceCount && allocator.GetVirtualCount() == EmitterCount - VoiceCount && RealCount(requests) == VoiceCount);
+    failures += !Check("real voices go to the loudest by priority x gain", LoudestAreReal(requests, VoiceCount));
+    failures += !Check("real voices are unique and in range", VoicesUnique(requests, VoiceCount));
+
+    // Nothing changed, so every emitter keeps the voice it had
+    std::vector<VoiceAllocator::Request> previous = requests;
+    allocator.Allocate(requests);
+    bool stable = true;
+    for(uint32_t i = 0; i < EmitterCount; i++)
+        stable &= requests[i].Voice == previous[i].Voice;
+    failures += !Check("unchanged emitters keep their voices", stable);
+
+    // A virtual emitter getting much louder takes the voice of the weakest real one, the rest stay put
+    const uint32_t promoted = FirstVirtual(requests);
+    const uint32_t demoted  = WeakestReal(requests);
+    const int32_t freed     = requests[demoted].Voice;
+
+    requests[promoted].Priority = 10.0f;
+    requests[promoted].Gain     = 1.0f;
+    previous                    = requests;
+    allocator.Allocate(requests);
+
+    bool othersKept = true;
+    for(uint32_t i = 0; i < EmitterCount; i++)
+    {
+        if(i != promoted && i != demoted)
+            othersKept &= requests[i].Voice == previous[i].Voice;
+    }
+    failures += !Check("a louder virtual emitter is promoted into the freed voice", requests[promoted].Voice == freed);
+    failures += !Check("the weakest real emitter is demoted", requests[demoted].Voice == VoiceAllocator::VirtualVoice);
+    failures += !Check("promotion leaves every other voice where it was", othersKept && VoicesUnique(requests, VoiceCount));
+
+    // Just edging past the weakest real emitter isn't enough to take its voice
+    const uint32_t weakest    = WeakestReal(requests);
+    const uint32_t challenger = FirstVirtual(requests);
+
+    requests[challenger].Priority = requests[weakest].Priority;
+    requests[challenger].Gain     = requests[weakest].Gain * 1.05f;
+    allocator.Allocate(requests);
+    failures += !Check("a slightly louder virtual emitter doesn't swap with a real one", requests[challenger].Voice == VoiceAllocator::VirtualVoice && requests[weakest].Voice != VoiceAllocator::VirtualVoice);
+
+    // Stopped, silent and zero priority emitters give their voices up and nothing takes the spare ones
+    std::vector<VoiceAllocator::Request> quiet(4);
+    quiet[1].Playing  = false;
+    quiet[2].Gain     = 0.0f;
+    quiet[3].Priority = 0.0f;
+    for(uint32_t i = 0; i < uint32_t(quiet.size()); i++)
+        quiet[i].Voice = int32_t(i);
+    allocator.Allocate(quiet);
+    failures += !Check("inaudible emitters never hold a voice", quiet[0].Voice == 0 && RealCount(quiet) == 1 && allocator.GetRealCount() == 1);
+
+    // Shrinking the pool demotes emitters holding voices past its end
+    allocator.SetVoiceCount(VoiceCount / 2);
+    allocator.Allocate(requests);
+    failures += !Check("a smaller pool keeps the loudest in range", RealCount(requests) == VoiceCount / 2 && VoicesUnique(requests, VoiceCount / 2) && LoudestAreReal(requests, VoiceCount / 2));
+
+    failures += !Check("gain is full volume inside the reference distance", VoiceAllocator::AttenuatedGain(glm::vec3(0.0f), glm::vec3(0.5f, 0.0f, 0.0f), 0.8f, 1.0f, 11.0f, 1.0f) == 0.8f);
+    failures += !Check("gain falls linearly to the max distance", std::abs(VoiceAllocator::AttenuatedGain(glm::vec3(0.0f), glm::vec3(6.0f, 0.0f, 0.0f), 0.8f, 1.0f, 11.0f, 1.0f) - 0.4f) < 1e-5f);
+    failures += !Check("gain is silent past the max distance", VoiceAllocator::AttenuatedGain(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 50.0f), 0.8f, 1.0f, 11.0f, 1.0f) == 0.0f);
+
+    // A node without a voice still moves through its sound, so promoting it later resumes in the right place
+    SoundNode* node = SoundNode::Create();
+    if(!Check("sound node created", node != nullptr))
+        return failures + 1;
+
+    node->SetSound(CreateSharedPtr<ClipSound>(ClipLength));
+    node->SetPitch(Pitch);
+    node->SetLooping(true);
+    node->Resume();
+
+    Advance(node, 50);
+    failures += !Check("virtual node advances its playback position", node->GetVoice() == VoiceAllocator::VirtualVoice && std::abs(node->GetPlaybackPosition() - 750.0) < PositionTolerance);
+
+    node->Pause();
+    Advance(node, 20);
+    failures += !Check("paused virtual node holds its playback position", std::abs(node->GetPlaybackPosition() - 750.0) < PositionTolerance);
+
+    node->Resume();
+    Advance(node, 30);
+    failures += !Check("looping virtual node wraps its playback position", node->IsPlaying() && std::abs(node->GetPlaybackPosition() - 200.0) < PositionTolerance);
+
+    node->SetLooping(false);
+    Advance(node, 60);
+    failures += !Check("virtual node finishes a one shot sound by the clock", !node->IsPlaying() && node->GetPlaybackPosition() == 0.0);
+
+    delete node;
+    return failures;
+}
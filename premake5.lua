@@ -84,3 +84,7 @@ workspace( settings.workspace_name )
 	include "Lumos/premake5"
 	include "Runtime/premake5"
 	include "Editor/premake5"
+
+	if not os.istarget(premake.IOS) and not os.istarget(premake.ANDROID) then
+		include "Tests/premake5"
+	end